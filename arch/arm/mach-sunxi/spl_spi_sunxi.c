@@ -292,6 +292,7 @@ static int spl_spi_load_image(struct spl_image_info *spl_image,
 		load.filename = NULL;
 		load.bl_len = 1;
 		load.read = spi_load_read;
+		load.bdesc = NULL;
 		ret = spl_load_simple_fit(spl_image, &load,
 					  CONFIG_SYS_SPI_U_BOOT_OFFS, header);
 	} else {
@@ -7,11 +7,14 @@
 #include <common.h>
 #include <asm/types.h>
 #include <asm/asm.h>
+#include <asm/cache.h>
 #include <asm/csr.h>
 #include <common.h>
 #include <cpu_func.h>
 #include <fdt_support.h>
 
+DECLARE_GLOBAL_DATA_PTR;
+
 #ifdef CONFIG_TARGET_ICE_C910
 static phys_addr_t opensbi_addr, dtb_addr;
 void (*image_entry)(u32, phys_addr_t);
@@ -90,10 +93,62 @@ int cleanup_before_linux(void)
 	return 0;
 }
 
+/* MHCR cache enable bits */
+#define MHCR_IE		BIT(0)
+#define MHCR_DE		BIT(1)
+
+/*
+ * Whole-cache operations. The L1 ones only act on the calling hart,
+ * unlike the range operations below, which act on a line by physical
+ * address wherever it is cached.
+ */
+#define dcache_call()	asm volatile(".long 0x0010000b" ::: "memory")
+#define dcache_iall()	asm volatile(".long 0x0020000b" ::: "memory")
+#define dcache_ciall()	asm volatile(".long 0x0030000b" ::: "memory")
+#define icache_iall()	asm volatile(".long 0x0100000b" ::: "memory")
+#define l2cache_call()	asm volatile(".long 0x0150000b" ::: "memory")
+#define l2cache_ciall()	asm volatile(".long 0x0170000b" ::: "memory")
+
+/*
+ * Line operations by physical address reach every cache level, so beyond
+ * a certain size walking the caches once is cheaper than one instruction
+ * per line of the range. Only safe while the other harts' L1 caches hold
+ * nothing of ours, i.e. while they have not entered U-Boot.
+ */
+static inline bool dcache_range_use_all(unsigned long start, unsigned long end)
+{
+#ifdef CONFIG_SMP
+	if (gd->arch.available_harts & ~BIT(gd->arch.boot_hart))
+		return false;
+#endif
+
+	return end > start && end - start >= CONFIG_C9XX_CACHE_ALL_THRESHOLD;
+}
+
+void flush_dcache_all(void)
+{
+	dcache_call();
+	l2cache_call();
+	sync_is();
+}
+
+void invalidate_dcache_all(void)
+{
+	/* dirty lines of unrelated data must survive, so clean as well */
+	dcache_ciall();
+	l2cache_ciall();
+	sync_is();
+}
+
 void flush_dcache_range(unsigned long start, unsigned long end)
 {
 	register unsigned long i asm("a0") = start & ~(CONFIG_SYS_CACHELINE_SIZE - 1);
 
+	if (dcache_range_use_all(start, end)) {
+		flush_dcache_all();
+		return;
+	}
+
 	for (; i < end; i += CONFIG_SYS_CACHELINE_SIZE)
 		asm volatile(".long 0x0295000b");  /* dcache.cpa a0 */
 
@@ -104,6 +159,11 @@ void invalidate_dcache_range(unsigned long start, unsigned long end)
 {
 	register unsigned long i asm("a0") = start & ~(CONFIG_SYS_CACHELINE_SIZE - 1);
 
+	if (dcache_range_use_all(start, end)) {
+		invalidate_dcache_all();
+		return;
+	}
+
 	for (; i < end; i += CONFIG_SYS_CACHELINE_SIZE)
 		asm volatile(".long 0x02b5000b");  /* dcache.cipa a0 */
 
@@ -114,12 +174,49 @@ void invalid_dcache_range(unsigned long start, unsigned long end)
 {
 	register unsigned long i asm("a0") = start & ~(CONFIG_SYS_CACHELINE_SIZE - 1);
 
+	if (dcache_range_use_all(start, end)) {
+		invalidate_dcache_all();
+		return;
+	}
+
 	for (; i < end; i += CONFIG_SYS_CACHELINE_SIZE)
 		asm volatile(".long 0x02a5000b");  /* dcache.ipa a0 */
 
 	sync_is();
 }
 
+/*
+ * dcache.cipa cleans and invalidates in a single pass, which is all a
+ * buffer needs before the device reads or writes it. Once the device has
+ * written it, the clean lines fetched meanwhile only need dropping.
+ */
+void dma_sync_range_for_device(unsigned long addr, size_t len,
+			       enum dma_data_direction dir)
+{
+	unsigned long end = addr + ROUND(len, ARCH_DMA_MINALIGN);
+
+	if (dir == DMA_TO_DEVICE)
+		flush_dcache_range(addr, end);
+	else
+		invalidate_dcache_range(addr, end);
+}
+
+void dma_sync_range_for_cpu(unsigned long addr, size_t len,
+			    enum dma_data_direction dir)
+{
+	if (dir != DMA_TO_DEVICE)
+		invalid_dcache_range(addr, addr + ROUND(len, ARCH_DMA_MINALIGN));
+}
+
+int icache_status(void)
+{
+#if CONFIG_IS_ENABLED(RISCV_MMODE)
+	return !!(csr_read(CSR_MHCR) & MHCR_IE);
+#else
+	return 0;
+#endif
+}
+
 void icache_enable(void)
 {
 #ifdef CONFIG_SPL_BUILD
@@ -132,6 +229,30 @@ void icache_enable(void)
     );
 #endif
 #endif
+#elif defined(CONFIG_RISCV_MMODE)
+	if (!icache_status()) {
+		icache_iall();
+		sync_is();
+		csr_set(CSR_MHCR, MHCR_IE);
+	}
+#endif
+}
+
+void icache_disable(void)
+{
+#if CONFIG_IS_ENABLED(RISCV_MMODE)
+	csr_clear(CSR_MHCR, MHCR_IE);
+	icache_iall();
+	sync_is();
+#endif
+}
+
+int dcache_status(void)
+{
+#if CONFIG_IS_ENABLED(RISCV_MMODE)
+	return !!(csr_read(CSR_MHCR) & MHCR_DE);
+#else
+	return 0;
 #endif
 }
 
@@ -146,5 +267,26 @@ void dcache_enable(void)
     );
 #endif
 #endif
+#elif defined(CONFIG_RISCV_MMODE)
+	if (!dcache_status()) {
+		dcache_iall();
+		sync_is();
+		csr_set(CSR_MHCR, MHCR_DE);
+	}
+#endif
+}
+
+void dcache_disable(void)
+{
+#if CONFIG_IS_ENABLED(RISCV_MMODE)
+	if (!dcache_status())
+		return;
+
+	/* no memory access between the clean and the disable */
+	asm volatile (
+		".long 0x0030000b\n\t"	/* dcache.ciall */
+		".long 0x01b0000b\n\t"	/* sync.is */
+		"csrc 0x7c1, %0\n\t"
+		: : "r" (MHCR_DE) : "memory");
 #endif
 }
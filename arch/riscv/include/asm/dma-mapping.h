@@ -9,6 +9,7 @@
 #ifndef __ASM_RISCV_DMA_MAPPING_H
 #define __ASM_RISCV_DMA_MAPPING_H
 
+#include <cpu_func.h>
 #include <linux/dma-direction.h>
 
 #define dma_mapping_error(x, y)	0
@@ -27,12 +28,18 @@ static inline void dma_free_coherent(void *addr)
 static inline unsigned long dma_map_single(volatile void *vaddr, size_t len,
 					   enum dma_data_direction dir)
 {
-	return (unsigned long)vaddr;
+	unsigned long addr = (unsigned long)vaddr;
+
+	dma_sync_range_for_device(addr, len, dir);
+
+	return addr;
 }
 
+/* takes the mapping direction, not the bus address, as third argument */
 static inline void dma_unmap_single(volatile void *vaddr, size_t len,
-				    unsigned long paddr)
+				    enum dma_data_direction dir)
 {
+	dma_sync_range_for_cpu((unsigned long)vaddr, len, dir);
 }
 
 #endif /* __ASM_RISCV_DMA_MAPPING_H */
@@ -15,7 +15,7 @@
 /* Architecture-specific global data */
 struct arch_global_data {
 	long boot_hart;		/* boot hart id */
-#ifdef CONFIG_SIFIVE_CLINT
+#if (defined CONFIG_SIFIVE_CLINT) || (defined CONFIG_THEAD_IPI)
 	void __iomem *clint;	/* clint base address */
 #endif
 #if (defined CONFIG_ANDES_PLIC) || (defined CONFIG_THEAD_PLIC)
@@ -51,4 +51,21 @@ void handle_ipi(ulong hart);
  */
 int smp_call_function(ulong addr, ulong arg0, ulong arg1, int wait);
 
+/**
+ * smp_parallel_run() - Run a function on all available harts
+ *
+ * The function is called once on every hart, the calling hart included,
+ * and smp_parallel_run() returns when all calls have returned. Only harts
+ * that entered U-Boot and wait in the secondary hart loop take part.
+ *
+ * The function must only do computation on memory: drivers, console and
+ * malloc() are not safe to use from other harts.
+ *
+ * @func: Function to call, @idx is 0 on the calling hart and ranges up to
+ *        @nr - 1 across the harts
+ * @arg: Argument passed to the function
+ * @return number of harts the work was split across
+ */
+int smp_parallel_run(void (*func)(int idx, int nr, void *arg), void *arg);
+
 #endif
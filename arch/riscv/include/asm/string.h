@@ -12,6 +12,8 @@
 #ifndef __ASM_RISCV_STRING_H
 #define __ASM_RISCV_STRING_H
 
+#include <config.h>
+
 /*
  * We don't do inline string functions, since the
  * optimised inline asm versions are not small.
@@ -20,10 +22,30 @@
 #undef __HAVE_ARCH_STRRCHR
 #undef __HAVE_ARCH_STRCHR
 #undef __HAVE_ARCH_MEMCPY
+#if CONFIG_IS_ENABLED(USE_ARCH_MEMCPY)
+#define __HAVE_ARCH_MEMCPY
+#endif
+extern void *memcpy(void *, const void *, __kernel_size_t);
+
 #undef __HAVE_ARCH_MEMMOVE
+#if CONFIG_IS_ENABLED(USE_ARCH_MEMMOVE)
+#define __HAVE_ARCH_MEMMOVE
+#endif
+extern void *memmove(void *, const void *, __kernel_size_t);
+
+#undef __HAVE_ARCH_MEMCMP
+#if CONFIG_IS_ENABLED(USE_ARCH_MEMCMP)
+#define __HAVE_ARCH_MEMCMP
+#endif
+extern int memcmp(const void *, const void *, __kernel_size_t);
+
 #undef __HAVE_ARCH_MEMCHR
 #undef __HAVE_ARCH_MEMZERO
 #undef __HAVE_ARCH_MEMSET
+#if CONFIG_IS_ENABLED(USE_ARCH_MEMSET)
+#define __HAVE_ARCH_MEMSET
+#endif
+extern void *memset(void *, int, __kernel_size_t);
 
 #ifdef CONFIG_MARCO_MEMSET
 #define memset(_p, _v, _n)	\
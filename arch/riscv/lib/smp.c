@@ -9,6 +9,8 @@
 #include <dm.h>
 #include <asm/barrier.h>
 #include <asm/smp.h>
+#include <linux/bitops.h>
+#include <linux/compiler.h>
 
 DECLARE_GLOBAL_DATA_PTR;
 
@@ -44,11 +46,37 @@ extern int riscv_clear_ipi(int hart);
  */
 extern int riscv_get_ipi(int hart, int *pending);
 
+static int send_ipi_hart(int hart, struct ipi_data *ipi, int wait)
+{
+	int ret, pending;
+
+	gd->arch.ipi[hart].addr = ipi->addr;
+	gd->arch.ipi[hart].arg0 = ipi->arg0;
+	gd->arch.ipi[hart].arg1 = ipi->arg1;
+
+	ret = riscv_send_ipi(hart);
+	if (ret) {
+		pr_err("Cannot send IPI to hart %d\n", hart);
+		return ret;
+	}
+
+	if (wait) {
+		pending = 1;
+		while (pending) {
+			ret = riscv_get_ipi(hart, &pending);
+			if (ret)
+				return ret;
+		}
+	}
+
+	return 0;
+}
+
 static int send_ipi_many(struct ipi_data *ipi, int wait)
 {
 	ofnode node, cpus;
 	u32 reg;
-	int ret, pending;
+	int ret;
 
 	cpus = ofnode_path("/cpus");
 	if (!ofnode_valid(cpus)) {
@@ -82,24 +110,9 @@ static int send_ipi_many(struct ipi_data *ipi, int wait)
 			continue;
 #endif
 
-		gd->arch.ipi[reg].addr = ipi->addr;
-		gd->arch.ipi[reg].arg0 = ipi->arg0;
-		gd->arch.ipi[reg].arg1 = ipi->arg1;
-
-		ret = riscv_send_ipi(reg);
-		if (ret) {
-			pr_err("Cannot send IPI to hart %d\n", reg);
+		ret = send_ipi_hart(reg, ipi, wait);
+		if (ret)
 			return ret;
-		}
-
-		if (wait) {
-			pending = 1;
-			while (pending) {
-				ret = riscv_get_ipi(reg, &pending);
-				if (ret)
-					return ret;
-			}
-		}
 	}
 
 	return 0;
@@ -144,3 +157,76 @@ int smp_call_function(ulong addr, ulong arg0, ulong arg1, int wait)
 
 	return ret;
 }
+
+#ifndef CONFIG_XIP
+struct smp_work {
+	void (*func)(int idx, int nr, void *arg);
+	void *arg;
+	ulong harts;		/* harts running the work, boot hart excluded */
+	int nr;
+	int done[CONFIG_NR_CPUS];
+};
+
+static int smp_work_index(ulong harts, ulong hart)
+{
+	return 1 + hweight32(harts & (BIT(hart) - 1));
+}
+
+static void smp_work_run(ulong hart, ulong arg0, ulong arg1)
+{
+	struct smp_work *work = (struct smp_work *)arg0;
+
+	work->func(smp_work_index(work->harts, hart), work->nr, work->arg);
+
+	__smp_mb();
+	WRITE_ONCE(work->done[hart], 1);
+}
+
+static ulong smp_work_harts(void)
+{
+	return gd->arch.available_harts & ~BIT(gd->arch.boot_hart);
+}
+
+int smp_parallel_run(void (*func)(int idx, int nr, void *arg), void *arg)
+{
+	struct smp_work work = {
+		.func = func,
+		.arg = arg,
+	};
+	struct ipi_data ipi = {
+		.addr = (ulong)smp_work_run,
+		.arg0 = (ulong)&work,
+	};
+	ulong sent = 0;
+	int hart;
+
+	work.harts = smp_work_harts();
+	work.nr = 1 + hweight32(work.harts);
+	__smp_mb();
+
+	for (hart = 0; hart < CONFIG_NR_CPUS; hart++) {
+		if (!(work.harts & BIT(hart)))
+			continue;
+		if (!send_ipi_hart(hart, &ipi, 1))
+			sent |= BIT(hart);
+	}
+
+	func(0, work.nr, arg);
+
+	/* do the share of any hart that could not be reached here */
+	for (hart = 0; hart < CONFIG_NR_CPUS; hart++) {
+		if ((work.harts & ~sent) & BIT(hart))
+			func(smp_work_index(work.harts, hart), work.nr, arg);
+	}
+
+	for (hart = 0; hart < CONFIG_NR_CPUS; hart++) {
+		if (!(sent & BIT(hart)))
+			continue;
+		while (!READ_ONCE(work.done[hart]))
+			;
+	}
+	__smp_mb();
+
+	return work.nr;
+}
+#endif
@@ -4,17 +4,47 @@
  * SPDX-License-Identifier: GPL-2.0+
  */
 
+#include <common.h>
+#include <asm/csr.h>
+#include <asm/io.h>
+
+DECLARE_GLOBAL_DATA_PTR;
+
+/*
+ * The C9xx cluster CLINT sits at a fixed offset from the PLIC, whose base
+ * is reported by the mapbaddr CSR, so no device tree node is needed.
+ */
+#define CLINT_PLIC_OFFSET	0x4000000
+
+/* MSIP registers */
+#define MSIP_REG(base, hart)	((ulong)(base) + (hart) * 4)
+
+static void __iomem *thead_clint_base(void)
+{
+	if (!gd->arch.clint)
+		gd->arch.clint = (void __iomem *)(csr_read(CSR_PLIC_BASE) +
+						  CLINT_PLIC_OFFSET);
+
+	return gd->arch.clint;
+}
+
 int riscv_send_ipi(int hart)
 {
+	writel(1, (void __iomem *)MSIP_REG(thead_clint_base(), hart));
+
 	return 0;
 }
 
 int riscv_clear_ipi(int hart)
 {
+	writel(0, (void __iomem *)MSIP_REG(thead_clint_base(), hart));
+
 	return 0;
 }
 
 int riscv_get_ipi(int hart, int *pending)
 {
+	*pending = readl((void __iomem *)MSIP_REG(thead_clint_base(), hart));
+
 	return 0;
 }
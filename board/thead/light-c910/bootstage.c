@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * SPDX-License-Identifier: GPL-2.0+
+ */
+
+#include <common.h>
+#include <div64.h>
+
+/* Matches timebase-frequency in the light device trees */
+#define LIGHT_TIMEBASE_FREQ	3000000
+
+extern int riscv_get_time(u64 *time);
+
+/*
+ * mtime runs from reset and is shared by SPL and U-Boot proper, so the
+ * records stashed by SPL line up with the ones added later. Read it
+ * directly: bootstage starts long before the timer uclass is up.
+ */
+ulong timer_get_boot_us(void)
+{
+	u64 ticks;
+
+	riscv_get_time(&ticks);
+
+	return lldiv(ticks, LIGHT_TIMEBASE_FREQ / 1000000);
+}
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0+
+#
+# Copyright (C) 2017-2020 Alibaba Group Holding Limited
+#
+# Convert a PhyInit generated lp4*_phy_train1d2d.c into the packed form used
+# by the SPL DDR PHY engine (lpddr4/src/ddr_phy_fw.c):
+#
+#  - the ICCM/DCCM training firmware arrays become LZ4 compressed images,
+#    split in independently decodable chunks so that SPL can stream them
+#    into the PHY through a small buffer. The ICCM images are identical
+#    for all configurations and live in ddr_phy_fw/lp4_pmu_train_imem.c.
+#  - runs of straight-line ddr_phy_reg_wr() calls become (address, value)
+#    tables written by ddr_phy_reg_seq_wr().
+#
+# Usage:
+#   ddr_phy_fw_pack.py <phyinit.c> [-o <out.c>] [--imem <imem.c>]
+
+import argparse
+import re
+import struct
+import sys
+
+CHUNK = 4096		# decoded bytes per LZ4 frame, DDR_PHY_FW_CHUNK
+MIN_RUN = 4		# shorter runs of register writes are kept as code
+
+IMAGES = {
+    'iccm_array': '&lp4_pmu_train_1d_imem',
+    'iccm_array1': '&lp4_pmu_train_2d_imem',
+    'dccm_array': '&dccm_1d',
+    'dccm_array1': '&dccm_2d',
+}
+
+PRIME1, PRIME2, PRIME3 = 2654435761, 2246822519, 3266489917
+PRIME4, PRIME5 = 668265263, 374761393
+
+
+def rotl32(x, r):
+    return ((x << r) | (x >> (32 - r))) & 0xffffffff
+
+
+def xxh32(data, seed=0):
+    """xxHash32 of short inputs, enough for the LZ4 frame header checksum"""
+    h = (seed + PRIME5 + len(data)) & 0xffffffff
+    i = 0
+    while i + 4 <= len(data):
+        h = (h + struct.unpack_from('<I', data, i)[0] * PRIME3) & 0xffffffff
+        h = (rotl32(h, 17) * PRIME4) & 0xffffffff
+        i += 4
+    while i < len(data):
+        h = (h + data[i] * PRIME5) & 0xffffffff
+        h = (rotl32(h, 11) * PRIME1) & 0xffffffff
+        i += 1
+    h ^= h >> 15
+    h = (h * PRIME2) & 0xffffffff
+    h ^= h >> 13
+    h = (h * PRIME3) & 0xffffffff
+    h ^= h >> 16
+    return h
+
+
+def lz4_len(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def lz4_sequence(lit, mlen, off):
+    out = bytearray()
+    tok_l = min(len(lit), 15)
+    tok_m = 0 if mlen is None else min(mlen - 4, 15)
+    out.append(tok_l << 4 | tok_m)
+    if len(lit) >= 15:
+        out += lz4_len(len(lit) - 15)
+    out += lit
+    if mlen is not None:
+        out += struct.pack('<H', off)
+        if mlen - 4 >= 15:
+            out += lz4_len(mlen - 4 - 15)
+    return out
+
+
+def lz4_block(data):
+    """Greedy LZ4 block compressor honouring the end-of-block rules"""
+    n = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    mflimit = n - 12
+    while i < mflimit:
+        key = data[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > 0xffff:
+            i += 1
+            continue
+        mlen = 4
+        while i + mlen < n - 5 and data[cand + mlen] == data[i + mlen]:
+            mlen += 1
+        out += lz4_sequence(data[anchor:i], mlen, i - cand)
+        i += mlen
+        anchor = i
+    out += lz4_sequence(data[anchor:], None, 0)
+    return bytes(out)
+
+
+def lz4_frame(data):
+    desc = bytes([0x60, 0x40])	# version 1, independent blocks, 64KB max
+    out = bytearray(struct.pack('<I', 0x184d2204))
+    out += desc
+    out.append((xxh32(desc) >> 8) & 0xff)
+    blk = lz4_block(data)
+    if len(blk) >= len(data):
+        out += struct.pack('<I', len(data) | 0x80000000) + data
+    else:
+        out += struct.pack('<I', len(blk)) + blk
+    out += struct.pack('<I', 0)
+    return bytes(out)
+
+
+def pack_image(words):
+    raw = b''.join(struct.pack('<H', w & 0xffff) for w in words)
+    out = bytearray()
+    for off in range(0, len(raw), CHUNK):
+        frame = lz4_frame(raw[off:off + CHUNK])
+        out += struct.pack('<I', len(frame)) + frame
+    return bytes(out)
+
+
+def c_bytes(name, data, static=True):
+    lines = ['%sconst u8 %s[] = {' % ('static ' if static else '', name)]
+    for off in range(0, len(data), 12):
+        lines.append('\t' + ' '.join('0x%02x,' % b
+                                     for b in data[off:off + 12]))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def parse_arrays(src):
+    arrays = {}
+    pat = re.compile(r'const short int (\w+)\[(\d+)\] = \{(.*?)\};\n', re.S)
+    for m in pat.finditer(src):
+        words = [int(v, 0) for v in m.group(3).replace('\n', '').split(',')
+                 if v.strip()]
+        assert len(words) == int(m.group(2)), m.group(1)
+        arrays[m.group(1)] = words
+    return arrays, pat.sub('', src)
+
+
+def pack_body(fn, body):
+    reg = re.compile(r'^ddr_phy_reg_wr\((0x[0-9a-f]+),(0x[0-9a-f]+)\);\s*$')
+    load = re.compile(r'^for\(i=0;i<(\d+);i\+\+\) ddr_phy_reg_wr\((0x[0-9a-f]+)'
+                      r'\+i,(\w+)\[i\]\);\s*$')
+    tables = []
+    out = []
+    run = []
+    conds = []		# enclosing preprocessor conditionals, None after #else
+
+    def flush():
+        if len(run) >= MIN_RUN and None not in conds:
+            name = '%s_seq%d' % (fn, len(tables))
+            tables.append((name, run[:], conds[:]))
+            out.append('ddr_phy_reg_seq_wr(%s,ARRAY_SIZE(%s));' %
+                       (name, name))
+        else:
+            out.extend('ddr_phy_reg_wr(%s,%s);' % r for r in run)
+        run.clear()
+
+    for line in body.split('\n'):
+        m = reg.match(line)
+        if m:
+            run.append((m.group(1), m.group(2)))
+            continue
+        flush()
+        if re.match(r'#\s*if', line):
+            conds.append(line.strip())
+        elif re.match(r'#\s*el', line):
+            conds[-1] = None
+        elif re.match(r'#\s*endif', line):
+            conds.pop()
+        m = load.match(line)
+        if m:
+            line = 'ddr_phy_fw_load(%s,%s);' % (m.group(2),
+                                                IMAGES[m.group(3)])
+        line = re.sub(r'ddr_train_cache_restore\(iccm_array1,\d+,'
+                      r'dccm_array1,\d+\)',
+                      'ddr_train_cache_restore(%s,%s)' %
+                      (IMAGES['iccm_array1'], IMAGES['dccm_array1']), line)
+        out.append(line)
+    flush()
+
+    text = '\n'.join(out)
+    if not re.search(r'\bi\b', text.replace('int i;', '')):
+        text = text.replace('int i;\n', '', 1)
+    return tables, text
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('src')
+    parser.add_argument('-o', '--output')
+    parser.add_argument('--imem', help='also write the shared ICCM images')
+    args = parser.parse_args()
+
+    src = open(args.src).read()
+    arrays, src = parse_arrays(src)
+
+    m = re.search(r'\nvoid (\w+)\(\) \{\n', src)
+    fn = m.group(1)
+    head, body = src[:m.start()], src[m.end():]
+    tables, body = pack_body(fn, body)
+
+    incs = re.findall(r'#include "[^"]+"', head)
+    pos = head.index(incs[-1]) + len(incs[-1])
+    head = head[:pos] + '\n#include "../../include/ddr_phy_fw.h"' + head[pos:]
+    out = [head.rstrip('\n'), '']
+    for name, img in (('dccm_1d', 'dccm_array'), ('dccm_2d', 'dccm_array1')):
+        out.append(c_bytes(name + '_lz4', pack_image(arrays[img])))
+        out.append('static const struct ddr_phy_fw_image %s = '
+                   'DDR_PHY_FW_IMAGE(%s_lz4, %d);' %
+                   (name, name, len(arrays[img])))
+        out.append('')
+    for name, run, conds in tables:
+        out.extend(conds)
+        out.append('static const struct ddr_phy_reg %s[] = {' % name)
+        out.extend('{%s,%s},' % r for r in run)
+        out.append('};')
+        out.extend('#endif' for c in conds)
+        out.append('')
+    out.append('void %s() {' % fn)
+    out.append(body)
+
+    with open(args.output or args.src, 'w') as f:
+        f.write('\n'.join(out))
+
+    if args.imem:
+        out = ['/*',
+               ' * LPDDR4 PMU training firmware instruction memory images,',
+               ' * shared by all lp4*_phy_train1d2d configurations.',
+               ' * Generated by ddr_phy_fw_pack.py, do not edit.',
+               ' */',
+               '',
+               '#include "../../include/ddr_phy_fw.h"',
+               '']
+        for name, img in (('1d', 'iccm_array'), ('2d', 'iccm_array1')):
+            sym = 'lp4_pmu_train_%s_imem' % name
+            out.append(c_bytes(sym + '_lz4', pack_image(arrays[img])))
+            out.append('const struct ddr_phy_fw_image %s = '
+                       'DDR_PHY_FW_IMAGE(%s_lz4, %d);' %
+                       (sym, sym, len(arrays[img])))
+            out.append('')
+        with open(args.imem, 'w') as f:
+            f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,38 @@
+#ifndef DDR_PHY_FW_H
+#define DDR_PHY_FW_H
+
+#include <linux/kernel.h>
+#include <linux/types.h>
+
+#define DDR_PHY_IMEM_BASE	0x50000
+#define DDR_PHY_DMEM_BASE	0x54000
+
+/* decoded bytes per LZ4 frame of a packed image, see ddr_phy_fw_pack.py */
+#define DDR_PHY_FW_CHUNK	4096
+
+/*
+ * Training firmware memory image: a sequence of (le32 length, LZ4 frame)
+ * records, each frame expanding to at most DDR_PHY_FW_CHUNK bytes of
+ * 16-bit PHY words.
+ */
+struct ddr_phy_fw_image {
+	const u8 *data;
+	unsigned int len;
+	unsigned int words;
+};
+
+#define DDR_PHY_FW_IMAGE(_data, _words) \
+	{ .data = _data, .len = sizeof(_data), .words = _words }
+
+struct ddr_phy_reg {
+	u32 addr;
+	u16 val;
+};
+
+extern const struct ddr_phy_fw_image lp4_pmu_train_1d_imem;
+extern const struct ddr_phy_fw_image lp4_pmu_train_2d_imem;
+
+void ddr_phy_reg_seq_wr(const struct ddr_phy_reg *seq, int num);
+int ddr_phy_fw_load(unsigned long addr, const struct ddr_phy_fw_image *img);
+
+#endif // DDR_PHY_FW_H
@@ -0,0 +1,27 @@
+#ifndef DDR_TRAIN_CACHE_H
+#define DDR_TRAIN_CACHE_H
+
+#include "ddr_common_func.h"
+#include "ddr_phy_fw.h"
+
+/*
+ * Cached PHY training results.
+ *
+ * After a successful 1D/2D training the trained PHY CSRs and the
+ * firmware message block are captured into a checksummed record which is
+ * stored on the boot eMMC. On the next boot with the same DDR
+ * configuration the record is written back into the PHY and the training
+ * firmware is only started for DRAM device init, skipping training.
+ */
+#define DDR_TRAIN_CACHE_MAGIC		0x43525444	/* "DTRC" */
+#define DDR_TRAIN_CACHE_VERSION		1
+
+int ddr_train_cache_load(enum DDR_TYPE type, int rank_num, int speed,
+			 enum DDR_BITWIDTH bits);
+int ddr_train_cache_valid(void);
+void ddr_train_cache_restore(const struct ddr_phy_fw_image *imem,
+			     const struct ddr_phy_fw_image *dmem);
+void ddr_train_cache_capture(void);
+void ddr_train_cache_finish(void);
+
+#endif // DDR_TRAIN_CACHE_H
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * SPDX-License-Identifier: GPL-2.0+
+ */
+
+#include <common.h>
+#include <lz4.h>
+#include <malloc.h>
+#include <asm/unaligned.h>
+#include "../include/common_lib.h"
+#include "../include/ddr_common_func.h"
+#include "../include/ddr_phy_fw.h"
+
+/**
+ * ddr_phy_reg_seq_wr() - program a table of PHY registers
+ *
+ * Replaces the straight-line ddr_phy_reg_wr() calls of the PhyInit output,
+ * writing both PHYs unless running in 32-bit mode.
+ */
+void ddr_phy_reg_seq_wr(const struct ddr_phy_reg *seq, int num)
+{
+	int i;
+
+	for (i = 0; i < num; i++)
+		ddr_phy_reg_wr(seq[i].addr, seq[i].val);
+}
+
+static void ddr_phy_mem_wr(unsigned long addr, const u16 *buf, size_t words)
+{
+	volatile u16 *phy0 = (volatile u16 *)(_DDR_PHY_BADDR + (addr << 1));
+#ifndef CONFIG_DDR_H32_MODE
+	volatile u16 *phy1 = (volatile u16 *)((_DDR_PHY1_BADDR) + (addr << 1));
+#endif
+	size_t i;
+
+	for (i = 0; i < words; i++) {
+		phy0[i] = buf[i];
+#ifndef CONFIG_DDR_H32_MODE
+		phy1[i] = buf[i];
+#endif
+	}
+}
+
+/**
+ * ddr_phy_fw_load() - expand a packed firmware image into PHY memory
+ *
+ * @addr:	PHY word address of the first word (ICCM or DCCM base)
+ * @img:	packed image
+ *
+ * Each LZ4 frame of the image is decoded into a chunk buffer and streamed
+ * into consecutive PHY words, so only DDR_PHY_FW_CHUNK bytes of SRAM are
+ * needed whatever the image size. A corrupted image leaves the PHY
+ * unusable, so this hangs rather than returning on decode errors.
+ *
+ * @return 0 on success
+ */
+int ddr_phy_fw_load(unsigned long addr, const struct ddr_phy_fw_image *img)
+{
+	const u8 *p = img->data, *end = img->data + img->len;
+	unsigned long start = addr;
+	size_t frame, len;
+	u16 *buf;
+	int ret;
+
+	buf = malloc(DDR_PHY_FW_CHUNK);
+	if (!buf) {
+		printf("ddr: no memory for firmware load\n");
+		hang();
+	}
+
+	while (p < end) {
+		frame = get_unaligned_le32(p);
+		p += sizeof(u32);
+		len = DDR_PHY_FW_CHUNK;
+		ret = ulz4fn(p, frame, buf, &len);
+		if (ret || len & 1) {
+			printf("ddr: firmware image at 0x%lx corrupted (%d)\n",
+			       start, ret);
+			hang();
+		}
+		ddr_phy_mem_wr(addr, buf, len / 2);
+		addr += len / 2;
+		p += frame;
+	}
+
+	free(buf);
+
+	if (addr - start != img->words) {
+		printf("ddr: firmware image at 0x%lx truncated\n", start);
+		hang();
+	}
+
+	return 0;
+}
@@ -2,6 +2,8 @@
 #include "../../include/ddr_common_func.h" 
 #include "../../include/lp4_3733_phy_train1d2d.h" 
 #include "../../include/waitfwdone.h" 
+#include "../../include/ddr_train_cache.h"
+#include "../../include/ddr_phy_fw.h"
 
 void lp4_phy_train1d2d(enum DDR_TYPE type, int speed, enum DDR_BITWIDTH bits) {
     if(type != DDR_TYPE_LPDDR4 || speed != 3733)
@@ -13,34404 +15,773 @@ void lp4_phy_train1d2d(enum DDR_TYPE type, int speed, enum DDR_BITWIDTH bits) {
     lp4_3733_phy_train1d2d();
 }
 
-const short int iccm_array[16384] = {
-0x114,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x2069,
-0x40,
-0x264a,
-0x7000,
-0x264a,
-0x7000,
-0x264a,
-0x7000,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x7054,
-0x7ce0,
-0x4300,
-0x1101,
-0x48c,
-0x2242,
-0x8042,
-0x1b01,
-0x312,
-0xf5fb,
-0x7ee0,
-0x78e0,
-0xc4e1,
-0x240a,
-0x1f80,
-0x8000,
-0x3000,
-0xc19,
-0x1703,
-0x240a,
-0x1f80,
-0x8000,
-0x4000,
-0xc0d,
-0x1702,
-0xc4c1,
-0x2020,
-0x7c0,
-0x7fff,
-0x78e0,
-0x1cfc,
-0xb3c8,
-0x1cfc,
-0xb388,
-0x7fe0,
-0x1cfc,
-0xb348,
-0x78e0,
-0x7ee0,
-0x78e0,
-0x748d,
-0xdd0c,
-0xf00c,
-0x78e0,
-0x748d,
-0xdd08,
-0xf009,
-0x78e0,
-0x748d,
-0x74ad,
-0xf006,
-0x78e0,
-0x748d,
-0xf006,
-0xc702,
-0xc601,
-0x24b0,
-0x334d,
-0x24b0,
-0x331f,
-0x7ee0,
-0x78e0,
-0x2244,
-0x8ffc,
-0x264a,
-0x7000,
-0x20e8,
-0x1a2,
-0x202f,
-0x8000,
-0x212f,
-0x4b,
-0x7ee0,
-0x78e0,
-0x702c,
-0x704c,
-0x706c,
-0x704d,
-0x706d,
-0x708d,
-0x70ad,
-0x70cd,
-0x70ed,
-0x206a,
-0x280,
-0xb88d,
-0x2029,
-0x8000,
-0x44db,
-0x8000,
-0x4000,
-0x42db,
-0x8000,
-0x400,
-0x706f,
-0x78e0,
-0x2022,
-0xf80,
-0x0,
-0x3294,
-0x2069,
-0x40,
-0x78e0,
-0xf1fe,
-0xc3e1,
-0xc2e1,
-0xc1e1,
-0xc0e1,
-0xc0f1,
-0xc5e1,
-0xc1a1,
-0xe806,
-0x7487,
-0xdc14,
-0x77f,
-0xffcf,
-0xda25,
-0xba9f,
-0x8a60,
-0x1233,
-0x80,
-0x7865,
-0x1aea,
-0x8002,
-0x12ed,
-0x8080,
-0x208c,
-0x8fc3,
-0xf20d,
-0xc085,
-0xc040,
-0x4020,
-0x872,
-0x360,
-0xc185,
-0x41c3,
-0x402,
-0x0,
-0xd2a,
-0x60,
-0xd8ff,
-0x70ad,
-0xc86,
-0x2e0,
-0x1a09,
-0x3003,
-0xfb6,
-0x320,
-0xd8ff,
-0x25ab,
-0x10c4,
-0x7fff,
-0xf1ff,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a6,
-0xc141,
-0xc042,
-0xc001,
-0x70cd,
-0xc243,
-0xa0c0,
-0xd83f,
-0xc064,
-0x40c3,
-0x8000,
-0x7c9,
-0x88a0,
-0x1c11,
-0x3382,
-0xf054,
-0xc003,
-0x89d,
-0x6ee,
-0xc084,
-0x60c8,
-0xc040,
-0xc100,
-0xd83f,
-0xb19,
-0x30b0,
-0x7826,
-0xb19,
-0x3070,
-0x4100,
-0xb1d,
-0x3031,
-0x4200,
-0xc100,
-0xf007,
-0xc300,
-0x4100,
-0x4200,
-0xf004,
-0xc200,
-0x4300,
-0xb42,
-0x380,
-0x40c3,
-0x0,
-0x4e20,
-0xeca,
-0x1a0,
-0x702c,
-0x70ed,
-0xf026,
-0x255f,
-0x1402,
-0xc002,
-0x7a16,
-0x62f8,
-0x6038,
-0x8824,
-0x211a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x54,
-0x9000,
-0xcc2,
-0x60,
-0x780f,
-0xc100,
-0xb8c5,
-0x71e5,
-0x7907,
-0x235a,
-0x3200,
-0x4220,
-0xb8c4,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7a5b,
-0xc001,
-0x8020,
-0x7945,
-0xa020,
-0xc002,
-0x41c3,
-0x8000,
-0x784,
-0x78b4,
-0x6028,
-0xfad,
-0x9004,
-0x7167,
-0xb63,
-0xb0d4,
-0x71c5,
-0xefb,
-0x90b4,
-0x706f,
-0xc0a6,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x320d,
-0x216f,
-0x243,
-0x1154,
-0x80,
-0x89a0,
-0xc046,
-0x1121,
-0x80,
-0x2400,
-0x3f81,
-0x0,
-0x334,
-0xc047,
-0xe5a,
-0x160,
-0x710c,
-0xc09c,
-0xc040,
-0xc089,
-0x2456,
-0x3d41,
-0x2400,
-0x3f82,
-0x0,
-0x19c,
-0xece,
-0xa0,
-0x2440,
-0x3fc3,
-0x706c,
-0xc341,
-0xf00c,
-0x235a,
-0x601,
-0x6038,
-0x6059,
-0x700c,
-0xa900,
-0x7144,
-0xaf3,
-0x8634,
-0xc09f,
-0x7164,
-0xbf9,
-0x8334,
-0x704c,
-0x251a,
-0x1f80,
-0x20,
-0x0,
-0x702c,
-0x2005,
-0xf80,
-0x9001,
-0xe100,
-0xc043,
-0xb020,
-0x251a,
-0x1f80,
-0x10,
-0x0,
-0xb887,
-0xdd6,
-0xa0,
-0xc045,
-0xe12,
-0xa0,
-0xc029,
-0xc048,
-0xe0a,
-0xa0,
-0xc02b,
-0x33f,
-0x20,
-0xc044,
-0xc001,
-0x84d,
-0xb5,
-0x71ad,
-0xc001,
-0x1e00,
-0x7003,
-0x8000,
-0x7c9,
-0xc208,
-0x2079,
-0xe,
-0x1600,
-0x7080,
-0x8000,
-0x4a,
-0x702c,
-0xb8c0,
-0x7e07,
-0xc8e,
-0xe0,
-0x40c1,
-0x4318,
-0xc007,
-0x47a9,
-0x2644,
-0x17de,
-0xe11,
-0x3010,
-0x2642,
-0x305e,
-0xeff,
-0xb031,
-0x7ffb,
-0x84b,
-0x38f,
-0x2e9,
-0x0,
-0xc001,
-0x1e00,
-0x7342,
-0x8000,
-0x7c9,
-0xc204,
-0x2079,
-0x8e,
-0x1600,
-0x7080,
-0x8000,
-0x7d,
-0x712c,
-0xb8c0,
-0x7e07,
-0xc4a,
-0xe0,
-0x40c1,
-0x4318,
-0xc006,
-0x47a9,
-0x2644,
-0x17cd,
-0xed06,
-0xbd61,
-0xd01,
-0x1031,
-0x7ffb,
-0x2011,
-0x8380,
-0x2a8,
-0x21,
-0x72ad,
-0x704c,
-0x700c,
-0xf00b,
-0x2400,
-0x3f81,
-0x0,
-0x1b4,
-0x6119,
-0x19c0,
-0x82,
-0xa940,
-0x7104,
-0x208c,
-0x8003,
-0xf7b6,
-0xf3a,
-0x60,
-0x40a1,
-0xf36,
-0x60,
-0x40a1,
-0x1e00,
-0x7043,
-0x8000,
-0x6e0,
-0xf26,
-0x60,
-0x40a1,
-0x78ef,
-0x4163,
-0xfee,
-0x60,
-0xc042,
-0xc002,
-0x70ed,
-0x1e00,
-0x73c2,
-0x8000,
-0x6e0,
-0xd86,
-0x0,
-0xf06,
-0x60,
-0x40a1,
-0x43f9,
-0xf04e,
-0x143f,
-0x3082,
-0x2084,
-0x1,
-0x2353,
-0x3101,
-0x7905,
-0x706c,
-0xf00e,
-0x6068,
-0x7164,
-0x201a,
-0xf8c,
-0x0,
-0x1000,
-0xc005,
-0x7885,
-0x781b,
-0xb89c,
-0xb89f,
-0xb020,
-0xbe9,
-0x80a4,
-0x2456,
-0x3d40,
-0xc9e,
-0x80,
-0x40c1,
-0xc190,
-0xd62,
-0xffef,
-0xda07,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x2400,
-0x3f81,
-0x0,
-0x1b4,
-0xc210,
-0x209f,
-0x3,
-0x224a,
-0x1200,
-0x6119,
-0x7163,
-0x8960,
-0x2253,
-0x140,
-0x7167,
-0x7865,
-0xa900,
-0x1140,
-0x83,
-0x4040,
-0x2242,
-0x104a,
-0xaff,
-0x9031,
-0x781d,
-0xb8c5,
-0x7865,
-0x1940,
-0x2,
-0x1180,
-0x83,
-0x4040,
-0xda10,
-0xba61,
-0xa01,
-0x31,
-0x781d,
-0xb8c5,
-0x7865,
-0x1980,
-0x2,
-0x238c,
-0xb001,
-0x762,
-0xffe5,
-0x202f,
-0x6c0,
-0xc003,
-0x1e00,
-0x7043,
-0x8000,
-0x6e0,
-0xc22,
-0xa0,
-0xb0e0,
-0xa5a,
-0xa0,
-0xc002,
-0x750c,
-0x41c3,
-0x94,
-0x1,
-0x9e2,
-0x60,
-0x42c1,
-0xf0ba,
-0x66e8,
-0x208c,
-0x8fc3,
-0xf2b5,
-0xc001,
-0x7912,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0x781d,
-0x7812,
-0x7825,
-0xdab,
-0x103e,
-0xc042,
-0x750c,
-0x41c3,
-0x95,
-0x1,
-0x9b2,
-0x60,
-0x42e1,
-0x706f,
-0xf040,
-0x702c,
-0x706c,
-0xf017,
-0x2400,
-0x3f80,
-0x0,
-0x1b4,
-0x6048,
-0x792f,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x781d,
-0x7144,
-0xb8c0,
-0x2344,
-0x7cc,
-0xec05,
-0xbc61,
-0xcff,
-0x9031,
-0x781b,
-0x7905,
-0x7164,
-0xbd7,
-0x8234,
-0x2744,
-0x17cc,
-0xc002,
-0x829,
-0x1e,
-0x66ea,
-0x2400,
-0x3f80,
-0x0,
-0x19c,
-0x6048,
-0xc29f,
-0x205f,
-0x600,
-0x621a,
-0x202f,
-0x6c2,
-0x781d,
-0x781d,
-0x6058,
-0x8840,
-0x7a25,
-0xa840,
-0xcaa,
-0x2a0,
-0x782f,
-0x4200,
-0x41c3,
-0x96,
-0x1,
-0x936,
-0x60,
-0x750c,
-0x2340,
-0x321b,
-0x238c,
-0xb003,
-0x780,
-0xffe5,
-0x4263,
-0x41c3,
-0x97,
-0x0,
-0x91a,
-0x60,
-0x750c,
-0xdaf,
-0x107e,
-0x750c,
-0x41c3,
-0x98,
-0x1,
-0x90a,
-0x60,
-0x42e1,
-0x70cd,
-0xf042,
-0x702c,
-0x706c,
-0xf019,
-0x2400,
-0x3f80,
-0x0,
-0x1b4,
-0x6058,
-0x10c0,
-0x80,
-0x792f,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x781d,
-0x7144,
-0xb8c0,
-0x2344,
-0x7cc,
-0xec05,
-0xbc61,
-0xcff,
-0x9031,
-0x781b,
-0x7905,
-0x7164,
-0xbd3,
-0x8234,
-0x2744,
-0x17cc,
-0xc002,
-0x82b,
-0x3e,
-0xc089,
-0x60f8,
-0x8848,
-0x2400,
-0x3f80,
-0x0,
-0x19c,
-0x6048,
-0xc29f,
-0x205f,
-0x600,
-0x621a,
-0x78dd,
-0x781d,
-0x781d,
-0x6058,
-0x8840,
-0x7a25,
-0xa840,
-0xbfe,
-0x2a0,
-0x782f,
-0x4200,
-0x41c3,
-0x99,
-0x1,
-0x886,
-0x60,
-0x750c,
-0xe608,
-0x268c,
-0x9003,
-0x77c,
-0xffe5,
-0x42c1,
-0x41c3,
-0x9a,
-0x0,
-0x86e,
-0x60,
-0x750c,
-0x71e5,
-0x75f5,
-0x68e,
-0xffee,
-0xc689,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0x7414,
-0x4c8,
-0xffe5,
-0x700c,
-0xc044,
-0xc003,
-0x702c,
-0xa76,
-0xa0,
-0xb020,
-0x264a,
-0x3000,
-0xf0e4,
-0x143f,
-0x3080,
-0xc042,
-0x40c3,
-0x0,
-0xffff,
-0xc041,
-0xc043,
-0xf096,
-0x60e8,
-0x260c,
-0xb000,
-0xf491,
-0x704c,
-0x70cd,
-0xd9ff,
-0x70ad,
-0x4758,
-0x700c,
-0xf033,
-0xf20c,
-0x2344,
-0x7cc,
-0x43e3,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x7b7d,
-0xbbc0,
-0xf00d,
-0x275a,
-0x1603,
-0xc49f,
-0x647c,
-0x7b1d,
-0x7b7d,
-0x7b7d,
-0x2432,
-0x10df,
-0x2744,
-0x3043,
-0x7c30,
-0x248c,
-0x9fc3,
-0xf408,
-0xe0df,
-0xd9ff,
-0xf716,
-0xeb94,
-0x704c,
-0x4100,
-0xf012,
-0x7074,
-0x22c0,
-0x61,
-0xf20e,
-0xdb3f,
-0x233c,
-0xb,
-0x7c50,
-0x7bb0,
-0x233c,
-0x303,
-0x230b,
-0x82c0,
-0x755c,
-0x763c,
-0xd9ff,
-0x7104,
-0x208c,
-0x8003,
-0x79a,
-0xffe5,
-0x2053,
-0x8083,
-0x78b0,
-0x262f,
-0xf088,
-0x2079,
-0x0,
-0x20c5,
-0x61,
-0x7014,
-0x72bd,
-0x71dd,
-0x262f,
-0xf088,
-0xf211,
-0x2204,
-0xf80,
-0x0,
-0xfffe,
-0x781d,
-0x7e30,
-0x661e,
-0x78cf,
-0xe0c0,
-0xf74a,
-0x81b,
-0x835,
-0xdd40,
-0xde20,
-0xf009,
-0x710c,
-0xc044,
-0xf033,
-0xe0df,
-0x45c9,
-0xf7c3,
-0xdd5f,
-0xde5f,
-0x78af,
-0x792f,
-0xb16,
-0x160,
-0x7a4f,
-0x4308,
-0xb0e,
-0x160,
-0x78cf,
-0x2580,
-0x103f,
-0x79bb,
-0x2184,
-0x1,
-0xbdc4,
-0x7d25,
-0xc190,
-0x79f4,
-0xb1a0,
-0x2642,
-0x1801,
-0x7a3b,
-0x2284,
-0x1,
-0xb9c4,
-0x7a25,
-0xc101,
-0xc396,
-0x7bf4,
-0x7930,
-0x230c,
-0x9040,
-0xc101,
-0xb340,
-0x21ca,
-0x2c5,
-0xc141,
-0xc103,
-0x7930,
-0x7030,
-0xc103,
-0x21ca,
-0x5,
-0xc143,
-0x71e5,
-0xc002,
-0x7710,
-0x6d4,
-0xffe5,
-0xc09c,
-0xc003,
-0x7910,
-0xc001,
-0x7810,
-0x843,
-0x65,
-0xc289,
-0x2216,
-0x782,
-0x8a06,
-0xdb40,
-0x2454,
-0x3b0b,
-0x201a,
-0xf81,
-0x0,
-0x1000,
-0xc005,
-0x7825,
-0x781b,
-0x41c3,
-0x9000,
-0x0,
-0x7825,
-0xb060,
-0x8a07,
-0x201a,
-0xf82,
-0x0,
-0x1000,
-0xc005,
-0x7845,
-0x781b,
-0x7825,
-0xb060,
-0xf003,
-0x2454,
-0x380b,
-0x702c,
-0xf015,
-0xc09c,
-0x6028,
-0xe25,
-0x3021,
-0x2456,
-0x3d40,
-0x6028,
-0x23f4,
-0x1042,
-0x201a,
-0xf83,
-0x0,
-0x1000,
-0xc005,
-0x7865,
-0x781b,
-0xb89c,
-0xb89f,
-0xb040,
-0x7124,
-0xc002,
-0x9d7,
-0x8004,
-0x2640,
-0x305e,
-0x264c,
-0xb080,
-0x636,
-0xffe5,
-0x70ed,
-0xc004,
-0x41c3,
-0xa9,
-0x0,
-0x8fa,
-0xffef,
-0x2078,
-0x0,
-0x88a,
-0x80,
-0x9f6,
-0x280,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0xb8e0,
-0xf9c,
-0xc2,
-0x2400,
-0x3f81,
-0x0,
-0x334,
-0x88e,
-0x160,
-0x700c,
-0x2480,
-0x320d,
-0x1404,
-0x341b,
-0xc6c6,
-0xb8e6,
-0x781d,
-0x781d,
-0x781d,
-0xb8c2,
-0x742c,
-0xf403,
-0x7914,
-0xf006,
-0x7915,
-0x909,
-0x354,
-0x762c,
-0x7915,
-0x7fe0,
-0x6901,
-0x42c3,
-0x8000,
-0x7c9,
-0x8a20,
-0x215f,
-0xc81,
-0x6038,
-0x8a21,
-0x215f,
-0x641,
-0x6119,
-0x8903,
-0xb8e6,
-0x8902,
-0x1600,
-0x7081,
-0x8000,
-0x1c,
-0xb8c2,
-0xf409,
-0x7034,
-0x41c3,
-0x8000,
-0x640,
-0xf209,
-0xe108,
-0xf007,
-0x7034,
-0x41c3,
-0x8000,
-0x630,
-0xf203,
-0xe108,
-0x6119,
-0x7fe0,
-0x8900,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b5,
-0xc254,
-0x4528,
-0x4200,
-0x41c3,
-0xee,
-0x1,
-0xdb2,
-0x20,
-0x750c,
-0x706f,
-0xf035,
-0x4261,
-0xf009,
-0xc014,
-0x20f4,
-0x83,
-0xc08e,
-0x7834,
-0xb060,
-0x62ba,
-0x7124,
-0x9f3,
-0x8294,
-0x4183,
-0x911c,
-0x1446,
-0x3103,
-0x915f,
-0xc053,
-0x1448,
-0x3101,
-0x144a,
-0x3100,
-0x143a,
-0x311f,
-0x143c,
-0x311e,
-0x1440,
-0x310f,
-0x1442,
-0x310e,
-0x1444,
-0x310c,
-0xc346,
-0xc313,
-0xc048,
-0xc147,
-0xc242,
-0x750c,
-0x41c3,
-0xef,
-0xb,
-0xc445,
-0xc644,
-0xc743,
-0x1c04,
-0x3780,
-0x1c00,
-0x37c0,
-0xd4a,
-0x20,
-0x4261,
-0x7167,
-0x232f,
-0x16c8,
-0xb97,
-0x9364,
-0x702c,
-0xc0b5,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e4,
-0xc1a4,
-0x4608,
-0x700c,
-0x866,
-0x20,
-0x702c,
-0x702c,
-0xd8ff,
-0x754c,
-0x726c,
-0x1c0c,
-0x30c1,
-0x4528,
-0xc142,
-0xc141,
-0x926,
-0x20,
-0xc140,
-0x265f,
-0x1100,
-0x702c,
-0xb98d,
-0x734c,
-0x78c5,
-0x2084,
-0xf03,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0xc541,
-0x906,
-0x20,
-0xc540,
-0xd8ff,
-0xd980,
-0x754c,
-0x726c,
-0xc543,
-0xc542,
-0xc541,
-0x8f2,
-0x20,
-0xc540,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0x700c,
-0x1e00,
-0x7004,
-0x9004,
-0x102,
-0x7ee0,
-0xc2e4,
-0x4308,
-0x70ad,
-0x46cb,
-0x9008,
-0x1e4,
-0x218c,
-0x8fc3,
-0xb6a0,
-0xb6a1,
-0xb6a2,
-0xf224,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x201a,
-0xf83,
-0x20,
-0x0,
-0x2305,
-0xf80,
-0x9004,
-0x40,
-0xb020,
-0x40c3,
-0x8000,
-0x7cd,
-0x8881,
-0x8800,
-0xf00c,
-0x201a,
-0xf82,
-0x0,
-0x2000,
-0x7104,
-0x7a65,
-0x2205,
-0xf82,
-0x9002,
-0x40,
-0xb220,
-0xceb,
-0x9005,
-0x806,
-0x280,
-0x208a,
-0x21a,
-0x41c3,
-0x900e,
-0x2a,
-0x1efc,
-0x92c4,
-0xb100,
-0x40c3,
-0x8000,
-0x446,
-0xa8a0,
-0x40c3,
-0x0,
-0xfac,
-0xb101,
-0x700c,
-0xc6c4,
-0x704c,
-0x7210,
-0x20e0,
-0x7ca,
-0x1600,
-0x7101,
-0x9008,
-0x1d6,
-0x9f3,
-0x803e,
-0x7144,
-0x7ee0,
-0xc2e2,
-0x4328,
-0xe52,
-0x60,
-0x260a,
-0x3000,
-0x45cb,
-0x9004,
-0xf2,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0x1e00,
-0x7784,
-0x9008,
-0x1e2,
-0xdd2,
-0x160,
-0x760c,
-0xb17,
-0x1030,
-0x1d10,
-0x1045,
-0x40c3,
-0x0,
-0x61a8,
-0xfb6,
-0xffcf,
-0x1d10,
-0x1005,
-0xc6c2,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a6,
-0x260a,
-0x3080,
-0xc20b,
-0xc345,
-0xdb7f,
-0xc040,
-0x7b44,
-0xd84b,
-0x2338,
-0xf,
-0x279a,
-0x1002,
-0xbae6,
-0x208a,
-0x3e,
-0x234f,
-0x4c,
-0x27ca,
-0x1001,
-0xe4cf,
-0x27ca,
-0x1001,
-0xe3d1,
-0x27ca,
-0x1001,
-0xc000,
-0x1600,
-0x7083,
-0x8000,
-0x446,
-0x1400,
-0x301f,
-0x208c,
-0x8fc3,
-0xc00e,
-0x2642,
-0x304b,
-0x27ca,
-0x30c1,
-0xc043,
-0xc00d,
-0xc044,
-0xc00c,
-0xb51,
-0x16b5,
-0xc042,
-0xdb50,
-0xc341,
-0xdb20,
-0xd810,
-0xde30,
-0xdd60,
-0x4378,
-0x708d,
-0x2025,
-0x2c0,
-0xf01a,
-0xf01a,
-0xf018,
-0xf018,
-0xf05c,
-0xf019,
-0xf014,
-0xf016,
-0xf045,
-0xf048,
-0xf010,
-0xf010,
-0xf047,
-0xf03b,
-0xf00e,
-0xf00c,
-0xf00a,
-0xf00a,
-0xf008,
-0xf008,
-0xf006,
-0xf006,
-0xf03f,
-0xf034,
-0xf005,
-0xf0a8,
-0x706c,
-0xf003,
-0xdb10,
-0x264c,
-0xb640,
-0x14a,
-0x2d,
-0x4060,
-0x726c,
-0x748d,
-0xc041,
-0x4608,
-0x4318,
-0x4508,
-0x4708,
-0x2025,
-0x780,
-0xf036,
-0xf02c,
-0xf02b,
-0xf017,
-0xf017,
-0xf093,
-0xf099,
-0xf093,
-0xf015,
-0xf019,
-0xf01c,
-0xf091,
-0xf00f,
-0xf01b,
-0xf00f,
-0xf00d,
-0xf089,
-0xf087,
-0xf087,
-0xf085,
-0xf085,
-0xf018,
-0xf017,
-0xf013,
-0xf008,
-0xf006,
-0xdb07,
-0xf012,
-0xc701,
-0x758d,
-0xf018,
-0x758d,
-0x47a9,
-0xf014,
-0x758d,
-0x47c9,
-0xf012,
-0x718d,
-0x476b,
-0xf00e,
-0x768d,
-0xf00b,
-0x708d,
-0xf00a,
-0x736c,
-0xe0d,
-0x30d1,
-0xc402,
-0x249a,
-0x1004,
-0x7a85,
-0x4468,
-0x4708,
-0x238a,
-0xffd,
-0x7b24,
-0x783d,
-0x2044,
-0xc0b,
-0xe3b0,
-0xdb58,
-0x23cf,
-0x11e1,
-0x7b24,
-0x2084,
-0x1,
-0x2305,
-0x2c3,
-0x7885,
-0x7b05,
-0x783d,
-0x239a,
-0x4,
-0x781d,
-0xc405,
-0x781d,
-0x2004,
-0xf80,
-0x0,
-0x2000,
-0x7c05,
-0x7c65,
-0x232f,
-0x17c0,
-0x43c3,
-0x9008,
-0x0,
-0x2305,
-0x10c0,
-0xb080,
-0x4020,
-0x209a,
-0x4,
-0x7154,
-0x2104,
-0xf81,
-0x0,
-0xff00,
-0x2004,
-0xf8c,
-0x0,
-0xf00,
-0xc002,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x7c05,
-0x40e1,
-0x20cf,
-0x1a1,
-0x264c,
-0xb180,
-0x27ca,
-0x1001,
-0xc004,
-0xb8c3,
-0x7f05,
-0x78ef,
-0x7c05,
-0x2354,
-0x1800,
-0x7865,
-0xb080,
-0x2355,
-0x1800,
-0x7865,
-0xb040,
-0xc003,
-0x7905,
-0x2355,
-0x1c00,
-0x7b05,
-0xb320,
-0xc000,
-0x2740,
-0x3041,
-0x208c,
-0x8fc3,
-0xf405,
-0x1e00,
-0x7042,
-0x8000,
-0x446,
-0x782f,
-0xc0a6,
-0x1404,
-0x341b,
-0xc6c6,
-0x738d,
-0xdf10,
-0xf19e,
-0x708d,
-0xf19b,
-0x718d,
-0xf199,
-0xdc20,
-0xf197,
-0x758d,
-0xf195,
-0x78e0,
-0xc0f1,
-0xc1a4,
-0xc408,
-0xc443,
-0xc407,
-0xc442,
-0xc406,
-0xc441,
-0xc405,
-0xde2,
-0xffef,
-0xc440,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0x41c3,
-0x8000,
-0x446,
-0x8920,
-0x208c,
-0x8fc3,
-0x20ca,
-0x41,
-0x1e00,
-0x7004,
-0x9008,
-0x1e8,
-0x7ee0,
-0x78e0,
-0x41c3,
-0x8000,
-0x446,
-0x8920,
-0x208c,
-0x8fc3,
-0x20ca,
-0x41,
-0x1e00,
-0x7004,
-0x9008,
-0x1e6,
-0x7ee0,
-0x78e0,
-0x41c3,
-0x900e,
-0x4c,
-0x9160,
-0x9141,
-0x221a,
-0xf81,
-0x1,
-0x0,
-0x7965,
-0xe807,
-0x231a,
-0xf80,
-0x8000,
-0x0,
-0x793d,
-0xf008,
-0x4040,
-0xda0f,
-0xba61,
-0xaff,
-0x8031,
-0x781d,
-0x793b,
-0x7825,
-0x41c3,
-0x900f,
-0xfe4c,
-0xda10,
-0xb100,
-0xba61,
-0xa01,
-0x31,
-0x781d,
-0x7fe0,
-0xb101,
-0x264a,
-0x3000,
-0xf010,
-0x265a,
-0x3c83,
-0x607c,
-0x235a,
-0x1643,
-0x7165,
-0x639b,
-0x633b,
-0x8b80,
-0x7c44,
-0xab80,
-0xbeb,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0x7ee0,
-0xc0f1,
-0xc1a4,
-0x700c,
-0xc4a,
-0xffef,
-0xd9ff,
-0x700c,
-0xc043,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xd988,
-0x754c,
-0xd0a,
-0xffef,
-0xdb40,
-0x700c,
-0xcc2,
-0xffef,
-0x712c,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0x7014,
-0x20c0,
-0xfe9,
-0x7fe0,
-0x2884,
-0x1,
-0x40c3,
-0x8000,
-0x7c9,
-0x8821,
-0x8800,
-0x215f,
-0x641,
-0x205f,
-0xc80,
-0x6038,
-0x2000,
-0xf80,
-0x8000,
-0x67c,
-0x8803,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x7fe0,
-0xb8c0,
-0x78e0,
-0x917,
-0x3f0,
-0x228a,
-0xfc7,
-0x714c,
-0xb9c4,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x7a5b,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf81,
-0x9002,
-0x16a,
-0x224f,
-0x240,
-0x1900,
-0x5,
-0xb140,
-0xb100,
-0xb140,
-0x7fe0,
-0x1900,
-0x5,
-0x78e0,
-0x80d,
-0x72,
-0x702c,
-0x48ff,
-0x2984,
-0x1,
-0x7fe0,
-0x782e,
-0xc0f1,
-0x4200,
-0xe9a,
-0x60,
-0x4020,
-0x795b,
-0x2144,
-0x181,
-0xb9c4,
-0xe906,
-0xb961,
-0x901,
-0x31,
-0x781d,
-0xc0d1,
-0x7fe0,
-0xb8c1,
-0x78e0,
-0xc0f1,
-0xc1a4,
-0x700c,
-0xb6e,
-0xffef,
-0xd9ff,
-0x700c,
-0xc043,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xd990,
-0x754c,
-0xc2e,
-0xffef,
-0xdb40,
-0x700c,
-0xbe6,
-0xffef,
-0x712c,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0xc3e1,
-0xc2e1,
-0xc1e1,
-0xc0e1,
-0xc0f1,
-0xc1a1,
-0x4220,
-0xc184,
-0xc140,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x80f,
-0x64,
-0x4040,
-0xb1e,
-0x2e0,
-0xc100,
-0x7487,
-0xc0d1,
-0x7fe0,
-0xc0a4,
-0x78e0,
-0x791d,
-0x216c,
-0x102,
-0x206c,
-0x141,
-0x7822,
-0x621a,
-0x7fe0,
-0x784e,
-0x78e0,
-0xc0e6,
-0x215f,
-0x483,
-0x44cb,
-0x8000,
-0x6e2,
-0x70cd,
-0x638d,
-0x6479,
-0x8941,
-0x7d04,
-0xf00b,
-0x6199,
-0x89e2,
-0x7f0b,
-0xf206,
-0x89e3,
-0x79af,
-0x210f,
-0x3cd,
-0x71c5,
-0xef1,
-0x90a4,
-0x2314,
-0x381,
-0x78af,
-0xc4c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0x47cb,
-0x8000,
-0x67c,
-0xb0e,
-0xa0,
-0x40e1,
-0x70ad,
-0x43a9,
-0xf00d,
-0x235a,
-0x641,
-0x235a,
-0x1c80,
-0x6038,
-0xdda,
-0x260,
-0x60f8,
-0x7164,
-0xbef,
-0x8094,
-0x7165,
-0xbfd,
-0x90b4,
-0x706c,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8ae,
-0xa8a1,
-0xa8a0,
-0x40c3,
-0x8000,
-0x7d8,
-0x972,
-0xa0,
-0xa0e0,
-0x976,
-0xa0,
-0x4508,
-0x4100,
-0xec2,
-0x260,
-0x40a1,
-0x236f,
-0x30c3,
-0x1318,
-0x3080,
-0xe809,
-0x41c3,
-0xad,
-0x0,
-0xf1a,
-0xffef,
-0xd80a,
-0xf01f,
-0x1300,
-0x3080,
-0x46cb,
-0x1e,
-0x8480,
-0x41c3,
-0x5f5,
-0xe100,
-0x2044,
-0x808d,
-0x40c1,
-0x20ca,
-0x41,
-0x916,
-0x160,
-0x702c,
-0x70b5,
-0x40c3,
-0x3b9a,
-0xca00,
-0x26ca,
-0x1001,
-0x40c1,
-0x1e00,
-0x70c5,
-0x9004,
-0xc0,
-0x8fa,
-0x160,
-0x702c,
-0x1600,
-0x7080,
-0x8000,
-0xd,
-0x80f,
-0x1e,
-0x1e00,
-0x7045,
-0x9004,
-0xc0,
-0x46cb,
-0x8000,
-0x6e0,
-0x8e00,
-0x8b7,
-0x10,
-0x1300,
-0x3080,
-0x8af,
-0xdf,
-0xdde,
-0x0,
-0x40c3,
-0x0,
-0xa00,
-0x9e2,
-0xffef,
-0xd9ff,
-0x70ad,
-0xd8ff,
-0x702c,
-0x754c,
-0x736c,
-0xc543,
-0xc542,
-0xc541,
-0xaa6,
-0xffef,
-0xc540,
-0x8e01,
-0x825,
-0xb4,
-0x702c,
-0x7104,
-0x781d,
-0xb862,
-0x780f,
-0xc043,
-0xd8ff,
-0x754c,
-0x726c,
-0xc542,
-0xc541,
-0xa82,
-0xffef,
-0xc540,
-0x8e01,
-0xc043,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb0c,
-0xc542,
-0xc541,
-0xa6e,
-0xffef,
-0xc540,
-0x8e01,
-0xd908,
-0x754c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0xa56,
-0xffef,
-0xc540,
-0xc9e,
-0xffef,
-0xd8ff,
-0x8e01,
-0x702c,
-0x754c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0xa3a,
-0xffef,
-0xc540,
-0xc66,
-0xffef,
-0xd8ff,
-0x922,
-0x280,
-0xd896,
-0x9ea,
-0xffef,
-0x712c,
-0xf3e,
-0x0,
-0xf009,
-0xcfa,
-0xffcf,
-0x40c3,
-0xf,
-0x4240,
-0x81a,
-0x160,
-0x702c,
-0x1300,
-0x3080,
-0x83f,
-0x1e,
-0x43c3,
-0x9004,
-0x14,
-0x9320,
-0xca01,
-0x80d,
-0x1b0,
-0x214f,
-0x82,
-0x80b,
-0xd1,
-0x2185,
-0x108,
-0x4220,
-0xb340,
-0xd823,
-0x42c3,
-0x9005,
-0xe034,
-0xb200,
-0x702c,
-0x40c3,
-0x9003,
-0xe034,
-0xb020,
-0xb8b1,
-0xb020,
-0xb221,
-0xddff,
-0x40e1,
-0x702c,
-0x228a,
-0xdff,
-0x776c,
-0xb06,
-0x320,
-0xc540,
-0x774c,
-0x40e1,
-0x712c,
-0x4340,
-0xaf6,
-0x320,
-0xc540,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xca04,
-0x704c,
-0x43c3,
-0x8000,
-0x7cd,
-0xf013,
-0x8b20,
-0xa0d,
-0x44,
-0x8b21,
-0x919,
-0x85,
-0x221a,
-0xf81,
-0x0,
-0x2000,
-0x2105,
-0xf81,
-0x9002,
-0x1f64,
-0x1900,
-0x5,
-0x7144,
-0xae1,
-0x8004,
-0x7ee0,
-0xc2e4,
-0x70ad,
-0xbd9a,
-0xd8ff,
-0x41a1,
-0x70cd,
-0xd4a,
-0xffef,
-0x1a09,
-0x3003,
-0xca6,
-0x240,
-0x254f,
-0x1401,
-0xd3a,
-0xffef,
-0xd8ff,
-0xfd2,
-0x2a0,
-0xd8ff,
-0x26ab,
-0x10c4,
-0x7fff,
-0xf000,
-0xc0f1,
-0xc1a5,
-0x4300,
-0xc080,
-0x702c,
-0xa3a,
-0x160,
-0xda14,
-0x231a,
-0xf80,
-0x10,
-0x0,
-0xc180,
-0x714c,
-0xe3a,
-0x220,
-0xb885,
-0x41c3,
-0xf6,
-0x0,
-0xcfe,
-0xffef,
-0x750c,
-0x700c,
-0x712c,
-0xf32,
-0xffaf,
-0xc280,
-0xc0a5,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3d02,
-0x4748,
-0x4338,
-0x4308,
-0xc080,
-0x702c,
-0x9ee,
-0x160,
-0xdab4,
-0xb25,
-0x10b1,
-0x750c,
-0x41c3,
-0xf2,
-0x1,
-0xcc2,
-0xffef,
-0x4260,
-0xc080,
-0x702c,
-0xf3a,
-0x220,
-0x714c,
-0x700c,
-0xd909,
-0xf036,
-0x231a,
-0x3f9b,
-0x10,
-0x0,
-0xb1b,
-0x1030,
-0x750c,
-0x41c3,
-0xf4,
-0x1,
-0xc96,
-0xffef,
-0x4260,
-0xdd09,
-0xdec0,
-0xd8d0,
-0xf00a,
-0x41c3,
-0xf3,
-0x1,
-0xc82,
-0xffef,
-0x4260,
-0x72ad,
-0xde8c,
-0xd880,
-0x60f8,
-0x2005,
-0x6c0,
-0xc180,
-0xd9e,
-0x220,
-0x724c,
-0x700c,
-0x722c,
-0xea2,
-0xffaf,
-0xc280,
-0xc080,
-0x702c,
-0x976,
-0x160,
-0xdab4,
-0x66fe,
-0x2605,
-0x16c0,
-0xc180,
-0xd7e,
-0x220,
-0x42a1,
-0x710c,
-0x41a1,
-0xe7e,
-0xffaf,
-0xc280,
-0x2480,
-0x3d02,
-0x1404,
-0x341b,
-0xc6c6,
-0xc3e2,
-0x2482,
-0x3d02,
-0x4528,
-0x4300,
-0xc080,
-0x702c,
-0x942,
-0x160,
-0xdab4,
-0x2354,
-0xd00,
-0xc180,
-0xd4a,
-0x220,
-0xda09,
-0x750c,
-0x41c3,
-0xf5,
-0x1,
-0xc0a,
-0xffef,
-0x42a1,
-0x700c,
-0xd909,
-0xe3e,
-0xffaf,
-0xc280,
-0xc7c2,
-0x78e0,
-0xc0f1,
-0x2482,
-0x3d02,
-0xc080,
-0x702c,
-0x90a,
-0x160,
-0xdab4,
-0x41c3,
-0xf7,
-0x0,
-0xbe2,
-0xffef,
-0x750c,
-0xd840,
-0xc180,
-0xd06,
-0x220,
-0xda09,
-0x700c,
-0xd909,
-0xe0a,
-0xffaf,
-0xc280,
-0x2480,
-0x3d02,
-0xc0d1,
-0x7ee0,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x7534,
-0x20e0,
-0x7c5,
-0x7fe0,
-0x1a09,
-0x3002,
-0xc0e6,
-0x44cb,
-0x9004,
-0xe4,
-0x42c3,
-0x8000,
-0x7cb,
-0x835,
-0xb0,
-0x716c,
-0x7114,
-0xd825,
-0x46cb,
-0x9004,
-0x30,
-0xb89f,
-0xf42a,
-0x8a25,
-0xaa23,
-0x8aa4,
-0x7b34,
-0xaaa2,
-0x96c0,
-0x88e0,
-0x78bb,
-0xb4e0,
-0xaa00,
-0xe5f,
-0x1171,
-0xaa61,
-0xb4e1,
-0xf02d,
-0x700c,
-0xb400,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0xb421,
-0x44cb,
-0x9004,
-0xf6,
-0xb400,
-0xb404,
-0x1c06,
-0x13c5,
-0x8a27,
-0xaa23,
-0x8a06,
-0x7b34,
-0xaa02,
-0x781b,
-0xaa00,
-0xd8ff,
-0xaa61,
-0x1cfe,
-0x9004,
-0xc4c6,
-0x88a0,
-0xb4a0,
-0x8a27,
-0xaa23,
-0x8a04,
-0x7b34,
-0xaa02,
-0x781b,
-0xaa00,
-0xaa61,
-0x9600,
-0x829,
-0x151,
-0xb4a1,
-0xf015,
-0x1c02,
-0x1005,
-0x41c3,
-0x9004,
-0xfe,
-0xd8ff,
-0x1900,
-0x3c5,
-0x19f8,
-0x8004,
-0x19f6,
-0x8005,
-0x19fe,
-0x8005,
-0xc4c6,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0xb401,
-0x702c,
-0x40c3,
-0x9004,
-0xf6,
-0xb020,
-0xb024,
-0x18fe,
-0x8044,
-0xb023,
-0xc4c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a5,
-0x4708,
-0x40c3,
-0x8000,
-0x7c9,
-0x88c0,
-0x2753,
-0x1040,
-0x2078,
-0x80,
-0xc042,
-0xc144,
-0xc102,
-0xcde,
-0xe0,
-0x40c1,
-0x45cb,
-0x8000,
-0x67c,
-0xc043,
-0x40a1,
-0x9d6,
-0x260,
-0xd90d,
-0x40a1,
-0xd90d,
-0xf8e,
-0xe0,
-0xda40,
-0x40a1,
-0xd90d,
-0x95e,
-0xffef,
-0xda7f,
-0x275f,
-0x1100,
-0x43db,
-0x8000,
-0x6e0,
-0x7f05,
-0x1300,
-0x3080,
-0xe814,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x81d,
-0xdf,
-0xc002,
-0xf863,
-0x1c04,
-0x3001,
-0x1c00,
-0x3fc1,
-0x6159,
-0x61b9,
-0xd2a,
-0x2e0,
-0x704c,
-0xf00b,
-0xc002,
-0xf85d,
-0x1c00,
-0x3fc1,
-0x6159,
-0x61b9,
-0xbce,
-0x2e0,
-0x704c,
-0x40c3,
-0x9003,
-0xe04c,
-0x218a,
-0xfc7,
-0x1800,
-0x5,
-0x18fc,
-0x8044,
-0x706d,
-0xc003,
-0xe8aa,
-0xf022,
-0x265f,
-0x1401,
-0xc002,
-0x2116,
-0x0,
-0x7061,
-0x2032,
-0xf9e,
-0x8000,
-0x7a8,
-0xc004,
-0xe06,
-0x260,
-0x210a,
-0x780,
-0x261a,
-0x3f82,
-0x0,
-0x2000,
-0x41c3,
-0x9002,
-0x50,
-0xb88a,
-0x7165,
-0x2205,
-0x43,
-0xb964,
-0x7945,
-0xb300,
-0x1900,
-0xfc5,
-0xb300,
-0xc002,
-0x78d4,
-0x2032,
-0xf80,
-0x8000,
-0x784,
-0xbb5,
-0x9004,
-0x40a1,
-0xd90d,
-0x8a2,
-0xffef,
-0xda7f,
-0x40a1,
-0xd90d,
-0xebe,
-0xe0,
-0xda49,
-0x1300,
-0x3080,
-0xe813,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x81f,
-0xdf,
-0xc002,
-0xf82f,
-0x1c04,
-0x3001,
-0x1c00,
-0x3fc1,
-0x6159,
-0x61b9,
-0xc72,
-0x2e0,
-0x704c,
-0xf018,
-0xc002,
-0xf829,
-0x1c00,
-0x3fc1,
-0x6159,
-0x61b9,
-0xb16,
-0x2e0,
-0x704c,
-0x40c3,
-0x0,
-0x2710,
-0xbaa,
-0x120,
-0x702c,
-0x952,
-0xffcf,
-0x40c3,
-0x0,
-0x1d4c,
-0xb9a,
-0x120,
-0x732c,
-0x40c3,
-0x3,
-0xf7a0,
-0xb8e,
-0x120,
-0x702c,
-0x40a1,
-0xc92,
-0x220,
-0xd90d,
-0xc003,
-0xe8ad,
-0x70ad,
-0xf023,
-0x265f,
-0x1401,
-0xc002,
-0x7916,
-0x61b8,
-0x2032,
-0xf81,
-0x8000,
-0x7a8,
-0xc004,
-0xd2e,
-0x260,
-0x4328,
-0x702c,
-0xf00e,
-0x231a,
-0x1f82,
-0x0,
-0x2000,
-0x7124,
-0x2205,
-0xf82,
-0x9002,
-0x50,
-0xb260,
-0x204f,
-0x283,
-0xb260,
-0x9e7,
-0x80b4,
-0x204f,
-0x243,
-0x71a5,
-0xc002,
-0x78d4,
-0x2032,
-0xf80,
-0x8000,
-0x784,
-0xdb5,
-0x9004,
-0xc0a5,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x265f,
-0x1c82,
-0x43c3,
-0xffff,
-0xdfff,
-0x205f,
-0x641,
-0x78ef,
-0x7ee0,
-0x78e0,
-0x265f,
-0x1c82,
-0x43c3,
-0xffbf,
-0x87f7,
-0x205f,
-0x641,
-0x78ef,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x46cb,
-0x9004,
-0xf4,
-0x9600,
-0x6ea2,
-0x702c,
-0xc040,
-0xd8ff,
-0x1500,
-0x111b,
-0x95e3,
-0x1508,
-0x110b,
-0x1d08,
-0x13c5,
-0xb500,
-0x1d06,
-0x13c5,
-0xb600,
-0x1600,
-0x7080,
-0x8000,
-0x7c8,
-0x1e00,
-0x7004,
-0x9008,
-0x190,
-0x40c3,
-0x0,
-0x2af8,
-0xaae,
-0x120,
-0x1efa,
-0x9485,
-0xc000,
-0xb600,
-0xb5e3,
-0x1d00,
-0x16c4,
-0x1d08,
-0x12c4,
-0x1600,
-0x7080,
-0x8000,
-0x7c8,
-0x781d,
-0xb8a0,
-0x6829,
-0x40c3,
-0x8000,
-0x6e0,
-0xa821,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x47cb,
-0x9004,
-0x1e0,
-0x9720,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x70ad,
-0x205f,
-0x100,
-0x2044,
-0x7c2,
-0x4020,
-0xea06,
-0xba61,
-0xa01,
-0x31,
-0x781d,
-0xb8c3,
-0x80f,
-0x70,
-0xc1a1,
-0x807,
-0x190,
-0x71ad,
-0x700c,
-0xa3e,
-0x120,
-0xd940,
-0x46cb,
-0x9005,
-0xe112,
-0x1ede,
-0x1055,
-0x1ea6,
-0x9055,
-0x17b6,
-0x9100,
-0x716f,
-0xc040,
-0xed29,
-0xc000,
-0x84f,
-0x3bf,
-0xd91c,
-0xc000,
-0x2084,
-0xc07,
-0xc040,
-0xb88f,
-0xb600,
-0x700c,
-0xa0a,
-0x120,
-0x1ef6,
-0x9205,
-0x40c3,
-0xf,
-0x4240,
-0x702c,
-0x9fa,
-0x120,
-0x1ef6,
-0x9245,
-0x17be,
-0x9100,
-0x1ef0,
-0x9045,
-0x1ef6,
-0x9205,
-0x209a,
-0x8,
-0x2004,
-0xf81,
-0x0,
-0x3e00,
-0xc000,
-0x7825,
-0xb88e,
-0xb600,
-0xf005,
-0x1ef6,
-0x9205,
-0x1ef0,
-0x9045,
-0x1e00,
-0x76c4,
-0x9013,
-0xe050,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4608,
-0x40c3,
-0x8000,
-0x7c9,
-0x1000,
-0x9b,
-0x45cb,
-0x8000,
-0x67c,
-0x40a1,
-0xea6,
-0x220,
-0xd90d,
-0x40a1,
-0xd90d,
-0xe3a,
-0xffaf,
-0xda7f,
-0x40a1,
-0xd90d,
-0xe2e,
-0xffaf,
-0xdafe,
-0x40c3,
-0x8000,
-0x6e0,
-0x8800,
-0x2653,
-0x104f,
-0xe81c,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x82d,
-0xff,
-0x2778,
-0x1080,
-0x235f,
-0x3c82,
-0x205f,
-0x641,
-0x40c1,
-0x43c3,
-0xffff,
-0xdfff,
-0x1c04,
-0x3041,
-0x6159,
-0x61b9,
-0x704c,
-0x9f2,
-0x2e0,
-0x1c00,
-0x3fc1,
-0xf018,
-0xe12,
-0xff8f,
-0x2778,
-0x1080,
-0x235f,
-0x3c82,
-0x205f,
-0x641,
-0x265f,
-0x1100,
-0x43c3,
-0xffff,
-0xdfff,
-0x1c00,
-0x3fc1,
-0x6159,
-0x78c5,
-0x61b9,
-0x780f,
-0x87a,
-0x2e0,
-0x704c,
-0x40c3,
-0x0,
-0x36b0,
-0x90e,
-0x120,
-0xd90a,
-0x40a1,
-0xa12,
-0x220,
-0xd90d,
-0x1e00,
-0x7005,
-0x9003,
-0xe048,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x46cb,
-0x9004,
-0xf4,
-0x6ea2,
-0xd8ff,
-0x1600,
-0x111b,
-0x1500,
-0x111e,
-0x1506,
-0x110b,
-0x95e4,
-0x1d08,
-0x13c5,
-0xb500,
-0x1d06,
-0x13c5,
-0xb600,
-0x700c,
-0x1e00,
-0x7004,
-0x9008,
-0x190,
-0xd834,
-0x1efa,
-0x9004,
-0x40c3,
-0x0,
-0x2af8,
-0x8ae,
-0x120,
-0x702c,
-0x1e00,
-0x16c4,
-0x1d06,
-0x12c4,
-0x1d00,
-0x1784,
-0xb5e4,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x236f,
-0x343,
-0x260a,
-0x3040,
-0x9320,
-0x4348,
-0x218c,
-0x864a,
-0x80,
-0x2d,
-0x712c,
-0xe02,
-0xff8f,
-0x4508,
-0x235f,
-0x1800,
-0x2042,
-0x11b,
-0x13fe,
-0x8080,
-0x706c,
-0x201a,
-0xf8e,
-0x10,
-0x0,
-0xf02a,
-0x261a,
-0x3f81,
-0x0,
-0x1000,
-0x7825,
-0x2005,
-0x381,
-0x4060,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0x2005,
-0xf8f,
-0x9002,
-0x0,
-0xe4a,
-0xffaf,
-0x9700,
-0x7063,
-0x7a0e,
-0x785c,
-0x781c,
-0x781c,
-0x781c,
-0x4100,
-0xd81b,
-0xb861,
-0x801,
-0x31,
-0x793d,
-0x7164,
-0x6238,
-0xb8c4,
-0x4831,
-0x2a44,
-0x800,
-0x209a,
-0x1,
-0x7825,
-0xb700,
-0xbaf,
-0x80b4,
-0x2555,
-0x1800,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e2,
-0x45cb,
-0x9004,
-0x6,
-0xd820,
-0xf96,
-0xe0,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0xc2e6,
-0x45cb,
-0x9004,
-0x1c6,
-0x95c0,
-0xbecb,
-0x264f,
-0x12cf,
-0x2605,
-0x1f80,
-0x0,
-0xc00,
-0xb5e0,
-0xb500,
-0xf6a,
-0xe0,
-0xd80a,
-0xb5e0,
-0x9501,
-0xb5c0,
-0xb8c9,
-0xc6c6,
-0xc1e2,
-0xc1a1,
-0x781b,
-0x2005,
-0xf80,
-0x9000,
-0x86,
-0x9020,
-0x704c,
-0x706c,
-0x2153,
-0x100,
-0x1c02,
-0x3002,
-0x783d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0xb8c4,
-0x1c03,
-0x3002,
-0xf013,
-0x606c,
-0x712c,
-0x700c,
-0xf004,
-0x61b9,
-0x7c9d,
-0x7104,
-0x8fb,
-0x8174,
-0x2444,
-0x104d,
-0x782f,
-0xd978,
-0x2905,
-0x1,
-0x784f,
-0x7164,
-0x611a,
-0xbdf,
-0x80b4,
-0x2440,
-0x3080,
-0x2284,
-0xf83,
-0x785d,
-0xc5c2,
-0x78e0,
-0x701,
-0xff6f,
-0x4040,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0x1600,
-0x711e,
-0x9018,
-0x1dc,
-0x1201,
-0x308c,
-0xc609,
-0x4378,
-0x706c,
-0xf013,
-0x43cb,
-0x9004,
-0x200,
-0x2705,
-0x32cd,
-0x95a0,
-0xc780,
-0x677f,
-0x2340,
-0x180b,
-0xafa0,
-0x2705,
-0x32cd,
-0x95a0,
-0x7164,
-0xe508,
-0xafa8,
-0xbe1,
-0x81b4,
-0x272f,
-0x30c0,
-0xe48c,
-0x304,
-0x2d,
-0x238a,
-0x205,
-0xb9d,
-0x32e,
-0x746d,
-0xc0f,
-0x1230,
-0x1b00,
-0x32c2,
-0x7695,
-0xf4af,
-0x71ad,
-0x706c,
-0xaea3,
-0xaea2,
-0xae61,
-0xae60,
-0x75ed,
-0x73cd,
-0x728d,
-0xa9e3,
-0xa9c2,
-0xa981,
-0xa960,
-0xaac5,
-0xaa83,
-0xaaa2,
-0xaa60,
-0xc120,
-0x6119,
-0xa960,
-0x1401,
-0x3081,
-0x6119,
-0xa960,
-0x1402,
-0x3081,
-0x6119,
-0xa980,
-0x1403,
-0x3081,
-0x6119,
-0xa980,
-0xc121,
-0x6119,
-0xa980,
-0x1405,
-0x3081,
-0x6119,
-0xa980,
-0xa8a7,
-0xa8a6,
-0xc122,
-0x6119,
-0xa9c0,
-0x1409,
-0x3081,
-0x6119,
-0xa9c0,
-0x140a,
-0x3081,
-0x6119,
-0xa9e0,
-0x140b,
-0x3081,
-0x6119,
-0xa9e0,
-0xc123,
-0x6119,
-0xa9e0,
-0x140d,
-0x3081,
-0x6119,
-0xa9e0,
-0x180f,
-0x2c2,
-0x269,
-0x20,
-0x180e,
-0x2c2,
-0x43c3,
-0x0,
-0x1400,
-0x2311,
-0x8300,
-0x258,
-0x21,
-0x71ed,
-0x706c,
-0xaee5,
-0xaee4,
-0xaee3,
-0xae62,
-0xae61,
-0xae60,
-0x260c,
-0xbf80,
-0x0,
-0x2208,
-0x73ad,
-0x726c,
-0xf47c,
-0x708d,
-0x1b00,
-0x3143,
-0xaee4,
-0xaee3,
-0xaee2,
-0xae81,
-0xae80,
-0xde0b,
-0x234a,
-0x1280,
-0x264a,
-0x3180,
-0xa9c4,
-0x1903,
-0x2c2,
-0x1902,
-0x782,
-0xa9a1,
-0xa980,
-0x742c,
-0xaa2b,
-0x702c,
-0xaaaa,
-0xaa66,
-0xaae3,
-0xaa20,
-0xc120,
-0x603a,
-0x702c,
-0xaa20,
-0x1401,
-0x3081,
-0x603a,
-0x702c,
-0xaa20,
-0x1402,
-0x3081,
-0x6119,
-0xa9a0,
-0x1403,
-0x3081,
-0x6119,
-0xa9a0,
-0xc121,
-0x6119,
-0xa9a0,
-0x1405,
-0x3081,
-0x6119,
-0xa9a0,
-0x742c,
-0xa8e7,
-0xa826,
-0xc122,
-0x6119,
-0x1900,
-0x782,
-0x1409,
-0x3081,
-0x6119,
-0x1900,
-0x782,
-0x140a,
-0x3081,
-0x6119,
-0x1900,
-0x2c2,
-0x140b,
-0x3081,
-0x6119,
-0xa9c0,
-0xc123,
-0x6119,
-0xa9c0,
-0x140d,
-0x3081,
-0x6119,
-0x1900,
-0x2c2,
-0x180f,
-0x1c3,
-0xf079,
-0x726c,
-0x708d,
-0x1b00,
-0x30c2,
-0xae81,
-0xae80,
-0xa961,
-0xa980,
-0x718d,
-0x702c,
-0xaa82,
-0xaa20,
-0xc120,
-0x603a,
-0x702c,
-0xaa20,
-0x1401,
-0x3081,
-0x603a,
-0x702c,
-0xaa20,
-0x1402,
-0x3081,
-0x6119,
-0xa960,
-0x1403,
-0x3081,
-0x6119,
-0xa960,
-0xc121,
-0x6119,
-0xa960,
-0x1405,
-0x3081,
-0x6119,
-0xa960,
-0xa887,
-0xa886,
-0xf0a2,
-0x264a,
-0x3200,
-0xca5,
-0x1331,
-0x234a,
-0x11c0,
-0x768d,
-0x1b00,
-0x3302,
-0x1905,
-0x782,
-0x1904,
-0x2c2,
-0xa983,
-0xa9a2,
-0xa961,
-0xa9e0,
-0x742c,
-0x1a08,
-0x143,
-0xaa27,
-0x702c,
-0xaaa6,
-0xaa63,
-0xaae2,
-0xaa21,
-0xc120,
-0x6119,
-0xa9a0,
-0x1401,
-0x3081,
-0x6119,
-0xa9e0,
-0x1402,
-0x3081,
-0x6119,
-0xa9a0,
-0x1403,
-0x3081,
-0x6119,
-0xa960,
-0xc121,
-0x6119,
-0xa960,
-0x1405,
-0x3081,
-0x6119,
-0xa9e0,
-0x742c,
-0x1807,
-0x243,
-0xa826,
-0xc122,
-0x6119,
-0x1900,
-0x2c2,
-0x1409,
-0x3081,
-0x6119,
-0x1900,
-0x782,
-0x140a,
-0x3081,
-0x6119,
-0x1900,
-0x782,
-0x140b,
-0x3081,
-0x6119,
-0x1900,
-0x782,
-0xc123,
-0x6119,
-0x1900,
-0x2c2,
-0x140d,
-0x3081,
-0x6119,
-0xa980,
-0x180f,
-0x283,
-0x180e,
-0x143,
-0xf04e,
-0x708d,
-0xaee3,
-0xaee2,
-0xae81,
-0xae80,
-0x748d,
-0x1b00,
-0x3302,
-0x1903,
-0x782,
-0x1902,
-0x2c2,
-0xa9a1,
-0xa960,
-0x702c,
-0xaaa8,
-0xaa67,
-0xaae3,
-0xaa22,
-0xc120,
-0x6119,
-0xa960,
-0x1401,
-0x3081,
-0x6119,
-0xa960,
-0x1402,
-0x3081,
-0x6119,
-0xa960,
-0x1403,
-0x3081,
-0x6119,
-0xa960,
-0xc121,
-0x6119,
-0xa9a0,
-0x1405,
-0x3081,
-0x6119,
-0xa9a0,
-0x702c,
-0xa827,
-0xa8e6,
-0xc122,
-0x6119,
-0x1900,
-0x2c2,
-0x1409,
-0x3081,
-0x6119,
-0x1900,
-0x2c2,
-0x140a,
-0x3081,
-0x6119,
-0x1900,
-0x2c2,
-0x140b,
-0x3081,
-0x6119,
-0x1900,
-0x2c2,
-0xc123,
-0x6119,
-0x1900,
-0x782,
-0x140d,
-0x3081,
-0x6119,
-0x1900,
-0x782,
-0x180f,
-0x143,
-0x180e,
-0x183,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0x215f,
-0x641,
-0x205f,
-0xc80,
-0x6119,
-0x2132,
-0xf80,
-0x8000,
-0x688,
-0x7fe0,
-0xb8c6,
-0x78e0,
-0x7014,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x41c3,
-0x9004,
-0x168,
-0x21c2,
-0x222,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x7905,
-0x7fe0,
-0x9100,
-0x78e0,
-0xc2e6,
-0x1600,
-0x710d,
-0x9004,
-0x1c6,
-0x47cb,
-0x9005,
-0xe1c6,
-0xd80a,
-0xbdc9,
-0x254f,
-0x12ce,
-0xb46,
-0xe0,
-0xb7c0,
-0x2505,
-0x1f80,
-0x0,
-0xc00,
-0xb700,
-0xb36,
-0xe0,
-0xd80a,
-0xd80a,
-0xb2e,
-0xe0,
-0xb7c0,
-0x1600,
-0x7100,
-0x9002,
-0x1c8,
-0xb7a0,
-0xb8c9,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a7,
-0x4318,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xc144,
-0x704c,
-0xc046,
-0x40c3,
-0x8000,
-0x7d8,
-0x8020,
-0x4063,
-0xa92,
-0xa0,
-0x706c,
-0x700c,
-0xc6a,
-0xff6f,
-0xd9ff,
-0x710c,
-0x4508,
-0x2344,
-0x37c0,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x7dbb,
-0x70cd,
-0x2553,
-0x1040,
-0xc045,
-0xc042,
-0xd8ff,
-0x702c,
-0xda09,
-0xdbff,
-0xc643,
-0xc641,
-0xd12,
-0xff6f,
-0xc640,
-0x255a,
-0x110d,
-0x702c,
-0x734c,
-0xdb22,
-0x250f,
-0x16c0,
-0x7d0f,
-0xd840,
-0xc040,
-0xd8ff,
-0xc643,
-0xc542,
-0xcf2,
-0xff6f,
-0x1c04,
-0x35c1,
-0xd84b,
-0xc040,
-0xd8ff,
-0xd980,
-0xda17,
-0x746c,
-0xc643,
-0xc542,
-0xcda,
-0xff6f,
-0xc641,
-0x700c,
-0xc92,
-0xff6f,
-0x712c,
-0xc52,
-0x1c0,
-0xa7a,
-0xe0,
-0x208a,
-0x10,
-0x40c3,
-0x0,
-0x9c40,
-0xac2,
-0xe0,
-0xd908,
-0x700c,
-0xbda,
-0xff6f,
-0xd9ff,
-0x47cb,
-0x0,
-0x1200,
-0xd8ff,
-0xd908,
-0xda0d,
-0xdb20,
-0xc643,
-0xc542,
-0xc641,
-0xc9a,
-0xff6f,
-0xc740,
-0x2756,
-0x1800,
-0xc040,
-0xd8ff,
-0xd988,
-0xda0d,
-0xdb08,
-0xc643,
-0xc542,
-0xc82,
-0xff6f,
-0xc641,
-0x700c,
-0xc3a,
-0xff6f,
-0x712c,
-0x46cb,
-0x8000,
-0x7cd,
-0x8ea0,
-0xf00e,
-0x4063,
-0xb62,
-0x20,
-0x41e1,
-0xe809,
-0x40e1,
-0x9c6,
-0x1e0,
-0x702c,
-0xc104,
-0x79b4,
-0xb100,
-0x71a5,
-0x8e41,
-0xae7,
-0x8365,
-0x7faf,
-0x8ee0,
-0xf03c,
-0x4063,
-0xb3e,
-0x20,
-0x41a1,
-0xe834,
-0x40a1,
-0x99e,
-0x1e0,
-0xd910,
-0xc504,
-0x209a,
-0x4,
-0x42e1,
-0x7df4,
-0x9520,
-0x7825,
-0xb500,
-0x7810,
-0x41c3,
-0xe0,
-0x1,
-0xa96,
-0xff2f,
-0x2079,
-0x0,
-0x1600,
-0x7100,
-0x8000,
-0x6,
-0x208c,
-0x81c3,
-0xf706,
-0x710c,
-0x1d00,
-0x1045,
-0xf00e,
-0x9500,
-0x80f,
-0x95,
-0x40c3,
-0x0,
-0xffff,
-0xf005,
-0x2e05,
-0x7000,
-0x1,
-0x0,
-0xb500,
-0x7b10,
-0x740c,
-0x41c3,
-0xe1,
-0x2,
-0xfc2,
-0xff6f,
-0x42e1,
-0x8e41,
-0x71e5,
-0xa8d,
-0x83e5,
-0x7def,
-0x8ea0,
-0xf010,
-0xac2,
-0x20,
-0x4063,
-0xe88a,
-0xc004,
-0xd0b,
-0x103f,
-0x78b4,
-0x9021,
-0xf003,
-0x10fe,
-0x8101,
-0xb020,
-0x8e41,
-0x71a5,
-0xae3,
-0x8365,
-0x79af,
-0x8e60,
-0xf016,
-0xc106,
-0x40c3,
-0x9002,
-0x15c,
-0x211a,
-0xf81,
-0x20,
-0x0,
-0x20c0,
-0xa2,
-0x7905,
-0x231a,
-0xf80,
-0x0,
-0x2000,
-0x7905,
-0xc004,
-0x20f4,
-0xc0,
-0x7164,
-0xb100,
-0xad7,
-0x80e5,
-0x7077,
-0x700c,
-0xa92,
-0xff6f,
-0xd9ff,
-0xc005,
-0x702c,
-0xda0a,
-0xc042,
-0xd8ff,
-0x746c,
-0x4528,
-0xc143,
-0xc141,
-0xb52,
-0xff6f,
-0xc140,
-0xd8ff,
-0x702c,
-0x754c,
-0x766c,
-0x4608,
-0xc043,
-0xc542,
-0xc541,
-0xb3e,
-0xff6f,
-0xc540,
-0xc005,
-0x702c,
-0xda0e,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0xc541,
-0xb26,
-0xff6f,
-0xc540,
-0xd8ff,
-0xd980,
-0x754c,
-0x766c,
-0xc643,
-0xc542,
-0xc541,
-0xb12,
-0xff6f,
-0xc540,
-0x700c,
-0xaca,
-0xff6f,
-0x712c,
-0xa8a,
-0x1c0,
-0xc0a7,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc0f1,
-0x4300,
-0x4328,
-0x4020,
-0xd06,
-0xffef,
-0x4160,
-0xe8b8,
-0x246f,
-0x1dc3,
-0x8c20,
-0x969,
-0x1e,
-0x142f,
-0x1080,
-0x235f,
-0x1c81,
-0xb8c0,
-0x205f,
-0x640,
-0x6038,
-0x2032,
-0xf80,
-0x8000,
-0x687,
-0x781d,
-0x781d,
-0x781d,
-0x791d,
-0xb9c2,
-0xd8f0,
-0x2805,
-0x41,
-0xeb05,
-0x143c,
-0x1080,
-0xf002,
-0x8c09,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x7014,
-0x7b2f,
-0x20ca,
-0x61,
-0xb1b,
-0x24,
-0x218a,
-0x404,
-0x2b05,
-0x1,
-0x208a,
-0xa0f,
-0x782c,
-0x6159,
-0x793b,
-0x2805,
-0x41,
-0xf96,
-0x20,
-0x7830,
-0xc0d1,
-0x7ee0,
-0x1600,
-0x7100,
-0x8000,
-0x22,
-0x7014,
-0x7de0,
-0x1600,
-0x7100,
-0x9004,
-0x8,
-0x7ee0,
-0x78e0,
-0xc2e4,
-0x43c3,
-0x8000,
-0x7ca,
-0x8b00,
-0xdea,
-0xff6f,
-0x712c,
-0x1600,
-0x7081,
-0x8000,
-0x4,
-0x8b82,
-0x8b41,
-0x211a,
-0xf8d,
-0x10,
-0x0,
-0x776c,
-0xf01c,
-0x221a,
-0xf81,
-0x0,
-0x800,
-0x2104,
-0xf8e,
-0x37fe,
-0xf000,
-0x2055,
-0x801,
-0x79a5,
-0x79c5,
-0x6ac1,
-0x229a,
-0x4,
-0x2284,
-0x4,
-0x7a25,
-0x795b,
-0xb991,
-0xb99c,
-0xb99f,
-0x9120,
-0x42c1,
-0x2108,
-0xc3,
-0xccd,
-0x9085,
-0x4060,
-0xd908,
-0xb961,
-0x901,
-0x31,
-0x781c,
-0x796f,
-0x2179,
-0x1,
-0x6038,
-0x7204,
-0xc6c4,
-0x40c3,
-0x8000,
-0x7d8,
-0x7bd,
-0xff2f,
-0x8000,
-0x40c3,
-0x8000,
-0x7d8,
-0x42c3,
-0x8000,
-0x7c9,
-0x8020,
-0x8a00,
-0x205f,
-0xc80,
-0x6038,
-0x8a21,
-0x215f,
-0x641,
-0x6038,
-0x8842,
-0x700c,
-0x75,
-0xffef,
-0x702c,
-0x40c3,
-0x8000,
-0x7cb,
-0x8881,
-0x8860,
-0xf022,
-0x231a,
-0xf80,
-0x0,
-0x800,
-0x2004,
-0xf81,
-0x0,
-0x800,
-0x231a,
-0xf80,
-0x0,
-0x1000,
-0x2004,
-0xf80,
-0x6ffd,
-0xe000,
-0x7825,
-0x2005,
-0xf82,
-0x9002,
-0x64,
-0x9220,
-0x4928,
-0x208b,
-0x880f,
-0xf206,
-0x2142,
-0x400,
-0x2080,
-0x10,
-0xb200,
-0x7164,
-0xcc1,
-0x90c5,
-0x7ee0,
-0x78e0,
-0xc0e4,
-0x4508,
-0x259a,
-0x1008,
-0x44cb,
-0x900e,
-0x48,
-0x2505,
-0x130e,
-0xb620,
-0x6c22,
-0x2505,
-0x104c,
-0x7224,
-0xb440,
-0x2505,
-0x1042,
-0xb260,
-0x6962,
-0xc102,
-0x7d65,
-0x80f,
-0x3f1,
-0xb520,
-0x208a,
-0xfc7,
-0xf005,
-0x137c,
-0x101,
-0x210f,
-0x0,
-0x1b7c,
-0x4,
-0xc4c4,
-0x44cb,
-0x900e,
-0xc2,
-0x1c02,
-0x1014,
-0xb420,
-0xb441,
-0x7fe0,
-0xb462,
-0x78e0,
-0xc2e4,
-0x4320,
-0x4100,
-0x40c3,
-0x8000,
-0x7d0,
-0x8800,
-0xf06,
-0x60,
-0x203c,
-0xc0,
-0x7014,
-0x710c,
-0xf427,
-0xde25,
-0xbe9f,
-0x708d,
-0xf01f,
-0xec04,
-0x1633,
-0x1082,
-0xf003,
-0x8e40,
-0xa31,
-0x6e,
-0x2114,
-0x302,
-0x2232,
-0xf8b,
-0x8000,
-0x784,
-0x704c,
-0xa1d,
-0x2c5,
-0x245a,
-0x140d,
-0x7d36,
-0x655d,
-0x2532,
-0x1f8d,
-0x8000,
-0x7a8,
-0xded,
-0x90e1,
-0x7144,
-0xf007,
-0x7185,
-0xcc9,
-0x9094,
-0x700c,
-0xc6c4,
-0xc6c4,
-0x219a,
-0x10,
-0x781b,
-0x2005,
-0xf80,
-0x9003,
-0xe064,
-0x2145,
-0x7c1,
-0x779,
-0xe0,
-0xb020,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a3,
-0x704c,
-0xf005,
-0x1900,
-0x5,
-0x7144,
-0xafd,
-0x8674,
-0x2014,
-0x81,
-0xdb32,
-0xbb9f,
-0x8b20,
-0xa821,
-0x6b21,
-0xc140,
-0x8920,
-0xa822,
-0xc100,
-0x7124,
-0xc141,
-0x8920,
-0xa823,
-0xc101,
-0x7124,
-0xc142,
-0x8920,
-0xa824,
-0xc102,
-0x6941,
-0x8a20,
-0x2240,
-0x5f,
-0x2740,
-0x304c,
-0xa82b,
-0x1700,
-0x3081,
-0x6ca1,
-0x6dc1,
-0xa82c,
-0x8c20,
-0x6ee1,
-0x4358,
-0xa82d,
-0x8d20,
-0xa82e,
-0x8e20,
-0xa830,
-0x8f20,
-0xa831,
-0x8f21,
-0xa836,
-0x8f22,
-0xa838,
-0x13e6,
-0x8081,
-0xe930,
-0x264a,
-0x3000,
-0xf02a,
-0x265a,
-0x3c82,
-0x235a,
-0x1641,
-0x7165,
-0x621a,
-0x6159,
-0x8b40,
-0xa941,
-0xc200,
-0x8a40,
-0xa942,
-0xc201,
-0x8a40,
-0xa943,
-0xc202,
-0x8a40,
-0xa944,
-0x1300,
-0x3082,
-0xa94b,
-0x1700,
-0x3082,
-0xa94c,
-0x8c40,
-0xa94d,
-0x8d40,
-0xa94e,
-0x8e40,
-0xa950,
-0x8f40,
-0xa951,
-0x8f41,
-0xa956,
-0x8f42,
-0xa958,
-0xbb9,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0xf08d,
-0xda3e,
-0xba9f,
-0x1201,
-0x481,
-0xa83a,
-0x1201,
-0x481,
-0xa83b,
-0x1201,
-0x481,
-0xa83c,
-0x1201,
-0x481,
-0xa83d,
-0x1201,
-0x481,
-0x1824,
-0x42,
-0x1201,
-0x481,
-0x1825,
-0x42,
-0x1201,
-0x481,
-0x1826,
-0x42,
-0x1201,
-0x481,
-0x1827,
-0x42,
-0x1201,
-0x481,
-0x1829,
-0x42,
-0x1201,
-0x481,
-0x182a,
-0x42,
-0x1201,
-0x481,
-0x182f,
-0x42,
-0x121c,
-0x481,
-0x1831,
-0x42,
-0x1201,
-0x481,
-0x1833,
-0x42,
-0x1201,
-0x481,
-0x1834,
-0x42,
-0x1201,
-0x481,
-0x1835,
-0x42,
-0x1201,
-0x481,
-0x1836,
-0x42,
-0x1201,
-0x481,
-0x183d,
-0x42,
-0x1201,
-0x481,
-0x183e,
-0x42,
-0x1201,
-0x481,
-0x183f,
-0x42,
-0x1201,
-0x481,
-0x1840,
-0x42,
-0x1201,
-0x481,
-0x1842,
-0x42,
-0x1201,
-0x481,
-0x1843,
-0x42,
-0x1201,
-0x481,
-0x1848,
-0x42,
-0x1201,
-0x481,
-0x184a,
-0x42,
-0x1201,
-0x481,
-0x184c,
-0x42,
-0x1201,
-0x481,
-0x184d,
-0x42,
-0x1201,
-0x481,
-0x184e,
-0x42,
-0x1201,
-0x481,
-0x184f,
-0x42,
-0x1201,
-0x481,
-0x1856,
-0x42,
-0x1201,
-0x481,
-0x1857,
-0x42,
-0x1201,
-0x481,
-0x1858,
-0x42,
-0x1201,
-0x481,
-0x1859,
-0x42,
-0x1201,
-0x481,
-0x185b,
-0x42,
-0x8a20,
-0x185c,
-0x42,
-0x8a21,
-0x1861,
-0x42,
-0x8a22,
-0x1863,
-0x42,
-0xc0a3,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc3e4,
-0xc1ab,
-0xc080,
-0x41c3,
-0x8000,
-0x650,
-0xc2e,
-0xfeef,
-0xda2a,
-0xc080,
-0x92e,
-0x2a0,
-0xd92a,
-0xdd25,
-0xbd9f,
-0x8d00,
-0x46cb,
-0x9004,
-0xe4,
-0xb600,
-0x1533,
-0x1080,
-0xb601,
-0x15f4,
-0x9080,
-0xe888,
-0x1e00,
-0x7005,
-0x9003,
-0xe154,
-0x1e42,
-0x905d,
-0xbda,
-0xffcf,
-0x2053,
-0xc1,
-0x1a01,
-0x3042,
-0x791d,
-0x793d,
-0x793d,
-0x793d,
-0xb9c3,
-0x1a02,
-0x3042,
-0xd908,
-0xb961,
-0x901,
-0x31,
-0x781d,
-0xb8c1,
-0xdea,
-0x1e0,
-0x1a06,
-0x3002,
-0x9ce,
-0x0,
-0x8b2,
-0x1c0,
-0x164c,
-0x9100,
-0x80d,
-0x151,
-0x8d00,
-0xb600,
-0xb601,
-0xc7c4,
-0x78e0,
-0xc3e2,
-0xc1bd,
-0x4508,
-0xc080,
-0x41c3,
-0x8000,
-0x4ad,
-0xba6,
-0xfeef,
-0xda72,
-0xc080,
-0x8a6,
-0x2a0,
-0xd972,
-0xed07,
-0x208a,
-0xc07,
-0x1e00,
-0x7004,
-0x9003,
-0xe8c4,
-0xc7c2,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a7,
-0xbfa,
-0xffef,
-0x4708,
-0xb72,
-0xffef,
-0xc046,
-0xbe2,
-0xffef,
-0xc044,
-0xc045,
-0x40c3,
-0x0,
-0x2710,
-0xbe2,
-0xa0,
-0x742c,
-0x4608,
-0x700c,
-0xcd6,
-0xff2f,
-0xd91f,
-0xca00,
-0x702c,
-0x70ad,
-0x7604,
-0x7b0f,
-0xd8ff,
-0xb98e,
-0x754c,
-0xc543,
-0xc742,
-0xc541,
-0xd92,
-0xff2f,
-0xc540,
-0x7bcf,
-0xd8ff,
-0x702c,
-0x704c,
-0xc543,
-0xc742,
-0xc541,
-0xd7e,
-0xff2f,
-0xc540,
-0x71cd,
-0xd8ff,
-0x702c,
-0x704c,
-0xdb7c,
-0xc543,
-0xc742,
-0xc641,
-0xd6a,
-0xff2f,
-0xc540,
-0xfae,
-0xff2f,
-0xd8ff,
-0xd8ff,
-0x41c3,
-0x1,
-0x0,
-0x724c,
-0xdb08,
-0xc643,
-0xc742,
-0xc641,
-0xc540,
-0xd4a,
-0xff2f,
-0x4338,
-0xf838,
-0xc543,
-0xc742,
-0xc541,
-0xd3a,
-0xff2f,
-0xc540,
-0xf835,
-0xc543,
-0xc742,
-0xc641,
-0xd2e,
-0xff2f,
-0xc540,
-0xd8ff,
-0x4163,
-0x724c,
-0xdb08,
-0xc643,
-0xc742,
-0xc641,
-0xd1a,
-0xff2f,
-0xc540,
-0xc006,
-0x754c,
-0xc543,
-0x2044,
-0x41,
-0x6038,
-0xe020,
-0x7b0f,
-0xd8ff,
-0x702c,
-0xc542,
-0xc541,
-0xcfa,
-0xff2f,
-0xc540,
-0xd8ff,
-0x218a,
-0x10,
-0x714c,
-0xdb08,
-0xc543,
-0xc742,
-0xc541,
-0xce6,
-0xff2f,
-0xc540,
-0xc105,
-0xc004,
-0x714c,
-0xc543,
-0x7914,
-0x2154,
-0xc80,
-0xb8c0,
-0x6038,
-0x2054,
-0xc80,
-0x7b0f,
-0xd8ff,
-0x218a,
-0x10,
-0xc742,
-0xc641,
-0xcbe,
-0xff2f,
-0xc540,
-0x700c,
-0xb88e,
-0x791b,
-0xd8ff,
-0x754c,
-0x726c,
-0x1c0c,
-0x30c1,
-0xc542,
-0xc541,
-0xca2,
-0xff2f,
-0xc540,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb40,
-0xc543,
-0xc542,
-0xc541,
-0xc8e,
-0xff2f,
-0xc540,
-0xeba,
-0xff2f,
-0xd8ff,
-0xbfc1,
-0xd8ff,
-0xd980,
-0x764c,
-0x746c,
-0xc543,
-0xc742,
-0xc541,
-0xc72,
-0xff2f,
-0xc640,
-0xc0a7,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0x218a,
-0x10,
-0x724c,
-0xdb08,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x1600,
-0x7101,
-0x9004,
-0x1e0,
-0x1600,
-0x7082,
-0x8000,
-0x4,
-0x225f,
-0x100,
-0x2044,
-0x7c3,
-0x4020,
-0xeb05,
-0xbb61,
-0xbff,
-0x8031,
-0x781d,
-0xb8c3,
-0x80b,
-0x190,
-0x877,
-0x71,
-0xdf18,
-0x46cb,
-0x9004,
-0x116,
-0x1e08,
-0x1094,
-0x71ad,
-0x1e02,
-0x1055,
-0xd829,
-0xb6a0,
-0x1e6c,
-0x1205,
-0x1e6c,
-0x1004,
-0x702c,
-0x40c3,
-0x98,
-0x9680,
-0x4328,
-0x1ef2,
-0x9044,
-0x9fe,
-0xa0,
-0x1e66,
-0x1044,
-0xd8a9,
-0x1e6c,
-0x1004,
-0x208a,
-0xa46,
-0x1e6c,
-0x1004,
-0x208a,
-0xa44,
-0x1e6c,
-0x1004,
-0x1e6c,
-0x1004,
-0x40c3,
-0x0,
-0x6000,
-0x1e72,
-0x935c,
-0x1ed0,
-0x9344,
-0x1e72,
-0x90dd,
-0x972,
-0xa0,
-0x1ed0,
-0x92c4,
-0x1e72,
-0x935c,
-0x1e72,
-0x92dc,
-0xf046,
-0x45cb,
-0x9004,
-0x116,
-0x1d08,
-0x1094,
-0x71cd,
-0x1d02,
-0x1055,
-0x234a,
-0x1200,
-0x702c,
-0xbf8b,
-0x40c3,
-0xf,
-0x4240,
-0xb5c0,
-0x1d6c,
-0x12c4,
-0x260a,
-0x3040,
-0x1df2,
-0x9044,
-0x1d66,
-0x1044,
-0x1d6c,
-0x13c4,
-0x986,
-0xa0,
-0x4318,
-0xbf70,
-0x202f,
-0x6c2,
-0x702c,
-0x976,
-0xa0,
-0x1d6c,
-0x13c4,
-0x40c3,
-0x98,
-0x9680,
-0x702c,
-0x966,
-0xa0,
-0x1d6c,
-0x12c4,
-0xd888,
-0x1d6c,
-0x1004,
-0x40c3,
-0x0,
-0x6000,
-0x1d6c,
-0x12c4,
-0x1d6c,
-0x1784,
-0x1d72,
-0x939c,
-0x1dd0,
-0x9384,
-0x1d72,
-0x90dd,
-0x8e6,
-0xa0,
-0x1dd0,
-0x9784,
-0x1d72,
-0x939c,
-0x1d72,
-0x979c,
-0x700c,
-0x92e,
-0xa0,
-0xd920,
-0x45cb,
-0x9004,
-0x1f0,
-0xd820,
-0x8c6,
-0xa0,
-0x1d00,
-0x1005,
-0xd820,
-0x8be,
-0xa0,
-0x1d00,
-0x1045,
-0x740c,
-0x8b2,
-0xa0,
-0x1d00,
-0x1005,
-0x1d0a,
-0x909d,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x2088,
-0x901,
-0x2089,
-0x906,
-0x2080,
-0x78e,
-0x781d,
-0x781d,
-0x9,
-0x20,
-0x780f,
-0x78e0,
-0x80b,
-0x8f4,
-0x4100,
-0xb97e,
-0xb986,
-0x7fe0,
-0x782f,
-0x78e0,
-0xc3e6,
-0xc1aa,
-0x70cd,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8cd,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8cc,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8cb,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8ca,
-0x41c3,
-0x89,
-0x0,
-0xe82,
-0xff2f,
-0xd80a,
-0x23b,
-0x0,
-0x2644,
-0x17c1,
-0xe906,
-0xb961,
-0x901,
-0x31,
-0x781b,
-0x1be4,
-0xb000,
-0x211,
-0x20,
-0x702c,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0x81f,
-0x5e,
-0xea07,
-0x1600,
-0x7080,
-0x8000,
-0x7d,
-0xf005,
-0x1600,
-0x7080,
-0x8000,
-0x4a,
-0x7610,
-0xf4f3,
-0x78cf,
-0x1bf0,
-0xb000,
-0x13f0,
-0xb001,
-0xc62,
-0xffaf,
-0x4040,
-0x4508,
-0xea0b,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0x13e4,
-0xb000,
-0x782b,
-0x712c,
-0xf40c,
-0xf0df,
-0x1600,
-0x7081,
-0x8000,
-0x25,
-0x13e4,
-0xb000,
-0x782b,
-0x702c,
-0xf2d7,
-0x710c,
-0xbac4,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781b,
-0xa4e,
-0xff6f,
-0x780f,
-0x13e4,
-0xb000,
-0x41a1,
-0x1e00,
-0x7043,
-0x8000,
-0x6e0,
-0x780f,
-0xb06,
-0xff6f,
-0x1be8,
-0xb000,
-0x702c,
-0xd854,
-0x1be0,
-0xb040,
-0x1e00,
-0x7042,
-0x8000,
-0x6e0,
-0x1bfc,
-0xb700,
-0x2402,
-0x301c,
-0xc082,
-0xf9a,
-0xfeaf,
-0x1bec,
-0xb000,
-0xf005,
-0x1801,
-0x13,
-0x7124,
-0xe1d0,
-0xf7fc,
-0x70ad,
-0xf041,
-0xeea,
-0xffef,
-0x78af,
-0x1bf4,
-0xb000,
-0x1600,
-0x7081,
-0x8000,
-0x7c9,
-0x13e8,
-0xb000,
-0x13f4,
-0xb002,
-0xe56,
-0x20,
-0x1bf8,
-0xb001,
-0x40c3,
-0x3,
-0xd090,
-0xf9e,
-0x60,
-0x702c,
-0x84a,
-0xff2f,
-0x13e8,
-0xb000,
-0x13f0,
-0xb000,
-0x2342,
-0x3201,
-0x85e,
-0xfeef,
-0x724c,
-0x13f8,
-0xb000,
-0x41c3,
-0x8a,
-0x4,
-0x43c1,
-0x2004,
-0xf8f,
-0x0,
-0x3f00,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x1bf8,
-0xb3c0,
-0xc741,
-0xc040,
-0x13f4,
-0xb002,
-0xd3a,
-0xff2f,
-0x740c,
-0xef06,
-0x13ec,
-0xb000,
-0x60b8,
-0x1800,
-0x43,
-0x71a5,
-0xe5d0,
-0x77e,
-0xffee,
-0x774c,
-0x4548,
-0x4748,
-0x4140,
-0xf022,
-0x13ec,
-0xb000,
-0x1001,
-0x483,
-0x1bec,
-0xb000,
-0xf212,
-0x13e0,
-0xb000,
-0xe0d0,
-0xf203,
-0xeb11,
-0x13e0,
-0xb000,
-0x4fb4,
-0x7704,
-0x4833,
-0x7391,
-0x27ca,
-0x1009,
-0x25ca,
-0x1049,
-0xf003,
-0xeb03,
-0x772c,
-0xf003,
-0x13e0,
-0xb001,
-0x13e0,
-0xb000,
-0x7104,
-0x1be0,
-0xb000,
-0x13e0,
-0xb000,
-0xe0d1,
-0x7ba,
-0xffe5,
-0x7734,
-0x2139,
-0x83,
-0x2538,
-0x1080,
-0x786b,
-0xd850,
-0x753c,
-0x771c,
-0x77b5,
-0x700c,
-0xf204,
-0x4fb0,
-0x207f,
-0x100,
-0x1600,
-0x7083,
-0x8000,
-0x7c9,
-0x41c3,
-0x8c,
-0x2,
-0xf32,
-0xfeaf,
-0x42c1,
-0x67b8,
-0x2844,
-0x80,
-0xdd6,
-0xffef,
-0x780f,
-0x1e00,
-0x7043,
-0x8000,
-0x6e0,
-0x1600,
-0x7081,
-0x8000,
-0x7c9,
-0x2614,
-0x1041,
-0x2100,
-0xf81,
-0x8000,
-0x7c9,
-0xa90a,
-0xcda,
-0xff6f,
-0x13e8,
-0xb000,
-0x13fc,
-0xb01c,
-0x1600,
-0x7081,
-0x8000,
-0x7c9,
-0x7124,
-0x7a2f,
-0x7154,
-0x1e00,
-0x7042,
-0x8000,
-0x7c9,
-0x5ea,
-0xffce,
-0x71c5,
-0x72d5,
-0x5ca,
-0xffe5,
-0x710c,
-0x40c3,
-0x8000,
-0x7c9,
-0x180e,
-0x43,
-0xc7c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1bd,
-0xd925,
-0xb99f,
-0x8900,
-0x1c3a,
-0x3002,
-0x1133,
-0x80,
-0x1c3b,
-0x3002,
-0x40c3,
-0x8000,
-0x7c8,
-0x8827,
-0x88a0,
-0xc16e,
-0x8829,
-0x1c39,
-0x3042,
-0x8828,
-0x1c36,
-0x3042,
-0x882a,
-0x710c,
-0x1c37,
-0x3042,
-0xe46,
-0x20,
-0xc193,
-0x702c,
-0xc146,
-0xf005,
-0x7a34,
-0x700c,
-0xb200,
-0x7124,
-0x9fb,
-0x82b4,
-0xc298,
-0xd90c,
-0x2905,
-0x341,
-0x740c,
-0x7835,
-0xc049,
-0x40d,
-0x20,
-0x700c,
-0x3ff,
-0x20,
-0x706f,
-0xc005,
-0x712c,
-0x2044,
-0x7c2,
-0x4020,
-0xc105,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781b,
-0xc047,
-0x202f,
-0x6c7,
-0xdca,
-0x20,
-0x792f,
-0x46cb,
-0x8000,
-0x6e0,
-0xc048,
-0x8e00,
-0x7014,
-0xf2f6,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0xb8e3,
-0xf4f0,
-0xab6,
-0xff4f,
-0x70ed,
-0x700c,
-0xf07e,
-0xc004,
-0x2079,
-0x80,
-0x7704,
-0xc04a,
-0xc004,
-0xb882,
-0x815,
-0x131,
-0xd9ff,
-0x40c3,
-0x0,
-0xa00,
-0xea2,
-0xfecf,
-0xec2,
-0x180,
-0x8e01,
-0x71ad,
-0x702c,
-0xc043,
-0xc007,
-0x704c,
-0x726c,
-0x780f,
-0xc04b,
-0xc042,
-0xc00a,
-0xc541,
-0x780f,
-0xc04c,
-0x781d,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x180,
-0xc040,
-0xf4a,
-0xfeef,
-0xd8ff,
-0x8e01,
-0xc742,
-0xc541,
-0xc043,
-0xc004,
-0x702c,
-0x704c,
-0x726c,
-0x2032,
-0xf80,
-0x8000,
-0x448,
-0xb8c5,
-0xc040,
-0xf26,
-0xfeef,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc00b,
-0x726c,
-0xc541,
-0xc042,
-0xc00c,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x580,
-0xc040,
-0xf02,
-0xfeef,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc00a,
-0x726c,
-0xc742,
-0xb8c5,
-0xc040,
-0xd8ff,
-0xeea,
-0xfeef,
-0xc541,
-0x40c3,
-0x0,
-0x2710,
-0xd06,
-0x60,
-0xd90a,
-0x781d,
-0x781d,
-0x7704,
-0x7d0f,
-0xf8dd,
-0xc742,
-0xc741,
-0xc740,
-0xec6,
-0xfeef,
-0xc543,
-0xf8da,
-0xc543,
-0xc742,
-0xc741,
-0xeba,
-0xfeef,
-0xc740,
-0xc004,
-0xb863,
-0x811,
-0x95,
-0xd9e,
-0x180,
-0x700c,
-0xe66,
-0xfeef,
-0x712c,
-0xc004,
-0x7104,
-0xc044,
-0xc004,
-0x7514,
-0x702,
-0xffe5,
-0xd9ff,
-0x40c3,
-0x0,
-0xa00,
-0xdb2,
-0xfecf,
-0xdd2,
-0x180,
-0x8e01,
-0x702c,
-0x71ed,
-0xc043,
-0xd8ff,
-0x704c,
-0xdb18,
-0x4528,
-0xc142,
-0xc741,
-0xe6e,
-0xfeef,
-0xc140,
-0x8b2,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc007,
-0x726c,
-0xc741,
-0x780f,
-0xc044,
-0xc042,
-0xd820,
-0xc040,
-0xe4a,
-0xfeef,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc741,
-0xe32,
-0xfeef,
-0x1c00,
-0x30c1,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc004,
-0x726c,
-0xc741,
-0xc042,
-0xd8ff,
-0xe1a,
-0xfeef,
-0x1c00,
-0x3481,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc741,
-0xe02,
-0xfeef,
-0xc540,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb08,
-0xc542,
-0xc741,
-0xdea,
-0xfeef,
-0xc540,
-0x816,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb18,
-0xc542,
-0xc741,
-0xdce,
-0xfeef,
-0xc540,
-0xcbe,
-0x180,
-0xf07f,
-0x700c,
-0xcea,
-0xfeef,
-0xd9ff,
-0xc007,
-0x70ad,
-0x734c,
-0x205a,
-0x101,
-0xdb22,
-0xc543,
-0xc540,
-0x7825,
-0x7e0f,
-0xd820,
-0xc041,
-0xd8ff,
-0x702c,
-0xfae,
-0xfeef,
-0xc642,
-0xd828,
-0xc041,
-0xf88c,
-0xc543,
-0xc642,
-0xf9e,
-0xfeef,
-0xc540,
-0xf889,
-0xc543,
-0xc642,
-0x1c04,
-0x33c1,
-0xf8e,
-0xfeef,
-0xc040,
-0xf885,
-0xc543,
-0xc642,
-0x1c04,
-0x3501,
-0xf7e,
-0xfeef,
-0xc540,
-0xd8ff,
-0xd980,
-0x734c,
-0xdb22,
-0xc543,
-0xc642,
-0x1c04,
-0x3081,
-0xf6a,
-0xfeef,
-0xc540,
-0x700c,
-0xd12,
-0xfeef,
-0x712c,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xdae0,
-0x201a,
-0xf81,
-0x20,
-0x0,
-0x40c3,
-0x9008,
-0x100,
-0x2105,
-0x3,
-0x7204,
-0x7825,
-0xb340,
-0x1800,
-0x485,
-0x700c,
-0xc4a,
-0xfeef,
-0xd9ff,
-0xf6a,
-0xfeef,
-0xd8ff,
-0xc007,
-0x702c,
-0xb990,
-0x780f,
-0xc042,
-0xd8ff,
-0x714c,
-0x746c,
-0xc543,
-0xc541,
-0xd02,
-0xfeef,
-0xc540,
-0xd90c,
-0xd8ff,
-0xb98d,
-0x734c,
-0x746c,
-0xc543,
-0xc642,
-0xc541,
-0xcee,
-0xfeef,
-0xc540,
-0xf16,
-0xfeef,
-0xd8ff,
-0xd8ff,
-0xd980,
-0x754c,
-0x746c,
-0xc543,
-0xc542,
-0xc541,
-0xcd2,
-0xfeef,
-0xc540,
-0xd850,
-0xc049,
-0x218a,
-0xfc7,
-0x40c3,
-0x9003,
-0xe048,
-0xb020,
-0x1804,
-0x5,
-0x2440,
-0x3e80,
-0x2032,
-0x6c1,
-0xc007,
-0x782b,
-0xf264,
-0xc009,
-0x702c,
-0xc66,
-0xfeef,
-0x7810,
-0x700c,
-0xaa6,
-0x60,
-0xd91e,
-0x2440,
-0x3d80,
-0x2032,
-0x6cb,
-0xc08e,
-0x2032,
-0x6cd,
-0x41a1,
-0xf00f,
-0x211a,
-0xf80,
-0x0,
-0x2000,
-0x7a34,
-0x7124,
-0x2005,
-0xf80,
-0x9002,
-0x54,
-0x9000,
-0x780f,
-0xb200,
-0xbe9,
-0x9065,
-0xc28f,
-0x702c,
-0x704c,
-0xf034,
-0x23f4,
-0x34c,
-0xc008,
-0x7bb4,
-0xbc80,
-0xb380,
-0xe886,
-0xc08f,
-0x20f4,
-0x340,
-0xe80f,
-0x235a,
-0x340e,
-0xc005,
-0x7e16,
-0x6638,
-0x2000,
-0xf80,
-0x8000,
-0x7a8,
-0xa8a0,
-0x7124,
-0xc008,
-0xe817,
-0x235a,
-0x340e,
-0xc005,
-0x7e16,
-0x6658,
-0x2000,
-0xf80,
-0x8000,
-0x788,
-0xa8a0,
-0x7144,
-0xc008,
-0xe88f,
-0xc005,
-0x2079,
-0x0,
-0x781b,
-0x781b,
-0x7404,
-0x7c05,
-0xb380,
-0xf005,
-0xc08f,
-0x20f4,
-0x340,
-0xe867,
-0x71a5,
-0xb9b,
-0x9365,
-0xc398,
-0x40c3,
-0x0,
-0x9c4,
-0xb96,
-0xfecf,
-0xb06,
-0xfecf,
-0x7167,
-0x7277,
-0x408,
-0xffc5,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0x7114,
-0x3f6,
-0xffce,
-0xf01a,
-0xc006,
-0x21f4,
-0x1,
-0xe913,
-0x1600,
-0x7080,
-0x8000,
-0x19,
-0xe88d,
-0xc006,
-0x2144,
-0x301,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x154,
-0xb020,
-0xc006,
-0x7104,
-0xc046,
-0xc006,
-0x8d1,
-0x82b4,
-0xc198,
-0x40c3,
-0x8000,
-0x6e0,
-0x8800,
-0xe808,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0xb8e3,
-0x89c,
-0xff41,
-0x700c,
-0x1e00,
-0x7005,
-0x9003,
-0xe048,
-0x9ae,
-0x20,
-0xc193,
-0xc0bd,
-0x1404,
-0x341b,
-0xc6c6,
-0xd8ff,
-0x702c,
-0x734c,
-0xdb22,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x726c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a3,
-0x4648,
-0x4338,
-0x4708,
-0x700c,
-0xf031,
-0x235f,
-0x3401,
-0xc000,
-0x7956,
-0x6038,
-0x2032,
-0xf81,
-0x8000,
-0x7a8,
-0x40c1,
-0xafe,
-0x1a0,
-0x4328,
-0x4508,
-0x231a,
-0x1f80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x50,
-0xc042,
-0x254f,
-0x1280,
-0xc041,
-0xc101,
-0xc002,
-0xb020,
-0x40c3,
-0x0,
-0xbb8,
-0x906,
-0x60,
-0x702c,
-0x700c,
-0xf007,
-0xc102,
-0x7104,
-0xb140,
-0xc201,
-0xb140,
-0x8f9,
-0x80b4,
-0x254f,
-0x1242,
-0xc000,
-0x7104,
-0x2779,
-0x1042,
-0xc040,
-0x2214,
-0x6c0,
-0x2032,
-0xf81,
-0x8000,
-0x784,
-0xc000,
-0x88f,
-0x8044,
-0xc0a3,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4728,
-0x4608,
-0x4020,
-0x732c,
-0xc341,
-0xdbe,
-0x160,
-0x4358,
-0x710c,
-0x4508,
-0x2644,
-0x17c0,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x7dbb,
-0xb15,
-0x3031,
-0x255a,
-0x110d,
-0x40e1,
-0x732c,
-0xd36,
-0xfeef,
-0xdabf,
-0xc001,
-0x250f,
-0x139b,
-0xe887,
-0x40e1,
-0x732c,
-0xd22,
-0xfeef,
-0xda7f,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x265f,
-0x164d,
-0x704c,
-0x205f,
-0xc80,
-0x238a,
-0xdff,
-0x1c00,
-0x3fc1,
-0x60f8,
-0x60b9,
-0xfb6,
-0x1e0,
-0x202f,
-0x6c7,
-0x862,
-0xff8f,
-0x86a,
-0xffaf,
-0x4300,
-0x4100,
-0xdb6,
-0x160,
-0x4060,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x205f,
-0xc80,
-0x60f8,
-0x60b8,
-0x1003,
-0xc1,
-0x783d,
-0x781d,
-0x781d,
-0x781d,
-0x2044,
-0x100,
-0x7034,
-0x20c5,
-0x4ab,
-0x1e00,
-0x7004,
-0x900e,
-0x22,
-0x40e1,
-0x91a,
-0x160,
-0x732c,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0x7a1b,
-0x1600,
-0x7080,
-0x8000,
-0x1c,
-0xbac4,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781d,
-0x780f,
-0x2144,
-0x7c2,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781d,
-0x7fe0,
-0xb8c0,
-0x78e0,
-0xc0e2,
-0x1600,
-0x7082,
-0x8000,
-0x4,
-0x7014,
-0x221a,
-0xf83,
-0x20,
-0x0,
-0x2305,
-0xf82,
-0x9002,
-0x86,
-0x9240,
-0x2305,
-0xf83,
-0x9003,
-0xfe86,
-0x22c4,
-0xf81,
-0x0,
-0xbfff,
-0xf203,
-0xba8e,
-0x70ad,
-0xb340,
-0xf01d,
-0x251a,
-0x1f82,
-0x0,
-0x1000,
-0x2205,
-0xf82,
-0x1,
-0x4a,
-0x7a5b,
-0x2205,
-0xf83,
-0x9000,
-0x0,
-0xe80b,
-0x9340,
-0x2114,
-0x34c,
-0xb440,
-0x2204,
-0xf82,
-0x0,
-0xfbff,
-0xf003,
-0x21f4,
-0x342,
-0xb340,
-0x71a5,
-0xdcd,
-0x9294,
-0xc4c2,
-0xc2e6,
-0x706c,
-0x41c3,
-0x8000,
-0x7cf,
-0xdd24,
-0xa960,
-0xbd9f,
-0x8d00,
-0xe007,
-0x7a1d,
-0x7a5d,
-0x7a5d,
-0x6a09,
-0xa901,
-0x1534,
-0x108c,
-0xec0e,
-0xca02,
-0x7a1d,
-0xa942,
-0x1533,
-0x1080,
-0xe007,
-0x781d,
-0x781d,
-0x781d,
-0x6058,
-0x7704,
-0xf003,
-0xa942,
-0xa903,
-0xf01e,
-0xee05,
-0x1533,
-0x108f,
-0xf002,
-0x8de0,
-0x78cf,
-0xf16,
-0xffef,
-0x796f,
-0xe804,
-0x6f07,
-0x791d,
-0xf005,
-0x4f1f,
-0x791d,
-0x793d,
-0x793d,
-0x2314,
-0x380,
-0x793d,
-0x2000,
-0xf80,
-0x8000,
-0x784,
-0xa820,
-0x71c5,
-0xecf,
-0x9094,
-0x7164,
-0xbfb,
-0x80b4,
-0x70cd,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x4608,
-0x710c,
-0x4338,
-0x4100,
-0x2644,
-0x17c0,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x793b,
-0x40c3,
-0x8000,
-0x7c9,
-0x8800,
-0x817,
-0x70,
-0x4748,
-0x73ad,
-0xe88f,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0x71ad,
-0xf006,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0x72ad,
-0x790b,
-0x700c,
-0xf212,
-0xc42,
-0xfecf,
-0x8c6,
-0xff2f,
-0x40a1,
-0xb5a,
-0xfecf,
-0x40c3,
-0x8000,
-0x7d8,
-0x8020,
-0x40c1,
-0x4263,
-0xdb6,
-0xffef,
-0x43e1,
-0x710c,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x4833,
-0x4910,
-0x6058,
-0x2348,
-0x3,
-0x2048,
-0x0,
-0x7b6e,
-0x780e,
-0x2309,
-0x0,
-0x7fe0,
-0x780f,
-0x78e0,
-0xc0f1,
-0x956,
-0x40,
-0xc0d1,
-0x7fe0,
-0x700c,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x40c3,
-0x9008,
-0x1e8,
-0x9020,
-0x2059,
-0xf40,
-0x7724,
-0x7930,
-0x793b,
-0x2155,
-0xc0d,
-0x2105,
-0xe,
-0x7d05,
-0x1600,
-0x111b,
-0x95e0,
-0x83a,
-0x20,
-0xd896,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x6822,
-0x7104,
-0xb8e0,
-0x21ca,
-0x1,
-0x782f,
-0x41c3,
-0x0,
-0xff00,
-0x2304,
-0x305b,
-0x2005,
-0x6c0,
-0x79e4,
-0xb600,
-0x2145,
-0x3c0,
-0xb500,
-0x1404,
-0x341b,
-0xc6c6,
-0x1600,
-0x7101,
-0x8000,
-0x6,
-0x790c,
-0x2985,
-0x41f,
-0x7fe0,
-0x6901,
-0x78e0,
-0x2042,
-0x701,
-0x939,
-0x454,
-0x889,
-0xc30,
-0xd91a,
-0x885,
-0xd70,
-0xd90f,
-0x87d,
-0xf30,
-0xd918,
-0xe0c5,
-0xf227,
-0xe0d0,
-0xf227,
-0xe0e0,
-0xf227,
-0xe0f8,
-0xf227,
-0x208c,
-0x8c03,
-0x722c,
-0xf230,
-0x208c,
-0x8802,
-0xf419,
-0x732c,
-0xf02c,
-0x2025,
-0x40,
-0xf011,
-0xf013,
-0xf01b,
-0xf011,
-0xf01b,
-0xf00f,
-0xf01b,
-0xf00d,
-0xf00b,
-0xf01b,
-0xf009,
-0xf009,
-0xf019,
-0xf007,
-0xf005,
-0xf005,
-0xf017,
-0xd93f,
-0xf016,
-0x702c,
-0xf014,
-0xd90b,
-0xf012,
-0xd90a,
-0xf010,
-0xd907,
-0xf00e,
-0xd908,
-0xf00c,
-0xd93e,
-0xf00a,
-0xd93b,
-0xf008,
-0xd93a,
-0xf006,
-0xd91f,
-0xf004,
-0xd938,
-0xf002,
-0xd91b,
-0x7fe0,
-0x4020,
-0x264a,
-0x3000,
-0xf010,
-0x265a,
-0x3c83,
-0x607c,
-0x235a,
-0x1643,
-0x7165,
-0x639b,
-0x633b,
-0x8b80,
-0x7c45,
-0xab80,
-0xbeb,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3a0d,
-0xe76,
-0xff6f,
-0xc083,
-0xc083,
-0xd90d,
-0xfc2,
-0xffef,
-0xdac8,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0x899,
-0x1e,
-0x40c3,
-0x8000,
-0x7c9,
-0x880e,
-0x88d,
-0x30,
-0xdb4b,
-0x40c3,
-0x8000,
-0x7c9,
-0x888d,
-0x40c3,
-0x8000,
-0x7c9,
-0x88ac,
-0x40c3,
-0x8000,
-0x7c9,
-0x88cb,
-0x40c3,
-0x8000,
-0x7c9,
-0x882a,
-0xbb9f,
-0x1b01,
-0x52,
-0x40c3,
-0x8000,
-0x7c9,
-0x88eb,
-0x40c3,
-0x8000,
-0x7c9,
-0xabe0,
-0x884c,
-0x279a,
-0x1004,
-0x1b32,
-0x82,
-0xc166,
-0x1c31,
-0x3382,
-0x1c4a,
-0x3342,
-0x1c63,
-0x3302,
-0x13b8,
-0x8080,
-0x7f25,
-0x41c3,
-0x8000,
-0x7c9,
-0x205f,
-0x18d,
-0x46cb,
-0x12,
-0x310,
-0x892d,
-0x44cb,
-0x9000,
-0x0,
-0x65d8,
-0x7885,
-0xb0e0,
-0x1b33,
-0x42,
-0x219a,
-0x4,
-0x6e02,
-0x60b8,
-0x7885,
-0x7945,
-0xb020,
-0xd8ff,
-0xc040,
-0xc083,
-0x712c,
-0x42c3,
-0x40,
-0x5800,
-0xf82,
-0x1e0,
-0x706c,
-0xc4e,
-0x0,
-0x9ea,
-0xfecf,
-0xc96,
-0x40,
-0x700c,
-0x1e00,
-0x7004,
-0x9004,
-0xdc,
-0x1600,
-0x7080,
-0x8000,
-0x19,
-0x7014,
-0x2f6,
-0x22,
-0x700c,
-0x2e3,
-0x0,
-0xe90b,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0x7034,
-0x712c,
-0xf40b,
-0x2cd,
-0x0,
-0x1600,
-0x7081,
-0x8000,
-0x25,
-0x7034,
-0x2bc,
-0x21,
-0x702c,
-0x7104,
-0xe26,
-0xfeef,
-0x780f,
-0x216f,
-0xc3,
-0x1100,
-0xc0,
-0x89c3,
-0x702c,
-0xc041,
-0x2400,
-0x3f80,
-0x0,
-0x2c8,
-0xece,
-0x20,
-0xdaa0,
-0x2400,
-0x3f80,
-0x0,
-0x228,
-0xec2,
-0x20,
-0xdaa0,
-0x2456,
-0x3c40,
-0xeb6,
-0x20,
-0xdaa0,
-0x2455,
-0x3e80,
-0xeae,
-0x20,
-0xdaa0,
-0x261a,
-0x1f8e,
-0x10,
-0x0,
-0x4338,
-0xf064,
-0x702c,
-0xe9a,
-0x20,
-0xda28,
-0x2455,
-0x3980,
-0xe8e,
-0x20,
-0xda28,
-0xc09c,
-0xe86,
-0x20,
-0xda28,
-0x2355,
-0x3800,
-0x78c5,
-0x2455,
-0x3c01,
-0xa8a,
-0x120,
-0x724c,
-0x2355,
-0x38c0,
-0x78c5,
-0xa7e,
-0x120,
-0x2455,
-0x3981,
-0x2355,
-0x3d00,
-0x78c5,
-0xa72,
-0x120,
-0xc19c,
-0x40c3,
-0x8000,
-0x7c9,
-0x1003,
-0x8b,
-0x40c3,
-0x8000,
-0x7c9,
-0x8862,
-0xf035,
-0x2455,
-0x3c00,
-0x20f4,
-0xde,
-0x94e,
-0xfeef,
-0x200a,
-0x780,
-0x4708,
-0x2455,
-0x3980,
-0x20f4,
-0xcd,
-0xc09c,
-0x20f4,
-0xc0,
-0xbdc5,
-0x936,
-0xfeef,
-0x65fd,
-0x235a,
-0x3a02,
-0x2400,
-0x3f81,
-0x0,
-0x2c8,
-0x6159,
-0x7974,
-0xb1a0,
-0x2400,
-0x3f81,
-0x0,
-0x228,
-0x615c,
-0x212f,
-0x782,
-0x7c74,
-0x216c,
-0x101,
-0xb420,
-0x2456,
-0x3c41,
-0x6159,
-0x7974,
-0xb1e0,
-0x2455,
-0x3e81,
-0x6159,
-0x7974,
-0xb100,
-0x7164,
-0xb9d,
-0x90c5,
-0x7167,
-0xb3d,
-0xb134,
-0x2455,
-0x3c00,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0xd930,
-0xb99f,
-0x2140,
-0xcce,
-0x7014,
-0x2642,
-0x1283,
-0x2142,
-0x280,
-0x23ca,
-0x1,
-0x710c,
-0x26ca,
-0x1041,
-0x4308,
-0xc042,
-0xf059,
-0xdab,
-0x12e0,
-0x704c,
-0x40c3,
-0x8000,
-0x7c9,
-0x1003,
-0x9f,
-0x40c3,
-0x8000,
-0x7c9,
-0x8882,
-0xba8f,
-0x4358,
-0xf02e,
-0x255a,
-0x1a0f,
-0xc101,
-0x923,
-0x32,
-0x235a,
-0x1a00,
-0x2400,
-0x3f81,
-0x0,
-0x228,
-0x61f9,
-0x21f4,
-0x302,
-0x2400,
-0x3f81,
-0x0,
-0x2c8,
-0xf006,
-0x2456,
-0x3c41,
-0x61fa,
-0x22f4,
-0x302,
-0x6119,
-0x21f4,
-0x301,
-0x7942,
-0x2608,
-0x3042,
-0x2455,
-0x3e81,
-0x673f,
-0x6038,
-0x27f4,
-0x130f,
-0x20f4,
-0x300,
-0x212f,
-0x6c6,
-0x7185,
-0x78e2,
-0x2108,
-0x1b,
-0xfa9,
-0xb325,
-0x262f,
-0x3086,
-0xc001,
-0x811,
-0x32,
-0x200a,
-0x780,
-0xf9e,
-0xfe8f,
-0xf006,
-0xf1e,
-0xfeaf,
-0x200a,
-0x780,
-0x4100,
-0xf16,
-0xfeaf,
-0x202f,
-0x6c6,
-0x1b01,
-0x52,
-0x1e01,
-0x1012,
-0x77a5,
-0xd57,
-0x9013,
-0x7765,
-0xbfd,
-0x9033,
-0x71ad,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0xd92c,
-0xb99f,
-0x2140,
-0xccb,
-0x7014,
-0x2342,
-0x1100,
-0xc041,
-0x23ca,
-0x1041,
-0x690c,
-0xc101,
-0x21ca,
-0x1,
-0xc141,
-0xf042,
-0x40c3,
-0x8000,
-0x7c9,
-0x1003,
-0x9e,
-0x40c3,
-0x8000,
-0x7c9,
-0x8842,
-0x700c,
-0xb88f,
-0x4100,
-0xf01e,
-0xc602,
-0x235a,
-0x3a0c,
-0x2456,
-0x3c4d,
-0x265a,
-0x1a0e,
-0x2455,
-0x3e8f,
-0x6599,
-0x21f4,
-0x9f,
-0x67d9,
-0x21f4,
-0x81,
-0x64fc,
-0x65dd,
-0x2102,
-0x7c1,
-0x2308,
-0x41,
-0x24f4,
-0x108c,
-0x25f4,
-0x1083,
-0x7144,
-0x7b82,
-0x2008,
-0xc0,
-0x780e,
-0xec7,
-0xb0a5,
-0x7b2e,
-0xe72,
-0xfe8f,
-0x4200,
-0xe6e,
-0xfeaf,
-0x4060,
-0xc101,
-0x7767,
-0x1901,
-0x92,
-0xc141,
-0x1b01,
-0x1012,
-0xb8d,
-0xb013,
-0xc002,
-0x7704,
-0xc042,
-0xc002,
-0x8f7,
-0x8033,
-0x716f,
-0x1600,
-0x7081,
-0x8000,
-0x7c9,
-0x6901,
-0x790f,
-0x7134,
-0x1e00,
-0x7002,
-0x8000,
-0x7c9,
-0x51a,
-0xffce,
-0xb62,
-0xfeef,
-0x730c,
-0x41c3,
-0x8000,
-0x7c9,
-0x700c,
-0xa901,
-0x1e00,
-0x7002,
-0x8000,
-0x7c9,
-0x1600,
-0x7080,
-0x8000,
-0x19,
-0x7014,
-0x85c,
-0x141,
-0x40c3,
-0x9003,
-0xe174,
-0x702c,
-0xb020,
-0xe82,
-0xfeef,
-0xb021,
-0x2480,
-0x3a0d,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e4,
-0xc1a4,
-0x4608,
-0x700c,
-0x9fe,
-0xfeaf,
-0xd9ff,
-0x1200,
-0x3083,
-0x702c,
-0xd8ff,
-0x754c,
-0x4528,
-0xc143,
-0xc142,
-0xc141,
-0xabe,
-0xfeaf,
-0xc140,
-0xbec1,
-0xd8ff,
-0xd980,
-0x764c,
-0xdb20,
-0xc543,
-0xc642,
-0xc541,
-0xaaa,
-0xfeaf,
-0x1c00,
-0x3041,
-0x700c,
-0xa5e,
-0xfeaf,
-0x712c,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0xc2e4,
-0xc1a4,
-0xd858,
-0xb89f,
-0x88c0,
-0x10cd,
-0x808d,
-0x700c,
-0x9aa,
-0xfeaf,
-0xd9ff,
-0x2605,
-0x1341,
-0x700c,
-0xb9c1,
-0xc043,
-0xc142,
-0xc041,
-0xc040,
-0xd8ff,
-0xd980,
-0xda09,
-0xa66,
-0xfeaf,
-0xdb20,
-0x700c,
-0xa1e,
-0xfeaf,
-0x712c,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0x21aa,
-0xc4,
-0x911,
-0x3f,
-0x722c,
-0x21ab,
-0xc4,
-0x712c,
-0x21ab,
-0xc4,
-0x80f,
-0x415,
-0x1600,
-0x7100,
-0x9008,
-0x1d6,
-0x7ee0,
-0x21aa,
-0x104,
-0x7b32,
-0xb19,
-0x25,
-0x24aa,
-0x1144,
-0x22aa,
-0x104,
-0x9fd,
-0x8084,
-0x7862,
-0x24aa,
-0x1144,
-0xf003,
-0x6038,
-0x21aa,
-0x104,
-0x7110,
-0x20e1,
-0x7c6,
-0x22aa,
-0x144,
-0xcf3,
-0x9080,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0x866,
-0x0,
-0xfa6,
-0xffcf,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0xf5a,
-0xffcf,
-0xf96,
-0xffef,
-0xd814,
-0xc0d1,
-0x7ee0,
-0xc0f1,
-0x846,
-0x0,
-0x41c3,
-0x8000,
-0x6e0,
-0x8920,
-0x781b,
-0xe915,
-0x1600,
-0x7081,
-0x8000,
-0x1,
-0x923,
-0xdf,
-0x41c3,
-0x8000,
-0x7c8,
-0x8920,
-0x917,
-0x134,
-0x216c,
-0x41,
-0x2809,
-0x8042,
-0xf208,
-0x6038,
-0x7842,
-0xf004,
-0x809,
-0x115,
-0x740c,
-0xc0d1,
-0x7ee0,
-0x246f,
-0x1343,
-0x9460,
-0x231a,
-0x2,
-0x2a05,
-0xf82,
-0x1e,
-0x8480,
-0x817,
-0xf84,
-0x3,
-0xd41,
-0x2885,
-0xa0f,
-0x201a,
-0xc2,
-0x2a85,
-0x41f,
-0x793d,
-0x6a01,
-0x6941,
-0x41c3,
-0x8000,
-0x6e0,
-0x8920,
-0xe90c,
-0x14fb,
-0x9081,
-0x915,
-0xdf,
-0x41c3,
-0x8000,
-0x7c8,
-0x8920,
-0x7034,
-0x22da,
-0x42,
-0x7210,
-0x7fe0,
-0x20ca,
-0x8d,
-0xc2e6,
-0xece,
-0xff2f,
-0xc1a4,
-0x781d,
-0x781d,
-0x781d,
-0x791d,
-0xb9c3,
-0xdd58,
-0x1a02,
-0x3042,
-0xbd9f,
-0x8d00,
-0xe80b,
-0x215f,
-0x100,
-0x1600,
-0x7082,
-0x8000,
-0x57,
-0x2044,
-0xe00,
-0x621e,
-0xf005,
-0x1600,
-0x708e,
-0x8000,
-0x24,
-0xe96,
-0xff0f,
-0x79cf,
-0x7b3d,
-0x7a3d,
-0x2653,
-0x907e,
-0x7b7d,
-0x7a5d,
-0x23c0,
-0x62,
-0x7a5d,
-0x2653,
-0x9081,
-0xb8c3,
-0x22c0,
-0x62,
-0x1a03,
-0x3002,
-0x1a05,
-0x30c2,
-0x1a07,
-0x3042,
-0x1a04,
-0x3082,
-0xc040,
-0x41c3,
-0x53,
-0x3,
-0xcb6,
-0xfeaf,
-0xd80a,
-0x276f,
-0x10c3,
-0x8f00,
-0xb8e2,
-0x700c,
-0x20ca,
-0xe1,
-0x1a08,
-0x3002,
-0x1724,
-0x1082,
-0x170f,
-0x1481,
-0x2742,
-0x1280,
-0x9000,
-0x8d60,
-0x97c0,
-0x8f82,
-0xc043,
-0xc142,
-0xd80a,
-0x41c3,
-0x55,
-0x6,
-0xc441,
-0xc7e,
-0xfeaf,
-0xc640,
-0x8f08,
-0xe808,
-0x41c3,
-0x5a,
-0x0,
-0xc6e,
-0xfeaf,
-0xd80a,
-0xde32,
-0xbe9f,
-0x1601,
-0x1483,
-0x16d1,
-0x9082,
-0x1601,
-0x148c,
-0x1602,
-0x1481,
-0x1601,
-0x1480,
-0xc440,
-0xc141,
-0xc042,
-0x41c3,
-0x5b,
-0x5,
-0xc42,
-0xfeaf,
-0xd80a,
-0x1601,
-0x1483,
-0x8e21,
-0x8e04,
-0x16cc,
-0x9082,
-0x8e80,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0x5c,
-0x5,
-0xc22,
-0xfeaf,
-0xc440,
-0x8f08,
-0x8b5,
-0x11,
-0x8f15,
-0x831,
-0x7e,
-0xdf3e,
-0xf840,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0x5d,
-0x5,
-0xc02,
-0xfeaf,
-0xc440,
-0xf841,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0x5e,
-0x5,
-0xbee,
-0xfeaf,
-0xc440,
-0x8d00,
-0x833,
-0x3e,
-0xdf65,
-0xf834,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0x5f,
-0x5,
-0xbd2,
-0xfeaf,
-0xc440,
-0xf835,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0x60,
-0x5,
-0xbbe,
-0xfeaf,
-0xc440,
-0x8d00,
-0x851,
-0x7e,
-0xdd71,
-0xbd9f,
-0x1501,
-0x1483,
-0x1501,
-0x148c,
-0x1502,
-0x1481,
-0x1501,
-0x1480,
-0x16cc,
-0x9082,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0x61,
-0x5,
-0xb8e,
-0xfeaf,
-0xc440,
-0x1501,
-0x1483,
-0x8d21,
-0x8d04,
-0x16cc,
-0x9082,
-0x8d80,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0x62,
-0x5,
-0xb6e,
-0xfeaf,
-0xc440,
-0x40c3,
-0x9008,
-0x1a0,
-0x1802,
-0x15,
-0x218a,
-0x44,
-0x1802,
-0x54,
-0x218a,
-0x144,
-0x1802,
-0x54,
-0x218a,
-0x1c4,
-0x1804,
-0x54,
-0x218a,
-0x88,
-0xb020,
-0x218a,
-0x288,
-0xb021,
-0x218a,
-0x2c8,
-0xb022,
-0x208a,
-0x3cc,
-0x1e00,
-0x7004,
-0x9009,
-0xe180,
-0xd934,
-0x40c3,
-0x9005,
-0xe0ee,
-0xb020,
-0xd4e,
-0xffef,
-0x18fc,
-0x8105,
-0xc0a4,
-0xc6c6,
-0x78e0,
-0xbf9f,
-0x1701,
-0x1483,
-0x1701,
-0x148c,
-0x1702,
-0x1481,
-0x1701,
-0x1480,
-0x16cc,
-0x9082,
-0x7ee0,
-0x1701,
-0x1483,
-0x8f21,
-0x8f04,
-0x16cc,
-0x9082,
-0x8f80,
-0x7ee0,
-0x621a,
-0xf004,
-0x1801,
-0x52,
-0x8fd,
-0x8084,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a7,
-0xda07,
-0xba8c,
-0x40c3,
-0x0,
-0x9f38,
-0x45cb,
-0x9012,
-0x328,
-0x1e00,
-0x7084,
-0x8000,
-0x2,
-0xb500,
-0xd858,
-0xb501,
-0x41c3,
-0xb8,
-0x1,
-0xaaa,
-0xfeaf,
-0xd80a,
-0xcc20,
-0x9520,
-0x7030,
-0x700c,
-0xf406,
-0xcc21,
-0x9521,
-0x2038,
-0x40,
-0x41c3,
-0xb9,
-0x0,
-0xd22,
-0xfe0f,
-0x1e00,
-0x7043,
-0x8000,
-0x6e0,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x1a00,
-0x3103,
-0x216f,
-0x243,
-0xc042,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x9126,
-0xc041,
-0x2005,
-0xf80,
-0x9004,
-0x32,
-0xc140,
-0x9000,
-0xc043,
-0xc001,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0x9000,
-0xa46,
-0x120,
-0xc046,
-0xc000,
-0xb8e0,
-0x264,
-0x1,
-0xc001,
-0xc103,
-0x2005,
-0xf80,
-0x9005,
-0xe032,
-0xb980,
-0xb020,
-0xc001,
-0x2005,
-0xf80,
-0x9003,
-0xe090,
-0xca2,
-0x20,
-0x1800,
-0x5,
-0x256f,
-0x1cc3,
-0x8d00,
-0xe885,
-0x1e00,
-0x7085,
-0x9004,
-0xc0,
-0xce2,
-0xffcf,
-0xf92,
-0xff0f,
-0x8d00,
-0x7014,
-0xf4bb,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0x1600,
-0x708b,
-0x8000,
-0x0,
-0x251a,
-0x1f80,
-0x20,
-0x0,
-0xc045,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x9000,
-0xc044,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0xb8c2,
-0x825,
-0x90,
-0x833,
-0xf1,
-0x238b,
-0x903e,
-0xce08,
-0x46cb,
-0x8000,
-0x41c,
-0x761c,
-0x1a03,
-0x3398,
-0xce0e,
-0x47cb,
-0x8000,
-0x434,
-0xf018,
-0x46cb,
-0x8000,
-0x418,
-0x1a03,
-0x3398,
-0x47cb,
-0x8000,
-0x430,
-0xf00f,
-0x238b,
-0x903e,
-0xce05,
-0x46cb,
-0x8000,
-0x410,
-0x761c,
-0xce0b,
-0x47cb,
-0x8000,
-0x428,
-0x1a03,
-0x3398,
-0x771c,
-0x1a09,
-0x33d8,
-0x1600,
-0x7082,
-0x8000,
-0xc,
-0x238b,
-0x903e,
-0x221a,
-0xf9b,
-0x1,
-0x86a0,
-0xf20b,
-0x233c,
-0x3f80,
-0xa6,
-0x400,
-0x41c3,
-0x141,
-0x1,
-0xbe6,
-0xfe0f,
-0x222f,
-0x6c2,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0xed95,
-0xc004,
-0x2044,
-0x80,
-0x6611,
-0x6710,
-0x4a10,
-0x2048,
-0x0,
-0x2805,
-0x40,
-0x41c3,
-0x9003,
-0xfe80,
-0x780f,
-0x2089,
-0xfc1,
-0xb100,
-0x19e0,
-0x8004,
-0xc002,
-0x201a,
-0xf8d,
-0x10,
-0x0,
-0x2b05,
-0x3f80,
-0x0,
-0xfa00,
-0x7104,
-0x821,
-0x1fe,
-0x746c,
-0x2200,
-0xf80,
-0xffff,
-0x793c,
-0x208c,
-0x8d47,
-0x706c,
-0xf685,
-0x2885,
-0xd07,
-0xf002,
-0x710c,
-0x780f,
-0x2089,
-0xfc1,
-0x205a,
-0x200,
-0xc105,
-0x2105,
-0xf82,
-0x9005,
-0xe164,
-0x2005,
-0xc1,
-0x1600,
-0x7100,
-0x9004,
-0x164,
-0xb8c1,
-0x7825,
-0xb200,
-0xc001,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x952,
-0x120,
-0x90c0,
-0x8e2,
-0x120,
-0x40a1,
-0x1600,
-0x7081,
-0x8000,
-0x1f,
-0xc002,
-0x2111,
-0x8000,
-0xc001,
-0x26cf,
-0x1021,
-0x2005,
-0xf80,
-0x9003,
-0xfe86,
-0xb0c0,
-0xb2a,
-0x0,
-0xb4a,
-0xff8f,
-0x8fe,
-0xfe8f,
-0xc52,
-0xff4f,
-0xca04,
-0x704c,
-0x708d,
-0xf033,
-0x245a,
-0x149e,
-0x2600,
-0x3f83,
-0x8000,
-0x6e0,
-0xb341,
-0xf028,
-0x241a,
-0x1f81,
-0x0,
-0x1000,
-0x79a5,
-0x793b,
-0x2105,
-0xf81,
-0x9002,
-0x140,
-0x9120,
-0x7e2f,
-0xd13,
-0x13a1,
-0xbec4,
-0x8b22,
-0x210f,
-0x341,
-0xab22,
-0xf013,
-0x8b23,
-0x7124,
-0xab23,
-0x792f,
-0x2614,
-0x3041,
-0x2100,
-0xf8f,
-0x8000,
-0x6e0,
-0x712c,
-0xafa3,
-0xee06,
-0xbe61,
-0xe01,
-0x1031,
-0x793b,
-0xaf22,
-0x71a5,
-0xdb3,
-0x9214,
-0x7185,
-0xc9f,
-0x9024,
-0x70ad,
-0xc000,
-0x80b,
-0x33f,
-0x710c,
-0xf007,
-0xbd2,
-0xfe0f,
-0xabe,
-0x20,
-0xd80d,
-0x700c,
-0xfc6,
-0x180,
-0xee2,
-0xfe4f,
-0x1e00,
-0x7003,
-0x8000,
-0x6e0,
-0xaa6,
-0x20,
-0x700c,
-0xca04,
-0x264a,
-0x3000,
-0x706c,
-0xf019,
-0x704c,
-0xf014,
-0x231a,
-0xf81,
-0x0,
-0x1000,
-0x2300,
-0x1f8d,
-0x8000,
-0x7f0,
-0x7165,
-0x7945,
-0x793b,
-0x2105,
-0xf81,
-0x9002,
-0x140,
-0x9180,
-0xad80,
-0xb140,
-0x7144,
-0xadb,
-0x8214,
-0x7164,
-0xbd3,
-0x8024,
-0x2616,
-0x30cb,
-0xbde,
-0xfeaf,
-0x710c,
-0xc000,
-0x813,
-0xbe,
-0x700c,
-0xbaa,
-0x100,
-0xa4a,
-0x20,
-0x720c,
-0xc000,
-0x2044,
-0x808e,
-0xf207,
-0xb9a,
-0x120,
-0x710c,
-0xa36,
-0x20,
-0x710c,
-0xc000,
-0x81b,
-0x21e,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xe887,
-0xb7e,
-0x120,
-0x730c,
-0xa1a,
-0x20,
-0xd80a,
-0xc000,
-0x2044,
-0x820d,
-0xf207,
-0xb6a,
-0x120,
-0x750c,
-0xa06,
-0x20,
-0xd8fd,
-0xee08,
-0xb5a,
-0x120,
-0x720c,
-0x9fa,
-0x20,
-0xd8fe,
-0xc000,
-0x813,
-0x13e,
-0x760c,
-0xb46,
-0x100,
-0x9e6,
-0x20,
-0x740c,
-0xc000,
-0x815,
-0x51,
-0x1600,
-0x7080,
-0x8000,
-0x19,
-0xe884,
-0xb2e,
-0x120,
-0xd80d,
-0xed07,
-0xb26,
-0x120,
-0x740c,
-0x9c2,
-0x20,
-0x730c,
-0xc000,
-0x825,
-0x27f,
-0x71ad,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x2005,
-0xf81,
-0x9003,
-0xe040,
-0xc006,
-0xb100,
-0xf040,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x46cb,
-0x8000,
-0x7c9,
-0xb8e2,
-0x25ca,
-0x13e1,
-0x700c,
-0xae00,
-0x780f,
-0x84f,
-0x95,
-0xe81d,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0x7014,
-0x710c,
-0xf213,
-0xe76,
-0xfe4f,
-0x8e00,
-0x7104,
-0xaf6,
-0xfeaf,
-0x780f,
-0xd8a,
-0xfe4f,
-0xdc2,
-0xfe6f,
-0x1e01,
-0x1003,
-0x4100,
-0xdf6,
-0x120,
-0x40a1,
-0x8e00,
-0x7104,
-0xf1e1,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0x7014,
-0x700c,
-0xf5e7,
-0xf1f7,
-0xac6,
-0xfeaf,
-0x730c,
-0xca09,
-0xe885,
-0x93e,
-0xfeaf,
-0xc002,
-0x922,
-0x20,
-0xd809,
-0xca09,
-0xe837,
-0xd925,
-0xb99f,
-0x8900,
-0x1133,
-0x8f,
-0x70cd,
-0x7f05,
-0xf022,
-0x2644,
-0x17c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0x78eb,
-0xf217,
-0x40c1,
-0xdda,
-0xfe6f,
-0x712c,
-0xc102,
-0x4508,
-0x7bcf,
-0x710c,
-0x42a1,
-0x93a,
-0xfeaf,
-0x4378,
-0xc102,
-0x700c,
-0x42a1,
-0x92e,
-0xfeaf,
-0x4363,
-0x4163,
-0x9da,
-0xfeaf,
-0x40a1,
-0x71c5,
-0xec1,
-0x90b4,
-0x710c,
-0x8da,
-0xfeaf,
-0xc002,
-0x1600,
-0x7080,
-0x8000,
-0x0,
-0xb8e5,
-0x9f8,
-0xfe82,
-0xb02,
-0xff8f,
-0xca04,
-0x706f,
-0x704c,
-0xf017,
-0x706c,
-0xf012,
-0x221a,
-0xf81,
-0x0,
-0x1000,
-0x7965,
-0x793b,
-0x2105,
-0xf8c,
-0x9002,
-0x140,
-0x2332,
-0x1f81,
-0x8000,
-0x7f0,
-0x7164,
-0x7165,
-0xb420,
-0xbdf,
-0x8214,
-0x7144,
-0xad7,
-0x8024,
-0x2316,
-0x308b,
-0xc001,
-0x2005,
-0xf81,
-0x9005,
-0xe032,
-0xc003,
-0xb100,
-0x9de,
-0xfeaf,
-0x700c,
-0xcfa,
-0xc0,
-0x82e,
-0x160,
-0xd807,
-0x23ab,
-0x30c4,
-0x7fff,
-0xf000,
-0xc2e2,
-0x45cb,
-0x9004,
-0x4,
-0x9500,
-0xb8a1,
-0xb500,
-0xf3e,
-0xffaf,
-0x740c,
-0xd81f,
-0xf36,
-0xffaf,
-0x1df6,
-0x105d,
-0xc6c2,
-0xc2e2,
-0xf2a,
-0xffaf,
-0xd81f,
-0x45cb,
-0x9004,
-0x1f0,
-0x740c,
-0xf1a,
-0xffaf,
-0x1d00,
-0x1005,
-0x150a,
-0x9700,
-0xb881,
-0x1d0a,
-0x901c,
-0xc6c2,
-0xc0f1,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x218c,
-0x8203,
-0xfcc,
-0x10e,
-0x80e,
-0x0,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc2e2,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x81b,
-0x3e,
-0xd80a,
-0x45cb,
-0x9005,
-0xe036,
-0xed6,
-0xffaf,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0x40c3,
-0x9004,
-0xf2,
-0x1800,
-0x45,
-0x7fe0,
-0x1800,
-0x5,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3002,
-0x4608,
-0x4060,
-0xdc08,
-0xbc61,
-0xc01,
-0x1031,
-0x781d,
-0x2044,
-0x4d,
-0x40a1,
-0x4378,
-0xc24e,
-0xae2,
-0xff2f,
-0x4728,
-0x2353,
-0x30c0,
-0x42c3,
-0x9003,
-0xe0c4,
-0xb200,
-0x70b5,
-0xd9f0,
-0x208a,
-0xc07,
-0x20ca,
-0x41,
-0x2004,
-0x6c1,
-0xba8b,
-0xb220,
-0xc096,
-0x702c,
-0xda28,
-0x9be,
-0xffef,
-0xc396,
-0x202f,
-0x6c7,
-0x20b8,
-0xfc3,
-0xc06d,
-0x40c3,
-0x0,
-0xf00,
-0xc04b,
-0xd820,
-0xc04a,
-0x14a0,
-0x3000,
-0x714c,
-0xc346,
-0xc04f,
-0xc045,
-0x149c,
-0x3000,
-0x2644,
-0x17c3,
-0x1c30,
-0x36c0,
-0xc050,
-0xc044,
-0xc00e,
-0x4338,
-0xc10e,
-0x1c25,
-0x3002,
-0x4040,
-0xeb06,
-0xbb61,
-0xb01,
-0x31,
-0x781b,
-0x1c24,
-0x3003,
-0x205a,
-0x100,
-0xc748,
-0x1c1c,
-0x3103,
-0xc643,
-0x200f,
-0x380,
-0x780f,
-0x9da,
-0x20,
-0xc054,
-0xc00e,
-0xb863,
-0xc052,
-0x7314,
-0x40c3,
-0x0,
-0xffff,
-0x48,
-0x2d,
-0xc051,
-0x41c3,
-0x9008,
-0x1ea,
-0x9100,
-0x2004,
-0xf82,
-0x0,
-0xc0ff,
-0x2004,
-0xf80,
-0x0,
-0x3f00,
-0x2080,
-0x10,
-0x7845,
-0xb100,
-0x1e00,
-0x76c4,
-0x900f,
-0xe022,
-0x1600,
-0x7100,
-0x9004,
-0xee,
-0x2050,
-0x141,
-0xb885,
-0x1e00,
-0x7044,
-0x9005,
-0xe0ee,
-0xc051,
-0x1498,
-0x3000,
-0xc055,
-0x1494,
-0x3000,
-0xc053,
-0x996,
-0x60,
-0xc083,
-0x46cb,
-0x8000,
-0x7cb,
-0x8e61,
-0x8e20,
-0xf00e,
-0xc210,
-0x7a34,
-0x9200,
-0xe889,
-0xc096,
-0x20f5,
-0x40,
-0x80b,
-0x833,
-0x2042,
-0x800,
-0xb200,
-0x7124,
-0xbe7,
-0x8045,
-0xc00e,
-0x7704,
-0x839,
-0xb5,
-0x70b5,
-0x47cb,
-0x0,
-0xf0f0,
-0x43db,
-0x0,
-0xffff,
-0x43e1,
-0x737f,
-0xd80f,
-0x41e1,
-0x42e1,
-0xe42,
-0xfeef,
-0xc340,
-0x70b5,
-0x23ca,
-0x33c2,
-0xd808,
-0x41e1,
-0x42e1,
-0x4363,
-0xe2e,
-0xfeef,
-0x1c00,
-0x36c0,
-0xb3a,
-0x60,
-0xc083,
-0x8e61,
-0x8e20,
-0xf00f,
-0xc20f,
-0x7a34,
-0x9200,
-0x815,
-0x7f1,
-0xc096,
-0x20f5,
-0x40,
-0x809,
-0x833,
-0xe020,
-0xb200,
-0x7124,
-0xbe9,
-0x8045,
-0xc012,
-0x80b,
-0x114,
-0xc76,
-0xffaf,
-0xc014,
-0xc013,
-0xe807,
-0x41c3,
-0x36,
-0x0,
-0xb2a,
-0xfe6f,
-0x740c,
-0x8ee0,
-0xf035,
-0xc010,
-0x7dfd,
-0x20f5,
-0x3c2,
-0xc00f,
-0x20f5,
-0x3c3,
-0x6358,
-0x781c,
-0x2048,
-0x0,
-0x2049,
-0x7c1,
-0xc015,
-0x78f4,
-0xb020,
-0x4b50,
-0x2048,
-0x0,
-0xc04e,
-0xc013,
-0xe812,
-0xc010,
-0x4363,
-0x20f5,
-0x3c2,
-0xc00f,
-0x20f5,
-0x3c0,
-0xc142,
-0xc240,
-0xc041,
-0x740c,
-0x41c3,
-0x38,
-0x5,
-0xada,
-0xfe6f,
-0x42a1,
-0xc00e,
-0x41c3,
-0x39,
-0x3,
-0x42a1,
-0x780e,
-0xc040,
-0x207f,
-0x140,
-0xd56,
-0xfdef,
-0x4363,
-0x71e5,
-0x8e01,
-0x897,
-0x83e5,
-0x2744,
-0x105b,
-0xc012,
-0x835,
-0x115,
-0x42c3,
-0x9008,
-0x1ea,
-0x9200,
-0x2004,
-0xf81,
-0x0,
-0xc0ff,
-0x2004,
-0xf80,
-0x0,
-0x3f00,
-0x2000,
-0xf80,
-0x0,
-0xfc00,
-0x7825,
-0xb200,
-0xc011,
-0x1e00,
-0x7004,
-0x9005,
-0xe0ee,
-0x1e00,
-0x7005,
-0x9003,
-0xe004,
-0x2480,
-0x3002,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ad,
-0xc248,
-0x4338,
-0xc16,
-0xfeef,
-0xc046,
-0x2342,
-0x30cd,
-0xc047,
-0x97e,
-0xfe6f,
-0x7eaf,
-0xd33,
-0x1134,
-0xc044,
-0x700c,
-0xd82,
-0xfe2f,
-0x702c,
-0x1200,
-0x3083,
-0x700c,
-0xd981,
-0xc043,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xb98e,
-0xe3e,
-0xfe2f,
-0x754c,
-0x700c,
-0xdf6,
-0xfe2f,
-0x712c,
-0x730c,
-0x203c,
-0x381,
-0x2342,
-0x304e,
-0x78cf,
-0x71ed,
-0x273c,
-0x1000,
-0x2004,
-0x8040,
-0xc045,
-0xc004,
-0x27ca,
-0x1222,
-0x7014,
-0x40e1,
-0x20cf,
-0xa2,
-0x74b5,
-0xc26,
-0xfeef,
-0x27ca,
-0x1005,
-0xc2a,
-0xfeef,
-0xc04a,
-0xc04c,
-0x40c3,
-0x0,
-0x2710,
-0xc1a,
-0xffaf,
-0xd908,
-0x41c3,
-0x900f,
-0xe0c0,
-0xc04b,
-0xb1e0,
-0xc005,
-0x47cb,
-0xffff,
-0xf0f0,
-0x7014,
-0x208a,
-0xfc7,
-0x78c0,
-0xb105,
-0xc004,
-0x772c,
-0xc145,
-0x7014,
-0x4020,
-0x70fd,
-0xc045,
-0x773c,
-0xc10a,
-0xc007,
-0x2114,
-0x0,
-0x48e8,
-0xb9c0,
-0x6038,
-0xe2b,
-0x10b5,
-0xc044,
-0x46cb,
-0x0,
-0xf0f0,
-0x7bf0,
-0xd80f,
-0x41c1,
-0x42c1,
-0xc42,
-0xfeef,
-0xc340,
-0xc005,
-0x41c1,
-0x42c1,
-0x7b10,
-0xd808,
-0xc32,
-0xfeef,
-0xc340,
-0xc004,
-0xe030,
-0xc049,
-0x234f,
-0x3040,
-0x899,
-0xb1,
-0x73b5,
-0xc006,
-0xb8c1,
-0xc044,
-0xc007,
-0x790f,
-0xc96,
-0xfe2f,
-0x700c,
-0x702c,
-0x70ad,
-0x716f,
-0xd8ff,
-0xb98e,
-0x754c,
-0x746c,
-0xc543,
-0xc542,
-0x1c04,
-0x36c0,
-0xd52,
-0xfe2f,
-0xc540,
-0xc006,
-0x702c,
-0x704c,
-0x7f0f,
-0xd8ff,
-0x746c,
-0xc543,
-0xc742,
-0xc541,
-0xd3a,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0xd22,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0xdb28,
-0xc543,
-0xd0a,
-0xfe2f,
-0xc540,
-0xf52,
-0xfe2f,
-0xd8ff,
-0xc008,
-0x46cb,
-0x0,
-0x3100,
-0x7014,
-0x22a,
-0x21,
-0xd8ff,
-0x2f3,
-0x20,
-0x1c0c,
-0x3441,
-0x44c,
-0x2d,
-0x7177,
-0x1600,
-0x7080,
-0x8000,
-0x13,
-0x7014,
-0x5d4,
-0x21,
-0x7377,
-0x4608,
-0x269a,
-0x1004,
-0x7e05,
-0xd80f,
-0x41c1,
-0x42c1,
-0x43c1,
-0xb66,
-0xfeef,
-0xc640,
-0xc007,
-0x790f,
-0x700c,
-0xbde,
-0xfe2f,
-0x4338,
-0xc006,
-0x702c,
-0x734c,
-0x7f0f,
-0xd820,
-0xc041,
-0x78cf,
-0xc040,
-0xd8ff,
-0xdb22,
-0x4528,
-0xc143,
-0xc96,
-0xfe2f,
-0xc742,
-0xd828,
-0xc041,
-0xd808,
-0xb861,
-0x801,
-0x31,
-0x7edd,
-0x702c,
-0xd8ff,
-0x734c,
-0xdb22,
-0xc543,
-0xc742,
-0xc76,
-0xfe2f,
-0xc640,
-0xd8ff,
-0x702c,
-0x734c,
-0xdb22,
-0xc543,
-0xc742,
-0x1c04,
-0x33c1,
-0xc62,
-0xfe2f,
-0xc540,
-0xd8ff,
-0xd980,
-0x734c,
-0xdb22,
-0xc543,
-0xc742,
-0x1c04,
-0x3501,
-0xc4a,
-0xfe2f,
-0xc540,
-0x700c,
-0xc02,
-0xfe2f,
-0x712c,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xdae0,
-0x201a,
-0xf81,
-0x20,
-0x0,
-0x40c3,
-0x9008,
-0x100,
-0x2105,
-0x3,
-0x7204,
-0x7825,
-0xb340,
-0x1800,
-0x485,
-0x700c,
-0xb3e,
-0xfe2f,
-0x4163,
-0xe5a,
-0xfe2f,
-0xd8ff,
-0x70cd,
-0xbe90,
-0xf968,
-0xc543,
-0xc742,
-0xc541,
-0xbfe,
-0xfe2f,
-0xc540,
-0xd8ff,
-0x41c3,
-0x0,
-0x2000,
-0x734c,
-0x746c,
-0xc543,
-0xc742,
-0xc541,
-0xc540,
-0xbe2,
-0xfe2f,
-0x4338,
-0xf95e,
-0xc543,
-0xc742,
-0xc541,
-0xbd6,
-0xfe2f,
-0xc540,
-0xf957,
-0xc543,
-0xc742,
-0xc541,
-0xbc6,
-0xfe2f,
-0xc540,
-0xf957,
-0xc543,
-0xc742,
-0xc541,
-0xbba,
-0xfe2f,
-0xc540,
-0xf950,
-0xc543,
-0xc742,
-0xc541,
-0xbaa,
-0xfe2f,
-0xc540,
-0xf950,
-0xc543,
-0xc742,
-0xc541,
-0xb9e,
-0xfe2f,
-0xc540,
-0xf949,
-0xc543,
-0xc742,
-0xc541,
-0xb8e,
-0xfe2f,
-0xc540,
-0xf949,
-0xc543,
-0xc742,
-0xc541,
-0xb82,
-0xfe2f,
-0xc540,
-0xf942,
-0xc543,
-0xc742,
-0xc541,
-0xb72,
-0xfe2f,
-0xc540,
-0xf942,
-0xc543,
-0xc742,
-0xc541,
-0xb66,
-0xfe2f,
-0xc540,
-0xf93b,
-0xc543,
-0xc742,
-0xc541,
-0xb56,
-0xfe2f,
-0xc540,
-0xf93b,
-0xc543,
-0xc742,
-0xc541,
-0xb4a,
-0xfe2f,
-0xc540,
-0xf934,
-0xc543,
-0xc742,
-0xc541,
-0xb3a,
-0xfe2f,
-0xc540,
-0xf934,
-0xc543,
-0xc742,
-0xc541,
-0xb2e,
-0xfe2f,
-0xc540,
-0xf92d,
-0xc543,
-0xc742,
-0xc541,
-0xb1e,
-0xfe2f,
-0xc540,
-0xc009,
-0x702c,
-0x754c,
-0x7b0f,
-0xd8ff,
-0xc543,
-0xc542,
-0xc541,
-0xb0a,
-0xfe2f,
-0xc540,
-0x79dd,
-0xd8ff,
-0x754c,
-0x746c,
-0x1c0c,
-0x3081,
-0xc542,
-0xc541,
-0xaf2,
-0xfe2f,
-0xc540,
-0xf91c,
-0xc543,
-0xc542,
-0xc541,
-0xae6,
-0xfe2f,
-0xc540,
-0xd0e,
-0xfe2f,
-0xd8ff,
-0xc543,
-0xc542,
-0xc541,
-0x3bd,
-0x20,
-0xc540,
-0x41c1,
-0x724c,
-0x746c,
-0xc543,
-0xc742,
-0xc541,
-0xac2,
-0xfe2f,
-0xc540,
-0xf90c,
-0xc543,
-0xc742,
-0x1c04,
-0x36c0,
-0xab2,
-0xfe2f,
-0xc540,
-0xf905,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xaa2,
-0xfe2f,
-0xc540,
-0xf8fe,
-0xc543,
-0xc742,
-0xc541,
-0xa92,
-0xfe2f,
-0xc540,
-0x750c,
-0xc041,
-0xf900,
-0xc543,
-0xc742,
-0xa82,
-0xfe2f,
-0xc540,
-0xf8fa,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xa72,
-0xfe2f,
-0xc540,
-0x750c,
-0xc043,
-0xf8f5,
-0xc742,
-0xc541,
-0xa62,
-0xfe2f,
-0xc540,
-0xf8ef,
-0xc543,
-0xc742,
-0xc541,
-0xa56,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0xa3e,
-0xfe2f,
-0xc540,
-0xf8e8,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xa2e,
-0xfe2f,
-0xc540,
-0xf8e1,
-0xc543,
-0xc742,
-0xc541,
-0xa1e,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0x746c,
-0xc543,
-0xa06,
-0xfe2f,
-0xc540,
-0x1c0c,
-0x36c0,
-0xf8da,
-0xc742,
-0xc541,
-0x9f6,
-0xfe2f,
-0xc540,
-0xc009,
-0x70ad,
-0x702c,
-0x780f,
-0xc045,
-0xc305,
-0xd8ff,
-0x754c,
-0xc543,
-0xc542,
-0xc541,
-0x9da,
-0xfe2f,
-0xc540,
-0xc008,
-0x46cb,
-0x0,
-0x2100,
-0x7014,
-0xf26c,
-0x714c,
-0xd8ff,
-0x41c1,
-0x746c,
-0x4358,
-0xc543,
-0xc742,
-0xc541,
-0x9ba,
-0xfe2f,
-0xc540,
-0xf8ca,
-0xc543,
-0xc742,
-0x1c04,
-0x36c0,
-0x9aa,
-0xfe2f,
-0xc540,
-0xf8bd,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0x99a,
-0xfe2f,
-0xc540,
-0xf8cb,
-0xc543,
-0xc742,
-0xc541,
-0x98a,
-0xfe2f,
-0xc540,
-0x750c,
-0xc041,
-0xf8be,
-0xc543,
-0xc742,
-0x97a,
-0xfe2f,
-0xc540,
-0xf8b2,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0x96a,
-0xfe2f,
-0xc540,
-0x750c,
-0xc043,
-0xf8ad,
-0xc742,
-0xc541,
-0x95a,
-0xfe2f,
-0xc540,
-0xf8bc,
-0xc543,
-0xc742,
-0xc541,
-0x94e,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0x936,
-0xfe2f,
-0xc540,
-0xf8a0,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0x926,
-0xfe2f,
-0xc540,
-0xf8ae,
-0xc543,
-0xc742,
-0xc541,
-0x916,
-0xfe2f,
-0xc540,
-0xc004,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0x746c,
-0xc543,
-0x8fe,
-0xfe2f,
-0xc540,
-0x1c0c,
-0x36c0,
-0xf004,
-0x1c0c,
-0x3441,
-0xf890,
-0xc742,
-0xc541,
-0x8ea,
-0xfe2f,
-0xc540,
-0xc305,
-0xf88a,
-0xc143,
-0xc142,
-0xc141,
-0x8da,
-0xfe2f,
-0xc140,
-0xf880,
-0x1c0c,
-0x30c1,
-0xc542,
-0xc541,
-0x8ca,
-0xfe2f,
-0xc540,
-0xf891,
-0xc543,
-0xc542,
-0xc541,
-0x8ba,
-0xfe2f,
-0xc540,
-0xae6,
-0xfe2f,
-0xd8ff,
-0xc004,
-0xc543,
-0xc541,
-0xc042,
-0x1c00,
-0x3041,
-0xd8ff,
-0xd980,
-0x764c,
-0xf0c7,
-0xf4c8,
-0xc00b,
-0x70cd,
-0x791d,
-0xc00c,
-0x6119,
-0x4918,
-0xb8c0,
-0x6119,
-0x4918,
-0xc04a,
-0x700c,
-0xf062,
-0xc004,
-0x45cb,
-0x0,
-0xffff,
-0x7014,
-0x7dc0,
-0xd80f,
-0x41a1,
-0x42a1,
-0xf12,
-0xfeaf,
-0xc340,
-0xc005,
-0x41a1,
-0x42a1,
-0x7b10,
-0xd808,
-0xf02,
-0xfeaf,
-0xc340,
-0x700c,
-0xf7e,
-0xfdef,
-0x4163,
-0x1200,
-0x3083,
-0xf865,
-0xc143,
-0xc142,
-0xc141,
-0x846,
-0xfe2f,
-0xc140,
-0xf85e,
-0xc543,
-0xc542,
-0xc541,
-0x836,
-0xfe2f,
-0xc540,
-0xc006,
-0x736f,
-0x702c,
-0x780f,
-0xc048,
-0xc042,
-0xd8ff,
-0x724c,
-0xdb08,
-0x1c0c,
-0x36c0,
-0xc541,
-0x81a,
-0xfe2f,
-0x1c00,
-0x3281,
-0xc008,
-0x702c,
-0x724c,
-0xc042,
-0xd8ff,
-0xdb08,
-0x1c0c,
-0x36c0,
-0xc541,
-0xffe,
-0xfdef,
-0xc540,
-0xd8ff,
-0x702c,
-0x724c,
-0xdb08,
-0x1c0c,
-0x36c0,
-0xc542,
-0xc541,
-0xfea,
-0xfdef,
-0x1c00,
-0x3281,
-0xc00a,
-0xd980,
-0x754c,
-0x7b0f,
-0xd8ff,
-0xc543,
-0xc542,
-0xc541,
-0xfd2,
-0xfdef,
-0xc540,
-0x700c,
-0xf8a,
-0xfdef,
-0x712c,
-0xc004,
-0x7104,
-0xc044,
-0xc007,
-0x232f,
-0x3007,
-0xc004,
-0x837,
-0x80b4,
-0x7bf0,
-0x700c,
-0xed6,
-0xfdef,
-0x4163,
-0x1200,
-0x3083,
-0xd8ff,
-0x702c,
-0x754c,
-0xc643,
-0xc642,
-0xc641,
-0xf96,
-0xfdef,
-0xc640,
-0x9de,
-0xfe2f,
-0xd8ff,
-0xf831,
-0xc643,
-0xc642,
-0xc641,
-0xf82,
-0xfdef,
-0xc640,
-0xca08,
-0x702c,
-0x714c,
-0xc043,
-0xc006,
-0xdb08,
-0xc641,
-0x780f,
-0xc042,
-0xd8ff,
-0xf6a,
-0xfdef,
-0xc640,
-0xc009,
-0x702c,
-0x754c,
-0x2054,
-0xc80,
-0x7b0f,
-0xd8ff,
-0xc643,
-0xc642,
-0xc641,
-0xf4e,
-0xfdef,
-0xc640,
-0xf81e,
-0x1c0c,
-0x3081,
-0xc642,
-0xc641,
-0xf3e,
-0xfdef,
-0xc640,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb50,
-0xc643,
-0xc642,
-0xc641,
-0xf2a,
-0xfdef,
-0xc640,
-0x956,
-0xfe2f,
-0xd8ff,
-0xc643,
-0xc642,
-0xc641,
-0xc640,
-0xd8ff,
-0xd980,
-0x754c,
-0xf12,
-0xfdef,
-0x746c,
-0xc0ad,
-0x1404,
-0x341b,
-0xc6c6,
-0x46cb,
-0x0,
-0xaaaa,
-0xf214,
-0xb17,
-0x3190,
-0xb1b,
-0x3150,
-0xb1d,
-0x3131,
-0x70cd,
-0x46cb,
-0x0,
-0xcccc,
-0xf008,
-0x46cb,
-0x0,
-0x8282,
-0xf004,
-0x46cb,
-0x0,
-0xb2b2,
-0x20f,
-0xffcf,
-0x702c,
-0xd8ff,
-0xb98f,
-0x754c,
-0x746c,
-0x7ee0,
-0xd8ff,
-0x702c,
-0x754c,
-0x726c,
-0x7ee0,
-0x78e0,
-0x702c,
-0xd8ff,
-0x754c,
-0x4528,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x714c,
-0xdb08,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x724c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x724c,
-0xdb08,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb30,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x4163,
-0x734c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x714c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a6,
-0x4608,
-0x1600,
-0x7100,
-0x9008,
-0x1e0,
-0x218a,
-0xffd,
-0xc045,
-0x7824,
-0xc042,
-0x1600,
-0x7100,
-0x900e,
-0x4c,
-0xc040,
-0x8e19,
-0xc044,
-0x8e10,
-0xc043,
-0x40c3,
-0x900e,
-0x4c,
-0x9001,
-0xc041,
-0xc004,
-0xe88a,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xcfe,
-0xfeaf,
-0x4300,
-0xd80f,
-0x956,
-0xfe2f,
-0xd90f,
-0x8608,
-0x70ad,
-0x781b,
-0x2005,
-0xf80,
-0x9003,
-0xe064,
-0xce6,
-0xffaf,
-0xb0a0,
-0x8629,
-0xaba,
-0xa0,
-0x710c,
-0xc002,
-0x712c,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0x40c3,
-0x9003,
-0xe064,
-0x2042,
-0x98f,
-0xb7a0,
-0xb7a0,
-0x1f9c,
-0x135c,
-0x1f9b,
-0x135c,
-0x1fe6,
-0x9f84,
-0x0,
-0xffff,
-0x1ff2,
-0x9044,
-0x1fe4,
-0x9044,
-0xd7a,
-0xfdef,
-0x960e,
-0xc100,
-0xc201,
-0xcaa,
-0x60,
-0x40c1,
-0xd80f,
-0x8ee,
-0xfe2f,
-0xd90f,
-0x8629,
-0xa66,
-0xa0,
-0x710c,
-0xc005,
-0x712c,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xb7a0,
-0x1fe6,
-0x9f84,
-0x0,
-0xff00,
-0x1ff2,
-0x9044,
-0x1fe4,
-0x9044,
-0xd3a,
-0xfdef,
-0x960a,
-0x8e58,
-0x8601,
-0xbde,
-0x60,
-0x712c,
-0xc100,
-0xc201,
-0xc62,
-0x60,
-0x40c1,
-0xd80f,
-0x8a6,
-0xfe2f,
-0xd90f,
-0xc004,
-0xe807,
-0xc003,
-0xfba,
-0xfdef,
-0x2078,
-0x100,
-0xf011,
-0xc003,
-0x41c3,
-0x0,
-0xffff,
-0x4220,
-0x7414,
-0x40c3,
-0x0,
-0xfffe,
-0x22ca,
-0x1,
-0x20ca,
-0x41,
-0xc16,
-0xfeaf,
-0x4320,
-0x1600,
-0x7100,
-0x900e,
-0x4c,
-0xc040,
-0x40c3,
-0x900e,
-0x4c,
-0x9001,
-0xc041,
-0xc002,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xc003,
-0x8629,
-0x2078,
-0x100,
-0x781b,
-0x781b,
-0x7504,
-0x9c6,
-0xa0,
-0xc042,
-0x8608,
-0x706f,
-0x781b,
-0x2005,
-0xf80,
-0x9003,
-0xe064,
-0xbd6,
-0xffaf,
-0x1800,
-0x6c4,
-0x712c,
-0x1f00,
-0x16c4,
-0x1f9c,
-0x16dc,
-0x1f9b,
-0x16dc,
-0x1fe6,
-0x9f84,
-0x0,
-0xffff,
-0x1ff2,
-0x9044,
-0x1fe4,
-0x9044,
-0x960e,
-0xc82,
-0xfdef,
-0x4528,
-0xc100,
-0xc201,
-0xbb2,
-0x60,
-0x40c1,
-0xc005,
-0xd90f,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xd80f,
-0xfea,
-0xfdef,
-0x1f00,
-0x16c4,
-0x8629,
-0x962,
-0xa0,
-0xc002,
-0x1fe6,
-0x9f84,
-0x0,
-0xff00,
-0x1ff2,
-0x9344,
-0x1fe4,
-0x9344,
-0x8605,
-0x712c,
-0x7104,
-0xc3e,
-0xfdef,
-0x7810,
-0xc100,
-0xc201,
-0xb6e,
-0x60,
-0x40c1,
-0xc004,
-0xe806,
-0xc003,
-0xece,
-0xfdef,
-0x2079,
-0x100,
-0x8e58,
-0x8603,
-0xac6,
-0x60,
-0x712c,
-0xc0a6,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a8,
-0x4608,
-0x1600,
-0x7100,
-0x9008,
-0x1e0,
-0x218a,
-0xffd,
-0xc047,
-0x7824,
-0xc045,
-0x1600,
-0x7100,
-0x900e,
-0x4c,
-0xc040,
-0x8e19,
-0xc043,
-0x8e10,
-0xc042,
-0x40c3,
-0x900e,
-0x4c,
-0x9001,
-0xc041,
-0xc003,
-0xe88a,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xaee,
-0xfeaf,
-0x4300,
-0xd80f,
-0xf46,
-0xfdef,
-0xd90f,
-0xc102,
-0x8608,
-0x2179,
-0x101,
-0xb52,
-0xfeaf,
-0xc144,
-0xc005,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0x8629,
-0x8a6,
-0xa0,
-0x730c,
-0x70ad,
-0x47cb,
-0x9003,
-0xe03e,
-0xb7a0,
-0x1f9b,
-0x135c,
-0x1f9c,
-0x135c,
-0x1fe6,
-0x9f84,
-0x0,
-0xffff,
-0x1ff2,
-0x9045,
-0x1fe4,
-0x9045,
-0x960e,
-0xb72,
-0xfdef,
-0x712c,
-0xc100,
-0xc201,
-0xaa6,
-0x60,
-0x40c1,
-0xd80f,
-0xeea,
-0xfdef,
-0xd90f,
-0xc007,
-0x712c,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xb7a0,
-0xb4e,
-0xfdef,
-0x960a,
-0x8e58,
-0x8602,
-0x9ee,
-0x60,
-0x712c,
-0xc100,
-0xc201,
-0xa76,
-0x60,
-0x40c1,
-0xd80f,
-0xeba,
-0xfdef,
-0xd90f,
-0xc003,
-0xe806,
-0xdce,
-0xfdef,
-0xc004,
-0xf012,
-0xc002,
-0x41c3,
-0x0,
-0xffff,
-0x42c3,
-0x0,
-0xfffe,
-0x7414,
-0x4020,
-0x20ca,
-0x81,
-0x22ca,
-0x41,
-0xa2e,
-0xfeaf,
-0x4320,
-0x1600,
-0x7100,
-0x900e,
-0x4c,
-0xc046,
-0x40c3,
-0x900e,
-0x4c,
-0x9001,
-0xc040,
-0xc005,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xc004,
-0x8629,
-0x781b,
-0x781b,
-0xe007,
-0xfde,
-0x60,
-0xc041,
-0x8608,
-0xa72,
-0xfeaf,
-0xc104,
-0x706f,
-0x712c,
-0x1f00,
-0x16c4,
-0x1f9b,
-0x16dc,
-0x1f9c,
-0x16dc,
-0x1fe6,
-0x9f84,
-0x0,
-0xffff,
-0x1ff2,
-0x9044,
-0x1fe4,
-0x9044,
-0x960e,
-0xaa6,
-0xfdef,
-0x4528,
-0xc106,
-0xc200,
-0x9da,
-0x60,
-0x40c1,
-0xc007,
-0xd90f,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0xd80f,
-0xe12,
-0xfdef,
-0x1f00,
-0x16c4,
-0x8629,
-0xf86,
-0x60,
-0xc001,
-0x40c3,
-0x0,
-0xff00,
-0x1fe6,
-0x9004,
-0x1ff2,
-0x9344,
-0x1fe4,
-0x9344,
-0x8605,
-0x712c,
-0x7104,
-0xa62,
-0xfdef,
-0x7810,
-0xc106,
-0xc200,
-0x992,
-0x60,
-0x40c1,
-0xc003,
-0xe806,
-0xc002,
-0xcf2,
-0xfdef,
-0x2078,
-0x100,
-0x8e58,
-0x8603,
-0x8ea,
-0x60,
-0x712c,
-0xc0a8,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3503,
-0xc140,
-0xdf6,
-0xfdef,
-0x712c,
-0x1600,
-0x7083,
-0x8000,
-0x4,
-0xc043,
-0xc088,
-0xd9ff,
-0xb52,
-0xff6f,
-0xdab4,
-0x40c3,
-0x0,
-0x2100,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0x700c,
-0x1e00,
-0x7004,
-0x9003,
-0xfec4,
-0xc000,
-0x71ad,
-0x2079,
-0x0,
-0x4898,
-0x205f,
-0x200,
-0xc145,
-0xc042,
-0xc102,
-0xf011,
-0x6941,
-0x219a,
-0x8,
-0x44a9,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x7c9b,
-0x2105,
-0xf80,
-0x9003,
-0xe0c4,
-0xb080,
-0x4140,
-0xc005,
-0x9e1,
-0x8024,
-0x2144,
-0x7c0,
-0x231a,
-0xf83,
-0x10,
-0x0,
-0x1600,
-0x709b,
-0x8000,
-0x7cd,
-0xc346,
-0xe598,
-0x1d8,
-0xd,
-0x40c3,
-0x8000,
-0x7cd,
-0x8821,
-0xf015,
-0xc003,
-0x2055,
-0x8c2,
-0xc006,
-0x7a05,
-0xd8ef,
-0x2004,
-0x6c0,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x7167,
-0x7845,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x1e00,
-0xb0a0,
-0x202f,
-0x6c7,
-0x9d7,
-0x8005,
-0x40c3,
-0x0,
-0x2100,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0xc000,
-0x41c3,
-0x9003,
-0xfe64,
-0x7014,
-0x40c3,
-0x9003,
-0xf064,
-0x711c,
-0x86e,
-0xffaf,
-0x1900,
-0x5,
-0x866,
-0xff8f,
-0xd80f,
-0xcba,
-0xfdef,
-0xd90f,
-0x730c,
-0xe32,
-0x60,
-0x218a,
-0xfc7,
-0xdf7f,
-0x46cb,
-0x9003,
-0xe024,
-0x710c,
-0xb6e0,
-0xc044,
-0xb606,
-0x208a,
-0x3c4,
-0x1efe,
-0x9004,
-0xd818,
-0x90a,
-0xfdef,
-0x712c,
-0x208a,
-0x4,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0xd80f,
-0xc7e,
-0xfdef,
-0xd90f,
-0xd807,
-0x8ee,
-0xfdef,
-0x712c,
-0x710c,
-0xb6e0,
-0xb606,
-0xd80f,
-0xd90f,
-0xc66,
-0xfdef,
-0x1efe,
-0x93c5,
-0x730c,
-0x8d2,
-0xfdef,
-0x712c,
-0xd80f,
-0xc52,
-0xfdef,
-0xd90f,
-0x700c,
-0x712c,
-0x1e00,
-0x1fc5,
-0x1e0c,
-0x1fc5,
-0x8ba,
-0xfdef,
-0x1efe,
-0x9005,
-0x40c3,
-0x8000,
-0x7cd,
-0x1600,
-0x7081,
-0x8000,
-0x7cd,
-0x8801,
-0x260a,
-0x3f80,
-0x9002,
-0x64,
-0x4338,
-0xc047,
-0xf05f,
-0x221a,
-0xf9f,
-0x0,
-0x1000,
-0xc602,
-0xc400,
-0xf053,
-0x225f,
-0x480,
-0x74d5,
-0x24c0,
-0x1061,
-0x23ca,
-0x1061,
-0xc041,
-0xc301,
-0xc088,
-0x631b,
-0x7bd4,
-0x9300,
-0xe0c0,
-0x88,
-0x25,
-0x40c1,
-0x209a,
-0x4,
-0x2005,
-0x7c0,
-0x7f1b,
-0x2705,
-0x178f,
-0x9700,
-0x7014,
-0xc004,
-0x23ca,
-0x1021,
-0x20ca,
-0x21,
-0xb53,
-0x1030,
-0xc044,
-0x78cf,
-0x80d,
-0xd0,
-0x84b,
-0x210,
-0x855,
-0x1d1,
-0x788f,
-0x2079,
-0x0,
-0x205f,
-0x100,
-0xf010,
-0xc301,
-0x677f,
-0x7f14,
-0x6861,
-0x209a,
-0x4,
-0x2005,
-0x7c0,
-0x781b,
-0x2005,
-0x780,
-0x9000,
-0xb700,
-0x4060,
-0xee5,
-0x9025,
-0xc788,
-0xe25,
-0x11d1,
-0x40c3,
-0x8000,
-0x7cd,
-0x7854,
-0xa8af,
-0xf00a,
-0x706d,
-0xf008,
-0x9700,
-0xb300,
-0x40c3,
-0x8000,
-0x7cd,
-0x7854,
-0xa8b0,
-0x71c5,
-0xc005,
-0xe5b,
-0x9004,
-0x7124,
-0xc007,
-0x7a2f,
-0x845,
-0x80a5,
-0x716d,
-0xc004,
-0x71a5,
-0x7014,
-0xf315,
-0x1600,
-0x7080,
-0x8000,
-0x0,
-0xb8c3,
-0xc041,
-0xf02f,
-0xc502,
-0xf028,
-0x275f,
-0x1480,
-0x41c3,
-0x47,
-0x2,
-0x42e1,
-0x661e,
-0x26f4,
-0x1340,
-0x43a1,
-0xe5e,
-0xfd6f,
-0x20bc,
-0x1,
-0xc003,
-0x271a,
-0x1f81,
-0x0,
-0x1000,
-0x26f4,
-0x1342,
-0x2054,
-0xd00,
-0x7905,
-0x40a1,
-0x209a,
-0x4,
-0x71a5,
-0x7825,
-0x781b,
-0x2005,
-0xf81,
-0x9002,
-0x0,
-0xc001,
-0x6058,
-0x2049,
-0xfc0,
-0xb100,
-0xc005,
-0xdb3,
-0x9024,
-0xc688,
-0x7167,
-0x40c3,
-0x8000,
-0x7cd,
-0x8801,
-0x272f,
-0x16c7,
-0x89b,
-0x83c5,
-0xc000,
-0x889,
-0x10,
-0x9da,
-0xfe4f,
-0x4308,
-0x40c3,
-0x8000,
-0x7cd,
-0x8881,
-0x1600,
-0x7080,
-0x8000,
-0x7cd,
-0xf034,
-0x41c3,
-0x8000,
-0x7cd,
-0x79b4,
-0x896f,
-0x8950,
-0x4a76,
-0x4b51,
-0x7270,
-0x21ca,
-0x38d,
-0x7e2f,
-0x261a,
-0x12ce,
-0xd908,
-0x27ca,
-0x122d,
-0x21ca,
-0x12d,
-0x2e44,
-0x180e,
-0xf019,
-0xc203,
-0x219a,
-0x4,
-0x2254,
-0xd03,
-0x251a,
-0x1f82,
-0x0,
-0x1000,
-0x7a65,
-0x7945,
-0x793b,
-0xb991,
-0xb99c,
-0xb99f,
-0x9160,
-0x7ad0,
-0x627a,
-0x2249,
-0xfc2,
-0xb140,
-0x210a,
-0x780,
-0x9d5,
-0x83e4,
-0x2140,
-0x5e,
-0x7104,
-0x7d0f,
-0xc9d,
-0x9365,
-0xdf09,
-0x2480,
-0x3503,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3d0a,
-0xc040,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x4338,
-0x41c3,
-0x4a,
-0x0,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x9000,
-0x2084,
-0x1,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0xd36,
-0xfd6f,
-0x2052,
-0x0,
-0x8ae,
-0xfeaf,
-0x700c,
-0x42c3,
-0x9003,
-0xff68,
-0x1e00,
-0x7005,
-0x9003,
-0xe004,
-0x1a00,
-0x5,
-0xc000,
-0x712c,
-0x47cb,
-0x8000,
-0x7ca,
-0x2044,
-0x7cd,
-0x4020,
-0xed06,
-0xbd61,
-0xd01,
-0x1031,
-0x781b,
-0x205a,
-0x103,
-0x1600,
-0x7100,
-0x9008,
-0x1ea,
-0xc044,
-0x12c3,
-0x700,
-0xc043,
-0xca0a,
-0x208c,
-0x8fc3,
-0xf40c,
-0x1600,
-0x7080,
-0x8000,
-0x0,
-0xb8e5,
-0xd8ff,
-0xf204,
-0x8f00,
-0x1a0a,
-0x3002,
-0xc100,
-0x230f,
-0x41,
-0xc149,
-0x2379,
-0x3001,
-0x7224,
-0xc14a,
-0x8f20,
-0x33b,
-0x20,
-0x2139,
-0x0,
-0xc004,
-0x714c,
-0x2004,
-0xf81,
-0x0,
-0xc0ff,
-0x2004,
-0xf80,
-0x0,
-0x3f00,
-0x2080,
-0x10,
-0x7825,
-0x1e00,
-0x7004,
-0x9008,
-0x1ea,
-0x1e00,
-0x7384,
-0x900f,
-0xe022,
-0xc003,
-0x762c,
-0xb8a5,
-0x1e00,
-0x7004,
-0x9005,
-0xe0ee,
-0xc009,
-0xf7e,
-0xff6f,
-0x780f,
-0xc000,
-0x780f,
-0xed08,
-0xb82,
-0xffef,
-0x2578,
-0x1081,
-0x2c9,
-0x0,
-0x976,
-0xfdef,
-0x712c,
-0x1600,
-0x709b,
-0x8000,
-0x4,
-0x8ee,
-0xfdef,
-0xc047,
-0xc046,
-0x2400,
-0x3f80,
-0x0,
-0x258,
-0x702c,
-0xec6,
-0xff2f,
-0xda5a,
-0x2400,
-0x3f80,
-0x0,
-0x1a4,
-0xeba,
-0xff2f,
-0xdab4,
-0xdda,
-0xfeef,
-0x208a,
-0xb04,
-0xd72,
-0xfeef,
-0xc045,
-0x1e00,
-0x7384,
-0x9003,
-0xfec4,
-0xc006,
-0x2079,
-0x0,
-0xe008,
-0xc042,
-0xf012,
-0x4200,
-0x2644,
-0x17c0,
-0x6e21,
-0x269a,
-0x1008,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7a5b,
-0x2605,
-0x1f80,
-0x9003,
-0xe0c4,
-0xb040,
-0x4628,
-0xc002,
-0xedf,
-0x9024,
-0x710c,
-0xd880,
-0xb88e,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0x231a,
-0x3f80,
-0x20,
-0x0,
-0x2005,
-0xf81,
-0x9003,
-0xfe86,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x9000,
-0xb8a0,
-0xf8e,
-0xfe2f,
-0xb100,
-0x208c,
-0x8f03,
-0xda3f,
-0xf643,
-0x2844,
-0x102,
-0x231a,
-0x3f80,
-0x10,
-0x0,
-0x8fc3,
-0x8f24,
-0x43c1,
-0xc04b,
-0xf012,
-0x7864,
-0x201a,
-0xf8c,
-0x0,
-0x1000,
-0xc007,
-0x7164,
-0x2054,
-0xd00,
-0x7885,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x1e00,
-0xb040,
-0x786f,
-0x9e1,
-0x8025,
-0xd8ef,
-0x228a,
-0x7c4,
-0x40c3,
-0x9003,
-0xe024,
-0xb040,
-0x228a,
-0x3c4,
-0x706f,
-0x180c,
-0x45,
-0x18fe,
-0x8084,
-0xf09f,
-0xc007,
-0x2055,
-0x8c2,
-0xc00b,
-0x7a05,
-0xd8ef,
-0x78c4,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x71c5,
-0x7845,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x1e00,
-0x1800,
-0x6c4,
-0x78cf,
-0x9d9,
-0x8005,
-0xd80f,
-0xfea,
-0xfdaf,
-0xd90f,
-0x45cb,
-0x9003,
-0xfe64,
-0xb82,
-0xff6f,
-0x1d00,
-0x1005,
-0xb7a,
-0xff4f,
-0xa3a,
-0xff2f,
-0xc005,
-0x710c,
-0x94a,
-0x60,
-0x218a,
-0xfc7,
-0xd820,
-0xc3a,
-0xfdaf,
-0x712c,
-0xc08f,
-0x702c,
-0xada,
-0x20,
-0x714c,
-0xd80f,
-0xfae,
-0xfdaf,
-0xd90f,
-0xd87f,
-0xb4a,
-0xff6f,
-0xb500,
-0xb46,
-0xff4f,
-0xa06,
-0xff2f,
-0xc005,
-0x730c,
-0x916,
-0x60,
-0x218a,
-0xfc7,
-0xd820,
-0xc02,
-0xfdaf,
-0x712c,
-0x2455,
-0x3f00,
-0x702c,
-0xaa2,
-0x20,
-0x714c,
-0x8f03,
-0x205f,
-0x243,
-0x260a,
-0x3000,
-0xf03f,
-0xc08c,
-0x702c,
-0xd26,
-0xff2f,
-0xda09,
-0x70ad,
-0xf030,
-0x787b,
-0x2084,
-0xf87,
-0xc18f,
-0x2135,
-0xb,
-0x2455,
-0x3f01,
-0x2135,
-0xe,
-0x2602,
-0x12c0,
-0x2048,
-0x2,
-0xc08c,
-0x60b8,
-0xa840,
-0x7c4f,
-0xc008,
-0x205f,
-0x241,
-0x2400,
-0x3f80,
-0x0,
-0x258,
-0x6038,
-0x60b8,
-0x8820,
-0x921,
-0x305,
-0xa840,
-0xc008,
-0x205f,
-0x481,
-0x2400,
-0x3f80,
-0x0,
-0x1a4,
-0x6038,
-0x2300,
-0x1381,
-0x78b4,
-0x793d,
-0xb020,
-0x71a5,
-0x7164,
-0xc002,
-0xda5,
-0x9004,
-0xc006,
-0x2640,
-0x305e,
-0x7014,
-0x23c0,
-0x61,
-0x8f24,
-0x202f,
-0x787,
-0x97f,
-0x8025,
-0xc048,
-0x8fc3,
-0x7467,
-0x234c,
-0xb780,
-0x6ec,
-0xffce,
-0xf036,
-0x70ad,
-0xf02e,
-0x235f,
-0x3241,
-0x2400,
-0x3f80,
-0x0,
-0x258,
-0x43a1,
-0x6038,
-0x41c3,
-0x3e,
-0x2,
-0x9f2,
-0xfd6f,
-0x60a8,
-0x42a1,
-0x231a,
-0x3f80,
-0x0,
-0x2000,
-0x229a,
-0x8,
-0x235f,
-0x3481,
-0x43c3,
-0x9002,
-0x80,
-0x7a05,
-0x2400,
-0x3f80,
-0x0,
-0x1a4,
-0x6119,
-0x21f4,
-0x340,
-0x2205,
-0xcc,
-0xb400,
-0x2342,
-0x800,
-0x7a05,
-0x21f4,
-0x340,
-0x71a5,
-0xb200,
-0xc002,
-0xda9,
-0x9024,
-0x4263,
-0x8f24,
-0x71c5,
-0x78cf,
-0x999,
-0x8025,
-0x4318,
-0xc003,
-0xb885,
-0x1e00,
-0x7004,
-0x9005,
-0xe0ee,
-0xc004,
-0x1e00,
-0x7004,
-0x9008,
-0x1ea,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0x7d0f,
-0xc00a,
-0x70b1,
-0x4c6,
-0xffed,
-0x70cd,
-0x2480,
-0x3d0a,
-0x1404,
-0x341b,
-0xc6c6,
-0xc0e6,
-0x43c3,
-0x8000,
-0x7cd,
-0x8ba0,
-0x8b81,
-0x251f,
-0x108f,
-0xf01b,
-0x251a,
-0x1f9e,
-0x0,
-0x1000,
-0x239a,
-0x4,
-0x2114,
-0x38e,
-0x2605,
-0x301e,
-0x2305,
-0x783,
-0x7b7b,
-0xbb91,
-0xbb9c,
-0xbb9f,
-0x9360,
-0x71e5,
-0x7165,
-0xb660,
-0x232f,
-0x2c7,
-0xbd7,
-0x80a4,
-0x7ef0,
-0x71a5,
-0xcf7,
-0x9365,
-0x706d,
-0xc4c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x201a,
-0xf8d,
-0x0,
-0x2000,
-0x4728,
-0x7afd,
-0x4100,
-0x40c3,
-0x9002,
-0xb2,
-0x7a5d,
-0x2505,
-0x100c,
-0x2245,
-0x602,
-0x7204,
-0x1c00,
-0x1005,
-0xb440,
-0x2505,
-0x1002,
-0x92c0,
-0x7204,
-0xbfc1,
-0x78a5,
-0x6f43,
-0x90a0,
-0x40c1,
-0x2244,
-0x7c3,
-0xeb06,
-0xbb61,
-0xb01,
-0x31,
-0x781d,
-0x1c00,
-0x1005,
-0x2044,
-0x83,
-0x40c1,
-0x2744,
-0x17cc,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x781d,
-0xb8c0,
-0x2005,
-0xcc,
-0x6f66,
-0x40c1,
-0x2344,
-0x7db,
-0xb11,
-0x3010,
-0x2342,
-0x305b,
-0xbff,
-0xb031,
-0x781d,
-0xbbc4,
-0x2044,
-0x100,
-0x2405,
-0x101e,
-0x2740,
-0x124c,
-0x40c1,
-0x2444,
-0x17ce,
-0xee05,
-0xbe61,
-0xeff,
-0x9031,
-0x781d,
-0xbfc4,
-0x2244,
-0x7ce,
-0x42a1,
-0xee06,
-0xbe61,
-0xe01,
-0x1031,
-0x7a5d,
-0xbcc4,
-0x2244,
-0x8e,
-0x42a1,
-0xef05,
-0xbf61,
-0xfff,
-0x9031,
-0x7a5d,
-0x2044,
-0x200,
-0xbac0,
-0x7e45,
-0x42a1,
-0xeb05,
-0xbb61,
-0xbff,
-0x8031,
-0x7a5d,
-0x2005,
-0x780,
-0x2244,
-0x103,
-0x42a1,
-0xec05,
-0xbc61,
-0xcff,
-0x9031,
-0x7a5d,
-0x7bc5,
-0x2244,
-0x202,
-0x7a65,
-0x225f,
-0x402,
-0xdd2,
-0xfdaf,
-0x7845,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x45cb,
-0x8000,
-0x7cd,
-0x8d80,
-0x4338,
-0x4718,
-0x706d,
-0x710c,
-0xea0d,
-0x245f,
-0x1243,
-0xa1b,
-0xb1,
-0xd908,
-0xe308,
-0xd809,
-0x71ed,
-0x234a,
-0x1200,
-0xf006,
-0x7b9b,
-0x74ed,
-0x742c,
-0xf002,
-0x71ed,
-0x1501,
-0x109e,
-0xf023,
-0x45c9,
-0x259a,
-0x1008,
-0x241a,
-0x1f82,
-0x0,
-0x2000,
-0x7aa5,
-0x2205,
-0xf82,
-0x9002,
-0x64,
-0xb1f,
-0x3030,
-0x9a40,
-0x258a,
-0x1fcf,
-0x7d44,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x7a5d,
-0x2284,
-0x81f,
-0x62ba,
-0x2714,
-0x30cd,
-0xb540,
-0x66fe,
-0x631b,
-0x9c3,
-0x8385,
-0x7185,
-0xefd,
-0xb325,
-0x4669,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x8819,
-0xb863,
-0x7314,
-0x20e0,
-0x7cd,
-0x40c3,
-0x900e,
-0x1e4c,
-0xb020,
-0x7fe0,
-0xb041,
-0x78e0,
-0xc0f1,
-0x706d,
-0x706c,
-0xf016,
-0x70ef,
-0xf011,
-0x235a,
-0xc82,
-0x605c,
-0x275a,
-0x3642,
-0x71e7,
-0x629a,
-0x623c,
-0x2600,
-0x3682,
-0x123c,
-0x82,
-0x2640,
-0x305e,
-0xac40,
-0xfe5,
-0xb094,
-0x7164,
-0xbd9,
-0x80b4,
-0x2314,
-0x10de,
-0xc0d1,
-0x7ee0,
-0x791b,
-0x781d,
-0x2184,
-0xa82,
-0x2046,
-0xa80,
-0x7905,
-0x215a,
-0x100,
-0x793d,
-0x793d,
-0x2144,
-0xcc1,
-0x2084,
-0x303,
-0x7905,
-0x215f,
-0x400,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0x7825,
-0x7fe0,
-0x780f,
-0x78e0,
-0xc2e2,
-0x45cb,
-0x9005,
-0xe000,
-0xd820,
-0xe26,
-0xfeef,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3b02,
-0x1600,
-0x709b,
-0x8000,
-0x4,
-0xc142,
-0x702c,
-0xc041,
-0xf007,
-0xf8a5,
-0x2004,
-0xf80,
-0x0,
-0xfbff,
-0xb200,
-0x9f7,
-0x8294,
-0x1600,
-0x7100,
-0x9004,
-0xaa,
-0x41c3,
-0x8000,
-0x51f,
-0xda78,
-0xc045,
-0x1e00,
-0x7085,
-0x9005,
-0xe0aa,
-0xdce,
-0xfd2f,
-0xc08d,
-0xc08d,
-0xace,
-0xe0,
-0xd978,
-0xe76,
-0xfd8f,
-0xd80f,
-0xb56,
-0xfdaf,
-0xd90f,
-0xef6,
-0xff0f,
-0x40c3,
-0x8000,
-0x67c,
-0xb12,
-0x20,
-0x712c,
-0x40c3,
-0x8000,
-0x67c,
-0x712c,
-0xaa2,
-0xfdaf,
-0xdaf7,
-0xc001,
-0x71ed,
-0x42e1,
-0xb8c4,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x7a5b,
-0x45cb,
-0x8000,
-0x7c9,
-0x225a,
-0x102,
-0xc001,
-0x8d20,
-0x238a,
-0xf7f,
-0x220f,
-0xe,
-0x265a,
-0x1100,
-0x704c,
-0x1c00,
-0x3fc1,
-0x78c5,
-0x780f,
-0xc044,
-0xc001,
-0x205f,
-0x640,
-0xc043,
-0x215f,
-0xc80,
-0xc103,
-0x6119,
-0x2100,
-0xf81,
-0x8000,
-0x67c,
-0xd02,
-0xa0,
-0xc004,
-0x40c3,
-0x8000,
-0x67c,
-0xea2,
-0xffef,
-0x712c,
-0x8d00,
-0x7ecf,
-0x205f,
-0xc81,
-0xc003,
-0x6038,
-0x2000,
-0xf80,
-0x8000,
-0x67c,
-0x8801,
-0x218a,
-0x44,
-0xc047,
-0x40c3,
-0x9003,
-0xe024,
-0xb0e0,
-0xb0e6,
-0x18fe,
-0x8044,
-0x40c1,
-0xba2,
-0xa0,
-0x702c,
-0xd830,
-0xf16,
-0xfd6f,
-0x712c,
-0xd9e,
-0xfe0f,
-0x231a,
-0x3f80,
-0x10,
-0x0,
-0xc046,
-0x700c,
-0xf005,
-0x6119,
-0x1900,
-0xfc3,
-0x7104,
-0x8fb,
-0x8534,
-0xc188,
-0x700c,
-0xeee,
-0xfd6f,
-0x712c,
-0xd80f,
-0xa6e,
-0xfdaf,
-0xd90f,
-0x40c1,
-0xb62,
-0xa0,
-0x712c,
-0x208a,
-0xfc7,
-0x46cb,
-0x9003,
-0xe174,
-0x70ed,
-0xb600,
-0xb601,
-0x1e59,
-0x901d,
-0xf7d,
-0x1a35,
-0x700c,
-0xebe,
-0xfd6f,
-0x712c,
-0x1503,
-0x108b,
-0x8d82,
-0x706f,
-0xf02a,
-0x241a,
-0x1f80,
-0x0,
-0x1000,
-0x206c,
-0x302,
-0x2205,
-0xf80,
-0x9002,
-0x166,
-0x9000,
-0x2079,
-0x3,
-0xc088,
-0x6098,
-0x8820,
-0x793b,
-0x7965,
-0xa820,
-0x241a,
-0x1f80,
-0x0,
-0x800,
-0x2153,
-0x80be,
-0x2004,
-0xf80,
-0x0,
-0x800,
-0x7a05,
-0x2205,
-0xf82,
-0x9002,
-0x64,
-0x9200,
-0xf205,
-0x2080,
-0x10,
-0x716f,
-0xb200,
-0x7185,
-0xbaf,
-0x9325,
-0xd80f,
-0x9de,
-0xfdaf,
-0xd90f,
-0xb8d,
-0xb031,
-0x71e5,
-0x706f,
-0x41c3,
-0x6e,
-0x0,
-0xcfe,
-0xfd2f,
-0x2378,
-0x3000,
-0x1e00,
-0x1005,
-0xcc6,
-0xfe2f,
-0x1e02,
-0x1005,
-0x700c,
-0xa16,
-0x20,
-0x732c,
-0xd840,
-0xe22,
-0xfd6f,
-0x712c,
-0xc002,
-0x712c,
-0xcc6,
-0xffef,
-0x704c,
-0x8d43,
-0x8d62,
-0xf00e,
-0xc102,
-0xc007,
-0x21f4,
-0xc1,
-0xb8e3,
-0xd840,
-0x20ca,
-0x822,
-0x7902,
-0xc002,
-0x7874,
-0x7164,
-0xb020,
-0xae7,
-0x80c5,
-0xc001,
-0x9c2,
-0xfdaf,
-0x712c,
-0xc106,
-0x2055,
-0x800,
-0x714c,
-0x7825,
-0xc102,
-0x92a,
-0xe0,
-0x716c,
-0x702c,
-0x1e00,
-0x7044,
-0x9003,
-0xe004,
-0x1e00,
-0x7044,
-0x9005,
-0xe076,
-0xc005,
-0x1e00,
-0x7004,
-0x9005,
-0xe0aa,
-0xf005,
-0xf80f,
-0xb88a,
-0xb200,
-0x9fd,
-0x8294,
-0xd72,
-0xffcf,
-0x8d00,
-0x704c,
-0x238a,
-0xf7f,
-0x205f,
-0xc81,
-0xc003,
-0x1c00,
-0x3fc1,
-0x6038,
-0x2000,
-0xf81,
-0x8000,
-0x67c,
-0xb36,
-0xa0,
-0xc004,
-0x2480,
-0x3b02,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x211a,
-0xf80,
-0x0,
-0x2000,
-0x7124,
-0x2005,
-0xf82,
-0x9002,
-0x94,
-0x9200,
-0x7ee0,
-0x78e0,
-0x8821,
-0x216c,
-0x41,
-0xa821,
-0x8822,
-0xb9c6,
-0xa822,
-0x882d,
-0x2144,
-0xc02,
-0x2285,
-0x23f,
-0x913,
-0x17f,
-0xa84d,
-0x794f,
-0xb985,
-0xa82d,
-0x8823,
-0xb987,
-0xa823,
-0x702c,
-0xa838,
-0xa831,
-0x7fe0,
-0xa830,
-0xc2e2,
-0xb9a,
-0xfdcf,
-0x256f,
-0x1343,
-0x9560,
-0xda20,
-0xd940,
-0x238c,
-0x85ca,
-0x22ca,
-0xc2d,
-0x238c,
-0x89d0,
-0x22ca,
-0x4d,
-0x238c,
-0x8fd8,
-0xd950,
-0x22ca,
-0x4d,
-0x218a,
-0x5ca,
-0x213c,
-0xc1,
-0x238c,
-0x89d0,
-0x21ca,
-0xad,
-0x238c,
-0x8fd8,
-0x21ca,
-0xed,
-0x73d3,
-0x0,
-0x95f,
-0x21ca,
-0x12d,
-0x2105,
-0x8c,
-0x15fe,
-0x9081,
-0x205a,
-0x400,
-0x211a,
-0xf83,
-0x20,
-0x0,
-0x41c3,
-0x9004,
-0xf8,
-0x2004,
-0xf80,
-0x0,
-0x1ff0,
-0xb881,
-0x2305,
-0x42,
-0x7224,
-0x7965,
-0xb280,
-0xb100,
-0xc6c2,
-0x78e0,
-0xc0e4,
-0x264a,
-0x3000,
-0x704c,
-0xf013,
-0x706c,
-0xf00c,
-0x225a,
-0xc8c,
-0x7165,
-0x609d,
-0x235a,
-0x64c,
-0x7164,
-0x64bc,
-0x642c,
-0x1e3c,
-0x1302,
-0xbeb,
-0x80b4,
-0x2300,
-0x168e,
-0x7144,
-0xadf,
-0x80b4,
-0x2614,
-0x308b,
-0xc4c4,
-0xc2e6,
-0x1209,
-0x308d,
-0x70cd,
-0x70ed,
-0x1a09,
-0x3382,
-0xf009,
-0x26f0,
-0x73c0,
-0x8000,
-0x8e8,
-0xb62,
-0x40,
-0x71e5,
-0xcc22,
-0xff1,
-0x9004,
-0x1a09,
-0x3342,
-0x1a22,
-0x339c,
-0xc6c6,
-0x78e0,
-0x43c3,
-0x9008,
-0x1ea,
-0x9340,
-0x209a,
-0x4,
-0x2000,
-0xf80,
-0x0,
-0xfe00,
-0x2204,
-0xf82,
-0x0,
-0xc0ff,
-0x7845,
-0x9341,
-0xb300,
-0xb962,
-0x226c,
-0x140,
-0x7825,
-0x7fe0,
-0xb301,
-0x78e0,
-0x7a1b,
-0x2205,
-0xf82,
-0x9003,
-0xe164,
-0x1a00,
-0x5,
-0x42c3,
-0x8000,
-0x7cd,
-0x8a61,
-0x8a80,
-0xf00d,
-0x241a,
-0x1f82,
-0x0,
-0x1000,
-0x7185,
-0x7a05,
-0x7a5b,
-0x2205,
-0xf82,
-0x9002,
-0x164,
-0xb220,
-0xbeb,
-0x8305,
-0x7ee0,
-0xc2e2,
-0x1600,
-0x710d,
-0x8000,
-0x6,
-0xe56d,
-0x2d85,
-0x1b81,
-0x2553,
-0x9041,
-0xf205,
-0x78af,
-0x214e,
-0x10d,
-0x651d,
-0x7aaf,
-0x41c3,
-0xaf,
-0x1,
-0xfe2,
-0xfd6f,
-0xd80a,
-0x40c3,
-0x8000,
-0x7c8,
-0xa8a0,
-0xc6c2,
-0x78e0,
-0xc2e6,
-0x266f,
-0x15c3,
-0x8e40,
-0x4508,
-0xea17,
-0xc1a,
-0xfeaf,
-0x4040,
-0x4708,
-0xe887,
-0x41c3,
-0xd6,
-0x1,
-0xa46,
-0xfd2f,
-0x700c,
-0x40e1,
-0x209a,
-0x1,
-0x7f05,
-0x78bb,
-0x2005,
-0xf80,
-0x9003,
-0xfe92,
-0xb0e0,
-0x16ff,
-0x9082,
-0xea18,
-0xbea,
-0xfeaf,
-0x4040,
-0x228c,
-0x8fc3,
-0xf209,
-0xe888,
-0x41c3,
-0xd7,
-0x1,
-0xa12,
-0xfd2f,
-0x700c,
-0x700c,
-0x209a,
-0x1,
-0x79bb,
-0x2105,
-0xf81,
-0x9003,
-0xfe9a,
-0xb100,
-0xc6c6,
-0x78e0,
-0xc0f1,
-0x1600,
-0x7082,
-0x8000,
-0x9,
-0xea1a,
-0xa23,
-0xa30,
-0x720c,
-0x228c,
-0x8c03,
-0xf20c,
-0xe2f8,
-0xf404,
-0x710c,
-0xf009,
-0x41c3,
-0xd8,
-0x1,
-0x9d2,
-0xfd2f,
-0x700c,
-0x700c,
-0x205f,
-0x401,
-0x7825,
-0x1e00,
-0x7004,
-0x9005,
-0xe0a0,
-0xc0d1,
-0x7ee0,
-0xc0e6,
-0x4328,
-0x70ed,
-0x41c3,
-0x9003,
-0xff64,
-0xb1e0,
-0x1904,
-0x45,
-0x42c3,
-0x8000,
-0x7cd,
-0x8a21,
-0x8ac0,
-0xf039,
-0x228c,
-0x8fc3,
-0xf418,
-0x261a,
-0x1f83,
-0x0,
-0x2000,
-0x42c3,
-0x9002,
-0x1f64,
-0x2305,
-0x8c,
-0x7444,
-0x7a65,
-0xb400,
-0xb51,
-0x123f,
-0xb2e0,
-0x42c3,
-0x9003,
-0xf164,
-0xb2e0,
-0x1a04,
-0x45,
-0xf020,
-0x260a,
-0x32c0,
-0x708d,
-0xf016,
-0xf753,
-0x4381,
-0x261a,
-0x1f82,
-0x0,
-0x2000,
-0x239a,
-0x8,
-0x7b45,
-0x42c3,
-0x9002,
-0x164,
-0x2305,
-0x8d,
-0x7444,
-0x7b45,
-0xb500,
-0x1b00,
-0x5,
-0x7185,
-0xe0d,
-0x3010,
-0xcd5,
-0x9274,
-0x262f,
-0xb782,
-0x71c5,
-0x993,
-0x83a5,
-0x222f,
-0x2c7,
-0xc4c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x40c3,
-0x9004,
-0x30,
-0x10b4,
-0x501,
-0x1600,
-0x708f,
-0x8000,
-0x25,
-0x90d,
-0x171,
-0xb0e0,
-0xb0e1,
-0xf007,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0xb021,
-0xf6f,
-0x1030,
-0x716f,
-0x1600,
-0x7080,
-0x8000,
-0x32,
-0x2744,
-0x108d,
-0xb8e3,
-0x1600,
-0x7080,
-0x8000,
-0x7cf,
-0x23ca,
-0x30a1,
-0x2744,
-0x104e,
-0xc040,
-0xf01b,
-0x209a,
-0x4,
-0x2753,
-0x1041,
-0x7905,
-0x40a1,
-0xf848,
-0xc000,
-0xf841,
-0xee07,
-0xc000,
-0x4263,
-0x790f,
-0xfaa,
-0xfdaf,
-0x700c,
-0xed08,
-0xc000,
-0x4263,
-0x790f,
-0xf9e,
-0xfdaf,
-0x710c,
-0xc000,
-0x7104,
-0xc040,
-0x40c3,
-0x8000,
-0x7cf,
-0x8821,
-0xc000,
-0x9c3,
-0x8025,
-0x40c1,
-0x1600,
-0x708d,
-0x8000,
-0x58,
-0xd6f,
-0x1030,
-0x716f,
-0x1600,
-0x7080,
-0x8000,
-0x65,
-0x2544,
-0x108e,
-0xb8e3,
-0x40c3,
-0x8000,
-0x7cf,
-0x8802,
-0x23ca,
-0x30a1,
-0x2544,
-0x104f,
-0xc040,
-0xf01b,
-0x209a,
-0x4,
-0x2553,
-0x1041,
-0x7905,
-0x40c1,
-0xf82b,
-0xc000,
-0xf824,
-0xef07,
-0xc000,
-0x4263,
-0x790f,
-0xf36,
-0xfdaf,
-0x700c,
-0xee08,
-0xc000,
-0x4263,
-0x790f,
-0xf2a,
-0xfdaf,
-0x710c,
-0xc000,
-0x7104,
-0xc040,
-0x40c3,
-0x8000,
-0x7cf,
-0x8823,
-0xc000,
-0x9c3,
-0x8025,
-0x40e1,
-0x1600,
-0x708e,
-0x8000,
-0x4,
-0xfaa,
-0xfdcf,
-0xfb2,
-0xfdef,
-0x4508,
-0x4100,
-0xcfe,
-0xffef,
-0x40a1,
-0x261a,
-0x1f8c,
-0x20,
-0x0,
-0x43c3,
-0x9008,
-0x1ea,
-0x9300,
-0x45cb,
-0x9012,
-0x402,
-0x2405,
-0x1342,
-0x2004,
-0xf81,
-0x0,
-0x3f00,
-0xb220,
-0x6d44,
-0x7a85,
-0x2196,
-0x6,
-0xb220,
-0x9321,
-0x6d02,
-0x7885,
-0xb9c5,
-0xb020,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf81,
-0x9002,
-0x154,
-0x9100,
-0x7845,
-0xb100,
-0x7ee0,
-0x209a,
-0x4,
-0x7905,
-0x4063,
-0x209a,
-0x10,
-0x2105,
-0x2,
-0x7ee0,
-0x78e0,
-0xc2e2,
-0xc1a4,
-0x1600,
-0x7080,
-0x8000,
-0x6e1,
-0x702c,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb08,
-0x4528,
-0xc142,
-0xc141,
-0x8f2,
-0xfd6f,
-0xc140,
-0x1600,
-0x7080,
-0x8000,
-0x6e1,
-0xd910,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb0c,
-0xc542,
-0xc541,
-0x8d6,
-0xfd6f,
-0xc540,
-0xd8ff,
-0xd980,
-0x754c,
-0x726c,
-0xc543,
-0xc542,
-0xc541,
-0x8c2,
-0xfd6f,
-0xc540,
-0xc0a4,
-0xc6c2,
-0x78e0,
-0xc2e4,
-0xc1a4,
-0x70ad,
-0xd8ff,
-0x702c,
-0x754c,
-0x736c,
-0xc543,
-0xc542,
-0xc541,
-0x8a2,
-0xfd6f,
-0xc540,
-0x46cb,
-0x8000,
-0x6e1,
-0x8e00,
-0x825,
-0xb4,
-0x702c,
-0x7104,
-0x781d,
-0xb862,
-0x780f,
-0xc043,
-0xd8ff,
-0x754c,
-0x726c,
-0xc542,
-0xc541,
-0x87a,
-0xfd6f,
-0xc540,
-0x8e00,
-0xc043,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb08,
-0xc542,
-0xc541,
-0x866,
-0xfd6f,
-0xc540,
-0x8e00,
-0xd908,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb0c,
-0xc542,
-0xc541,
-0x84e,
-0xfd6f,
-0xc540,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0x42c3,
-0x9004,
-0x110,
-0x9200,
-0x204f,
-0x101,
-0xb8a4,
-0xb220,
-0x7fe0,
-0xb200,
-0xc0e6,
-0x215f,
-0x483,
-0x44cb,
-0x8000,
-0x6e2,
-0x638d,
-0x6479,
-0x89c1,
-0x7d04,
-0x702c,
-0xf009,
-0x629a,
-0x8ae3,
-0x809,
-0x3ce,
-0x8a42,
-0x7d45,
-0x7124,
-0x9f5,
-0x83a4,
-0x2314,
-0x42,
-0x40a1,
-0xc4c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3d09,
-0xc044,
-0x206f,
-0x243,
-0x8820,
-0x1054,
-0x83,
-0x1021,
-0x8d,
-0x10fd,
-0x808e,
-0x1209,
-0x308b,
-0x1208,
-0x308f,
-0xc149,
-0x2400,
-0x3f80,
-0x0,
-0x10c,
-0x702c,
-0x8ce,
-0xfeef,
-0xdab4,
-0xc096,
-0x8c6,
-0xfeef,
-0xdab4,
-0xbee2,
-0x6f01,
-0xc046,
-0x20df,
-0x3e1,
-0x70cd,
-0x7ba5,
-0xc046,
-0xc004,
-0x43d9,
-0xc34d,
-0x2078,
-0x141,
-0xb882,
-0x2078,
-0x100,
-0x7905,
-0xc004,
-0x2078,
-0xc0,
-0xc04c,
-0x7825,
-0xc04a,
-0xc004,
-0x2079,
-0x180,
-0xc04e,
-0xc004,
-0xb869,
-0xc04b,
-0xc009,
-0x201a,
-0xf80,
-0x10,
-0x0,
-0xc04f,
-0x2378,
-0x1000,
-0x28d,
-0x20,
-0xc048,
-0x4300,
-0x2644,
-0x17c0,
-0xc10a,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7b7b,
-0xaea,
-0xfd6f,
-0x40c1,
-0xc047,
-0xc00d,
-0x7b0b,
-0x266,
-0x1,
-0xc004,
-0xb880,
-0x2078,
-0x141,
-0xc00c,
-0x7825,
-0xc050,
-0x215,
-0x20,
-0x700c,
-0xc110,
-0x704c,
-0xe5e,
-0xfe6f,
-0xc045,
-0x7014,
-0x1f6,
-0x21,
-0x70ed,
-0x40c3,
-0x8000,
-0x7c9,
-0xa8c1,
-0xc004,
-0xb863,
-0x7214,
-0xa28,
-0xfd45,
-0x4508,
-0xf79a,
-0xc004,
-0x831,
-0x1b1,
-0x70ad,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x265a,
-0x1641,
-0x205f,
-0xc80,
-0x6038,
-0x2032,
-0xf8d,
-0x8000,
-0x67f,
-0x7dbd,
-0x7dbd,
-0x7dbd,
-0x7dbd,
-0x7dbd,
-0x7dbd,
-0x7dbd,
-0x2456,
-0x3e00,
-0x702c,
-0xfda,
-0xfeaf,
-0xdab4,
-0xc004,
-0x7614,
-0x164,
-0xd,
-0xc004,
-0x706f,
-0x2025,
-0x0,
-0xf025,
-0xf02b,
-0xf02f,
-0xf033,
-0xf003,
-0xf003,
-0xf034,
-0xc096,
-0xc043,
-0x2400,
-0x3f80,
-0x0,
-0x10c,
-0xc042,
-0x2456,
-0x3e00,
-0xc041,
-0xc008,
-0x70b5,
-0x238a,
-0xfc7,
-0xc040,
-0xd8ff,
-0x23ca,
-0x1,
-0xc004,
-0xc106,
-0x7514,
-0x23ca,
-0x31a1,
-0x40c1,
-0xd7e,
-0xfeef,
-0x4263,
-0xdf8c,
-0x716f,
-0xf088,
-0xc005,
-0xe0e,
-0xffaf,
-0x2456,
-0x3e01,
-0xf09d,
-0xc005,
-0xf36,
-0xa0,
-0x2456,
-0x3e01,
-0xf097,
-0xac6,
-0xa0,
-0xc005,
-0xf093,
-0x40c1,
-0xf5e,
-0xff6f,
-0x41a1,
-0xf08f,
-0x1e00,
-0x76c4,
-0x900f,
-0xe022,
-0xc096,
-0xc042,
-0x2400,
-0x3f80,
-0x0,
-0x10c,
-0xc106,
-0xc308,
-0xc041,
-0x2456,
-0x3e00,
-0xc040,
-0x40c1,
-0xd96,
-0x20,
-0x704c,
-0x716f,
-0xdcf,
-0x1030,
-0xdfc0,
-0x40c3,
-0x8000,
-0x7c9,
-0x8825,
-0x40c3,
-0x8000,
-0x7c9,
-0x8844,
-0x225f,
-0x243,
-0xf02d,
-0x260a,
-0x30c0,
-0xf025,
-0x20f5,
-0x78d,
-0xdf1b,
-0x2640,
-0x305e,
-0x78bc,
-0x781c,
-0x781c,
-0x781c,
-0xbf61,
-0xfff,
-0x9031,
-0x781d,
-0x651f,
-0xbfc4,
-0x7f02,
-0x2d44,
-0x1800,
-0x6ca1,
-0x249a,
-0x1008,
-0x209a,
-0x10,
-0x7f05,
-0x221a,
-0xf80,
-0x0,
-0x2000,
-0x7885,
-0x2005,
-0xf80,
-0x9002,
-0x64,
-0xb0e0,
-0x44a9,
-0xcbd,
-0x9234,
-0x2456,
-0x3e00,
-0x7144,
-0xe309,
-0x9ab,
-0x80a5,
-0x708d,
-0xc005,
-0x45cb,
-0x8000,
-0x67c,
-0x41a1,
-0x704c,
-0xae2,
-0xfe6f,
-0x716c,
-0xc096,
-0xc042,
-0x2400,
-0x3f80,
-0x0,
-0x10c,
-0xc106,
-0xc308,
-0xc041,
-0x2456,
-0x3e00,
-0xc040,
-0x40c1,
-0xce6,
-0x20,
-0x714c,
-0xc005,
-0x41a1,
-0x704c,
-0xab6,
-0xfe6f,
-0x706c,
-0xdfc0,
-0xc004,
-0x815,
-0x370,
-0x456b,
-0xc004,
-0x80d,
-0x1b0,
-0x456b,
-0xf006,
-0x71ad,
-0xc005,
-0xfea,
-0xfdaf,
-0xc191,
-0x706f,
-0xed0d,
-0xc007,
-0xc20e,
-0x2456,
-0x3e01,
-0x671f,
-0xc00f,
-0x716c,
-0x84a,
-0xa0,
-0x78e5,
-0x43b9,
-0x1600,
-0x7080,
-0x8000,
-0x7c9,
-0x7104,
-0x1e00,
-0x7002,
-0x8000,
-0x7c9,
-0x780f,
-0x7114,
-0x5e8,
-0xffee,
-0x78cf,
-0xd56,
-0xfd6f,
-0x730c,
-0xca09,
-0xe895,
-0xc004,
-0x811,
-0xf1,
-0x79cf,
-0xcba,
-0xfd6f,
-0xc007,
-0xf00d,
-0xc00b,
-0x817,
-0x134,
-0x7bcf,
-0xc00a,
-0xc109,
-0xc207,
-0xbf2,
-0xfd6f,
-0x2052,
-0x0,
-0x71c5,
-0x72d5,
-0x57a,
-0xffe5,
-0x710c,
-0xc004,
-0x819,
-0xd1,
-0xca09,
-0xe888,
-0x1600,
-0x7080,
-0x8000,
-0x0,
-0xb8e5,
-0xcb8,
-0xfd42,
-0x1e00,
-0x7003,
-0x8000,
-0xf,
-0x2480,
-0x3d09,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b1,
-0xc050,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xc046,
-0xe96,
-0xfdef,
-0x4020,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xb72,
-0xfdef,
-0x4300,
-0xd80f,
-0xfca,
-0xfd2f,
-0xd90f,
-0x47cb,
-0x9003,
-0xe004,
-0x1f22,
-0x1015,
-0x208a,
-0xfc7,
-0x1fa7,
-0x101c,
-0x1fa8,
-0x101c,
-0x710c,
-0xd9ff,
-0xb700,
-0x1ffe,
-0x9004,
-0xb705,
-0x922,
-0xffef,
-0x1ffc,
-0x9004,
-0x46cb,
-0x8000,
-0x7c9,
-0x8e04,
-0xc048,
-0x206f,
-0x243,
-0x10fd,
-0x809e,
-0x265f,
-0x3100,
-0x780d,
-0x791c,
-0x793c,
-0x793c,
-0x793c,
-0x793c,
-0xc008,
-0x793c,
-0x793c,
-0x7824,
-0xc041,
-0x8e05,
-0xc04d,
-0x7824,
-0xc04e,
-0xc006,
-0x201a,
-0xf80,
-0x10,
-0x0,
-0xc044,
-0x8e03,
-0xc04c,
-0x8e02,
-0x25f,
-0x20,
-0xc04b,
-0xe13,
-0x315e,
-0xc001,
-0xae05,
-0xae04,
-0x781b,
-0xae02,
-0x7104,
-0xae03,
-0x70ad,
-0x770c,
-0x716f,
-0xc042,
-0xf0d0,
-0x2344,
-0x37c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0x1e01,
-0x16c2,
-0x205a,
-0x100,
-0x200f,
-0x6c2,
-0x8e00,
-0xe806,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0xf006,
-0x1600,
-0x7081,
-0x8000,
-0x25,
-0x784f,
-0x790b,
-0xc04a,
-0xf2b3,
-0x202f,
-0x6c7,
-0x41c3,
-0x8000,
-0x67c,
-0x714c,
-0x706c,
-0x8ee,
-0xfe6f,
-0xc04f,
-0xc00a,
-0x702c,
-0xd1e,
-0xfeef,
-0x714c,
-0x700c,
-0xb52,
-0xfd2f,
-0x712c,
-0x700c,
-0xc049,
-0xf003,
-0x71a5,
-0xe59f,
-0x10c,
-0x9,
-0xc006,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x2005,
-0xf80,
-0x9005,
-0xe040,
-0xb0a0,
-0x206f,
-0x243,
-0x10fd,
-0x8080,
-0x82b,
-0x15f,
-0x8e25,
-0x8e44,
-0xf00e,
-0x221a,
-0xf83,
-0x0,
-0x1000,
-0xc004,
-0x7144,
-0x7865,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0xb0a0,
-0x9e7,
-0x8085,
-0xf00e,
-0xc001,
-0x201a,
-0xf81,
-0x0,
-0x1000,
-0xc004,
-0x7825,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0xb0a0,
-0x8ce,
-0xfeaf,
-0xd814,
-0xa9e,
-0xff8f,
-0xc010,
-0x712c,
-0xad2,
-0xfd2f,
-0x7810,
-0x8e04,
-0xc043,
-0x700c,
-0xc047,
-0xf034,
-0xc003,
-0x704c,
-0x201a,
-0xf81,
-0x0,
-0x2000,
-0x2105,
-0xf80,
-0x9002,
-0x170,
-0x9000,
-0xc245,
-0xf011,
-0x209a,
-0x8,
-0x7825,
-0x2005,
-0xf80,
-0x9002,
-0x166,
-0x9000,
-0xe806,
-0xc005,
-0x7810,
-0x200f,
-0x80,
-0xc045,
-0x7144,
-0xae5,
-0x8234,
-0x4040,
-0xc005,
-0x262f,
-0xf008,
-0xf40b,
-0xc303,
-0x740c,
-0x41c3,
-0xe,
-0x3,
-0x4263,
-0xe96,
-0xfd2f,
-0xc540,
-0xc105,
-0xc007,
-0x7825,
-0xc047,
-0xc003,
-0x7104,
-0xc043,
-0x8e25,
-0xc003,
-0x997,
-0x8025,
-0xd80f,
-0xdda,
-0xfd2f,
-0xd90f,
-0xc007,
-0x262f,
-0xf008,
-0xf580,
-0xc002,
-0x2008,
-0x340,
-0xc042,
-0x710c,
-0xc049,
-0xc009,
-0x41c3,
-0x11,
-0x1,
-0x8ea,
-0xfcef,
-0x4263,
-0xf8e,
-0xfe6f,
-0xc00a,
-0xc00f,
-0x41c3,
-0x8000,
-0x67c,
-0x704c,
-0xfa2,
-0xfe2f,
-0x706c,
-0xc502,
-0x7767,
-0x7077,
-0x664,
-0xffea,
-0x710c,
-0xc002,
-0x41c3,
-0x13,
-0x0,
-0x7812,
-0x202f,
-0xd,
-0x8b6,
-0xfcef,
-0xb8c0,
-0xc006,
-0x1600,
-0x7081,
-0x8000,
-0x16,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x2005,
-0xf82,
-0x9005,
-0xe040,
-0xc002,
-0x6038,
-0x2049,
-0x7c1,
-0xb220,
-0x206f,
-0x243,
-0x10fd,
-0x809e,
-0xe37,
-0x315f,
-0x8e65,
-0x8e44,
-0xf00e,
-0x221a,
-0xf8c,
-0x0,
-0x1000,
-0xc004,
-0x7144,
-0x7885,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0xb020,
-0xbe7,
-0x8085,
-0x962,
-0xff8f,
-0x206f,
-0x243,
-0x10fd,
-0x809e,
-0xf00e,
-0xc001,
-0x201a,
-0xf82,
-0x0,
-0x1000,
-0xc004,
-0x7845,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0xb020,
-0xc001,
-0x7104,
-0xc041,
-0xc101,
-0xc00e,
-0x7110,
-0x5a4,
-0xffce,
-0xe15,
-0x315e,
-0xc00d,
-0xae05,
-0xc008,
-0xae04,
-0xc00c,
-0xae03,
-0xc00b,
-0xae02,
-0x700c,
-0x1fa7,
-0x101c,
-0x1fa8,
-0x101c,
-0xb700,
-0xc0b1,
-0x1404,
-0x341b,
-0xc6c6,
-0x208c,
-0x8fc3,
-0xf209,
-0x821,
-0x1d1,
-0x41c3,
-0x9004,
-0x238,
-0x1900,
-0x45,
-0xf006,
-0x41c3,
-0x9004,
-0x238,
-0x1900,
-0x105,
-0x1900,
-0x5,
-0x1209,
-0x3081,
-0xe903,
-0x19,
-0x0,
-0x41c3,
-0x9018,
-0x64,
-0xb100,
-0x55,
-0x20,
-0x1902,
-0x5,
-0x78e0,
-0xc2e2,
-0x4508,
-0xca09,
-0xe812,
-0xcc22,
-0x208c,
-0x8010,
-0xf785,
-0xfc2,
-0xfd0f,
-0xcc22,
-0x2615,
-0x7001,
-0x8000,
-0x8e8,
-0x7104,
-0xa1a0,
-0x1a22,
-0x301c,
-0xc6c2,
-0x41c3,
-0x9018,
-0x64,
-0xb1a0,
-0x40a1,
-0xdd10,
-0xbd61,
-0xd01,
-0x1031,
-0x781d,
-0xb102,
-0x80e,
-0x20,
-0x1902,
-0x5,
-0xc6c2,
-0x41c3,
-0x9018,
-0x8,
-0x9100,
-0x8ff,
-0x801f,
-0x195e,
-0x45,
-0x9100,
-0x801,
-0x1e,
-0x7ee0,
-0xc2e6,
-0x4708,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x83b,
-0x13f,
-0x4528,
-0xca09,
-0x7ef0,
-0xe80a,
-0xcc22,
-0x218a,
-0x10,
-0x7902,
-0x6e02,
-0x7030,
-0xf4c,
-0xfd0a,
-0xf3a,
-0xffef,
-0xd808,
-0xf76,
-0xffef,
-0x40e1,
-0x70ed,
-0xf007,
-0xf6a,
-0xffef,
-0x1504,
-0x1400,
-0x71e5,
-0xff9,
-0x9384,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3109,
-0xc352,
-0xc245,
-0xc154,
-0x4318,
-0x206f,
-0x243,
-0x88a0,
-0x10fc,
-0x808e,
-0x1600,
-0x710f,
-0x9008,
-0x1e0,
-0x4063,
-0xc06,
-0xfd2f,
-0x702c,
-0xc050,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xf46,
-0xfdaf,
-0x4300,
-0x40c3,
-0x0,
-0xff7f,
-0x78e4,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0x2400,
-0x3f80,
-0x0,
-0x1e4,
-0x41c3,
-0x8000,
-0x44d,
-0xde6,
-0xfcaf,
-0xda60,
-0x2400,
-0x3f80,
-0x0,
-0x1e4,
-0xae2,
-0x60,
-0xd960,
-0x716c,
-0x4060,
-0x2344,
-0x37cf,
-0xef05,
-0xbf61,
-0xfff,
-0x9031,
-0x781b,
-0x7edd,
-0x205a,
-0x100,
-0x7edd,
-0x7edd,
-0x7edd,
-0x200f,
-0x6c2,
-0xc005,
-0x7edd,
-0x7edd,
-0xe807,
-0xd8ff,
-0x1e00,
-0x7004,
-0x9003,
-0xf0c4,
-0xf016,
-0x700c,
-0xf011,
-0x2044,
-0x7c1,
-0xe906,
-0xb961,
-0x901,
-0x31,
-0x7c9b,
-0x6821,
-0x209a,
-0x8,
-0x2005,
-0xf80,
-0x9003,
-0xe0c4,
-0xb080,
-0x4020,
-0x8e3,
-0x8234,
-0x4468,
-0x1498,
-0x3600,
-0x251a,
-0x1f8d,
-0x10,
-0x0,
-0x7bc6,
-0xc04d,
-0x1497,
-0x3600,
-0x702c,
-0xc34c,
-0xc04e,
-0x1496,
-0x3600,
-0xc551,
-0xc04f,
-0x784f,
-0x704c,
-0x926,
-0xfeef,
-0xc053,
-0x702c,
-0xc14a,
-0xf00c,
-0x7a3b,
-0x7014,
-0x2400,
-0x3f80,
-0x0,
-0x1c4,
-0x22ce,
-0x21,
-0x6038,
-0xa840,
-0x7124,
-0x9eb,
-0x8434,
-0x2144,
-0x40,
-0x40c3,
-0x8000,
-0x7cd,
-0x1600,
-0x709e,
-0x8000,
-0x7cd,
-0x8881,
-0x250a,
-0x1780,
-0xf047,
-0x706c,
-0xf042,
-0xc010,
-0x2055,
-0xc01,
-0xc011,
-0x7825,
-0x261a,
-0x1f81,
-0x0,
-0x1000,
-0x7905,
-0x4060,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0x90e0,
-0xc005,
-0x2378,
-0x201,
-0x2079,
-0x0,
-0x2007,
-0x807e,
-0xf427,
-0x78fd,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0xbfc4,
-0x702c,
-0xe807,
-0x4100,
-0x219a,
-0x10,
-0x2180,
-0x30,
-0x79e5,
-0x265f,
-0x148b,
-0x2456,
-0x3882,
-0x7261,
-0x7a74,
-0xb220,
-0x41c3,
-0x0,
-0x141f,
-0x813,
-0x150,
-0x209a,
-0x10,
-0x2080,
-0x10,
-0x2005,
-0x3c1,
-0xc097,
-0x7061,
-0x7874,
-0xb020,
-0x7164,
-0xb7f,
-0x8254,
-0x71a5,
-0x7eaf,
-0xc73,
-0x93a5,
-0x218a,
-0x4,
-0xc005,
-0x71ad,
-0x7014,
-0xd8ff,
-0xc049,
-0x703c,
-0xc049,
-0x265f,
-0x3240,
-0xc044,
-0xc005,
-0x2079,
-0x0,
-0xc055,
-0x205f,
-0x200,
-0xc047,
-0xf0df,
-0xc109,
-0x8d2,
-0x60,
-0x2456,
-0x3880,
-0xd80f,
-0x9e2,
-0xfd2f,
-0xd90f,
-0x710c,
-0xb5a,
-0xffaf,
-0xd9ff,
-0x46cb,
-0x9003,
-0xe024,
-0x70ad,
-0x1e00,
-0x1f84,
-0x0,
-0xffff,
-0xb606,
-0x1efe,
-0x9004,
-0x1ea8,
-0x135c,
-0x1ea9,
-0x135c,
-0xc014,
-0x712c,
-0xe020,
-0x7810,
-0xe26,
-0xfcef,
-0x4318,
-0xc015,
-0x712c,
-0x68e1,
-0xc00e,
-0xcc6,
-0xff6f,
-0x42e1,
-0xc109,
-0x87e,
-0x60,
-0xc097,
-0xd80f,
-0x992,
-0xfd2f,
-0xd90f,
-0x730c,
-0xb0a,
-0xffaf,
-0xd9ff,
-0x712c,
-0x4063,
-0x1e00,
-0x1f84,
-0x0,
-0xffff,
-0xb626,
-0x1efe,
-0x9044,
-0x1ea8,
-0x135c,
-0xde6,
-0xfcef,
-0x1ea9,
-0x135c,
-0xc00d,
-0x712c,
-0xc86,
-0xff6f,
-0x42e1,
-0xc00a,
-0x780f,
-0xc056,
-0xe08f,
-0xc00c,
-0x20ca,
-0x61,
-0xc04c,
-0x1600,
-0x7080,
-0x8000,
-0x7cd,
-0xc04b,
-0xc004,
-0xc046,
-0xf075,
-0xc106,
-0xc007,
-0xc607,
-0x6119,
-0xc146,
-0x722c,
-0xf068,
-0xc006,
-0xe17,
-0x1231,
-0x7a10,
-0xc005,
-0xe887,
-0xc00f,
-0x7854,
-0x10f0,
-0x8102,
-0xb040,
-0xf058,
-0xc00e,
-0x20f5,
-0x83,
-0xc00d,
-0x20f5,
-0x8c,
-0x4c70,
-0x2048,
-0x0,
-0x7f0e,
-0xf8d,
-0x11b3,
-0x730c,
-0x203c,
-0x39b,
-0x991,
-0x6e0,
-0x43c1,
-0xc00c,
-0xc208,
-0x41c3,
-0x14,
-0x3,
-0x780f,
-0x2078,
-0x0,
-0xc16,
-0xfcaf,
-0xc740,
-0xc010,
-0x4363,
-0x2055,
-0x8c1,
-0xc011,
-0x7905,
-0xc008,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x7905,
-0x4063,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0x2005,
-0xf8d,
-0x9002,
-0x0,
-0x9540,
-0xc016,
-0x2400,
-0x3f81,
-0x0,
-0x1c4,
-0x2133,
-0x1,
-0xc240,
-0x6158,
-0x780e,
-0xc208,
-0xc042,
-0x2048,
-0x0,
-0xc141,
-0x2049,
-0x80f,
-0x740c,
-0x41c3,
-0x15,
-0x6,
-0x926,
-0xfd2f,
-0xc743,
-0xb5e0,
-0x71ad,
-0x4163,
-0xf00a,
-0xc00f,
-0x2014,
-0x82,
-0x6478,
-0x781c,
-0x2048,
-0x0,
-0xb200,
-0xc006,
-0x71c5,
-0x7104,
-0xc046,
-0xe33,
-0x9254,
-0xc00b,
-0x7104,
-0xc04b,
-0xc00b,
-0x780f,
-0xc048,
-0x40c3,
-0x8000,
-0x7cd,
-0x8821,
-0xc008,
-0x90d,
-0x8025,
-0x70b5,
-0xbe0,
-0xfe82,
-0xc00a,
-0x7104,
-0xc04a,
-0x70b5,
-0xf522,
-0xc012,
-0x881,
-0x30,
-0x740c,
-0x41c3,
-0x16,
-0x0,
-0x8c2,
-0xfd0f,
-0x1600,
-0x708e,
-0x8000,
-0x7cd,
-0xf02d,
-0xc004,
-0xc707,
-0x7910,
-0xc007,
-0x6038,
-0xc044,
-0xf024,
-0xf09,
-0x1211,
-0xc005,
-0xe81c,
-0xc004,
-0x781b,
-0x2004,
-0xf81,
-0x1,
-0xfffe,
-0xc00e,
-0x2035,
-0x43,
-0xc00d,
-0x2035,
-0x42,
-0xc00f,
-0x2035,
-0x40,
-0xc241,
-0xc340,
-0xc042,
-0x740c,
-0x41c3,
-0x17,
-0x5,
-0x42a1,
-0x872,
-0xfd2f,
-0x43e1,
-0xc004,
-0x71e5,
-0x7104,
-0xc044,
-0xfbd,
-0x9254,
-0x71c5,
-0x40c3,
-0x8000,
-0x7cd,
-0x8801,
-0x7dcf,
-0x89f,
-0x8345,
-0x98a,
-0xfe6f,
-0xc013,
-0x1e00,
-0x7005,
-0x9003,
-0xe004,
-0x2480,
-0x3109,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0x4508,
-0x205f,
-0x641,
-0x40c3,
-0x8000,
-0x7c9,
-0x8800,
-0x4358,
-0x205f,
-0xc80,
-0x6038,
-0x2000,
-0xf80,
-0x8000,
-0x67c,
-0x88e2,
-0x700c,
-0xb4e,
-0xfcef,
-0x702c,
-0x710c,
-0x2544,
-0x17ca,
-0xa11,
-0x1010,
-0x2242,
-0x104a,
-0xaff,
-0x9031,
-0x781b,
-0x7077,
-0x205a,
-0x100,
-0x702c,
-0x27cf,
-0x11e2,
-0x734c,
-0x200f,
-0x340,
-0x780f,
-0xc042,
-0xd8ff,
-0xdb22,
-0x4628,
-0xc143,
-0x1c04,
-0x3081,
-0xdfa,
-0xfcef,
-0xc740,
-0xd8ff,
-0xd980,
-0x754c,
-0x726c,
-0xc643,
-0xc642,
-0xc641,
-0xbd6,
-0xfcef,
-0xc640,
-0x700c,
-0xb8e,
-0xfcef,
-0x712c,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0x4528,
-0x9d2,
-0xfdaf,
-0x4708,
-0x4608,
-0x700c,
-0xad2,
-0xfcef,
-0xd908,
-0x706f,
-0xd8ff,
-0x702c,
-0x704c,
-0xdb28,
-0x1c0c,
-0x36c0,
-0xc742,
-0x1c04,
-0x36c0,
-0xb92,
-0xfcef,
-0x1c00,
-0x36c0,
-0xdd6,
-0xfcef,
-0xd8ff,
-0xe62e,
-0xed18,
-0xf836,
-0x1c0c,
-0x36c0,
-0xc742,
-0x1c04,
-0x36c0,
-0xb72,
-0xfcef,
-0x1c00,
-0x36c0,
-0xd8ff,
-0xd90c,
-0x714c,
-0xdb0a,
-0x1c0c,
-0x36c0,
-0xc742,
-0x1c04,
-0x36c0,
-0x1c00,
-0x36c0,
-0xf00a,
-0x1c0c,
-0x3041,
-0xc742,
-0x1c04,
-0x36c0,
-0x1c00,
-0x36c0,
-0xf828,
-0xb42,
-0xfccf,
-0xd8ff,
-0x702c,
-0x714c,
-0xdb08,
-0x1c0c,
-0x36c0,
-0xc742,
-0x1c04,
-0x36c0,
-0xb2e,
-0xfcef,
-0x1c00,
-0x36c0,
-0x70ad,
-0x7bcf,
-0xd8ff,
-0xd90c,
-0x714c,
-0xc543,
-0xc742,
-0xc541,
-0xb16,
-0xfcef,
-0xc540,
-0xd8ff,
-0x702c,
-0x754c,
-0x726c,
-0x1c0c,
-0x30c1,
-0xc542,
-0xc541,
-0xafe,
-0xfcef,
-0xc540,
-0x702c,
-0xd8ff,
-0xb98f,
-0x754c,
-0x746c,
-0x1c0c,
-0x3041,
-0xc542,
-0xc541,
-0xae6,
-0xfcef,
-0xc540,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb10,
-0xc543,
-0xc542,
-0xc541,
-0xad2,
-0xfcef,
-0xc540,
-0xcfe,
-0xfcef,
-0xd8ff,
-0xbfc1,
-0xd8ff,
-0xd980,
-0x764c,
-0x746c,
-0xc543,
-0xc742,
-0xc541,
-0xab6,
-0xfcef,
-0x1c00,
-0x3041,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0xd8ff,
-0xd90c,
-0x714c,
-0xdb08,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a8,
-0xc145,
-0x4318,
-0x700c,
-0xd9ff,
-0xc346,
-0x9b2,
-0xfcef,
-0xc244,
-0xc00d,
-0x70cd,
-0x70ad,
-0xc047,
-0xf03a,
-0x2532,
-0x1f8f,
-0x8000,
-0x624,
-0x702c,
-0x896,
-0xfcaf,
-0x42e1,
-0xc207,
-0x7944,
-0xc206,
-0x7844,
-0x2005,
-0x807e,
-0xf42b,
-0xc005,
-0x702c,
-0x734c,
-0xdb22,
-0x60e8,
-0x1c0c,
-0x3001,
-0x1c08,
-0x36c0,
-0xc040,
-0xd8ff,
-0xc56,
-0xfcef,
-0xc741,
-0xd07,
-0x1190,
-0xed99,
-0x70b5,
-0xd9c8,
-0xd8fa,
-0xa5e,
-0xfe2f,
-0x20ca,
-0x41,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x780f,
-0xc043,
-0x700c,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0x702c,
-0x754c,
-0xc1e,
-0xfcef,
-0xdb20,
-0x71a5,
-0xd8f,
-0x9334,
-0x710c,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb41,
-0x1c0c,
-0x3401,
-0xc642,
-0xc641,
-0x9f2,
-0xfcef,
-0xc640,
-0xd8ff,
-0xd980,
-0x754c,
-0x746c,
-0xc643,
-0xc642,
-0xc641,
-0x9de,
-0xfcef,
-0xc640,
-0x700c,
-0x996,
-0xfcef,
-0x712c,
-0xc004,
-0xe833,
-0x700c,
-0x8f2,
-0xfcef,
-0xd9ff,
-0xd84f,
-0x70ad,
-0x2353,
-0x305b,
-0xc040,
-0xf817,
-0xc543,
-0x1c08,
-0x36c0,
-0x9b2,
-0xfcef,
-0xc541,
-0x700c,
-0x96a,
-0xfcef,
-0x712c,
-0x40c3,
-0xf,
-0x4240,
-0xfa6,
-0xfe2f,
-0x702c,
-0x700c,
-0x8be,
-0xfcef,
-0xd9ff,
-0xd851,
-0xc040,
-0xf80b,
-0xc543,
-0x1c08,
-0x36c0,
-0x982,
-0xfcef,
-0xc541,
-0x700c,
-0x93a,
-0xfcef,
-0x712c,
-0x40c3,
-0x0,
-0x1f40,
-0xf76,
-0xfe2f,
-0xd91e,
-0xc0a8,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0xd980,
-0xda17,
-0x746c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ac,
-0xc349,
-0xc247,
-0xc14a,
-0xc5e,
-0xfd2f,
-0xc046,
-0xc011,
-0x71ed,
-0xc04b,
-0xc012,
-0xc048,
-0xd8ff,
-0xc044,
-0x700c,
-0xc045,
-0xf0b8,
-0xc005,
-0x2032,
-0xf9b,
-0x8000,
-0x624,
-0xc00a,
-0x2032,
-0x6ce,
-0xc004,
-0x780f,
-0x208c,
-0x8fc3,
-0xf40b,
-0x40c3,
-0x0,
-0xa00,
-0x832,
-0xfcef,
-0xd9ff,
-0x852,
-0xff8f,
-0x700c,
-0xc044,
-0x41e1,
-0x2344,
-0x37c0,
-0xc209,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x793b,
-0xd81f,
-0x7a24,
-0xb861,
-0x801,
-0x31,
-0x793c,
-0xc00b,
-0x7824,
-0x2205,
-0x803e,
-0xf479,
-0x78dd,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x18d,
-0xc008,
-0xe80b,
-0xf87e,
-0xc043,
-0x700c,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0x8b6,
-0xfcef,
-0xdb20,
-0xc004,
-0x702c,
-0x704c,
-0x7104,
-0xc044,
-0x40c3,
-0x8000,
-0x6e0,
-0x8801,
-0x726c,
-0xc741,
-0xc043,
-0xc006,
-0xc540,
-0xc042,
-0x892,
-0xfcef,
-0xd8ff,
-0x40c3,
-0x8000,
-0x6e0,
-0x8801,
-0x70ad,
-0x2353,
-0x315b,
-0xc043,
-0xf869,
-0xc542,
-0xc741,
-0x876,
-0xfcef,
-0x1c00,
-0x36c0,
-0xf868,
-0xc043,
-0xc006,
-0x726c,
-0xc741,
-0xc042,
-0x78dd,
-0x2044,
-0x800,
-0x2045,
-0x580,
-0xc040,
-0x856,
-0xfcef,
-0xd8ff,
-0x40c3,
-0x8000,
-0x6e0,
-0x8801,
-0xbec5,
-0x702c,
-0xc043,
-0xd8ff,
-0x704c,
-0x726c,
-0xc542,
-0xc741,
-0x83a,
-0xfcef,
-0xc640,
-0xc005,
-0xe819,
-0x40c3,
-0x0,
-0x2710,
-0xe52,
-0xfe2f,
-0xd90a,
-0x781d,
-0x781d,
-0x7704,
-0x7e0f,
-0xf850,
-0xc542,
-0xc541,
-0xc540,
-0x812,
-0xfcef,
-0xc643,
-0xf84d,
-0xc643,
-0xc542,
-0xc541,
-0xc540,
-0xf00d,
-0x40c3,
-0x8000,
-0x6e0,
-0x8801,
-0xc542,
-0xc541,
-0xc043,
-0xc540,
-0xd8ff,
-0x702c,
-0x704c,
-0xdb18,
-0xfea,
-0xfc8f,
-0xc004,
-0x790f,
-0x90f,
-0x110,
-0xc005,
-0x817,
-0x2d1,
-0xe909,
-0xeca,
-0xff4f,
-0x700c,
-0xf8e,
-0xfcaf,
-0x712c,
-0xd8ff,
-0xc044,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0xe08c,
-0x690,
-0xffc5,
-0xc007,
-0x8cf,
-0x30,
-0xd9ff,
-0x47cb,
-0x0,
-0xa00,
-0xed2,
-0xfcaf,
-0x40e1,
-0xeee,
-0xff4f,
-0x46cb,
-0x8000,
-0x6e1,
-0x8e00,
-0x702c,
-0x234a,
-0x3800,
-0xc043,
-0xc006,
-0x704c,
-0x726c,
-0xc042,
-0xd8ff,
-0x4528,
-0xc141,
-0xf82,
-0xfcaf,
-0x1c00,
-0x36c0,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0xf6a,
-0xfcaf,
-0x1c00,
-0x33c1,
-0xe56,
-0xff4f,
-0x700c,
-0xf1a,
-0xfcaf,
-0x712c,
-0x40c3,
-0xf,
-0x4240,
-0xd56,
-0xfe2f,
-0x702c,
-0x40e1,
-0xe6e,
-0xfcaf,
-0xd9ff,
-0xe8e,
-0xff4f,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xc006,
-0x726c,
-0xc541,
-0xc042,
-0xd8ff,
-0xf2a,
-0xfcaf,
-0x1c00,
-0x36c0,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0xf12,
-0xfcaf,
-0x1c00,
-0x3441,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb10,
-0xc542,
-0xc541,
-0xefa,
-0xfcaf,
-0xc540,
-0xdea,
-0xff4f,
-0x700c,
-0xeae,
-0xfcaf,
-0x712c,
-0xc06,
-0xfd0f,
-0xc0ac,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x726c,
-0x7ee0,
-0x78e0,
-0x40c3,
-0x8000,
-0x6e0,
-0x8801,
-0x702c,
-0x704c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a9,
-0xc145,
-0xd958,
-0xb99f,
-0xc046,
-0x8900,
-0x11cd,
-0x808f,
-0x70ad,
-0xc047,
-0xc00e,
-0x71cd,
-0xc343,
-0xc244,
-0xc048,
-0xf058,
-0x2544,
-0x17c1,
-0x706f,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0xc042,
-0xf04b,
-0xc007,
-0xc202,
-0xc108,
-0x7077,
-0x20ca,
-0x3c1,
-0x7944,
-0x790b,
-0xf242,
-0xc002,
-0x2344,
-0x37c1,
-0x262f,
-0x3007,
-0x40c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0xe9e,
-0xfcef,
-0x780f,
-0x40c3,
-0x8000,
-0x6e0,
-0x8800,
-0xe81c,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x831,
-0xdf,
-0xc003,
-0x235a,
-0x3c81,
-0x265f,
-0x3102,
-0xc040,
-0xc006,
-0xc304,
-0x1c04,
-0x3001,
-0x6119,
-0x255a,
-0x1640,
-0x6119,
-0xc002,
-0x7845,
-0xc205,
-0xcce,
-0xffef,
-0x780f,
-0xf014,
-0xc003,
-0x235a,
-0x3c81,
-0x265f,
-0x3102,
-0xc040,
-0xc006,
-0xc304,
-0x6119,
-0x255a,
-0x1640,
-0x6119,
-0xc002,
-0x7845,
-0xc205,
-0xb62,
-0xffef,
-0x780f,
-0x7167,
-0xb6f,
-0xb094,
-0x71a5,
-0xd53,
-0x90b4,
-0x40c1,
-0xe26,
-0xfcef,
-0x730c,
-0xc0a9,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x43c3,
-0x8000,
-0x7cd,
-0x8b80,
-0x8ba1,
-0x245f,
-0x1482,
-0x6058,
-0xf017,
-0x921,
-0xee,
-0x4260,
-0x229a,
-0x8,
-0x261a,
-0x1f8f,
-0x0,
-0x2000,
-0x7ae5,
-0x2205,
-0xf8f,
-0x9002,
-0x64,
-0x9040,
-0xb740,
-0x7164,
-0x7204,
-0xbdd,
-0x8254,
-0x7185,
-0x7e8f,
-0xdf9,
-0x93a5,
-0x706c,
-0xc7e,
-0xfe4f,
-0xc6c6,
-0xc2e2,
-0x219a,
-0x1,
-0x239a,
-0x1,
-0x44cb,
-0x9008,
-0x100,
-0x7825,
-0x1600,
-0x7081,
-0x8000,
-0x4,
-0x7b45,
-0x211a,
-0xf8d,
-0x20,
-0x0,
-0x2505,
-0x1301,
-0xb100,
-0x6c02,
-0x78a5,
-0xb060,
-0x700c,
-0xd1a,
-0xfcaf,
-0x712c,
-0xc6c2,
-0x78e0,
-0xc2e2,
-0x260a,
-0x3040,
-0x4308,
-0x70ad,
-0xf024,
-0x255a,
-0x1182,
-0x7261,
-0x8a01,
-0x8a60,
-0x8a22,
-0x209a,
-0x4,
-0x7b05,
-0x8a03,
-0x209a,
-0x4,
-0x7825,
-0x201a,
-0xf80,
-0x1,
-0x0,
-0x2005,
-0xc1,
-0x8a05,
-0x8a64,
-0x7734,
-0x209a,
-0x4,
-0x7865,
-0xf207,
-0x793b,
-0xb99c,
-0xb99f,
-0xb100,
-0xf003,
-0xab6,
-0xfe0f,
-0x71a5,
-0x2e45,
-0x3180,
-0xdb9,
-0x9004,
-0xc6c2,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x4718,
-0x40c3,
-0x8000,
-0x7cd,
-0x88c0,
-0x4338,
-0xc340,
-0xea04,
-0x79db,
-0xf004,
-0x265f,
-0x1241,
-0x1001,
-0x9e,
-0x7054,
-0xdd08,
-0x25ca,
-0x1062,
-0xf039,
-0x40e1,
-0x209a,
-0x4,
-0xc300,
-0x23f5,
-0x3042,
-0xeb13,
-0x7c5c,
-0x7c9c,
-0x7c9c,
-0x7c9c,
-0x224a,
-0x16c0,
-0x2a44,
-0x803,
-0x2242,
-0x104a,
-0xafd,
-0x9031,
-0x7c9d,
-0x629a,
-0xbac4,
-0x4a94,
-0xf00d,
-0x248a,
-0x1fcf,
-0x7c44,
-0x2204,
-0xf83,
-0x0,
-0xfc00,
-0xda0a,
-0xba61,
-0xaff,
-0x8031,
-0x7b7d,
-0x261a,
-0x1f82,
-0x0,
-0x1000,
-0x239a,
-0x1,
-0x71e5,
-0x7124,
-0x2205,
-0x7c2,
-0x7845,
-0x781b,
-0xb891,
-0xb89c,
-0x7b85,
-0xb89f,
-0xb060,
-0xd97,
-0x93c5,
-0x71c5,
-0xefd,
-0xb3a5,
-0x70ed,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x7014,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0x43c3,
-0x40,
-0x1800,
-0x4568,
-0x7dc0,
-0x42c3,
-0x8000,
-0x688,
-0x82f,
-0x3e,
-0x706f,
-0x41c3,
-0x8000,
-0x7d3,
-0x8904,
-0xe80f,
-0x8900,
-0x44cb,
-0x8000,
-0x6ba,
-0xaa00,
-0x8901,
-0xaa19,
-0x8902,
-0xac00,
-0x8903,
-0xac19,
-0x2350,
-0x300,
-0x7d04,
-0x2242,
-0x30e,
-0x40c1,
-0xf06,
-0xff2f,
-0xd90d,
-0x40c1,
-0xd90d,
-0xcbe,
-0xfdef,
-0xda40,
-0x40c1,
-0xd90d,
-0xe8e,
-0xfcaf,
-0xda7f,
-0xdfff,
-0x40c1,
-0x702c,
-0x42a1,
-0x4363,
-0xd12,
-0xffef,
-0xc740,
-0x40c1,
-0xd90d,
-0xc9a,
-0xfdef,
-0xda80,
-0x40c1,
-0x702c,
-0x42c3,
-0xffff,
-0xdfff,
-0x776c,
-0xcf6,
-0xffef,
-0xc740,
-0x40c1,
-0xabe,
-0xff2f,
-0xd90d,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3403,
-0x702c,
-0xf22,
-0xfcaf,
-0x4508,
-0xc042,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xc22,
-0x20,
-0xc041,
-0x40a1,
-0xe0e,
-0xfd2f,
-0x2455,
-0x3bc1,
-0x71ed,
-0x40e1,
-0x2544,
-0x17ce,
-0xee05,
-0xbe61,
-0xeff,
-0x9031,
-0x781b,
-0x205a,
-0x100,
-0x200f,
-0x340,
-0xd7e,
-0xfd6f,
-0x780f,
-0x702c,
-0x40c3,
-0x9003,
-0xfe64,
-0x1e00,
-0x7044,
-0x9003,
-0xfe64,
-0x1882,
-0x5c,
-0x208a,
-0x808,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0x1e00,
-0x73c4,
-0x900f,
-0xe0c0,
-0x1e00,
-0x7044,
-0x9003,
-0xfe64,
-0xf010,
-0x6941,
-0x219a,
-0x8,
-0x43e1,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7b7b,
-0x2105,
-0xf80,
-0x9003,
-0xe0c4,
-0xb060,
-0x4140,
-0x9e3,
-0x8234,
-0x2144,
-0x7c0,
-0x45cb,
-0x0,
-0xaaaa,
-0xd80f,
-0x41a1,
-0x42a1,
-0x43a1,
-0x98e,
-0xfd6f,
-0xc540,
-0xd80f,
-0xe2a,
-0xfcaf,
-0xd90f,
-0x40c3,
-0x0,
-0xf00,
-0xe82,
-0xff2f,
-0x712c,
-0x46cb,
-0x9003,
-0xe174,
-0x700c,
-0xb600,
-0x208a,
-0xfc7,
-0xb601,
-0x43db,
-0x0,
-0xffff,
-0xd830,
-0x1e58,
-0x96dc,
-0x1e5e,
-0x93dc,
-0xa6e,
-0xfcaf,
-0x1e57,
-0x93dc,
-0xd80f,
-0x702c,
-0x704c,
-0x4363,
-0x942,
-0xfd6f,
-0x1c00,
-0x36c0,
-0x740c,
-0xa56,
-0xfcaf,
-0x712c,
-0xd80f,
-0x41a1,
-0x42a1,
-0x43a1,
-0x92a,
-0xfd6f,
-0xc540,
-0x700c,
-0xb600,
-0xb601,
-0xd820,
-0x1e58,
-0x901c,
-0x208a,
-0x844,
-0x1e5e,
-0x93dc,
-0x1e57,
-0x901c,
-0x40c3,
-0x0,
-0xf00,
-0xe0e,
-0xff2f,
-0x732c,
-0xd830,
-0xa1a,
-0xfcaf,
-0x712c,
-0xc001,
-0x1600,
-0x7082,
-0x8000,
-0x7cd,
-0x201a,
-0xf80,
-0x10,
-0x0,
-0xc043,
-0x40c3,
-0x8000,
-0x7cd,
-0x8821,
-0xf022,
-0x700c,
-0x2016,
-0x83,
-0xf01a,
-0x209a,
-0x8,
-0x221a,
-0xf8c,
-0x0,
-0x2000,
-0x7885,
-0x2005,
-0xf80,
-0x9002,
-0x64,
-0x9000,
-0x7c1d,
-0x7c9d,
-0x7c9d,
-0x7c9d,
-0x7c9d,
-0xb8c4,
-0x7c05,
-0xc087,
-0x7874,
-0xb080,
-0x7164,
-0x40e1,
-0x8d1,
-0x8234,
-0x68e1,
-0x7144,
-0x9c1,
-0x80a5,
-0x208a,
-0xfc7,
-0xb600,
-0x70ed,
-0x710c,
-0xb6e1,
-0x1e58,
-0x96dc,
-0x1e5e,
-0x901c,
-0x1e57,
-0x901c,
-0x208a,
-0x7d0,
-0x1e00,
-0x7004,
-0x9003,
-0xfe64,
-0xd830,
-0x98e,
-0xfcaf,
-0x712c,
-0xd80f,
-0x702c,
-0x704c,
-0x4363,
-0x862,
-0xfd6f,
-0x1c00,
-0x36c0,
-0x740c,
-0x976,
-0xfcaf,
-0x712c,
-0xd80f,
-0x41a1,
-0x42a1,
-0x43a1,
-0x84a,
-0xfd6f,
-0xc540,
-0x40c3,
-0x0,
-0xf00,
-0x712c,
-0xb6e0,
-0xd42,
-0xff2f,
-0xb6e1,
-0xd820,
-0x1e58,
-0x901c,
-0x710c,
-0x1e5e,
-0x901c,
-0x208a,
-0x844,
-0x1e57,
-0x901c,
-0x93e,
-0xfcaf,
-0xd830,
-0x40c3,
-0x8000,
-0x7cd,
-0x8801,
-0x1600,
-0x708b,
-0x8000,
-0x7cd,
-0xc046,
-0xf084,
-0x231a,
-0x1f80,
-0x0,
-0x1000,
-0x2716,
-0x12de,
-0x704c,
-0xc044,
-0xc104,
-0xc003,
-0x7825,
-0xc045,
-0xc002,
-0x2055,
-0xd01,
-0xc005,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0x9000,
-0xb8c4,
-0xc041,
-0xf05d,
-0x4340,
-0x239a,
-0x4,
-0xc004,
-0x7865,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x64,
-0x9000,
-0x791d,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0xb8c4,
-0x7905,
-0xc087,
-0x20f5,
-0x79f,
-0x2455,
-0x3bc0,
-0x20f4,
-0x2cc,
-0xc001,
-0x71f3,
-0x2400,
-0x101b,
-0x27d4,
-0x3829,
-0x71e3,
-0x2340,
-0x340c,
-0x782e,
-0x791c,
-0x7c8e,
-0x4528,
-0x792e,
-0x4990,
-0x2154,
-0x801,
-0x272f,
-0x3009,
-0x4990,
-0x7811,
-0x8f1,
-0x87c2,
-0x208a,
-0x3f,
-0x4891,
-0x78ae,
-0x6119,
-0x272f,
-0x3049,
-0x4891,
-0x7931,
-0x2000,
-0xf8d,
-0x0,
-0xffc0,
-0xfe7,
-0xb042,
-0x2048,
-0x1,
-0x783b,
-0x2084,
-0x7,
-0xb9c4,
-0x7905,
-0xc002,
-0xc405,
-0x2055,
-0xc00,
-0x7c05,
-0x7b85,
-0x787b,
-0xb891,
-0xb89c,
-0xb89f,
-0xa15,
-0x1f1,
-0xb020,
-0x789b,
-0x2005,
-0xf80,
-0x9002,
-0x1000,
-0xb020,
-0x7144,
-0x2640,
-0x305e,
-0xa4b,
-0x8214,
-0x231a,
-0x1f80,
-0x0,
-0x2000,
-0x7165,
-0x2005,
-0xf81,
-0x9002,
-0x1e64,
-0xc001,
-0xb100,
-0xc006,
-0x230c,
-0x9000,
-0x6f8,
-0xffee,
-0xd8ff,
-0x1e58,
-0x901c,
-0x712c,
-0x40c3,
-0x0,
-0xf00,
-0x4528,
-0x1e5e,
-0x905c,
-0xbee,
-0xff2f,
-0x1e57,
-0x905c,
-0xf26,
-0xfe0f,
-0x40c3,
-0x9003,
-0xfe64,
-0x1e00,
-0x73c4,
-0x9003,
-0xe004,
-0x1e00,
-0x7344,
-0x900f,
-0xe0c0,
-0x1e00,
-0x73c4,
-0x9003,
-0xfec4,
-0x1882,
-0x3dc,
-0xd80f,
-0xb5a,
-0xfcaf,
-0xd90f,
-0x41c3,
-0x0,
-0xffff,
-0xd80f,
-0x704c,
-0x4320,
-0xea2,
-0xfd2f,
-0xc740,
-0xf03b,
-0x700c,
-0xfb6,
-0xfc6f,
-0x712c,
-0x40c3,
-0x8000,
-0x7cd,
-0x8821,
-0x1600,
-0x7082,
-0x8000,
-0x7cd,
-0xf023,
-0x221a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x166,
-0x9060,
-0xeb17,
-0xc002,
-0x2055,
-0xd0c,
-0xc003,
-0x7c05,
-0x221a,
-0xf80,
-0x0,
-0x1000,
-0x7885,
-0x781b,
-0x2005,
-0xf8c,
-0x9002,
-0x1e00,
-0xb891,
-0xb89c,
-0xb89f,
-0x9000,
-0x2055,
-0x800,
-0xb400,
-0x657d,
-0x7144,
-0x9bf,
-0x80a5,
-0xd80f,
-0xada,
-0xfcaf,
-0xd90f,
-0xe7a,
-0xfe0f,
-0x71e5,
-0x41a1,
-0xf91,
-0x9234,
-0x70ad,
-0x2178,
-0x0,
-0x41c3,
-0x156,
-0x0,
-0xdf2,
-0xfc0f,
-0x1e00,
-0x7005,
-0x9003,
-0xe004,
-0x2480,
-0x3403,
-0x1404,
-0x341b,
-0xc6c6,
-0xc0f1,
-0x2482,
-0x3302,
-0xc080,
-0x41c3,
-0x8000,
-0x597,
-0xcfe,
-0xfc2f,
-0xda8a,
-0xc080,
-0x9fe,
-0xffef,
-0xd98a,
-0xd80f,
-0xa8a,
-0xfcaf,
-0xd90f,
-0x2480,
-0x3302,
-0xc0d1,
-0x7ee0,
-0xc3e6,
-0xc1b2,
-0xc14a,
-0xc045,
-0x712c,
-0xb8c4,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x793b,
-0x215a,
-0x101,
-0xc005,
-0x210f,
-0x0,
-0xc046,
-0xc005,
-0xaa2,
-0xfcaf,
-0x702c,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0xd2a,
-0xfd2f,
-0x4608,
-0x208c,
-0x8e82,
-0x70ed,
-0xd8fe,
-0xc044,
-0xf707,
-0xd16,
-0xfd0f,
-0x2054,
-0x880,
-0xc044,
-0x251a,
-0x1f8d,
-0x10,
-0x0,
-0x710c,
-0xc18d,
-0xd12,
-0xfdaf,
-0xc54b,
-0xf76,
-0xffcf,
-0x45cb,
-0x9003,
-0xe002,
-0xd840,
-0x1d00,
-0x1f84,
-0x0,
-0x8000,
-0xd1e,
-0xfcaf,
-0xb512,
-0x1600,
-0x7100,
-0x9004,
-0x4a,
-0xd998,
-0x2011,
-0x8380,
-0xd8aa,
-0x21ca,
-0x1,
-0x40c3,
-0x9005,
-0xe04c,
-0xc049,
-0x189c,
-0x54,
-0xc049,
-0xc005,
-0x46cb,
-0x9008,
-0x0,
-0x712c,
-0x781b,
-0x2056,
-0xe00,
-0x78c5,
-0x9000,
-0xc047,
-0x16e9,
-0x1700,
-0xc048,
-0xda2,
-0xfc6f,
-0x208a,
-0x4,
-0x1200,
-0x3083,
-0xd8ff,
-0x702c,
-0x754c,
-0xc743,
-0xc742,
-0xc741,
-0xe62,
-0xfc6f,
-0xc740,
-0xc006,
-0x724c,
-0xc743,
-0x780f,
-0xc046,
-0xc042,
-0xc004,
-0xc741,
-0xc740,
-0x2044,
-0x41,
-0x6038,
-0x780f,
-0xc044,
-0xc304,
-0xd980,
-0xd8ff,
-0xe3a,
-0xfc6f,
-0xb990,
-0x700c,
-0xdf2,
-0xfc6f,
-0x712c,
-0xc005,
-0x9de,
-0xffaf,
-0x714c,
-0x16f0,
-0x1700,
-0x46cb,
-0x9009,
-0xe1e0,
-0x41c3,
-0x0,
-0xf00,
-0xc04c,
-0xb888,
-0xb600,
-0xc007,
-0x209a,
-0x4,
-0xc047,
-0x2004,
-0x42,
-0xc008,
-0x7932,
-0x7824,
-0x7845,
-0xc048,
-0xb887,
-0x1ef2,
-0x9004,
-0xc109,
-0x710c,
-0xc0a,
-0xfd2f,
-0xb100,
-0xc047,
-0x208a,
-0x4,
-0xd0a,
-0xfc6f,
-0x712c,
-0x1200,
-0x3083,
-0xd8ff,
-0x702c,
-0x754c,
-0xc743,
-0xc742,
-0xc741,
-0xdce,
-0xfc6f,
-0xc740,
-0x812,
-0xfcaf,
-0xd8ff,
-0xc006,
-0xc304,
-0x724c,
-0xc042,
-0x700c,
-0xb88f,
-0x791b,
-0xd8ff,
-0xc743,
-0xc741,
-0xdae,
-0xfc6f,
-0xc740,
-0xc007,
-0x714c,
-0xc743,
-0x2044,
-0x41,
-0x6038,
-0xe01e,
-0x7b0f,
-0xd8ff,
-0x742c,
-0xc742,
-0xc741,
-0xd8e,
-0xfc6f,
-0xc740,
-0x710c,
-0x702c,
-0xc043,
-0xd8ff,
-0xb98f,
-0x754c,
-0x746c,
-0xc742,
-0xc741,
-0xd76,
-0xfc6f,
-0xc740,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb10,
-0xc743,
-0xc742,
-0xc741,
-0xd62,
-0xfc6f,
-0xc740,
-0xf8e,
-0xfc6f,
-0xd8ff,
-0xf838,
-0xc743,
-0xc742,
-0xc741,
-0xd4e,
-0xfc6f,
-0xc740,
-0x40c3,
-0x0,
-0x6210,
-0xb501,
-0x730c,
-0xcfe,
-0xfc6f,
-0x712c,
-0x208a,
-0x408,
-0xb501,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x80b,
-0xbf,
-0x208a,
-0x606,
-0xf002,
-0xd833,
-0xcde,
-0xfc6f,
-0x712c,
-0xc008,
-0x704c,
-0x1ef2,
-0x9004,
-0x8c6,
-0xffaf,
-0xc005,
-0x700c,
-0xb42,
-0xfdaf,
-0xc18d,
-0x70ed,
-0x208a,
-0x4,
-0x712c,
-0xb5e0,
-0xc22,
-0xfc6f,
-0xb5f2,
-0x1200,
-0x3083,
-0xd8ff,
-0x702c,
-0x754c,
-0xc743,
-0xc742,
-0xc741,
-0xce2,
-0xfc6f,
-0xc740,
-0xc006,
-0xc304,
-0x702c,
-0xc042,
-0xd8ff,
-0xb990,
-0x724c,
-0xc743,
-0xc741,
-0xcca,
-0xfc6f,
-0xc740,
-0xf814,
-0xc743,
-0xc742,
-0xc741,
-0xcbe,
-0xfc6f,
-0xc740,
-0x700c,
-0xc76,
-0xfc6f,
-0x712c,
-0xc00c,
-0x702c,
-0x704c,
-0xb600,
-0xc009,
-0xb0e0,
-0xb5e1,
-0xb0e,
-0xfeef,
-0xc00a,
-0xc005,
-0x82e,
-0xfcaf,
-0x702c,
-0xc10b,
-0x2055,
-0xd00,
-0x714c,
-0x7825,
-0xc10a,
-0xf96,
-0xffaf,
-0x706c,
-0xb6e,
-0xfe0f,
-0xc02,
-0xfecf,
-0xc7c6,
-0xd8ff,
-0xd980,
-0x754c,
-0x746c,
-0x7ee0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
+static const u8 dccm_1d_lz4[] = {
+	0xe6, 0x01, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0xd7,
+	0x01, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x02, 0x92, 0x0e, 0x02,
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1f, 0x13, 0x04, 0x00, 0x00,
+	0x00, 0x03, 0x16, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x21,
+	0x00, 0x10, 0x06, 0x00, 0x00, 0x13, 0x00, 0x00, 0x04, 0x00, 0xc8, 0x64,
+	0x36, 0x33, 0x00, 0x24, 0x4d, 0x08, 0x54, 0x00, 0x00, 0x06, 0x00, 0x0c,
+	0x00, 0x00, 0x1c, 0x00, 0x05, 0x04, 0x00, 0x0f, 0x33, 0x00, 0x20, 0x05,
+	0x3c, 0x00, 0x0f, 0x09, 0x00, 0xff, 0xff, 0xff, 0x67, 0x11, 0xff, 0x78,
+	0x03, 0xf1, 0x04, 0x4a, 0x01, 0x81, 0x01, 0x18, 0x01, 0x18, 0x01, 0x6f,
+	0x01, 0x6f, 0x01, 0x59, 0x01, 0x81, 0x01, 0x20, 0x01, 0x20, 0xfe, 0x03,
+	0xf0, 0x05, 0x1c, 0x70, 0xa8, 0x61, 0xac, 0x35, 0xac, 0x35, 0x5c, 0x12,
+	0x5c, 0x12, 0x38, 0xc7, 0xf4, 0xb0, 0x90, 0x65, 0x90, 0x65, 0x31, 0x00,
+	0x30, 0x38, 0x9f, 0x58, 0x07, 0x00, 0x80, 0x00, 0x20, 0x28, 0x0f, 0x14,
+	0x02, 0x1f, 0xf0, 0x2c, 0x00, 0x72, 0xb4, 0xff, 0x01, 0x00, 0x01, 0x00,
+	0xb4, 0x0c, 0x00, 0x10, 0xf4, 0x12, 0x00, 0x11, 0xb9, 0x0c, 0x00, 0x11,
+	0xba, 0x06, 0x00, 0x11, 0xbb, 0x06, 0x00, 0x11, 0x01, 0x06, 0x00, 0x11,
+	0x13, 0x06, 0x00, 0x70, 0xf9, 0xf0, 0x04, 0x00, 0x00, 0x02, 0xfa, 0x06,
+	0x00, 0x20, 0x00, 0xfb, 0x06, 0x00, 0xf0, 0x00, 0x04, 0x60, 0xf0, 0x07,
+	0x00, 0x08, 0x00, 0x65, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x62, 0xff, 0x42,
+	0x00, 0x5f, 0x02, 0xf0, 0x01, 0x00, 0x20, 0x60, 0x00, 0x1e, 0x20, 0x11,
+	0xf0, 0x8a, 0x00, 0x10, 0x12, 0x66, 0x00, 0x21, 0xf0, 0x18, 0x0c, 0x00,
+	0x0f, 0x72, 0x00, 0x05, 0x02, 0x66, 0x00, 0xc0, 0x62, 0xf0, 0x01, 0x00,
+	0x0f, 0x00, 0x62, 0xf4, 0x01, 0x00, 0xf0, 0x00, 0x72, 0x00, 0x13, 0x04,
+	0x72, 0x00, 0x71, 0x3b, 0xf0, 0x02, 0x00, 0x01, 0x00, 0xb2, 0x8a, 0x00,
+	0x11, 0xb2, 0x48, 0x00, 0x08, 0xe4, 0x00, 0x0f, 0xde, 0x00, 0x05, 0x00,
+	0xc6, 0x00, 0x11, 0x01, 0xc6, 0x00, 0x40, 0xff, 0x01, 0x26, 0xff, 0xcc,
+	0x00, 0x11, 0x27, 0x06, 0x00, 0x00, 0x84, 0x00, 0x30, 0x02, 0x00, 0x32,
+	0x4e, 0x00, 0x16, 0x08, 0x78, 0x00, 0x11, 0x01, 0x78, 0x00, 0x11, 0x01,
+	0x78, 0x00, 0x13, 0x08, 0x78, 0x00, 0x08, 0x72, 0x00, 0x20, 0xb2, 0xf4,
+	0xcc, 0x00, 0x08, 0x78, 0x00, 0x1f, 0xb4, 0x5c, 0x01, 0x04, 0x01, 0xf6,
+	0x00, 0x10, 0x01, 0xf6, 0x00, 0x22, 0x01, 0x00, 0x6c, 0x00, 0x02, 0xfc,
+	0x00, 0x0c, 0x90, 0x00, 0x20, 0xff, 0xff, 0x90, 0x00, 0x2c, 0xff, 0xff,
+	0x84, 0x00, 0x13, 0x10, 0x9c, 0x00, 0x00, 0x02, 0x01, 0x10, 0x10, 0x18,
+	0x06, 0xf0, 0x1f, 0x0d, 0x02, 0x01, 0x03, 0x0b, 0x0c, 0x0e, 0x16, 0x04,
+	0x10, 0x11, 0x18, 0x06, 0x0c, 0x10, 0x16, 0x1c, 0x20, 0x24, 0x28, 0x06,
+	0x0c, 0x12, 0x18, 0x1e, 0x24, 0x28, 0x2c, 0x06, 0x0a, 0x0e, 0x14, 0x18,
+	0x1c, 0x20, 0x24, 0x06, 0x0a, 0x10, 0x16, 0x1a, 0x20, 0x24, 0x28, 0x6e,
+	0x00, 0x2b, 0x01, 0x80, 0xfd, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x60, 0x00,
+	0xf5, 0x00, 0xf0, 0x0b, 0xe8, 0x00, 0x04, 0x00, 0xff, 0x00, 0xfc, 0x00,
+	0x04, 0x00, 0x04, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x11, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
-const short int dccm_array[830] = {
-0x0,
-0x0,
-0x0,
-0xe92,
-0x2,
-0x0,
-0x17,
-0x0,
-0x131f,
-0x4,
-0x0,
-0x3,
-0x0,
-0x100,
-0x0,
-0x100,
-0x0,
-0x0,
-0x110,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x3664,
-0x33,
-0x4d24,
-0x5408,
-0x0,
-0x6,
-0x3664,
-0x33,
-0x4d24,
-0x5408,
-0x0,
-0x6,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x1000,
-0x1,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x6400,
-0x3336,
-0x2400,
-0x84d,
-0x54,
-0x600,
-0x6400,
-0x3336,
-0x2400,
-0x84d,
-0x54,
-0x600,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0xff,
-0x0,
-0x0,
-0x14a,
-0x181,
-0x118,
-0x118,
-0x16f,
-0x16f,
-0x159,
-0x181,
-0x120,
-0x120,
-0x0,
-0x0,
-0x701c,
-0x61a8,
-0x35ac,
-0x35ac,
-0x125c,
-0x125c,
-0xc738,
-0xb0f4,
-0x6590,
-0x6590,
-0x0,
-0x0,
-0x9f38,
-0x58,
-0x0,
-0x0,
-0x2820,
-0x140f,
-0x1f02,
-0x1f0,
-0x0,
-0xb400,
-0x1ff,
-0x100,
-0xb400,
-0x1f0,
-0x0,
-0xb400,
-0x1f4,
-0x0,
-0xb900,
-0x1f0,
-0x0,
-0xba00,
-0x1f0,
-0x0,
-0xbb00,
-0x1f0,
-0x0,
-0x100,
-0x1f0,
-0x0,
-0x1300,
-0x1f0,
-0x0,
-0xf900,
-0x4f0,
-0x0,
-0xfa02,
-0x4f0,
-0x0,
-0xfb00,
-0x4f0,
-0x0,
-0x6004,
-0x7f0,
-0x800,
-0x6500,
-0x7f0,
-0x0,
-0x6200,
-0x1ff,
-0x0,
-0x200,
-0x1f0,
-0x2000,
-0x1f02,
-0x1f0,
-0x0,
-0xb400,
-0x1ff,
-0x100,
-0xb400,
-0x1f0,
-0x0,
-0xb400,
-0x1f4,
-0x0,
-0xb900,
-0x1f0,
-0x0,
-0xba00,
-0x1f0,
-0x0,
-0xbb00,
-0x1f0,
-0x0,
-0x100,
-0x1f0,
-0x0,
-0x1100,
-0x1f0,
-0x100,
-0x1200,
-0x1f0,
-0x0,
-0x18f0,
-0x1f0,
-0x100,
-0x1300,
-0x1f0,
-0x0,
-0xf900,
-0x4f0,
-0x0,
-0xfa02,
-0x4f0,
-0x0,
-0xfb00,
-0x4f0,
-0x0,
-0x6204,
-0x1ff,
-0x0,
-0x6200,
-0x1f0,
-0xf00,
-0x6200,
-0x1f4,
-0xf000,
-0x200,
-0x1f0,
-0x400,
-0x1f02,
-0x1f0,
-0x0,
-0x3b00,
-0x2f0,
-0x100,
-0xb200,
-0x1ff,
-0x0,
-0xb200,
-0x1f0,
-0x100,
-0xb400,
-0x1ff,
-0x100,
-0xb400,
-0x1f0,
-0x0,
-0xb900,
-0x1f0,
-0x0,
-0xba00,
-0x1f0,
-0x0,
-0xbb00,
-0x1f0,
-0x0,
-0x100,
-0x1f0,
-0x0,
-0x6000,
-0x7f0,
-0x100,
-0x6500,
-0x7f0,
-0xff00,
-0x2601,
-0x7ff,
-0x0,
-0x2700,
-0x7ff,
-0x0,
-0x1300,
-0x1f0,
-0x200,
-0x3200,
-0x1ff,
-0x0,
-0x6208,
-0x1ff,
-0x0,
-0x6200,
-0x1f0,
-0x100,
-0x6200,
-0x1f4,
-0x100,
-0x200,
-0x1f0,
-0x800,
-0x1f02,
-0x1f0,
-0x0,
-0xb200,
-0x1ff,
-0x0,
-0xb200,
-0x1f0,
-0x100,
-0xb200,
-0x1f4,
-0x100,
-0xb400,
-0x1ff,
-0x100,
-0xb400,
-0x1f0,
-0x0,
-0xb400,
-0x1f4,
-0x0,
-0xb900,
-0x1f0,
-0x0,
-0xba00,
-0x1f0,
-0x0,
-0xbb00,
-0x1f0,
-0x0,
-0x1100,
-0x1f0,
-0x100,
-0x1201,
-0x1f0,
-0x100,
-0x1300,
-0x1f0,
-0x200,
-0x1800,
-0x1f0,
-0x100,
-0x6000,
-0x7f0,
-0x100,
-0x6500,
-0x7f0,
-0xff00,
-0x2601,
-0x7ff,
-0xff00,
-0x27ff,
-0x7ff,
-0xff00,
-0x62ff,
-0x1ff,
-0x0,
-0x6200,
-0x1f0,
-0x100,
-0x6200,
-0x1f4,
-0x1000,
-0x3200,
-0x1ff,
-0x0,
-0x208,
-0x1f0,
-0x1000,
-0x2,
-0x0,
-0x20d,
-0x301,
-0xc0b,
-0x160e,
-0x1004,
-0x1811,
-0xc06,
-0x1610,
-0x201c,
-0x2824,
-0xc06,
-0x1812,
-0x241e,
-0x2c28,
-0xa06,
-0x140e,
-0x1c18,
-0x2420,
-0xa06,
-0x1610,
-0x201a,
-0x2824,
-0x6e,
-0x2,
-0x1,
-0xfd,
-0x4,
-0xf,
-0x60,
-0x7,
-0x0,
-0xe8,
-0x4,
-0xff,
-0xfc,
-0x4,
-0x404,
-0x3a,
-0x2,
-0x2,
-0x11,
-0x7,
-0x0,
-0x0,
+static const struct ddr_phy_fw_image dccm_1d = DDR_PHY_FW_IMAGE(dccm_1d_lz4, 830);
+
+static const u8 dccm_2d_lz4[] = {
+	0x91, 0x01, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x82,
+	0x01, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x02, 0x92, 0x0e, 0x02,
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x61, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x03, 0x16, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x01, 0x20, 0x80,
+	0x00, 0x00, 0x10, 0x0a, 0x00, 0x00, 0x12, 0x00, 0x01, 0x04, 0x00, 0xc8,
+	0x64, 0x36, 0x33, 0x00, 0x24, 0x4d, 0x08, 0x54, 0x00, 0x00, 0x06, 0x00,
+	0x0c, 0x00, 0x01, 0x1d, 0x00, 0x04, 0x05, 0x00, 0x0f, 0x33, 0x00, 0x20,
+	0x04, 0x3b, 0x00, 0x0f, 0x08, 0x00, 0xff, 0xff, 0xff, 0x61, 0x19, 0xff,
+	0x72, 0x03, 0x25, 0x01, 0x14, 0x0f, 0x00, 0xf1, 0x04, 0x4a, 0x01, 0x81,
+	0x01, 0x18, 0x01, 0x18, 0x01, 0x6f, 0x01, 0x6f, 0x01, 0x59, 0x01, 0x81,
+	0x01, 0x20, 0x01, 0x20, 0x0a, 0x04, 0xf5, 0x05, 0x1c, 0x70, 0xa8, 0x61,
+	0xac, 0x35, 0xac, 0x35, 0x5c, 0x12, 0x5c, 0x12, 0x38, 0xc7, 0xf4, 0xb0,
+	0x90, 0x65, 0x90, 0x65, 0x35, 0x00, 0x0f, 0x09, 0x00, 0x04, 0xfe, 0x20,
+	0x38, 0x9f, 0x58, 0x00, 0x00, 0x00, 0x1e, 0x32, 0x00, 0x01, 0x00, 0x00,
+	0xff, 0xff, 0xe0, 0x01, 0xf0, 0x00, 0xa0, 0x00, 0x78, 0x00, 0x60, 0x00,
+	0x50, 0x00, 0x43, 0x00, 0x3c, 0x00, 0x35, 0x00, 0x30, 0x00, 0x2c, 0x00,
+	0x28, 0x00, 0x25, 0x00, 0x22, 0x00, 0x20, 0x00, 0x1e, 0x00, 0x1c, 0x46,
+	0x00, 0xf0, 0x0b, 0x01, 0x02, 0x03, 0x06, 0x07, 0x0a, 0x0b, 0x0e, 0x0f,
+	0x1a, 0x1b, 0x1e, 0x1f, 0x3a, 0x3b, 0x3e, 0x3f, 0x00, 0x00, 0x20, 0x28,
+	0x0f, 0x14, 0x02, 0x1f, 0xf0, 0x94, 0x00, 0x72, 0xb4, 0xff, 0x01, 0x00,
+	0x01, 0x00, 0xb4, 0x0c, 0x00, 0x10, 0xf4, 0x12, 0x00, 0x11, 0xb9, 0x0c,
+	0x00, 0x11, 0xba, 0x06, 0x00, 0x11, 0xbb, 0x06, 0x00, 0x11, 0x01, 0x06,
+	0x00, 0x11, 0x13, 0x06, 0x00, 0x70, 0xf9, 0xf0, 0x04, 0x00, 0x00, 0x02,
+	0xfa, 0x06, 0x00, 0x20, 0x00, 0xfb, 0x06, 0x00, 0xf0, 0x00, 0x04, 0x60,
+	0xf0, 0x07, 0x00, 0x08, 0x00, 0x65, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x62,
+	0xff, 0x42, 0x00, 0x50, 0x02, 0xf0, 0x01, 0x00, 0x20, 0x18, 0x05, 0xf0,
+	0x2b, 0x0d, 0x02, 0x01, 0x03, 0x0b, 0x0c, 0x0e, 0x16, 0x04, 0x10, 0x11,
+	0x18, 0x06, 0x0c, 0x10, 0x16, 0x1c, 0x20, 0x24, 0x28, 0x06, 0x0c, 0x12,
+	0x18, 0x1e, 0x24, 0x28, 0x2c, 0x06, 0x0a, 0x0e, 0x14, 0x18, 0x1c, 0x20,
+	0x24, 0x06, 0x0a, 0x10, 0x16, 0x1a, 0x20, 0x24, 0x28, 0x6e, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0xfd, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x60, 0x00, 0x4d,
+	0x00, 0xf0, 0x0b, 0xe8, 0x00, 0x04, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x04,
+	0x00, 0x04, 0x04, 0x3a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x11, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const struct ddr_phy_fw_image dccm_2d = DDR_PHY_FW_IMAGE(dccm_2d_lz4, 702);
+
+static const struct ddr_phy_reg lp4_3733_phy_train1d2d_seq0[] = {
+{0x1005f,0x17f},
+{0x1015f,0x17f},
+{0x1105f,0x17f},
+{0x1115f,0x17f},
+{0x1205f,0x17f},
+{0x1215f,0x17f},
+{0x1305f,0x17f},
+{0x1315f,0x17f},
+{0x55,0x15f},
+{0x1055,0x15f},
+{0x2055,0x15f},
+{0x3055,0x15f},
+{0x4055,0x15f},
+{0x5055,0x15f},
+{0x200c5,0x19},
+{0x2002e,0x2},
+{0x90204,0x0},
+{0x20024,0x1e3},
+{0x2003a,0x2},
+{0x2007d,0x212},
+{0x2007c,0x61},
+{0x20056,0x3},
+{0x1004d,0xe00},
+{0x1014d,0xe00},
+{0x1104d,0xe00},
+{0x1114d,0xe00},
+{0x1204d,0xe00},
+{0x1214d,0xe00},
+{0x1304d,0xe00},
+{0x1314d,0xe00},
+{0x10049,0xe3f},
+{0x10149,0xe3f},
+{0x11049,0xe3f},
+{0x11149,0xe3f},
+{0x12049,0xe3f},
+{0x12149,0xe3f},
+{0x13049,0xe3f},
+{0x13149,0xe3f},
+{0x43,0x7f},
+{0x1043,0x7f},
+{0x2043,0x7f},
+{0x3043,0x7f},
+{0x4043,0x7f},
+{0x5043,0x7f},
+{0x20018,0x3},
+{0x20075,0x4},
+{0x20050,0x11},
+{0x2009b,0x2},
+{0x20008,0x3a5},
+{0x20088,0x9},
+{0x200b2,0x124},
+{0x10043,0x5a1},
+{0x10143,0x5a1},
+{0x11043,0x5a1},
+{0x11143,0x5a1},
+{0x12043,0x5a1},
+{0x12143,0x5a1},
+{0x13043,0x5a1},
+{0x13143,0x5a1},
+{0x200fa,0x1},
+{0x20019,0x1},
+{0x200f0,0x0},
+{0x200f1,0x0},
+{0x200f2,0x4444},
+{0x200f3,0x8888},
+{0x200f4,0x5555},
+{0x200f5,0x0},
+{0x200f6,0x0},
+{0x200f7,0xf000},
+{0x1004a,0x500},
+{0x1104a,0x500},
+{0x1204a,0x500},
+{0x1304a,0x500},
+{0x20025,0x0},
+{0x2002d,0x0},
+{0x2002c,0x0},
+{0x20060,0x2},
 };
-const short int iccm_array1[16384] = {
-0x204,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x50,
-0x0,
-0x2069,
-0x40,
-0x264a,
-0x7000,
-0x264a,
-0x7000,
-0x264a,
-0x7000,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x7054,
-0x7ce0,
-0x4300,
-0x1101,
-0x48c,
-0x2242,
-0x8042,
-0x1b01,
-0x312,
-0xf5fb,
-0x7ee0,
-0x78e0,
-0x1cfc,
-0xb3c8,
-0x1cfc,
-0xb388,
-0x7fe0,
-0x1cfc,
-0xb348,
-0x78e0,
-0x7ee0,
-0x78e0,
-0x748d,
-0xdd0c,
-0xf00c,
-0x78e0,
-0x748d,
-0xdd08,
-0xf009,
-0x78e0,
-0x748d,
-0x74ad,
-0xf006,
-0x78e0,
-0x748d,
-0xf006,
-0xc702,
-0xc601,
-0x24b0,
-0x334d,
-0x24b0,
-0x331f,
-0x7ee0,
-0x78e0,
-0xc5e1,
-0xc6e1,
-0xc7e1,
-0x2107,
-0xcb,
-0x262f,
-0xf040,
-0x704d,
-0x10,
-0x26,
-0x232f,
-0x12c4,
-0x200e,
-0x8280,
-0x2203,
-0x1041,
-0xb19,
-0x7de,
-0x220e,
-0x8282,
-0x2203,
-0x10c3,
-0xf006,
-0x78e0,
-0xc5e1,
-0xc6e1,
-0xc7e1,
-0x706d,
-0x250a,
-0x9080,
-0x23cc,
-0x8021,
-0xf260,
-0x7034,
-0xf20c,
-0x3c,
-0x2b,
-0xdc40,
-0x202f,
-0x8000,
-0x212f,
-0x804b,
-0x7f8,
-0xffe3,
-0xbc61,
-0xf014,
-0xdc20,
-0x210a,
-0x8000,
-0x22ca,
-0x21,
-0x23ca,
-0x21,
-0xf222,
-0x14,
-0x24,
-0x700c,
-0x212f,
-0x8040,
-0xbc61,
-0x7fe,
-0xffe3,
-0x21c0,
-0x8043,
-0x240a,
-0x7300,
-0x260a,
-0x90c0,
-0x704c,
-0x46,
-0x22,
-0x706c,
-0x20a8,
-0x380,
-0x2000,
-0x8000,
-0x2101,
-0x8041,
-0x2201,
-0x8082,
-0x25cc,
-0x9086,
-0x20c0,
-0x6e,
-0x22c2,
-0x34e,
-0x7075,
-0xf22f,
-0xf645,
-0x220e,
-0x8282,
-0x2203,
-0x10c3,
-0x232f,
-0x92c0,
-0x4e,
-0x3,
-0x200e,
-0x8280,
-0x47,
-0x20,
-0x2203,
-0x1041,
-0x20a8,
-0x580,
-0x2000,
-0x8000,
-0x2101,
-0x8041,
-0x2201,
-0x8082,
-0x2301,
-0xc3,
-0x2202,
-0x8342,
-0x2303,
-0x8383,
-0xf746,
-0x2200,
-0x8342,
-0x2301,
-0x8383,
-0x20c0,
-0x66,
-0x7075,
-0x12,
-0x1,
-0xf1da,
-0x4241,
-0x4341,
-0x6a09,
-0x212f,
-0x2,
-0xc7c1,
-0xc6c1,
-0xc5c1,
-0x7ee0,
-0x78e0,
-0x2244,
-0x8ffc,
-0x264a,
-0x7000,
-0x20e8,
-0x1a2,
-0x202f,
-0x8000,
-0x212f,
-0x4b,
-0x7ee0,
-0x78e0,
-0x702c,
-0x704c,
-0x706c,
-0x704d,
-0x706d,
-0x708d,
-0x70ad,
-0x70cd,
-0x70ed,
-0x206a,
-0x280,
-0xb88d,
-0x2029,
-0x8000,
-0x44db,
-0x8000,
-0x4000,
-0x42db,
-0x8000,
-0x400,
-0x706f,
-0x78e0,
-0x2022,
-0xf80,
-0x0,
-0x2548,
-0x2069,
-0x40,
-0x78e0,
-0xf1fe,
-0xc3e1,
-0xc2e1,
-0xc1e1,
-0xc0e1,
-0xc0f1,
-0xc5e1,
-0xc1a1,
-0xe806,
-0x7487,
-0xdc14,
-0x66b,
-0xffcf,
-0xda25,
-0xba9f,
-0x8a60,
-0x1233,
-0x80,
-0x7865,
-0x1aea,
-0x8002,
-0x12ed,
-0x8080,
-0x208c,
-0x8fc3,
-0xf20d,
-0xc085,
-0xc040,
-0x4020,
-0xb9a,
-0x260,
-0xc185,
-0x41c3,
-0x402,
-0x0,
-0xf6e,
-0x20,
-0xd8ff,
-0x70ad,
-0xa3e,
-0x220,
-0x1a10,
-0x3003,
-0xade,
-0x260,
-0xd8ff,
-0x25ab,
-0x10c4,
-0x7fff,
-0xf1ff,
-0x78e0,
-0xb8e6,
-0x781d,
-0x781d,
-0x781d,
-0xb8c2,
-0x742c,
-0xf403,
-0x7914,
-0xf006,
-0x7915,
-0x909,
-0x354,
-0x762c,
-0x7915,
-0x7fe0,
-0x6901,
-0x42c3,
-0x8000,
-0x665,
-0x8a20,
-0x215f,
-0xc81,
-0x6038,
-0x8a21,
-0x215f,
-0x641,
-0x6119,
-0x8903,
-0xb8e6,
-0x8902,
-0x1600,
-0x7081,
-0x8000,
-0x1c,
-0xb8c2,
-0xf409,
-0x7034,
-0x41c3,
-0x8000,
-0x540,
-0xf209,
-0xe108,
-0xf007,
-0x7034,
-0x41c3,
-0x8000,
-0x530,
-0xf203,
-0xe108,
-0x6119,
-0x7fe0,
-0x8900,
-0xc0e2,
-0x2053,
-0x14c,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x2044,
-0x4d,
-0x702c,
-0x704c,
-0xf00b,
-0x1070,
-0x83,
-0xd19,
-0x10e0,
-0x792f,
-0x106e,
-0x80,
-0x7144,
-0x6119,
-0x784f,
-0x8ed,
-0x80b4,
-0x7043,
-0xf003,
-0x6199,
-0x782f,
-0xc4c2,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b6,
-0x4548,
-0xc153,
-0x4200,
-0x750c,
-0x41c3,
-0x186,
-0x1,
-0xe92,
-0x20,
-0xc354,
-0x706f,
-0xf041,
-0x4261,
-0xf015,
-0xc014,
-0x819,
-0xb0,
-0xc08e,
-0xc014,
-0x87f,
-0x71,
-0xc38e,
-0x6548,
-0x7b34,
-0xb300,
-0xf006,
-0x25f4,
-0x1083,
-0x7834,
-0xb060,
-0xc013,
-0x7124,
-0x621a,
-0x9dd,
-0x8294,
-0x4183,
-0x911c,
-0x1446,
-0x3103,
-0x915f,
-0xc055,
-0x1448,
-0x3101,
-0x144a,
-0x3100,
-0x143a,
-0x311f,
-0x143c,
-0x311e,
-0x1440,
-0x310f,
-0x1442,
-0x310e,
-0x1444,
-0x310c,
-0xc346,
-0xc315,
-0xc048,
-0xc147,
-0xc242,
-0x750c,
-0x41c3,
-0x187,
-0xb,
-0xc445,
-0xc644,
-0xc743,
-0x1c04,
-0x3780,
-0x1c00,
-0x37c0,
-0xe12,
-0x20,
-0x4261,
-0x7167,
-0xc013,
-0x232f,
-0x16c8,
-0xb7d,
-0x9024,
-0x702c,
-0xc0b6,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x700c,
-0x1e00,
-0x7004,
-0x9004,
-0x102,
-0x7ee0,
-0xc2e4,
-0x4308,
-0x70ad,
-0x46cb,
-0x9008,
-0x1e4,
-0x218c,
-0x8fc3,
-0xb6a0,
-0xb6a1,
-0xb6a2,
-0xf224,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x201a,
-0xf83,
-0x20,
-0x0,
-0x2305,
-0xf80,
-0x9004,
-0x40,
-0xb020,
-0x40c3,
-0x8000,
-0x669,
-0x8881,
-0x8800,
-0xf00c,
-0x201a,
-0xf82,
-0x0,
-0x2000,
-0x7104,
-0x7a65,
-0x2205,
-0xf82,
-0x9002,
-0x40,
-0xb220,
-0xceb,
-0x9005,
-0x88e,
-0x1c0,
-0x208a,
-0x21a,
-0x41c3,
-0x900e,
-0x2a,
-0x1efc,
-0x92c4,
-0xb100,
-0x40c3,
-0x8000,
-0x4ba,
-0xa8a0,
-0x40c3,
-0x0,
-0xfac,
-0xb101,
-0x700c,
-0xc6c4,
-0x704c,
-0x7210,
-0x20e0,
-0x7ca,
-0x1600,
-0x7101,
-0x9008,
-0x1d6,
-0x9f3,
-0x803e,
-0x7144,
-0x7ee0,
-0xc2e2,
-0x4328,
-0xec6,
-0x60,
-0x260a,
-0x3000,
-0x45cb,
-0x9004,
-0xf2,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0x1e00,
-0x7784,
-0x9008,
-0x1e2,
-0xf36,
-0x120,
-0x760c,
-0xb17,
-0x1030,
-0x1d10,
-0x1045,
-0x40c3,
-0x0,
-0x61a8,
-0xfb6,
-0xffcf,
-0x1d10,
-0x1005,
-0xc6c2,
-0xc2e2,
-0x70ad,
-0xf007,
-0xca11,
-0x7704,
-0xfba,
-0xffef,
-0x7810,
-0x71a5,
-0xc813,
-0xdf3,
-0x9024,
-0x712c,
-0xc6c2,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a6,
-0x260a,
-0x3080,
-0xc20b,
-0xc345,
-0xdb7f,
-0xc040,
-0x7b44,
-0xd84b,
-0x2338,
-0xf,
-0x279a,
-0x1002,
-0xbae6,
-0x208a,
-0x3e,
-0x234f,
-0x4c,
-0x27ca,
-0x1001,
-0xe4cf,
-0x27ca,
-0x1001,
-0xe3d1,
-0x27ca,
-0x1001,
-0xc000,
-0x1600,
-0x7083,
-0x8000,
-0x4ba,
-0x1400,
-0x301f,
-0x208c,
-0x8fc3,
-0xc00e,
-0x2642,
-0x304b,
-0x27ca,
-0x30c1,
-0xc043,
-0xc00d,
-0xc044,
-0xc00c,
-0xb51,
-0x16b5,
-0xc042,
-0xdb50,
-0xc341,
-0xdb20,
-0xd810,
-0xde30,
-0xdd60,
-0x4378,
-0x708d,
-0x2025,
-0x2c0,
-0xf01a,
-0xf01a,
-0xf018,
-0xf018,
-0xf05c,
-0xf019,
-0xf014,
-0xf016,
-0xf045,
-0xf048,
-0xf010,
-0xf010,
-0xf047,
-0xf03b,
-0xf00e,
-0xf00c,
-0xf00a,
-0xf00a,
-0xf008,
-0xf008,
-0xf006,
-0xf006,
-0xf03f,
-0xf034,
-0xf005,
-0xf0a8,
-0x706c,
-0xf003,
-0xdb10,
-0x264c,
-0xb640,
-0x14a,
-0x2d,
-0x4060,
-0x726c,
-0x748d,
-0xc041,
-0x4608,
-0x4318,
-0x4508,
-0x4708,
-0x2025,
-0x780,
-0xf036,
-0xf02c,
-0xf02b,
-0xf017,
-0xf017,
-0xf093,
-0xf099,
-0xf093,
-0xf015,
-0xf019,
-0xf01c,
-0xf091,
-0xf00f,
-0xf01b,
-0xf00f,
-0xf00d,
-0xf089,
-0xf087,
-0xf087,
-0xf085,
-0xf085,
-0xf018,
-0xf017,
-0xf013,
-0xf008,
-0xf006,
-0xdb07,
-0xf012,
-0xc701,
-0x758d,
-0xf018,
-0x758d,
-0x47a9,
-0xf014,
-0x758d,
-0x47c9,
-0xf012,
-0x718d,
-0x476b,
-0xf00e,
-0x768d,
-0xf00b,
-0x708d,
-0xf00a,
-0x736c,
-0xe0d,
-0x30d1,
-0xc402,
-0x249a,
-0x1004,
-0x7a85,
-0x4468,
-0x4708,
-0x238a,
-0xffd,
-0x7b24,
-0x783d,
-0x2044,
-0xc0b,
-0xe3b0,
-0xdb58,
-0x23cf,
-0x11e1,
-0x7b24,
-0x2084,
-0x1,
-0x2305,
-0x2c3,
-0x7885,
-0x7b05,
-0x783d,
-0x239a,
-0x4,
-0x781d,
-0xc405,
-0x781d,
-0x2004,
-0xf80,
-0x0,
-0x2000,
-0x7c05,
-0x7c65,
-0x232f,
-0x17c0,
-0x43c3,
-0x9008,
-0x0,
-0x2305,
-0x10c0,
-0xb080,
-0x4020,
-0x209a,
-0x4,
-0x7154,
-0x2104,
-0xf81,
-0x0,
-0xff00,
-0x2004,
-0xf8c,
-0x0,
-0xf00,
-0xc002,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x7c05,
-0x40e1,
-0x20cf,
-0x1a1,
-0x264c,
-0xb180,
-0x27ca,
-0x1001,
-0xc004,
-0xb8c3,
-0x7f05,
-0x78ef,
-0x7c05,
-0x2354,
-0x1800,
-0x7865,
-0xb080,
-0x2355,
-0x1800,
-0x7865,
-0xb040,
-0xc003,
-0x7905,
-0x2355,
-0x1c00,
-0x7b05,
-0xb320,
-0xc000,
-0x2740,
-0x3041,
-0x208c,
-0x8fc3,
-0xf405,
-0x1e00,
-0x7042,
-0x8000,
-0x4ba,
-0x782f,
-0xc0a6,
-0x1404,
-0x341b,
-0xc6c6,
-0x738d,
-0xdf10,
-0xf19e,
-0x708d,
-0xf19b,
-0x718d,
-0xf199,
-0xdc20,
-0xf197,
-0x758d,
-0xf195,
-0x78e0,
-0xc0f1,
-0xc1a4,
-0xc408,
-0xc443,
-0xc407,
-0xc442,
-0xc406,
-0xc441,
-0xc405,
-0xde2,
-0xffef,
-0xc440,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0x41c3,
-0x8000,
-0x4ba,
-0x8920,
-0x208c,
-0x8fc3,
-0x20ca,
-0x41,
-0x1e00,
-0x7004,
-0x9008,
-0x1e8,
-0x7ee0,
-0x78e0,
-0x41c3,
-0x8000,
-0x4ba,
-0x8920,
-0x208c,
-0x8fc3,
-0x20ca,
-0x41,
-0x1e00,
-0x7004,
-0x9008,
-0x1e6,
-0x7ee0,
-0x78e0,
-0x264a,
-0x3000,
-0xf010,
-0x265a,
-0x3c83,
-0x607c,
-0x235a,
-0x1643,
-0x7165,
-0x639b,
-0x633b,
-0x8b80,
-0x7c44,
-0xab80,
-0xbeb,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0x7ee0,
-0xc0f1,
-0xc1a4,
-0x700c,
-0xc76,
-0xffef,
-0xd9ff,
-0x700c,
-0xc043,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xd988,
-0x754c,
-0xd52,
-0xffef,
-0xdb40,
-0x700c,
-0xcee,
-0xffef,
-0x712c,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4528,
-0x4300,
-0x70ed,
-0x704c,
-0xf006,
-0x8820,
-0x8801,
-0x915,
-0x4,
-0x7144,
-0x784f,
-0x8f7,
-0x87f4,
-0x2314,
-0x0,
-0x704c,
-0xd91e,
-0xf009,
-0x2314,
-0x0,
-0x8880,
-0x8801,
-0xc0f,
-0x1004,
-0x7724,
-0x202f,
-0x8047,
-0xf5f8,
-0xf002,
-0x4728,
-0x78ef,
-0xc040,
-0x784f,
-0x264a,
-0x3000,
-0xdeff,
-0x4718,
-0x4318,
-0x706d,
-0xf013,
-0x8821,
-0x8880,
-0xca14,
-0xe80a,
-0xca66,
-0x7410,
-0xca67,
-0x90d,
-0x21,
-0x23c0,
-0x1061,
-0x7165,
-0x2108,
-0x79e,
-0x2409,
-0x138e,
-0x71e7,
-0xc000,
-0x8dd,
-0x87e5,
-0x2314,
-0x7c0,
-0x1600,
-0x7080,
-0x8000,
-0xe,
-0xc041,
-0x133f,
-0x80,
-0xe00f,
-0xad00,
-0x780f,
-0x8c6,
-0x60,
-0x2314,
-0x0,
-0x2340,
-0x30c1,
-0xad22,
-0xad01,
-0x6a03,
-0x780f,
-0x8b2,
-0x60,
-0x2314,
-0x0,
-0xc100,
-0xb963,
-0xad24,
-0xad03,
-0x6f0b,
-0x780f,
-0x89e,
-0x60,
-0x2314,
-0x0,
-0xad05,
-0x1215,
-0x3603,
-0xc816,
-0x262f,
-0xf2c7,
-0x1a14,
-0x30d8,
-0x5070,
-0xf20b,
-0xc101,
-0x913,
-0x15e,
-0x700c,
-0xdb0f,
-0x1a18,
-0x3019,
-0x1a14,
-0x33d9,
-0x1214,
-0x3081,
-0xe92c,
-0x1215,
-0x3082,
-0x712c,
-0xdd64,
-0x2244,
-0x7cc,
-0x4220,
-0x2602,
-0x3381,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x7a5b,
-0x2904,
-0x81,
-0x234e,
-0x3042,
-0x7124,
-0x7c2f,
-0xc100,
-0x6159,
-0x7a2f,
-0xa13,
-0x325,
-0xd964,
-0x4181,
-0x219f,
-0x901,
-0x2905,
-0x81,
-0x7b2c,
-0xc11,
-0x10a5,
-0x1a14,
-0x30d8,
-0x229f,
-0x901,
-0x2a05,
-0x30d,
-0x78ac,
-0x5070,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0x704c,
-0x41c3,
-0x9003,
-0xe004,
-0xb140,
-0xb15d,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0x40c3,
-0x9003,
-0xff64,
-0xb040,
-0x7fe0,
-0x1804,
-0x45,
-0x78e0,
-0x917,
-0x3f0,
-0x228a,
-0xfc7,
-0x714c,
-0xb9c4,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x7a5b,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf81,
-0x9002,
-0x16a,
-0x224f,
-0x240,
-0x1900,
-0x5,
-0xb140,
-0xb100,
-0xb140,
-0x7fe0,
-0x1900,
-0x5,
-0x78e0,
-0x260a,
-0x3000,
-0x706c,
-0xf00d,
-0x230a,
-0x780,
-0xbcc4,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x7b7d,
-0x7124,
-0xbbc0,
-0x631b,
-0x7c2f,
-0xae9,
-0x8325,
-0x786f,
-0x7ee0,
-0xc0f1,
-0x4200,
-0xbf6,
-0x60,
-0x4020,
-0x795b,
-0x2144,
-0x181,
-0xb9c4,
-0xe906,
-0xb961,
-0x901,
-0x31,
-0x781d,
-0xc0d1,
-0x7fe0,
-0xb8c1,
-0x78e0,
-0xc0f1,
-0xc1a4,
-0x700c,
-0xa4a,
-0xffef,
-0xd9ff,
-0x700c,
-0xc043,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xd990,
-0x754c,
-0xb26,
-0xffef,
-0xdb40,
-0x700c,
-0xac2,
-0xffef,
-0x712c,
-0xc0a4,
-0xc0d1,
-0x7ee0,
-0xc3e1,
-0xc2e1,
-0xc1e1,
-0xc0e1,
-0xc0f1,
-0xc1a1,
-0x4220,
-0xc184,
-0xc140,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x80f,
-0x64,
-0x4040,
-0xc02,
-0x220,
-0xc100,
-0x7487,
-0xc0d1,
-0x7fe0,
-0xc0a4,
-0x78e0,
-0x791d,
-0x216c,
-0x102,
-0x206c,
-0x141,
-0x7822,
-0x621a,
-0x7fe0,
-0x784e,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0x45cb,
-0x8000,
-0x674,
-0x6de4,
-0x83e,
-0xa0,
-0x40e1,
-0x70cd,
-0x43c9,
-0xf00e,
-0x235a,
-0x641,
-0x235a,
-0x1c80,
-0x6038,
-0xab2,
-0x1a0,
-0x60f8,
-0x7164,
-0xbf1,
-0x8094,
-0x7165,
-0xbfb,
-0x90b4,
-0x706c,
-0x40c3,
-0x8000,
-0x665,
-0xa8ce,
-0xa8c1,
-0xa8c0,
-0xbe2,
-0x60,
-0xa5e0,
-0xbe6,
-0x60,
-0x4508,
-0x4100,
-0xa72,
-0x1e0,
-0x40a1,
-0x236f,
-0x30c3,
-0x1318,
-0x3080,
-0xe809,
-0x41c3,
-0x145,
-0x0,
-0xf56,
-0xffef,
-0xd80a,
-0xf01f,
-0x1300,
-0x3080,
-0x46cb,
-0x1e,
-0x8480,
-0x41c3,
-0x5f5,
-0xe100,
-0x2044,
-0x808d,
-0x40c1,
-0x20ca,
-0x41,
-0x992,
-0x120,
-0x702c,
-0x70b5,
-0x40c3,
-0x3b9a,
-0xca00,
-0x26ca,
-0x1001,
-0x40c1,
-0x1e00,
-0x70c5,
-0x9004,
-0xc0,
-0x976,
-0x120,
-0x702c,
-0x1600,
-0x7080,
-0x8000,
-0xd,
-0x80f,
-0x1e,
-0x1e00,
-0x7045,
-0x9004,
-0xc0,
-0x46cb,
-0x8000,
-0x57c,
-0x8e00,
-0x8b7,
-0x10,
-0x1300,
-0x3080,
-0x8af,
-0xdf,
-0xc82,
-0x0,
-0x40c3,
-0x0,
-0xa00,
-0x8fa,
-0xffef,
-0xd9ff,
-0x70ad,
-0xd8ff,
-0x702c,
-0x754c,
-0x736c,
-0xc543,
-0xc542,
-0xc541,
-0x9da,
-0xffef,
-0xc540,
-0x8e01,
-0x825,
-0xb4,
-0x702c,
-0x7104,
-0x781d,
-0xb862,
-0x780f,
-0xc043,
-0xd8ff,
-0x754c,
-0x726c,
-0xc542,
-0xc541,
-0x9b6,
-0xffef,
-0xc540,
-0x8e01,
-0xc043,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb0c,
-0xc542,
-0xc541,
-0x9a2,
-0xffef,
-0xc540,
-0x8e01,
-0xd908,
-0x754c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0x98a,
-0xffef,
-0xc540,
-0xbd2,
-0xffef,
-0xd8ff,
-0x8e01,
-0x702c,
-0x754c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0x96e,
-0xffef,
-0xc540,
-0xb9a,
-0xffef,
-0xd8ff,
-0xbde,
-0x1c0,
-0xd896,
-0x902,
-0xffef,
-0x712c,
-0xd1a,
-0x0,
-0xf009,
-0xbe6,
-0xffcf,
-0x40c3,
-0xf,
-0x4240,
-0x896,
-0x120,
-0x702c,
-0x1300,
-0x3080,
-0x83f,
-0x1e,
-0x43c3,
-0x9004,
-0x14,
-0x9320,
-0xca01,
-0x80d,
-0x1b0,
-0x214f,
-0x82,
-0x80b,
-0xd1,
-0x2185,
-0x108,
-0x4220,
-0xb340,
-0xd823,
-0x42c3,
-0x9005,
-0xe034,
-0xb200,
-0x702c,
-0x40c3,
-0x9003,
-0xe034,
-0xb020,
-0xb8b1,
-0xb020,
-0xb221,
-0xddff,
-0x40e1,
-0x702c,
-0x228a,
-0xdff,
-0x776c,
-0x8c6,
-0x2a0,
-0xc540,
-0x774c,
-0x40e1,
-0x712c,
-0x4340,
-0x8b6,
-0x2a0,
-0xc540,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e4,
-0x70ad,
-0xbd9a,
-0xd8ff,
-0x41a1,
-0x70cd,
-0xdba,
-0xffef,
-0x1a10,
-0x3003,
-0x88a,
-0x1c0,
-0x254f,
-0x1401,
-0xdaa,
-0xffef,
-0xd8ff,
-0x926,
-0x220,
-0xd8ff,
-0x26ab,
-0x10c4,
-0x7fff,
-0xf000,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a4,
-0xc043,
-0x1600,
-0x7080,
-0x8000,
-0x12,
-0x86b,
-0x175,
-0x706f,
-0x1600,
-0x708f,
-0x8000,
-0x669,
-0xf023,
-0xc003,
-0x83b,
-0x3ae,
-0x252f,
-0x16c7,
-0x259f,
-0x1041,
-0x40c3,
-0x8000,
-0x71a,
-0xc202,
-0x43c1,
-0x6509,
-0x60b8,
-0x8802,
-0xc140,
-0x41c3,
-0x16,
-0x4,
-0xc041,
-0xd4e,
-0xffef,
-0x740c,
-0x2500,
-0x1f80,
-0x8000,
-0x6dc,
-0x82e,
-0x0,
-0x7167,
-0x71c5,
-0xec3,
-0x9254,
-0x71e5,
-0x78ef,
-0xc042,
-0x40c3,
-0x8000,
-0x669,
-0x8821,
-0xc002,
-0x9ed,
-0x8025,
-0x70cd,
-0xc0a4,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3b04,
-0x68a1,
-0x716f,
-0xf0ac,
-0x8d62,
-0x15ff,
-0x9480,
-0x152d,
-0x109f,
-0x152f,
-0x109e,
-0x1cd8,
-0x3000,
-0x8d05,
-0x1531,
-0x108b,
-0x1533,
-0x108f,
-0x1cdc,
-0x3000,
-0x8d07,
-0x1535,
-0x108e,
-0x1537,
-0x108c,
-0x1ce0,
-0x3000,
-0x8d09,
-0x1539,
-0x1082,
-0x153b,
-0x1081,
-0x1ce4,
-0x3000,
-0x8d0b,
-0x1ce8,
-0x3000,
-0x8d0d,
-0x1cec,
-0x3000,
-0x8d0f,
-0x1cf0,
-0x3000,
-0x8d11,
-0x1cf4,
-0x3000,
-0x8d13,
-0x1cf8,
-0x3000,
-0x8d15,
-0x1cfc,
-0x3000,
-0x8d17,
-0x1c40,
-0x3018,
-0x8d19,
-0x1c41,
-0x3018,
-0x8d1b,
-0x1c42,
-0x3018,
-0x8d1d,
-0x1c43,
-0x3018,
-0x8d1f,
-0x1c44,
-0x3018,
-0x1521,
-0x1080,
-0x1c45,
-0x3018,
-0x1523,
-0x1080,
-0x1c46,
-0x3018,
-0x1525,
-0x1080,
-0x1c47,
-0x3018,
-0x1527,
-0x1080,
-0x1c48,
-0x3018,
-0x1529,
-0x1080,
-0x1c49,
-0x3018,
-0x152b,
-0x1080,
-0x1c4a,
-0x3018,
-0x153d,
-0x1080,
-0xc25a,
-0x14d8,
-0x3002,
-0xc05c,
-0x144a,
-0x3600,
-0xc15b,
-0x41c3,
-0x14,
-0x1f,
-0xc053,
-0x1449,
-0x3600,
-0xc459,
-0xc658,
-0xc052,
-0x1448,
-0x3600,
-0xc757,
-0x1c58,
-0x32c0,
-0xc051,
-0x1447,
-0x3600,
-0x1c54,
-0x3780,
-0x1c50,
-0x37c0,
-0xc050,
-0x1446,
-0x3600,
-0xc04f,
-0x1445,
-0x3600,
-0xc04e,
-0x1444,
-0x3600,
-0xc04d,
-0x1443,
-0x3600,
-0xc04c,
-0x1442,
-0x3600,
-0xc04b,
-0x1441,
-0x3600,
-0xc04a,
-0x1440,
-0x3600,
-0xc049,
-0x14fc,
-0x3000,
-0xc048,
-0x14f8,
-0x3000,
-0xc047,
-0x14f4,
-0x3000,
-0xc046,
-0x14f0,
-0x3000,
-0xc045,
-0x14ec,
-0x3000,
-0xc044,
-0x14e8,
-0x3000,
-0xc043,
-0x14e4,
-0x3000,
-0xc042,
-0x14e0,
-0x3000,
-0xc041,
-0x14dc,
-0x3000,
-0xc040,
-0xbb6,
-0xffef,
-0x740c,
-0x7767,
-0x7077,
-0x6ac,
-0xffca,
-0x2480,
-0x3b04,
-0x1404,
-0x341b,
-0xc6c6,
-0xc0f1,
-0x2482,
-0x3d02,
-0xc080,
-0x702c,
-0x8f2,
-0x120,
-0xdab4,
-0x41c3,
-0x18f,
-0x0,
-0xb8a,
-0xffef,
-0x750c,
-0xd840,
-0xc180,
-0xc22,
-0x160,
-0xda09,
-0x700c,
-0xd909,
-0xc280,
-0xcce,
-0xffaf,
-0x726c,
-0xd830,
-0xc180,
-0xc0e,
-0x160,
-0xda09,
-0x710c,
-0xd909,
-0xc280,
-0xcba,
-0xffaf,
-0x726c,
-0x2480,
-0x3d02,
-0xc0d1,
-0x7ee0,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x7534,
-0x20e0,
-0x7c5,
-0x7fe0,
-0x1a10,
-0x3002,
-0xc0e6,
-0x44cb,
-0x9004,
-0xe4,
-0x42c3,
-0x8000,
-0x667,
-0x835,
-0xb0,
-0x716c,
-0x7114,
-0xd825,
-0x46cb,
-0x9004,
-0x30,
-0xb89f,
-0xf42a,
-0x8a25,
-0xaa23,
-0x8aa4,
-0x7b34,
-0xaaa2,
-0x96c0,
-0x88e0,
-0x78bb,
-0xb4e0,
-0xaa00,
-0xe5f,
-0x1171,
-0xaa61,
-0xb4e1,
-0xf02d,
-0x700c,
-0xb400,
-0x1600,
-0x7081,
-0x8000,
-0x58,
-0xb421,
-0x44cb,
-0x9004,
-0xf6,
-0xb400,
-0xb404,
-0x1c06,
-0x13c5,
-0x8a27,
-0xaa23,
-0x8a06,
-0x7b34,
-0xaa02,
-0x781b,
-0xaa00,
-0xd8ff,
-0xaa61,
-0x1cfe,
-0x9004,
-0xc4c6,
-0x88a0,
-0xb4a0,
-0x8a27,
-0xaa23,
-0x8a04,
-0x7b34,
-0xaa02,
-0x781b,
-0xaa00,
-0xaa61,
-0x9600,
-0x829,
-0x151,
-0xb4a1,
-0xf015,
-0x1c02,
-0x1005,
-0x41c3,
-0x9004,
-0xfe,
-0xd8ff,
-0x1900,
-0x3c5,
-0x19f8,
-0x8004,
-0x19f6,
-0x8005,
-0x19fe,
-0x8005,
-0xc4c6,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0xb401,
-0x702c,
-0x40c3,
-0x9004,
-0xf6,
-0xb020,
-0xb024,
-0x18fe,
-0x8044,
-0xb023,
-0xc4c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x46cb,
-0x9004,
-0xf4,
-0x9600,
-0x6ea2,
-0x702c,
-0xc040,
-0xd8ff,
-0x1500,
-0x111b,
-0x95e3,
-0x1508,
-0x110b,
-0x1d08,
-0x13c5,
-0xb500,
-0x1d06,
-0x13c5,
-0xb600,
-0x1600,
-0x7080,
-0x8000,
-0x664,
-0x1e00,
-0x7004,
-0x9008,
-0x190,
-0x40c3,
-0x0,
-0x2af8,
-0xc86,
-0xe0,
-0x1efa,
-0x9485,
-0xc000,
-0xb600,
-0xb5e3,
-0x1d00,
-0x16c4,
-0x1d08,
-0x12c4,
-0x1600,
-0x7080,
-0x8000,
-0x664,
-0x781d,
-0xb8a0,
-0x6829,
-0x40c3,
-0x8000,
-0x57c,
-0xa821,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x47cb,
-0x9004,
-0x1e0,
-0x9720,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x70ad,
-0x205f,
-0x100,
-0x2044,
-0x7c2,
-0x4020,
-0xea06,
-0xba61,
-0xa01,
-0x31,
-0x781d,
-0xb8c3,
-0x80f,
-0x70,
-0xc1a1,
-0x807,
-0x190,
-0x71ad,
-0x700c,
-0xc16,
-0xe0,
-0xd940,
-0x46cb,
-0x9005,
-0xe112,
-0x1ede,
-0x1055,
-0x1ea6,
-0x9055,
-0x17b6,
-0x9100,
-0x716f,
-0xc040,
-0xed29,
-0xc000,
-0x84f,
-0x3bf,
-0xd91c,
-0xc000,
-0x2084,
-0xc07,
-0xc040,
-0xb88f,
-0xb600,
-0x700c,
-0xbe2,
-0xe0,
-0x1ef6,
-0x9205,
-0x40c3,
-0xf,
-0x4240,
-0x702c,
-0xbd2,
-0xe0,
-0x1ef6,
-0x9245,
-0x17be,
-0x9100,
-0x1ef0,
-0x9045,
-0x1ef6,
-0x9205,
-0x209a,
-0x8,
-0x2004,
-0xf81,
-0x0,
-0x3e00,
-0xc000,
-0x7825,
-0xb88e,
-0xb600,
-0xf005,
-0x1ef6,
-0x9205,
-0x1ef0,
-0x9045,
-0x1e00,
-0x76c4,
-0x9013,
-0xe050,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x46cb,
-0x9004,
-0xf4,
-0x6ea2,
-0xd8ff,
-0x1600,
-0x111b,
-0x1500,
-0x111e,
-0x1506,
-0x110b,
-0x95e4,
-0x1d08,
-0x13c5,
-0xb500,
-0x1d06,
-0x13c5,
-0xb600,
-0x700c,
-0x1e00,
-0x7004,
-0x9008,
-0x190,
-0xd834,
-0x1efa,
-0x9004,
-0x40c3,
-0x0,
-0x2af8,
-0xb4e,
-0xe0,
-0x702c,
-0x1e00,
-0x16c4,
-0x1d06,
-0x12c4,
-0x1d00,
-0x1784,
-0xb5e4,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x8821,
-0x8800,
-0x6119,
-0x7fe0,
-0x783d,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4328,
-0x7034,
-0x1600,
-0x7081,
-0x8000,
-0x1a,
-0x4608,
-0xd8f0,
-0x20ca,
-0x3e2,
-0x4358,
-0x9fa,
-0x160,
-0x782b,
-0xf469,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x8cb,
-0xbf,
-0x41c1,
-0xca15,
-0x120c,
-0x308d,
-0xc041,
-0x4061,
-0x4263,
-0xdb40,
-0x1a15,
-0x30c3,
-0xf52,
-0x20,
-0x1a0c,
-0x3083,
-0xb1b,
-0x1030,
-0x40c1,
-0x40c1,
-0x4163,
-0x714c,
-0xdb80,
-0xcfa,
-0x160,
-0x1c00,
-0x3001,
-0xf005,
-0x4163,
-0xf4a,
-0x160,
-0x704c,
-0x40c3,
-0x8000,
-0x669,
-0x1001,
-0x9f,
-0x88c0,
-0x264a,
-0x3000,
-0x238a,
-0x1fc1,
-0x708d,
-0xf01b,
-0xb2f,
-0x306e,
-0x700c,
-0xf00f,
-0x239f,
-0x41,
-0x42c3,
-0x8000,
-0x6dc,
-0x7b14,
-0x627f,
-0x634b,
-0x8f41,
-0x7104,
-0x2309,
-0x10cb,
-0x2608,
-0x309e,
-0x8e7,
-0x87f4,
-0x7b8f,
-0x7185,
-0x7124,
-0x9d3,
-0x8254,
-0x71c5,
-0x78cf,
-0xff9,
-0xb025,
-0x702c,
-0xca65,
-0x2640,
-0x321e,
-0x2342,
-0x120b,
-0x2009,
-0x783,
-0xca64,
-0x1a67,
-0x30c2,
-0x41c3,
-0x32,
-0x2,
-0x2308,
-0x1000,
-0x1a66,
-0x3002,
-0x7a0f,
-0xfe2,
-0xffaf,
-0x740c,
-0xc001,
-0x1a0c,
-0x3342,
-0x1a15,
-0x3002,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc0e6,
-0xc604,
-0x90f,
-0x7f4,
-0xc503,
-0x700c,
-0x1e00,
-0x1003,
-0xf03c,
-0x2014,
-0x4c,
-0x8ce1,
-0xff3,
-0x90a4,
-0x260a,
-0x33c0,
-0x8ce0,
-0xaeb,
-0x83e4,
-0x43e9,
-0x2602,
-0x308f,
-0x2202,
-0x2cc,
-0x7074,
-0x74fd,
-0xae80,
-0x4628,
-0xf012,
-0xe2b,
-0x30a4,
-0x7ccf,
-0xc23,
-0x17f5,
-0x7074,
-0xdcff,
-0x24ca,
-0x1062,
-0x64fe,
-0x7ccd,
-0x2014,
-0x30c,
-0x1400,
-0x108b,
-0x1401,
-0x109e,
-0xadf,
-0x82e5,
-0x7fcd,
-0x7074,
-0xd8ff,
-0x20ca,
-0x61,
-0x60f8,
-0x7a0d,
-0xca0c,
-0xf203,
-0x4a31,
-0xf002,
-0x7942,
-0x2044,
-0x7c2,
-0x4020,
-0xea06,
-0xba61,
-0xa01,
-0x31,
-0x781b,
-0xad00,
-0xc4c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x4338,
-0x1600,
-0x7101,
-0x8000,
-0x6,
-0x4348,
-0x218c,
-0x864a,
-0x96,
-0x2d,
-0xc1a1,
-0xeca,
-0xffaf,
-0x712c,
-0x260a,
-0x3000,
-0x235f,
-0x1800,
-0x70ad,
-0x68ec,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x201a,
-0xf8e,
-0x10,
-0x0,
-0xf033,
-0x231a,
-0x3f81,
-0x0,
-0x1000,
-0x7825,
-0x2005,
-0x381,
-0x40a1,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0xc040,
-0xf0a,
-0xffaf,
-0x9000,
-0xeb08,
-0x2704,
-0x1f81,
-0x0,
-0xfffc,
-0x6038,
-0xf003,
-0x78e2,
-0x7a0e,
-0x785c,
-0x781c,
-0x781c,
-0x781c,
-0x4100,
-0xd81b,
-0xb861,
-0x801,
-0x31,
-0x793d,
-0x71a5,
-0x6238,
-0xb8c4,
-0x4831,
-0x2a44,
-0x800,
-0x209a,
-0x1,
-0x7905,
-0xc000,
-0xb020,
-0xda1,
-0x90b4,
-0x2655,
-0x3800,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e2,
-0x45cb,
-0x9004,
-0x6,
-0xd820,
-0x886,
-0xe0,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0xc2e6,
-0x45cb,
-0x9004,
-0x1c6,
-0x95c0,
-0xbecb,
-0x264f,
-0x12cf,
-0x2605,
-0x1f80,
-0x0,
-0xc00,
-0xb5e0,
-0xb500,
-0x85a,
-0xe0,
-0xd80a,
-0xb5e0,
-0x9501,
-0xb5c0,
-0xb8c9,
-0xc6c6,
-0x6f5,
-0xff6f,
-0x4040,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ac,
-0xc249,
-0xc144,
-0x702c,
-0x744c,
-0xc34b,
-0xb86,
-0xe0,
-0xc043,
-0xc004,
-0x70ed,
-0x7704,
-0x851,
-0xb5,
-0x238a,
-0x3002,
-0xc609,
-0x70ad,
-0x238a,
-0x3002,
-0xf01c,
-0x79cc,
-0xc004,
-0x7214,
-0x40c3,
-0x8000,
-0x71a,
-0xf403,
-0x6109,
-0xf003,
-0x6038,
-0x8822,
-0x70b5,
-0x23ca,
-0x3041,
-0x2138,
-0x6c0,
-0x41c3,
-0x57,
-0x1,
-0xe36,
-0xff6f,
-0x42c1,
-0x70b5,
-0x25ca,
-0x1061,
-0x71c5,
-0xc00b,
-0xecd,
-0x9024,
-0xd941,
-0x700c,
-0xc045,
-0xf08e,
-0xc009,
-0x70ad,
-0xc64a,
-0xf03b,
-0x943,
-0x4,
-0xca02,
-0x83b,
-0x44,
-0xc106,
-0xc008,
-0x7834,
-0x41c3,
-0x8000,
-0x6dc,
-0x6029,
-0x2000,
-0xf80,
-0x8000,
-0x6dc,
-0x8861,
-0xc005,
-0x780f,
-0x631b,
-0x6038,
-0xc041,
-0xc006,
-0xc342,
-0x41c3,
-0x59,
-0x5,
-0xc040,
-0x740c,
-0xd86,
-0xffaf,
-0x43e1,
-0xc106,
-0xc008,
-0x7ecf,
-0x7daf,
-0x7834,
-0x41c3,
-0x8000,
-0x6dc,
-0x2000,
-0xf83,
-0x8000,
-0x6dc,
-0x602a,
-0xc005,
-0x8b61,
-0x790f,
-0x6338,
-0x70d1,
-0x26ca,
-0x1005,
-0x6238,
-0x70b1,
-0x25ca,
-0x100d,
-0xc007,
-0x7104,
-0xc047,
-0xc007,
-0x7a0f,
-0xc00b,
-0xa57,
-0x25,
-0xd841,
-0x784a,
-0x43c3,
-0x8000,
-0x71b,
-0xc048,
-0x6069,
-0xc004,
-0x815,
-0x70,
-0x61f9,
-0xc008,
-0x6078,
-0x8861,
-0xd880,
-0x7862,
-0xc045,
-0x782d,
-0xc046,
-0x7b2f,
-0xca03,
-0xb57,
-0x87f4,
-0x5042,
-0x921,
-0x24,
-0x70cd,
-0xca02,
-0x819,
-0x64,
-0x43e1,
-0xc006,
-0x41c3,
-0x5a,
-0x3,
-0xc040,
-0xcfa,
-0xffaf,
-0x740c,
-0xddff,
-0x79cf,
-0x7baf,
-0xb13,
-0x65,
-0x704c,
-0xc005,
-0x780f,
-0x4912,
-0x4b10,
-0xc04a,
-0xc003,
-0x78f4,
-0xa841,
-0xc20a,
-0xa840,
-0x1203,
-0x3082,
-0xc812,
-0x81f,
-0x84,
-0x1202,
-0x3082,
-0xa17,
-0x24,
-0x740c,
-0xc140,
-0x41c3,
-0x5b,
-0x3,
-0xcb6,
-0xffaf,
-0x42e1,
-0x71e5,
-0xe79f,
-0x6e6,
-0xffe5,
-0xdeff,
-0xc003,
-0x228a,
-0x3e,
-0xc103,
-0x183f,
-0x3,
-0xc004,
-0x7214,
-0x4040,
-0x20ca,
-0x6c1,
-0x193e,
-0x2,
-0xc004,
-0x7114,
-0xc003,
-0x22ca,
-0x6c1,
-0x1840,
-0x82,
-0x1203,
-0x3081,
-0xc812,
-0x815,
-0x44,
-0x1202,
-0x3081,
-0x90d,
-0x4,
-0xf5e,
-0xffaf,
-0xc003,
-0xc0ac,
-0x1404,
-0x341b,
-0xc6c6,
-0x7014,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x41c3,
-0x9004,
-0x168,
-0x21c2,
-0x222,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x7905,
-0x7fe0,
-0x9100,
-0x78e0,
-0x1600,
-0x7100,
-0x8000,
-0x22,
-0x7014,
-0x7de0,
-0x1600,
-0x7100,
-0x9004,
-0x8,
-0x7ee0,
-0x78e0,
-0x42c3,
-0x8000,
-0x665,
-0x813,
-0x70,
-0x7014,
-0x700c,
-0xf40b,
-0x8a40,
-0xd84f,
-0xf003,
-0x8a40,
-0xd853,
-0xb89f,
-0x7054,
-0x20c0,
-0xce2,
-0x7034,
-0x7fe0,
-0x20c0,
-0xa1,
-0x78e0,
-0xc0f1,
-0x4200,
-0x7114,
-0x40c3,
-0x8000,
-0x665,
-0xf205,
-0xea8c,
-0x8820,
-0xd84d,
-0xf003,
-0x8820,
-0xd84e,
-0xb89f,
-0x7034,
-0x20c0,
-0xce2,
-0xf008,
-0x712c,
-0x700c,
-0xc1e,
-0xff6f,
-0xb993,
-0x700c,
-0xc0d1,
-0x7ee0,
-0xc2e2,
-0x260a,
-0x3000,
-0x706d,
-0x70ad,
-0xf00b,
-0xf2e,
-0x60,
-0x210a,
-0x780,
-0xe804,
-0x78af,
-0x200f,
-0x2cd,
-0x7165,
-0xbf1,
-0x90b4,
-0x4061,
-0x78af,
-0xc6c2,
-0x40c3,
-0x8000,
-0x674,
-0x469,
-0xff6f,
-0x8000,
-0x40c3,
-0x8000,
-0x674,
-0x42c3,
-0x8000,
-0x665,
-0x8020,
-0x8a00,
-0x205f,
-0xc80,
-0x6038,
-0x8a21,
-0x215f,
-0x641,
-0x6038,
-0x8842,
-0x700c,
-0x52d,
-0xffef,
-0x702c,
-0x704c,
-0x706c,
-0xf00c,
-0x817,
-0xae,
-0x796f,
-0xea03,
-0x6b21,
-0x792f,
-0xa0b,
-0xf4,
-0x6961,
-0x6963,
-0x7144,
-0xaeb,
-0x8194,
-0x7fe0,
-0x786f,
-0xc2e4,
-0x1cfc,
-0xb6c8,
-0x4318,
-0xe806,
-0x1600,
-0x7080,
-0x8000,
-0x14,
-0xf006,
-0x1600,
-0x7080,
-0x8000,
-0x15,
-0x791d,
-0x793d,
-0x1a12,
-0x3002,
-0x256f,
-0x1bc3,
-0x793d,
-0x8dc0,
-0x793d,
-0x793d,
-0x793d,
-0x1a03,
-0x3382,
-0x793d,
-0x15f7,
-0x908c,
-0x1a0b,
-0x3042,
-0x791d,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0x2144,
-0x42,
-0x2053,
-0x8141,
-0x776c,
-0x4020,
-0x20ca,
-0xc1,
-0x2484,
-0x1001,
-0x1a13,
-0x3082,
-0x1a12,
-0x3042,
-0x1a0f,
-0x3002,
-0x1a14,
-0x3302,
-0xe902,
-0xea04,
-0x1a12,
-0x3503,
-0xe0d,
-0x1435,
-0x700c,
-0x1a03,
-0x3fc3,
-0xf00e,
-0x79dd,
-0x793d,
-0x793d,
-0x793d,
-0x6909,
-0xbec3,
-0x1a02,
-0x3002,
-0x61d8,
-0x1a03,
-0x3382,
-0x7704,
-0x1a02,
-0x3002,
-0xd820,
-0xb89f,
-0x8840,
-0x1a14,
-0x3098,
-0x8861,
-0x1a18,
-0x30d8,
-0xec14,
-0xb1d,
-0x3010,
-0x7b7d,
-0x7b7d,
-0x7a5d,
-0x7b7d,
-0x7a5d,
-0x7b7d,
-0x7a5d,
-0x1a18,
-0x30d8,
-0x7a5d,
-0xf006,
-0xbbc3,
-0xbac3,
-0x1a18,
-0x30d8,
-0x1a14,
-0x3098,
-0x206f,
-0xf43,
-0x68c9,
-0x7077,
-0x41c1,
-0x21ca,
-0x1,
-0x8900,
-0x781d,
-0xb8c1,
-0x1a15,
-0x3002,
-0x8900,
-0x781d,
-0x781d,
-0x781d,
-0xb8c1,
-0x1a0c,
-0x3002,
-0x15f7,
-0x9081,
-0x710c,
-0xb9c3,
-0xb9c4,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0x5053,
-0x41c3,
-0x2b,
-0x2,
-0xa2a,
-0xffaf,
-0x740c,
-0x7077,
-0xd87f,
-0xdd50,
-0x751c,
-0xc814,
-0x1a65,
-0x3342,
-0x1a64,
-0x3003,
-0x5055,
-0xc818,
-0x7077,
-0x5056,
-0x16fd,
-0x9080,
-0x791b,
-0x781d,
-0x781d,
-0x781d,
-0x703c,
-0x2044,
-0x879e,
-0xf253,
-0xb61,
-0x3030,
-0x269f,
-0x3a0f,
-0x206f,
-0x243,
-0x8820,
-0x8808,
-0x201a,
-0xf80,
-0x1,
-0x86a0,
-0x7b1d,
-0x211a,
-0xf80,
-0x20,
-0x0,
-0x7b7d,
-0x7b7d,
-0x7b7d,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x9000,
-0x7b7d,
-0x7b7d,
-0x2044,
-0x82,
-0xc80c,
-0x7b7d,
-0x6050,
-0x4b10,
-0x2048,
-0x1,
-0xc806,
-0x6052,
-0x2905,
-0x81,
-0x2e05,
-0x309e,
-0x782f,
-0xe0ff,
-0xd87f,
-0x20ca,
-0x45,
-0xf010,
-0x40c3,
-0x8000,
-0x665,
-0x8800,
-0x205f,
-0xc80,
-0x2032,
-0xf80,
-0x8000,
-0x686,
-0xa9e,
-0xff4f,
-0x2e85,
-0x3406,
-0x7a0f,
-0x2640,
-0x3040,
-0x790f,
-0x6158,
-0x2509,
-0x1003,
-0x4a30,
-0x2048,
-0x0,
-0x1a65,
-0x30c2,
-0x1a64,
-0x3002,
-0x7a0f,
-0x41c3,
-0x29,
-0x2,
-0x956,
-0xffaf,
-0x740c,
-0xaa2,
-0x100,
-0x1404,
-0x341b,
-0xc6c4,
-0x44cb,
-0x900e,
-0xc2,
-0x1c02,
-0x1014,
-0xb420,
-0xb441,
-0x7fe0,
-0xb462,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ac,
-0x45cb,
-0x8000,
-0x686,
-0x260a,
-0x3340,
-0xc344,
-0x1600,
-0x7083,
-0x8000,
-0x4,
-0x2680,
-0x3581,
-0xc24b,
-0xc143,
-0xc040,
-0x200a,
-0x780,
-0x42c3,
-0x0,
-0x1491,
-0xe5e,
-0xa0,
-0x702c,
-0x41c3,
-0x8000,
-0x474,
-0x40c3,
-0x1f,
-0x1f,
-0xa109,
-0xc000,
-0x70ed,
-0x192c,
-0x401,
-0xb1f8,
-0x1928,
-0x3c5,
-0x1a0e,
-0x33c2,
-0x1a0d,
-0x33c2,
-0xe88b,
-0x40c3,
-0x0,
-0xc00,
-0xb118,
-0x2040,
-0x7c2,
-0xe00f,
-0xb153,
-0xb114,
-0xc003,
-0x41c3,
-0x8000,
-0x665,
-0x8942,
-0x205f,
-0x500,
-0x231a,
-0xf83,
-0x10,
-0x0,
-0x6058,
-0x2000,
-0xf80,
-0x8000,
-0x1b70,
-0xc042,
-0xc003,
-0xc34a,
-0x205f,
-0x642,
-0x8900,
-0x205f,
-0xc80,
-0x6058,
-0x60a8,
-0xc049,
-0x8905,
-0xc048,
-0x8904,
-0xf079,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0xdeff,
-0x43b9,
-0xc046,
-0x700c,
-0xc647,
-0xc045,
-0xf069,
-0xc000,
-0xe806,
-0x254f,
-0x1080,
-0x780f,
-0x849,
-0x111,
-0xc000,
-0xd98c,
-0x7014,
-0xd8c0,
-0x703c,
-0xc103,
-0x6119,
-0xc00a,
-0x7905,
-0xc006,
-0x7905,
-0xc007,
-0x7104,
-0xc047,
-0x780d,
-0x209a,
-0x4,
-0xf831,
-0x86e,
-0xffaf,
-0x9000,
-0x7910,
-0xca0c,
-0x2044,
-0x7c3,
-0x4020,
-0xeb05,
-0xbb61,
-0xbff,
-0x8031,
-0x781d,
-0xc045,
-0xc000,
-0xe80d,
-0xc106,
-0xc004,
-0x71c5,
-0x7905,
-0x78cd,
-0x209a,
-0x4,
-0xf825,
-0x1000,
-0x11b,
-0xf014,
-0x254f,
-0x1080,
-0x780f,
-0x821,
-0x111,
-0xc004,
-0x813,
-0x91,
-0xc002,
-0xc102,
-0x8800,
-0x7124,
-0xc142,
-0xf002,
-0xc009,
-0x906,
-0xff6f,
-0x71c5,
-0x4318,
-0xc00b,
-0x841,
-0x36e,
-0x7aef,
-0x229f,
-0x41,
-0xc105,
-0x40c3,
-0x8000,
-0x71a,
-0x706c,
-0x6058,
-0x1802,
-0x6c2,
-0xa820,
-0xf00d,
-0x2100,
-0xf80,
-0x8000,
-0x6dd,
-0x1800,
-0x3,
-0x2100,
-0x781,
-0xd87f,
-0xa900,
-0x7164,
-0xbed,
-0x87f4,
-0x2214,
-0xc1,
-0x71e5,
-0x71a5,
-0xd33,
-0x9254,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0xc108,
-0x780f,
-0x7030,
-0x708,
-0xffee,
-0x70ad,
-0xc0ac,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a3,
-0x704c,
-0xf005,
-0x1900,
-0x5,
-0x7144,
-0xafd,
-0x8674,
-0x2014,
-0x81,
-0xdb32,
-0xbb9f,
-0x8b20,
-0xa821,
-0x6b21,
-0xc140,
-0x8920,
-0xa822,
-0xc100,
-0x7124,
-0xc141,
-0x8920,
-0xa823,
-0xc101,
-0x7124,
-0xc142,
-0x8920,
-0xa824,
-0xc102,
-0x6941,
-0x8a20,
-0x2240,
-0x5f,
-0x2740,
-0x304c,
-0xa82b,
-0x1700,
-0x3081,
-0x6ca1,
-0x6dc1,
-0xa82c,
-0x8c20,
-0x6ee1,
-0x4358,
-0xa82d,
-0x8d20,
-0xa82e,
-0x8e20,
-0xa830,
-0x8f20,
-0xa831,
-0x8f21,
-0xa836,
-0x8f22,
-0xa838,
-0x13e6,
-0x8081,
-0xe930,
-0x264a,
-0x3000,
-0xf02a,
-0x265a,
-0x3c82,
-0x235a,
-0x1641,
-0x7165,
-0x621a,
-0x6159,
-0x8b40,
-0xa941,
-0xc200,
-0x8a40,
-0xa942,
-0xc201,
-0x8a40,
-0xa943,
-0xc202,
-0x8a40,
-0xa944,
-0x1300,
-0x3082,
-0xa94b,
-0x1700,
-0x3082,
-0xa94c,
-0x8c40,
-0xa94d,
-0x8d40,
-0xa94e,
-0x8e40,
-0xa950,
-0x8f40,
-0xa951,
-0x8f41,
-0xa956,
-0x8f42,
-0xa958,
-0xbb9,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0xf08d,
-0xda3e,
-0xba9f,
-0x1201,
-0x481,
-0xa83a,
-0x1201,
-0x481,
-0xa83b,
-0x1201,
-0x481,
-0xa83c,
-0x1201,
-0x481,
-0xa83d,
-0x1201,
-0x481,
-0x1824,
-0x42,
-0x1201,
-0x481,
-0x1825,
-0x42,
-0x1201,
-0x481,
-0x1826,
-0x42,
-0x1201,
-0x481,
-0x1827,
-0x42,
-0x1201,
-0x481,
-0x1829,
-0x42,
-0x1201,
-0x481,
-0x182a,
-0x42,
-0x1201,
-0x481,
-0x182f,
-0x42,
-0x121c,
-0x481,
-0x1831,
-0x42,
-0x1201,
-0x481,
-0x1833,
-0x42,
-0x1201,
-0x481,
-0x1834,
-0x42,
-0x1201,
-0x481,
-0x1835,
-0x42,
-0x1201,
-0x481,
-0x1836,
-0x42,
-0x1201,
-0x481,
-0x183d,
-0x42,
-0x1201,
-0x481,
-0x183e,
-0x42,
-0x1201,
-0x481,
-0x183f,
-0x42,
-0x1201,
-0x481,
-0x1840,
-0x42,
-0x1201,
-0x481,
-0x1842,
-0x42,
-0x1201,
-0x481,
-0x1843,
-0x42,
-0x1201,
-0x481,
-0x1848,
-0x42,
-0x1201,
-0x481,
-0x184a,
-0x42,
-0x1201,
-0x481,
-0x184c,
-0x42,
-0x1201,
-0x481,
-0x184d,
-0x42,
-0x1201,
-0x481,
-0x184e,
-0x42,
-0x1201,
-0x481,
-0x184f,
-0x42,
-0x1201,
-0x481,
-0x1856,
-0x42,
-0x1201,
-0x481,
-0x1857,
-0x42,
-0x1201,
-0x481,
-0x1858,
-0x42,
-0x1201,
-0x481,
-0x1859,
-0x42,
-0x1201,
-0x481,
-0x185b,
-0x42,
-0x8a20,
-0x185c,
-0x42,
-0x8a21,
-0x1861,
-0x42,
-0x8a22,
-0x1863,
-0x42,
-0xc0a3,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc3e4,
-0xc1ab,
-0xc080,
-0x41c3,
-0x8000,
-0x550,
-0xbfe,
-0xff2f,
-0xda2a,
-0xc080,
-0x972,
-0x220,
-0xd92a,
-0xdd25,
-0xbd9f,
-0x8d00,
-0x46cb,
-0x9004,
-0xe4,
-0xb600,
-0x1533,
-0x1080,
-0xb601,
-0x15f4,
-0x9080,
-0xe888,
-0x1e00,
-0x7005,
-0x9003,
-0xe154,
-0x1e42,
-0x905d,
-0x902,
-0xffcf,
-0x2053,
-0xc1,
-0x1a01,
-0x3042,
-0x791d,
-0x793d,
-0x793d,
-0x793d,
-0xb9c3,
-0x1a04,
-0x3042,
-0xd908,
-0xb961,
-0x901,
-0x31,
-0x781d,
-0xb8c1,
-0xb6e,
-0x160,
-0x1a08,
-0x3002,
-0x81e,
-0x0,
-0x856,
-0x100,
-0x164c,
-0x9100,
-0x80d,
-0x151,
-0x8d00,
-0xb600,
-0xb601,
-0xc7c4,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x1600,
-0x7101,
-0x9004,
-0x1e0,
-0x1600,
-0x7082,
-0x8000,
-0x4,
-0x225f,
-0x100,
-0x2044,
-0x7c3,
-0x4020,
-0xeb05,
-0xbb61,
-0xbff,
-0x8031,
-0x781d,
-0xb8c3,
-0x80b,
-0x190,
-0x877,
-0x71,
-0xdf18,
-0x46cb,
-0x9004,
-0x116,
-0x1e08,
-0x1094,
-0x71ad,
-0x1e02,
-0x1055,
-0xd829,
-0xb6a0,
-0x1e6c,
-0x1205,
-0x1e6c,
-0x1004,
-0x702c,
-0x40c3,
-0x98,
-0x9680,
-0x4328,
-0x1ef2,
-0x9044,
-0xef2,
-0x60,
-0x1e66,
-0x1044,
-0xd8a9,
-0x1e6c,
-0x1004,
-0x208a,
-0xa46,
-0x1e6c,
-0x1004,
-0x208a,
-0xa44,
-0x1e6c,
-0x1004,
-0x1e6c,
-0x1004,
-0x40c3,
-0x0,
-0x6000,
-0x1e72,
-0x935c,
-0x1ed0,
-0x9344,
-0x1e72,
-0x90dd,
-0xe66,
-0x60,
-0x1ed0,
-0x92c4,
-0x1e72,
-0x935c,
-0x1e72,
-0x92dc,
-0xf046,
-0x45cb,
-0x9004,
-0x116,
-0x1d08,
-0x1094,
-0x71cd,
-0x1d02,
-0x1055,
-0x234a,
-0x1200,
-0x702c,
-0xbf8b,
-0x40c3,
-0xf,
-0x4240,
-0xb5c0,
-0x1d6c,
-0x12c4,
-0x260a,
-0x3040,
-0x1df2,
-0x9044,
-0x1d66,
-0x1044,
-0x1d6c,
-0x13c4,
-0xe7a,
-0x60,
-0x4318,
-0xbf70,
-0x202f,
-0x6c2,
-0x702c,
-0xe6a,
-0x60,
-0x1d6c,
-0x13c4,
-0x40c3,
-0x98,
-0x9680,
-0x702c,
-0xe5a,
-0x60,
-0x1d6c,
-0x12c4,
-0xd888,
-0x1d6c,
-0x1004,
-0x40c3,
-0x0,
-0x6000,
-0x1d6c,
-0x12c4,
-0x1d6c,
-0x1784,
-0x1d72,
-0x939c,
-0x1dd0,
-0x9384,
-0x1d72,
-0x90dd,
-0xdda,
-0x60,
-0x1dd0,
-0x9784,
-0x1d72,
-0x939c,
-0x1d72,
-0x979c,
-0x700c,
-0xe22,
-0x60,
-0xd920,
-0x45cb,
-0x9004,
-0x1f0,
-0xd820,
-0xdba,
-0x60,
-0x1d00,
-0x1005,
-0xd820,
-0xdb2,
-0x60,
-0x1d00,
-0x1045,
-0x740c,
-0xda6,
-0x60,
-0x1d00,
-0x1005,
-0x1d0a,
-0x909d,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1bd,
-0xd925,
-0xb99f,
-0x8900,
-0x1c3a,
-0x3002,
-0x1133,
-0x80,
-0x1c3b,
-0x3002,
-0x40c3,
-0x8000,
-0x664,
-0x8827,
-0x88a0,
-0xc16e,
-0x8829,
-0x1c39,
-0x3042,
-0x8828,
-0x1c36,
-0x3042,
-0x882a,
-0x710c,
-0x1c37,
-0x3042,
-0xdb2,
-0x20,
-0xc193,
-0x702c,
-0xc146,
-0xf005,
-0x7a34,
-0x700c,
-0xb200,
-0x7124,
-0x9fb,
-0x82b4,
-0xc298,
-0xd90c,
-0x2905,
-0x341,
-0x740c,
-0x7835,
-0xc049,
-0x40d,
-0x20,
-0x700c,
-0x3ff,
-0x20,
-0x706f,
-0xc005,
-0x712c,
-0x2044,
-0x7c2,
-0x4020,
-0xc105,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781b,
-0xc047,
-0x202f,
-0x6c7,
-0xd36,
-0x20,
-0x792f,
-0x46cb,
-0x8000,
-0x57c,
-0xc048,
-0x8e00,
-0x7014,
-0xf2f6,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0xb8e3,
-0xf4f0,
-0x87a,
-0xff8f,
-0x70ed,
-0x700c,
-0xf07e,
-0xc004,
-0x2079,
-0x80,
-0x7704,
-0xc04a,
-0xc004,
-0xb882,
-0x815,
-0x131,
-0xd9ff,
-0x40c3,
-0x0,
-0xa00,
-0xcda,
-0xff0f,
-0x89e,
-0x140,
-0x8e01,
-0x71ad,
-0x702c,
-0xc043,
-0xc007,
-0x704c,
-0x726c,
-0x780f,
-0xc04b,
-0xc042,
-0xc00a,
-0xc541,
-0x780f,
-0xc04c,
-0x781d,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x180,
-0xc040,
-0xd9e,
-0xff2f,
-0xd8ff,
-0x8e01,
-0xc742,
-0xc541,
-0xc043,
-0xc004,
-0x702c,
-0x704c,
-0x726c,
-0x2032,
-0xf80,
-0x8000,
-0x4bc,
-0xb8c5,
-0xc040,
-0xd7a,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc00b,
-0x726c,
-0xc541,
-0xc042,
-0xc00c,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x580,
-0xc040,
-0xd56,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc00a,
-0x726c,
-0xc742,
-0xb8c5,
-0xc040,
-0xd8ff,
-0xd3e,
-0xff2f,
-0xc541,
-0x40c3,
-0x0,
-0x2710,
-0xca2,
-0x60,
-0xd90a,
-0x781d,
-0x781d,
-0x7704,
-0x7d0f,
-0xf8dd,
-0xc742,
-0xc741,
-0xc740,
-0xd1a,
-0xff2f,
-0xc543,
-0xf8da,
-0xc543,
-0xc742,
-0xc741,
-0xd0e,
-0xff2f,
-0xc740,
-0xc004,
-0xb863,
-0x811,
-0x95,
-0xf7a,
-0x100,
-0x700c,
-0xc9e,
-0xff2f,
-0x712c,
-0xc004,
-0x7104,
-0xc044,
-0xc004,
-0x7514,
-0x702,
-0xffe5,
-0xd9ff,
-0x40c3,
-0x0,
-0xa00,
-0xbea,
-0xff0f,
-0xfae,
-0x100,
-0x8e01,
-0x702c,
-0x71ed,
-0xc043,
-0xd8ff,
-0x704c,
-0xdb18,
-0x4528,
-0xc142,
-0xc741,
-0xcc2,
-0xff2f,
-0xc140,
-0xf06,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc007,
-0x726c,
-0xc741,
-0x780f,
-0xc044,
-0xc042,
-0xd820,
-0xc040,
-0xc9e,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc741,
-0xc86,
-0xff2f,
-0x1c00,
-0x30c1,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xc004,
-0x726c,
-0xc741,
-0xc042,
-0xd8ff,
-0xc6e,
-0xff2f,
-0x1c00,
-0x3481,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc741,
-0xc56,
-0xff2f,
-0xc540,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb08,
-0xc542,
-0xc741,
-0xc3e,
-0xff2f,
-0xc540,
-0xe6a,
-0xff2f,
-0xd8ff,
-0x8e01,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb18,
-0xc542,
-0xc741,
-0xc22,
-0xff2f,
-0xc540,
-0xe9a,
-0x100,
-0xf07f,
-0x700c,
-0xb22,
-0xff2f,
-0xd9ff,
-0xc007,
-0x70ad,
-0x734c,
-0x205a,
-0x101,
-0xdb22,
-0xc543,
-0xc540,
-0x7825,
-0x7e0f,
-0xd820,
-0xc041,
-0xd8ff,
-0x702c,
-0xe02,
-0xff2f,
-0xc642,
-0xd828,
-0xc041,
-0xf88c,
-0xc543,
-0xc642,
-0xdf2,
-0xff2f,
-0xc540,
-0xf889,
-0xc543,
-0xc642,
-0x1c04,
-0x33c1,
-0xde2,
-0xff2f,
-0xc040,
-0xf885,
-0xc543,
-0xc642,
-0x1c04,
-0x3501,
-0xdd2,
-0xff2f,
-0xc540,
-0xd8ff,
-0xd980,
-0x734c,
-0xdb22,
-0xc543,
-0xc642,
-0x1c04,
-0x3081,
-0xdbe,
-0xff2f,
-0xc540,
-0x700c,
-0xb4a,
-0xff2f,
-0x712c,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0xdae0,
-0x201a,
-0xf81,
-0x20,
-0x0,
-0x40c3,
-0x9008,
-0x100,
-0x2105,
-0x3,
-0x7204,
-0x7825,
-0xb340,
-0x1800,
-0x485,
-0x700c,
-0xa82,
-0xff2f,
-0xd9ff,
-0xdbe,
-0xff2f,
-0xd8ff,
-0xc007,
-0x702c,
-0xb990,
-0x780f,
-0xc042,
-0xd8ff,
-0x714c,
-0x746c,
-0xc543,
-0xc541,
-0xb56,
-0xff2f,
-0xc540,
-0xd90c,
-0xd8ff,
-0xb98d,
-0x734c,
-0x746c,
-0xc543,
-0xc642,
-0xc541,
-0xb42,
-0xff2f,
-0xc540,
-0xd6a,
-0xff2f,
-0xd8ff,
-0xd8ff,
-0xd980,
-0x754c,
-0x746c,
-0xc543,
-0xc542,
-0xc541,
-0xb26,
-0xff2f,
-0xc540,
-0xd850,
-0xc049,
-0x218a,
-0xfc7,
-0x40c3,
-0x9003,
-0xe048,
-0xb020,
-0x1804,
-0x5,
-0x2440,
-0x3e80,
-0x2032,
-0x6c1,
-0xc007,
-0x782b,
-0xf264,
-0xc009,
-0x702c,
-0xa9e,
-0xff2f,
-0x7810,
-0x700c,
-0xa42,
-0x60,
-0xd91e,
-0x2440,
-0x3d80,
-0x2032,
-0x6cb,
-0xc08e,
-0x2032,
-0x6cd,
-0x41a1,
-0xf00f,
-0x211a,
-0xf80,
-0x0,
-0x2000,
-0x7a34,
-0x7124,
-0x2005,
-0xf80,
-0x9002,
-0x54,
-0x9000,
-0x780f,
-0xb200,
-0xbe9,
-0x9065,
-0xc28f,
-0x702c,
-0x704c,
-0xf034,
-0x23f4,
-0x34c,
-0xc008,
-0x7bb4,
-0xbc80,
-0xb380,
-0xe886,
-0xc08f,
-0x20f4,
-0x340,
-0xe80f,
-0x235a,
-0x340e,
-0xc005,
-0x7e16,
-0x6638,
-0x2000,
-0xf80,
-0x8000,
-0x644,
-0xa8a0,
-0x7124,
-0xc008,
-0xe817,
-0x235a,
-0x340e,
-0xc005,
-0x7e16,
-0x6658,
-0x2000,
-0xf80,
-0x8000,
-0x624,
-0xa8a0,
-0x7144,
-0xc008,
-0xe88f,
-0xc005,
-0x2079,
-0x0,
-0x781b,
-0x781b,
-0x7404,
-0x7c05,
-0xb380,
-0xf005,
-0xc08f,
-0x20f4,
-0x340,
-0xe867,
-0x71a5,
-0xb9b,
-0x9365,
-0xc398,
-0x40c3,
-0x0,
-0x9c4,
-0x9ce,
-0xff0f,
-0x93e,
-0xff0f,
-0x7167,
-0x7277,
-0x408,
-0xffc5,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0x7114,
-0x3f6,
-0xffce,
-0xf01a,
-0xc006,
-0x21f4,
-0x1,
-0xe913,
-0x1600,
-0x7080,
-0x8000,
-0x19,
-0xe88d,
-0xc006,
-0x2144,
-0x301,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x154,
-0xb020,
-0xc006,
-0x7104,
-0xc046,
-0xc006,
-0x8d1,
-0x82b4,
-0xc198,
-0x40c3,
-0x8000,
-0x57c,
-0x8800,
-0xe808,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0xb8e3,
-0xd98,
-0xff41,
-0x700c,
-0x1e00,
-0x7005,
-0x9003,
-0xe048,
-0x91a,
-0x20,
-0xc193,
-0xc0bd,
-0x1404,
-0x341b,
-0xc6c6,
-0xd8ff,
-0x702c,
-0x734c,
-0xdb22,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x726c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4728,
-0x4608,
-0x4020,
-0x732c,
-0xc341,
-0xada,
-0xe0,
-0x4358,
-0x710c,
-0x4508,
-0x2644,
-0x17c0,
-0xe805,
-0xb861,
-0x8ff,
-0x8031,
-0x7dbb,
-0xb15,
-0x3031,
-0x255a,
-0x110d,
-0x40e1,
-0x732c,
-0xbd6,
-0xff2f,
-0xdabf,
-0xc001,
-0x250f,
-0x139b,
-0xe887,
-0x40e1,
-0x732c,
-0xbc2,
-0xff2f,
-0xda7f,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x265f,
-0x164d,
-0x704c,
-0x205f,
-0xc80,
-0x238a,
-0xdff,
-0x1c00,
-0x3fc1,
-0x60f8,
-0x60b9,
-0xcba,
-0x1a0,
-0x202f,
-0x6c7,
-0xa86,
-0xff8f,
-0xa8e,
-0xffaf,
-0x4300,
-0x4100,
-0x91a,
-0x120,
-0x4060,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x205f,
-0xc80,
-0x60f8,
-0x60b8,
-0x1003,
-0xc1,
-0x783d,
-0x781d,
-0x781d,
-0x781d,
-0x2044,
-0x100,
-0x7034,
-0x20c5,
-0x4ab,
-0x1e00,
-0x7004,
-0x900e,
-0x22,
-0x40e1,
-0xf62,
-0xa0,
-0x732c,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0x7a1b,
-0x1600,
-0x7080,
-0x8000,
-0x1c,
-0xbac4,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781d,
-0x780f,
-0x2144,
-0x7c2,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781d,
-0x7fe0,
-0xb8c0,
-0x78e0,
-0xc0e2,
-0x1600,
-0x7082,
-0x8000,
-0x4,
-0x7014,
-0x221a,
-0xf83,
-0x20,
-0x0,
-0x2305,
-0xf82,
-0x9002,
-0x86,
-0x9240,
-0x2305,
-0xf83,
-0x9003,
-0xfe86,
-0x22c4,
-0xf81,
-0x0,
-0xbfff,
-0xf203,
-0xba8e,
-0x70ad,
-0xb340,
-0xf01d,
-0x251a,
-0x1f82,
-0x0,
-0x1000,
-0x2205,
-0xf82,
-0x1,
-0x4a,
-0x7a5b,
-0x2205,
-0xf83,
-0x9000,
-0x0,
-0xe80b,
-0x9340,
-0x2114,
-0x34c,
-0xb440,
-0x2204,
-0xf82,
-0x0,
-0xfbff,
-0xf003,
-0x21f4,
-0x342,
-0xb340,
-0x71a5,
-0xdcd,
-0x9294,
-0xc4c2,
-0xc2e6,
-0x706c,
-0x41c3,
-0x8000,
-0x66b,
-0xdd24,
-0xa960,
-0xbd9f,
-0x8d00,
-0xe007,
-0x7a1d,
-0x7a5d,
-0x7a5d,
-0x6a09,
-0xa901,
-0x1534,
-0x108c,
-0xec0e,
-0xca04,
-0x7a1d,
-0xa942,
-0x1533,
-0x1080,
-0xe007,
-0x781d,
-0x781d,
-0x781d,
-0x6058,
-0x7704,
-0xf003,
-0xa942,
-0xa903,
-0xf01e,
-0xee05,
-0x1533,
-0x108f,
-0xf002,
-0x8de0,
-0x78cf,
-0xf16,
-0xffef,
-0x796f,
-0xe804,
-0x6f07,
-0x791d,
-0xf005,
-0x4f1f,
-0x791d,
-0x793d,
-0x793d,
-0x2314,
-0x380,
-0x793d,
-0x2000,
-0xf80,
-0x8000,
-0x620,
-0xa820,
-0x71c5,
-0xecf,
-0x9094,
-0x7164,
-0xbfb,
-0x80b4,
-0x70cd,
-0xc6c6,
-0xc0f1,
-0xa26,
-0x40,
-0xc0d1,
-0x7fe0,
-0x700c,
-0x1600,
-0x7101,
-0x8000,
-0x6,
-0x790c,
-0x2985,
-0x41f,
-0x7fe0,
-0x6901,
-0x78e0,
-0xc2e4,
-0x4200,
-0x82a,
-0xffaf,
-0x4020,
-0x41c3,
-0x8000,
-0x665,
-0x8920,
-0xe907,
-0x1600,
-0x708d,
-0x8000,
-0x58,
-0xf005,
-0x1600,
-0x708d,
-0x8000,
-0x25,
-0x706c,
-0x708d,
-0xf024,
-0x2144,
-0x7ce,
-0x4100,
-0xee06,
-0xbe61,
-0xe01,
-0x1031,
-0x793d,
-0xb9c1,
-0x933,
-0xa1,
-0x712c,
-0x2344,
-0x7ce,
-0xee05,
-0xbe61,
-0xeff,
-0x9031,
-0x793b,
-0x79ab,
-0xd910,
-0x2344,
-0x7ce,
-0x24c0,
-0x1062,
-0xee06,
-0xbe61,
-0xe01,
-0x1031,
-0x793b,
-0x79ab,
-0x24c0,
-0x1062,
-0x7164,
-0xbbd,
-0x8134,
-0x797b,
-0x4081,
-0xc6c4,
-0x78e0,
-0x2042,
-0x701,
-0x939,
-0x454,
-0x889,
-0xc30,
-0xd91a,
-0x885,
-0xd70,
-0xd90f,
-0x87d,
-0xf30,
-0xd918,
-0xe0c5,
-0xf227,
-0xe0d0,
-0xf227,
-0xe0e0,
-0xf227,
-0xe0f8,
-0xf227,
-0x208c,
-0x8c03,
-0x722c,
-0xf230,
-0x208c,
-0x8802,
-0xf419,
-0x732c,
-0xf02c,
-0x2025,
-0x40,
-0xf011,
-0xf013,
-0xf01b,
-0xf011,
-0xf01b,
-0xf00f,
-0xf01b,
-0xf00d,
-0xf00b,
-0xf01b,
-0xf009,
-0xf009,
-0xf019,
-0xf007,
-0xf005,
-0xf005,
-0xf017,
-0xd93f,
-0xf016,
-0x702c,
-0xf014,
-0xd90b,
-0xf012,
-0xd90a,
-0xf010,
-0xd907,
-0xf00e,
-0xd908,
-0xf00c,
-0xd93e,
-0xf00a,
-0xd93b,
-0xf008,
-0xd93a,
-0xf006,
-0xd91f,
-0xf004,
-0xd938,
-0xf002,
-0xd91b,
-0x7fe0,
-0x4020,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b6,
-0xc253,
-0x4328,
-0xc052,
-0x4020,
-0x702c,
-0xaee,
-0xff2f,
-0x734c,
-0xc054,
-0x4061,
-0x742c,
-0xae2,
-0xff2f,
-0xda08,
-0x1600,
-0x708e,
-0x8000,
-0x667,
-0x70ed,
-0xc055,
-0xf03c,
-0xc015,
-0xc114,
-0x20ca,
-0x46,
-0xe837,
-0x7def,
-0x60bf,
-0x1a12,
-0x3098,
-0x7bef,
-0xc081,
-0x722c,
-0x42a1,
-0xcf6,
-0xff6f,
-0x4378,
-0x1212,
-0x3081,
-0xc213,
-0x9ba,
-0x120,
-0xc081,
-0xc812,
-0x1203,
-0x3081,
-0x82b,
-0x44,
-0x1202,
-0x3081,
-0x923,
-0x4,
-0xc031,
-0x1443,
-0x30c3,
-0x1442,
-0x3082,
-0xc040,
-0x41c3,
-0x69,
-0x3,
-0xafa,
-0xff2f,
-0x740c,
-0xde2,
-0xff2f,
-0xc081,
-0x2454,
-0x3840,
-0x722c,
-0x42a1,
-0x8a6,
-0x1a0,
-0x4363,
-0xc012,
-0x712c,
-0xdde,
-0x120,
-0xc281,
-0x71c5,
-0x40c3,
-0x8000,
-0x667,
-0x8801,
-0x79cf,
-0x883,
-0x8065,
-0x222f,
-0x8042,
-0xc0b6,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b7,
-0xc056,
-0xd8ff,
-0x702c,
-0xa2e,
-0xff2f,
-0x734c,
-0x4508,
-0xd8ff,
-0x742c,
-0xa22,
-0xff2f,
-0xda08,
-0x60ba,
-0xca06,
-0x794f,
-0x43db,
-0x8000,
-0x667,
-0x782a,
-0xc052,
-0x785b,
-0xc053,
-0x1600,
-0x70c0,
-0x8000,
-0x1e,
-0x7014,
-0x740c,
-0xc054,
-0xf648,
-0x1301,
-0x3080,
-0x7104,
-0xc054,
-0xc012,
-0xc053,
-0x1300,
-0x308f,
-0x702c,
-0xf056,
-0xc013,
-0xc312,
-0x7a0f,
-0x62b8,
-0x7e6f,
-0x70d1,
-0xa97,
-0x30,
-0x26ca,
-0x1005,
-0x78fd,
-0x5052,
-0x78cf,
-0xc055,
-0xc315,
-0xc081,
-0x712c,
-0xc06,
-0xff6f,
-0x42a1,
-0x1212,
-0x3081,
-0xc081,
-0x8ca,
-0x120,
-0x704c,
-0xc812,
-0x1203,
-0x3081,
-0x82d,
-0x44,
-0x1202,
-0x3081,
-0x925,
-0x4,
-0xc031,
-0x1443,
-0x30c3,
-0x1442,
-0x3082,
-0xc040,
-0x41c3,
-0x70,
-0x3,
-0xa06,
-0xff2f,
-0x740c,
-0xcf2,
-0xff2f,
-0xc081,
-0xc315,
-0x2454,
-0x3840,
-0x712c,
-0xfb2,
-0x160,
-0x42a1,
-0xc016,
-0xdca,
-0xff6f,
-0x702c,
-0x1443,
-0x3081,
-0xc481,
-0xc331,
-0xe10f,
-0x7a2f,
-0x7c54,
-0x8c21,
-0x7962,
-0x7a2f,
-0x8c20,
-0x4b31,
-0x792f,
-0x2109,
-0x81,
-0x8841,
-0x909,
-0x85,
-0xa821,
-0x41c1,
-0xc014,
-0x780f,
-0x671f,
-0x1301,
-0x3080,
-0x7fef,
-0x855,
-0x83e5,
-0x7d2f,
-0xc0b7,
-0x1404,
-0x341b,
-0xc6c6,
-0x264a,
-0x3000,
-0xf010,
-0x265a,
-0x3c83,
-0x607c,
-0x235a,
-0x1643,
-0x7165,
-0x639b,
-0x633b,
-0x8b80,
-0x7c45,
-0xab80,
-0xbeb,
-0x9094,
-0x2640,
-0x305e,
-0xef9,
-0xb0b4,
-0x706d,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1bb,
-0x9fe,
-0xffaf,
-0xc082,
-0xc082,
-0xd90d,
-0xfc6,
-0xffef,
-0xdac8,
-0x1600,
-0x7080,
-0x8000,
-0x1b,
-0x897,
-0x1e,
-0x40c3,
-0x8000,
-0x665,
-0x880e,
-0x88b,
-0x30,
-0xdb4b,
-0x40c3,
-0x8000,
-0x665,
-0x888d,
-0x40c3,
-0x8000,
-0x665,
-0x88ac,
-0x40c3,
-0x8000,
-0x665,
-0x88cb,
-0x40c3,
-0x8000,
-0x665,
-0x882a,
-0xbb9f,
-0x1b01,
-0x52,
-0x40c3,
-0x8000,
-0x665,
-0x88eb,
-0x40c3,
-0x8000,
-0x665,
-0xabe0,
-0x884c,
-0x279a,
-0x1004,
-0x1b32,
-0x82,
-0xc165,
-0x1c2d,
-0x3382,
-0x1c46,
-0x3342,
-0x1c5f,
-0x3302,
-0x13b8,
-0x8080,
-0x7f25,
-0x41c3,
-0x8000,
-0x665,
-0x205f,
-0x18d,
-0x46cb,
-0x12,
-0x310,
-0x892d,
-0x44cb,
-0x9000,
-0x0,
-0x65d8,
-0x7885,
-0xb0e0,
-0x1b33,
-0x42,
-0x219a,
-0x4,
-0x6e02,
-0x60b8,
-0x7885,
-0x7945,
-0xb020,
-0xd8ff,
-0xc040,
-0xc082,
-0x712c,
-0x42c3,
-0x40,
-0x5800,
-0xb92,
-0x1a0,
-0x706c,
-0xb1e,
-0x0,
-0x87a,
-0xff0f,
-0xb52,
-0x40,
-0x700c,
-0x1e00,
-0x7004,
-0x9004,
-0xdc,
-0x256f,
-0x1cc3,
-0x8d00,
-0xe8a4,
-0x702c,
-0x782f,
-0x1e00,
-0x7042,
-0x8000,
-0x665,
-0x839,
-0x95,
-0xe812,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0x7014,
-0x710c,
-0xf20a,
-0x6901,
-0xd36,
-0xff2f,
-0x780f,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x6821,
-0xf1e9,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0x7014,
-0x700c,
-0xf5f0,
-0xf1f8,
-0xd12,
-0xff2f,
-0x730c,
-0x41c3,
-0x8000,
-0x665,
-0x700c,
-0xa901,
-0x1e00,
-0x7002,
-0x8000,
-0x665,
-0x8d00,
-0x7014,
-0xf4b5,
-0x41c3,
-0x9004,
-0x30,
-0x11b4,
-0x502,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0xc041,
-0xa0d,
-0x171,
-0xb100,
-0xc001,
-0xf006,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0xb101,
-0xc001,
-0x86d,
-0x30,
-0x716f,
-0x1600,
-0x7080,
-0x8000,
-0x32,
-0xb8e3,
-0x40c3,
-0x8000,
-0x665,
-0x88e6,
-0xc001,
-0x23ca,
-0x30a1,
-0x2044,
-0x8e,
-0x2044,
-0x4d,
-0xf01d,
-0xc101,
-0x209a,
-0x4,
-0xb9c1,
-0x7905,
-0x40c1,
-0xf849,
-0x271a,
-0x1f80,
-0x0,
-0x2000,
-0xf84c,
-0xed07,
-0x79ef,
-0x700c,
-0x4263,
-0x882,
-0xff6f,
-0x716c,
-0xee08,
-0x79ef,
-0x710c,
-0x4263,
-0x876,
-0xff6f,
-0x716c,
-0x71e5,
-0x40c3,
-0x8000,
-0x665,
-0x8807,
-0x8c5,
-0x83e5,
-0x40a1,
-0x1600,
-0x708d,
-0x8000,
-0x58,
-0xd79,
-0x1030,
-0x716f,
-0x1600,
-0x7080,
-0x8000,
-0x65,
-0x2544,
-0x108e,
-0xb8e3,
-0x40c3,
-0x8000,
-0x665,
-0x8808,
-0x23ca,
-0x30a1,
-0x2544,
-0x104f,
-0xc041,
-0xf022,
-0x209a,
-0x4,
-0x2553,
-0x1041,
-0x7905,
-0x40c1,
-0xf82c,
-0xc001,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0xf82e,
-0xef09,
-0xc001,
-0x4263,
-0x716c,
-0x790f,
-0x80a,
-0xff6f,
-0x700c,
-0xee09,
-0xc001,
-0x4263,
-0x716c,
-0x790f,
-0xffa,
-0xff2f,
-0x710c,
-0xc001,
-0x7104,
-0xc041,
-0x40c3,
-0x8000,
-0x665,
-0x8829,
-0xc001,
-0x9b9,
-0x8025,
-0x40e1,
-0x1600,
-0x708e,
-0x8000,
-0x4,
-0xb76,
-0xff4f,
-0xb7e,
-0xff6f,
-0x4508,
-0x4100,
-0xa0a,
-0xe0,
-0x40a1,
-0x261a,
-0x1f8c,
-0x20,
-0x0,
-0x43c3,
-0x9008,
-0x1ea,
-0x9300,
-0x45cb,
-0x9012,
-0x402,
-0x2405,
-0x1342,
-0x2004,
-0xf81,
-0x0,
-0x3f00,
-0xb220,
-0x6d44,
-0x7a85,
-0x2196,
-0x6,
-0xb220,
-0x9321,
-0x6d02,
-0x7885,
-0xb9c5,
-0xb020,
-0x40c3,
-0x9003,
-0xe174,
-0x702c,
-0xb020,
-0xcca,
-0xff2f,
-0xb021,
-0xc0bb,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0x209a,
-0x4,
-0x7905,
-0x4063,
-0x209a,
-0x10,
-0x2105,
-0x2,
-0x7ee0,
-0x78e0,
-0x2005,
-0xf81,
-0x9002,
-0x154,
-0x9100,
-0x7845,
-0xb100,
-0x7ee0,
-0xc2e4,
-0xc1a4,
-0x4608,
-0x700c,
-0x89a,
-0xfeef,
-0xd9ff,
-0x1200,
-0x3083,
-0x702c,
-0xd8ff,
-0x754c,
-0x4528,
-0xc143,
-0xc142,
-0xc141,
-0x976,
-0xfeef,
-0xc140,
-0xbec1,
-0xd8ff,
-0xd980,
-0x764c,
-0xdb20,
-0xc543,
-0xc642,
-0xc541,
-0x962,
-0xfeef,
-0x1c00,
-0x3041,
-0x700c,
-0x8fa,
-0xfeef,
-0x712c,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0xc2e4,
-0xc1a4,
-0xd858,
-0xb89f,
-0x88c0,
-0x10cd,
-0x808d,
-0x700c,
-0x846,
-0xfeef,
-0xd9ff,
-0x2605,
-0x1341,
-0x700c,
-0xb9c1,
-0xc043,
-0xc142,
-0xc041,
-0xc040,
-0xd8ff,
-0xd980,
-0xda09,
-0x91e,
-0xfeef,
-0xdb20,
-0x700c,
-0x8ba,
-0xfeef,
-0x712c,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0x21aa,
-0xc4,
-0x911,
-0x3f,
-0x722c,
-0x21ab,
-0xc4,
-0x712c,
-0x21ab,
-0xc4,
-0x80f,
-0x415,
-0x1600,
-0x7100,
-0x9008,
-0x1d6,
-0x7ee0,
-0x21aa,
-0x104,
-0x7b32,
-0xb19,
-0x25,
-0x24aa,
-0x1144,
-0x22aa,
-0x104,
-0x9fd,
-0x8084,
-0x7862,
-0x24aa,
-0x1144,
-0xf003,
-0x6038,
-0x21aa,
-0x104,
-0x7110,
-0x20e1,
-0x7c6,
-0x22aa,
-0x144,
-0xcf3,
-0x9080,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0x866,
-0x0,
-0xfa6,
-0xffcf,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0xf5a,
-0xffcf,
-0xf96,
-0xffef,
-0xd814,
-0xc0d1,
-0x7ee0,
-0xc0f1,
-0x846,
-0x0,
-0x41c3,
-0x8000,
-0x57c,
-0x8920,
-0x781b,
-0xe915,
-0x1600,
-0x7081,
-0x8000,
-0x1,
-0x923,
-0xdf,
-0x41c3,
-0x8000,
-0x664,
-0x8920,
-0x917,
-0x134,
-0x216c,
-0x41,
-0x2809,
-0x8042,
-0xf208,
-0x6038,
-0x7842,
-0xf004,
-0x809,
-0x115,
-0x740c,
-0xc0d1,
-0x7ee0,
-0x246f,
-0x1343,
-0x9460,
-0x231a,
-0x2,
-0x2a05,
-0xf82,
-0x1e,
-0x8480,
-0x817,
-0xf84,
-0x3,
-0xd41,
-0x2885,
-0xa0f,
-0x201a,
-0xc2,
-0x2a85,
-0x41f,
-0x793d,
-0x6a01,
-0x6941,
-0x41c3,
-0x8000,
-0x57c,
-0x8920,
-0xe90c,
-0x14fb,
-0x9081,
-0x915,
-0xdf,
-0x41c3,
-0x8000,
-0x664,
-0x8920,
-0x7034,
-0x22da,
-0x42,
-0x7210,
-0x7fe0,
-0x20ca,
-0x8d,
-0xc2e6,
-0x8b2,
-0xff6f,
-0xc1a4,
-0x781d,
-0x781d,
-0x781d,
-0x791d,
-0xb9c3,
-0xdd58,
-0x1a04,
-0x3042,
-0xbd9f,
-0x8d00,
-0xe80b,
-0x215f,
-0x100,
-0x1600,
-0x7082,
-0x8000,
-0x57,
-0x2044,
-0xe00,
-0x621e,
-0xf005,
-0x1600,
-0x708e,
-0x8000,
-0x24,
-0x87a,
-0xff4f,
-0x79cf,
-0x7b3d,
-0x7a3d,
-0x2653,
-0x907e,
-0x7b7d,
-0x7a5d,
-0x23c0,
-0x62,
-0x7a5d,
-0x2653,
-0x9081,
-0xb8c3,
-0x22c0,
-0x62,
-0x1a05,
-0x3002,
-0x1a07,
-0x30c2,
-0x1a09,
-0x3042,
-0x1a06,
-0x3082,
-0xc040,
-0x41c3,
-0xeb,
-0x3,
-0xc76,
-0xfeef,
-0xd80a,
-0x276f,
-0x10c3,
-0x8f00,
-0xb8e2,
-0x700c,
-0x20ca,
-0xe1,
-0x1a0a,
-0x3002,
-0x1724,
-0x1082,
-0x170f,
-0x1481,
-0x2742,
-0x1280,
-0x9000,
-0x8d60,
-0x97c0,
-0x8f82,
-0xc043,
-0xc142,
-0xd80a,
-0x41c3,
-0xed,
-0x6,
-0xc441,
-0xc3e,
-0xfeef,
-0xc640,
-0x8f08,
-0xe808,
-0x41c3,
-0xf2,
-0x0,
-0xc2e,
-0xfeef,
-0xd80a,
-0xde32,
-0xbe9f,
-0x1601,
-0x1483,
-0x16d1,
-0x9082,
-0x1601,
-0x148c,
-0x1602,
-0x1481,
-0x1601,
-0x1480,
-0xc440,
-0xc141,
-0xc042,
-0x41c3,
-0xf3,
-0x5,
-0xc02,
-0xfeef,
-0xd80a,
-0x1601,
-0x1483,
-0x8e21,
-0x8e04,
-0x16cc,
-0x9082,
-0x8e80,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0xf4,
-0x5,
-0xbe2,
-0xfeef,
-0xc440,
-0x8f08,
-0x8b5,
-0x11,
-0x8f15,
-0x831,
-0x7e,
-0xdf3e,
-0xf840,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0xf5,
-0x5,
-0xbc2,
-0xfeef,
-0xc440,
-0xf841,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0xf6,
-0x5,
-0xbae,
-0xfeef,
-0xc440,
-0x8d00,
-0x833,
-0x3e,
-0xdf65,
-0xf834,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0xf7,
-0x5,
-0xb92,
-0xfeef,
-0xc440,
-0xf835,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0xf8,
-0x5,
-0xb7e,
-0xfeef,
-0xc440,
-0x8d00,
-0x851,
-0x7e,
-0xdd71,
-0xbd9f,
-0x1501,
-0x1483,
-0x1501,
-0x148c,
-0x1502,
-0x1481,
-0x1501,
-0x1480,
-0x16cc,
-0x9082,
-0xc141,
-0xc042,
-0xd80a,
-0x41c3,
-0xf9,
-0x5,
-0xb4e,
-0xfeef,
-0xc440,
-0x1501,
-0x1483,
-0x8d21,
-0x8d04,
-0x16cc,
-0x9082,
-0x8d80,
-0xc042,
-0xc141,
-0xd80a,
-0x41c3,
-0xfa,
-0x5,
-0xb2e,
-0xfeef,
-0xc440,
-0x40c3,
-0x9008,
-0x1a0,
-0x1802,
-0x15,
-0x218a,
-0x44,
-0x1802,
-0x54,
-0x218a,
-0x144,
-0x1802,
-0x54,
-0x218a,
-0x1c4,
-0x1804,
-0x54,
-0x218a,
-0x88,
-0xb020,
-0x218a,
-0x288,
-0xb021,
-0x218a,
-0x2c8,
-0xb022,
-0x208a,
-0x3cc,
-0x1e00,
-0x7004,
-0x9009,
-0xe180,
-0xd934,
-0x40c3,
-0x9005,
-0xe0ee,
-0xb020,
-0xd4e,
-0xffef,
-0x18fc,
-0x8105,
-0xc0a4,
-0xc6c6,
-0x78e0,
-0xbf9f,
-0x1701,
-0x1483,
-0x1701,
-0x148c,
-0x1702,
-0x1481,
-0x1701,
-0x1480,
-0x16cc,
-0x9082,
-0x7ee0,
-0x1701,
-0x1483,
-0x8f21,
-0x8f04,
-0x16cc,
-0x9082,
-0x8f80,
-0x7ee0,
-0x621a,
-0xf004,
-0x1801,
-0x52,
-0x8fd,
-0x8084,
-0x7ee0,
-0x78e0,
-0x2014,
-0x82,
-0xf003,
-0x1802,
-0x54,
-0x8ff,
-0x8084,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a5,
-0xde07,
-0xbe8c,
-0x40c3,
-0x0,
-0x9f38,
-0x45cb,
-0x9012,
-0x328,
-0x1e00,
-0x7384,
-0x8000,
-0x2,
-0xb500,
-0xd858,
-0xb501,
-0x41c3,
-0x14c,
-0x0,
-0xa5a,
-0xfeef,
-0xd80a,
-0xd80a,
-0x41c3,
-0x150,
-0x1,
-0xa4e,
-0xfeef,
-0x42c1,
-0xcc34,
-0x9520,
-0x7030,
-0x700c,
-0xf405,
-0xcc35,
-0x9521,
-0x2038,
-0x40,
-0x41c3,
-0x151,
-0x0,
-0xa7e,
-0xfe8f,
-0x45cb,
-0x8000,
-0x57c,
-0x1d00,
-0x1043,
-0x1600,
-0x709b,
-0x8000,
-0x4,
-0x1a00,
-0x3103,
-0x231a,
-0x3f80,
-0x20,
-0x0,
-0xc041,
-0x2005,
-0xf81,
-0x9004,
-0x32,
-0x206f,
-0x243,
-0x9006,
-0xc040,
-0x9100,
-0xc042,
-0xc001,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0xd26,
-0xa0,
-0x9000,
-0xc000,
-0xb8e0,
-0x234,
-0x1,
-0xc001,
-0x2005,
-0xf81,
-0x9005,
-0xe032,
-0xc002,
-0xb880,
-0xb100,
-0xc001,
-0x2005,
-0xf80,
-0x9003,
-0xe090,
-0xc72,
-0x20,
-0x1800,
-0x5,
-0x266f,
-0x1cc3,
-0x8e00,
-0xe885,
-0x1e00,
-0x7085,
-0x9004,
-0xc0,
-0xcc6,
-0xffcf,
-0xc32,
-0xff4f,
-0x8e00,
-0x89d,
-0x11,
-0x1600,
-0x7080,
-0x8000,
-0x4,
-0x41c3,
-0x9002,
-0x86,
-0x1600,
-0x7082,
-0x8000,
-0x0,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x231a,
-0x3f9b,
-0x10,
-0x0,
-0x7825,
-0x9000,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0xb8c2,
-0x823,
-0x90,
-0x827,
-0xf1,
-0x228b,
-0x803e,
-0x42c3,
-0x8000,
-0x42c,
-0xce0a,
-0x705c,
-0x5016,
-0x42c3,
-0x8000,
-0x444,
-0xce10,
-0xf011,
-0xce09,
-0x5016,
-0xce0f,
-0xf00e,
-0x228b,
-0x803e,
-0x42c3,
-0x8000,
-0x420,
-0xce07,
-0x705c,
-0x5016,
-0x42c3,
-0x8000,
-0x438,
-0xce0d,
-0x705c,
-0x5034,
-0xc001,
-0x7825,
-0xcfe,
-0xa0,
-0x90c0,
-0xc8a,
-0xa0,
-0x4063,
-0xc001,
-0xbea0,
-0x2005,
-0xf81,
-0x9003,
-0xfe86,
-0xb1c0,
-0xbd2,
-0x0,
-0xbd6,
-0xff8f,
-0x942,
-0xfecf,
-0xd72,
-0xff4f,
-0xca06,
-0x704c,
-0x70cd,
-0xf036,
-0x265a,
-0x1483,
-0x657c,
-0xb441,
-0xf02d,
-0x261a,
-0x1f81,
-0x0,
-0x1000,
-0x79e5,
-0x793b,
-0x2105,
-0xf81,
-0x9002,
-0x140,
-0x9120,
-0x262f,
-0x3047,
-0xf11,
-0x17a1,
-0x716d,
-0x8c22,
-0x210f,
-0x3c1,
-0xac22,
-0xf018,
-0x8c23,
-0x2644,
-0x37db,
-0x7124,
-0xac23,
-0x792f,
-0x2314,
-0x41,
-0x61b9,
-0x260a,
-0x32c0,
-0xa9e3,
-0xb11,
-0x3010,
-0x2342,
-0x305b,
-0xbfd,
-0xb031,
-0x262f,
-0x3780,
-0x1902,
-0x782,
-0x71e5,
-0xfab,
-0x9214,
-0x71c5,
-0xe99,
-0x9024,
-0x70ed,
-0x1600,
-0x708f,
-0x8000,
-0x25,
-0xef28,
-0x1600,
-0x7080,
-0x8000,
-0x32,
-0x1600,
-0x709b,
-0x8000,
-0x66b,
-0x71cd,
-0xb8e3,
-0x26ca,
-0x10a1,
-0xf014,
-0xf15,
-0x103e,
-0x212f,
-0x6c7,
-0x700c,
-0x42c1,
-0x91a,
-0xff2f,
-0x706c,
-0xf13,
-0x107e,
-0x212f,
-0x6c7,
-0x710c,
-0x42c1,
-0x906,
-0xff2f,
-0x706c,
-0x7167,
-0x40c3,
-0x8000,
-0x66b,
-0x8801,
-0x8d3,
-0x86c5,
-0x1600,
-0x708f,
-0x8000,
-0x58,
-0xef28,
-0x1600,
-0x7080,
-0x8000,
-0x65,
-0x71cd,
-0xb8e3,
-0x40c3,
-0x8000,
-0x66b,
-0x1002,
-0x9b,
-0x26ca,
-0x10a1,
-0xf014,
-0xf15,
-0x103e,
-0x212f,
-0x6c7,
-0x700c,
-0x42c1,
-0x8c2,
-0xff2f,
-0x706c,
-0xf13,
-0x107e,
-0x212f,
-0x6c7,
-0x710c,
-0x42c1,
-0x8ae,
-0xff2f,
-0x706c,
-0x7167,
-0x40c3,
-0x8000,
-0x66b,
-0x8803,
-0x8d3,
-0x86c5,
-0xc000,
-0x80b,
-0x33f,
-0x710c,
-0xf005,
-0xaba,
-0x20,
-0xd80d,
-0x700c,
-0xcd6,
-0x140,
-0xd62,
-0xfe8f,
-0x700c,
-0xaa6,
-0x20,
-0x1d00,
-0x1003,
-0xca06,
-0x70ad,
-0x706c,
-0xf01a,
-0x704c,
-0xf015,
-0x231a,
-0xf81,
-0x0,
-0x1000,
-0x2300,
-0x1f8c,
-0x8000,
-0x1b98,
-0x7165,
-0x7945,
-0x793b,
-0x2105,
-0xf81,
-0x9002,
-0x140,
-0x91c0,
-0xacc0,
-0xb140,
-0x7144,
-0xadd,
-0x8214,
-0x7164,
-0xbd1,
-0x8024,
-0x2516,
-0x10cb,
-0xc000,
-0x853,
-0x1be,
-0x700c,
-0x46cb,
-0x8000,
-0x665,
-0xae00,
-0x780f,
-0x83d,
-0x95,
-0xe814,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0x7014,
-0x710c,
-0xf20a,
-0xf877,
-0xc9a,
-0xe0,
-0x1e01,
-0x1003,
-0xa2e,
-0x20,
-0x760c,
-0x8e00,
-0x7104,
-0xf1eb,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0x7014,
-0x700c,
-0xf5ef,
-0xf1f8,
-0xbea,
-0xfeef,
-0x730c,
-0xc000,
-0xb8e5,
-0xf299,
-0x46cb,
-0x8000,
-0x665,
-0xf08d,
-0xe809,
-0x1600,
-0x7080,
-0x8000,
-0x58,
-0x7014,
-0x710c,
-0xf40a,
-0xf082,
-0x1600,
-0x7080,
-0x8000,
-0x25,
-0x7014,
-0x700c,
-0xf27c,
-0xf860,
-0x700c,
-0xc040,
-0x710c,
-0xba6,
-0xff2f,
-0x1e01,
-0x1003,
-0x8e01,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0x205f,
-0x641,
-0x8e00,
-0x251a,
-0x1f8d,
-0x20,
-0x0,
-0x205f,
-0xc80,
-0x2505,
-0x1f8f,
-0x9002,
-0x86,
-0x6119,
-0x6638,
-0x8816,
-0xc043,
-0xaf2,
-0xff2f,
-0x710c,
-0x97e0,
-0x712c,
-0x802,
-0x60,
-0x4318,
-0x2505,
-0x1f80,
-0x9003,
-0xfe86,
-0x2746,
-0x134f,
-0xc044,
-0xb0e0,
-0x258a,
-0x1fc7,
-0xc003,
-0x714c,
-0x706c,
-0xb8e6,
-0xd8ff,
-0x25ca,
-0x1001,
-0x4063,
-0xd4e,
-0x20,
-0x41a1,
-0x1600,
-0x7080,
-0x8000,
-0x1d,
-0x86b,
-0x3e,
-0xbf82,
-0xc004,
-0x41c3,
-0x8f,
-0x0,
-0xb0e0,
-0xf838,
-0xd2e,
-0x20,
-0xdb40,
-0x41c3,
-0x90,
-0x0,
-0xf834,
-0xd22,
-0x20,
-0xdb30,
-0x4063,
-0x41a1,
-0x724c,
-0xd16,
-0x20,
-0x706c,
-0xf01b,
-0x1600,
-0x7081,
-0x8000,
-0x1f,
-0xc000,
-0x925,
-0xe,
-0xc000,
-0x201a,
-0xf80,
-0x20,
-0x0,
-0x2005,
-0xf81,
-0x9003,
-0xfe86,
-0x2005,
-0xf80,
-0x9002,
-0x86,
-0x9000,
-0xb8a0,
-0xb100,
-0xc000,
-0x7104,
-0xc040,
-0xc000,
-0x8cb,
-0x8134,
-0x750c,
-0x8f2,
-0x0,
-0x8e00,
-0x68a1,
-0x78af,
-0x7114,
-0x6e8,
-0xffee,
-0xaea0,
-0xab6,
-0xfeef,
-0x730c,
-0xc76,
-0xff8f,
-0xca06,
-0x706f,
-0x704c,
-0xf017,
-0x706c,
-0xf012,
-0x221a,
-0xf81,
-0x0,
-0x1000,
-0x7965,
-0x793b,
-0x2105,
-0xf8c,
-0x9002,
-0x140,
-0x2332,
-0x1f81,
-0x8000,
-0x1b98,
-0x7164,
-0x7165,
-0xb420,
-0xbdf,
-0x8214,
-0x7144,
-0xad7,
-0x8024,
-0x2316,
-0x308b,
-0xc001,
-0x2005,
-0xf81,
-0x9005,
-0xe032,
-0xc002,
-0xb100,
-0xa4e,
-0xfeef,
-0x700c,
-0x86e,
-0x80,
-0x912,
-0xe0,
-0xd807,
-0x23ab,
-0x30c4,
-0x7fff,
-0xf000,
-0xc0f1,
-0xd82,
-0xfeaf,
-0x740c,
-0x4063,
-0x41a1,
-0x704c,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0xd3e,
-0xfe8f,
-0x8e00,
-0x7104,
-0xa2e,
-0xfeef,
-0x780f,
-0xb02,
-0xfe8f,
-0xc0d1,
-0x7ee0,
-0xc2e2,
-0x45cb,
-0x9004,
-0x4,
-0x9500,
-0xb8a1,
-0xb500,
-0xf52,
-0xffaf,
-0x740c,
-0xd81f,
-0xf4a,
-0xffaf,
-0x1df6,
-0x105d,
-0xc6c2,
-0xc2e2,
-0xf3e,
-0xffaf,
-0xd81f,
-0x45cb,
-0x9004,
-0x1f0,
-0x740c,
-0xf2e,
-0xffaf,
-0x1d00,
-0x1005,
-0x150a,
-0x9700,
-0xb881,
-0x1d0a,
-0x901c,
-0xc6c2,
-0xc0f1,
-0x1600,
-0x7081,
-0x8000,
-0x12,
-0x218c,
-0x8203,
-0x884,
-0xce,
-0x80e,
-0x0,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc2e2,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x81b,
-0x3e,
-0xd80a,
-0x45cb,
-0x9005,
-0xe036,
-0xeea,
-0xffaf,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0x40c3,
-0x9004,
-0xf2,
-0x1800,
-0x45,
-0x7fe0,
-0x1800,
-0x5,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a8,
-0x4608,
-0x40c3,
-0x8000,
-0x669,
-0x8800,
-0xc146,
-0x702c,
-0x201a,
-0xf80,
-0x0,
-0x2000,
-0x2005,
-0xf80,
-0x9002,
-0x40,
-0x9000,
-0xc044,
-0xeb6,
-0xfe6f,
-0x700c,
-0x1200,
-0x3083,
-0xd981,
-0x70ad,
-0xd8ff,
-0xb98e,
-0x754c,
-0xc543,
-0xc542,
-0xc541,
-0xf8e,
-0xfe6f,
-0xc540,
-0x700c,
-0xf2a,
-0xfe6f,
-0x712c,
-0x8da,
-0xff0f,
-0x8e2,
-0xff2f,
-0xc047,
-0x40c3,
-0x0,
-0x2710,
-0xee2,
-0xffaf,
-0xd908,
-0x40c3,
-0x900f,
-0xe0c0,
-0x1800,
-0x205,
-0xb0a5,
-0xc004,
-0x790f,
-0xe66,
-0xfe6f,
-0x700c,
-0x702c,
-0x716f,
-0xd8ff,
-0xb98e,
-0x754c,
-0x746c,
-0xc543,
-0xc542,
-0x1c04,
-0x36c0,
-0xf42,
-0xfe6f,
-0xc540,
-0x7fcf,
-0xf8b8,
-0xc543,
-0xc742,
-0xc541,
-0xf32,
-0xfe6f,
-0xc540,
-0xbec1,
-0xc645,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0xf16,
-0xfe6f,
-0xc540,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0xdb28,
-0xc543,
-0xefe,
-0xfe6f,
-0xc540,
-0x942,
-0xfeaf,
-0xd8ff,
-0xc104,
-0xc007,
-0x46cb,
-0x0,
-0x3100,
-0x2014,
-0x41,
-0x4968,
-0xb8c0,
-0x6038,
-0xe030,
-0xc044,
-0xc006,
-0xe804,
-0x1c0c,
-0x3441,
-0xf068,
-0xf8a0,
-0xc543,
-0xc742,
-0xc541,
-0xec6,
-0xfe6f,
-0xc540,
-0xf89a,
-0xc543,
-0xc742,
-0x1c04,
-0x36c0,
-0xeb6,
-0xfe6f,
-0xc540,
-0xf893,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xea6,
-0xfe6f,
-0xc540,
-0xf895,
-0xc543,
-0xc742,
-0xc541,
-0xe9a,
-0xfe6f,
-0xc540,
-0x750c,
-0xc041,
-0xf88d,
-0xc543,
-0xc742,
-0xe8a,
-0xfe6f,
-0xc540,
-0xf887,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xe7a,
-0xfe6f,
-0xc540,
-0x750c,
-0xc043,
-0xf882,
-0xc742,
-0xc541,
-0xe6a,
-0xfe6f,
-0xc540,
-0xf885,
-0xc543,
-0xc742,
-0xc541,
-0xe5a,
-0xfe6f,
-0xc540,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0xe42,
-0xfe6f,
-0xc540,
-0xf876,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xe32,
-0xfe6f,
-0xc540,
-0xf878,
-0xc543,
-0xc742,
-0xc541,
-0xe26,
-0xfe6f,
-0xc540,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0x746c,
-0xc543,
-0xe0e,
-0xfe6f,
-0xc540,
-0x1c0c,
-0x36c0,
-0xf867,
-0xc742,
-0xc541,
-0xdfe,
-0xfe6f,
-0xc540,
-0xc004,
-0x70ad,
-0x702c,
-0x780f,
-0xc044,
-0xc304,
-0xd8ff,
-0x754c,
-0xc543,
-0xc542,
-0xc541,
-0xde2,
-0xfe6f,
-0xc540,
-0xc006,
-0x46cb,
-0x0,
-0x2100,
-0x7014,
-0xf26d,
-0x714c,
-0xd8ff,
-0x41c1,
-0x746c,
-0x4358,
-0xc543,
-0xc742,
-0xc541,
-0xdbe,
-0xfe6f,
-0xc540,
-0xf858,
-0xc543,
-0xc742,
-0x1c04,
-0x36c0,
-0xdae,
-0xfe6f,
-0xc540,
-0xf84e,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xd9e,
-0xfe6f,
-0xc540,
-0xf847,
-0xc543,
-0xc742,
-0xc541,
-0xd92,
-0xfe6f,
-0xc540,
-0x750c,
-0xc041,
-0xf84b,
-0xc543,
-0xc742,
-0xd82,
-0xfe6f,
-0xc540,
-0xf842,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xd72,
-0xfe6f,
-0xc540,
-0x750c,
-0xc043,
-0xf83d,
-0xc742,
-0xc541,
-0xd62,
-0xfe6f,
-0xc540,
-0xf837,
-0xc543,
-0xc742,
-0xc541,
-0xd52,
-0xfe6f,
-0xc540,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0x1c04,
-0x36c0,
-0xd3a,
-0xfe6f,
-0xc540,
-0xf831,
-0x1c0c,
-0x36c0,
-0xc742,
-0xc541,
-0xd2a,
-0xfe6f,
-0xc540,
-0xf82a,
-0xc543,
-0xc742,
-0xc541,
-0xd1e,
-0xfe6f,
-0xc540,
-0xc005,
-0x702c,
-0x764c,
-0xc042,
-0x750c,
-0xc041,
-0xd8ff,
-0x746c,
-0xc543,
-0xd06,
-0xfe6f,
-0xc540,
-0x1c0c,
-0x36c0,
-0xf003,
-0x1c0c,
-0x3441,
-0xf821,
-0xc742,
-0xc541,
-0xcee,
-0xfe6f,
-0xc540,
-0xc304,
-0x702c,
-0xd8ff,
-0x754c,
-0x4528,
-0xc143,
-0xc142,
-0xc141,
-0xcda,
-0xfe6f,
-0xc140,
-0x702c,
-0xd8ff,
-0xb98f,
-0x754c,
-0x746c,
-0x1c0c,
-0x30c1,
-0xc542,
-0xc541,
-0xcc2,
-0xfe6f,
-0xc540,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb30,
-0xc543,
-0xc542,
-0xc541,
-0xcae,
-0xfe6f,
-0xc540,
-0xed6,
-0xfe6f,
-0xd8ff,
-0xc005,
-0xd980,
-0x764c,
-0xc042,
-0xd8ff,
-0x746c,
-0xc543,
-0xc541,
-0xc92,
-0xfe6f,
-0x1c00,
-0x3041,
-0xc0a8,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x714c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x714c,
-0xdb08,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x724c,
-0xdb08,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xd8ff,
-0x41c1,
-0x724c,
-0x746c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3103,
-0xc244,
-0xc143,
-0xc047,
-0xc088,
-0x41c3,
-0x0,
-0x7f00,
-0xda51,
-0xe86,
-0xffaf,
-0xc345,
-0x40c3,
-0x9003,
-0xe024,
-0x1800,
-0xfc5,
-0x180c,
-0xfc5,
-0x18fe,
-0x8005,
-0x238a,
-0x3002,
-0xc005,
-0x70ad,
-0xe0b0,
-0xd840,
-0x23ca,
-0x3001,
-0xc005,
-0x2079,
-0xc00,
-0x781b,
-0x781b,
-0x781b,
-0x781b,
-0xe030,
-0xc046,
-0xf06a,
-0xc007,
-0x8cf,
-0x36e,
-0x7eaf,
-0xc203,
-0x40c1,
-0x80e,
-0xfeef,
-0x712c,
-0xc203,
-0xc306,
-0x710c,
-0xf96,
-0xfeef,
-0x41c1,
-0xc103,
-0xc204,
-0x40c1,
-0x4363,
-0xd46,
-0x20,
-0x1c00,
-0x3041,
-0xc004,
-0xe812,
-0xc004,
-0x80f,
-0xb1,
-0x40c1,
-0xc103,
-0x724c,
-0xf004,
-0xc103,
-0x40c1,
-0x704c,
-0xd1e,
-0xff4f,
-0xc103,
-0xe6a,
-0x120,
-0x40c1,
-0x40c3,
-0x8000,
-0x669,
-0x88e0,
-0x1001,
-0x8b,
-0xc003,
-0x702c,
-0xffe,
-0xfe6f,
-0xda08,
-0x2340,
-0x1041,
-0x79e2,
-0x7829,
-0x706d,
-0x7b0f,
-0xd8ff,
-0xf01f,
-0xdc41,
-0x7c2a,
-0x42c3,
-0x8000,
-0x6dc,
-0x7165,
-0x2432,
-0x1f80,
-0x8000,
-0x71b,
-0xe00f,
-0x780f,
-0x7c14,
-0xc088,
-0x7834,
-0x644f,
-0x8820,
-0x629a,
-0x2108,
-0x3c1,
-0xa820,
-0x8a21,
-0x8841,
-0x2209,
-0x42,
-0xa841,
-0x49f0,
-0x781c,
-0x2009,
-0x780,
-0x212f,
-0x2c7,
-0x9c3,
-0x80e4,
-0x262f,
-0x3007,
-0x40c1,
-0xbfa,
-0xfeef,
-0x712c,
-0x8821,
-0x2609,
-0x3041,
-0xa821,
-0x71a5,
-0xd2f,
-0x9094,
-0xc004,
-0x89b,
-0xb0,
-0x740c,
-0x41c3,
-0x71,
-0x0,
-0xffa,
-0xfe4f,
-0x1600,
-0x708f,
-0x8000,
-0x669,
-0x706f,
-0xf035,
-0xc003,
-0x85f,
-0x36e,
-0x212f,
-0x6c7,
-0xc088,
-0x7834,
-0x8841,
-0x8800,
-0x43a1,
-0xc241,
-0x6059,
-0xc204,
-0x7e3d,
-0xc040,
-0x740c,
-0x41c3,
-0x73,
-0x5,
-0xfc2,
-0xfe6f,
-0xc642,
-0xc004,
-0x201a,
-0xf81,
-0x0,
-0x2000,
-0x40a1,
-0x209a,
-0x8,
-0x7905,
-0xc005,
-0x817,
-0xc10,
-0x2105,
-0xf80,
-0x9002,
-0x80,
-0xb0c0,
-0xc005,
-0xe0c0,
-0xf206,
-0x2105,
-0xf80,
-0x9002,
-0x60,
-0xb0c0,
-0x7167,
-0x71a5,
-0xd9f,
-0x9254,
-0x71e5,
-0x78ef,
-0xc044,
-0x40c3,
-0x8000,
-0x669,
-0x8821,
-0xc004,
-0x9ed,
-0x8025,
-0x70ad,
-0xbd2,
-0xfe8f,
-0x2480,
-0x3103,
-0x1404,
-0x341b,
-0xc6c6,
-0xc0e6,
-0x43c3,
-0x8000,
-0x669,
-0x8ba0,
-0x8b81,
-0x251f,
-0x108f,
-0xf01b,
-0x251a,
-0x1f9e,
-0x0,
-0x1000,
-0x239a,
-0x4,
-0x2114,
-0x38e,
-0x2605,
-0x301e,
-0x2305,
-0x783,
-0x7b7b,
-0xbb91,
-0xbb9c,
-0xbb9f,
-0x9360,
-0x71e5,
-0x7165,
-0xb660,
-0x232f,
-0x2c7,
-0xbd7,
-0x80a4,
-0x7ef0,
-0x71a5,
-0xcf7,
-0x9365,
-0x706d,
-0xc4c6,
-0x78e0,
-0xc0e6,
-0x41c3,
-0x8000,
-0x669,
-0x8960,
-0x8941,
-0x235f,
-0x24d,
-0xe508,
-0xf022,
-0x219a,
-0x8,
-0x231a,
-0xf8e,
-0x0,
-0x2000,
-0x278a,
-0x1fcf,
-0x7185,
-0x79c5,
-0x2105,
-0xf81,
-0x9002,
-0x64,
-0x9120,
-0x7f24,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0x793d,
-0x216c,
-0x10e,
-0x66fe,
-0x2014,
-0x341,
-0xb1c0,
-0xe509,
-0xcc9,
-0x9274,
-0x4181,
-0x7164,
-0xaf9,
-0x80e5,
-0xdc08,
-0xc4c6,
-0xcc32,
-0x7fe0,
-0x1a33,
-0x301c,
-0xc0f1,
-0x4308,
-0x706c,
-0xf00f,
-0xb19,
-0x10ee,
-0x786f,
-0xa7e,
-0xfecf,
-0x704c,
-0xf004,
-0x1801,
-0xfd3,
-0x7144,
-0xafb,
-0x8094,
-0x7164,
-0xbe9,
-0x8094,
-0xc0d1,
-0x7ee0,
-0x78e0,
-0xc0f1,
-0x706d,
-0x706c,
-0xf016,
-0x70ef,
-0xf011,
-0x235a,
-0xc82,
-0x605c,
-0x275a,
-0x3642,
-0x71e7,
-0x629a,
-0x623c,
-0x2600,
-0x3682,
-0x125c,
-0x82,
-0x2640,
-0x305e,
-0xac40,
-0xfe5,
-0xb094,
-0x7164,
-0xbd9,
-0x80b4,
-0x2314,
-0x10de,
-0xc0d1,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3003,
-0x4548,
-0x4628,
-0x4708,
-0xc099,
-0x702c,
-0xda5a,
-0xb8a,
-0xffaf,
-0x4378,
-0xc082,
-0xb82,
-0xffaf,
-0xda5a,
-0xb0f,
-0x71,
-0xc099,
-0xc182,
-0x9e2,
-0x20,
-0x714c,
-0xd80f,
-0xd56,
-0xfe6f,
-0xd90f,
-0xca66,
-0xf070,
-0xb13,
-0x3071,
-0xc182,
-0xc000,
-0xc16,
-0xe0,
-0x42a1,
-0xf011,
-0x702c,
-0xf00d,
-0xd19,
-0x106e,
-0x4020,
-0x209a,
-0x8,
-0x2005,
-0xf82,
-0x9003,
-0xe064,
-0xc000,
-0xb200,
-0x7124,
-0x9eb,
-0x8254,
-0x8ca,
-0xfe4f,
-0x40c3,
-0x8000,
-0x667,
-0x8820,
-0x8842,
-0x44cb,
-0x8000,
-0x6dc,
-0x2614,
-0x104b,
-0x8823,
-0xf037,
-0x264c,
-0xb100,
-0xd5b,
-0x17ae,
-0x23ca,
-0x1001,
-0x1300,
-0x1140,
-0x84d,
-0x32,
-0x200a,
-0x780,
-0x209a,
-0x8,
-0x231a,
-0xf9f,
-0x0,
-0x2000,
-0x2005,
-0x7c0,
-0x2005,
-0xf80,
-0x9002,
-0x166,
-0x9000,
-0xe894,
-0x2414,
-0x13c0,
-0xc041,
-0x1001,
-0x9f,
-0xc000,
-0x2708,
-0x301f,
-0xc001,
-0x1801,
-0x7c2,
-0x1000,
-0x9f,
-0xc000,
-0x2709,
-0x301f,
-0xc001,
-0x1800,
-0x7c2,
-0xe441,
-0x2640,
-0x305e,
-0xea3,
-0xb274,
-0x2340,
-0x1080,
-0x7144,
-0x4308,
-0x7b4f,
-0x9f3,
-0x80e5,
-0x264a,
-0x3000,
-0xd80f,
-0xc8a,
-0xfe6f,
-0xd90f,
-0xca15,
-0x712c,
-0xb8c4,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x793b,
-0xc000,
-0x6038,
-0x780f,
-0xc040,
-0xca67,
-0xc100,
-0x81b,
-0x8045,
-0xb0f,
-0x3071,
-0xc099,
-0xc182,
-0x8de,
-0x20,
-0x704c,
-0x2480,
-0x3003,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e2,
-0x45cb,
-0x9005,
-0xe000,
-0xd820,
-0xf02,
-0xff6f,
-0x1d00,
-0x1045,
-0x1d00,
-0x1005,
-0xc6c2,
-0x8821,
-0x216c,
-0x41,
-0xa821,
-0x8822,
-0xb9c6,
-0xa822,
-0x882d,
-0x2144,
-0xc02,
-0x2285,
-0x23f,
-0x913,
-0x17f,
-0xa84d,
-0x794f,
-0xb985,
-0xa82d,
-0x8823,
-0xb987,
-0xa823,
-0x702c,
-0xa838,
-0xa831,
-0x7fe0,
-0xa830,
-0xc2e2,
-0xe4a,
-0xfe8f,
-0x256f,
-0x1343,
-0x9560,
-0xda20,
-0xd940,
-0x238c,
-0x85ca,
-0x22ca,
-0xc2d,
-0x238c,
-0x89d0,
-0x22ca,
-0x4d,
-0x238c,
-0x8fd8,
-0xd950,
-0x22ca,
-0x4d,
-0x218a,
-0x5ca,
-0x213c,
-0xc1,
-0x238c,
-0x89d0,
-0x21ca,
-0xad,
-0x238c,
-0x8fd8,
-0x21ca,
-0xed,
-0x73d3,
-0x0,
-0x95f,
-0x21ca,
-0x12d,
-0x2105,
-0x8c,
-0x15fe,
-0x9081,
-0x205a,
-0x400,
-0x211a,
-0xf83,
-0x20,
-0x0,
-0x41c3,
-0x9004,
-0xf8,
-0x2004,
-0xf80,
-0x0,
-0x1ff0,
-0xb881,
-0x2305,
-0x42,
-0x7224,
-0x7965,
-0xb280,
-0xb100,
-0xc6c2,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x4358,
-0x42c3,
-0x8000,
-0x669,
-0x1200,
-0x8b,
-0x4738,
-0x260a,
-0x3000,
-0xf030,
-0x4300,
-0x211a,
-0xf8d,
-0x0,
-0x1000,
-0x239a,
-0x4,
-0xdc30,
-0xbc90,
-0x47cb,
-0x9000,
-0x0,
-0x7d65,
-0x2505,
-0x1303,
-0xe410,
-0x7ca5,
-0x215f,
-0x24d,
-0x7e9b,
-0x7c7b,
-0x7ee5,
-0x2600,
-0x3343,
-0x75e3,
-0x7f85,
-0x631b,
-0xb13,
-0x3030,
-0x651d,
-0x9680,
-0xab80,
-0x9760,
-0x7b82,
-0xad60,
-0xf008,
-0x8b80,
-0xb680,
-0x8b60,
-0x1500,
-0x10cc,
-0x639b,
-0xb760,
-0x7104,
-0x8ab,
-0x8254,
-0x7165,
-0x8a01,
-0x212f,
-0x2c7,
-0x8f7,
-0x8065,
-0x700c,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc0e4,
-0x264a,
-0x3000,
-0x704c,
-0xf013,
-0x706c,
-0xf00c,
-0x225a,
-0xc8c,
-0x7165,
-0x609d,
-0x235a,
-0x64c,
-0x7164,
-0x64bc,
-0x642c,
-0x1e5c,
-0x1302,
-0xbeb,
-0x80b4,
-0x2300,
-0x168e,
-0x7144,
-0xadf,
-0x80b4,
-0x2614,
-0x308b,
-0xc4c4,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1bc,
-0xc244,
-0xc142,
-0xc043,
-0x1600,
-0x710d,
-0x9008,
-0x1e0,
-0x712c,
-0x9c6,
-0x60,
-0x4378,
-0x1e00,
-0x7002,
-0x8000,
-0x666,
-0x4608,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc003,
-0x1600,
-0x708f,
-0x8000,
-0x4,
-0x714c,
-0xca6,
-0xff2f,
-0x706c,
-0xa56,
-0xfe6f,
-0x40a1,
-0x208a,
-0x8,
-0x41c3,
-0x9009,
-0xe1f2,
-0xb100,
-0x70ad,
-0x208a,
-0x10,
-0xb1a1,
-0xb102,
-0x710c,
-0x2644,
-0x17c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0x1e00,
-0x7344,
-0x9003,
-0xfec4,
-0x205a,
-0x100,
-0x712c,
-0x200f,
-0x380,
-0x780f,
-0xe32,
-0xffaf,
-0xc045,
-0x271a,
-0x1f8f,
-0x10,
-0x0,
-0xc004,
-0x7214,
-0x40c3,
-0x9003,
-0xe004,
-0xf404,
-0xb0a0,
-0xf004,
-0x1800,
-0x6c4,
-0x1484,
-0x3000,
-0xc047,
-0x1600,
-0x7100,
-0x9002,
-0x164,
-0xc102,
-0x206c,
-0xc0,
-0xfae,
-0x20,
-0xb880,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0x966,
-0xfeef,
-0x4300,
-0xc092,
-0x702c,
-0xffe,
-0xff6f,
-0xda28,
-0xc003,
-0xc192,
-0x724c,
-0x2055,
-0x8c0,
-0x7f05,
-0xc746,
-0xb32,
-0xffef,
-0xc006,
-0xc004,
-0x7014,
-0xf283,
-0xc088,
-0x218a,
-0x38,
-0xfe6,
-0xff6f,
-0xda14,
-0xca0c,
-0xd910,
-0x4220,
-0x2044,
-0x7c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x7a5b,
-0x2044,
-0x7c3,
-0x712c,
-0x4020,
-0xeb06,
-0xbb61,
-0xb01,
-0x31,
-0x781b,
-0x7c0f,
-0x40c3,
-0x8000,
-0x666,
-0x8862,
-0x40c3,
-0x8000,
-0x666,
-0x88a1,
-0x7993,
-0x4399,
-0xf00b,
-0x2454,
-0x390b,
-0x7c14,
-0x23f4,
-0x1000,
-0x71a5,
-0x7824,
-0x7842,
-0xb400,
-0x78af,
-0xbed,
-0x8025,
-0xc488,
-0x70cd,
-0xf044,
-0x40c3,
-0x8000,
-0x666,
-0x8801,
-0x7914,
-0x40c3,
-0x8000,
-0x666,
-0x1004,
-0x8b,
-0x40c3,
-0x8000,
-0x666,
-0x8843,
-0xf026,
-0x9180,
-0x7463,
-0x202f,
-0x8306,
-0x34,
-0x24,
-0xb180,
-0x829,
-0x813,
-0x231a,
-0xf8f,
-0x0,
-0x1000,
-0xc006,
-0x7f05,
-0x200a,
-0x780,
-0x209a,
-0x4,
-0x78e5,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0xb080,
-0xf006,
-0x40c3,
-0x0,
-0xfe00,
-0xb100,
-0x2640,
-0x305e,
-0x7224,
-0xec1,
-0xb094,
-0x7144,
-0x7b4f,
-0xbfb,
-0x90e5,
-0x264a,
-0x3000,
-0xcda,
-0xff8f,
-0xc004,
-0xc202,
-0xc188,
-0x2079,
-0x43,
-0xb5a,
-0xffef,
-0x40a1,
-0x71c5,
-0x7dcf,
-0xd7b,
-0x97f4,
-0xc188,
-0xc006,
-0xc192,
-0x714c,
-0xdee,
-0xe0,
-0x706c,
-0xf007,
-0xc202,
-0xd80f,
-0xc192,
-0xb36,
-0xffef,
-0x706c,
-0xaee,
-0xff6f,
-0xc005,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc003,
-0x704c,
-0xace,
-0xff2f,
-0x706c,
-0xc007,
-0xe81c,
-0xc004,
-0x819,
-0xb1,
-0x742c,
-0xc002,
-0xc203,
-0xc305,
-0xc040,
-0x740c,
-0x41c3,
-0x1f,
-0x3,
-0xf00b,
-0xc002,
-0xc303,
-0xc041,
-0xc005,
-0xb995,
-0xc040,
-0xc004,
-0x6841,
-0x740c,
-0x92a,
-0xfe4f,
-0xb92,
-0xfe6f,
-0xc002,
-0xc0bc,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3806,
-0xc042,
-0x205f,
-0x640,
-0xc143,
-0xc24a,
-0xc049,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x205f,
-0xc81,
-0xc009,
-0x6038,
-0x2000,
-0xf80,
-0x8000,
-0x674,
-0x8812,
-0x702c,
-0xc047,
-0xf4e,
-0x20,
-0xc002,
-0x4318,
-0xc002,
-0x1600,
-0x710f,
-0x9008,
-0x1e0,
-0xc302,
-0x1600,
-0x708e,
-0x8000,
-0x4,
-0x2338,
-0x3000,
-0x41c3,
-0x1b,
-0x2,
-0x90e,
-0xfe2f,
-0x4263,
-0x40c3,
-0x8000,
-0x665,
-0x1801,
-0x6c2,
-0x710c,
-0x4508,
-0x2344,
-0x37c0,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7dbb,
-0x218a,
-0x4,
-0xc003,
-0x255a,
-0x110d,
-0x261a,
-0x1f8e,
-0x10,
-0x0,
-0x2004,
-0x8040,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc04b,
-0xf205,
-0xc002,
-0x704c,
-0x716c,
-0xf004,
-0xc002,
-0x704c,
-0x706c,
-0x9da,
-0xff0f,
-0x250f,
-0x16c0,
-0xc04c,
-0xc007,
-0x2084,
-0x3e,
-0xc047,
-0xf7e,
-0xfe2f,
-0x40e1,
-0xd820,
-0x1e00,
-0x7004,
-0x9003,
-0xe004,
-0x208a,
-0x8,
-0x41c3,
-0x9009,
-0xe1f2,
-0xb100,
-0x700c,
-0x228a,
-0x10,
-0xb101,
-0xb142,
-0x1e00,
-0x7004,
-0x9003,
-0xfec4,
-0x730c,
-0xd1e,
-0x20,
-0x218a,
-0xfc7,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xed2,
-0xfeaf,
-0x4300,
-0xc08e,
-0x218a,
-0x38,
-0xda5a,
-0xd76,
-0xff6f,
-0xc78e,
-0xc002,
-0x120c,
-0x309f,
-0x2055,
-0xc0c,
-0x40c3,
-0x8000,
-0x665,
-0x8864,
-0x7cc5,
-0x235f,
-0x480,
-0x671f,
-0x770c,
-0x260a,
-0x3000,
-0x2744,
-0x37c0,
-0xe806,
-0xb861,
-0x8ff,
-0x8031,
-0x262f,
-0x3780,
-0x40c3,
-0x8000,
-0x665,
-0x88a5,
-0x2653,
-0x311e,
-0xf026,
-0x2744,
-0x37c2,
-0xea06,
-0xba61,
-0xa01,
-0x31,
-0x781b,
-0x2140,
-0x4b,
-0x261a,
-0x1f82,
-0x0,
-0x1000,
-0x219a,
-0x4,
-0x7a85,
-0x7945,
-0x793b,
-0xb991,
-0xb99c,
-0xb99f,
-0x9140,
-0x2604,
-0x3081,
-0x6038,
-0x795d,
-0x216c,
-0x101,
-0x6038,
-0x1f02,
-0x1014,
-0x4161,
-0x9c3,
-0x8274,
-0x208a,
-0xc7f,
-0x7164,
-0x7e6f,
-0xdf7,
-0x93a5,
-0x702c,
-0xca66,
-0xf0e6,
-0xc006,
-0xbd6,
-0x60,
-0x780f,
-0xc107,
-0x7825,
-0x790f,
-0xf3e,
-0xa0,
-0xc004,
-0xc004,
-0xa9a,
-0xffaf,
-0x702c,
-0xd80f,
-0xe9a,
-0xfe2f,
-0xd90f,
-0xca0c,
-0x704c,
-0xc245,
-0xf009,
-0x2455,
-0x3ec1,
-0x615b,
-0xc18e,
-0x6149,
-0x7144,
-0xab20,
-0x228c,
-0x8d02,
-0xf7b8,
-0x712c,
-0x2044,
-0x7c2,
-0x4020,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781b,
-0xc04d,
-0xf0a7,
-0x40c3,
-0x8000,
-0x665,
-0x8844,
-0x2455,
-0x3ec0,
-0x225f,
-0x481,
-0x603c,
-0x40c3,
-0x8000,
-0x665,
-0x8825,
-0xf031,
-0xc003,
-0x855,
-0x36e,
-0x40a1,
-0x209a,
-0x8,
-0x231a,
-0xf8f,
-0x0,
-0x2000,
-0x9cc0,
-0x78e5,
-0x2005,
-0xf8f,
-0x9002,
-0x64,
-0xe21,
-0x1012,
-0x260b,
-0x9f80,
-0x0,
-0x1f00,
-0xf20d,
-0x40c3,
-0x0,
-0xfe00,
-0xb400,
-0x40c3,
-0x0,
-0x1c1f,
-0xf00d,
-0x1f00,
-0x1005,
-0xf00a,
-0x265e,
-0x1800,
-0xbec4,
-0x2004,
-0xf80,
-0x0,
-0xfc00,
-0x78c5,
-0xb700,
-0x71a5,
-0x7285,
-0xda7,
-0x9254,
-0x7144,
-0x7b4f,
-0x9f9,
-0x80e5,
-0x70ad,
-0x9c6,
-0xff8f,
-0x986,
-0xfe0f,
-0x40c3,
-0x8000,
-0x665,
-0x8864,
-0x2455,
-0x3ecf,
-0x43cb,
-0x8000,
-0x6dc,
-0x235f,
-0x480,
-0x671f,
-0x40c3,
-0x8000,
-0x665,
-0x1005,
-0x9f,
-0xf045,
-0x70ad,
-0x704c,
-0xf040,
-0x40a1,
-0x209a,
-0x8,
-0x241a,
-0x1f81,
-0x0,
-0x2000,
-0x7825,
-0x2005,
-0xf80,
-0x9002,
-0x166,
-0x9000,
-0xc103,
-0x218c,
-0x8004,
-0x22ca,
-0x2,
-0xf402,
-0x621a,
-0xc003,
-0x849,
-0x36e,
-0x97c0,
-0x262f,
-0xf386,
-0x38,
-0x4,
-0xc006,
-0x1420,
-0x301e,
-0x7810,
-0x80d,
-0xf81,
-0x0,
-0xffff,
-0x1340,
-0x109e,
-0x262f,
-0xf088,
-0xf40e,
-0xc005,
-0x262f,
-0x3787,
-0x2314,
-0x1000,
-0x8821,
-0x2608,
-0x3041,
-0xa821,
-0x8820,
-0x2609,
-0x3041,
-0xa820,
-0x2380,
-0x1041,
-0xc00d,
-0x71a5,
-0x780f,
-0x60d8,
-0x1f02,
-0x1014,
-0xd85,
-0x9254,
-0x7164,
-0x7c6f,
-0xf77,
-0xb325,
-0xd80f,
-0xd22,
-0xfe2f,
-0xd90f,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0xe09e,
-0x6b2,
-0xffce,
-0xf42,
-0xff2f,
-0xc004,
-0xca15,
-0x712c,
-0x2044,
-0x7cd,
-0x4020,
-0xc108,
-0xed05,
-0xbd61,
-0xdff,
-0x9031,
-0x781b,
-0x6038,
-0xc046,
-0xc006,
-0xc10c,
-0x7810,
-0xc048,
-0x792f,
-0xca67,
-0xc144,
-0xc108,
-0x7110,
-0x624,
-0xffce,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x205f,
-0xc81,
-0xc009,
-0x6038,
-0x2000,
-0xf80,
-0x8000,
-0x674,
-0x8832,
-0xd52,
-0xa0,
-0xc004,
-0xc00a,
-0xe811,
-0xc003,
-0xc302,
-0x41c3,
-0x1d,
-0x4,
-0xc041,
-0xc004,
-0x724c,
-0xc040,
-0xd5a,
-0xfe2f,
-0x740c,
-0xfbe,
-0xfe2f,
-0xc003,
-0xc00b,
-0xe80a,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc002,
-0x704c,
-0xeae,
-0xfeef,
-0x706c,
-0x2480,
-0x3806,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1210,
-0x308d,
-0x70cd,
-0x70ed,
-0x1a10,
-0x3382,
-0xf009,
-0x26f0,
-0x73c0,
-0x8000,
-0x1ca4,
-0x8d2,
-0x40,
-0x71e5,
-0xcc36,
-0xff1,
-0x9004,
-0x1a10,
-0x3342,
-0x1a36,
-0x339c,
-0xc6c6,
-0x78e0,
-0x43c3,
-0x9008,
-0x1ea,
-0x9340,
-0x209a,
-0x4,
-0x2000,
-0xf80,
-0x0,
-0xfe00,
-0x2204,
-0xf82,
-0x0,
-0xc0ff,
-0x7845,
-0x9341,
-0xb300,
-0xb962,
-0x226c,
-0x140,
-0x7825,
-0x7fe0,
-0xb301,
-0x78e0,
-0xc2e2,
-0x1600,
-0x710d,
-0x8000,
-0x6,
-0xe56d,
-0x2d85,
-0x1b81,
-0x2553,
-0x9041,
-0xf205,
-0x78af,
-0x214e,
-0x10d,
-0x651d,
-0x7aaf,
-0x41c3,
-0x147,
-0x1,
-0xca6,
-0xfe2f,
-0xd80a,
-0x40c3,
-0x8000,
-0x664,
-0xa8a0,
-0xc6c2,
-0x78e0,
-0xc2e6,
-0x266f,
-0x15c3,
-0x8e40,
-0x4508,
-0xea17,
-0x87a,
-0xff2f,
-0x4040,
-0x4708,
-0xe887,
-0x41c3,
-0x16e,
-0x1,
-0xcc6,
-0xfdef,
-0x700c,
-0x40e1,
-0x209a,
-0x1,
-0x7f05,
-0x78bb,
-0x2005,
-0xf80,
-0x9003,
-0xfe92,
-0xb0e0,
-0x16ff,
-0x9082,
-0xea18,
-0x84a,
-0xff2f,
-0x4040,
-0x228c,
-0x8fc3,
-0xf209,
-0xe888,
-0x41c3,
-0x16f,
-0x1,
-0xc92,
-0xfdef,
-0x700c,
-0x700c,
-0x209a,
-0x1,
-0x79bb,
-0x2105,
-0xf81,
-0x9003,
-0xfe9a,
-0xb100,
-0xc6c6,
-0x78e0,
-0xc0f1,
-0x1600,
-0x7082,
-0x8000,
-0x9,
-0xea1a,
-0xa23,
-0xa30,
-0x720c,
-0x228c,
-0x8c03,
-0xf20c,
-0xe2f8,
-0xf404,
-0x710c,
-0xf009,
-0x41c3,
-0x170,
-0x1,
-0xc52,
-0xfdef,
-0x700c,
-0x700c,
-0x205f,
-0x401,
-0x7825,
-0x1e00,
-0x7004,
-0x9005,
-0xe0a0,
-0xc0d1,
-0x7ee0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a2,
-0x4628,
-0x2009,
-0x41,
-0xab7,
-0x65,
-0x4748,
-0x1600,
-0x7081,
-0x8000,
-0x4,
-0x45cb,
-0x8000,
-0x474,
-0x78e2,
-0x211a,
-0xf81,
-0x20,
-0x0,
-0x25f4,
-0x13c3,
-0x25f4,
-0x1002,
-0xc041,
-0xc140,
-0x750c,
-0x41c3,
-0x60,
-0x2,
-0xba6,
-0xfe2f,
-0x4338,
-0x7ee2,
-0x25f4,
-0x1383,
-0x25f4,
-0x13c2,
-0x234f,
-0x3401,
-0xb92,
-0xfe2f,
-0x750c,
-0x40c3,
-0x8000,
-0x667,
-0x1001,
-0x8b,
-0x8840,
-0x43c3,
-0x8000,
-0x4a8,
-0xf026,
-0xc001,
-0x666c,
-0x7144,
-0x249a,
-0x1001,
-0x6068,
-0x7c05,
-0x211a,
-0xf80,
-0x0,
-0x1000,
-0x219a,
-0x8,
-0x2004,
-0xf8d,
-0xf,
-0xe000,
-0xc000,
-0x2184,
-0x8,
-0x78a5,
-0x7905,
-0x40c3,
-0x9002,
-0x82,
-0x2105,
-0xd,
-0xb580,
-0xe014,
-0x2105,
-0xc,
-0x6769,
-0x4020,
-0x209a,
-0x1,
-0x7825,
-0xb400,
-0x794f,
-0xbb7,
-0x9065,
-0x710c,
-0xf008,
-0x41c3,
-0x5f,
-0x0,
-0xb1e,
-0xfe2f,
-0x740c,
-0x700c,
-0xc0a2,
-0x1404,
-0x341b,
-0xc6c6,
-0xc0e6,
-0x4328,
-0x70ed,
-0x41c3,
-0x9003,
-0xff64,
-0xb1e0,
-0x1904,
-0x45,
-0x42c3,
-0x8000,
-0x669,
-0x8a21,
-0x8ac0,
-0xf039,
-0x228c,
-0x8fc3,
-0xf418,
-0x261a,
-0x1f83,
-0x0,
-0x2000,
-0x42c3,
-0x9002,
-0x1f64,
-0x2305,
-0x8c,
-0x7444,
-0x7a65,
-0xb400,
-0xb51,
-0x123f,
-0xb2e0,
-0x42c3,
-0x9003,
-0xf164,
-0xb2e0,
-0x1a04,
-0x45,
-0xf020,
-0x260a,
-0x32c0,
-0x708d,
-0xf016,
-0xf753,
-0x4381,
-0x261a,
-0x1f82,
-0x0,
-0x2000,
-0x239a,
-0x8,
-0x7b45,
-0x42c3,
-0x9002,
-0x164,
-0x2305,
-0x8d,
-0x7444,
-0x7b45,
-0xb500,
-0x1b00,
-0x5,
-0x7185,
-0xe0d,
-0x3010,
-0xcd5,
-0x9274,
-0x262f,
-0xb782,
-0x71c5,
-0x993,
-0x83a5,
-0x222f,
-0x2c7,
-0xc4c6,
-0xc2e2,
-0xc1a4,
-0x1600,
-0x7080,
-0x8000,
-0x57d,
-0x702c,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb08,
-0x4528,
-0xc142,
-0xc141,
-0xd6a,
-0xfdef,
-0xc140,
-0x1600,
-0x7080,
-0x8000,
-0x57d,
-0xd910,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb0c,
-0xc542,
-0xc541,
-0xd4e,
-0xfdef,
-0xc540,
-0xd8ff,
-0xd980,
-0x754c,
-0x726c,
-0xc543,
-0xc542,
-0xc541,
-0xd3a,
-0xfdef,
-0xc540,
-0xc0a4,
-0xc6c2,
-0x78e0,
-0xc2e4,
-0xc1a4,
-0x70ad,
-0xd8ff,
-0x702c,
-0x754c,
-0x736c,
-0xc543,
-0xc542,
-0xc541,
-0xd1a,
-0xfdef,
-0xc540,
-0x46cb,
-0x8000,
-0x57d,
-0x8e00,
-0x825,
-0xb4,
-0x702c,
-0x7104,
-0x781d,
-0xb862,
-0x780f,
-0xc043,
-0xd8ff,
-0x754c,
-0x726c,
-0xc542,
-0xc541,
-0xcf2,
-0xfdef,
-0xc540,
-0x8e00,
-0xc043,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb08,
-0xc542,
-0xc541,
-0xcde,
-0xfdef,
-0xc540,
-0x8e00,
-0xd908,
-0x754c,
-0xc043,
-0xd8ff,
-0xdb0c,
-0xc542,
-0xc541,
-0xcc6,
-0xfdef,
-0xc540,
-0xc0a4,
-0xc6c4,
-0x78e0,
-0x42c3,
-0x9004,
-0x110,
-0x9200,
-0x204f,
-0x101,
-0xb8a4,
-0xb220,
-0x7fe0,
-0xb200,
-0xc2e2,
-0x4200,
-0xd36,
-0xfe6f,
-0x4020,
-0x4408,
-0x706c,
-0x786f,
-0x791b,
-0x2144,
-0x7cd,
-0x4181,
-0xed05,
-0xbd61,
-0xdff,
-0x9031,
-0x793d,
-0xb9c1,
-0x9eb,
-0x80a1,
-0x7164,
-0xc6c2,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3002,
-0xc24f,
-0xc15a,
-0xc04b,
-0xc09e,
-0x702c,
-0xeb2,
-0xff2f,
-0x764c,
-0xc00b,
-0xf22,
-0xfdef,
-0xc19e,
-0xca13,
-0xe807,
-0xc00b,
-0xa4e,
-0x20,
-0xc10f,
-0x23d,
-0x0,
-0x700c,
-0xc04e,
-0xc00f,
-0x2079,
-0x40,
-0x781b,
-0x781b,
-0x7204,
-0xc056,
-0x1600,
-0x7080,
-0x8000,
-0xe,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x2044,
-0x8041,
-0xc016,
-0x20ca,
-0xa1,
-0xc056,
-0xca0b,
-0x2105,
-0x803e,
-0x740c,
-0xc058,
-0x20ca,
-0x61,
-0xc058,
-0xd810,
-0xc057,
-0x20ca,
-0x61,
-0xc057,
-0x700c,
-0xc04d,
-0xf0db,
-0xc00e,
-0x6038,
-0x88e1,
-0x88a0,
-0xc00b,
-0x42e1,
-0xd76,
-0x20,
-0x41a1,
-0x4608,
-0x5042,
-0xca03,
-0x929,
-0x4,
-0xca02,
-0x825,
-0x64,
-0x43a1,
-0xc01a,
-0xc20e,
-0x41c3,
-0x4b,
-0x6,
-0xc043,
-0xc017,
-0xc740,
-0xc042,
-0xc018,
-0xc041,
-0x8b2,
-0xfe2f,
-0x740c,
-0x700c,
-0xc05d,
-0xc017,
-0x1460,
-0x301b,
-0xc050,
-0xc01a,
-0xc059,
-0xf094,
-0x78af,
-0xc04c,
-0xc00f,
-0xc64a,
-0x7114,
-0x700c,
-0xc052,
-0xc053,
-0xf226,
-0xc00c,
-0x252f,
-0x16c8,
-0x78a2,
-0x790f,
-0x78ef,
-0xc04a,
-0xc00b,
-0xd0e,
-0x20,
-0xc20a,
-0xc053,
-0xc00c,
-0xc20a,
-0x60b8,
-0x790f,
-0xcfe,
-0x20,
-0xc00b,
-0xc052,
-0xc013,
-0xe0f,
-0x1025,
-0x78b3,
-0xc113,
-0xc14a,
-0xf00a,
-0xc012,
-0xe0f,
-0x1025,
-0x700c,
-0xc012,
-0xc04a,
-0x4063,
-0xf002,
-0xc64a,
-0x780e,
-0xc05c,
-0xc00c,
-0xc51c,
-0x651d,
-0x78ef,
-0xc04c,
-0xc00f,
-0x80d,
-0xb1,
-0x702c,
-0x700c,
-0xc151,
-0xf023,
-0xc010,
-0x7f10,
-0xc00c,
-0x78e2,
-0x7a0f,
-0x78af,
-0xc05b,
-0xc00b,
-0xcaa,
-0x20,
-0xc11b,
-0xc051,
-0xc00c,
-0xc11b,
-0x60f8,
-0x7a0f,
-0xc9a,
-0x20,
-0xc00b,
-0xc211,
-0xc10a,
-0x90f,
-0xa5,
-0x79f3,
-0xc211,
-0xc24a,
-0xf007,
-0xc10a,
-0x90b,
-0x25,
-0x702c,
-0xc110,
-0xc04a,
-0xc70c,
-0x1212,
-0x3602,
-0x1203,
-0x3083,
-0x792e,
-0xa37,
-0xe4,
-0x673f,
-0x1202,
-0x3083,
-0xb2b,
-0xa4,
-0x7bef,
-0xc045,
-0xc012,
-0xc211,
-0xc141,
-0xc043,
-0xc013,
-0xc246,
-0x7aaf,
-0xc042,
-0xc01c,
-0x41c3,
-0x50,
-0x9,
-0xc040,
-0x740c,
-0xfa6,
-0xfdef,
-0xc644,
-0xc01d,
-0x7104,
-0x2053,
-0x807e,
-0xc05d,
-0xf405,
-0xc010,
-0x7767,
-0xb864,
-0xc050,
-0xc019,
-0xc60a,
-0x7704,
-0xc059,
-0xc010,
-0x780e,
-0x2048,
-0x40,
-0xc050,
-0x202f,
-0x6c6,
-0x2048,
-0x5b,
-0xc019,
-0x262f,
-0xf007,
-0xf56b,
-0xc00d,
-0x82d,
-0x385,
-0x5042,
-0xca03,
-0x91f,
-0x4,
-0xca02,
-0x817,
-0x64,
-0x740c,
-0xc20e,
-0xc30d,
-0x41c3,
-0x51,
-0x3,
-0xf4a,
-0xfdef,
-0xc640,
-0xc555,
-0xc754,
-0xc64d,
-0xc00e,
-0x7204,
-0xc04e,
-0xc10e,
-0xc016,
-0x7110,
-0x648,
-0xffe5,
-0xc19e,
-0x41c3,
-0x52,
-0x0,
-0xf76,
-0xfdaf,
-0xc00d,
-0xc00f,
-0x80f,
-0x50,
-0xc115,
-0xc00b,
-0xb96f,
-0x183f,
-0x42,
-0xc00f,
-0x80d,
-0x90,
-0xc10b,
-0xc014,
-0x1940,
-0x2,
-0x2480,
-0x3002,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3802,
-0xc147,
-0x4508,
-0xc088,
-0x702c,
-0xc42,
-0xff2f,
-0xda80,
-0x704c,
-0x70cd,
-0xc242,
-0xf02b,
-0x8880,
-0x8861,
-0x4081,
-0xf015,
-0x60f8,
-0x1000,
-0x8b,
-0x7165,
-0x1800,
-0x2c2,
-0x716d,
-0xca15,
-0x2044,
-0x7db,
-0x4061,
-0xb11,
-0x3010,
-0x2342,
-0x305b,
-0xbff,
-0xb031,
-0x781b,
-0x60f8,
-0x7f10,
-0xbd9,
-0x83e5,
-0xc088,
-0x4b90,
-0x7714,
-0x7104,
-0x20ca,
-0x2c,
-0x242f,
-0x9007,
-0xf206,
-0x7b4f,
-0x7124,
-0x7470,
-0x22ca,
-0xd,
-0x71c5,
-0xeb1,
-0x97f4,
-0x2514,
-0x1380,
-0x700c,
-0x708d,
-0x70cd,
-0x4318,
-0xc044,
-0xc046,
-0xf01f,
-0x8860,
-0x8801,
-0x7862,
-0x6861,
-0x7714,
-0xca0f,
-0x7b70,
-0x23ca,
-0x2c,
-0x631f,
-0x784f,
-0x825,
-0x3e5,
-0x7b6a,
-0xc004,
-0x7b70,
-0x2600,
-0x90ce,
-0x7b8c,
-0x2041,
-0x8000,
-0xc044,
-0xc006,
-0x2300,
-0xb0db,
-0x2041,
-0x8000,
-0xc046,
-0x7185,
-0xcc9,
-0x97f4,
-0x2514,
-0x1300,
-0xca67,
-0x1266,
-0x3082,
-0x70ed,
-0x706c,
-0xc343,
-0xc345,
-0xf02d,
-0x626a,
-0x120f,
-0x308c,
-0x2400,
-0x108b,
-0x7c2f,
-0xc3b,
-0x12c5,
-0x221f,
-0x8c,
-0xda1f,
-0x241a,
-0x10df,
-0x260a,
-0x37c0,
-0xba61,
-0xa01,
-0x31,
-0x262f,
-0x3781,
-0xc203,
-0x2200,
-0x87c2,
-0xc243,
-0xc205,
-0x2201,
-0x8782,
-0xc245,
-0xc202,
-0x2200,
-0x8302,
-0x2741,
-0x900f,
-0xc242,
-0x1215,
-0x308c,
-0x714c,
-0xbcc4,
-0xec06,
-0xbc61,
-0xc01,
-0x1031,
-0x7a5b,
-0x627a,
-0x7b50,
-0x8a7,
-0x80e5,
-0xc288,
-0xc812,
-0x1203,
-0x3081,
-0x825,
-0x44,
-0x1202,
-0x3081,
-0x91d,
-0x24,
-0x4263,
-0xc002,
-0x41c3,
-0x46,
-0x4,
-0xc041,
-0xc003,
-0x43c1,
-0xc040,
-0xd9a,
-0xfdef,
-0x740c,
-0xc002,
-0xc104,
-0x78e5,
-0x79c5,
-0x2079,
-0x0,
-0x2179,
-0x1,
-0x7824,
-0x41c3,
-0x47,
-0x0,
-0xdca,
-0xfd8f,
-0xc106,
-0xc304,
-0x4063,
-0xc8a,
-0xfdaf,
-0x42c1,
-0x4608,
-0xc003,
-0xc105,
-0xc202,
-0xc7a,
-0xfdaf,
-0x43e1,
-0xc107,
-0x915,
-0x70,
-0x4300,
-0x2642,
-0x13c1,
-0x1d3f,
-0x1042,
-0xc107,
-0x909,
-0x90,
-0x1d40,
-0x10c2,
-0x5042,
-0xca03,
-0x935,
-0x4,
-0xca02,
-0x831,
-0x64,
-0x7acf,
-0x7b6f,
-0x41c3,
-0x48,
-0x2,
-0xd2a,
-0xfdef,
-0x740c,
-0x1540,
-0x1080,
-0x153f,
-0x10c3,
-0x153e,
-0x1082,
-0xc040,
-0x41c3,
-0x49,
-0x3,
-0xd12,
-0xfdef,
-0x740c,
-0xca0f,
-0x2480,
-0x3802,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x8de,
-0xfe6f,
-0x4548,
-0x153f,
-0x1081,
-0x4300,
-0x2140,
-0x3ce,
-0x44c9,
-0x222f,
-0x8307,
-0xf20e,
-0x785b,
-0x60b8,
-0x10ff,
-0x808f,
-0x1540,
-0x108b,
-0xf11,
-0x12e4,
-0x7785,
-0x10fe,
-0x8080,
-0xbe5,
-0x9005,
-0x7ccf,
-0xc1f,
-0x17b5,
-0x720c,
-0x7894,
-0x60b8,
-0x88e1,
-0x1540,
-0x108b,
-0xf0f,
-0x12e4,
-0x71c5,
-0x8800,
-0xbe9,
-0x9005,
-0x491f,
-0x790f,
-0x4950,
-0x7a0f,
-0x4c30,
-0x780f,
-0x2009,
-0x82,
-0xca0c,
-0xb8c4,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x7a5b,
-0x794f,
-0x8b00,
-0x907,
-0x5,
-0xab40,
-0xc6c6,
-0x208c,
-0x8fc3,
-0xf209,
-0x821,
-0x1d1,
-0x41c3,
-0x9004,
-0x238,
-0x1900,
-0x45,
-0xf006,
-0x41c3,
-0x9004,
-0x238,
-0x1900,
-0x105,
-0x1900,
-0x5,
-0x1210,
-0x3081,
-0xe903,
-0x19,
-0x0,
-0x41c3,
-0x9018,
-0x64,
-0xb100,
-0x55,
-0x20,
-0x1902,
-0x5,
-0x78e0,
-0xc2e2,
-0x4508,
-0xca10,
-0xe812,
-0xcc36,
-0x208c,
-0x8010,
-0xf785,
-0xe6e,
-0xfdcf,
-0xcc36,
-0x2615,
-0x7001,
-0x8000,
-0x1ca4,
-0x7104,
-0xa1a0,
-0x1a36,
-0x301c,
-0xc6c2,
-0x41c3,
-0x9018,
-0x64,
-0xb1a0,
-0x40a1,
-0xdd10,
-0xbd61,
-0xd01,
-0x1031,
-0x781d,
-0xb102,
-0x80e,
-0x20,
-0x1902,
-0x5,
-0xc6c2,
-0x41c3,
-0x9018,
-0x8,
-0x9100,
-0x8ff,
-0x801f,
-0x195e,
-0x45,
-0x9100,
-0x801,
-0x1e,
-0x7ee0,
-0xc2e6,
-0x4708,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x83b,
-0x13f,
-0x4528,
-0xca10,
-0x7ef0,
-0xe80a,
-0xcc36,
-0x218a,
-0x10,
-0x7902,
-0x6e02,
-0x7030,
-0xdf8,
-0xfdca,
-0xf3a,
-0xffef,
-0xd808,
-0xf76,
-0xffef,
-0x40e1,
-0x70ed,
-0xf007,
-0xf6a,
-0xffef,
-0x1504,
-0x1400,
-0x71e5,
-0xff9,
-0x9384,
-0xc6c6,
-0x708d,
-0x706c,
-0xf009,
-0x2100,
-0x680,
-0x106e,
-0x81,
-0x915,
-0xa5,
-0x7164,
-0x4a30,
-0x796f,
-0x9ef,
-0x80b4,
-0x7a0f,
-0xf007,
-0x1070,
-0x8c,
-0x249a,
-0x1001,
-0x7c45,
-0x7fe0,
-0x788f,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a5,
-0x4508,
-0x2440,
-0x3440,
-0xc041,
-0x2440,
-0x34c0,
-0x706c,
-0xc040,
-0x40a1,
-0x4358,
-0x4628,
-0x1c13,
-0x30c2,
-0x1c12,
-0x30c2,
-0x1c11,
-0x30c2,
-0xb7e,
-0xfe2f,
-0xc364,
-0xc084,
-0xc041,
-0x2440,
-0x3480,
-0xc040,
-0x40a1,
-0x41c1,
-0x4263,
-0xb66,
-0xfe2f,
-0x716c,
-0x1412,
-0x3083,
-0x1413,
-0x3082,
-0xc814,
-0xc524,
-0x2209,
-0xc1,
-0x211a,
-0xc,
-0x1411,
-0x3080,
-0xc043,
-0x2009,
-0x34f,
-0xc818,
-0x78ec,
-0x6098,
-0xc042,
-0xc812,
-0x1203,
-0x308c,
-0x843,
-0x304,
-0x1202,
-0x308c,
-0xc3b,
-0x1024,
-0x740c,
-0xc140,
-0x41c3,
-0x3d,
-0x3,
-0xae2,
-0xfdcf,
-0xc203,
-0xc740,
-0x47cb,
-0x3e,
-0x3,
-0x740c,
-0x41e1,
-0xad2,
-0xfdef,
-0x43a1,
-0xc002,
-0x274f,
-0x1401,
-0x42c1,
-0xc040,
-0x740c,
-0xabe,
-0xfdef,
-0x4363,
-0xc002,
-0xc0a5,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3511,
-0xf66,
-0xfe2f,
-0x700c,
-0x1600,
-0x708e,
-0x8000,
-0x4,
-0x40c3,
-0x8000,
-0x1b70,
-0x702c,
-0xfea,
-0xfeef,
-0xda28,
-0xeca,
-0xfe2f,
-0x700c,
-0xc046,
-0x40c3,
-0x8000,
-0x665,
-0x8801,
-0x1c38,
-0x3001,
-0x1c3c,
-0x3003,
-0x205f,
-0x641,
-0x1600,
-0x7080,
-0x8000,
-0x665,
-0x205f,
-0xc80,
-0x6119,
-0x2100,
-0xf80,
-0x8000,
-0x674,
-0x1007,
-0xcf,
-0xc006,
-0xbaa,
-0xff6f,
-0x702c,
-0x261a,
-0x1f8e,
-0x20,
-0x0,
-0x2605,
-0x1f80,
-0x9002,
-0x92,
-0x90a0,
-0xed6,
-0xfe2f,
-0x2553,
-0x1140,
-0x4318,
-0x78bd,
-0xf96b,
-0x781d,
-0xec6,
-0xfe2f,
-0xb8c5,
-0x4508,
-0x40c3,
-0x8000,
-0x474,
-0x20f4,
-0x6c2,
-0x41c3,
-0x91,
-0x1,
-0xa12,
-0xfdef,
-0x750c,
-0x40c3,
-0x8000,
-0x474,
-0x20f4,
-0x342,
-0x41c3,
-0x92,
-0x1,
-0x9fa,
-0xfdef,
-0x750c,
-0xc006,
-0x712c,
-0x734c,
-0xd7a,
-0x20,
-0xc38e,
-0x206f,
-0x243,
-0x881a,
-0x889,
-0x3e,
-0x710c,
-0xc044,
-0x41c3,
-0x93,
-0x0,
-0x9d6,
-0xfdef,
-0x740c,
-0x2605,
-0x1f80,
-0x9003,
-0xe090,
-0x1800,
-0x45,
-0xf015,
-0x41c3,
-0x94,
-0x0,
-0x9ba,
-0xfdcf,
-0x4063,
-0x41a1,
-0xdce,
-0xffaf,
-0x42c1,
-0xe808,
-0xc006,
-0x722c,
-0x704c,
-0xd32,
-0x20,
-0xc38e,
-0xc004,
-0x7104,
-0xc044,
-0xc004,
-0x7e0f,
-0xed7,
-0x9134,
-0x750c,
-0x41c3,
-0x95,
-0x0,
-0x98a,
-0xfdcf,
-0xc22f,
-0x4063,
-0xd9e,
-0xffaf,
-0x41a1,
-0x41c3,
-0x96,
-0x0,
-0x976,
-0xfdef,
-0x740c,
-0xc006,
-0xac6,
-0xff6f,
-0x702c,
-0xc006,
-0x712c,
-0x734c,
-0xcee,
-0x20,
-0x706c,
-0x70f5,
-0x4ce,
-0x2a,
-0x702c,
-0x1600,
-0x7083,
-0x8000,
-0x4,
-0x2400,
-0x3f80,
-0x0,
-0x104,
-0xe9e,
-0xfeef,
-0xdab4,
-0xc094,
-0xe96,
-0xfeef,
-0xdab4,
-0x231a,
-0xf83,
-0x10,
-0x0,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0xc052,
-0x700c,
-0x48d,
-0x20,
-0xc350,
-0xc105,
-0xc006,
-0x2011,
-0x8040,
-0x478,
-0x21,
-0x702c,
-0xc005,
-0x780f,
-0xf76,
-0xffaf,
-0xc04a,
-0x4608,
-0x2456,
-0x3dc0,
-0x702c,
-0xe56,
-0xfeef,
-0xdab4,
-0xc005,
-0x70ad,
-0x70ed,
-0x2055,
-0xc01,
-0xc010,
-0x43db,
-0x9002,
-0x0,
-0x7825,
-0xc04b,
-0xca06,
-0xc049,
-0xf039,
-0x260a,
-0x33c0,
-0xf032,
-0x251a,
-0x1f81,
-0x0,
-0x1000,
-0x209a,
-0x4,
-0x7825,
-0xc044,
-0xc104,
-0xc00b,
-0x7825,
-0x781b,
-0x2005,
-0x6c0,
-0x8e6,
-0xfdef,
-0x9000,
-0x7a1c,
-0x2456,
-0x3dc1,
-0x7a5c,
-0x2114,
-0x781,
-0x7a5c,
-0xb100,
-0x7a5c,
-0xd91b,
-0xb961,
-0x9ff,
-0x8031,
-0x7a5d,
-0x7164,
-0x6059,
-0x2844,
-0x800,
-0xb9c4,
-0x7942,
-0x2354,
-0x3c82,
-0x2640,
-0x305e,
-0x209a,
-0x10,
-0x7905,
-0xc004,
-0x781b,
-0x7845,
-0xb020,
-0xba1,
-0x8234,
-0x4060,
-0x71a5,
-0xe709,
-0xc009,
-0xd8f,
-0x9024,
-0x706c,
-0xc005,
-0xc305,
-0x41c3,
-0x8e,
-0x2,
-0x2038,
-0x380,
-0x8a2,
-0xfdaf,
-0x42c1,
-0x40c3,
-0x8000,
-0x665,
-0xa8c1,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc00a,
-0x704c,
-0x9aa,
-0xfeaf,
-0x716c,
-0x1600,
-0x709b,
-0x8000,
-0x4,
-0x1600,
-0x710d,
-0x9008,
-0x1e0,
-0x40c1,
-0xfce,
-0xfdaf,
-0x702c,
-0xc04c,
-0x40c3,
-0x0,
-0xffff,
-0x4100,
-0x4200,
-0xeca,
-0xfe2f,
-0x4300,
-0x40c3,
-0x0,
-0xff7f,
-0x78a4,
-0x1e00,
-0x7004,
-0x9009,
-0xe1e0,
-0x2400,
-0x3f80,
-0x0,
-0x3f4,
-0x41c3,
-0x8000,
-0x4c1,
-0xe7a,
-0xfd6f,
-0xda60,
-0x2400,
-0x3f80,
-0x0,
-0x3f4,
-0xbea,
-0x60,
-0xd960,
-0xd8ff,
-0x1e00,
-0x7004,
-0x9003,
-0xf0c4,
-0x710c,
-0x2644,
-0x17cd,
-0xed05,
-0xbd61,
-0xdff,
-0x9031,
-0x781b,
-0x702c,
-0x205a,
-0x100,
-0x200f,
-0x380,
-0x780f,
-0xaf2,
-0xff2f,
-0xc051,
-0x700c,
-0xc047,
-0xf00c,
-0x7a1b,
-0x7034,
-0x2400,
-0x3f81,
-0x0,
-0x3d4,
-0x22ce,
-0x21,
-0x6119,
-0xa940,
-0x7104,
-0x8eb,
-0x8434,
-0x2044,
-0x41,
-0x40c3,
-0x8000,
-0x665,
-0x1005,
-0x9e,
-0x40c3,
-0x8000,
-0x665,
-0x231a,
-0x3f9b,
-0x10,
-0x0,
-0x8864,
-0x4468,
-0x1c34,
-0x36c0,
-0xf041,
-0x70ed,
-0xf03c,
-0xc00c,
-0x2055,
-0xc01,
-0xc00d,
-0x7825,
-0x251a,
-0x1f81,
-0x0,
-0x1000,
-0x7905,
-0x40e1,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0xf53,
-0x1231,
-0x90c0,
-0x78dd,
-0xf8ad,
-0x781d,
-0xbec4,
-0x702c,
-0xe808,
-0x4100,
-0x219a,
-0x10,
-0x2180,
-0x30,
-0x79c5,
-0x255f,
-0x148b,
-0x2400,
-0x3f82,
-0x0,
-0x320,
-0x7261,
-0xb228,
-0x41c3,
-0x0,
-0x141f,
-0x813,
-0x150,
-0x209a,
-0x10,
-0x2080,
-0x10,
-0x2005,
-0x381,
-0x2400,
-0x3f80,
-0x0,
-0x26c,
-0x7061,
-0xb028,
-0x71e5,
-0xf8b,
-0x9254,
-0x7185,
-0x7d8f,
-0xe7f,
-0xb365,
-0x710c,
-0x235f,
-0x24f,
-0xc044,
-0xf0cb,
-0x2400,
-0x3f80,
-0x0,
-0x320,
-0xa96,
-0x40,
-0xd80f,
-0xe0e,
-0xfdaf,
-0xd90f,
-0x710c,
-0xbb2,
-0xffaf,
-0xd9ff,
-0x45cb,
-0x9003,
-0xe024,
-0x1d00,
-0x1f84,
-0x0,
-0xffff,
-0xb506,
-0x1dfe,
-0x9004,
-0x700c,
-0xc044,
-0x1da8,
-0x101c,
-0x1da9,
-0x101c,
-0xc012,
-0xde21,
-0x712c,
-0xb8e2,
-0x26ca,
-0x1be1,
-0x942,
-0xfdaf,
-0x40c1,
-0x2400,
-0x3f80,
-0x0,
-0x104,
-0xf72,
-0xff0f,
-0x2400,
-0x3f80,
-0x0,
-0x26c,
-0xa3a,
-0x40,
-0xd80f,
-0xdb6,
-0xfdaf,
-0xd90f,
-0x730c,
-0xb5a,
-0xffaf,
-0xd9ff,
-0x712c,
-0x700c,
-0x1d00,
-0x1f84,
-0x0,
-0xffff,
-0xb526,
-0x1dfe,
-0x9044,
-0x1da8,
-0x101c,
-0x1da9,
-0x101c,
-0x8fa,
-0xfdaf,
-0x40c1,
-0xf32,
-0xff2f,
-0xc094,
-0xc007,
-0x45e9,
-0x780f,
-0xc053,
-0x40c3,
-0x8000,
-0x665,
-0x8804,
-0xc048,
-0xf063,
-0xe508,
-0x722c,
-0xde08,
-0xf05a,
-0x7ab0,
-0x2400,
-0x3f80,
-0x0,
-0x104,
-0x20f5,
-0x8c,
-0xc094,
-0x20f5,
-0x83,
-0x4b90,
-0x2048,
-0x0,
-0x780e,
-0x883,
-0x1b3,
-0x7134,
-0x712c,
-0xf246,
-0xc040,
-0x700c,
-0x41c3,
-0xac,
-0x3,
-0x4263,
-0xe3a,
-0xfd6f,
-0x43c1,
-0xc00c,
-0x716c,
-0x2055,
-0x8c1,
-0xc00d,
-0x7905,
-0x231a,
-0x3f80,
-0x0,
-0x1000,
-0x7825,
-0x781b,
-0x2005,
-0xf80,
-0x9002,
-0x200,
-0xc049,
-0x9040,
-0xc013,
-0x2400,
-0x3f81,
-0x0,
-0x3d4,
-0x2133,
-0x1,
-0xc240,
-0x6158,
-0x780e,
-0xc042,
-0x2048,
-0x0,
-0x2049,
-0x800,
-0xc141,
-0xc044,
-0xc043,
-0x740c,
-0x41c3,
-0xad,
-0x6,
-0xd96,
-0xfdaf,
-0x4263,
-0xc104,
-0xc009,
-0xb020,
-0x710c,
-0x712c,
-0xc044,
-0xf00a,
-0x2456,
-0x3dc0,
-0x2014,
-0x82,
-0x6398,
-0x781c,
-0x2048,
-0x0,
-0xb200,
-0x71a5,
-0x71c5,
-0xe4f,
-0x9254,
-0xc008,
-0x7104,
-0xc048,
-0xc008,
-0x790f,
-0x40c3,
-0x8000,
-0x665,
-0x8805,
-0x833,
-0x8065,
-0x4338,
-0xc004,
-0x7014,
-0x878,
-0xff02,
-0xc007,
-0x7104,
-0xc047,
-0xc004,
-0x7014,
-0xf535,
-0x41c3,
-0xae,
-0x0,
-0xd36,
-0xfdaf,
-0x740c,
-0x40c3,
-0x8000,
-0x665,
-0x88c4,
-0xf027,
-0x7ff0,
-0xe708,
-0xdd08,
-0xf01f,
-0x2004,
-0xf81,
-0x1,
-0xfffe,
-0x2400,
-0x3f80,
-0x0,
-0x104,
-0x2035,
-0x43,
-0xc094,
-0x2035,
-0x42,
-0x2456,
-0x3dc0,
-0x2035,
-0x40,
-0xc241,
-0xc340,
-0xc042,
-0x740c,
-0x41c3,
-0xaf,
-0x5,
-0x4263,
-0xcea,
-0xfdaf,
-0x43a1,
-0x71a5,
-0x71e5,
-0xdc7,
-0x9274,
-0x78fb,
-0x71c5,
-0x40c3,
-0x8000,
-0x665,
-0x8805,
-0x79cf,
-0x8ab,
-0x8065,
-0x4338,
-0xe46,
-0xfeaf,
-0xc011,
-0x1e00,
-0x7005,
-0x9003,
-0xe004,
-0x1600,
-0x7001,
-0x8000,
-0x674,
-0xc00a,
-0x704c,
-0xe1e,
-0xfe6f,
-0x706c,
-0xc00b,
-0x2456,
-0x3dc1,
-0x704c,
-0x90a,
-0x60,
-0x716c,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0x7314,
-0x378,
-0xffce,
-0x2480,
-0x3511,
-0x1404,
-0x341b,
-0xc6c6,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ad,
-0x1600,
-0x708c,
-0x8000,
-0x4,
-0xc340,
-0xc148,
-0x241a,
-0x1f8c,
-0x20,
-0x0,
-0xc04a,
-0x70ed,
-0x2405,
-0x1f80,
-0x9002,
-0x90,
-0x9020,
-0x206f,
-0x243,
-0x887a,
-0x2344,
-0x800,
-0xc046,
-0x700c,
-0x915,
-0x71,
-0xc044,
-0x2405,
-0x1f80,
-0x9002,
-0x96,
-0x9000,
-0xb8c5,
-0xc044,
-0x224f,
-0x40,
-0xc047,
-0xba80,
-0x40c3,
-0x9003,
-0xe024,
-0xc249,
-0x1800,
-0xfc5,
-0x180c,
-0xfc5,
-0x18fe,
-0x83c4,
-0xc006,
-0xf870,
-0x781d,
-0x68c9,
-0x710c,
-0xc042,
-0xf0bf,
-0xc00a,
-0x2011,
-0x83c0,
-0xf2ba,
-0x78ef,
-0x702c,
-0xdaff,
-0xb2e,
-0xfdef,
-0x4318,
-0x4063,
-0xa56,
-0xffaf,
-0x702c,
-0x4508,
-0xc008,
-0x4163,
-0xdaff,
-0x7b0f,
-0xaaa,
-0xfe2f,
-0x700c,
-0x4063,
-0xd9ff,
-0xabe,
-0xff6f,
-0x714c,
-0x916,
-0xfeaf,
-0x4063,
-0xc009,
-0x833,
-0xf1,
-0x710c,
-0x2544,
-0x17c1,
-0xe906,
-0xb961,
-0x901,
-0x31,
-0x781b,
-0x205a,
-0x100,
-0x200f,
-0x34d,
-0xc02,
-0x60,
-0x4063,
-0xfae,
-0xfdef,
-0x4063,
-0x8820,
-0x7aaf,
-0xb72,
-0x20,
-0x4040,
-0x45cb,
-0x8000,
-0x669,
-0x8d00,
-0x1501,
-0x108b,
-0x702c,
-0xc041,
-0xd8ff,
-0xb02,
-0xfdaf,
-0xda08,
-0xc045,
-0xc001,
-0x2340,
-0x1041,
-0x7902,
-0xc005,
-0x7829,
-0x780f,
-0xc04b,
-0x700c,
-0xc043,
-0xf018,
-0x793d,
-0x209f,
-0x41,
-0x793d,
-0x1a12,
-0x3058,
-0x1212,
-0x3081,
-0x2000,
-0xf80,
-0x8000,
-0x6dc,
-0x724c,
-0x9de,
-0xffaf,
-0xc04c,
-0xc20c,
-0x4063,
-0xe42,
-0xffaf,
-0x702c,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0xc10b,
-0x780f,
-0x8cb,
-0x8064,
-0x791d,
-0xc007,
-0x7314,
-0xa30,
-0x61,
-0x4063,
-0x206f,
-0x243,
-0x887a,
-0xc000,
-0x88d,
-0x10,
-0xb89,
-0x1e,
-0x8d01,
-0x8d20,
-0x7104,
-0x4831,
-0xc005,
-0x7829,
-0x790f,
-0xf037,
-0x70ad,
-0x704c,
-0xf012,
-0x209f,
-0x41,
-0x44cb,
-0x8000,
-0x6dc,
-0x78b4,
-0x608c,
-0x2000,
-0xf80,
-0x8000,
-0x6dc,
-0x8801,
-0xc0b,
-0x1025,
-0x6058,
-0x4892,
-0x71a5,
-0xddf,
-0x97f4,
-0x4061,
-0xc006,
-0xe886,
-0x7650,
-0x22ca,
-0x385,
-0x4648,
-0xf016,
-0xc002,
-0x225a,
-0x402,
-0x7c10,
-0x265a,
-0x1400,
-0x2805,
-0x300,
-0xf818,
-0x4e10,
-0x2a05,
-0x30e,
-0x7edd,
-0x7edd,
-0x7edd,
-0x7edd,
-0x661e,
-0xc002,
-0x7104,
-0xc042,
-0xc003,
-0x7104,
-0xc043,
-0xc003,
-0x7a0f,
-0xa95,
-0x8064,
-0x4348,
-0x71e5,
-0x72f5,
-0x682,
-0xffc5,
-0xc000,
-0xe814,
-0xb25,
-0x1e,
-0xc000,
-0x8040,
-0xa1d,
-0x3a5,
-0x750c,
-0x41c3,
-0x8d,
-0x2,
-0xa66,
-0xfdaf,
-0x43c1,
-0xc100,
-0xc004,
-0xa904,
-0xc000,
-0xa0c0,
-0xc0ad,
-0x1404,
-0x341b,
-0xc6c6,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x7ee0,
-0x78e0,
-0xc0e4,
-0xf029,
-0x45cb,
-0x8000,
-0x71b,
-0xe910,
-0x93b,
-0x70,
-0x4448,
-0x941,
-0xb1,
-0x4448,
-0x249a,
-0x1041,
-0x659d,
-0x8dc0,
-0x8881,
-0x64dc,
-0xad80,
-0xf016,
-0x4448,
-0x249a,
-0x1041,
-0x64be,
-0x8ea0,
-0x8881,
-0x64bc,
-0xae80,
-0x8882,
-0x2452,
-0x11cd,
-0x8e81,
-0x64bc,
-0xae81,
-0xf006,
-0x249a,
-0x1041,
-0x64bc,
-0x88a2,
-0xaca1,
-0x7144,
-0xab5,
-0x80c4,
-0xc4c4,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x260a,
-0x3080,
-0x4200,
-0x40c3,
-0x8000,
-0x669,
-0x4738,
-0x1001,
-0x8b,
-0x8820,
-0xf02a,
-0xe49,
-0x332e,
-0x4789,
-0x205f,
-0x243,
-0x279a,
-0x1008,
-0x45cb,
-0x9002,
-0x80,
-0x73e3,
-0x2333,
-0x30e,
-0x201a,
-0xf83,
-0x0,
-0x2000,
-0x665e,
-0x2642,
-0x905b,
-0x7f65,
-0x2705,
-0x1343,
-0xb340,
-0xdb7f,
-0x23ca,
-0x2b,
-0x238c,
-0xbf41,
-0x26ca,
-0x10cd,
-0x2542,
-0x180d,
-0x7bcf,
-0x7fa5,
-0xb760,
-0x7185,
-0xcb9,
-0x9254,
-0x7124,
-0x782f,
-0xbfb,
-0x9025,
-0x708d,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a8,
-0xc145,
-0x4318,
-0x700c,
-0xd9ff,
-0xc346,
-0xb7a,
-0xfd6f,
-0xc244,
-0xc00d,
-0x70cd,
-0x70ad,
-0xc047,
-0xf03a,
-0x2532,
-0x1f8f,
-0x8000,
-0x524,
-0x702c,
-0x93e,
-0xfd6f,
-0x42e1,
-0xc207,
-0x7944,
-0xc206,
-0x7844,
-0x2005,
-0x807e,
-0xf42b,
-0xc005,
-0x702c,
-0x734c,
-0xdb22,
-0x60e8,
-0x1c0c,
-0x3001,
-0x1c08,
-0x36c0,
-0xc040,
-0xd8ff,
-0xe3a,
-0xfd6f,
-0xc741,
-0xd07,
-0x1190,
-0xed99,
-0x70b5,
-0xd9c8,
-0xd8fa,
-0xc6a,
-0xfe6f,
-0x20ca,
-0x41,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x780f,
-0xc043,
-0x700c,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0x702c,
-0x754c,
-0xe02,
-0xfd6f,
-0xdb20,
-0x71a5,
-0xd8f,
-0x9334,
-0x710c,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb41,
-0x1c0c,
-0x3401,
-0xc642,
-0xc641,
-0xbd6,
-0xfd6f,
-0xc640,
-0xd8ff,
-0xd980,
-0x754c,
-0x746c,
-0xc643,
-0xc642,
-0xc641,
-0xbc2,
-0xfd6f,
-0xc640,
-0x700c,
-0xb5e,
-0xfd6f,
-0x712c,
-0xc004,
-0xe833,
-0x700c,
-0xaba,
-0xfd6f,
-0xd9ff,
-0xd84f,
-0x70ad,
-0x2353,
-0x305b,
-0xc040,
-0xf817,
-0xc543,
-0x1c08,
-0x36c0,
-0xb96,
-0xfd6f,
-0xc541,
-0x700c,
-0xb32,
-0xfd6f,
-0x712c,
-0x40c3,
-0xf,
-0x4240,
-0xad2,
-0xfeaf,
-0x702c,
-0x700c,
-0xa86,
-0xfd6f,
-0xd9ff,
-0xd851,
-0xc040,
-0xf80b,
-0xc543,
-0x1c08,
-0x36c0,
-0xb66,
-0xfd6f,
-0xc541,
-0x700c,
-0xb02,
-0xfd6f,
-0x712c,
-0x40c3,
-0x0,
-0x1f40,
-0xaa2,
-0xfeaf,
-0xd91e,
-0xc0a8,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0xd980,
-0xda17,
-0x746c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0xc1a4,
-0x4628,
-0x4708,
-0x700c,
-0xa3a,
-0xfd6f,
-0xd9ff,
-0x702c,
-0xd8ff,
-0x734c,
-0xdb22,
-0x4528,
-0xc143,
-0xc742,
-0x1c04,
-0x3381,
-0xd26,
-0xfd6f,
-0xc640,
-0xb62,
-0xfe6f,
-0xd8fa,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x781d,
-0x780f,
-0xc043,
-0xd8ff,
-0x702c,
-0x754c,
-0xdb20,
-0xc542,
-0xc541,
-0xcfe,
-0xfd6f,
-0xc540,
-0xd8ff,
-0xd980,
-0x754c,
-0x726c,
-0xc543,
-0xc542,
-0xc541,
-0xada,
-0xfd6f,
-0xc540,
-0x700c,
-0xa76,
-0xfd6f,
-0x712c,
-0xc0a4,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ac,
-0xc349,
-0xc247,
-0xc14a,
-0xd42,
-0xfdaf,
-0xc046,
-0xc011,
-0x71ed,
-0xc04b,
-0xc012,
-0xc048,
-0xd8ff,
-0xc044,
-0x700c,
-0xc045,
-0xf0b8,
-0xc005,
-0x2032,
-0xf9b,
-0x8000,
-0x524,
-0xc00a,
-0x2032,
-0x6ce,
-0xc004,
-0x780f,
-0x208c,
-0x8fc3,
-0xf40b,
-0x40c3,
-0x0,
-0xa00,
-0x98a,
-0xfd6f,
-0xd9ff,
-0xd4e,
-0xff4f,
-0x700c,
-0xc044,
-0x41e1,
-0x2344,
-0x37c0,
-0xc209,
-0xe806,
-0xb861,
-0x801,
-0x31,
-0x793b,
-0xd81f,
-0x7a24,
-0xb861,
-0x801,
-0x31,
-0x793c,
-0xc00b,
-0x7824,
-0x2205,
-0x803e,
-0xf479,
-0x78dd,
-0x781d,
-0x2044,
-0x800,
-0x2045,
-0x18d,
-0xc008,
-0xe80b,
-0xf87e,
-0xc043,
-0x700c,
-0xc042,
-0xc041,
-0xc040,
-0xd8ff,
-0xa2a,
-0xfd6f,
-0xdb20,
-0xc004,
-0x702c,
-0x704c,
-0x7104,
-0xc044,
-0x40c3,
-0x8000,
-0x57c,
-0x8801,
-0x726c,
-0xc741,
-0xc043,
-0xc006,
-0xc540,
-0xc042,
-0xa06,
-0xfd6f,
-0xd8ff,
-0x40c3,
-0x8000,
-0x57c,
-0x8801,
-0x70ad,
-0x2353,
-0x315b,
-0xc043,
-0xf869,
-0xc542,
-0xc741,
-0x9ea,
-0xfd6f,
-0x1c00,
-0x36c0,
-0xf868,
-0xc043,
-0xc006,
-0x726c,
-0xc741,
-0xc042,
-0x78dd,
-0x2044,
-0x800,
-0x2045,
-0x580,
-0xc040,
-0x9ca,
-0xfd6f,
-0xd8ff,
-0x40c3,
-0x8000,
-0x57c,
-0x8801,
-0xbec5,
-0x702c,
-0xc043,
-0xd8ff,
-0x704c,
-0x726c,
-0xc542,
-0xc741,
-0x9ae,
-0xfd6f,
-0xc640,
-0xc005,
-0xe819,
-0x40c3,
-0x0,
-0x2710,
-0x90e,
-0xfeaf,
-0xd90a,
-0x781d,
-0x781d,
-0x7704,
-0x7e0f,
-0xf850,
-0xc542,
-0xc541,
-0xc540,
-0x986,
-0xfd6f,
-0xc643,
-0xf84d,
-0xc643,
-0xc542,
-0xc541,
-0xc540,
-0xf00d,
-0x40c3,
-0x8000,
-0x57c,
-0x8801,
-0xc542,
-0xc541,
-0xc043,
-0xc540,
-0xd8ff,
-0x702c,
-0x704c,
-0xdb18,
-0x95e,
-0xfd4f,
-0xc004,
-0x790f,
-0x90f,
-0x110,
-0xc005,
-0x817,
-0x2d1,
-0xe909,
-0xbc6,
-0xff4f,
-0x700c,
-0x8e6,
-0xfd6f,
-0x712c,
-0xd8ff,
-0xc044,
-0xc005,
-0x7104,
-0xc045,
-0xc005,
-0xe08c,
-0x690,
-0xffc5,
-0xc007,
-0x8cf,
-0x30,
-0xd9ff,
-0x47cb,
-0x0,
-0xa00,
-0x82a,
-0xfd6f,
-0x40e1,
-0xbea,
-0xff4f,
-0x46cb,
-0x8000,
-0x57d,
-0x8e00,
-0x702c,
-0x234a,
-0x3800,
-0xc043,
-0xc006,
-0x704c,
-0x726c,
-0xc042,
-0xd8ff,
-0x4528,
-0xc141,
-0x8f6,
-0xfd6f,
-0x1c00,
-0x36c0,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0x8de,
-0xfd6f,
-0x1c00,
-0x33c1,
-0xb52,
-0xff4f,
-0x700c,
-0x872,
-0xfd6f,
-0x712c,
-0x40c3,
-0xf,
-0x4240,
-0x812,
-0xfeaf,
-0x702c,
-0x40e1,
-0xfc6,
-0xfd2f,
-0xd9ff,
-0xb8a,
-0xff4f,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xc006,
-0x726c,
-0xc541,
-0xc042,
-0xd8ff,
-0x89e,
-0xfd6f,
-0x1c00,
-0x36c0,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0x726c,
-0xc542,
-0xc541,
-0x886,
-0xfd6f,
-0x1c00,
-0x3441,
-0x8e00,
-0x702c,
-0x704c,
-0xc043,
-0xd8ff,
-0xdb10,
-0xc542,
-0xc541,
-0x86e,
-0xfd6f,
-0xc540,
-0xae6,
-0xff4f,
-0x700c,
-0x806,
-0xfd6f,
-0x712c,
-0xc22,
-0xfd8f,
-0xc0ac,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xd8ff,
-0x702c,
-0x704c,
-0x726c,
-0x7ee0,
-0x78e0,
-0x40c3,
-0x8000,
-0x57c,
-0x8801,
-0x702c,
-0x704c,
-0x7ee0,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a9,
-0xc145,
-0xd958,
-0xb99f,
-0xc046,
-0x8900,
-0x11cd,
-0x808f,
-0x70ad,
-0xc047,
-0xc00e,
-0x71cd,
-0xc343,
-0xc244,
-0xc048,
-0xf058,
-0x2544,
-0x17c1,
-0x706f,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0xc042,
-0xf04b,
-0xc007,
-0xc202,
-0xc108,
-0x7077,
-0x20ca,
-0x3c1,
-0x7944,
-0x790b,
-0xf242,
-0xc002,
-0x2344,
-0x37c1,
-0x262f,
-0x3007,
-0x40c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781b,
-0x98a,
-0xfdaf,
-0x780f,
-0x40c3,
-0x8000,
-0x57c,
-0x8800,
-0xe81c,
-0x1600,
-0x7080,
-0x8000,
-0x1,
-0x831,
-0xdf,
-0xc003,
-0x235a,
-0x3c81,
-0x265f,
-0x3102,
-0xc040,
-0xc006,
-0xc304,
-0x1c04,
-0x3001,
-0x6119,
-0x255a,
-0x1640,
-0x6119,
-0xc002,
-0x7845,
-0xc205,
-0xcce,
-0xffef,
-0x780f,
-0xf014,
-0xc003,
-0x235a,
-0x3c81,
-0x265f,
-0x3102,
-0xc040,
-0xc006,
-0xc304,
-0x6119,
-0x255a,
-0x1640,
-0x6119,
-0xc002,
-0x7845,
-0xc205,
-0xaf2,
-0xffef,
-0x780f,
-0x7167,
-0xb6f,
-0xb094,
-0x71a5,
-0xd53,
-0x90b4,
-0x40c1,
-0x912,
-0xfdaf,
-0x730c,
-0xc0a9,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e4,
-0x42c3,
-0x8000,
-0x669,
-0x8a80,
-0x8ac1,
-0x245f,
-0x1481,
-0x6038,
-0xf013,
-0x919,
-0x211,
-0x231a,
-0xf82,
-0x0,
-0x2000,
-0x2205,
-0xf8d,
-0x9002,
-0x1064,
-0x9040,
-0xb540,
-0x7124,
-0x7204,
-0x9e5,
-0x8254,
-0x7185,
-0x7b8f,
-0xef9,
-0x90e5,
-0x702c,
-0xf2e,
-0xfe8f,
-0xc6c4,
-0xc2e2,
-0x260a,
-0x3040,
-0x4308,
-0x70ad,
-0xf024,
-0x255a,
-0x1182,
-0x7261,
-0x8a01,
-0x8a60,
-0x8a22,
-0x209a,
-0x4,
-0x7b05,
-0x8a03,
-0x209a,
-0x4,
-0x7825,
-0x201a,
-0xf80,
-0x1,
-0x0,
-0x2005,
-0xc1,
-0x8a05,
-0x8a64,
-0x7734,
-0x209a,
-0x4,
-0x7865,
-0xf207,
-0x793b,
-0xb99c,
-0xb99f,
-0xb100,
-0xf003,
-0xdb6,
-0xfe4f,
-0x71a5,
-0x2e45,
-0x3180,
-0xdb9,
-0x9004,
-0xc6c2,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1a1,
-0x4718,
-0x40c3,
-0x8000,
-0x669,
-0x88c0,
-0x4338,
-0xc340,
-0xea04,
-0x79db,
-0xf004,
-0x265f,
-0x1241,
-0x1001,
-0x9e,
-0x7054,
-0xdd08,
-0x25ca,
-0x1062,
-0xf039,
-0x40e1,
-0x209a,
-0x4,
-0xc300,
-0x23f5,
-0x3042,
-0xeb13,
-0x7c5c,
-0x7c9c,
-0x7c9c,
-0x7c9c,
-0x224a,
-0x16c0,
-0x2a44,
-0x803,
-0x2242,
-0x104a,
-0xafd,
-0x9031,
-0x7c9d,
-0x629a,
-0xbac4,
-0x4a94,
-0xf00d,
-0x248a,
-0x1fcf,
-0x7c44,
-0x2204,
-0xf83,
-0x0,
-0xfc00,
-0xda0a,
-0xba61,
-0xaff,
-0x8031,
-0x7b7d,
-0x261a,
-0x1f82,
-0x0,
-0x1000,
-0x239a,
-0x1,
-0x71e5,
-0x7124,
-0x2205,
-0x7c2,
-0x7845,
-0x781b,
-0xb891,
-0xb89c,
-0x7b85,
-0xb89f,
-0xb060,
-0xd97,
-0x93c5,
-0x71c5,
-0xefd,
-0xb3a5,
-0x70ed,
-0x7487,
-0x1404,
-0x341b,
-0xc6c6,
-0xc2e6,
-0xc1a1,
-0x216f,
-0xdc3,
-0x7014,
-0x8900,
-0x45cb,
-0x40,
-0x1800,
-0x46cb,
-0x8000,
-0x684,
-0x857,
-0x3e,
-0x7dc0,
-0x11e9,
-0x808f,
-0x41c3,
-0x143,
-0x0,
-0xac6,
-0xfd6f,
-0x740c,
-0x275f,
-0x1182,
-0x43c3,
-0x12,
-0x310,
-0x41c3,
-0x9000,
-0x0,
-0xdf08,
-0x6278,
-0x7825,
-0x9000,
-0xae00,
-0xbf61,
-0xf01,
-0x1031,
-0x781d,
-0xae19,
-0x6b02,
-0x6058,
-0x7825,
-0x9000,
-0x41c3,
-0x8000,
-0x6b6,
-0xda08,
-0xa900,
-0xba61,
-0xa01,
-0x31,
-0x781d,
-0xa919,
-0xbe6c,
-0x40c1,
-0xed6,
-0xfeef,
-0xd90d,
-0x40c1,
-0xd90d,
-0x8d2,
-0xfe6f,
-0xda40,
-0x40c1,
-0xd90d,
-0xfe2,
-0xfd2f,
-0xda7f,
-0xdfff,
-0x40c1,
-0x702c,
-0x42a1,
-0x706c,
-0xd3a,
-0xffef,
-0xc740,
-0x40c1,
-0xd90d,
-0x8ae,
-0xfe6f,
-0xda80,
-0x40c1,
-0x702c,
-0x42c3,
-0xffff,
-0xdfff,
-0x776c,
-0xd1e,
-0xffef,
-0xc740,
-0x40c1,
-0xbba,
-0xfeef,
-0xd90d,
-0x7487,
-0xc6c6,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1b2,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0x4328,
-0xc043,
-0x4020,
-0x702c,
-0x996,
-0xfd6f,
-0x734c,
-0xc045,
-0x4061,
-0x742c,
-0x98a,
-0xfd6f,
-0xda08,
-0xc046,
-0xc003,
-0x251a,
-0x1f8d,
-0x10,
-0x0,
-0x704c,
-0x2055,
-0x8c0,
-0xc044,
-0x1600,
-0x7080,
-0x8000,
-0x669,
-0xc041,
-0xf042,
-0xc606,
-0xc005,
-0x2351,
-0xb000,
-0x26ca,
-0x1001,
-0xee36,
-0x784f,
-0xd941,
-0x790a,
-0xc047,
-0x40c3,
-0x8000,
-0x71a,
-0x610a,
-0x6038,
-0x1001,
-0xc1,
-0xca0c,
-0x4363,
-0x6159,
-0x2044,
-0x7c2,
-0x4020,
-0xea06,
-0xba61,
-0xa01,
-0x31,
-0x781b,
-0x7f0f,
-0xc202,
-0x277c,
-0x1800,
-0x41c3,
-0x75,
-0x3,
-0x9ea,
-0xfd2f,
-0xc740,
-0xc002,
-0xc104,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x79a5,
-0x7905,
-0x4063,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0xb0e0,
-0x79cf,
-0xc007,
-0x611a,
-0x7167,
-0xb8b,
-0xb094,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0x780f,
-0xc042,
-0x40c3,
-0x8000,
-0x669,
-0x8821,
-0xc002,
-0x9e7,
-0x8025,
-0x706f,
-0x1600,
-0x7080,
-0x8000,
-0x12,
-0x847,
-0x1b5,
-0xc088,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0x702c,
-0xe8e,
-0xfe6f,
-0xda28,
-0xc203,
-0x41c3,
-0x19,
-0x1,
-0x922,
-0xfd6f,
-0x750c,
-0x251a,
-0x1f8d,
-0x10,
-0x0,
-0xc004,
-0xc188,
-0x724c,
-0x9b2,
-0xfeef,
-0x78a5,
-0x700c,
-0x722c,
-0xc288,
-0xa5e,
-0xfd2f,
-0x726c,
-0xc0b2,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0x2482,
-0x3203,
-0xc043,
-0x1600,
-0x7080,
-0x8000,
-0x669,
-0x1600,
-0x709b,
-0x8000,
-0x4,
-0x70ed,
-0xc041,
-0xc003,
-0x231a,
-0x3f9b,
-0x10,
-0x0,
-0x2055,
-0xc00,
-0xc044,
-0xf057,
-0xd8ff,
-0x2644,
-0x17c1,
-0xe905,
-0xb961,
-0x9ff,
-0x8031,
-0x781d,
-0x893,
-0x3e,
-0x78ef,
-0x209f,
-0x41,
-0x41c3,
-0x8000,
-0x71a,
-0x602a,
-0x6038,
-0x1001,
-0xc1,
-0xca0c,
-0x6159,
-0x2044,
-0x7c2,
-0x4020,
-0xea05,
-0xba61,
-0xaff,
-0x8031,
-0x781b,
-0x7a0e,
-0x785c,
-0x781c,
-0x781c,
-0x781c,
-0x4100,
-0xd81b,
-0xb861,
-0x801,
-0x31,
-0x793d,
-0x6238,
-0xb8c4,
-0x4831,
-0x2a44,
-0x800,
-0xc202,
-0x7d10,
-0x257c,
-0x1200,
-0x259a,
-0x1001,
-0x7d25,
-0x79b0,
-0xc140,
-0x41c3,
-0x7b,
-0x3,
-0x89e,
-0xfd2f,
-0x43c1,
-0xc004,
-0x71e5,
-0x2305,
-0x3001,
-0xc002,
-0x201a,
-0xf80,
-0x0,
-0x1000,
-0x7905,
-0x40c1,
-0x209a,
-0x4,
-0x7825,
-0x781b,
-0xb891,
-0xb89c,
-0xb89f,
-0xb0a0,
-0x71c5,
-0xe5f,
-0x9254,
-0xc001,
-0x7104,
-0xc041,
-0xc001,
-0x780f,
-0xc042,
-0x40c3,
-0x8000,
-0x669,
-0x8821,
-0xc002,
-0x9e9,
-0x8025,
-0x70cd,
-0x1600,
-0x7080,
-0x8000,
-0x12,
-0x845,
-0x1b5,
-0xc085,
-0x1600,
-0x708d,
-0x8000,
-0x4,
-0x702c,
-0xd42,
-0xfe6f,
-0xdab4,
-0xc203,
-0x41c3,
-0x17,
-0x1,
-0xfda,
-0xfd2f,
-0x750c,
-0x251a,
-0x1f8d,
-0x10,
-0x0,
-0xc004,
-0xc185,
-0xda09,
-0x86a,
-0xfeef,
-0x78a5,
-0x700c,
-0xd909,
-0xc285,
-0x916,
-0xfd2f,
-0x726c,
-0x2480,
-0x3203,
-0x1404,
-0x341b,
-0xc6c6,
-0x78e0,
-0xc2e6,
-0x1cfc,
-0xb6c8,
-0xc1ad,
-0xc040,
-0xd8ff,
-0x702c,
-0xf1e,
-0xfd2f,
-0x734c,
-0xc046,
-0xd8ff,
-0x742c,
-0xf12,
-0xfd2f,
-0xda08,
-0xc047,
-0xc000,
-0x47cb,
-0x8000,
-0x667,
-0x8f20,
-0x205f,
-0x500,
-0xc043,
-0x603a,
-0x2200,
-0xf9b,
-0x8000,
-0x1b70,
-0xb76,
-0xfdaf,
-0xc000,
-0x8f20,
-0x8fc1,
-0x704c,
-0x260a,
-0x3040,
-0x4328,
-0xc042,
-0xc241,
-0xf020,
-0xc507,
-0xc006,
-0x25ca,
-0x1001,
-0xed18,
-0xca07,
-0x92b,
-0x25,
-0x784f,
-0xd941,
-0xc044,
-0x782a,
-0x2032,
-0xf80,
-0x8000,
-0x71c,
-0xb9a,
-0xff6f,
-0xc045,
-0x1b00,
-0x3002,
-0xc204,
-0xc105,
-0xc001,
-0x62ba,
-0x6038,
-0xc041,
-0x7167,
-0x2640,
-0x305e,
-0x212f,
-0x787,
-0xec1,
-0x9065,
-0x2651,
-0xb000,
-0x1600,
-0x7080,
-0x8000,
-0x12,
-0x861,
-0x1b5,
-0xc088,
-0x702c,
-0xc56,
-0xfe6f,
-0xda14,
-0xc200,
-0x41c3,
-0x18,
-0x1,
-0xeee,
-0xfd2f,
-0x750c,
-0xc203,
-0x8f22,
-0x8f63,
-0x2200,
-0xf82,
-0x8000,
-0x1b70,
-0x7c3b,
-0xf00e,
-0x70ad,
-0xf007,
-0xc688,
-0x661e,
-0x6208,
-0x7185,
-0x71a5,
-0xae00,
-0x78af,
-0x8f3,
-0x80b4,
-0x7890,
-0x7124,
-0x782f,
-0xbe7,
-0x8025,
-0x700c,
-0x722c,
-0xc288,
-0x80a,
-0xfd2f,
-0x716c,
-0x1700,
-0x108b,
-0x8fc1,
-0x234e,
-0x1040,
-0x661e,
-0xc001,
-0x79d0,
-0x2805,
-0x40,
-0xafe,
-0xff6f,
-0x780f,
-0xc102,
-0xa900,
-0xc0ad,
-0x1404,
-0x341b,
-0xc6c6,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
+
+static const struct ddr_phy_reg lp4_3733_phy_train1d2d_seq1[] = {
+{0xd0000,0x1},
+{0xd0000,0x1},
+{0xd0099,0x9},
+{0xd0099,0x1},
+{0xd0099,0x0},
 };
-const short int dccm_array1[702] = {
-0x0,
-0x0,
-0x0,
-0xe92,
-0x2,
-0x0,
-0x17,
-0x0,
-0x61,
-0x4,
-0x0,
-0x3,
-0x0,
-0x100,
-0x0,
-0x100,
-0x8020,
-0x0,
-0x110,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x3664,
-0x33,
-0x4d24,
-0x5408,
-0x0,
-0x6,
-0x3664,
-0x33,
-0x4d24,
-0x5408,
-0x0,
-0x6,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x1000,
-0x1,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x6400,
-0x3336,
-0x2400,
-0x84d,
-0x54,
-0x600,
-0x6400,
-0x3336,
-0x2400,
-0x84d,
-0x54,
-0x600,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0xff00,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x100,
-0x14,
-0x0,
-0x0,
-0x0,
-0x0,
-0x14a,
-0x181,
-0x118,
-0x118,
-0x16f,
-0x16f,
-0x159,
-0x181,
-0x120,
-0x120,
-0x0,
-0x0,
-0x701c,
-0x61a8,
-0x35ac,
-0x35ac,
-0x125c,
-0x125c,
-0xc738,
-0xb0f4,
-0x6590,
-0x6590,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x9f38,
-0x58,
-0x0,
-0x321e,
-0x100,
-0x0,
-0xffff,
-0x1e0,
-0xf0,
-0xa0,
-0x78,
-0x60,
-0x50,
-0x43,
-0x3c,
-0x35,
-0x30,
-0x2c,
-0x28,
-0x25,
-0x22,
-0x20,
-0x1e,
-0x1c,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0x100,
-0x302,
-0x706,
-0xb0a,
-0xf0e,
-0x1b1a,
-0x1f1e,
-0x3b3a,
-0x3f3e,
-0x0,
-0x2820,
-0x140f,
-0x1f02,
-0x1f0,
-0x0,
-0xb400,
-0x1ff,
-0x100,
-0xb400,
-0x1f0,
-0x0,
-0xb400,
-0x1f4,
-0x0,
-0xb900,
-0x1f0,
-0x0,
-0xba00,
-0x1f0,
-0x0,
-0xbb00,
-0x1f0,
-0x0,
-0x100,
-0x1f0,
-0x0,
-0x1300,
-0x1f0,
-0x0,
-0xf900,
-0x4f0,
-0x0,
-0xfa02,
-0x4f0,
-0x0,
-0xfb00,
-0x4f0,
-0x0,
-0x6004,
-0x7f0,
-0x800,
-0x6500,
-0x7f0,
-0x0,
-0x6200,
-0x1ff,
-0x0,
-0x200,
-0x1f0,
-0x2000,
-0x2,
-0x0,
-0x20d,
-0x301,
-0xc0b,
-0x160e,
-0x1004,
-0x1811,
-0xc06,
-0x1610,
-0x201c,
-0x2824,
-0xc06,
-0x1812,
-0x241e,
-0x2c28,
-0xa06,
-0x140e,
-0x1c18,
-0x2420,
-0xa06,
-0x1610,
-0x201a,
-0x2824,
-0x6e,
-0x2,
-0x1,
-0xfd,
-0x4,
-0xf,
-0x60,
-0x7,
-0x0,
-0xe8,
-0x4,
-0xff,
-0xfc,
-0x4,
-0x404,
-0x3a,
-0x2,
-0x2,
-0x11,
-0x7,
-0x0,
-0x0,
+
+static const struct ddr_phy_reg lp4_3733_phy_train1d2d_seq2[] = {
+{0xd0099,0x1},
+{0xd0000,0x0},
+{0xd0000,0x1},
+{0xd0000,0x0},
+};
+
+static const struct ddr_phy_reg lp4_3733_phy_train1d2d_seq3[] = {
+{0xd0000,0x1},
+{0xd0000,0x1},
+{0xd0099,0x9},
+{0xd0099,0x1},
+{0xd0099,0x0},
 };
+
+#ifndef CONFIG_LPDDR_EYE
+static const struct ddr_phy_reg lp4_3733_phy_train1d2d_seq4[] = {
+{0xd0000,0x1},
+{0xd0000,0x0},
+{0x90000,0x10},
+{0x90001,0x400},
+{0x90002,0x10e},
+{0x90003,0x0},
+{0x90004,0x0},
+{0x90005,0x8},
+{0x90029,0xb},
+{0x9002a,0x480},
+{0x9002b,0x109},
+{0x9002c,0x8},
+{0x9002d,0x448},
+{0x9002e,0x139},
+{0x9002f,0x8},
+{0x90030,0x478},
+{0x90031,0x109},
+{0x90032,0x0},
+{0x90033,0xe8},
+{0x90034,0x109},
+{0x90035,0x2},
+{0x90036,0x10},
+{0x90037,0x139},
+{0x90038,0xb},
+{0x90039,0x7c0},
+{0x9003a,0x139},
+{0x9003b,0x44},
+{0x9003c,0x633},
+{0x9003d,0x159},
+{0x9003e,0x14f},
+{0x9003f,0x630},
+{0x90040,0x159},
+{0x90041,0x47},
+{0x90042,0x633},
+{0x90043,0x149},
+{0x90044,0x4f},
+{0x90045,0x633},
+{0x90046,0x179},
+{0x90047,0x8},
+{0x90048,0xe0},
+{0x90049,0x109},
+{0x9004a,0x0},
+{0x9004b,0x7c8},
+{0x9004c,0x109},
+{0x9004d,0x0},
+{0x9004e,0x1},
+{0x9004f,0x8},
+{0x90050,0x0},
+{0x90051,0x45a},
+{0x90052,0x9},
+{0x90053,0x0},
+{0x90054,0x448},
+{0x90055,0x109},
+{0x90056,0x40},
+{0x90057,0x633},
+{0x90058,0x179},
+{0x90059,0x1},
+{0x9005a,0x618},
+{0x9005b,0x109},
+{0x9005c,0x40c0},
+{0x9005d,0x633},
+{0x9005e,0x149},
+{0x9005f,0x8},
+{0x90060,0x4},
+{0x90061,0x48},
+{0x90062,0x4040},
+{0x90063,0x633},
+{0x90064,0x149},
+{0x90065,0x0},
+{0x90066,0x4},
+{0x90067,0x48},
+{0x90068,0x40},
+{0x90069,0x633},
+{0x9006a,0x149},
+{0x9006b,0x10},
+{0x9006c,0x4},
+{0x9006d,0x18},
+{0x9006e,0x0},
+{0x9006f,0x4},
+{0x90070,0x78},
+{0x90071,0x549},
+{0x90072,0x633},
+{0x90073,0x159},
+{0x90074,0xd49},
+{0x90075,0x633},
+{0x90076,0x159},
+{0x90077,0x94a},
+{0x90078,0x633},
+{0x90079,0x159},
+{0x9007a,0x441},
+{0x9007b,0x633},
+{0x9007c,0x149},
+{0x9007d,0x42},
+{0x9007e,0x633},
+{0x9007f,0x149},
+{0x90080,0x1},
+{0x90081,0x633},
+{0x90082,0x149},
+{0x90083,0x0},
+{0x90084,0xe0},
+{0x90085,0x109},
+{0x90086,0xa},
+{0x90087,0x10},
+{0x90088,0x109},
+{0x90089,0x9},
+{0x9008a,0x3c0},
+{0x9008b,0x149},
+{0x9008c,0x9},
+{0x9008d,0x3c0},
+{0x9008e,0x159},
+{0x9008f,0x18},
+{0x90090,0x10},
+{0x90091,0x109},
+{0x90092,0x0},
+{0x90093,0x3c0},
+{0x90094,0x109},
+{0x90095,0x18},
+{0x90096,0x4},
+{0x90097,0x48},
+{0x90098,0x18},
+{0x90099,0x4},
+{0x9009a,0x58},
+{0x9009b,0xb},
+{0x9009c,0x10},
+{0x9009d,0x109},
+{0x9009e,0x1},
+{0x9009f,0x10},
+{0x900a0,0x109},
+{0x900a1,0x5},
+{0x900a2,0x7c0},
+{0x900a3,0x109},
+{0x40000,0x811},
+{0x40020,0x880},
+{0x40040,0x0},
+{0x40060,0x0},
+{0x40001,0x4008},
+{0x40021,0x83},
+{0x40041,0x4f},
+{0x40061,0x0},
+{0x40002,0x4040},
+{0x40022,0x83},
+{0x40042,0x51},
+{0x40062,0x0},
+{0x40003,0x811},
+{0x40023,0x880},
+{0x40043,0x0},
+{0x40063,0x0},
+{0x40004,0x720},
+{0x40024,0xf},
+{0x40044,0x1740},
+{0x40064,0x0},
+{0x40005,0x16},
+{0x40025,0x83},
+{0x40045,0x4b},
+{0x40065,0x0},
+{0x40006,0x716},
+{0x40026,0xf},
+{0x40046,0x2001},
+{0x40066,0x0},
+{0x40007,0x716},
+{0x40027,0xf},
+{0x40047,0x2800},
+{0x40067,0x0},
+{0x40008,0x716},
+{0x40028,0xf},
+{0x40048,0xf00},
+{0x40068,0x0},
+{0x40009,0x720},
+{0x40029,0xf},
+{0x40049,0x1400},
+{0x40069,0x0},
+{0x4000a,0xe08},
+{0x4002a,0xc15},
+{0x4004a,0x0},
+{0x4006a,0x0},
+{0x4000b,0x625},
+{0x4002b,0x15},
+{0x4004b,0x0},
+{0x4006b,0x0},
+{0x4000c,0x4028},
+{0x4002c,0x80},
+{0x4004c,0x0},
+{0x4006c,0x0},
+{0x4000d,0xe08},
+{0x4002d,0xc1a},
+{0x4004d,0x0},
+{0x4006d,0x0},
+{0x4000e,0x625},
+{0x4002e,0x1a},
+{0x4004e,0x0},
+{0x4006e,0x0},
+{0x4000f,0x4040},
+{0x4002f,0x80},
+{0x4004f,0x0},
+{0x4006f,0x0},
+{0x40010,0x2604},
+{0x40030,0x15},
+{0x40050,0x0},
+{0x40070,0x0},
+{0x40011,0x708},
+{0x40031,0x5},
+{0x40051,0x0},
+{0x40071,0x2002},
+{0x40012,0x8},
+{0x40032,0x80},
+{0x40052,0x0},
+{0x40072,0x0},
+{0x40013,0x2604},
+{0x40033,0x1a},
+{0x40053,0x0},
+{0x40073,0x0},
+{0x40014,0x708},
+{0x40034,0xa},
+{0x40054,0x0},
+{0x40074,0x2002},
+{0x40015,0x4040},
+{0x40035,0x80},
+{0x40055,0x0},
+{0x40075,0x0},
+{0x40016,0x60a},
+{0x40036,0x15},
+{0x40056,0x1200},
+{0x40076,0x0},
+{0x40017,0x61a},
+{0x40037,0x15},
+{0x40057,0x1300},
+{0x40077,0x0},
+{0x40018,0x60a},
+{0x40038,0x1a},
+{0x40058,0x1200},
+{0x40078,0x0},
+{0x40019,0x642},
+{0x40039,0x1a},
+{0x40059,0x1300},
+{0x40079,0x0},
+{0x4001a,0x4808},
+{0x4003a,0x880},
+{0x4005a,0x0},
+{0x4007a,0x0},
+{0x900a4,0x0},
+{0x900a5,0x790},
+{0x900a6,0x11a},
+{0x900a7,0x8},
+{0x900a8,0x7aa},
+{0x900a9,0x2a},
+{0x900aa,0x10},
+{0x900ab,0x7b2},
+{0x900ac,0x2a},
+{0x900ad,0x0},
+{0x900ae,0x7c8},
+{0x900af,0x109},
+{0x900b0,0x10},
+{0x900b1,0x10},
+{0x900b2,0x109},
+{0x900b3,0x10},
+{0x900b4,0x2a8},
+{0x900b5,0x129},
+{0x900b6,0x8},
+{0x900b7,0x370},
+{0x900b8,0x129},
+{0x900b9,0xa},
+{0x900ba,0x3c8},
+{0x900bb,0x1a9},
+{0x900bc,0xc},
+{0x900bd,0x408},
+{0x900be,0x199},
+{0x900bf,0x14},
+{0x900c0,0x790},
+{0x900c1,0x11a},
+{0x900c2,0x8},
+{0x900c3,0x4},
+{0x900c4,0x18},
+{0x900c5,0xe},
+{0x900c6,0x408},
+{0x900c7,0x199},
+{0x900c8,0x8},
+{0x900c9,0x8568},
+{0x900ca,0x108},
+{0x900cb,0x18},
+{0x900cc,0x790},
+{0x900cd,0x16a},
+{0x900ce,0x8},
+{0x900cf,0x1d8},
+{0x900d0,0x169},
+{0x900d1,0x10},
+{0x900d2,0x8558},
+{0x900d3,0x168},
+{0x900d4,0x70},
+{0x900d5,0x788},
+{0x900d6,0x16a},
+{0x900d7,0x1ff8},
+{0x900d8,0x85a8},
+{0x900d9,0x1e8},
+{0x900da,0x50},
+{0x900db,0x798},
+{0x900dc,0x16a},
+{0x900dd,0x60},
+{0x900de,0x7a0},
+{0x900df,0x16a},
+{0x900e0,0x8},
+{0x900e1,0x8310},
+{0x900e2,0x168},
+{0x900e3,0x8},
+{0x900e4,0xa310},
+{0x900e5,0x168},
+{0x900e6,0xa},
+{0x900e7,0x408},
+{0x900e8,0x169},
+{0x900e9,0x6e},
+{0x900ea,0x0},
+{0x900eb,0x68},
+{0x900ec,0x0},
+{0x900ed,0x408},
+{0x900ee,0x169},
+{0x900ef,0x0},
+{0x900f0,0x8310},
+{0x900f1,0x168},
+{0x900f2,0x0},
+{0x900f3,0xa310},
+{0x900f4,0x168},
+{0x900f5,0x1ff8},
+{0x900f6,0x85a8},
+{0x900f7,0x1e8},
+{0x900f8,0x68},
+{0x900f9,0x798},
+{0x900fa,0x16a},
+{0x900fb,0x78},
+{0x900fc,0x7a0},
+{0x900fd,0x16a},
+{0x900fe,0x68},
+{0x900ff,0x790},
+{0x90100,0x16a},
+{0x90101,0x8},
+{0x90102,0x8b10},
+{0x90103,0x168},
+{0x90104,0x8},
+{0x90105,0xab10},
+{0x90106,0x168},
+{0x90107,0xa},
+{0x90108,0x408},
+{0x90109,0x169},
+{0x9010a,0x58},
+{0x9010b,0x0},
+{0x9010c,0x68},
+{0x9010d,0x0},
+{0x9010e,0x408},
+{0x9010f,0x169},
+{0x90110,0x0},
+{0x90111,0x8b10},
+{0x90112,0x168},
+{0x90113,0x1},
+{0x90114,0xab10},
+{0x90115,0x168},
+{0x90116,0x0},
+{0x90117,0x1d8},
+{0x90118,0x169},
+{0x90119,0x80},
+{0x9011a,0x790},
+{0x9011b,0x16a},
+{0x9011c,0x18},
+{0x9011d,0x7aa},
+{0x9011e,0x6a},
+{0x9011f,0xa},
+{0x90120,0x0},
+{0x90121,0x1e9},
+{0x90122,0x8},
+{0x90123,0x8080},
+{0x90124,0x108},
+{0x90125,0xf},
+{0x90126,0x408},
+{0x90127,0x169},
+{0x90128,0xc},
+{0x90129,0x0},
+{0x9012a,0x68},
+{0x9012b,0x9},
+{0x9012c,0x0},
+{0x9012d,0x1a9},
+{0x9012e,0x0},
+{0x9012f,0x408},
+{0x90130,0x169},
+{0x90131,0x0},
+{0x90132,0x8080},
+{0x90133,0x108},
+{0x90134,0x8},
+{0x90135,0x7aa},
+{0x90136,0x6a},
+{0x90137,0x0},
+{0x90138,0x8568},
+{0x90139,0x108},
+{0x9013a,0xb7},
+{0x9013b,0x790},
+{0x9013c,0x16a},
+{0x9013d,0x1f},
+{0x9013e,0x0},
+{0x9013f,0x68},
+{0x90140,0x8},
+{0x90141,0x8558},
+{0x90142,0x168},
+{0x90143,0xf},
+{0x90144,0x408},
+{0x90145,0x169},
+{0x90146,0xd},
+{0x90147,0x0},
+{0x90148,0x68},
+{0x90149,0x0},
+{0x9014a,0x408},
+{0x9014b,0x169},
+{0x9014c,0x0},
+{0x9014d,0x8558},
+{0x9014e,0x168},
+{0x9014f,0x8},
+{0x90150,0x3c8},
+{0x90151,0x1a9},
+{0x90152,0x3},
+{0x90153,0x370},
+{0x90154,0x129},
+{0x90155,0x20},
+{0x90156,0x2aa},
+{0x90157,0x9},
+{0x90158,0x8},
+{0x90159,0xe8},
+{0x9015a,0x109},
+{0x9015b,0x0},
+{0x9015c,0x8140},
+{0x9015d,0x10c},
+{0x9015e,0x10},
+{0x9015f,0x8138},
+{0x90160,0x104},
+{0x90161,0x8},
+{0x90162,0x448},
+{0x90163,0x109},
+{0x90164,0xf},
+{0x90165,0x7c0},
+{0x90166,0x109},
+{0x90167,0x0},
+{0x90168,0xe8},
+{0x90169,0x109},
+{0x9016a,0x47},
+{0x9016b,0x630},
+{0x9016c,0x109},
+{0x9016d,0x8},
+{0x9016e,0x618},
+{0x9016f,0x109},
+{0x90170,0x8},
+{0x90171,0xe0},
+{0x90172,0x109},
+{0x90173,0x0},
+{0x90174,0x7c8},
+{0x90175,0x109},
+{0x90176,0x8},
+{0x90177,0x8140},
+{0x90178,0x10c},
+{0x90179,0x0},
+{0x9017a,0x478},
+{0x9017b,0x109},
+{0x9017c,0x0},
+{0x9017d,0x1},
+{0x9017e,0x8},
+{0x9017f,0x8},
+{0x90180,0x4},
+{0x90181,0x0},
+{0x90006,0x8},
+{0x90007,0x7c8},
+{0x90008,0x109},
+{0x90009,0x0},
+{0x9000a,0x400},
+{0x9000b,0x106},
+{0xd00e7,0x400},
+{0x90017,0x0},
+{0x9001f,0x29},
+{0x90026,0x68},
+{0x400d0,0x0},
+{0x400d1,0x101},
+{0x400d2,0x105},
+{0x400d3,0x107},
+{0x400d4,0x10f},
+{0x400d5,0x202},
+{0x400d6,0x20a},
+{0x400d7,0x20b},
+{0x2003a,0x2},
+{0x200be,0x3},
+{0x2000b,0x74},
+{0x2000c,0xe9},
+{0x2000d,0x91b},
+{0x2000e,0x2c},
+{0x9000c,0x0},
+{0x9000d,0x173},
+{0x9000e,0x60},
+{0x9000f,0x6110},
+{0x90010,0x2152},
+{0x90011,0xdfbd},
+{0x90012,0x2060},
+{0x90013,0x6152},
+{0x20010,0x5a},
+{0x20011,0x3},
+{0x40080,0xe0},
+{0x40081,0x12},
+{0x40082,0xe0},
+{0x40083,0x12},
+{0x40084,0xe0},
+{0x40085,0x12},
+{0x400fd,0xf},
+{0x10011,0x1},
+{0x10012,0x1},
+{0x10013,0x180},
+{0x10018,0x1},
+{0x10002,0x6209},
+{0x100b2,0x1},
+{0x101b4,0x1},
+{0x102b4,0x1},
+{0x103b4,0x1},
+{0x104b4,0x1},
+{0x105b4,0x1},
+{0x106b4,0x1},
+{0x107b4,0x1},
+{0x108b4,0x1},
+{0x11011,0x1},
+{0x11012,0x1},
+{0x11013,0x180},
+{0x11018,0x1},
+{0x11002,0x6209},
+{0x110b2,0x1},
+{0x111b4,0x1},
+{0x112b4,0x1},
+{0x113b4,0x1},
+{0x114b4,0x1},
+{0x115b4,0x1},
+{0x116b4,0x1},
+{0x117b4,0x1},
+{0x118b4,0x1},
+{0x12011,0x1},
+{0x12012,0x1},
+{0x12013,0x180},
+{0x12018,0x1},
+{0x12002,0x6209},
+{0x120b2,0x1},
+{0x121b4,0x1},
+{0x122b4,0x1},
+{0x123b4,0x1},
+{0x124b4,0x1},
+{0x125b4,0x1},
+{0x126b4,0x1},
+{0x127b4,0x1},
+{0x128b4,0x1},
+{0x13011,0x1},
+{0x13012,0x1},
+{0x13013,0x180},
+{0x13018,0x1},
+{0x13002,0x6209},
+{0x130b2,0x1},
+{0x131b4,0x1},
+{0x132b4,0x1},
+{0x133b4,0x1},
+{0x134b4,0x1},
+{0x135b4,0x1},
+{0x136b4,0x1},
+{0x137b4,0x1},
+{0x138b4,0x1},
+{0x20089,0x1},
+{0x20088,0x19},
+{0xc0080,0x2},
+{0xd0000,0x1},
+};
+#endif
+
 void lp4_3733_phy_train1d2d() {
-int i;
 printf("entered lp4_3733_phy_train1d2d \n");
-ddr_phy_reg_wr(0x1005f,0x17f);
-ddr_phy_reg_wr(0x1015f,0x17f);
-ddr_phy_reg_wr(0x1105f,0x17f);
-ddr_phy_reg_wr(0x1115f,0x17f);
-ddr_phy_reg_wr(0x1205f,0x17f);
-ddr_phy_reg_wr(0x1215f,0x17f);
-ddr_phy_reg_wr(0x1305f,0x17f);
-ddr_phy_reg_wr(0x1315f,0x17f);
-ddr_phy_reg_wr(0x55,0x15f);
-ddr_phy_reg_wr(0x1055,0x15f);
-ddr_phy_reg_wr(0x2055,0x15f);
-ddr_phy_reg_wr(0x3055,0x15f);
-ddr_phy_reg_wr(0x4055,0x15f);
-ddr_phy_reg_wr(0x5055,0x15f);
-ddr_phy_reg_wr(0x200c5,0x19);
-ddr_phy_reg_wr(0x2002e,0x2);
-ddr_phy_reg_wr(0x90204,0x0);
-ddr_phy_reg_wr(0x20024,0x1e3);
-ddr_phy_reg_wr(0x2003a,0x2);
-ddr_phy_reg_wr(0x2007d,0x212);
-ddr_phy_reg_wr(0x2007c,0x61);
-ddr_phy_reg_wr(0x20056,0x3);
-ddr_phy_reg_wr(0x1004d,0xe00);
-ddr_phy_reg_wr(0x1014d,0xe00);
-ddr_phy_reg_wr(0x1104d,0xe00);
-ddr_phy_reg_wr(0x1114d,0xe00);
-ddr_phy_reg_wr(0x1204d,0xe00);
-ddr_phy_reg_wr(0x1214d,0xe00);
-ddr_phy_reg_wr(0x1304d,0xe00);
-ddr_phy_reg_wr(0x1314d,0xe00);
-ddr_phy_reg_wr(0x10049,0xe3f);
-ddr_phy_reg_wr(0x10149,0xe3f);
-ddr_phy_reg_wr(0x11049,0xe3f);
-ddr_phy_reg_wr(0x11149,0xe3f);
-ddr_phy_reg_wr(0x12049,0xe3f);
-ddr_phy_reg_wr(0x12149,0xe3f);
-ddr_phy_reg_wr(0x13049,0xe3f);
-ddr_phy_reg_wr(0x13149,0xe3f);
-ddr_phy_reg_wr(0x43,0x7f);
-ddr_phy_reg_wr(0x1043,0x7f);
-ddr_phy_reg_wr(0x2043,0x7f);
-ddr_phy_reg_wr(0x3043,0x7f);
-ddr_phy_reg_wr(0x4043,0x7f);
-ddr_phy_reg_wr(0x5043,0x7f);
-ddr_phy_reg_wr(0x20018,0x3);
-ddr_phy_reg_wr(0x20075,0x4);
-ddr_phy_reg_wr(0x20050,0x11);
-ddr_phy_reg_wr(0x2009b,0x2);
-ddr_phy_reg_wr(0x20008,0x3a5);
-ddr_phy_reg_wr(0x20088,0x9);
-ddr_phy_reg_wr(0x200b2,0x124);
-ddr_phy_reg_wr(0x10043,0x5a1);
-ddr_phy_reg_wr(0x10143,0x5a1);
-ddr_phy_reg_wr(0x11043,0x5a1);
-ddr_phy_reg_wr(0x11143,0x5a1);
-ddr_phy_reg_wr(0x12043,0x5a1);
-ddr_phy_reg_wr(0x12143,0x5a1);
-ddr_phy_reg_wr(0x13043,0x5a1);
-ddr_phy_reg_wr(0x13143,0x5a1);
-ddr_phy_reg_wr(0x200fa,0x1);
-ddr_phy_reg_wr(0x20019,0x1);
-ddr_phy_reg_wr(0x200f0,0x0);
-ddr_phy_reg_wr(0x200f1,0x0);
-ddr_phy_reg_wr(0x200f2,0x4444);
-ddr_phy_reg_wr(0x200f3,0x8888);
-ddr_phy_reg_wr(0x200f4,0x5555);
-ddr_phy_reg_wr(0x200f5,0x0);
-ddr_phy_reg_wr(0x200f6,0x0);
-ddr_phy_reg_wr(0x200f7,0xf000);
-ddr_phy_reg_wr(0x1004a,0x500);
-ddr_phy_reg_wr(0x1104a,0x500);
-ddr_phy_reg_wr(0x1204a,0x500);
-ddr_phy_reg_wr(0x1304a,0x500);
-ddr_phy_reg_wr(0x20025,0x0);
-ddr_phy_reg_wr(0x2002d,0x0);
-ddr_phy_reg_wr(0x2002c,0x0);
-ddr_phy_reg_wr(0x20060,0x2);
+ddr_phy_reg_seq_wr(lp4_3733_phy_train1d2d_seq0,ARRAY_SIZE(lp4_3733_phy_train1d2d_seq0));
+#ifdef CONFIG_DDR_TRAIN_CACHE
+if (ddr_train_cache_valid()) {
+ddr_train_cache_restore(&lp4_pmu_train_2d_imem,&dccm_2d);
+} else {
+#endif
 ddr_phy_reg_wr(0xd0000,0x0);
-for(i=0;i<16384;i++) ddr_phy_reg_wr(0x50000+i,iccm_array[i]); 
+ddr_phy_fw_load(0x50000,&lp4_pmu_train_1d_imem);
 ddr_phy_reg_wr(0xd0000,0x1);
 ddr_phy_reg_wr(0xd0000,0x0);
-for(i=0;i<830;i++) ddr_phy_reg_wr(0x54000+i,dccm_array[i]); 
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0099,0x9);
-ddr_phy_reg_wr(0xd0099,0x1);
-ddr_phy_reg_wr(0xd0099,0x0);
+ddr_phy_fw_load(0x54000,&dccm_1d);
+ddr_phy_reg_seq_wr(lp4_3733_phy_train1d2d_seq1,ARRAY_SIZE(lp4_3733_phy_train1d2d_seq1));
 #ifndef CONFIG_DDR_H32_MODE
 ddr_phy_broadcast_en(0);
 #endif         
@@ -34419,19 +790,12 @@ dwc_ddrphy_phyinit_userCustom_G_waitFwDone(0);
 dwc_ddrphy1_phyinit_userCustom_G_waitFwDone(0);
 ddr_phy_broadcast_en(1);
 #endif         
-ddr_phy_reg_wr(0xd0099,0x1);
-ddr_phy_reg_wr(0xd0000,0x0);
+ddr_phy_reg_seq_wr(lp4_3733_phy_train1d2d_seq2,ARRAY_SIZE(lp4_3733_phy_train1d2d_seq2));
+ddr_phy_fw_load(0x50000,&lp4_pmu_train_2d_imem);
 ddr_phy_reg_wr(0xd0000,0x1);
 ddr_phy_reg_wr(0xd0000,0x0);
-for(i=0;i<16384;i++) ddr_phy_reg_wr(0x50000+i,iccm_array1[i]); 
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0000,0x0);
-for(i=0;i<702;i++) ddr_phy_reg_wr(0x54000+i,dccm_array1[i]); 
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0099,0x9);
-ddr_phy_reg_wr(0xd0099,0x1);
-ddr_phy_reg_wr(0xd0099,0x0);
+ddr_phy_fw_load(0x54000,&dccm_2d);
+ddr_phy_reg_seq_wr(lp4_3733_phy_train1d2d_seq3,ARRAY_SIZE(lp4_3733_phy_train1d2d_seq3));
 #ifndef CONFIG_DDR_H32_MODE
 ddr_phy_broadcast_en(0);
 #endif         
@@ -34442,568 +806,11 @@ ddr_phy_broadcast_en(1);
 #endif         
 ddr_phy_reg_wr(0xd0099,0x1);
 ddr_phy_reg_wr(0xd0000,0x0);
+#ifdef CONFIG_DDR_TRAIN_CACHE
+ddr_train_cache_capture();
+}
+#endif
 #ifndef CONFIG_LPDDR_EYE
-ddr_phy_reg_wr(0xd0000,0x1);
-ddr_phy_reg_wr(0xd0000,0x0);
-ddr_phy_reg_wr(0x90000,0x10);
-ddr_phy_reg_wr(0x90001,0x400);
-ddr_phy_reg_wr(0x90002,0x10e);
-ddr_phy_reg_wr(0x90003,0x0);
-ddr_phy_reg_wr(0x90004,0x0);
-ddr_phy_reg_wr(0x90005,0x8);
-ddr_phy_reg_wr(0x90029,0xb);
-ddr_phy_reg_wr(0x9002a,0x480);
-ddr_phy_reg_wr(0x9002b,0x109);
-ddr_phy_reg_wr(0x9002c,0x8);
-ddr_phy_reg_wr(0x9002d,0x448);
-ddr_phy_reg_wr(0x9002e,0x139);
-ddr_phy_reg_wr(0x9002f,0x8);
-ddr_phy_reg_wr(0x90030,0x478);
-ddr_phy_reg_wr(0x90031,0x109);
-ddr_phy_reg_wr(0x90032,0x0);
-ddr_phy_reg_wr(0x90033,0xe8);
-ddr_phy_reg_wr(0x90034,0x109);
-ddr_phy_reg_wr(0x90035,0x2);
-ddr_phy_reg_wr(0x90036,0x10);
-ddr_phy_reg_wr(0x90037,0x139);
-ddr_phy_reg_wr(0x90038,0xb);
-ddr_phy_reg_wr(0x90039,0x7c0);
-ddr_phy_reg_wr(0x9003a,0x139);
-ddr_phy_reg_wr(0x9003b,0x44);
-ddr_phy_reg_wr(0x9003c,0x633);
-ddr_phy_reg_wr(0x9003d,0x159);
-ddr_phy_reg_wr(0x9003e,0x14f);
-ddr_phy_reg_wr(0x9003f,0x630);
-ddr_phy_reg_wr(0x90040,0x159);
-ddr_phy_reg_wr(0x90041,0x47);
-ddr_phy_reg_wr(0x90042,0x633);
-ddr_phy_reg_wr(0x90043,0x149);
-ddr_phy_reg_wr(0x90044,0x4f);
-ddr_phy_reg_wr(0x90045,0x633);
-ddr_phy_reg_wr(0x90046,0x179);
-ddr_phy_reg_wr(0x90047,0x8);
-ddr_phy_reg_wr(0x90048,0xe0);
-ddr_phy_reg_wr(0x90049,0x109);
-ddr_phy_reg_wr(0x9004a,0x0);
-ddr_phy_reg_wr(0x9004b,0x7c8);
-ddr_phy_reg_wr(0x9004c,0x109);
-ddr_phy_reg_wr(0x9004d,0x0);
-ddr_phy_reg_wr(0x9004e,0x1);
-ddr_phy_reg_wr(0x9004f,0x8);
-ddr_phy_reg_wr(0x90050,0x0);
-ddr_phy_reg_wr(0x90051,0x45a);
-ddr_phy_reg_wr(0x90052,0x9);
-ddr_phy_reg_wr(0x90053,0x0);
-ddr_phy_reg_wr(0x90054,0x448);
-ddr_phy_reg_wr(0x90055,0x109);
-ddr_phy_reg_wr(0x90056,0x40);
-ddr_phy_reg_wr(0x90057,0x633);
-ddr_phy_reg_wr(0x90058,0x179);
-ddr_phy_reg_wr(0x90059,0x1);
-ddr_phy_reg_wr(0x9005a,0x618);
-ddr_phy_reg_wr(0x9005b,0x109);
-ddr_phy_reg_wr(0x9005c,0x40c0);
-ddr_phy_reg_wr(0x9005d,0x633);
-ddr_phy_reg_wr(0x9005e,0x149);
-ddr_phy_reg_wr(0x9005f,0x8);
-ddr_phy_reg_wr(0x90060,0x4);
-ddr_phy_reg_wr(0x90061,0x48);
-ddr_phy_reg_wr(0x90062,0x4040);
-ddr_phy_reg_wr(0x90063,0x633);
-ddr_phy_reg_wr(0x90064,0x149);
-ddr_phy_reg_wr(0x90065,0x0);
-ddr_phy_reg_wr(0x90066,0x4);
-ddr_phy_reg_wr(0x90067,0x48);
-ddr_phy_reg_wr(0x90068,0x40);
-ddr_phy_reg_wr(0x90069,0x633);
-ddr_phy_reg_wr(0x9006a,0x149);
-ddr_phy_reg_wr(0x9006b,0x10);
-ddr_phy_reg_wr(0x9006c,0x4);
-ddr_phy_reg_wr(0x9006d,0x18);
-ddr_phy_reg_wr(0x9006e,0x0);
-ddr_phy_reg_wr(0x9006f,0x4);
-ddr_phy_reg_wr(0x90070,0x78);
-ddr_phy_reg_wr(0x90071,0x549);
-ddr_phy_reg_wr(0x90072,0x633);
-ddr_phy_reg_wr(0x90073,0x159);
-ddr_phy_reg_wr(0x90074,0xd49);
-ddr_phy_reg_wr(0x90075,0x633);
-ddr_phy_reg_wr(0x90076,0x159);
-ddr_phy_reg_wr(0x90077,0x94a);
-ddr_phy_reg_wr(0x90078,0x633);
-ddr_phy_reg_wr(0x90079,0x159);
-ddr_phy_reg_wr(0x9007a,0x441);
-ddr_phy_reg_wr(0x9007b,0x633);
-ddr_phy_reg_wr(0x9007c,0x149);
-ddr_phy_reg_wr(0x9007d,0x42);
-ddr_phy_reg_wr(0x9007e,0x633);
-ddr_phy_reg_wr(0x9007f,0x149);
-ddr_phy_reg_wr(0x90080,0x1);
-ddr_phy_reg_wr(0x90081,0x633);
-ddr_phy_reg_wr(0x90082,0x149);
-ddr_phy_reg_wr(0x90083,0x0);
-ddr_phy_reg_wr(0x90084,0xe0);
-ddr_phy_reg_wr(0x90085,0x109);
-ddr_phy_reg_wr(0x90086,0xa);
-ddr_phy_reg_wr(0x90087,0x10);
-ddr_phy_reg_wr(0x90088,0x109);
-ddr_phy_reg_wr(0x90089,0x9);
-ddr_phy_reg_wr(0x9008a,0x3c0);
-ddr_phy_reg_wr(0x9008b,0x149);
-ddr_phy_reg_wr(0x9008c,0x9);
-ddr_phy_reg_wr(0x9008d,0x3c0);
-ddr_phy_reg_wr(0x9008e,0x159);
-ddr_phy_reg_wr(0x9008f,0x18);
-ddr_phy_reg_wr(0x90090,0x10);
-ddr_phy_reg_wr(0x90091,0x109);
-ddr_phy_reg_wr(0x90092,0x0);
-ddr_phy_reg_wr(0x90093,0x3c0);
-ddr_phy_reg_wr(0x90094,0x109);
-ddr_phy_reg_wr(0x90095,0x18);
-ddr_phy_reg_wr(0x90096,0x4);
-ddr_phy_reg_wr(0x90097,0x48);
-ddr_phy_reg_wr(0x90098,0x18);
-ddr_phy_reg_wr(0x90099,0x4);
-ddr_phy_reg_wr(0x9009a,0x58);
-ddr_phy_reg_wr(0x9009b,0xb);
-ddr_phy_reg_wr(0x9009c,0x10);
-ddr_phy_reg_wr(0x9009d,0x109);
-ddr_phy_reg_wr(0x9009e,0x1);
-ddr_phy_reg_wr(0x9009f,0x10);
-ddr_phy_reg_wr(0x900a0,0x109);
-ddr_phy_reg_wr(0x900a1,0x5);
-ddr_phy_reg_wr(0x900a2,0x7c0);
-ddr_phy_reg_wr(0x900a3,0x109);
-ddr_phy_reg_wr(0x40000,0x811);
-ddr_phy_reg_wr(0x40020,0x880);
-ddr_phy_reg_wr(0x40040,0x0);
-ddr_phy_reg_wr(0x40060,0x0);
-ddr_phy_reg_wr(0x40001,0x4008);
-ddr_phy_reg_wr(0x40021,0x83);
-ddr_phy_reg_wr(0x40041,0x4f);
-ddr_phy_reg_wr(0x40061,0x0);
-ddr_phy_reg_wr(0x40002,0x4040);
-ddr_phy_reg_wr(0x40022,0x83);
-ddr_phy_reg_wr(0x40042,0x51);
-ddr_phy_reg_wr(0x40062,0x0);
-ddr_phy_reg_wr(0x40003,0x811);
-ddr_phy_reg_wr(0x40023,0x880);
-ddr_phy_reg_wr(0x40043,0x0);
-ddr_phy_reg_wr(0x40063,0x0);
-ddr_phy_reg_wr(0x40004,0x720);
-ddr_phy_reg_wr(0x40024,0xf);
-ddr_phy_reg_wr(0x40044,0x1740);
-ddr_phy_reg_wr(0x40064,0x0);
-ddr_phy_reg_wr(0x40005,0x16);
-ddr_phy_reg_wr(0x40025,0x83);
-ddr_phy_reg_wr(0x40045,0x4b);
-ddr_phy_reg_wr(0x40065,0x0);
-ddr_phy_reg_wr(0x40006,0x716);
-ddr_phy_reg_wr(0x40026,0xf);
-ddr_phy_reg_wr(0x40046,0x2001);
-ddr_phy_reg_wr(0x40066,0x0);
-ddr_phy_reg_wr(0x40007,0x716);
-ddr_phy_reg_wr(0x40027,0xf);
-ddr_phy_reg_wr(0x40047,0x2800);
-ddr_phy_reg_wr(0x40067,0x0);
-ddr_phy_reg_wr(0x40008,0x716);
-ddr_phy_reg_wr(0x40028,0xf);
-ddr_phy_reg_wr(0x40048,0xf00);
-ddr_phy_reg_wr(0x40068,0x0);
-ddr_phy_reg_wr(0x40009,0x720);
-ddr_phy_reg_wr(0x40029,0xf);
-ddr_phy_reg_wr(0x40049,0x1400);
-ddr_phy_reg_wr(0x40069,0x0);
-ddr_phy_reg_wr(0x4000a,0xe08);
-ddr_phy_reg_wr(0x4002a,0xc15);
-ddr_phy_reg_wr(0x4004a,0x0);
-ddr_phy_reg_wr(0x4006a,0x0);
-ddr_phy_reg_wr(0x4000b,0x625);
-ddr_phy_reg_wr(0x4002b,0x15);
-ddr_phy_reg_wr(0x4004b,0x0);
-ddr_phy_reg_wr(0x4006b,0x0);
-ddr_phy_reg_wr(0x4000c,0x4028);
-ddr_phy_reg_wr(0x4002c,0x80);
-ddr_phy_reg_wr(0x4004c,0x0);
-ddr_phy_reg_wr(0x4006c,0x0);
-ddr_phy_reg_wr(0x4000d,0xe08);
-ddr_phy_reg_wr(0x4002d,0xc1a);
-ddr_phy_reg_wr(0x4004d,0x0);
-ddr_phy_reg_wr(0x4006d,0x0);
-ddr_phy_reg_wr(0x4000e,0x625);
-ddr_phy_reg_wr(0x4002e,0x1a);
-ddr_phy_reg_wr(0x4004e,0x0);
-ddr_phy_reg_wr(0x4006e,0x0);
-ddr_phy_reg_wr(0x4000f,0x4040);
-ddr_phy_reg_wr(0x4002f,0x80);
-ddr_phy_reg_wr(0x4004f,0x0);
-ddr_phy_reg_wr(0x4006f,0x0);
-ddr_phy_reg_wr(0x40010,0x2604);
-ddr_phy_reg_wr(0x40030,0x15);
-ddr_phy_reg_wr(0x40050,0x0);
-ddr_phy_reg_wr(0x40070,0x0);
-ddr_phy_reg_wr(0x40011,0x708);
-ddr_phy_reg_wr(0x40031,0x5);
-ddr_phy_reg_wr(0x40051,0x0);
-ddr_phy_reg_wr(0x40071,0x2002);
-ddr_phy_reg_wr(0x40012,0x8);
-ddr_phy_reg_wr(0x40032,0x80);
-ddr_phy_reg_wr(0x40052,0x0);
-ddr_phy_reg_wr(0x40072,0x0);
-ddr_phy_reg_wr(0x40013,0x2604);
-ddr_phy_reg_wr(0x40033,0x1a);
-ddr_phy_reg_wr(0x40053,0x0);
-ddr_phy_reg_wr(0x40073,0x0);
-ddr_phy_reg_wr(0x40014,0x708);
-ddr_phy_reg_wr(0x40034,0xa);
-ddr_phy_reg_wr(0x40054,0x0);
-ddr_phy_reg_wr(0x40074,0x2002);
-ddr_phy_reg_wr(0x40015,0x4040);
-ddr_phy_reg_wr(0x40035,0x80);
-ddr_phy_reg_wr(0x40055,0x0);
-ddr_phy_reg_wr(0x40075,0x0);
-ddr_phy_reg_wr(0x40016,0x60a);
-ddr_phy_reg_wr(0x40036,0x15);
-ddr_phy_reg_wr(0x40056,0x1200);
-ddr_phy_reg_wr(0x40076,0x0);
-ddr_phy_reg_wr(0x40017,0x61a);
-ddr_phy_reg_wr(0x40037,0x15);
-ddr_phy_reg_wr(0x40057,0x1300);
-ddr_phy_reg_wr(0x40077,0x0);
-ddr_phy_reg_wr(0x40018,0x60a);
-ddr_phy_reg_wr(0x40038,0x1a);
-ddr_phy_reg_wr(0x40058,0x1200);
-ddr_phy_reg_wr(0x40078,0x0);
-ddr_phy_reg_wr(0x40019,0x642);
-ddr_phy_reg_wr(0x40039,0x1a);
-ddr_phy_reg_wr(0x40059,0x1300);
-ddr_phy_reg_wr(0x40079,0x0);
-ddr_phy_reg_wr(0x4001a,0x4808);
-ddr_phy_reg_wr(0x4003a,0x880);
-ddr_phy_reg_wr(0x4005a,0x0);
-ddr_phy_reg_wr(0x4007a,0x0);
-ddr_phy_reg_wr(0x900a4,0x0);
-ddr_phy_reg_wr(0x900a5,0x790);
-ddr_phy_reg_wr(0x900a6,0x11a);
-ddr_phy_reg_wr(0x900a7,0x8);
-ddr_phy_reg_wr(0x900a8,0x7aa);
-ddr_phy_reg_wr(0x900a9,0x2a);
-ddr_phy_reg_wr(0x900aa,0x10);
-ddr_phy_reg_wr(0x900ab,0x7b2);
-ddr_phy_reg_wr(0x900ac,0x2a);
-ddr_phy_reg_wr(0x900ad,0x0);
-ddr_phy_reg_wr(0x900ae,0x7c8);
-ddr_phy_reg_wr(0x900af,0x109);
-ddr_phy_reg_wr(0x900b0,0x10);
-ddr_phy_reg_wr(0x900b1,0x10);
-ddr_phy_reg_wr(0x900b2,0x109);
-ddr_phy_reg_wr(0x900b3,0x10);
-ddr_phy_reg_wr(0x900b4,0x2a8);
-ddr_phy_reg_wr(0x900b5,0x129);
-ddr_phy_reg_wr(0x900b6,0x8);
-ddr_phy_reg_wr(0x900b7,0x370);
-ddr_phy_reg_wr(0x900b8,0x129);
-ddr_phy_reg_wr(0x900b9,0xa);
-ddr_phy_reg_wr(0x900ba,0x3c8);
-ddr_phy_reg_wr(0x900bb,0x1a9);
-ddr_phy_reg_wr(0x900bc,0xc);
-ddr_phy_reg_wr(0x900bd,0x408);
-ddr_phy_reg_wr(0x900be,0x199);
-ddr_phy_reg_wr(0x900bf,0x14);
-ddr_phy_reg_wr(0x900c0,0x790);
-ddr_phy_reg_wr(0x900c1,0x11a);
-ddr_phy_reg_wr(0x900c2,0x8);
-ddr_phy_reg_wr(0x900c3,0x4);
-ddr_phy_reg_wr(0x900c4,0x18);
-ddr_phy_reg_wr(0x900c5,0xe);
-ddr_phy_reg_wr(0x900c6,0x408);
-ddr_phy_reg_wr(0x900c7,0x199);
-ddr_phy_reg_wr(0x900c8,0x8);
-ddr_phy_reg_wr(0x900c9,0x8568);
-ddr_phy_reg_wr(0x900ca,0x108);
-ddr_phy_reg_wr(0x900cb,0x18);
-ddr_phy_reg_wr(0x900cc,0x790);
-ddr_phy_reg_wr(0x900cd,0x16a);
-ddr_phy_reg_wr(0x900ce,0x8);
-ddr_phy_reg_wr(0x900cf,0x1d8);
-ddr_phy_reg_wr(0x900d0,0x169);
-ddr_phy_reg_wr(0x900d1,0x10);
-ddr_phy_reg_wr(0x900d2,0x8558);
-ddr_phy_reg_wr(0x900d3,0x168);
-ddr_phy_reg_wr(0x900d4,0x70);
-ddr_phy_reg_wr(0x900d5,0x788);
-ddr_phy_reg_wr(0x900d6,0x16a);
-ddr_phy_reg_wr(0x900d7,0x1ff8);
-ddr_phy_reg_wr(0x900d8,0x85a8);
-ddr_phy_reg_wr(0x900d9,0x1e8);
-ddr_phy_reg_wr(0x900da,0x50);
-ddr_phy_reg_wr(0x900db,0x798);
-ddr_phy_reg_wr(0x900dc,0x16a);
-ddr_phy_reg_wr(0x900dd,0x60);
-ddr_phy_reg_wr(0x900de,0x7a0);
-ddr_phy_reg_wr(0x900df,0x16a);
-ddr_phy_reg_wr(0x900e0,0x8);
-ddr_phy_reg_wr(0x900e1,0x8310);
-ddr_phy_reg_wr(0x900e2,0x168);
-ddr_phy_reg_wr(0x900e3,0x8);
-ddr_phy_reg_wr(0x900e4,0xa310);
-ddr_phy_reg_wr(0x900e5,0x168);
-ddr_phy_reg_wr(0x900e6,0xa);
-ddr_phy_reg_wr(0x900e7,0x408);
-ddr_phy_reg_wr(0x900e8,0x169);
-ddr_phy_reg_wr(0x900e9,0x6e);
-ddr_phy_reg_wr(0x900ea,0x0);
-ddr_phy_reg_wr(0x900eb,0x68);
-ddr_phy_reg_wr(0x900ec,0x0);
-ddr_phy_reg_wr(0x900ed,0x408);
-ddr_phy_reg_wr(0x900ee,0x169);
-ddr_phy_reg_wr(0x900ef,0x0);
-ddr_phy_reg_wr(0x900f0,0x8310);
-ddr_phy_reg_wr(0x900f1,0x168);
-ddr_phy_reg_wr(0x900f2,0x0);
-ddr_phy_reg_wr(0x900f3,0xa310);
-ddr_phy_reg_wr(0x900f4,0x168);
-ddr_phy_reg_wr(0x900f5,0x1ff8);
-ddr_phy_reg_wr(0x900f6,0x85a8);
-ddr_phy_reg_wr(0x900f7,0x1e8);
-ddr_phy_reg_wr(0x900f8,0x68);
-ddr_phy_reg_wr(0x900f9,0x798);
-ddr_phy_reg_wr(0x900fa,0x16a);
-ddr_phy_reg_wr(0x900fb,0x78);
-ddr_phy_reg_wr(0x900fc,0x7a0);
-ddr_phy_reg_wr(0x900fd,0x16a);
-ddr_phy_reg_wr(0x900fe,0x68);
-ddr_phy_reg_wr(0x900ff,0x790);
-ddr_phy_reg_wr(0x90100,0x16a);
-ddr_phy_reg_wr(0x90101,0x8);
-ddr_phy_reg_wr(0x90102,0x8b10);
-ddr_phy_reg_wr(0x90103,0x168);
-ddr_phy_reg_wr(0x90104,0x8);
-ddr_phy_reg_wr(0x90105,0xab10);
-ddr_phy_reg_wr(0x90106,0x168);
-ddr_phy_reg_wr(0x90107,0xa);
-ddr_phy_reg_wr(0x90108,0x408);
-ddr_phy_reg_wr(0x90109,0x169);
-ddr_phy_reg_wr(0x9010a,0x58);
-ddr_phy_reg_wr(0x9010b,0x0);
-ddr_phy_reg_wr(0x9010c,0x68);
-ddr_phy_reg_wr(0x9010d,0x0);
-ddr_phy_reg_wr(0x9010e,0x408);
-ddr_phy_reg_wr(0x9010f,0x169);
-ddr_phy_reg_wr(0x90110,0x0);
-ddr_phy_reg_wr(0x90111,0x8b10);
-ddr_phy_reg_wr(0x90112,0x168);
-ddr_phy_reg_wr(0x90113,0x1);
-ddr_phy_reg_wr(0x90114,0xab10);
-ddr_phy_reg_wr(0x90115,0x168);
-ddr_phy_reg_wr(0x90116,0x0);
-ddr_phy_reg_wr(0x90117,0x1d8);
-ddr_phy_reg_wr(0x90118,0x169);
-ddr_phy_reg_wr(0x90119,0x80);
-ddr_phy_reg_wr(0x9011a,0x790);
-ddr_phy_reg_wr(0x9011b,0x16a);
-ddr_phy_reg_wr(0x9011c,0x18);
-ddr_phy_reg_wr(0x9011d,0x7aa);
-ddr_phy_reg_wr(0x9011e,0x6a);
-ddr_phy_reg_wr(0x9011f,0xa);
-ddr_phy_reg_wr(0x90120,0x0);
-ddr_phy_reg_wr(0x90121,0x1e9);
-ddr_phy_reg_wr(0x90122,0x8);
-ddr_phy_reg_wr(0x90123,0x8080);
-ddr_phy_reg_wr(0x90124,0x108);
-ddr_phy_reg_wr(0x90125,0xf);
-ddr_phy_reg_wr(0x90126,0x408);
-ddr_phy_reg_wr(0x90127,0x169);
-ddr_phy_reg_wr(0x90128,0xc);
-ddr_phy_reg_wr(0x90129,0x0);
-ddr_phy_reg_wr(0x9012a,0x68);
-ddr_phy_reg_wr(0x9012b,0x9);
-ddr_phy_reg_wr(0x9012c,0x0);
-ddr_phy_reg_wr(0x9012d,0x1a9);
-ddr_phy_reg_wr(0x9012e,0x0);
-ddr_phy_reg_wr(0x9012f,0x408);
-ddr_phy_reg_wr(0x90130,0x169);
-ddr_phy_reg_wr(0x90131,0x0);
-ddr_phy_reg_wr(0x90132,0x8080);
-ddr_phy_reg_wr(0x90133,0x108);
-ddr_phy_reg_wr(0x90134,0x8);
-ddr_phy_reg_wr(0x90135,0x7aa);
-ddr_phy_reg_wr(0x90136,0x6a);
-ddr_phy_reg_wr(0x90137,0x0);
-ddr_phy_reg_wr(0x90138,0x8568);
-ddr_phy_reg_wr(0x90139,0x108);
-ddr_phy_reg_wr(0x9013a,0xb7);
-ddr_phy_reg_wr(0x9013b,0x790);
-ddr_phy_reg_wr(0x9013c,0x16a);
-ddr_phy_reg_wr(0x9013d,0x1f);
-ddr_phy_reg_wr(0x9013e,0x0);
-ddr_phy_reg_wr(0x9013f,0x68);
-ddr_phy_reg_wr(0x90140,0x8);
-ddr_phy_reg_wr(0x90141,0x8558);
-ddr_phy_reg_wr(0x90142,0x168);
-ddr_phy_reg_wr(0x90143,0xf);
-ddr_phy_reg_wr(0x90144,0x408);
-ddr_phy_reg_wr(0x90145,0x169);
-ddr_phy_reg_wr(0x90146,0xd);
-ddr_phy_reg_wr(0x90147,0x0);
-ddr_phy_reg_wr(0x90148,0x68);
-ddr_phy_reg_wr(0x90149,0x0);
-ddr_phy_reg_wr(0x9014a,0x408);
-ddr_phy_reg_wr(0x9014b,0x169);
-ddr_phy_reg_wr(0x9014c,0x0);
-ddr_phy_reg_wr(0x9014d,0x8558);
-ddr_phy_reg_wr(0x9014e,0x168);
-ddr_phy_reg_wr(0x9014f,0x8);
-ddr_phy_reg_wr(0x90150,0x3c8);
-ddr_phy_reg_wr(0x90151,0x1a9);
-ddr_phy_reg_wr(0x90152,0x3);
-ddr_phy_reg_wr(0x90153,0x370);
-ddr_phy_reg_wr(0x90154,0x129);
-ddr_phy_reg_wr(0x90155,0x20);
-ddr_phy_reg_wr(0x90156,0x2aa);
-ddr_phy_reg_wr(0x90157,0x9);
-ddr_phy_reg_wr(0x90158,0x8);
-ddr_phy_reg_wr(0x90159,0xe8);
-ddr_phy_reg_wr(0x9015a,0x109);
-ddr_phy_reg_wr(0x9015b,0x0);
-ddr_phy_reg_wr(0x9015c,0x8140);
-ddr_phy_reg_wr(0x9015d,0x10c);
-ddr_phy_reg_wr(0x9015e,0x10);
-ddr_phy_reg_wr(0x9015f,0x8138);
-ddr_phy_reg_wr(0x90160,0x104);
-ddr_phy_reg_wr(0x90161,0x8);
-ddr_phy_reg_wr(0x90162,0x448);
-ddr_phy_reg_wr(0x90163,0x109);
-ddr_phy_reg_wr(0x90164,0xf);
-ddr_phy_reg_wr(0x90165,0x7c0);
-ddr_phy_reg_wr(0x90166,0x109);
-ddr_phy_reg_wr(0x90167,0x0);
-ddr_phy_reg_wr(0x90168,0xe8);
-ddr_phy_reg_wr(0x90169,0x109);
-ddr_phy_reg_wr(0x9016a,0x47);
-ddr_phy_reg_wr(0x9016b,0x630);
-ddr_phy_reg_wr(0x9016c,0x109);
-ddr_phy_reg_wr(0x9016d,0x8);
-ddr_phy_reg_wr(0x9016e,0x618);
-ddr_phy_reg_wr(0x9016f,0x109);
-ddr_phy_reg_wr(0x90170,0x8);
-ddr_phy_reg_wr(0x90171,0xe0);
-ddr_phy_reg_wr(0x90172,0x109);
-ddr_phy_reg_wr(0x90173,0x0);
-ddr_phy_reg_wr(0x90174,0x7c8);
-ddr_phy_reg_wr(0x90175,0x109);
-ddr_phy_reg_wr(0x90176,0x8);
-ddr_phy_reg_wr(0x90177,0x8140);
-ddr_phy_reg_wr(0x90178,0x10c);
-ddr_phy_reg_wr(0x90179,0x0);
-ddr_phy_reg_wr(0x9017a,0x478);
-ddr_phy_reg_wr(0x9017b,0x109);
-ddr_phy_reg_wr(0x9017c,0x0);
-ddr_phy_reg_wr(0x9017d,0x1);
-ddr_phy_reg_wr(0x9017e,0x8);
-ddr_phy_reg_wr(0x9017f,0x8);
-ddr_phy_reg_wr(0x90180,0x4);
-ddr_phy_reg_wr(0x90181,0x0);
-ddr_phy_reg_wr(0x90006,0x8);
-ddr_phy_reg_wr(0x90007,0x7c8);
-ddr_phy_reg_wr(0x90008,0x109);
-ddr_phy_reg_wr(0x90009,0x0);
-ddr_phy_reg_wr(0x9000a,0x400);
-ddr_phy_reg_wr(0x9000b,0x106);
-ddr_phy_reg_wr(0xd00e7,0x400);
-ddr_phy_reg_wr(0x90017,0x0);
-ddr_phy_reg_wr(0x9001f,0x29);
-ddr_phy_reg_wr(0x90026,0x68);
-ddr_phy_reg_wr(0x400d0,0x0);
-ddr_phy_reg_wr(0x400d1,0x101);
-ddr_phy_reg_wr(0x400d2,0x105);
-ddr_phy_reg_wr(0x400d3,0x107);
-ddr_phy_reg_wr(0x400d4,0x10f);
-ddr_phy_reg_wr(0x400d5,0x202);
-ddr_phy_reg_wr(0x400d6,0x20a);
-ddr_phy_reg_wr(0x400d7,0x20b);
-ddr_phy_reg_wr(0x2003a,0x2);
-ddr_phy_reg_wr(0x200be,0x3);
-ddr_phy_reg_wr(0x2000b,0x74);
-ddr_phy_reg_wr(0x2000c,0xe9);
-ddr_phy_reg_wr(0x2000d,0x91b);
-ddr_phy_reg_wr(0x2000e,0x2c);
-ddr_phy_reg_wr(0x9000c,0x0);
-ddr_phy_reg_wr(0x9000d,0x173);
-ddr_phy_reg_wr(0x9000e,0x60);
-ddr_phy_reg_wr(0x9000f,0x6110);
-ddr_phy_reg_wr(0x90010,0x2152);
-ddr_phy_reg_wr(0x90011,0xdfbd);
-ddr_phy_reg_wr(0x90012,0x2060);
-ddr_phy_reg_wr(0x90013,0x6152);
-ddr_phy_reg_wr(0x20010,0x5a);
-ddr_phy_reg_wr(0x20011,0x3);
-ddr_phy_reg_wr(0x40080,0xe0);
-ddr_phy_reg_wr(0x40081,0x12);
-ddr_phy_reg_wr(0x40082,0xe0);
-ddr_phy_reg_wr(0x40083,0x12);
-ddr_phy_reg_wr(0x40084,0xe0);
-ddr_phy_reg_wr(0x40085,0x12);
-ddr_phy_reg_wr(0x400fd,0xf);
-ddr_phy_reg_wr(0x10011,0x1);
-ddr_phy_reg_wr(0x10012,0x1);
-ddr_phy_reg_wr(0x10013,0x180);
-ddr_phy_reg_wr(0x10018,0x1);
-ddr_phy_reg_wr(0x10002,0x6209);
-ddr_phy_reg_wr(0x100b2,0x1);
-ddr_phy_reg_wr(0x101b4,0x1);
-ddr_phy_reg_wr(0x102b4,0x1);
-ddr_phy_reg_wr(0x103b4,0x1);
-ddr_phy_reg_wr(0x104b4,0x1);
-ddr_phy_reg_wr(0x105b4,0x1);
-ddr_phy_reg_wr(0x106b4,0x1);
-ddr_phy_reg_wr(0x107b4,0x1);
-ddr_phy_reg_wr(0x108b4,0x1);
-ddr_phy_reg_wr(0x11011,0x1);
-ddr_phy_reg_wr(0x11012,0x1);
-ddr_phy_reg_wr(0x11013,0x180);
-ddr_phy_reg_wr(0x11018,0x1);
-ddr_phy_reg_wr(0x11002,0x6209);
-ddr_phy_reg_wr(0x110b2,0x1);
-ddr_phy_reg_wr(0x111b4,0x1);
-ddr_phy_reg_wr(0x112b4,0x1);
-ddr_phy_reg_wr(0x113b4,0x1);
-ddr_phy_reg_wr(0x114b4,0x1);
-ddr_phy_reg_wr(0x115b4,0x1);
-ddr_phy_reg_wr(0x116b4,0x1);
-ddr_phy_reg_wr(0x117b4,0x1);
-ddr_phy_reg_wr(0x118b4,0x1);
-ddr_phy_reg_wr(0x12011,0x1);
-ddr_phy_reg_wr(0x12012,0x1);
-ddr_phy_reg_wr(0x12013,0x180);
-ddr_phy_reg_wr(0x12018,0x1);
-ddr_phy_reg_wr(0x12002,0x6209);
-ddr_phy_reg_wr(0x120b2,0x1);
-ddr_phy_reg_wr(0x121b4,0x1);
-ddr_phy_reg_wr(0x122b4,0x1);
-ddr_phy_reg_wr(0x123b4,0x1);
-ddr_phy_reg_wr(0x124b4,0x1);
-ddr_phy_reg_wr(0x125b4,0x1);
-ddr_phy_reg_wr(0x126b4,0x1);
-ddr_phy_reg_wr(0x127b4,0x1);
-ddr_phy_reg_wr(0x128b4,0x1);
-ddr_phy_reg_wr(0x13011,0x1);
-ddr_phy_reg_wr(0x13012,0x1);
-ddr_phy_reg_wr(0x13013,0x180);
-ddr_phy_reg_wr(0x13018,0x1);
-ddr_phy_reg_wr(0x13002,0x6209);
-ddr_phy_reg_wr(0x130b2,0x1);
-ddr_phy_reg_wr(0x131b4,0x1);
-ddr_phy_reg_wr(0x132b4,0x1);
-ddr_phy_reg_wr(0x133b4,0x1);
-ddr_phy_reg_wr(0x134b4,0x1);
-ddr_phy_reg_wr(0x135b4,0x1);
-ddr_phy_reg_wr(0x136b4,0x1);
-ddr_phy_reg_wr(0x137b4,0x1);
-ddr_phy_reg_wr(0x138b4,0x1);
-ddr_phy_reg_wr(0x20089,0x1);
-ddr_phy_reg_wr(0x20088,0x19);
-ddr_phy_reg_wr(0xc0080,0x2);
-ddr_phy_reg_wr(0xd0000,0x1);
+ddr_phy_reg_seq_wr(lp4_3733_phy_train1d2d_seq4,ARRAY_SIZE(lp4_3733_phy_train1d2d_seq4));
 #endif // #ifndef LPDDR_EYE
  }
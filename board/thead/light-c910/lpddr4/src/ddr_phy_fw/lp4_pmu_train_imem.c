@@ -0,0 +1,4355 @@
+/*
+ * LPDDR4 PMU training firmware instruction memory images,
+ * shared by all lp4*_phy_train1d2d configurations.
+ * Generated by ddr_phy_fw_pack.py, do not edit.
+ */
+
+#include "../../include/ddr_phy_fw.h"
+
+static const u8 lp4_pmu_train_1d_imem_lz4[] = {
+	0x72, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x63,
+	0x0e, 0x00, 0x00, 0x6f, 0x14, 0x01, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00,
+	0x37, 0x84, 0x69, 0x20, 0x40, 0x00, 0x4a, 0x26, 0x00, 0x70, 0x04, 0x00,
+	0x1f, 0x00, 0x01, 0x00, 0x0c, 0xf3, 0x17, 0x54, 0x70, 0xe0, 0x7c, 0x00,
+	0x43, 0x01, 0x11, 0x8c, 0x04, 0x42, 0x22, 0x42, 0x80, 0x01, 0x1b, 0x12,
+	0x03, 0xfb, 0xf5, 0xe0, 0x7e, 0xe0, 0x78, 0xe1, 0xc4, 0x0a, 0x24, 0x80,
+	0x1f, 0x00, 0x80, 0x00, 0x30, 0x19, 0x0c, 0x03, 0x17, 0x0c, 0x00, 0xf0,
+	0x10, 0x40, 0x0d, 0x0c, 0x02, 0x17, 0xc1, 0xc4, 0x20, 0x20, 0xc0, 0x07,
+	0xff, 0x7f, 0xe0, 0x78, 0xfc, 0x1c, 0xc8, 0xb3, 0xfc, 0x1c, 0x88, 0xb3,
+	0xe0, 0x7f, 0xfc, 0x1c, 0x48, 0xb3, 0xe0, 0x78, 0x38, 0x00, 0xd1, 0x8d,
+	0x74, 0x0c, 0xdd, 0x0c, 0xf0, 0xe0, 0x78, 0x8d, 0x74, 0x08, 0xdd, 0x09,
+	0x08, 0x00, 0x31, 0xad, 0x74, 0x06, 0x08, 0x00, 0xe0, 0x06, 0xf0, 0x02,
+	0xc7, 0x01, 0xc6, 0xb0, 0x24, 0x4d, 0x33, 0xb0, 0x24, 0x1f, 0x33, 0x2c,
+	0x00, 0x40, 0x44, 0x22, 0xfc, 0x8f, 0xa8, 0x00, 0xc0, 0xe8, 0x20, 0xa2,
+	0x01, 0x2f, 0x20, 0x00, 0x80, 0x2f, 0x21, 0x4b, 0x00, 0x18, 0x00, 0xf0,
+	0x25, 0x2c, 0x70, 0x4c, 0x70, 0x6c, 0x70, 0x4d, 0x70, 0x6d, 0x70, 0x8d,
+	0x70, 0xad, 0x70, 0xcd, 0x70, 0xed, 0x70, 0x6a, 0x20, 0x80, 0x02, 0x8d,
+	0xb8, 0x29, 0x20, 0x00, 0x80, 0xdb, 0x44, 0x00, 0x80, 0x00, 0x40, 0xdb,
+	0x42, 0x00, 0x80, 0x00, 0x04, 0x6f, 0x70, 0xe0, 0x78, 0x22, 0x20, 0x80,
+	0x0f, 0x00, 0x00, 0x94, 0x32, 0xf8, 0x00, 0xf0, 0xd5, 0xe0, 0x78, 0xfe,
+	0xf1, 0xe1, 0xc3, 0xe1, 0xc2, 0xe1, 0xc1, 0xe1, 0xc0, 0xf1, 0xc0, 0xe1,
+	0xc5, 0xa1, 0xc1, 0x06, 0xe8, 0x87, 0x74, 0x14, 0xdc, 0x7f, 0x07, 0xcf,
+	0xff, 0x25, 0xda, 0x9f, 0xba, 0x60, 0x8a, 0x33, 0x12, 0x80, 0x00, 0x65,
+	0x78, 0xea, 0x1a, 0x02, 0x80, 0xed, 0x12, 0x80, 0x80, 0x8c, 0x20, 0xc3,
+	0x8f, 0x0d, 0xf2, 0x85, 0xc0, 0x40, 0xc0, 0x20, 0x40, 0x72, 0x08, 0x60,
+	0x03, 0x85, 0xc1, 0xc3, 0x41, 0x02, 0x04, 0x00, 0x00, 0x2a, 0x0d, 0x60,
+	0x00, 0xff, 0xd8, 0xad, 0x70, 0x86, 0x0c, 0xe0, 0x02, 0x09, 0x1a, 0x03,
+	0x30, 0xb6, 0x0f, 0x20, 0x03, 0xff, 0xd8, 0xab, 0x25, 0xc4, 0x10, 0xff,
+	0x7f, 0xff, 0xf1, 0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa6,
+	0xc1, 0x41, 0xc1, 0x42, 0xc0, 0x01, 0xc0, 0xcd, 0x70, 0x43, 0xc2, 0xc0,
+	0xa0, 0x3f, 0xd8, 0x64, 0xc0, 0xc3, 0x40, 0x00, 0x80, 0xc9, 0x07, 0xa0,
+	0x88, 0x11, 0x1c, 0x82, 0x33, 0x54, 0xf0, 0x03, 0xc0, 0x9d, 0x08, 0xee,
+	0x06, 0x84, 0xc0, 0xc8, 0x60, 0x40, 0xc0, 0x00, 0xc1, 0x3f, 0xd8, 0x19,
+	0x0b, 0xb0, 0x30, 0x26, 0x78, 0x19, 0x0b, 0x70, 0x30, 0x00, 0x41, 0x1d,
+	0x0b, 0x31, 0x30, 0x00, 0x42, 0x00, 0xc1, 0x07, 0xf0, 0x00, 0xc3, 0x00,
+	0x41, 0x00, 0x42, 0x04, 0xf0, 0x00, 0xc2, 0x00, 0x43, 0x42, 0x0b, 0x80,
+	0x03, 0xc3, 0x40, 0x00, 0x00, 0x20, 0x4e, 0xca, 0x0e, 0xa0, 0x01, 0x2c,
+	0x70, 0xed, 0x70, 0x26, 0xf0, 0x5f, 0x25, 0x02, 0x14, 0x02, 0xc0, 0x16,
+	0x7a, 0xf8, 0x62, 0x38, 0x60, 0x24, 0x88, 0x1a, 0x21, 0xee, 0x00, 0xf4,
+	0x4b, 0x00, 0x20, 0x05, 0x20, 0x80, 0x0f, 0x02, 0x90, 0x54, 0x00, 0x00,
+	0x90, 0xc2, 0x0c, 0x60, 0x00, 0x0f, 0x78, 0x00, 0xc1, 0xc5, 0xb8, 0xe5,
+	0x71, 0x07, 0x79, 0x5a, 0x23, 0x00, 0x32, 0x20, 0x42, 0xc4, 0xb8, 0x06,
+	0xe8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x5b, 0x7a, 0x01, 0xc0, 0x20,
+	0x80, 0x45, 0x79, 0x20, 0xa0, 0x02, 0xc0, 0xc3, 0x41, 0x00, 0x80, 0x84,
+	0x07, 0xb4, 0x78, 0x28, 0x60, 0xad, 0x0f, 0x04, 0x90, 0x67, 0x71, 0x63,
+	0x0b, 0xd4, 0xb0, 0xc5, 0x71, 0xfb, 0x0e, 0xb4, 0x90, 0x6f, 0x70, 0xa6,
+	0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xdc, 0x00, 0xf0, 0x5b, 0x82,
+	0x24, 0x0d, 0x32, 0x6f, 0x21, 0x43, 0x02, 0x54, 0x11, 0x80, 0x00, 0xa0,
+	0x89, 0x46, 0xc0, 0x21, 0x11, 0x80, 0x00, 0x00, 0x24, 0x81, 0x3f, 0x00,
+	0x00, 0x34, 0x03, 0x47, 0xc0, 0x5a, 0x0e, 0x60, 0x01, 0x0c, 0x71, 0x9c,
+	0xc0, 0x40, 0xc0, 0x89, 0xc0, 0x56, 0x24, 0x41, 0x3d, 0x00, 0x24, 0x82,
+	0x3f, 0x00, 0x00, 0x9c, 0x01, 0xce, 0x0e, 0xa0, 0x00, 0x40, 0x24, 0xc3,
+	0x3f, 0x6c, 0x70, 0x41, 0xc3, 0x0c, 0xf0, 0x5a, 0x23, 0x01, 0x06, 0x38,
+	0x60, 0x59, 0x60, 0x0c, 0x70, 0x00, 0xa9, 0x44, 0x71, 0xf3, 0x0a, 0x34,
+	0x86, 0x9f, 0xc0, 0x64, 0x71, 0xf9, 0x0b, 0x34, 0x83, 0x4c, 0x70, 0x1a,
+	0x25, 0x80, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x2c, 0x70, 0xca, 0x00, 0x80,
+	0x01, 0x90, 0x00, 0xe1, 0x43, 0xc0, 0x20, 0xb0, 0x16, 0x00, 0xf0, 0x1f,
+	0x10, 0x00, 0x00, 0x00, 0x87, 0xb8, 0xd6, 0x0d, 0xa0, 0x00, 0x45, 0xc0,
+	0x12, 0x0e, 0xa0, 0x00, 0x29, 0xc0, 0x48, 0xc0, 0x0a, 0x0e, 0xa0, 0x00,
+	0x2b, 0xc0, 0x3f, 0x03, 0x20, 0x00, 0x44, 0xc0, 0x01, 0xc0, 0x4d, 0x08,
+	0xb5, 0x00, 0xad, 0x71, 0x01, 0xc0, 0x00, 0x1e, 0x03, 0x70, 0x70, 0x01,
+	0xf0, 0x2b, 0x08, 0xc2, 0x79, 0x20, 0x0e, 0x00, 0x00, 0x16, 0x80, 0x70,
+	0x00, 0x80, 0x4a, 0x00, 0x2c, 0x70, 0xc0, 0xb8, 0x07, 0x7e, 0x8e, 0x0c,
+	0xe0, 0x00, 0xc1, 0x40, 0x18, 0x43, 0x07, 0xc0, 0xa9, 0x47, 0x44, 0x26,
+	0xde, 0x17, 0x11, 0x0e, 0x10, 0x30, 0x42, 0x26, 0x5e, 0x30, 0xff, 0x0e,
+	0x31, 0xb0, 0xfb, 0x7f, 0x4b, 0x08, 0x8f, 0x03, 0xe9, 0x02, 0x00, 0x00,
+	0x44, 0x00, 0x20, 0x42, 0x73, 0x44, 0x00, 0x53, 0x04, 0xc2, 0x79, 0x20,
+	0x8e, 0x44, 0x00, 0x40, 0x7d, 0x00, 0x2c, 0x71, 0x44, 0x00, 0x13, 0x4a,
+	0x44, 0x00, 0x11, 0x06, 0x44, 0x00, 0xf2, 0x0d, 0xcd, 0x17, 0x06, 0xed,
+	0x61, 0xbd, 0x01, 0x0d, 0x31, 0x10, 0xfb, 0x7f, 0x11, 0x20, 0x80, 0x83,
+	0xa8, 0x02, 0x21, 0x00, 0xad, 0x72, 0x4c, 0x70, 0x0c, 0x70, 0x0b, 0xf0,
+	0x1a, 0x01, 0xf1, 0x0a, 0xb4, 0x01, 0x19, 0x61, 0xc0, 0x19, 0x82, 0x00,
+	0x40, 0xa9, 0x04, 0x71, 0x8c, 0x20, 0x03, 0x80, 0xb6, 0xf7, 0x3a, 0x0f,
+	0x60, 0x00, 0xa1, 0x40, 0x36, 0x06, 0x00, 0x91, 0x00, 0x1e, 0x43, 0x70,
+	0x00, 0x80, 0xe0, 0x06, 0x26, 0x0e, 0x00, 0xf0, 0x03, 0xef, 0x78, 0x63,
+	0x41, 0xee, 0x0f, 0x60, 0x00, 0x42, 0xc0, 0x02, 0xc0, 0xed, 0x70, 0x00,
+	0x1e, 0xc2, 0x73, 0x1c, 0x00, 0x51, 0x86, 0x0d, 0x00, 0x00, 0x06, 0x20,
+	0x00, 0xf2, 0x35, 0xf9, 0x43, 0x4e, 0xf0, 0x3f, 0x14, 0x82, 0x30, 0x84,
+	0x20, 0x01, 0x00, 0x53, 0x23, 0x01, 0x31, 0x05, 0x79, 0x6c, 0x70, 0x0e,
+	0xf0, 0x68, 0x60, 0x64, 0x71, 0x1a, 0x20, 0x8c, 0x0f, 0x00, 0x00, 0x00,
+	0x10, 0x05, 0xc0, 0x85, 0x78, 0x1b, 0x78, 0x9c, 0xb8, 0x9f, 0xb8, 0x20,
+	0xb0, 0xe9, 0x0b, 0xa4, 0x80, 0x56, 0x24, 0x40, 0x3d, 0x9e, 0x0c, 0x80,
+	0x00, 0xc1, 0x40, 0x90, 0xc1, 0x62, 0x0d, 0xef, 0xff, 0x07, 0xda, 0x12,
+	0x01, 0x24, 0xc9, 0x07, 0x9e, 0x00, 0xf1, 0x24, 0x10, 0xc2, 0x9f, 0x20,
+	0x03, 0x00, 0x4a, 0x22, 0x00, 0x12, 0x19, 0x61, 0x63, 0x71, 0x60, 0x89,
+	0x53, 0x22, 0x40, 0x01, 0x67, 0x71, 0x65, 0x78, 0x00, 0xa9, 0x40, 0x11,
+	0x83, 0x00, 0x40, 0x40, 0x42, 0x22, 0x4a, 0x10, 0xff, 0x0a, 0x31, 0x90,
+	0x1d, 0x78, 0xc5, 0xb8, 0x65, 0x78, 0x40, 0x19, 0x02, 0x00, 0x80, 0x18,
+	0x00, 0x82, 0x10, 0xda, 0x61, 0xba, 0x01, 0x0a, 0x31, 0x00, 0x18, 0x00,
+	0xf4, 0x03, 0x80, 0x19, 0x02, 0x00, 0x8c, 0x23, 0x01, 0xb0, 0x62, 0x07,
+	0xe5, 0xff, 0x2f, 0x20, 0xc0, 0x06, 0x03, 0xc0, 0xda, 0x00, 0xf0, 0x0f,
+	0x22, 0x0c, 0xa0, 0x00, 0xe0, 0xb0, 0x5a, 0x0a, 0xa0, 0x00, 0x02, 0xc0,
+	0x0c, 0x75, 0xc3, 0x41, 0x94, 0x00, 0x01, 0x00, 0xe2, 0x09, 0x60, 0x00,
+	0xc1, 0x42, 0xba, 0xf0, 0xe8, 0x66, 0x6c, 0x03, 0x62, 0xb5, 0xf2, 0x01,
+	0xc0, 0x12, 0x79, 0x98, 0x00, 0xd1, 0x1b, 0x00, 0x1d, 0x78, 0x12, 0x78,
+	0x25, 0x78, 0xab, 0x0d, 0x3e, 0x10, 0x42, 0x30, 0x00, 0xf2, 0x41, 0x95,
+	0x00, 0x01, 0x00, 0xb2, 0x09, 0x60, 0x00, 0xe1, 0x42, 0x6f, 0x70, 0x40,
+	0xf0, 0x2c, 0x70, 0x6c, 0x70, 0x17, 0xf0, 0x00, 0x24, 0x80, 0x3f, 0x00,
+	0x00, 0xb4, 0x01, 0x48, 0x60, 0x2f, 0x79, 0x06, 0xec, 0x61, 0xbc, 0x01,
+	0x0c, 0x31, 0x10, 0x1d, 0x78, 0x44, 0x71, 0xc0, 0xb8, 0x44, 0x23, 0xcc,
+	0x07, 0x05, 0xec, 0x61, 0xbc, 0xff, 0x0c, 0x31, 0x90, 0x1b, 0x78, 0x05,
+	0x79, 0x64, 0x71, 0xd7, 0x0b, 0x34, 0x82, 0x44, 0x27, 0xcc, 0x17, 0x02,
+	0xc0, 0x29, 0x08, 0x1e, 0x00, 0xea, 0x66, 0x3c, 0x00, 0xf1, 0x36, 0x9c,
+	0x01, 0x48, 0x60, 0x9f, 0xc2, 0x5f, 0x20, 0x00, 0x06, 0x1a, 0x62, 0x2f,
+	0x20, 0xc2, 0x06, 0x1d, 0x78, 0x1d, 0x78, 0x58, 0x60, 0x40, 0x88, 0x25,
+	0x7a, 0x40, 0xa8, 0xaa, 0x0c, 0xa0, 0x02, 0x2f, 0x78, 0x00, 0x42, 0xc3,
+	0x41, 0x96, 0x00, 0x01, 0x00, 0x36, 0x09, 0x60, 0x00, 0x0c, 0x75, 0x40,
+	0x23, 0x1b, 0x32, 0x8c, 0x23, 0x03, 0xb0, 0x80, 0x07, 0xe5, 0xff, 0x63,
+	0x42, 0xc3, 0x41, 0x97, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x00, 0x40, 0xaf,
+	0x0d, 0x7e, 0x10, 0xd8, 0x00, 0x51, 0x98, 0x00, 0x01, 0x00, 0x0a, 0xa8,
+	0x00, 0x31, 0xcd, 0x70, 0x42, 0xa8, 0x00, 0x15, 0x19, 0xa8, 0x00, 0x6f,
+	0x58, 0x60, 0xc0, 0x10, 0x80, 0x00, 0xac, 0x00, 0x0f, 0x15, 0xd3, 0xac,
+	0x00, 0xae, 0x2b, 0x08, 0x3e, 0x00, 0x89, 0xc0, 0xf8, 0x60, 0x48, 0x88,
+	0xb0, 0x00, 0x28, 0xdd, 0x78, 0xae, 0x00, 0x24, 0xfe, 0x0b, 0xae, 0x00,
+	0x60, 0x99, 0x00, 0x01, 0x00, 0x86, 0x08, 0xae, 0x00, 0xf1, 0x04, 0x08,
+	0xe6, 0x8c, 0x26, 0x03, 0x90, 0x7c, 0x07, 0xe5, 0xff, 0xc1, 0x42, 0xc3,
+	0x41, 0x9a, 0x00, 0x00, 0x00, 0x6e, 0x18, 0x00, 0xf0, 0x22, 0xe5, 0x71,
+	0xf5, 0x75, 0x8e, 0x06, 0xee, 0xff, 0x89, 0xc6, 0x01, 0xc0, 0x04, 0x71,
+	0x41, 0xc0, 0x01, 0xc0, 0x14, 0x74, 0xc8, 0x04, 0xe5, 0xff, 0x0c, 0x70,
+	0x44, 0xc0, 0x03, 0xc0, 0x2c, 0x70, 0x76, 0x0a, 0xa0, 0x00, 0x20, 0xb0,
+	0x4a, 0x26, 0x00, 0x30, 0xe4, 0xf0, 0x3f, 0x14, 0x80, 0x30, 0x42, 0xbc,
+	0x04, 0xf0, 0x12, 0x00, 0xff, 0xff, 0x41, 0xc0, 0x43, 0xc0, 0x96, 0xf0,
+	0xe8, 0x60, 0x0c, 0x26, 0x00, 0xb0, 0x91, 0xf4, 0x4c, 0x70, 0xcd, 0x70,
+	0xff, 0xd9, 0xad, 0x70, 0x58, 0x47, 0x0c, 0x70, 0x33, 0xf0, 0x0c, 0xf2,
+	0x74, 0x01, 0x24, 0xe3, 0x43, 0x88, 0x01, 0xf2, 0x43, 0x7d, 0x7b, 0xc0,
+	0xbb, 0x0d, 0xf0, 0x5a, 0x27, 0x03, 0x16, 0x9f, 0xc4, 0x7c, 0x64, 0x1d,
+	0x7b, 0x7d, 0x7b, 0x7d, 0x7b, 0x32, 0x24, 0xdf, 0x10, 0x44, 0x27, 0x43,
+	0x30, 0x30, 0x7c, 0x8c, 0x24, 0xc3, 0x9f, 0x08, 0xf4, 0xdf, 0xe0, 0xff,
+	0xd9, 0x16, 0xf7, 0x94, 0xeb, 0x4c, 0x70, 0x00, 0x41, 0x12, 0xf0, 0x74,
+	0x70, 0xc0, 0x22, 0x61, 0x00, 0x0e, 0xf2, 0x3f, 0xdb, 0x3c, 0x23, 0x0b,
+	0x00, 0x50, 0x7c, 0xb0, 0x7b, 0x3c, 0x23, 0x03, 0x03, 0x0b, 0x23, 0xc0,
+	0x82, 0x5c, 0x75, 0x3c, 0x76, 0xff, 0xd9, 0x38, 0x03, 0xf0, 0x0d, 0x9a,
+	0x07, 0xe5, 0xff, 0x53, 0x20, 0x83, 0x80, 0xb0, 0x78, 0x2f, 0x26, 0x88,
+	0xf0, 0x79, 0x20, 0x00, 0x00, 0xc5, 0x20, 0x61, 0x00, 0x14, 0x70, 0xbd,
+	0x72, 0xdd, 0x71, 0x12, 0x00, 0x40, 0x11, 0xf2, 0x04, 0x22, 0x06, 0x05,
+	0xf3, 0x9a, 0xfe, 0xff, 0x1d, 0x78, 0x30, 0x7e, 0x1e, 0x66, 0xcf, 0x78,
+	0xc0, 0xe0, 0x4a, 0xf7, 0x1b, 0x08, 0x35, 0x08, 0x40, 0xdd, 0x20, 0xde,
+	0x09, 0xf0, 0x0c, 0x71, 0x44, 0xc0, 0x33, 0xf0, 0xdf, 0xe0, 0xc9, 0x45,
+	0xc3, 0xf7, 0x5f, 0xdd, 0x5f, 0xde, 0xaf, 0x78, 0x2f, 0x79, 0x16, 0x0b,
+	0x60, 0x01, 0x4f, 0x7a, 0x08, 0x43, 0x0e, 0x0b, 0x60, 0x01, 0xcf, 0x78,
+	0x80, 0x25, 0x3f, 0x10, 0xbb, 0x79, 0x84, 0x21, 0x01, 0x00, 0xc4, 0xbd,
+	0x25, 0x7d, 0x90, 0xc1, 0xf4, 0x79, 0xa0, 0xb1, 0x42, 0x26, 0x01, 0x18,
+	0x3b, 0x7a, 0x84, 0x22, 0x01, 0x00, 0xc4, 0xb9, 0x25, 0x7a, 0x01, 0xc1,
+	0x96, 0xc3, 0xf4, 0x7b, 0x30, 0x79, 0x0c, 0x23, 0x40, 0x90, 0x01, 0xc1,
+	0x40, 0xb3, 0xca, 0x21, 0xc5, 0x02, 0x41, 0xc1, 0x03, 0xc1, 0x30, 0x79,
+	0x30, 0x70, 0x03, 0xc1, 0xca, 0x21, 0x05, 0x00, 0x43, 0xc1, 0xe5, 0x71,
+	0x02, 0xc0, 0x10, 0x77, 0xd4, 0x06, 0xe5, 0xff, 0x9c, 0xc0, 0x03, 0xc0,
+	0x10, 0x79, 0x01, 0xc0, 0x10, 0x78, 0x43, 0x08, 0x65, 0x00, 0x89, 0xc2,
+	0x16, 0x22, 0x82, 0x07, 0x06, 0x8a, 0x40, 0xdb, 0x54, 0x24, 0x0b, 0x3b,
+	0x1a, 0x20, 0x81, 0xb0, 0x03, 0xf3, 0x04, 0x25, 0x78, 0x1b, 0x78, 0xc3,
+	0x41, 0x00, 0x90, 0x00, 0x00, 0x25, 0x78, 0x60, 0xb0, 0x07, 0x8a, 0x1a,
+	0x20, 0x82, 0x1a, 0x00, 0x40, 0x45, 0x78, 0x1b, 0x78, 0x14, 0x00, 0xf0,
+	0x03, 0x03, 0xf0, 0x54, 0x24, 0x0b, 0x38, 0x2c, 0x70, 0x15, 0xf0, 0x9c,
+	0xc0, 0x28, 0x60, 0x25, 0x0e, 0x21, 0x30, 0xd6, 0x03, 0x93, 0x28, 0x60,
+	0xf4, 0x23, 0x42, 0x10, 0x1a, 0x20, 0x83, 0x2e, 0x00, 0x13, 0x65, 0xf8,
+	0x03, 0xf4, 0x21, 0x40, 0xb0, 0x24, 0x71, 0x02, 0xc0, 0xd7, 0x09, 0x04,
+	0x80, 0x40, 0x26, 0x5e, 0x30, 0x4c, 0x26, 0x80, 0xb0, 0x36, 0x06, 0xe5,
+	0xff, 0xed, 0x70, 0x04, 0xc0, 0xc3, 0x41, 0xa9, 0x00, 0x00, 0x00, 0xfa,
+	0x08, 0xef, 0xff, 0x78, 0x20, 0x00, 0x00, 0x8a, 0x08, 0x80, 0x00, 0xf6,
+	0x09, 0x80, 0x02, 0x78, 0x03, 0x55, 0xe0, 0xb8, 0x9c, 0x0f, 0xc2, 0xce,
+	0x05, 0xa2, 0x8e, 0x08, 0x60, 0x01, 0x0c, 0x70, 0x80, 0x24, 0x0d, 0x32,
+	0x02, 0x06, 0x20, 0xe6, 0xb8, 0x74, 0x02, 0xf0, 0x0d, 0x1d, 0x78, 0xc2,
+	0xb8, 0x2c, 0x74, 0x03, 0xf4, 0x14, 0x79, 0x06, 0xf0, 0x15, 0x79, 0x09,
+	0x09, 0x54, 0x03, 0x2c, 0x76, 0x15, 0x79, 0xe0, 0x7f, 0x01, 0x69, 0xc3,
+	0x42, 0x30, 0x05, 0xf0, 0x15, 0x20, 0x8a, 0x5f, 0x21, 0x81, 0x0c, 0x38,
+	0x60, 0x21, 0x8a, 0x5f, 0x21, 0x41, 0x06, 0x19, 0x61, 0x03, 0x89, 0xe6,
+	0xb8, 0x02, 0x89, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x1c, 0x00, 0xc2,
+	0xb8, 0x09, 0xf4, 0x34, 0x70, 0x70, 0x06, 0x82, 0x40, 0x06, 0x09, 0xf2,
+	0x08, 0xe1, 0x07, 0xf0, 0x0e, 0x00, 0xc2, 0x30, 0x06, 0x03, 0xf2, 0x08,
+	0xe1, 0x19, 0x61, 0xe0, 0x7f, 0x00, 0x89, 0x44, 0x07, 0x60, 0xb5, 0xc1,
+	0x54, 0xc2, 0x28, 0x45, 0x82, 0x03, 0x10, 0xee, 0xfe, 0x03, 0xf0, 0x44,
+	0x0d, 0x20, 0x00, 0x0c, 0x75, 0x6f, 0x70, 0x35, 0xf0, 0x61, 0x42, 0x09,
+	0xf0, 0x14, 0xc0, 0xf4, 0x20, 0x83, 0x00, 0x8e, 0xc0, 0x34, 0x78, 0x60,
+	0xb0, 0xba, 0x62, 0x24, 0x71, 0xf3, 0x09, 0x94, 0x82, 0x83, 0x41, 0x1c,
+	0x91, 0x46, 0x14, 0x03, 0x31, 0x5f, 0x91, 0x53, 0xc0, 0x48, 0x14, 0x01,
+	0x31, 0x4a, 0x14, 0x00, 0x31, 0x3a, 0x14, 0x1f, 0x31, 0x3c, 0x14, 0x1e,
+	0x31, 0x40, 0x14, 0x0f, 0x31, 0x42, 0x14, 0x0e, 0x31, 0x44, 0x14, 0x0c,
+	0x31, 0x46, 0xc3, 0x13, 0xc3, 0x48, 0xc0, 0x47, 0xc1, 0x42, 0xc2, 0xb2,
+	0x03, 0xf3, 0x16, 0xef, 0x00, 0x0b, 0x00, 0x45, 0xc4, 0x44, 0xc6, 0x43,
+	0xc7, 0x04, 0x1c, 0x80, 0x37, 0x00, 0x1c, 0xc0, 0x37, 0x4a, 0x0d, 0x20,
+	0x00, 0x61, 0x42, 0x67, 0x71, 0x2f, 0x23, 0xc8, 0x16, 0x97, 0x0b, 0x64,
+	0x93, 0x2c, 0x70, 0xb5, 0x02, 0x07, 0xf0, 0x32, 0xe4, 0xc2, 0xa4, 0xc1,
+	0x08, 0x46, 0x0c, 0x70, 0x66, 0x08, 0x20, 0x00, 0x2c, 0x70, 0x2c, 0x70,
+	0xff, 0xd8, 0x4c, 0x75, 0x6c, 0x72, 0x0c, 0x1c, 0xc1, 0x30, 0x28, 0x45,
+	0x42, 0xc1, 0x41, 0xc1, 0x26, 0x09, 0x20, 0x00, 0x40, 0xc1, 0x5f, 0x26,
+	0x00, 0x11, 0x2c, 0x70, 0x8d, 0xb9, 0x4c, 0x73, 0xc5, 0x78, 0x84, 0x20,
+	0x03, 0x0f, 0x42, 0xc0, 0xff, 0xd8, 0x6c, 0x74, 0x43, 0xc5, 0x41, 0xc5,
+	0x06, 0x20, 0x00, 0x50, 0xc5, 0xff, 0xd8, 0x80, 0xd9, 0x38, 0x00, 0xf2,
+	0x27, 0x43, 0xc5, 0x42, 0xc5, 0x41, 0xc5, 0xf2, 0x08, 0x20, 0x00, 0x40,
+	0xc5, 0xa4, 0xc0, 0xc4, 0xc6, 0xe0, 0x78, 0x0c, 0x70, 0x00, 0x1e, 0x04,
+	0x70, 0x04, 0x90, 0x02, 0x01, 0xe0, 0x7e, 0xe4, 0xc2, 0x08, 0x43, 0xad,
+	0x70, 0xcb, 0x46, 0x08, 0x90, 0xe4, 0x01, 0x8c, 0x21, 0xc3, 0x8f, 0xa0,
+	0xb6, 0xa1, 0xb6, 0xa2, 0xb6, 0x24, 0xf2, 0xaa, 0x01, 0x20, 0x04, 0x00,
+	0xf4, 0x01, 0x00, 0x26, 0x07, 0xa0, 0x05, 0x23, 0x80, 0x0f, 0x04, 0x90,
+	0x40, 0x00, 0x20, 0xb0, 0x62, 0x08, 0x83, 0xcd, 0x07, 0x81, 0x88, 0x00,
+	0x88, 0x0c, 0xf0, 0x40, 0x02, 0xa0, 0x20, 0x04, 0x71, 0x65, 0x7a, 0x05,
+	0x22, 0x82, 0x0f, 0x02, 0x22, 0x00, 0xf0, 0x0a, 0xb2, 0xeb, 0x0c, 0x05,
+	0x90, 0x06, 0x08, 0x80, 0x02, 0x8a, 0x20, 0x1a, 0x02, 0xc3, 0x41, 0x0e,
+	0x90, 0x2a, 0x00, 0xfc, 0x1e, 0xc4, 0x92, 0x00, 0xb1, 0x3a, 0x00, 0x40,
+	0x46, 0x04, 0xa0, 0xa8, 0x60, 0x08, 0xf0, 0x41, 0xac, 0x0f, 0x01, 0xb1,
+	0x0c, 0x70, 0xc4, 0xc6, 0x4c, 0x70, 0x10, 0x72, 0xe0, 0x20, 0xca, 0x07,
+	0x00, 0x16, 0x01, 0x71, 0x08, 0x90, 0xd6, 0x01, 0xf3, 0x09, 0x3e, 0x80,
+	0x44, 0x71, 0xe0, 0x7e, 0xe2, 0xc2, 0x28, 0x43, 0x52, 0x0e, 0x60, 0x00,
+	0x0a, 0x26, 0x00, 0x30, 0xcb, 0x45, 0x04, 0x90, 0xf2, 0x00, 0x00, 0x1d,
+	0x45, 0x10, 0x00, 0x1d, 0x05, 0x10, 0x00, 0x1e, 0x84, 0x77, 0x08, 0x90,
+	0xe2, 0x01, 0xd2, 0x0d, 0x60, 0x01, 0x0c, 0x76, 0x17, 0x0b, 0x30, 0x10,
+	0x10, 0x1d, 0x45, 0x10, 0x54, 0x00, 0xc2, 0xa8, 0x61, 0xb6, 0x0f, 0xcf,
+	0xff, 0x10, 0x1d, 0x05, 0x10, 0xc2, 0xc6, 0xdc, 0x01, 0xf0, 0x1b, 0xa6,
+	0xc1, 0x0a, 0x26, 0x80, 0x30, 0x0b, 0xc2, 0x45, 0xc3, 0x7f, 0xdb, 0x40,
+	0xc0, 0x44, 0x7b, 0x4b, 0xd8, 0x38, 0x23, 0x0f, 0x00, 0x9a, 0x27, 0x02,
+	0x10, 0xe6, 0xba, 0x8a, 0x20, 0x3e, 0x00, 0x4f, 0x23, 0x4c, 0x00, 0xca,
+	0x27, 0x01, 0x10, 0xcf, 0xe4, 0x06, 0x00, 0x20, 0xd1, 0xe3, 0x06, 0x00,
+	0xe0, 0x00, 0xc0, 0x00, 0x16, 0x83, 0x70, 0x00, 0x80, 0x46, 0x04, 0x00,
+	0x14, 0x1f, 0x30, 0x34, 0x06, 0xf1, 0xa2, 0x0e, 0xc0, 0x42, 0x26, 0x4b,
+	0x30, 0xca, 0x27, 0xc1, 0x30, 0x43, 0xc0, 0x0d, 0xc0, 0x44, 0xc0, 0x0c,
+	0xc0, 0x51, 0x0b, 0xb5, 0x16, 0x42, 0xc0, 0x50, 0xdb, 0x41, 0xc3, 0x20,
+	0xdb, 0x10, 0xd8, 0x30, 0xde, 0x60, 0xdd, 0x78, 0x43, 0x8d, 0x70, 0x25,
+	0x20, 0xc0, 0x02, 0x1a, 0xf0, 0x1a, 0xf0, 0x18, 0xf0, 0x18, 0xf0, 0x5c,
+	0xf0, 0x19, 0xf0, 0x14, 0xf0, 0x16, 0xf0, 0x45, 0xf0, 0x48, 0xf0, 0x10,
+	0xf0, 0x10, 0xf0, 0x47, 0xf0, 0x3b, 0xf0, 0x0e, 0xf0, 0x0c, 0xf0, 0x0a,
+	0xf0, 0x0a, 0xf0, 0x08, 0xf0, 0x08, 0xf0, 0x06, 0xf0, 0x06, 0xf0, 0x3f,
+	0xf0, 0x34, 0xf0, 0x05, 0xf0, 0xa8, 0xf0, 0x6c, 0x70, 0x03, 0xf0, 0x10,
+	0xdb, 0x4c, 0x26, 0x40, 0xb6, 0x4a, 0x01, 0x2d, 0x00, 0x60, 0x40, 0x6c,
+	0x72, 0x8d, 0x74, 0x41, 0xc0, 0x08, 0x46, 0x18, 0x43, 0x08, 0x45, 0x08,
+	0x47, 0x25, 0x20, 0x80, 0x07, 0x36, 0xf0, 0x2c, 0xf0, 0x2b, 0xf0, 0x17,
+	0xf0, 0x17, 0xf0, 0x93, 0xf0, 0x99, 0xf0, 0x93, 0xf0, 0x15, 0xf0, 0x19,
+	0xf0, 0x1c, 0xf0, 0x91, 0xf0, 0x0f, 0xf0, 0x1b, 0xf0, 0x0f, 0xf0, 0x0d,
+	0xf0, 0x89, 0xf0, 0x87, 0xf0, 0x87, 0xf0, 0x85, 0xf0, 0x85, 0xf0, 0x18,
+	0xf0, 0x17, 0xf0, 0x13, 0x60, 0x00, 0xf0, 0x3d, 0x07, 0xdb, 0x12, 0xf0,
+	0x01, 0xc7, 0x8d, 0x75, 0x18, 0xf0, 0x8d, 0x75, 0xa9, 0x47, 0x14, 0xf0,
+	0x8d, 0x75, 0xc9, 0x47, 0x12, 0xf0, 0x8d, 0x71, 0x6b, 0x47, 0x0e, 0xf0,
+	0x8d, 0x76, 0x0b, 0xf0, 0x8d, 0x70, 0x0a, 0xf0, 0x6c, 0x73, 0x0d, 0x0e,
+	0xd1, 0x30, 0x02, 0xc4, 0x9a, 0x24, 0x04, 0x10, 0x85, 0x7a, 0x68, 0x44,
+	0x08, 0x47, 0x8a, 0x23, 0xfd, 0x0f, 0x24, 0x7b, 0x3d, 0x78, 0x44, 0x20,
+	0x0b, 0x0c, 0xb0, 0xe3, 0x58, 0xdb, 0xcf, 0x23, 0xe1, 0x11, 0x24, 0x7b,
+	0x04, 0x08, 0xf1, 0x06, 0x05, 0x23, 0xc3, 0x02, 0x85, 0x78, 0x05, 0x7b,
+	0x3d, 0x78, 0x9a, 0x23, 0x04, 0x00, 0x1d, 0x78, 0x05, 0xc4, 0x1d, 0x78,
+	0x04, 0xfa, 0x0a, 0xf1, 0x11, 0x00, 0x20, 0x05, 0x7c, 0x65, 0x7c, 0x2f,
+	0x23, 0xc0, 0x17, 0xc3, 0x43, 0x08, 0x90, 0x00, 0x00, 0x05, 0x23, 0xc0,
+	0x10, 0x80, 0xb0, 0x20, 0x40, 0x9a, 0x20, 0x04, 0x00, 0x54, 0x71, 0x04,
+	0x21, 0x7e, 0x04, 0x22, 0xff, 0x04, 0x36, 0x08, 0x42, 0x0f, 0x02, 0xc0,
+	0x1a, 0x36, 0x00, 0xd0, 0x10, 0x05, 0x7c, 0xe1, 0x40, 0xcf, 0x20, 0xa1,
+	0x01, 0x4c, 0x26, 0x80, 0xb1, 0x7a, 0x01, 0xf1, 0x04, 0x04, 0xc0, 0xc3,
+	0xb8, 0x05, 0x7f, 0xef, 0x78, 0x05, 0x7c, 0x54, 0x23, 0x00, 0x18, 0x65,
+	0x78, 0x80, 0xb0, 0x55, 0x08, 0x00, 0xf1, 0x04, 0x40, 0xb0, 0x03, 0xc0,
+	0x05, 0x79, 0x55, 0x23, 0x00, 0x1c, 0x05, 0x7b, 0x20, 0xb3, 0x00, 0xc0,
+	0x40, 0x27, 0x41, 0x98, 0x01, 0x51, 0x05, 0xf4, 0x00, 0x1e, 0x42, 0xaa,
+	0x01, 0x24, 0x2f, 0x78, 0x3e, 0x0a, 0xf0, 0x25, 0x8d, 0x73, 0x10, 0xdf,
+	0x9e, 0xf1, 0x8d, 0x70, 0x9b, 0xf1, 0x8d, 0x71, 0x99, 0xf1, 0x20, 0xdc,
+	0x97, 0xf1, 0x8d, 0x75, 0x95, 0xf1, 0xe0, 0x78, 0xf1, 0xc0, 0xa4, 0xc1,
+	0x08, 0xc4, 0x43, 0xc4, 0x07, 0xc4, 0x42, 0xc4, 0x06, 0xc4, 0x41, 0xc4,
+	0x05, 0xc4, 0xe2, 0x0d, 0xef, 0xff, 0x40, 0xc4, 0xa4, 0xc0, 0xd1, 0xc0,
+	0xf0, 0x0b, 0x00, 0x2a, 0x04, 0x40, 0x46, 0x04, 0x20, 0x89, 0xf0, 0x01,
+	0x40, 0xca, 0x20, 0x41, 0x00, 0x22, 0x03, 0x4f, 0x08, 0x90, 0xe8, 0x01,
+	0x1c, 0x00, 0x07, 0x13, 0xe6, 0x1c, 0x00, 0xf4, 0x2b, 0x0e, 0x90, 0x4c,
+	0x00, 0x60, 0x91, 0x41, 0x91, 0x1a, 0x22, 0x81, 0x0f, 0x01, 0x00, 0x00,
+	0x00, 0x65, 0x79, 0x07, 0xe8, 0x1a, 0x23, 0x80, 0x0f, 0x00, 0x80, 0x00,
+	0x00, 0x3d, 0x79, 0x08, 0xf0, 0x40, 0x40, 0x0f, 0xda, 0x61, 0xba, 0xff,
+	0x0a, 0x31, 0x80, 0x1d, 0x78, 0x3b, 0x79, 0x25, 0x78, 0xc3, 0x41, 0x0f,
+	0x90, 0x4c, 0xfe, 0x10, 0xda, 0x00, 0xb1, 0xd4, 0x08, 0x40, 0xe0, 0x7f,
+	0x01, 0xb1, 0x08, 0x07, 0xf0, 0x0d, 0x10, 0xf0, 0x5a, 0x26, 0x83, 0x3c,
+	0x7c, 0x60, 0x5a, 0x23, 0x43, 0x16, 0x65, 0x71, 0x9b, 0x63, 0x3b, 0x63,
+	0x80, 0x8b, 0x44, 0x7c, 0x80, 0xab, 0xeb, 0x0b, 0x94, 0x90, 0x60, 0x05,
+	0x80, 0xf9, 0x0e, 0xb4, 0xb0, 0x6d, 0x70, 0xe0, 0x7e, 0xcc, 0x00, 0xf0,
+	0x0a, 0x0c, 0x70, 0x4a, 0x0c, 0xef, 0xff, 0xff, 0xd9, 0x0c, 0x70, 0x43,
+	0xc0, 0x42, 0xc0, 0x41, 0xc0, 0x40, 0xc0, 0xff, 0xd8, 0x88, 0xd9, 0x4c,
+	0x75, 0x0a, 0xd6, 0x00, 0x92, 0xdb, 0x0c, 0x70, 0xc2, 0x0c, 0xef, 0xff,
+	0x2c, 0x71, 0xde, 0x00, 0xc0, 0x14, 0x70, 0xc0, 0x20, 0xe9, 0x0f, 0xe0,
+	0x7f, 0x84, 0x28, 0x01, 0x00, 0x84, 0x03, 0x60, 0xc9, 0x07, 0x21, 0x88,
+	0x00, 0x88, 0x36, 0x05, 0x70, 0x5f, 0x20, 0x80, 0x0c, 0x38, 0x60, 0x00,
+	0x90, 0x01, 0x52, 0x80, 0x7c, 0x06, 0x03, 0x88, 0x78, 0x05, 0x02, 0x06,
+	0x00, 0xf3, 0x0d, 0xe0, 0x7f, 0xc0, 0xb8, 0xe0, 0x78, 0x17, 0x09, 0xf0,
+	0x03, 0x8a, 0x22, 0xc7, 0x0f, 0x4c, 0x71, 0xc4, 0xb9, 0x05, 0xe9, 0x61,
+	0xb9, 0xff, 0x09, 0x31, 0x80, 0x5b, 0x7a, 0xc2, 0x01, 0xf0, 0x0a, 0x20,
+	0x05, 0x20, 0x81, 0x0f, 0x02, 0x90, 0x6a, 0x01, 0x4f, 0x22, 0x40, 0x02,
+	0x00, 0x19, 0x05, 0x00, 0x40, 0xb1, 0x00, 0xb1, 0x40, 0xb1, 0xe0, 0x7f,
+	0x0c, 0x00, 0xf0, 0x1b, 0xe0, 0x78, 0x0d, 0x08, 0x72, 0x00, 0x2c, 0x70,
+	0xff, 0x48, 0x84, 0x29, 0x01, 0x00, 0xe0, 0x7f, 0x2e, 0x78, 0xf1, 0xc0,
+	0x00, 0x42, 0x9a, 0x0e, 0x60, 0x00, 0x20, 0x40, 0x5b, 0x79, 0x44, 0x21,
+	0x81, 0x01, 0xc4, 0xb9, 0x06, 0xe9, 0x61, 0xb9, 0x01, 0x09, 0xd8, 0x09,
+	0x62, 0xd1, 0xc0, 0xe0, 0x7f, 0xc1, 0xb8, 0xa8, 0x01, 0x4c, 0x0c, 0x70,
+	0x6e, 0x0b, 0xdc, 0x00, 0xe6, 0x90, 0xd9, 0x4c, 0x75, 0x2e, 0x0c, 0xef,
+	0xff, 0x40, 0xdb, 0x0c, 0x70, 0xe6, 0x0b, 0xdc, 0x00, 0x06, 0x6c, 0x0d,
+	0x82, 0xa1, 0xc1, 0x20, 0x42, 0x84, 0xc1, 0x40, 0xc1, 0x02, 0x06, 0xf0,
+	0x01, 0x12, 0x00, 0x0f, 0x08, 0x64, 0x00, 0x40, 0x40, 0x1e, 0x0b, 0xe0,
+	0x02, 0x00, 0xc1, 0x87, 0x74, 0x60, 0x00, 0xf4, 0x3f, 0xa4, 0xc0, 0xe0,
+	0x78, 0x1d, 0x79, 0x6c, 0x21, 0x02, 0x01, 0x6c, 0x20, 0x41, 0x01, 0x22,
+	0x78, 0x1a, 0x62, 0xe0, 0x7f, 0x4e, 0x78, 0xe0, 0x78, 0xe6, 0xc0, 0x5f,
+	0x21, 0x83, 0x04, 0xcb, 0x44, 0x00, 0x80, 0xe2, 0x06, 0xcd, 0x70, 0x8d,
+	0x63, 0x79, 0x64, 0x41, 0x89, 0x04, 0x7d, 0x0b, 0xf0, 0x99, 0x61, 0xe2,
+	0x89, 0x0b, 0x7f, 0x06, 0xf2, 0xe3, 0x89, 0xaf, 0x79, 0x0f, 0x21, 0xcd,
+	0x03, 0xc5, 0x71, 0xf1, 0x0e, 0xa4, 0x90, 0x14, 0x23, 0x81, 0x03, 0xaf,
+	0x78, 0xc6, 0xc4, 0xa8, 0x0c, 0xf2, 0x23, 0xa4, 0xc1, 0xcb, 0x47, 0x00,
+	0x80, 0x7c, 0x06, 0x0e, 0x0b, 0xa0, 0x00, 0xe1, 0x40, 0xad, 0x70, 0xa9,
+	0x43, 0x0d, 0xf0, 0x5a, 0x23, 0x41, 0x06, 0x5a, 0x23, 0x80, 0x1c, 0x38,
+	0x60, 0xda, 0x0d, 0x60, 0x02, 0xf8, 0x60, 0x64, 0x71, 0xef, 0x0b, 0x94,
+	0x80, 0x65, 0x71, 0xfd, 0x0b, 0xb4, 0x90, 0x6c, 0x70, 0x84, 0x01, 0x41,
+	0xae, 0xa8, 0xa1, 0xa8, 0x0c, 0x05, 0xf0, 0x15, 0x80, 0xd8, 0x07, 0x72,
+	0x09, 0xa0, 0x00, 0xe0, 0xa0, 0x76, 0x09, 0xa0, 0x00, 0x08, 0x45, 0x00,
+	0x41, 0xc2, 0x0e, 0x60, 0x02, 0xa1, 0x40, 0x6f, 0x23, 0xc3, 0x30, 0x18,
+	0x13, 0x80, 0x30, 0x09, 0xe8, 0xc3, 0x41, 0xad, 0x02, 0x0a, 0xf0, 0x0e,
+	0x0f, 0xef, 0xff, 0x0a, 0xd8, 0x1f, 0xf0, 0x00, 0x13, 0x80, 0x30, 0xcb,
+	0x46, 0x1e, 0x00, 0x80, 0x84, 0xc3, 0x41, 0xf5, 0x05, 0x00, 0xe1, 0x44,
+	0x20, 0x8d, 0x80, 0xc1, 0x40, 0xb4, 0x02, 0xf0, 0x0f, 0x16, 0x09, 0x60,
+	0x01, 0x2c, 0x70, 0xb5, 0x70, 0xc3, 0x40, 0x9a, 0x3b, 0x00, 0xca, 0xca,
+	0x26, 0x01, 0x10, 0xc1, 0x40, 0x00, 0x1e, 0xc5, 0x70, 0x04, 0x90, 0xc0,
+	0x00, 0xfa, 0x08, 0x1c, 0x00, 0x02, 0xd6, 0x05, 0xf0, 0x01, 0x0d, 0x00,
+	0x0f, 0x08, 0x1e, 0x00, 0x00, 0x1e, 0x45, 0x70, 0x04, 0x90, 0xc0, 0x00,
+	0xcb, 0x46, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x0d, 0x00, 0x00, 0x04, 0x22,
+	0x4d, 0x18, 0x60, 0x40, 0x82, 0xc6, 0x0d, 0x00, 0x00, 0xf0, 0x41, 0x00,
+	0x80, 0xe0, 0x06, 0x00, 0x8e, 0xb7, 0x08, 0x10, 0x00, 0x00, 0x13, 0x80,
+	0x30, 0xaf, 0x08, 0xdf, 0x00, 0xde, 0x0d, 0x00, 0x00, 0xc3, 0x40, 0x00,
+	0x00, 0x00, 0x0a, 0xe2, 0x09, 0xef, 0xff, 0xff, 0xd9, 0xad, 0x70, 0xff,
+	0xd8, 0x2c, 0x70, 0x4c, 0x75, 0x6c, 0x73, 0x43, 0xc5, 0x42, 0xc5, 0x41,
+	0xc5, 0xa6, 0x0a, 0xef, 0xff, 0x40, 0xc5, 0x01, 0x8e, 0x25, 0x08, 0xb4,
+	0x00, 0x2c, 0x70, 0x04, 0x71, 0x1d, 0x78, 0x62, 0xb8, 0x0f, 0x78, 0x43,
+	0xc0, 0xff, 0xd8, 0x4c, 0x75, 0x6c, 0x72, 0x22, 0x00, 0x13, 0x82, 0x22,
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x3a, 0x00, 0x20, 0x0c, 0xdb, 0x16, 0x00,
+	0x13, 0x6e, 0x16, 0x00, 0x40, 0x08, 0xd9, 0x4c, 0x75, 0x1a, 0x00, 0x02,
+	0x2c, 0x00, 0x11, 0x56, 0x16, 0x00, 0x80, 0x9e, 0x0c, 0xef, 0xff, 0xff,
+	0xd8, 0x01, 0x8e, 0x2e, 0x00, 0x06, 0x1c, 0x00, 0x11, 0x3a, 0x1c, 0x00,
+	0x11, 0x66, 0x1c, 0x00, 0xf0, 0x13, 0x22, 0x09, 0x80, 0x02, 0x96, 0xd8,
+	0xea, 0x09, 0xef, 0xff, 0x2c, 0x71, 0x3e, 0x0f, 0x00, 0x00, 0x09, 0xf0,
+	0xfa, 0x0c, 0xcf, 0xff, 0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42, 0x1a, 0x08,
+	0x60, 0x01, 0x2c, 0x70, 0xc0, 0x00, 0xf0, 0x49, 0x3f, 0x08, 0x1e, 0x00,
+	0xc3, 0x43, 0x04, 0x90, 0x14, 0x00, 0x20, 0x93, 0x01, 0xca, 0x0d, 0x08,
+	0xb0, 0x01, 0x4f, 0x21, 0x82, 0x00, 0x0b, 0x08, 0xd1, 0x00, 0x85, 0x21,
+	0x08, 0x01, 0x20, 0x42, 0x40, 0xb3, 0x23, 0xd8, 0xc3, 0x42, 0x05, 0x90,
+	0x34, 0xe0, 0x00, 0xb2, 0x2c, 0x70, 0xc3, 0x40, 0x03, 0x90, 0x34, 0xe0,
+	0x20, 0xb0, 0xb1, 0xb8, 0x20, 0xb0, 0x21, 0xb2, 0xff, 0xdd, 0xe1, 0x40,
+	0x2c, 0x70, 0x8a, 0x22, 0xff, 0x0d, 0x6c, 0x77, 0x06, 0x0b, 0x20, 0x03,
+	0x40, 0xc5, 0x4c, 0x77, 0xe1, 0x40, 0x2c, 0x71, 0x40, 0x43, 0xf6, 0x0a,
+	0x0e, 0x00, 0xf0, 0x4d, 0xa4, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6,
+	0xe0, 0x78, 0x04, 0xca, 0x4c, 0x70, 0xc3, 0x43, 0x00, 0x80, 0xcd, 0x07,
+	0x13, 0xf0, 0x20, 0x8b, 0x0d, 0x0a, 0x44, 0x00, 0x21, 0x8b, 0x19, 0x09,
+	0x85, 0x00, 0x1a, 0x22, 0x81, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x05, 0x21,
+	0x81, 0x0f, 0x02, 0x90, 0x64, 0x1f, 0x00, 0x19, 0x05, 0x00, 0x44, 0x71,
+	0xe1, 0x0a, 0x04, 0x80, 0xe0, 0x7e, 0xe4, 0xc2, 0xad, 0x70, 0x9a, 0xbd,
+	0xff, 0xd8, 0xa1, 0x41, 0xcd, 0x70, 0x4a, 0x0d, 0xef, 0xff, 0x09, 0x1a,
+	0x03, 0x30, 0xa6, 0x0c, 0x40, 0x02, 0x4f, 0x25, 0x01, 0x14, 0x3a, 0x0d,
+	0xfe, 0x00, 0xf1, 0x4e, 0xd2, 0x0f, 0xa0, 0x02, 0xff, 0xd8, 0xab, 0x26,
+	0xc4, 0x10, 0xff, 0x7f, 0x00, 0xf0, 0xf1, 0xc0, 0xa5, 0xc1, 0x00, 0x43,
+	0x80, 0xc0, 0x2c, 0x70, 0x3a, 0x0a, 0x60, 0x01, 0x14, 0xda, 0x1a, 0x23,
+	0x80, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x80, 0xc1, 0x4c, 0x71, 0x3a, 0x0e,
+	0x20, 0x02, 0x85, 0xb8, 0xc3, 0x41, 0xf6, 0x00, 0x00, 0x00, 0xfe, 0x0c,
+	0xef, 0xff, 0x0c, 0x75, 0x0c, 0x70, 0x2c, 0x71, 0x32, 0x0f, 0xaf, 0xff,
+	0x80, 0xc2, 0xa5, 0xc0, 0xd1, 0xc0, 0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc2,
+	0xfc, 0x1c, 0xc8, 0xb6, 0x82, 0x24, 0x02, 0x3d, 0x48, 0x47, 0x38, 0x43,
+	0x08, 0x4a, 0x00, 0xf1, 0x09, 0xee, 0x09, 0x60, 0x01, 0xb4, 0xda, 0x25,
+	0x0b, 0xb1, 0x10, 0x0c, 0x75, 0xc3, 0x41, 0xf2, 0x00, 0x01, 0x00, 0xc2,
+	0x0c, 0xef, 0xff, 0x60, 0x42, 0x66, 0x00, 0xf0, 0x00, 0x0f, 0x20, 0x02,
+	0x4c, 0x71, 0x0c, 0x70, 0x09, 0xd9, 0x36, 0xf0, 0x1a, 0x23, 0x9b, 0x3f,
+	0x6c, 0x00, 0x31, 0x1b, 0x0b, 0x30, 0x2a, 0x00, 0x51, 0xf4, 0x00, 0x01,
+	0x00, 0x96, 0x2a, 0x00, 0xf1, 0x00, 0x09, 0xdd, 0xc0, 0xde, 0xd0, 0xd8,
+	0x0a, 0xf0, 0xc3, 0x41, 0xf3, 0x00, 0x01, 0x00, 0x82, 0x14, 0x00, 0xf0,
+	0x0b, 0xad, 0x72, 0x8c, 0xde, 0x80, 0xd8, 0xf8, 0x60, 0x05, 0x20, 0xc0,
+	0x06, 0x80, 0xc1, 0x9e, 0x0d, 0x20, 0x02, 0x4c, 0x72, 0x0c, 0x70, 0x2c,
+	0x72, 0xa2, 0x0e, 0x90, 0x00, 0x00, 0x5c, 0x00, 0x11, 0x76, 0x78, 0x00,
+	0xf2, 0x04, 0xfe, 0x66, 0x05, 0x26, 0xc0, 0x16, 0x80, 0xc1, 0x7e, 0x0d,
+	0x20, 0x02, 0xa1, 0x42, 0x0c, 0x71, 0xa1, 0x41, 0x7e, 0x22, 0x00, 0x32,
+	0x24, 0x02, 0x3d, 0x5a, 0x01, 0x20, 0xe2, 0xc3, 0xb0, 0x00, 0x22, 0x28,
+	0x45, 0xf8, 0x00, 0x11, 0x42, 0x36, 0x00, 0xc0, 0x54, 0x23, 0x00, 0x0d,
+	0x80, 0xc1, 0x4a, 0x0d, 0x20, 0x02, 0x09, 0xda, 0xb6, 0x00, 0xa0, 0xf5,
+	0x00, 0x01, 0x00, 0x0a, 0x0c, 0xef, 0xff, 0xa1, 0x42, 0xac, 0x00, 0x11,
+	0x3e, 0x42, 0x00, 0x60, 0xc2, 0xc7, 0xe0, 0x78, 0xf1, 0xc0, 0x3c, 0x00,
+	0x00, 0x6e, 0x00, 0x11, 0x0a, 0x38, 0x00, 0x80, 0xc3, 0x41, 0xf7, 0x00,
+	0x00, 0x00, 0xe2, 0x0b, 0x1e, 0x01, 0x52, 0x40, 0xd8, 0x80, 0xc1, 0x06,
+	0x42, 0x00, 0x41, 0x70, 0x09, 0xd9, 0x0a, 0x34, 0x00, 0x40, 0x80, 0x24,
+	0x02, 0x3d, 0x2a, 0x01, 0xf2, 0x49, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80,
+	0x12, 0x00, 0x34, 0x75, 0xe0, 0x20, 0xc5, 0x07, 0xe0, 0x7f, 0x09, 0x1a,
+	0x02, 0x30, 0xe6, 0xc0, 0xcb, 0x44, 0x04, 0x90, 0xe4, 0x00, 0xc3, 0x42,
+	0x00, 0x80, 0xcb, 0x07, 0x35, 0x08, 0xb0, 0x00, 0x6c, 0x71, 0x14, 0x71,
+	0x25, 0xd8, 0xcb, 0x46, 0x04, 0x90, 0x30, 0x00, 0x9f, 0xb8, 0x2a, 0xf4,
+	0x25, 0x8a, 0x23, 0xaa, 0xa4, 0x8a, 0x34, 0x7b, 0xa2, 0xaa, 0xc0, 0x96,
+	0xe0, 0x88, 0xbb, 0x78, 0xe0, 0xb4, 0x00, 0xaa, 0x5f, 0x0e, 0x71, 0x11,
+	0x61, 0xaa, 0xe1, 0xb4, 0x2d, 0xf0, 0x0c, 0x70, 0x00, 0xb4, 0x58, 0x00,
+	0x40, 0x58, 0x00, 0x21, 0xb4, 0x4c, 0x00, 0xf0, 0x17, 0xf6, 0x00, 0x00,
+	0xb4, 0x04, 0xb4, 0x06, 0x1c, 0xc5, 0x13, 0x27, 0x8a, 0x23, 0xaa, 0x06,
+	0x8a, 0x34, 0x7b, 0x02, 0xaa, 0x1b, 0x78, 0x00, 0xaa, 0xff, 0xd8, 0x61,
+	0xaa, 0xfe, 0x1c, 0x04, 0x90, 0xc6, 0xc4, 0xa0, 0x88, 0xa0, 0xb4, 0x1c,
+	0x00, 0x15, 0x04, 0x1c, 0x00, 0xf0, 0x25, 0x61, 0xaa, 0x00, 0x96, 0x29,
+	0x08, 0x51, 0x01, 0xa1, 0xb4, 0x15, 0xf0, 0x02, 0x1c, 0x05, 0x10, 0xc3,
+	0x41, 0x04, 0x90, 0xfe, 0x00, 0xff, 0xd8, 0x00, 0x19, 0xc5, 0x03, 0xf8,
+	0x19, 0x04, 0x80, 0xf6, 0x19, 0x05, 0x80, 0xfe, 0x19, 0x05, 0x80, 0xc6,
+	0xc4, 0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x58, 0x00, 0x01, 0xb4, 0xd4,
+	0x02, 0xf4, 0x01, 0x04, 0x90, 0xf6, 0x00, 0x20, 0xb0, 0x24, 0xb0, 0xfe,
+	0x18, 0x44, 0x80, 0x23, 0xb0, 0xc6, 0xc4, 0x0c, 0x02, 0xf0, 0x2b, 0xa5,
+	0xc1, 0x08, 0x47, 0xc3, 0x40, 0x00, 0x80, 0xc9, 0x07, 0xc0, 0x88, 0x53,
+	0x27, 0x40, 0x10, 0x78, 0x20, 0x80, 0x00, 0x42, 0xc0, 0x44, 0xc1, 0x02,
+	0xc1, 0xde, 0x0c, 0xe0, 0x00, 0xc1, 0x40, 0xcb, 0x45, 0x00, 0x80, 0x7c,
+	0x06, 0x43, 0xc0, 0xa1, 0x40, 0xd6, 0x09, 0x60, 0x02, 0x0d, 0xd9, 0xa1,
+	0x40, 0x0d, 0xd9, 0x8e, 0x0f, 0xe0, 0x00, 0x40, 0xda, 0x0a, 0x00, 0xc0,
+	0x5e, 0x09, 0xef, 0xff, 0x7f, 0xda, 0x5f, 0x27, 0x00, 0x11, 0xdb, 0x43,
+	0x34, 0x04, 0x20, 0x05, 0x7f, 0x70, 0x03, 0x22, 0x14, 0xe8, 0x7c, 0x00,
+	0xf4, 0x13, 0x01, 0x00, 0x1d, 0x08, 0xdf, 0x00, 0x02, 0xc0, 0x63, 0xf8,
+	0x04, 0x1c, 0x01, 0x30, 0x00, 0x1c, 0xc1, 0x3f, 0x59, 0x61, 0xb9, 0x61,
+	0x2a, 0x0d, 0xe0, 0x02, 0x4c, 0x70, 0x0b, 0xf0, 0x02, 0xc0, 0x5d, 0xf8,
+	0x14, 0x00, 0x20, 0xce, 0x0b, 0x14, 0x00, 0x00, 0x7a, 0x03, 0xf0, 0x29,
+	0x4c, 0xe0, 0x8a, 0x21, 0xc7, 0x0f, 0x00, 0x18, 0x05, 0x00, 0xfc, 0x18,
+	0x44, 0x80, 0x6d, 0x70, 0x03, 0xc0, 0xaa, 0xe8, 0x22, 0xf0, 0x5f, 0x26,
+	0x01, 0x14, 0x02, 0xc0, 0x16, 0x21, 0x00, 0x00, 0x61, 0x70, 0x32, 0x20,
+	0x9e, 0x0f, 0x00, 0x80, 0xa8, 0x07, 0x04, 0xc0, 0x06, 0x0e, 0x60, 0x02,
+	0x0a, 0x21, 0x80, 0x07, 0x1a, 0x26, 0x82, 0x3f, 0x62, 0x03, 0xf0, 0x1b,
+	0xc3, 0x41, 0x02, 0x90, 0x50, 0x00, 0x8a, 0xb8, 0x65, 0x71, 0x05, 0x22,
+	0x43, 0x00, 0x64, 0xb9, 0x45, 0x79, 0x00, 0xb3, 0x00, 0x19, 0xc5, 0x0f,
+	0x00, 0xb3, 0x02, 0xc0, 0xd4, 0x78, 0x32, 0x20, 0x80, 0x0f, 0x00, 0x80,
+	0x84, 0x07, 0xb5, 0x0b, 0x04, 0x90, 0xbc, 0x00, 0x20, 0xa2, 0x08, 0xbc,
+	0x00, 0x00, 0x0a, 0x00, 0x60, 0xbe, 0x0e, 0xe0, 0x00, 0x49, 0xda, 0xba,
+	0x00, 0x15, 0x13, 0xba, 0x00, 0x11, 0x1f, 0xba, 0x00, 0x19, 0x2f, 0xba,
+	0x00, 0x20, 0x72, 0x0c, 0xa6, 0x00, 0x55, 0x18, 0xf0, 0x02, 0xc0, 0x29,
+	0xba, 0x00, 0x13, 0x16, 0xba, 0x00, 0xc0, 0x00, 0x00, 0x10, 0x27, 0xaa,
+	0x0b, 0x20, 0x01, 0x2c, 0x70, 0x52, 0x09, 0x82, 0x04, 0x50, 0x00, 0x00,
+	0x4c, 0x1d, 0x9a, 0x10, 0x00, 0x80, 0x73, 0xc3, 0x40, 0x03, 0x00, 0xa0,
+	0xf7, 0x8e, 0x0c, 0x00, 0xf4, 0x01, 0x70, 0xa1, 0x40, 0x92, 0x0c, 0x20,
+	0x02, 0x0d, 0xd9, 0x03, 0xc0, 0xad, 0xe8, 0xad, 0x70, 0x23, 0xd8, 0x00,
+	0x63, 0x79, 0xb8, 0x61, 0x32, 0x20, 0x81, 0xd6, 0x00, 0xe0, 0x2e, 0x0d,
+	0x60, 0x02, 0x28, 0x43, 0x2c, 0x70, 0x0e, 0xf0, 0x1a, 0x23, 0x82, 0x1f,
+	0xd8, 0x00, 0x60, 0x24, 0x71, 0x05, 0x22, 0x82, 0x0f, 0xdc, 0x00, 0xf9,
+	0x03, 0x60, 0xb2, 0x4f, 0x20, 0x83, 0x02, 0x60, 0xb2, 0xe7, 0x09, 0xb4,
+	0x80, 0x4f, 0x20, 0x43, 0x02, 0xa5, 0x71, 0xda, 0x00, 0x45, 0x0d, 0x04,
+	0x90, 0xa5, 0x90, 0x04, 0xf0, 0x01, 0x5f, 0x26, 0x82, 0x1c, 0xc3, 0x43,
+	0xff, 0xff, 0xff, 0xdf, 0x5f, 0x20, 0x41, 0x06, 0xef, 0x78, 0x00, 0x04,
+	0x02, 0x14, 0x00, 0x46, 0xbf, 0xff, 0xf7, 0x87, 0x14, 0x00, 0x02, 0x14,
+	0x04, 0x20, 0xa1, 0xc1, 0xc8, 0x02, 0xf0, 0x0e, 0xf4, 0x00, 0x00, 0x96,
+	0xa2, 0x6e, 0x2c, 0x70, 0x40, 0xc0, 0xff, 0xd8, 0x00, 0x15, 0x1b, 0x11,
+	0xe3, 0x95, 0x08, 0x15, 0x0b, 0x11, 0x08, 0x1d, 0xc5, 0x13, 0x00, 0xb5,
+	0x06, 0x06, 0x00, 0x12, 0xb6, 0xda, 0x01, 0xa0, 0xc8, 0x07, 0x00, 0x1e,
+	0x04, 0x70, 0x08, 0x90, 0x90, 0x01, 0x14, 0x06, 0xf4, 0x09, 0xf8, 0x2a,
+	0xae, 0x0a, 0x20, 0x01, 0xfa, 0x1e, 0x85, 0x94, 0x00, 0xc0, 0x00, 0xb6,
+	0xe3, 0xb5, 0x00, 0x1d, 0xc4, 0x16, 0x08, 0x1d, 0xc4, 0x12, 0x2c, 0x00,
+	0x60, 0x1d, 0x78, 0xa0, 0xb8, 0x29, 0x68, 0x66, 0x02, 0x62, 0xe0, 0x06,
+	0x21, 0xa8, 0x87, 0x74, 0xd8, 0x03, 0x02, 0x78, 0x00, 0x82, 0xcb, 0x47,
+	0x04, 0x90, 0xe0, 0x01, 0x20, 0x97, 0x2c, 0x00, 0xf2, 0x55, 0x04, 0x00,
+	0xad, 0x70, 0x5f, 0x20, 0x00, 0x01, 0x44, 0x20, 0xc2, 0x07, 0x20, 0x40,
+	0x06, 0xea, 0x61, 0xba, 0x01, 0x0a, 0x31, 0x00, 0x1d, 0x78, 0xc3, 0xb8,
+	0x0f, 0x08, 0x70, 0x00, 0xa1, 0xc1, 0x07, 0x08, 0x90, 0x01, 0xad, 0x71,
+	0x0c, 0x70, 0x3e, 0x0a, 0x20, 0x01, 0x40, 0xd9, 0xcb, 0x46, 0x05, 0x90,
+	0x12, 0xe1, 0xde, 0x1e, 0x55, 0x10, 0xa6, 0x1e, 0x55, 0x90, 0xb6, 0x17,
+	0x00, 0x91, 0x6f, 0x71, 0x40, 0xc0, 0x29, 0xed, 0x00, 0xc0, 0x4f, 0x08,
+	0xbf, 0x03, 0x1c, 0xd9, 0x00, 0xc0, 0x84, 0x20, 0x07, 0x0c, 0x40, 0xc0,
+	0x8f, 0xb8, 0x00, 0xb6, 0x0c, 0x70, 0x0a, 0x0a, 0x20, 0x01, 0xf6, 0x1e,
+	0x05, 0x92, 0x1e, 0x06, 0x40, 0x2c, 0x70, 0xfa, 0x09, 0x10, 0x00, 0xa0,
+	0x45, 0x92, 0xbe, 0x17, 0x00, 0x91, 0xf0, 0x1e, 0x45, 0x90, 0x1c, 0x00,
+	0x50, 0x9a, 0x20, 0x08, 0x00, 0x04, 0x8a, 0x01, 0xd0, 0x00, 0x00, 0x3e,
+	0x00, 0xc0, 0x25, 0x78, 0x8e, 0xb8, 0x00, 0xb6, 0x05, 0xf0, 0x1a, 0x00,
+	0x00, 0x22, 0x00, 0x84, 0x00, 0x1e, 0xc4, 0x76, 0x13, 0x90, 0x50, 0xe0,
+	0xc2, 0x00, 0x04, 0x44, 0x03, 0x40, 0xa2, 0xc1, 0x08, 0x46, 0xde, 0x00,
+	0x62, 0xc9, 0x07, 0x00, 0x10, 0x9b, 0x00, 0x32, 0x03, 0x40, 0xa1, 0x40,
+	0xa6, 0x0e, 0xea, 0x01, 0x00, 0x60, 0x02, 0x51, 0x3a, 0x0e, 0xaf, 0xff,
+	0x7f, 0x30, 0x03, 0x60, 0x2e, 0x0e, 0xaf, 0xff, 0xfe, 0xda, 0x2c, 0x00,
+	0x95, 0xe0, 0x06, 0x00, 0x88, 0x53, 0x26, 0x4f, 0x10, 0x1c, 0x72, 0x02,
+	0xc0, 0x2d, 0x08, 0xff, 0x00, 0x78, 0x27, 0x80, 0x10, 0x5f, 0x23, 0x82,
+	0x3c, 0x9e, 0x01, 0x22, 0xc1, 0x40, 0xbe, 0x01, 0x40, 0x04, 0x1c, 0x41,
+	0x30, 0x38, 0x03, 0x60, 0x4c, 0x70, 0xf2, 0x09, 0xe0, 0x02, 0x32, 0x03,
+	0x68, 0x18, 0xf0, 0x12, 0x0e, 0x8f, 0xff, 0x2c, 0x00, 0x42, 0x5f, 0x26,
+	0x00, 0x11, 0x2e, 0x00, 0x00, 0x20, 0x00, 0xa0, 0x59, 0x61, 0xc5, 0x78,
+	0xb9, 0x61, 0x0f, 0x78, 0x7a, 0x08, 0xb0, 0x02, 0x00, 0xa2, 0x01, 0xc0,
+	0xb0, 0x36, 0x0e, 0x09, 0x20, 0x01, 0x0a, 0xd9, 0xa1, 0x40, 0x12, 0x0a,
+	0x96, 0x00, 0x93, 0x00, 0x1e, 0x05, 0x70, 0x03, 0x90, 0x48, 0xe0, 0xa2,
+	0x2e, 0x02, 0x03, 0x8c, 0x01, 0xf8, 0x08, 0x46, 0x04, 0x90, 0xf4, 0x00,
+	0xa2, 0x6e, 0xff, 0xd8, 0x00, 0x16, 0x1b, 0x11, 0x00, 0x15, 0x1e, 0x11,
+	0x06, 0x15, 0x0b, 0x11, 0xe4, 0x95, 0x00, 0x02, 0x24, 0x0c, 0x70, 0xfa,
+	0x01, 0x60, 0x34, 0xd8, 0xfa, 0x1e, 0x04, 0x90, 0x5e, 0x00, 0x40, 0xf8,
+	0x2a, 0xae, 0x08, 0xfa, 0x02, 0x50, 0x00, 0x1e, 0xc4, 0x16, 0x06, 0xf8,
+	0x01, 0x52, 0x1d, 0x84, 0x17, 0xe4, 0xb5, 0xe6, 0x01, 0x04, 0x24, 0x01,
+	0xf1, 0x1e, 0x6f, 0x23, 0x43, 0x03, 0x0a, 0x26, 0x40, 0x30, 0x20, 0x93,
+	0x48, 0x43, 0x8c, 0x21, 0x4a, 0x86, 0x80, 0x00, 0x2d, 0x00, 0x2c, 0x71,
+	0x02, 0x0e, 0x8f, 0xff, 0x08, 0x45, 0x5f, 0x23, 0x00, 0x18, 0x42, 0x20,
+	0x1b, 0x01, 0xfe, 0x13, 0x80, 0x80, 0x6c, 0x70, 0x1a, 0x20, 0x8e, 0xd4,
+	0x06, 0x50, 0x2a, 0xf0, 0x1a, 0x26, 0x81, 0xd8, 0x03, 0xf1, 0x17, 0x10,
+	0x25, 0x78, 0x05, 0x20, 0x81, 0x03, 0x60, 0x40, 0x9a, 0x20, 0x04, 0x00,
+	0x25, 0x78, 0x1b, 0x78, 0x05, 0x20, 0x8f, 0x0f, 0x02, 0x90, 0x00, 0x00,
+	0x4a, 0x0e, 0xaf, 0xff, 0x00, 0x97, 0x63, 0x70, 0x0e, 0x7a, 0x5c, 0x78,
+	0x1c, 0x02, 0x00, 0xf4, 0x19, 0x00, 0x41, 0x1b, 0xd8, 0x61, 0xb8, 0x01,
+	0x08, 0x31, 0x00, 0x3d, 0x79, 0x64, 0x71, 0x38, 0x62, 0xc4, 0xb8, 0x31,
+	0x48, 0x44, 0x2a, 0x00, 0x08, 0x9a, 0x20, 0x01, 0x00, 0x25, 0x78, 0x00,
+	0xb7, 0xaf, 0x0b, 0xb4, 0x80, 0x55, 0x25, 0x00, 0x18, 0x9c, 0x00, 0xf1,
+	0x0a, 0xe2, 0xc2, 0xcb, 0x45, 0x04, 0x90, 0x06, 0x00, 0x20, 0xd8, 0x96,
+	0x0f, 0xe0, 0x00, 0x00, 0x1d, 0x45, 0x10, 0x00, 0x1d, 0x05, 0x10, 0xc2,
+	0xc6, 0xe6, 0x18, 0x00, 0xd0, 0xc6, 0x01, 0xc0, 0x95, 0xcb, 0xbe, 0x4f,
+	0x26, 0xcf, 0x12, 0x05, 0x26, 0x80, 0x8a, 0x03, 0xf0, 0x0a, 0x0c, 0xe0,
+	0xb5, 0x00, 0xb5, 0x6a, 0x0f, 0xe0, 0x00, 0x0a, 0xd8, 0xe0, 0xb5, 0x01,
+	0x95, 0xc0, 0xb5, 0xc9, 0xb8, 0xc6, 0xc6, 0xe2, 0xc1, 0xa1, 0xc1, 0x94,
+	0x00, 0xf3, 0x08, 0x80, 0x0f, 0x00, 0x90, 0x86, 0x00, 0x20, 0x90, 0x4c,
+	0x70, 0x6c, 0x70, 0x53, 0x21, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x30, 0x3d,
+	0x78, 0x1d, 0x02, 0x00, 0xf4, 0x35, 0xc4, 0xb8, 0x03, 0x1c, 0x02, 0x30,
+	0x13, 0xf0, 0x6c, 0x60, 0x2c, 0x71, 0x0c, 0x70, 0x04, 0xf0, 0xb9, 0x61,
+	0x9d, 0x7c, 0x04, 0x71, 0xfb, 0x08, 0x74, 0x81, 0x44, 0x24, 0x4d, 0x10,
+	0x2f, 0x78, 0x78, 0xd9, 0x05, 0x29, 0x01, 0x00, 0x4f, 0x78, 0x64, 0x71,
+	0x1a, 0x61, 0xdf, 0x0b, 0xb4, 0x80, 0x40, 0x24, 0x80, 0x30, 0x84, 0x22,
+	0x83, 0x0f, 0x5d, 0x78, 0xc2, 0xc5, 0xe0, 0x78, 0x01, 0x07, 0x6f, 0xff,
+	0x40, 0x40, 0x4c, 0x01, 0xf2, 0x1d, 0xa4, 0xc1, 0x00, 0x16, 0x1e, 0x71,
+	0x18, 0x90, 0xdc, 0x01, 0x01, 0x12, 0x8c, 0x30, 0x09, 0xc6, 0x78, 0x43,
+	0x6c, 0x70, 0x13, 0xf0, 0xcb, 0x43, 0x04, 0x90, 0x00, 0x02, 0x05, 0x27,
+	0xcd, 0x32, 0xa0, 0x95, 0x80, 0xc7, 0x7f, 0x67, 0x40, 0x23, 0x0b, 0x18,
+	0xa0, 0xaf, 0x10, 0x00, 0xf0, 0x47, 0x64, 0x71, 0x08, 0xe5, 0xa8, 0xaf,
+	0xe1, 0x0b, 0xb4, 0x81, 0x2f, 0x27, 0xc0, 0x30, 0x8c, 0xe4, 0x04, 0x03,
+	0x2d, 0x00, 0x8a, 0x23, 0x05, 0x02, 0x9d, 0x0b, 0x2e, 0x03, 0x6d, 0x74,
+	0x0f, 0x0c, 0x30, 0x12, 0x00, 0x1b, 0xc2, 0x32, 0x95, 0x76, 0xaf, 0xf4,
+	0xad, 0x71, 0x6c, 0x70, 0xa3, 0xae, 0xa2, 0xae, 0x61, 0xae, 0x60, 0xae,
+	0xed, 0x75, 0xcd, 0x73, 0x8d, 0x72, 0xe3, 0xa9, 0xc2, 0xa9, 0x81, 0xa9,
+	0x60, 0xa9, 0xc5, 0xaa, 0x83, 0xaa, 0xa2, 0xaa, 0x60, 0xaa, 0x20, 0xc1,
+	0x19, 0x61, 0x60, 0xa9, 0x01, 0x14, 0x81, 0x30, 0x08, 0x00, 0x11, 0x02,
+	0x08, 0x00, 0x33, 0x80, 0xa9, 0x03, 0x08, 0x00, 0x73, 0x21, 0xc1, 0x19,
+	0x61, 0x80, 0xa9, 0x05, 0x0e, 0x00, 0xb1, 0xa7, 0xa8, 0xa6, 0xa8, 0x22,
+	0xc1, 0x19, 0x61, 0xc0, 0xa9, 0x09, 0x12, 0x00, 0x31, 0xc0, 0xa9, 0x0a,
+	0x08, 0x00, 0x33, 0xe0, 0xa9, 0x0b, 0x08, 0x00, 0x73, 0x23, 0xc1, 0x19,
+	0x61, 0xe0, 0xa9, 0x0d, 0x0e, 0x00, 0xf1, 0x16, 0x0f, 0x18, 0xc2, 0x02,
+	0x69, 0x02, 0x20, 0x00, 0x0e, 0x18, 0xc2, 0x02, 0xc3, 0x43, 0x00, 0x00,
+	0x00, 0x14, 0x11, 0x23, 0x00, 0x83, 0x58, 0x02, 0x21, 0x00, 0xed, 0x71,
+	0x6c, 0x70, 0xe5, 0xae, 0xe4, 0xae, 0xe3, 0xae, 0x62, 0x9c, 0x00, 0xf0,
+	0x05, 0x0c, 0x26, 0x80, 0xbf, 0x00, 0x00, 0x08, 0x22, 0xad, 0x73, 0x6c,
+	0x72, 0x7c, 0xf4, 0x8d, 0x70, 0x00, 0x1b, 0x43, 0x31, 0x1e, 0x00, 0xf0,
+	0x25, 0xe2, 0xae, 0x81, 0xae, 0x80, 0xae, 0x0b, 0xde, 0x4a, 0x23, 0x80,
+	0x12, 0x4a, 0x26, 0x80, 0x31, 0xc4, 0xa9, 0x03, 0x19, 0xc2, 0x02, 0x02,
+	0x19, 0x82, 0x07, 0xa1, 0xa9, 0x80, 0xa9, 0x2c, 0x74, 0x2b, 0xaa, 0x2c,
+	0x70, 0xaa, 0xaa, 0x66, 0xaa, 0xe3, 0xaa, 0x20, 0xaa, 0x20, 0xc1, 0x3a,
+	0x60, 0x2c, 0x70, 0x20, 0xaa, 0xcc, 0x00, 0x02, 0x0a, 0x00, 0x02, 0xce,
+	0x00, 0x13, 0xa0, 0xce, 0x00, 0x20, 0xa0, 0xa9, 0xce, 0x00, 0x13, 0xa0,
+	0xce, 0x00, 0x71, 0xa0, 0xa9, 0x2c, 0x74, 0xe7, 0xa8, 0x26, 0xd0, 0x00,
+	0x42, 0x00, 0x19, 0x82, 0x07, 0xd2, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xd4,
+	0x00, 0x42, 0x00, 0x19, 0xc2, 0x02, 0xd6, 0x00, 0x20, 0xc0, 0xa9, 0xd6,
+	0x00, 0x13, 0xc0, 0xd6, 0x00, 0x00, 0x18, 0x00, 0x80, 0x0f, 0x18, 0xc3,
+	0x01, 0x79, 0xf0, 0x6c, 0x72, 0xa8, 0x00, 0x20, 0xc2, 0x30, 0xa2, 0x00,
+	0x9f, 0x61, 0xa9, 0x80, 0xa9, 0x8d, 0x71, 0x2c, 0x70, 0x82, 0x88, 0x00,
+	0x08, 0x13, 0x60, 0x88, 0x00, 0x11, 0x60, 0x88, 0x00, 0x13, 0x60, 0x88,
+	0x00, 0xf1, 0x2c, 0x60, 0xa9, 0x87, 0xa8, 0x86, 0xa8, 0xa2, 0xf0, 0x4a,
+	0x26, 0x00, 0x32, 0xa5, 0x0c, 0x31, 0x13, 0x4a, 0x23, 0xc0, 0x11, 0x8d,
+	0x76, 0x00, 0x1b, 0x02, 0x33, 0x05, 0x19, 0x82, 0x07, 0x04, 0x19, 0xc2,
+	0x02, 0x83, 0xa9, 0xa2, 0xa9, 0x61, 0xa9, 0xe0, 0xa9, 0x2c, 0x74, 0x08,
+	0x1a, 0x43, 0x01, 0x27, 0xaa, 0x2c, 0x70, 0xa6, 0xaa, 0x63, 0xaa, 0xe2,
+	0xaa, 0x21, 0xbc, 0x01, 0x13, 0xa0, 0xbc, 0x01, 0x2a, 0xe0, 0xa9, 0xee,
+	0x00, 0x0a, 0x66, 0x00, 0x00, 0x3e, 0x00, 0x44, 0x07, 0x18, 0x43, 0x02,
+	0xf0, 0x00, 0x2e, 0xc2, 0x02, 0xf0, 0x00, 0x22, 0x82, 0x07, 0xf0, 0x00,
+	0x00, 0x04, 0x01, 0x00, 0xf2, 0x00, 0x00, 0xea, 0x00, 0x02, 0xca, 0x01,
+	0xf2, 0x01, 0x80, 0xa9, 0x0f, 0x18, 0x83, 0x02, 0x0e, 0x18, 0x43, 0x01,
+	0x4e, 0xf0, 0x8d, 0x70, 0xe3, 0xae, 0x96, 0x01, 0x20, 0x8d, 0x74, 0xa6,
+	0x00, 0xf1, 0x06, 0x03, 0x19, 0x82, 0x07, 0x02, 0x19, 0xc2, 0x02, 0xa1,
+	0xa9, 0x60, 0xa9, 0x2c, 0x70, 0xa8, 0xaa, 0x67, 0xaa, 0xe3, 0xaa, 0x22,
+	0x9a, 0x00, 0x0c, 0x56, 0x02, 0x0a, 0x00, 0x01, 0x07, 0x88, 0x01, 0x43,
+	0x70, 0x27, 0xa8, 0xe6, 0x88, 0x01, 0x06, 0x98, 0x00, 0x2c, 0xc2, 0x02,
+	0x88, 0x01, 0x00, 0x90, 0x00, 0x02, 0x98, 0x00, 0x22, 0x82, 0x07, 0x98,
+	0x00, 0x00, 0xaa, 0x00, 0x84, 0x0f, 0x18, 0x43, 0x01, 0x0e, 0x18, 0x83,
+	0x01, 0xba, 0x0b, 0xc0, 0x5f, 0x21, 0x41, 0x06, 0x5f, 0x20, 0x80, 0x0c,
+	0x19, 0x61, 0x32, 0x21, 0x22, 0x08, 0xa4, 0x88, 0x06, 0xe0, 0x7f, 0xc6,
+	0xb8, 0xe0, 0x78, 0x14, 0x70, 0x94, 0x06, 0x00, 0x64, 0x09, 0xf0, 0x05,
+	0x68, 0x01, 0xc2, 0x21, 0x22, 0x02, 0x1a, 0x20, 0x80, 0x0f, 0x20, 0x00,
+	0x00, 0x00, 0x05, 0x79, 0xe0, 0x7f, 0x00, 0x91, 0x90, 0x03, 0xf2, 0x0f,
+	0x00, 0x16, 0x0d, 0x71, 0x04, 0x90, 0xc6, 0x01, 0xcb, 0x47, 0x05, 0x90,
+	0xc6, 0xe1, 0x0a, 0xd8, 0xc9, 0xbd, 0x4f, 0x25, 0xce, 0x12, 0x46, 0x0b,
+	0xe0, 0x00, 0xc0, 0xb7, 0x05, 0x25, 0x36, 0x04, 0x40, 0x00, 0xb7, 0x36,
+	0x0b, 0x34, 0x04, 0x31, 0x0a, 0xd8, 0x2e, 0x18, 0x00, 0xa0, 0x00, 0x16,
+	0x00, 0x71, 0x02, 0x90, 0xc8, 0x01, 0xa0, 0xb7, 0x40, 0x04, 0x02, 0x7c,
+	0x05, 0x44, 0xa7, 0xc1, 0x18, 0x43, 0x70, 0x00, 0x60, 0x44, 0xc1, 0x4c,
+	0x70, 0x46, 0xc0, 0x26, 0x06, 0xf0, 0x21, 0xd8, 0x07, 0x20, 0x80, 0x63,
+	0x40, 0x92, 0x0a, 0xa0, 0x00, 0x6c, 0x70, 0x0c, 0x70, 0x6a, 0x0c, 0x6f,
+	0xff, 0xff, 0xd9, 0x0c, 0x71, 0x08, 0x45, 0x44, 0x23, 0xc0, 0x37, 0x05,
+	0xe8, 0x61, 0xb8, 0xff, 0x08, 0x31, 0x80, 0xbb, 0x7d, 0xcd, 0x70, 0x53,
+	0x25, 0x40, 0x10, 0x45, 0xc0, 0x42, 0xc0, 0x94, 0x0d, 0xf0, 0x11, 0x09,
+	0xda, 0xff, 0xdb, 0x43, 0xc6, 0x41, 0xc6, 0x12, 0x0d, 0x6f, 0xff, 0x40,
+	0xc6, 0x5a, 0x25, 0x0d, 0x11, 0x2c, 0x70, 0x4c, 0x73, 0x22, 0xdb, 0x0f,
+	0x25, 0xc0, 0x16, 0x0f, 0x7d, 0x40, 0xd8, 0xdc, 0x07, 0xd1, 0x43, 0xc6,
+	0x42, 0xc5, 0xf2, 0x0c, 0x6f, 0xff, 0x04, 0x1c, 0xc1, 0x35, 0x4b, 0x12,
+	0x00, 0x60, 0x80, 0xd9, 0x17, 0xda, 0x6c, 0x74, 0x18, 0x00, 0xf1, 0x0a,
+	0xda, 0x0c, 0x6f, 0xff, 0x41, 0xc6, 0x0c, 0x70, 0x92, 0x0c, 0x6f, 0xff,
+	0x2c, 0x71, 0x52, 0x0c, 0xc0, 0x01, 0x7a, 0x0a, 0xe0, 0x00, 0x8a, 0x20,
+	0x10, 0x00, 0x0e, 0xc0, 0x40, 0x9c, 0xc2, 0x0a, 0xe0, 0x00, 0x08, 0xd9,
+	0x0c, 0x70, 0xda, 0x0b, 0x8e, 0x00, 0xe0, 0xcb, 0x47, 0x00, 0x00, 0x00,
+	0x12, 0xff, 0xd8, 0x08, 0xd9, 0x0d, 0xda, 0x20, 0xdb, 0x40, 0x00, 0xc0,
+	0x41, 0xc6, 0x9a, 0x0c, 0x6f, 0xff, 0x40, 0xc7, 0x56, 0x27, 0x00, 0x18,
+	0x6c, 0x00, 0x51, 0x88, 0xd9, 0x0d, 0xda, 0x08, 0x1a, 0x00, 0x13, 0x82,
+	0x5a, 0x00, 0x11, 0x3a, 0x5a, 0x00, 0x20, 0xcb, 0x46, 0x2c, 0x0d, 0xf0,
+	0x2f, 0xa0, 0x8e, 0x0e, 0xf0, 0x63, 0x40, 0x62, 0x0b, 0x20, 0x00, 0xe1,
+	0x41, 0x09, 0xe8, 0xe1, 0x40, 0xc6, 0x09, 0xe0, 0x01, 0x2c, 0x70, 0x04,
+	0xc1, 0xb4, 0x79, 0x00, 0xb1, 0xa5, 0x71, 0x41, 0x8e, 0xe7, 0x0a, 0x65,
+	0x83, 0xaf, 0x7f, 0xe0, 0x8e, 0x3c, 0xf0, 0x63, 0x40, 0x3e, 0x0b, 0x20,
+	0x00, 0xa1, 0x41, 0x34, 0xe8, 0xa1, 0x40, 0x9e, 0x09, 0xe0, 0x01, 0x10,
+	0xd9, 0x04, 0xc5, 0x12, 0x06, 0xf0, 0x00, 0xe1, 0x42, 0xf4, 0x7d, 0x20,
+	0x95, 0x25, 0x78, 0x00, 0xb5, 0x10, 0x78, 0xc3, 0x41, 0xe0, 0x96, 0x0c,
+	0x40, 0x0a, 0x2f, 0xff, 0x79, 0xa7, 0x01, 0xf0, 0x00, 0x16, 0x00, 0x71,
+	0x00, 0x80, 0x06, 0x00, 0x8c, 0x20, 0xc3, 0x81, 0x06, 0xf7, 0x0c, 0x71,
+	0xe0, 0x05, 0x71, 0x0e, 0xf0, 0x00, 0x95, 0x0f, 0x08, 0x95, 0xcc, 0x00,
+	0xf0, 0x3c, 0xff, 0xff, 0x05, 0xf0, 0x05, 0x2e, 0x00, 0x70, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0xb5, 0x10, 0x7b, 0x0c, 0x74, 0xc3, 0x41, 0xe1, 0x00,
+	0x02, 0x00, 0xc2, 0x0f, 0x6f, 0xff, 0xe1, 0x42, 0x41, 0x8e, 0xe5, 0x71,
+	0x8d, 0x0a, 0xe5, 0x83, 0xef, 0x7d, 0xa0, 0x8e, 0x10, 0xf0, 0xc2, 0x0a,
+	0x20, 0x00, 0x63, 0x40, 0x8a, 0xe8, 0x04, 0xc0, 0x0b, 0x0d, 0x3f, 0x10,
+	0xb4, 0x78, 0x21, 0x90, 0x03, 0xf0, 0xfe, 0x10, 0x01, 0x81, 0x20, 0xb0,
+	0x41, 0x8e, 0xa5, 0x71, 0xe3, 0xa6, 0x00, 0xf1, 0x01, 0x79, 0x60, 0x8e,
+	0x16, 0xf0, 0x06, 0xc1, 0xc3, 0x40, 0x02, 0x90, 0x5c, 0x01, 0x1a, 0x21,
+	0x81, 0x2a, 0x02, 0x60, 0xc0, 0x20, 0xa2, 0x00, 0x05, 0x79, 0xa8, 0x0d,
+	0x00, 0xca, 0x09, 0xf0, 0x07, 0x05, 0x79, 0x04, 0xc0, 0xf4, 0x20, 0xc0,
+	0x00, 0x64, 0x71, 0x00, 0xb1, 0xd7, 0x0a, 0xe5, 0x80, 0x77, 0x70, 0x0c,
+	0x70, 0x92, 0x0a, 0x48, 0x01, 0x60, 0x05, 0xc0, 0x2c, 0x70, 0x0a, 0xda,
+	0xc2, 0x01, 0xe0, 0x6c, 0x74, 0x28, 0x45, 0x43, 0xc1, 0x41, 0xc1, 0x52,
+	0x0b, 0x6f, 0xff, 0x40, 0xc1, 0xd2, 0x01, 0x80, 0x4c, 0x75, 0x6c, 0x76,
+	0x08, 0x46, 0x43, 0xc0, 0x30, 0x0f, 0x10, 0x3e, 0x16, 0x00, 0x10, 0xc5,
+	0x2e, 0x00, 0x13, 0x0e, 0x2e, 0x00, 0x51, 0x43, 0xc5, 0x41, 0xc5, 0x26,
+	0x16, 0x00, 0x40, 0xff, 0xd8, 0x80, 0xd9, 0x2c, 0x00, 0x01, 0x86, 0x01,
+	0x21, 0xc5, 0x12, 0x14, 0x00, 0x40, 0x0c, 0x70, 0xca, 0x0a, 0xc8, 0x01,
+	0x53, 0x8a, 0x0a, 0xc0, 0x01, 0xa7, 0xee, 0x07, 0x00, 0x18, 0x0d, 0xf0,
+	0x0f, 0x00, 0x43, 0x28, 0x43, 0x20, 0x40, 0x06, 0x0d, 0xef, 0xff, 0x60,
+	0x41, 0xb8, 0xe8, 0x6f, 0x24, 0xc3, 0x1d, 0x20, 0x8c, 0x69, 0x09, 0x1e,
+	0x00, 0x2f, 0x14, 0x80, 0x10, 0x5f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x35,
+	0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x26, 0x0e,
+	0x00, 0x00, 0xf1, 0x05, 0x81, 0x1c, 0xc0, 0xb8, 0x5f, 0x20, 0x40, 0x06,
+	0x38, 0x60, 0x32, 0x20, 0x80, 0x0f, 0x00, 0x80, 0x87, 0x06, 0x1d, 0x78,
+	0x02, 0x00, 0xf1, 0x04, 0x79, 0xc2, 0xb9, 0xf0, 0xd8, 0x05, 0x28, 0x41,
+	0x00, 0x05, 0xeb, 0x3c, 0x14, 0x80, 0x10, 0x02, 0xf0, 0x09, 0x8c, 0x18,
+	0x00, 0xf0, 0x12, 0x78, 0x1d, 0x78, 0x14, 0x70, 0x2f, 0x7b, 0xca, 0x20,
+	0x61, 0x00, 0x1b, 0x0b, 0x24, 0x00, 0x8a, 0x21, 0x04, 0x04, 0x05, 0x2b,
+	0x01, 0x00, 0x8a, 0x20, 0x0f, 0x0a, 0x2c, 0x78, 0x59, 0x61, 0x3b, 0x79,
+	0x34, 0x00, 0xf0, 0x07, 0x96, 0x0f, 0x20, 0x00, 0x30, 0x78, 0xd1, 0xc0,
+	0xe0, 0x7e, 0x00, 0x16, 0x00, 0x71, 0x00, 0x80, 0x22, 0x00, 0x14, 0x70,
+	0xe0, 0x7d, 0x0c, 0x00, 0xf2, 0x7d, 0x04, 0x90, 0x08, 0x00, 0xe0, 0x7e,
+	0xe0, 0x78, 0xe4, 0xc2, 0xc3, 0x43, 0x00, 0x80, 0xca, 0x07, 0x00, 0x8b,
+	0xea, 0x0d, 0x6f, 0xff, 0x2c, 0x71, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80,
+	0x04, 0x00, 0x82, 0x8b, 0x41, 0x8b, 0x1a, 0x21, 0x8d, 0x0f, 0x10, 0x00,
+	0x00, 0x00, 0x6c, 0x77, 0x1c, 0xf0, 0x1a, 0x22, 0x81, 0x0f, 0x00, 0x00,
+	0x00, 0x08, 0x04, 0x21, 0x8e, 0x0f, 0xfe, 0x37, 0x00, 0xf0, 0x55, 0x20,
+	0x01, 0x08, 0xa5, 0x79, 0xc5, 0x79, 0xc1, 0x6a, 0x9a, 0x22, 0x04, 0x00,
+	0x84, 0x22, 0x04, 0x00, 0x25, 0x7a, 0x5b, 0x79, 0x91, 0xb9, 0x9c, 0xb9,
+	0x9f, 0xb9, 0x20, 0x91, 0xc1, 0x42, 0x08, 0x21, 0xc3, 0x00, 0xcd, 0x0c,
+	0x85, 0x90, 0x60, 0x40, 0x08, 0xd9, 0x61, 0xb9, 0x01, 0x09, 0x31, 0x00,
+	0x1c, 0x78, 0x6f, 0x79, 0x79, 0x21, 0x01, 0x00, 0x38, 0x60, 0x04, 0x72,
+	0xc4, 0xc6, 0xc3, 0x40, 0x00, 0x80, 0xd8, 0x07, 0xbd, 0x07, 0x2f, 0xff,
+	0x00, 0x80, 0x0c, 0x00, 0xf0, 0x13, 0xc3, 0x42, 0x00, 0x80, 0xc9, 0x07,
+	0x20, 0x80, 0x00, 0x8a, 0x5f, 0x20, 0x80, 0x0c, 0x38, 0x60, 0x21, 0x8a,
+	0x5f, 0x21, 0x41, 0x06, 0x38, 0x60, 0x42, 0x88, 0x0c, 0x70, 0x75, 0x00,
+	0xef, 0xff, 0x2c, 0x70, 0x28, 0x00, 0xb2, 0xcb, 0x07, 0x81, 0x88, 0x60,
+	0x88, 0x22, 0xf0, 0x1a, 0x23, 0x80, 0x90, 0x00, 0x12, 0x20, 0x98, 0x00,
+	0x03, 0x10, 0x00, 0xf1, 0x1e, 0x10, 0x04, 0x20, 0x80, 0x0f, 0xfd, 0x6f,
+	0x00, 0xe0, 0x25, 0x78, 0x05, 0x20, 0x82, 0x0f, 0x02, 0x90, 0x64, 0x00,
+	0x20, 0x92, 0x28, 0x49, 0x8b, 0x20, 0x0f, 0x88, 0x06, 0xf2, 0x42, 0x21,
+	0x00, 0x04, 0x80, 0x20, 0x10, 0x00, 0x00, 0xb2, 0x64, 0x71, 0xc1, 0x0c,
+	0xc5, 0x90, 0x00, 0x01, 0xf0, 0x34, 0xc0, 0x08, 0x45, 0x9a, 0x25, 0x08,
+	0x10, 0xcb, 0x44, 0x0e, 0x90, 0x48, 0x00, 0x05, 0x25, 0x0e, 0x13, 0x20,
+	0xb6, 0x22, 0x6c, 0x05, 0x25, 0x4c, 0x10, 0x24, 0x72, 0x40, 0xb4, 0x05,
+	0x25, 0x42, 0x10, 0x60, 0xb2, 0x62, 0x69, 0x02, 0xc1, 0x65, 0x7d, 0x0f,
+	0x08, 0xf1, 0x03, 0x20, 0xb5, 0x8a, 0x20, 0xc7, 0x0f, 0x05, 0xf0, 0x7c,
+	0x13, 0x01, 0x01, 0x0f, 0x21, 0x00, 0x00, 0x7c, 0x1b, 0x04, 0x00, 0xc4,
+	0xc4, 0x3c, 0x00, 0xe0, 0xc2, 0x00, 0x02, 0x1c, 0x14, 0x10, 0x20, 0xb4,
+	0x41, 0xb4, 0xe0, 0x7f, 0x62, 0xb4, 0x58, 0x01, 0x40, 0x20, 0x43, 0x00,
+	0x41, 0xb2, 0x00, 0xf0, 0xff, 0x4a, 0xd0, 0x07, 0x00, 0x88, 0x06, 0x0f,
+	0x60, 0x00, 0x3c, 0x20, 0xc0, 0x00, 0x14, 0x70, 0x0c, 0x71, 0x27, 0xf4,
+	0x25, 0xde, 0x9f, 0xbe, 0x8d, 0x70, 0x1f, 0xf0, 0x04, 0xec, 0x33, 0x16,
+	0x82, 0x10, 0x03, 0xf0, 0x40, 0x8e, 0x31, 0x0a, 0x6e, 0x00, 0x14, 0x21,
+	0x02, 0x03, 0x32, 0x22, 0x8b, 0x0f, 0x00, 0x80, 0x84, 0x07, 0x4c, 0x70,
+	0x1d, 0x0a, 0xc5, 0x02, 0x5a, 0x24, 0x0d, 0x14, 0x36, 0x7d, 0x5d, 0x65,
+	0x32, 0x25, 0x8d, 0x1f, 0x00, 0x80, 0xa8, 0x07, 0xed, 0x0d, 0xe1, 0x90,
+	0x44, 0x71, 0x07, 0xf0, 0x85, 0x71, 0xc9, 0x0c, 0x94, 0x90, 0x0c, 0x70,
+	0xc4, 0xc6, 0xc4, 0xc6, 0x9a, 0x21, 0x10, 0x00, 0x1b, 0x78, 0x05, 0x20,
+	0x80, 0x0f, 0x03, 0x90, 0x64, 0xe0, 0x45, 0x21, 0xc1, 0x07, 0x79, 0x07,
+	0xe0, 0x00, 0x20, 0xb0, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa3, 0xc1,
+	0x4c, 0x70, 0x05, 0xf0, 0x00, 0x19, 0x05, 0x00, 0x44, 0x71, 0xfd, 0x0a,
+	0x74, 0x86, 0x14, 0x20, 0x81, 0x00, 0x32, 0xdb, 0x9f, 0xbb, 0x20, 0x8b,
+	0x21, 0xa8, 0x21, 0x6b, 0x40, 0xc1, 0x20, 0x89, 0x22, 0xa8, 0x00, 0xc1,
+	0x24, 0x71, 0x41, 0xc1, 0x20, 0x89, 0x23, 0xa8, 0x01, 0xc1, 0x24, 0x71,
+	0x42, 0xc1, 0x20, 0x89, 0x24, 0xa8, 0x02, 0xc1, 0x41, 0x69, 0x20, 0x8a,
+	0x40, 0x22, 0x5f, 0x00, 0x40, 0x27, 0x4c, 0x30, 0x2b, 0xa8, 0x00, 0x17,
+	0x81, 0x30, 0xa1, 0x6c, 0xc1, 0x6d, 0x2c, 0xa8, 0x20, 0x8c, 0xe1, 0x6e,
+	0x58, 0x43, 0x2d, 0xa8, 0x20, 0x8d, 0x2e, 0xa8, 0x20, 0x8e, 0x30, 0xa8,
+	0x20, 0x8f, 0x31, 0xa8, 0x21, 0x8f, 0x36, 0xa8, 0x22, 0x8f, 0x38, 0xa8,
+	0xe6, 0x13, 0x81, 0x80, 0x30, 0xe9, 0x4a, 0x26, 0x00, 0x30, 0x2a, 0xf0,
+	0x5a, 0x26, 0x82, 0x3c, 0x5a, 0x23, 0x41, 0x16, 0x65, 0x71, 0x1a, 0x62,
+	0x59, 0x61, 0x40, 0x8b, 0x41, 0xa9, 0x00, 0xc2, 0x40, 0x8a, 0x42, 0xa9,
+	0x01, 0xc2, 0x40, 0x8a, 0x43, 0xa9, 0x02, 0xc2, 0x40, 0x8a, 0x44, 0xa9,
+	0x00, 0x13, 0x82, 0x30, 0x4b, 0xa9, 0x00, 0x17, 0x82, 0x30, 0x4c, 0xa9,
+	0x40, 0x8c, 0x4d, 0xa9, 0x40, 0x8d, 0x4e, 0xa9, 0x40, 0x8e, 0x50, 0xa9,
+	0x40, 0x8f, 0x51, 0xa9, 0x41, 0x8f, 0x56, 0xa9, 0x42, 0x8f, 0x58, 0xa9,
+	0xb9, 0x0b, 0x94, 0x90, 0x40, 0x26, 0x5e, 0x30, 0xf9, 0x0e, 0xb4, 0xb0,
+	0x6d, 0x70, 0x8d, 0xf0, 0x3e, 0xda, 0x9f, 0xba, 0x01, 0x12, 0x81, 0x04,
+	0x3a, 0xa8, 0x06, 0x00, 0x11, 0x3b, 0x06, 0x00, 0x11, 0x3c, 0x06, 0x00,
+	0x11, 0x3d, 0x06, 0x00, 0x40, 0x24, 0x18, 0x42, 0x00, 0x1a, 0x00, 0x13,
+	0x25, 0x08, 0x00, 0x13, 0x26, 0x08, 0x00, 0x13, 0x27, 0x08, 0x00, 0x13,
+	0x29, 0x08, 0x00, 0x13, 0x2a, 0x08, 0x00, 0x93, 0x2f, 0x18, 0x42, 0x00,
+	0x1c, 0x12, 0x81, 0x04, 0x31, 0x10, 0x00, 0x13, 0x33, 0x08, 0x00, 0x13,
+	0x34, 0x08, 0x00, 0x13, 0x35, 0x08, 0x00, 0x13, 0x36, 0x08, 0x00, 0x13,
+	0x3d, 0x08, 0x00, 0x13, 0x3e, 0x08, 0x00, 0x13, 0x3f, 0x08, 0x00, 0x13,
+	0x40, 0x08, 0x00, 0x13, 0x42, 0x08, 0x00, 0x13, 0x43, 0x08, 0x00, 0x13,
+	0x48, 0x08, 0x00, 0x13, 0x4a, 0x08, 0x00, 0x13, 0x4c, 0x08, 0x00, 0x13,
+	0x4d, 0x08, 0x00, 0x13, 0x4e, 0x08, 0x00, 0x13, 0x4f, 0x08, 0x00, 0x13,
+	0x56, 0x08, 0x00, 0x13, 0x57, 0x08, 0x00, 0x13, 0x58, 0x08, 0x00, 0x13,
+	0x59, 0x08, 0x00, 0xf1, 0x60, 0x5b, 0x18, 0x42, 0x00, 0x20, 0x8a, 0x5c,
+	0x18, 0x42, 0x00, 0x21, 0x8a, 0x61, 0x18, 0x42, 0x00, 0x22, 0x8a, 0x63,
+	0x18, 0x42, 0x00, 0xa3, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xe0,
+	0x78, 0xe4, 0xc3, 0xab, 0xc1, 0x80, 0xc0, 0xc3, 0x41, 0x00, 0x80, 0x50,
+	0x06, 0x2e, 0x0c, 0xef, 0xfe, 0x2a, 0xda, 0x80, 0xc0, 0x2e, 0x09, 0xa0,
+	0x02, 0x2a, 0xd9, 0x25, 0xdd, 0x9f, 0xbd, 0x00, 0x8d, 0xcb, 0x46, 0x04,
+	0x90, 0xe4, 0x00, 0x00, 0xb6, 0x33, 0x15, 0x80, 0x10, 0x01, 0xb6, 0xf4,
+	0x15, 0x80, 0x90, 0x88, 0xe8, 0x00, 0x1e, 0x05, 0x70, 0x03, 0x90, 0x54,
+	0xe1, 0x42, 0x1e, 0x5d, 0x90, 0xda, 0x0b, 0xcf, 0xff, 0x53, 0x20, 0xc1,
+	0x00, 0x01, 0x1a, 0x42, 0x30, 0x1d, 0x79, 0x3d, 0x02, 0x00, 0x64, 0xc3,
+	0xb9, 0x02, 0x1a, 0x42, 0x30, 0xc8, 0x03, 0xf2, 0x1d, 0x1d, 0x78, 0xc1,
+	0xb8, 0xea, 0x0d, 0xe0, 0x01, 0x06, 0x1a, 0x02, 0x30, 0xce, 0x09, 0x00,
+	0x00, 0xb2, 0x08, 0xc0, 0x01, 0x4c, 0x16, 0x00, 0x91, 0x0d, 0x08, 0x51,
+	0x01, 0x00, 0x8d, 0x00, 0xb6, 0x01, 0xb6, 0xc4, 0xc7, 0xe0, 0x78, 0xe2,
+	0xc3, 0xbd, 0xc1, 0x08, 0x45, 0x8a, 0x00, 0xf2, 0x11, 0xad, 0x04, 0xa6,
+	0x0b, 0xef, 0xfe, 0x72, 0xda, 0x80, 0xc0, 0xa6, 0x08, 0xa0, 0x02, 0x72,
+	0xd9, 0x07, 0xed, 0x8a, 0x20, 0x07, 0x0c, 0x00, 0x1e, 0x04, 0x70, 0x03,
+	0x90, 0xc4, 0xe8, 0xc2, 0xc7, 0xac, 0x02, 0xf2, 0x41, 0xa7, 0xc1, 0xfa,
+	0x0b, 0xef, 0xff, 0x08, 0x47, 0x72, 0x0b, 0xef, 0xff, 0x46, 0xc0, 0xe2,
+	0x0b, 0xef, 0xff, 0x44, 0xc0, 0x45, 0xc0, 0xc3, 0x40, 0x00, 0x00, 0x10,
+	0x27, 0xe2, 0x0b, 0xa0, 0x00, 0x2c, 0x74, 0x08, 0x46, 0x0c, 0x70, 0xd6,
+	0x0c, 0x2f, 0xff, 0x1f, 0xd9, 0x00, 0xca, 0x2c, 0x70, 0xad, 0x70, 0x04,
+	0x76, 0x0f, 0x7b, 0xff, 0xd8, 0x8e, 0xb9, 0x4c, 0x75, 0x43, 0xc5, 0x42,
+	0xc7, 0x41, 0xc5, 0x92, 0x0d, 0x2f, 0xff, 0x40, 0xc5, 0xcf, 0x7b, 0xff,
+	0xd8, 0x2c, 0x70, 0x4c, 0x70, 0x14, 0x00, 0x11, 0x7e, 0x14, 0x00, 0x22,
+	0xcd, 0x71, 0x14, 0x00, 0x21, 0x7c, 0xdb, 0x16, 0x00, 0x21, 0xc6, 0x6a,
+	0x16, 0x00, 0xf1, 0x13, 0xae, 0x0f, 0x2f, 0xff, 0xff, 0xd8, 0xff, 0xd8,
+	0xc3, 0x41, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x72, 0x08, 0xdb, 0x43, 0xc6,
+	0x42, 0xc7, 0x41, 0xc6, 0x40, 0xc5, 0x4a, 0x0d, 0x2f, 0xff, 0x38, 0x43,
+	0x38, 0xf8, 0x2e, 0x00, 0x21, 0xc5, 0x3a, 0x2e, 0x00, 0x12, 0x35, 0x0e,
+	0x00, 0x21, 0xc6, 0x2e, 0x0e, 0x00, 0x46, 0xff, 0xd8, 0x63, 0x41, 0x32,
+	0x00, 0x11, 0x1a, 0x14, 0x00, 0x20, 0x06, 0xc0, 0x8a, 0x00, 0x80, 0x44,
+	0x20, 0x41, 0x00, 0x38, 0x60, 0x20, 0xe0, 0x9c, 0x00, 0x80, 0x2c, 0x70,
+	0x42, 0xc5, 0x41, 0xc5, 0xfa, 0x0c, 0x98, 0x00, 0x92, 0xff, 0xd8, 0x8a,
+	0x21, 0x10, 0x00, 0x4c, 0x71, 0x08, 0x84, 0x00, 0x21, 0xc5, 0xe6, 0x16,
+	0x00, 0xf0, 0x07, 0x05, 0xc1, 0x04, 0xc0, 0x4c, 0x71, 0x43, 0xc5, 0x14,
+	0x79, 0x54, 0x21, 0x80, 0x0c, 0xc0, 0xb8, 0x38, 0x60, 0x54, 0x20, 0x80,
+	0x0c, 0x3c, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x8e, 0x00, 0x11, 0xbe, 0x28,
+	0x00, 0xf0, 0x01, 0x0c, 0x70, 0x8e, 0xb8, 0x1b, 0x79, 0xff, 0xd8, 0x4c,
+	0x75, 0x6c, 0x72, 0x0c, 0x1c, 0xc1, 0x30, 0x58, 0x00, 0x11, 0xa2, 0x1a,
+	0x00, 0x01, 0xda, 0x00, 0x20, 0x75, 0x40, 0x56, 0x00, 0x41, 0xc5, 0x41,
+	0xc5, 0x8e, 0x14, 0x00, 0x20, 0xba, 0x0e, 0xda, 0x00, 0xa2, 0xc1, 0xbf,
+	0xff, 0xd8, 0x80, 0xd9, 0x4c, 0x76, 0x6c, 0x74, 0xc8, 0x00, 0x10, 0x72,
+	0x1c, 0x00, 0x25, 0xc6, 0xa7, 0x2c, 0x02, 0x03, 0x92, 0x00, 0x52, 0x72,
+	0x08, 0xdb, 0xe0, 0x7e, 0x84, 0x01, 0xb1, 0x00, 0x16, 0x01, 0x71, 0x04,
+	0x90, 0xe0, 0x01, 0x00, 0x16, 0x82, 0x06, 0x06, 0xf0, 0x11, 0x5f, 0x22,
+	0x00, 0x01, 0x44, 0x20, 0xc3, 0x07, 0x20, 0x40, 0x05, 0xeb, 0x61, 0xbb,
+	0xff, 0x0b, 0x31, 0x80, 0x1d, 0x78, 0xc3, 0xb8, 0x0b, 0x08, 0x90, 0x01,
+	0x77, 0x08, 0x71, 0x00, 0x18, 0xdf, 0x4e, 0x02, 0xf0, 0x09, 0x16, 0x01,
+	0x08, 0x1e, 0x94, 0x10, 0xad, 0x71, 0x02, 0x1e, 0x55, 0x10, 0x29, 0xd8,
+	0xa0, 0xb6, 0x6c, 0x1e, 0x05, 0x12, 0x6c, 0x1e, 0x04, 0x10, 0xb0, 0x05,
+	0xf0, 0x05, 0x98, 0x00, 0x80, 0x96, 0x28, 0x43, 0xf2, 0x1e, 0x44, 0x90,
+	0xfe, 0x09, 0xa0, 0x00, 0x66, 0x1e, 0x44, 0x10, 0xa9, 0xd8, 0x1c, 0x00,
+	0x42, 0x8a, 0x20, 0x46, 0x0a, 0x08, 0x00, 0x11, 0x44, 0x08, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0xea, 0x01, 0xf0, 0x07, 0x00, 0x60, 0x72, 0x1e, 0x5c,
+	0x93, 0xd0, 0x1e, 0x44, 0x93, 0x72, 0x1e, 0xdd, 0x90, 0x72, 0x09, 0xa0,
+	0x00, 0xd0, 0x1e, 0xc4, 0x92, 0x14, 0x00, 0xf0, 0x3d, 0x72, 0x1e, 0xdc,
+	0x92, 0x46, 0xf0, 0xcb, 0x45, 0x04, 0x90, 0x16, 0x01, 0x08, 0x1d, 0x94,
+	0x10, 0xcd, 0x71, 0x02, 0x1d, 0x55, 0x10, 0x4a, 0x23, 0x00, 0x12, 0x2c,
+	0x70, 0x8b, 0xbf, 0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42, 0xc0, 0xb5, 0x6c,
+	0x1d, 0xc4, 0x12, 0x0a, 0x26, 0x40, 0x30, 0xf2, 0x1d, 0x44, 0x90, 0x66,
+	0x1d, 0x44, 0x10, 0x6c, 0x1d, 0xc4, 0x13, 0x86, 0x09, 0xa0, 0x00, 0x18,
+	0x43, 0x70, 0xbf, 0x2f, 0x20, 0xc2, 0x06, 0x2c, 0x70, 0x76, 0x09, 0xa0,
+	0x00, 0x16, 0x00, 0x20, 0xc3, 0x40, 0x9c, 0x00, 0x32, 0x2c, 0x70, 0x66,
+	0x10, 0x00, 0x72, 0x12, 0x88, 0xd8, 0x6c, 0x1d, 0x04, 0x10, 0x84, 0x00,
+	0x00, 0x46, 0x00, 0xf0, 0x09, 0x6c, 0x1d, 0x84, 0x17, 0x72, 0x1d, 0x9c,
+	0x93, 0xd0, 0x1d, 0x84, 0x93, 0x72, 0x1d, 0xdd, 0x90, 0xe6, 0x08, 0xa0,
+	0x00, 0xd0, 0x1d, 0x84, 0x97, 0x14, 0x00, 0xc0, 0x72, 0x1d, 0x9c, 0x97,
+	0x0c, 0x70, 0x2e, 0x09, 0xa0, 0x00, 0x20, 0xd9, 0x92, 0x00, 0xf1, 0x00,
+	0xf0, 0x01, 0x20, 0xd8, 0xc6, 0x08, 0xa0, 0x00, 0x00, 0x1d, 0x05, 0x10,
+	0x20, 0xd8, 0xbe, 0x0a, 0x00, 0x51, 0x45, 0x10, 0x0c, 0x74, 0xb2, 0x0a,
+	0x00, 0x64, 0x05, 0x10, 0x0a, 0x1d, 0x9d, 0x90, 0xa0, 0x03, 0xc0, 0x88,
+	0x20, 0x01, 0x09, 0x89, 0x20, 0x06, 0x09, 0x80, 0x20, 0x8e, 0x07, 0xc8,
+	0x07, 0xf1, 0x0e, 0x09, 0x00, 0x20, 0x00, 0x0f, 0x78, 0xe0, 0x78, 0x0b,
+	0x08, 0xf4, 0x08, 0x00, 0x41, 0x7e, 0xb9, 0x86, 0xb9, 0xe0, 0x7f, 0x2f,
+	0x78, 0xe0, 0x78, 0xe6, 0xc3, 0xaa, 0xc1, 0xcd, 0xf2, 0x06, 0x40, 0xc9,
+	0x07, 0xcd, 0xa8, 0x48, 0x06, 0x33, 0xc9, 0x07, 0xcc, 0x08, 0x00, 0x13,
+	0xcb, 0x08, 0x00, 0xf2, 0x09, 0xca, 0xa8, 0xc3, 0x41, 0x89, 0x00, 0x00,
+	0x00, 0x82, 0x0e, 0x2f, 0xff, 0x0a, 0xd8, 0x3b, 0x02, 0x00, 0x00, 0x44,
+	0x26, 0xc1, 0x17, 0x06, 0xe9, 0x70, 0x07, 0xf2, 0x0b, 0x1b, 0x78, 0xe4,
+	0x1b, 0x00, 0xb0, 0x11, 0x02, 0x20, 0x00, 0x2c, 0x70, 0x00, 0x16, 0x80,
+	0x70, 0x00, 0x80, 0x1b, 0x00, 0x1f, 0x08, 0x5e, 0x00, 0x07, 0xea, 0x0e,
+	0x00, 0x42, 0x7d, 0x00, 0x05, 0xf0, 0x0a, 0x00, 0xf2, 0x0b, 0x4a, 0x00,
+	0x10, 0x76, 0xf3, 0xf4, 0xcf, 0x78, 0xf0, 0x1b, 0x00, 0xb0, 0xf0, 0x13,
+	0x01, 0xb0, 0x62, 0x0c, 0xaf, 0xff, 0x40, 0x40, 0x08, 0x45, 0x0b, 0xea,
+	0x0e, 0x08, 0xe2, 0x58, 0x00, 0xe4, 0x13, 0x00, 0xb0, 0x2b, 0x78, 0x2c,
+	0x71, 0x0c, 0xf4, 0xdf, 0xf0, 0x14, 0x00, 0x14, 0x25, 0x14, 0x00, 0xf0,
+	0x08, 0x70, 0xd7, 0xf2, 0x0c, 0x71, 0xc4, 0xba, 0x05, 0xea, 0x61, 0xba,
+	0xff, 0x0a, 0x31, 0x80, 0x1b, 0x78, 0x4e, 0x0a, 0x6f, 0xff, 0x0f, 0x78,
+	0x32, 0x00, 0xf1, 0x10, 0xa1, 0x41, 0x00, 0x1e, 0x43, 0x70, 0x00, 0x80,
+	0xe0, 0x06, 0x0f, 0x78, 0x06, 0x0b, 0x6f, 0xff, 0xe8, 0x1b, 0x00, 0xb0,
+	0x2c, 0x70, 0x54, 0xd8, 0xe0, 0x1b, 0x40, 0xb0, 0x00, 0x1e, 0x42, 0x1a,
+	0x00, 0xf2, 0x1d, 0xfc, 0x1b, 0x00, 0xb7, 0x02, 0x24, 0x1c, 0x30, 0x82,
+	0xc0, 0x9a, 0x0f, 0xaf, 0xfe, 0xec, 0x1b, 0x00, 0xb0, 0x05, 0xf0, 0x01,
+	0x18, 0x13, 0x00, 0x24, 0x71, 0xd0, 0xe1, 0xfc, 0xf7, 0xad, 0x70, 0x41,
+	0xf0, 0xea, 0x0e, 0xef, 0xff, 0xaf, 0x78, 0xf4, 0x1b, 0x00, 0xb0, 0x7a,
+	0x00, 0xf0, 0x13, 0xc9, 0x07, 0xe8, 0x13, 0x00, 0xb0, 0xf4, 0x13, 0x02,
+	0xb0, 0x56, 0x0e, 0x20, 0x00, 0xf8, 0x1b, 0x01, 0xb0, 0xc3, 0x40, 0x03,
+	0x00, 0x90, 0xd0, 0x9e, 0x0f, 0x60, 0x00, 0x2c, 0x70, 0x4a, 0x08, 0x2f,
+	0xff, 0x20, 0x00, 0xf0, 0x0e, 0xf0, 0x13, 0x00, 0xb0, 0x42, 0x23, 0x01,
+	0x32, 0x5e, 0x08, 0xef, 0xfe, 0x4c, 0x72, 0xf8, 0x13, 0x00, 0xb0, 0xc3,
+	0x41, 0x8a, 0x00, 0x04, 0x00, 0xc1, 0x43, 0x04, 0x20, 0x8f, 0x3a, 0x08,
+	0x12, 0x3f, 0xfc, 0x00, 0xa0, 0xc9, 0x07, 0xf8, 0x1b, 0xc0, 0xb3, 0x41,
+	0xc7, 0x40, 0xc0, 0x52, 0x00, 0x00, 0xea, 0x03, 0xf0, 0x11, 0x0c, 0x74,
+	0x06, 0xef, 0xec, 0x13, 0x00, 0xb0, 0xb8, 0x60, 0x00, 0x18, 0x43, 0x00,
+	0xa5, 0x71, 0xd0, 0xe5, 0x7e, 0x07, 0xee, 0xff, 0x4c, 0x77, 0x48, 0x45,
+	0x48, 0x47, 0x40, 0x41, 0x22, 0xf0, 0x1c, 0x00, 0x40, 0x01, 0x10, 0x83,
+	0x04, 0xac, 0x00, 0xc0, 0x12, 0xf2, 0xe0, 0x13, 0x00, 0xb0, 0xd0, 0xe0,
+	0x03, 0xf2, 0x11, 0xeb, 0x0a, 0x00, 0xf0, 0x0d, 0xb4, 0x4f, 0x04, 0x77,
+	0x33, 0x48, 0x91, 0x73, 0xca, 0x27, 0x09, 0x10, 0xca, 0x25, 0x49, 0x10,
+	0x03, 0xf0, 0x03, 0xeb, 0x2c, 0x77, 0x03, 0xf0, 0xe0, 0x13, 0x01, 0xb0,
+	0x20, 0x00, 0x51, 0x04, 0x71, 0xe0, 0x1b, 0x00, 0x0a, 0x00, 0xf0, 0x19,
+	0xd1, 0xe0, 0xba, 0x07, 0xe5, 0xff, 0x34, 0x77, 0x39, 0x21, 0x83, 0x00,
+	0x38, 0x25, 0x80, 0x10, 0x6b, 0x78, 0x50, 0xd8, 0x3c, 0x75, 0x1c, 0x77,
+	0xb5, 0x77, 0x0c, 0x70, 0x04, 0xf2, 0xb0, 0x4f, 0x7f, 0x20, 0x00, 0x01,
+	0x00, 0x16, 0x83, 0x70, 0x14, 0x09, 0xf4, 0x09, 0xc3, 0x41, 0x8c, 0x00,
+	0x02, 0x00, 0x32, 0x0f, 0xaf, 0xfe, 0xc1, 0x42, 0xb8, 0x67, 0x44, 0x28,
+	0x80, 0x00, 0xd6, 0x0d, 0xef, 0xff, 0x0f, 0x78, 0x5e, 0x01, 0x04, 0x18,
+	0x01, 0x80, 0x14, 0x26, 0x41, 0x10, 0x00, 0x21, 0x81, 0x0f, 0x34, 0x00,
+	0x51, 0x0a, 0xa9, 0xda, 0x0c, 0x6f, 0x0a, 0x01, 0x35, 0xfc, 0x13, 0x1c,
+	0x3a, 0x01, 0x62, 0x24, 0x71, 0x2f, 0x7a, 0x54, 0x71, 0x7c, 0x01, 0xf2,
+	0x01, 0xc9, 0x07, 0xea, 0x05, 0xce, 0xff, 0xc5, 0x71, 0xd5, 0x72, 0xca,
+	0x05, 0xe5, 0xff, 0x0c, 0x71, 0x64, 0x02, 0x82, 0x0e, 0x18, 0x43, 0x00,
+	0xc6, 0xc7, 0xe0, 0x78, 0x10, 0x04, 0xf0, 0x05, 0xbd, 0xc1, 0x25, 0xd9,
+	0x9f, 0xb9, 0x00, 0x89, 0x3a, 0x1c, 0x02, 0x30, 0x33, 0x11, 0x80, 0x00,
+	0x3b, 0x1c, 0x02, 0x30, 0x28, 0x00, 0xf0, 0x46, 0xc8, 0x07, 0x27, 0x88,
+	0xa0, 0x88, 0x6e, 0xc1, 0x29, 0x88, 0x39, 0x1c, 0x42, 0x30, 0x28, 0x88,
+	0x36, 0x1c, 0x42, 0x30, 0x2a, 0x88, 0x0c, 0x71, 0x37, 0x1c, 0x42, 0x30,
+	0x46, 0x0e, 0x20, 0x00, 0x93, 0xc1, 0x2c, 0x70, 0x46, 0xc1, 0x05, 0xf0,
+	0x34, 0x7a, 0x0c, 0x70, 0x00, 0xb2, 0x24, 0x71, 0xfb, 0x09, 0xb4, 0x82,
+	0x98, 0xc2, 0x0c, 0xd9, 0x05, 0x29, 0x41, 0x03, 0x0c, 0x74, 0x35, 0x78,
+	0x49, 0xc0, 0x0d, 0x04, 0x20, 0x00, 0x0c, 0x70, 0xff, 0x03, 0x20, 0x00,
+	0x6f, 0x70, 0x05, 0xc0, 0x2c, 0x71, 0x44, 0x20, 0xc2, 0x66, 0x04, 0x16,
+	0xc1, 0x48, 0x02, 0xe0, 0x47, 0xc0, 0x2f, 0x20, 0xc7, 0x06, 0xca, 0x0d,
+	0x20, 0x00, 0x2f, 0x79, 0xcb, 0x46, 0x46, 0x02, 0x82, 0x48, 0xc0, 0x00,
+	0x8e, 0x14, 0x70, 0xf6, 0xf2, 0xba, 0x01, 0xf1, 0x15, 0x01, 0x00, 0xe3,
+	0xb8, 0xf0, 0xf4, 0xb6, 0x0a, 0x4f, 0xff, 0xed, 0x70, 0x0c, 0x70, 0x7e,
+	0xf0, 0x04, 0xc0, 0x79, 0x20, 0x80, 0x00, 0x04, 0x77, 0x4a, 0xc0, 0x04,
+	0xc0, 0x82, 0xb8, 0x15, 0x08, 0x31, 0x01, 0xff, 0xd9, 0xd0, 0x03, 0xf0,
+	0x16, 0x0a, 0xa2, 0x0e, 0xcf, 0xfe, 0xc2, 0x0e, 0x80, 0x01, 0x01, 0x8e,
+	0xad, 0x71, 0x2c, 0x70, 0x43, 0xc0, 0x07, 0xc0, 0x4c, 0x70, 0x6c, 0x72,
+	0x0f, 0x78, 0x4b, 0xc0, 0x42, 0xc0, 0x0a, 0xc0, 0x41, 0xc5, 0x0f, 0x78,
+	0x4c, 0xc0, 0x8c, 0x03, 0xf0, 0x03, 0x44, 0x20, 0x00, 0x08, 0x45, 0x20,
+	0x80, 0x01, 0x40, 0xc0, 0x4a, 0x0f, 0xef, 0xfe, 0xff, 0xd8, 0x01, 0x8e,
+	0x56, 0x06, 0x40, 0x43, 0xc0, 0x04, 0xc0, 0x50, 0x06, 0x22, 0x6c, 0x72,
+	0x9a, 0x0b, 0x73, 0x48, 0x04, 0xc5, 0xb8, 0x40, 0xc0, 0x26, 0x22, 0x00,
+	0x00, 0x1a, 0x00, 0xe3, 0x43, 0xc0, 0x0b, 0xc0, 0x6c, 0x72, 0x41, 0xc5,
+	0x42, 0xc0, 0x0c, 0xc0, 0x1d, 0x78, 0x46, 0x00, 0x49, 0x05, 0x40, 0xc0,
+	0x02, 0x24, 0x00, 0x60, 0x0a, 0xc0, 0x6c, 0x72, 0x42, 0xc7, 0x3c, 0x00,
+	0x80, 0xff, 0xd8, 0xea, 0x0e, 0xef, 0xfe, 0x41, 0xc5, 0x9e, 0x00, 0x80,
+	0x10, 0x27, 0x06, 0x0d, 0x60, 0x00, 0x0a, 0xd9, 0x80, 0x00, 0xf2, 0x04,
+	0x04, 0x77, 0x0f, 0x7d, 0xdd, 0xf8, 0x42, 0xc7, 0x41, 0xc7, 0x40, 0xc7,
+	0xc6, 0x0e, 0xef, 0xfe, 0x43, 0xc5, 0xda, 0x74, 0x06, 0xf4, 0x1a, 0xc7,
+	0xba, 0x0e, 0xef, 0xfe, 0x40, 0xc7, 0x04, 0xc0, 0x63, 0xb8, 0x11, 0x08,
+	0x95, 0x00, 0x9e, 0x0d, 0x80, 0x01, 0x0c, 0x70, 0x66, 0x0e, 0xef, 0xfe,
+	0x2c, 0x71, 0x04, 0xc0, 0x04, 0x71, 0x44, 0xc0, 0x04, 0xc0, 0x14, 0x75,
+	0x02, 0x07, 0xe5, 0xff, 0xf2, 0x00, 0x60, 0xb2, 0x0d, 0xcf, 0xfe, 0xd2,
+	0x0d, 0xf2, 0x00, 0xf0, 0x04, 0x2c, 0x70, 0xed, 0x71, 0x43, 0xc0, 0xff,
+	0xd8, 0x4c, 0x70, 0x18, 0xdb, 0x28, 0x45, 0x42, 0xc1, 0x41, 0xc7, 0x6e,
+	0x4c, 0x00, 0x30, 0xc1, 0xb2, 0x08, 0x22, 0x06, 0x22, 0x01, 0x8e, 0xc0,
+	0x00, 0x10, 0x07, 0xc0, 0x00, 0xd2, 0xc7, 0x0f, 0x78, 0x44, 0xc0, 0x42,
+	0xc0, 0x20, 0xd8, 0x40, 0xc0, 0x4a, 0x0e, 0x00, 0x01, 0x02, 0x1e, 0x00,
+	0xf4, 0x01, 0xff, 0xd8, 0x6c, 0x72, 0x42, 0xc5, 0x41, 0xc7, 0x32, 0x0e,
+	0xef, 0xfe, 0x00, 0x1c, 0xc1, 0x30, 0x36, 0x00, 0x11, 0x04, 0x36, 0x00,
+	0x51, 0x42, 0xc0, 0xff, 0xd8, 0x1a, 0x1a, 0x00, 0x24, 0x81, 0x34, 0x1a,
+	0x00, 0x04, 0x32, 0x00, 0x10, 0x02, 0x6c, 0x00, 0x16, 0xc5, 0x16, 0x00,
+	0x20, 0x08, 0xdb, 0x48, 0x00, 0x79, 0xea, 0x0d, 0xef, 0xfe, 0x40, 0xc5,
+	0x16, 0x82, 0x00, 0x31, 0xff, 0xd8, 0x18, 0x1c, 0x00, 0x11, 0xce, 0x1c,
+	0x00, 0xf0, 0x17, 0xbe, 0x0c, 0x80, 0x01, 0x7f, 0xf0, 0x0c, 0x70, 0xea,
+	0x0c, 0xef, 0xfe, 0xff, 0xd9, 0x07, 0xc0, 0xad, 0x70, 0x4c, 0x73, 0x5a,
+	0x20, 0x01, 0x01, 0x22, 0xdb, 0x43, 0xc5, 0x40, 0xc5, 0x25, 0x78, 0x0f,
+	0x7e, 0x20, 0xd8, 0x41, 0xc0, 0xfa, 0x06, 0xb0, 0xae, 0x0f, 0xef, 0xfe,
+	0x42, 0xc6, 0x28, 0xd8, 0x41, 0xc0, 0x8c, 0x2c, 0x01, 0x30, 0xc6, 0x9e,
+	0x0f, 0x5c, 0x00, 0x11, 0x89, 0x0c, 0x00, 0x50, 0x04, 0x1c, 0xc1, 0x33,
+	0x8e, 0x10, 0x00, 0x23, 0xc0, 0x85, 0x10, 0x00, 0x30, 0x01, 0x35, 0x7e,
+	0x10, 0x00, 0x11, 0xc5, 0x18, 0x07, 0x10, 0x73, 0x4e, 0x00, 0x71, 0x42,
+	0xc6, 0x04, 0x1c, 0x81, 0x30, 0x6a, 0x16, 0x00, 0x40, 0x0c, 0x70, 0x12,
+	0x0d, 0x54, 0x01, 0x02, 0x60, 0x02, 0xf1, 0x14, 0x04, 0x00, 0xe0, 0xda,
+	0x1a, 0x20, 0x81, 0x0f, 0x20, 0x00, 0x00, 0x00, 0xc3, 0x40, 0x08, 0x90,
+	0x00, 0x01, 0x05, 0x21, 0x03, 0x00, 0x04, 0x72, 0x25, 0x78, 0x40, 0xb3,
+	0x00, 0x18, 0x85, 0x04, 0x0c, 0x70, 0x4a, 0x9e, 0x00, 0x00, 0x3c, 0x00,
+	0xa0, 0xff, 0xd8, 0x07, 0xc0, 0x2c, 0x70, 0x90, 0xb9, 0x0f, 0x78, 0x0e,
+	0x01, 0x20, 0x4c, 0x71, 0x72, 0x07, 0x31, 0x41, 0xc5, 0x02, 0xcc, 0x00,
+	0x80, 0x0c, 0xd9, 0xff, 0xd8, 0x8d, 0xb9, 0x4c, 0x73, 0x14, 0x00, 0x60,
+	0x42, 0xc6, 0x41, 0xc5, 0xee, 0x0c, 0xa2, 0x00, 0x11, 0x16, 0x1c, 0x02,
+	0x01, 0x88, 0x00, 0x11, 0x75, 0x1a, 0x00, 0x41, 0xc5, 0x41, 0xc5, 0xd2,
+	0x1a, 0x00, 0xf1, 0x39, 0x50, 0xd8, 0x49, 0xc0, 0x8a, 0x21, 0xc7, 0x0f,
+	0xc3, 0x40, 0x03, 0x90, 0x48, 0xe0, 0x20, 0xb0, 0x04, 0x18, 0x05, 0x00,
+	0x40, 0x24, 0x80, 0x3e, 0x32, 0x20, 0xc1, 0x06, 0x07, 0xc0, 0x2b, 0x78,
+	0x64, 0xf2, 0x09, 0xc0, 0x2c, 0x70, 0x66, 0x0c, 0xef, 0xfe, 0x10, 0x78,
+	0x0c, 0x70, 0xa6, 0x0a, 0x60, 0x00, 0x1e, 0xd9, 0x40, 0x24, 0x80, 0x3d,
+	0x32, 0x20, 0xcb, 0x06, 0x8e, 0xc0, 0x32, 0x20, 0xcd, 0x06, 0xa1, 0x41,
+	0x0f, 0xf0, 0x1a, 0x21, 0x20, 0x0d, 0x50, 0x20, 0x34, 0x7a, 0x24, 0x71,
+	0x1e, 0x0c, 0xf0, 0x01, 0x02, 0x90, 0x54, 0x00, 0x00, 0x90, 0x0f, 0x78,
+	0x00, 0xb2, 0xe9, 0x0b, 0x65, 0x90, 0x8f, 0xc2, 0xda, 0x01, 0xf1, 0x14,
+	0x34, 0xf0, 0xf4, 0x23, 0x4c, 0x03, 0x08, 0xc0, 0xb4, 0x7b, 0x80, 0xbc,
+	0x80, 0xb3, 0x86, 0xe8, 0x8f, 0xc0, 0xf4, 0x20, 0x40, 0x03, 0x0f, 0xe8,
+	0x5a, 0x23, 0x0e, 0x34, 0x05, 0xc0, 0x16, 0x7e, 0x38, 0x66, 0x00, 0x8c,
+	0x0e, 0x95, 0xa8, 0x07, 0xa0, 0xa8, 0x24, 0x71, 0x08, 0xc0, 0x17, 0x1a,
+	0x00, 0x13, 0x58, 0x1a, 0x00, 0xf2, 0x0d, 0x88, 0x07, 0xa0, 0xa8, 0x44,
+	0x71, 0x08, 0xc0, 0x8f, 0xe8, 0x05, 0xc0, 0x79, 0x20, 0x00, 0x00, 0x1b,
+	0x78, 0x1b, 0x78, 0x04, 0x74, 0x05, 0x7c, 0x80, 0xb3, 0x05, 0xf0, 0x4e,
+	0x00, 0xa0, 0x67, 0xe8, 0xa5, 0x71, 0x9b, 0x0b, 0x65, 0x93, 0x98, 0xc3,
+	0xee, 0x02, 0xf2, 0x1b, 0xc4, 0x09, 0x96, 0x0b, 0xcf, 0xfe, 0x06, 0x0b,
+	0xcf, 0xfe, 0x67, 0x71, 0x77, 0x72, 0x08, 0x04, 0xc5, 0xff, 0x05, 0xc0,
+	0x04, 0x71, 0x45, 0xc0, 0x05, 0xc0, 0x14, 0x71, 0xf6, 0x03, 0xce, 0xff,
+	0x1a, 0xf0, 0x06, 0xc0, 0xf4, 0x21, 0x01, 0x00, 0x13, 0xe9, 0x84, 0x01,
+	0xb0, 0x19, 0x00, 0x8d, 0xe8, 0x06, 0xc0, 0x44, 0x21, 0x01, 0x03, 0x1a,
+	0x8a, 0x00, 0x33, 0x00, 0x00, 0x20, 0xcc, 0x00, 0xf0, 0x02, 0x01, 0x20,
+	0xb0, 0x06, 0xc0, 0x04, 0x71, 0x46, 0xc0, 0x06, 0xc0, 0xd1, 0x08, 0xb4,
+	0x82, 0x98, 0xc1, 0x96, 0x04, 0x62, 0xe0, 0x06, 0x00, 0x88, 0x08, 0xe8,
+	0x3a, 0x00, 0x00, 0x1e, 0x04, 0x62, 0x9c, 0x08, 0x41, 0xff, 0x0c, 0x70,
+	0xde, 0x0a, 0x40, 0x48, 0xe0, 0xae, 0x09, 0x98, 0x04, 0x13, 0xbd, 0xfe,
+	0x08, 0x00, 0x3c, 0x02, 0x40, 0x4c, 0x73, 0x22, 0xdb, 0x04, 0x0e, 0x01,
+	0x0c, 0x00, 0x30, 0x70, 0x6c, 0x72, 0x0c, 0x00, 0x02, 0xf8, 0x04, 0xf0,
+	0x05, 0xa3, 0xc1, 0x48, 0x46, 0x38, 0x43, 0x08, 0x47, 0x0c, 0x70, 0x31,
+	0xf0, 0x5f, 0x23, 0x01, 0x34, 0x00, 0xc0, 0x56, 0x79, 0x9a, 0x0f, 0x00,
+	0x5c, 0x05, 0xf5, 0x02, 0xa8, 0x07, 0xc1, 0x40, 0xfe, 0x0a, 0xa0, 0x01,
+	0x28, 0x43, 0x08, 0x45, 0x1a, 0x23, 0x80, 0x1f, 0x00, 0x96, 0x00, 0xf0,
+	0x01, 0x50, 0x00, 0x42, 0xc0, 0x4f, 0x25, 0x80, 0x12, 0x41, 0xc0, 0x01,
+	0xc1, 0x02, 0xc0, 0x20, 0xb0, 0xf2, 0x00, 0x40, 0xb8, 0x0b, 0x06, 0x09,
+	0x98, 0x06, 0xf0, 0x11, 0x0c, 0x70, 0x07, 0xf0, 0x02, 0xc1, 0x04, 0x71,
+	0x40, 0xb1, 0x01, 0xc2, 0x40, 0xb1, 0xf9, 0x08, 0xb4, 0x80, 0x4f, 0x25,
+	0x42, 0x12, 0x00, 0xc0, 0x04, 0x71, 0x79, 0x27, 0x42, 0x10, 0x40, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0xb1, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18,
+	0x60, 0x40, 0x82, 0xa2, 0x0e, 0x00, 0x00, 0xf0, 0x51, 0x14, 0x22, 0xc0,
+	0x06, 0x32, 0x20, 0x81, 0x0f, 0x00, 0x80, 0x84, 0x07, 0x00, 0xc0, 0x8f,
+	0x08, 0x44, 0x80, 0xa3, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xe0,
+	0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa2, 0xc1, 0x28, 0x47, 0x08,
+	0x46, 0x20, 0x40, 0x2c, 0x73, 0x41, 0xc3, 0xbe, 0x0d, 0x60, 0x01, 0x58,
+	0x43, 0x0c, 0x71, 0x08, 0x45, 0x44, 0x26, 0xc0, 0x17, 0x05, 0xe8, 0x61,
+	0xb8, 0xff, 0x08, 0x31, 0x80, 0xbb, 0x7d, 0x15, 0x0b, 0x31, 0x30, 0x5a,
+	0x25, 0x0d, 0x11, 0xe1, 0x40, 0x2c, 0x73, 0x36, 0x0d, 0xef, 0xfe, 0xbf,
+	0xda, 0x01, 0xc0, 0x0f, 0x25, 0x9b, 0x13, 0x87, 0xe8, 0x12, 0x00, 0xf5,
+	0x2f, 0x22, 0x0d, 0xef, 0xfe, 0x7f, 0xda, 0x00, 0x16, 0x80, 0x70, 0x00,
+	0x80, 0xc9, 0x07, 0x5f, 0x26, 0x4d, 0x16, 0x4c, 0x70, 0x5f, 0x20, 0x80,
+	0x0c, 0x8a, 0x23, 0xff, 0x0d, 0x00, 0x1c, 0xc1, 0x3f, 0xf8, 0x60, 0xb9,
+	0x60, 0xb6, 0x0f, 0xe0, 0x01, 0x2f, 0x20, 0xc7, 0x06, 0x62, 0x08, 0x8f,
+	0xff, 0x6a, 0x08, 0xaf, 0xff, 0x00, 0x43, 0x00, 0x41, 0xb6, 0x0d, 0x60,
+	0x01, 0x60, 0x40, 0x38, 0x00, 0xe1, 0x20, 0x80, 0x0c, 0xf8, 0x60, 0xb8,
+	0x60, 0x03, 0x10, 0xc1, 0x00, 0x3d, 0x78, 0x1d, 0x02, 0x00, 0xf3, 0x0c,
+	0x44, 0x20, 0x00, 0x01, 0x34, 0x70, 0xc5, 0x20, 0xab, 0x04, 0x00, 0x1e,
+	0x04, 0x70, 0x0e, 0x90, 0x22, 0x00, 0xe1, 0x40, 0x1a, 0x09, 0x60, 0x01,
+	0x2c, 0x73, 0xa2, 0xc6, 0x00, 0x22, 0x1b, 0x7a, 0x40, 0x00, 0xf6, 0x05,
+	0x1c, 0x00, 0xc4, 0xba, 0x05, 0xea, 0x61, 0xba, 0xff, 0x0a, 0x31, 0x80,
+	0x1d, 0x78, 0x0f, 0x78, 0x44, 0x21, 0xc2, 0x07, 0x10, 0x00, 0xf0, 0x56,
+	0xe0, 0x7f, 0xc0, 0xb8, 0xe0, 0x78, 0xe2, 0xc0, 0x00, 0x16, 0x82, 0x70,
+	0x00, 0x80, 0x04, 0x00, 0x14, 0x70, 0x1a, 0x22, 0x83, 0x0f, 0x20, 0x00,
+	0x00, 0x00, 0x05, 0x23, 0x82, 0x0f, 0x02, 0x90, 0x86, 0x00, 0x40, 0x92,
+	0x05, 0x23, 0x83, 0x0f, 0x03, 0x90, 0x86, 0xfe, 0xc4, 0x22, 0x81, 0x0f,
+	0x00, 0x00, 0xff, 0xbf, 0x03, 0xf2, 0x8e, 0xba, 0xad, 0x70, 0x40, 0xb3,
+	0x1d, 0xf0, 0x1a, 0x25, 0x82, 0x1f, 0x00, 0x00, 0x00, 0x10, 0x05, 0x22,
+	0x82, 0x0f, 0x01, 0x00, 0x4a, 0x00, 0x5b, 0x7a, 0x05, 0x22, 0x83, 0x0f,
+	0x00, 0x90, 0x00, 0x00, 0x0b, 0xe8, 0x40, 0x93, 0x14, 0x21, 0x4c, 0x03,
+	0x40, 0xb4, 0x04, 0x22, 0x82, 0x36, 0x00, 0xf2, 0x32, 0xfb, 0x03, 0xf0,
+	0xf4, 0x21, 0x42, 0x03, 0x40, 0xb3, 0xa5, 0x71, 0xcd, 0x0d, 0x94, 0x92,
+	0xc2, 0xc4, 0xe6, 0xc2, 0x6c, 0x70, 0xc3, 0x41, 0x00, 0x80, 0xcf, 0x07,
+	0x24, 0xdd, 0x60, 0xa9, 0x9f, 0xbd, 0x00, 0x8d, 0x07, 0xe0, 0x1d, 0x7a,
+	0x5d, 0x7a, 0x5d, 0x7a, 0x09, 0x6a, 0x01, 0xa9, 0x34, 0x15, 0x8c, 0x10,
+	0x0e, 0xec, 0x02, 0xca, 0x1d, 0x7a, 0x42, 0xa9, 0x33, 0x15, 0x80, 0x10,
+	0x07, 0xe0, 0xf8, 0x00, 0xf1, 0x28, 0x58, 0x60, 0x04, 0x77, 0x03, 0xf0,
+	0x42, 0xa9, 0x03, 0xa9, 0x1e, 0xf0, 0x05, 0xee, 0x33, 0x15, 0x8f, 0x10,
+	0x02, 0xf0, 0xe0, 0x8d, 0xcf, 0x78, 0x16, 0x0f, 0xef, 0xff, 0x6f, 0x79,
+	0x04, 0xe8, 0x07, 0x6f, 0x1d, 0x79, 0x05, 0xf0, 0x1f, 0x4f, 0x1d, 0x79,
+	0x3d, 0x79, 0x3d, 0x79, 0x14, 0x23, 0x80, 0x03, 0x3d, 0x79, 0x00, 0x20,
+	0x80, 0xe6, 0x01, 0xf2, 0x03, 0x20, 0xa8, 0xc5, 0x71, 0xcf, 0x0e, 0x94,
+	0x90, 0x64, 0x71, 0xfb, 0x0b, 0xb4, 0x80, 0xcd, 0x70, 0xc6, 0xc6, 0xe8,
+	0x01, 0x80, 0x08, 0x46, 0x0c, 0x71, 0x38, 0x43, 0x00, 0x41, 0xda, 0x01,
+	0xc0, 0x06, 0xe8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x3b, 0x79, 0xc3,
+	0x40, 0xb4, 0x01, 0xc2, 0x00, 0x88, 0x17, 0x08, 0x70, 0x00, 0x48, 0x47,
+	0xad, 0x73, 0x8f, 0xe8, 0x50, 0x01, 0x62, 0x25, 0x00, 0xad, 0x71, 0x06,
+	0xf0, 0x0c, 0x00, 0xf0, 0x09, 0x58, 0x00, 0xad, 0x72, 0x0b, 0x79, 0x0c,
+	0x70, 0x12, 0xf2, 0x42, 0x0c, 0xcf, 0xfe, 0xc6, 0x08, 0x2f, 0xff, 0xa1,
+	0x40, 0x5a, 0x0b, 0xcf, 0xfe, 0x3c, 0x00, 0xf4, 0x01, 0xd8, 0x07, 0x20,
+	0x80, 0xc1, 0x40, 0x63, 0x42, 0xb6, 0x0d, 0xef, 0xff, 0xe1, 0x43, 0x0c,
+	0x71, 0x5c, 0x02, 0xf2, 0x19, 0x33, 0x48, 0x10, 0x49, 0x58, 0x60, 0x48,
+	0x23, 0x03, 0x00, 0x48, 0x20, 0x00, 0x00, 0x6e, 0x7b, 0x0e, 0x78, 0x09,
+	0x23, 0x00, 0x00, 0xe0, 0x7f, 0x0f, 0x78, 0xe0, 0x78, 0xf1, 0xc0, 0x56,
+	0x09, 0x40, 0x00, 0xd1, 0xc0, 0xe0, 0x7f, 0x0c, 0x70, 0x9c, 0x00, 0xf2,
+	0x19, 0xc3, 0x40, 0x08, 0x90, 0xe8, 0x01, 0x20, 0x90, 0x59, 0x20, 0x40,
+	0x0f, 0x24, 0x77, 0x30, 0x79, 0x3b, 0x79, 0x55, 0x21, 0x0d, 0x0c, 0x05,
+	0x21, 0x0e, 0x00, 0x05, 0x7d, 0x00, 0x16, 0x1b, 0x11, 0xe0, 0x95, 0x3a,
+	0x08, 0x20, 0x00, 0x96, 0xd8, 0x1e, 0x01, 0xf2, 0x17, 0x1d, 0x78, 0x22,
+	0x68, 0x04, 0x71, 0xe0, 0xb8, 0xca, 0x21, 0x01, 0x00, 0x2f, 0x78, 0xc3,
+	0x41, 0x00, 0x00, 0x00, 0xff, 0x04, 0x23, 0x5b, 0x30, 0x05, 0x20, 0xc0,
+	0x06, 0xe4, 0x79, 0x00, 0xb6, 0x45, 0x21, 0xc0, 0x03, 0x00, 0xb5, 0x8a,
+	0x00, 0xf2, 0xc5, 0x00, 0x16, 0x01, 0x71, 0x00, 0x80, 0x06, 0x00, 0x0c,
+	0x79, 0x85, 0x29, 0x1f, 0x04, 0xe0, 0x7f, 0x01, 0x69, 0xe0, 0x78, 0x42,
+	0x20, 0x01, 0x07, 0x39, 0x09, 0x54, 0x04, 0x89, 0x08, 0x30, 0x0c, 0x1a,
+	0xd9, 0x85, 0x08, 0x70, 0x0d, 0x0f, 0xd9, 0x7d, 0x08, 0x30, 0x0f, 0x18,
+	0xd9, 0xc5, 0xe0, 0x27, 0xf2, 0xd0, 0xe0, 0x27, 0xf2, 0xe0, 0xe0, 0x27,
+	0xf2, 0xf8, 0xe0, 0x27, 0xf2, 0x8c, 0x20, 0x03, 0x8c, 0x2c, 0x72, 0x30,
+	0xf2, 0x8c, 0x20, 0x02, 0x88, 0x19, 0xf4, 0x2c, 0x73, 0x2c, 0xf0, 0x25,
+	0x20, 0x40, 0x00, 0x11, 0xf0, 0x13, 0xf0, 0x1b, 0xf0, 0x11, 0xf0, 0x1b,
+	0xf0, 0x0f, 0xf0, 0x1b, 0xf0, 0x0d, 0xf0, 0x0b, 0xf0, 0x1b, 0xf0, 0x09,
+	0xf0, 0x09, 0xf0, 0x19, 0xf0, 0x07, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x17,
+	0xf0, 0x3f, 0xd9, 0x16, 0xf0, 0x2c, 0x70, 0x14, 0xf0, 0x0b, 0xd9, 0x12,
+	0xf0, 0x0a, 0xd9, 0x10, 0xf0, 0x07, 0xd9, 0x0e, 0xf0, 0x08, 0xd9, 0x0c,
+	0xf0, 0x3e, 0xd9, 0x0a, 0xf0, 0x3b, 0xd9, 0x08, 0xf0, 0x3a, 0xd9, 0x06,
+	0xf0, 0x1f, 0xd9, 0x04, 0xf0, 0x38, 0xd9, 0x02, 0xf0, 0x1b, 0xd9, 0xe0,
+	0x7f, 0x20, 0x40, 0x4a, 0x26, 0x00, 0x30, 0x10, 0xf0, 0x5a, 0x26, 0x83,
+	0x3c, 0x7c, 0x60, 0x5a, 0x23, 0x43, 0x16, 0x65, 0x71, 0x9b, 0x63, 0x3b,
+	0x63, 0x80, 0x8b, 0x45, 0x7c, 0x80, 0xab, 0xeb, 0x0b, 0x94, 0x90, 0x40,
+	0x26, 0x5e, 0x30, 0xf9, 0x0e, 0xb4, 0xb0, 0x6d, 0x70, 0xe0, 0x7e, 0x34,
+	0x01, 0xf3, 0x04, 0x82, 0x24, 0x0d, 0x3a, 0x76, 0x0e, 0x6f, 0xff, 0x83,
+	0xc0, 0x83, 0xc0, 0x0d, 0xd9, 0xc2, 0x0f, 0xef, 0xff, 0xc8, 0x84, 0x03,
+	0x60, 0x1b, 0x00, 0x99, 0x08, 0x1e, 0x00, 0x9e, 0x01, 0xa2, 0xc9, 0x07,
+	0x0e, 0x88, 0x8d, 0x08, 0x30, 0x00, 0x4b, 0xdb, 0x0e, 0x00, 0x22, 0x8d,
+	0x88, 0x08, 0x00, 0x13, 0xac, 0x08, 0x00, 0x13, 0xcb, 0x08, 0x00, 0x73,
+	0x2a, 0x88, 0x9f, 0xbb, 0x01, 0x1b, 0x52, 0x34, 0x00, 0x13, 0xeb, 0x16,
+	0x00, 0xf0, 0x11, 0xe0, 0xab, 0x4c, 0x88, 0x9a, 0x27, 0x04, 0x10, 0x32,
+	0x1b, 0x82, 0x00, 0x66, 0xc1, 0x31, 0x1c, 0x82, 0x33, 0x4a, 0x1c, 0x42,
+	0x33, 0x63, 0x1c, 0x02, 0x33, 0xb8, 0x13, 0x80, 0x80, 0x25, 0x7f, 0xd8,
+	0x02, 0xf0, 0x01, 0xc9, 0x07, 0x5f, 0x20, 0x8d, 0x01, 0xcb, 0x46, 0x12,
+	0x00, 0x10, 0x03, 0x2d, 0x89, 0xcb, 0x44, 0x16, 0x03, 0xf0, 0x2b, 0xd8,
+	0x65, 0x85, 0x78, 0xe0, 0xb0, 0x33, 0x1b, 0x42, 0x00, 0x9a, 0x21, 0x04,
+	0x00, 0x02, 0x6e, 0xb8, 0x60, 0x85, 0x78, 0x45, 0x79, 0x20, 0xb0, 0xff,
+	0xd8, 0x40, 0xc0, 0x83, 0xc0, 0x2c, 0x71, 0xc3, 0x42, 0x40, 0x00, 0x00,
+	0x58, 0x82, 0x0f, 0xe0, 0x01, 0x6c, 0x70, 0x4e, 0x0c, 0x00, 0x00, 0xea,
+	0x09, 0xcf, 0xfe, 0x96, 0x0c, 0x40, 0x00, 0x0c, 0x70, 0xe6, 0x03, 0x42,
+	0x04, 0x90, 0xdc, 0x00, 0x78, 0x02, 0xf2, 0x13, 0x19, 0x00, 0x14, 0x70,
+	0xf6, 0x02, 0x22, 0x00, 0x0c, 0x70, 0xe3, 0x02, 0x00, 0x00, 0x0b, 0xe9,
+	0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x58, 0x00, 0x34, 0x70, 0x2c, 0x71,
+	0x0b, 0xf4, 0xcd, 0x02, 0x00, 0x00, 0x12, 0x00, 0xf2, 0x1f, 0x25, 0x00,
+	0x34, 0x70, 0xbc, 0x02, 0x21, 0x00, 0x2c, 0x70, 0x04, 0x71, 0x26, 0x0e,
+	0xef, 0xfe, 0x0f, 0x78, 0x6f, 0x21, 0xc3, 0x00, 0x00, 0x11, 0xc0, 0x00,
+	0xc3, 0x89, 0x2c, 0x70, 0x41, 0xc0, 0x00, 0x24, 0x80, 0x3f, 0x00, 0x00,
+	0xc8, 0x02, 0xce, 0x0e, 0x20, 0x00, 0xa0, 0xda, 0x0e, 0x00, 0x31, 0x28,
+	0x02, 0xc2, 0x0e, 0x00, 0x51, 0x56, 0x24, 0x40, 0x3c, 0xb6, 0x0a, 0x00,
+	0x51, 0x55, 0x24, 0x80, 0x3e, 0xae, 0x0a, 0x00, 0xf1, 0x0a, 0x1a, 0x26,
+	0x8e, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x38, 0x43, 0x64, 0xf0, 0x2c, 0x70,
+	0x9a, 0x0e, 0x20, 0x00, 0x28, 0xda, 0x55, 0x24, 0x80, 0x39, 0x8e, 0x0a,
+	0x00, 0x31, 0x9c, 0xc0, 0x86, 0x08, 0x00, 0xf2, 0x1b, 0x55, 0x23, 0x00,
+	0x38, 0xc5, 0x78, 0x55, 0x24, 0x01, 0x3c, 0x8a, 0x0a, 0x20, 0x01, 0x4c,
+	0x72, 0x55, 0x23, 0xc0, 0x38, 0xc5, 0x78, 0x7e, 0x0a, 0x20, 0x01, 0x55,
+	0x24, 0x81, 0x39, 0x55, 0x23, 0x00, 0x3d, 0xc5, 0x78, 0x72, 0x0a, 0x20,
+	0x01, 0x9c, 0xc1, 0x74, 0x01, 0x33, 0x03, 0x10, 0x8b, 0x60, 0x01, 0xf0,
+	0x07, 0x62, 0x88, 0x35, 0xf0, 0x55, 0x24, 0x00, 0x3c, 0xf4, 0x20, 0xde,
+	0x00, 0x4e, 0x09, 0xef, 0xfe, 0x0a, 0x20, 0x80, 0x07, 0x08, 0x47, 0x62,
+	0x00, 0xf1, 0x0a, 0xf4, 0x20, 0xcd, 0x00, 0x9c, 0xc0, 0xf4, 0x20, 0xc0,
+	0x00, 0xc5, 0xbd, 0x36, 0x09, 0xef, 0xfe, 0xfd, 0x65, 0x5a, 0x23, 0x02,
+	0x3a, 0x00, 0x24, 0x81, 0xc0, 0x00, 0x62, 0x59, 0x61, 0x74, 0x79, 0xa0,
+	0xb1, 0x0e, 0x00, 0xf0, 0x05, 0x28, 0x02, 0x5c, 0x61, 0x2f, 0x21, 0x82,
+	0x07, 0x74, 0x7c, 0x6c, 0x21, 0x01, 0x01, 0x20, 0xb4, 0x56, 0x24, 0x41,
+	0x3c, 0x20, 0x00, 0x60, 0xe0, 0xb1, 0x55, 0x24, 0x81, 0x3e, 0x0a, 0x00,
+	0xe0, 0x00, 0xb1, 0x64, 0x71, 0x9d, 0x0b, 0xc5, 0x90, 0x67, 0x71, 0x3d,
+	0x0b, 0x34, 0xb1, 0x70, 0x00, 0x02, 0x56, 0x01, 0xf4, 0x1b, 0xc9, 0x07,
+	0x30, 0xd9, 0x9f, 0xb9, 0x40, 0x21, 0xce, 0x0c, 0x14, 0x70, 0x42, 0x26,
+	0x83, 0x12, 0x42, 0x21, 0x80, 0x02, 0xca, 0x23, 0x01, 0x00, 0x0c, 0x71,
+	0xca, 0x26, 0x41, 0x10, 0x08, 0x43, 0x42, 0xc0, 0x59, 0xf0, 0xab, 0x0d,
+	0xe0, 0x12, 0x4c, 0x70, 0xb8, 0x00, 0x13, 0x9f, 0xb8, 0x00, 0xf4, 0x07,
+	0x82, 0x88, 0x8f, 0xba, 0x58, 0x43, 0x2e, 0xf0, 0x5a, 0x25, 0x0f, 0x1a,
+	0x01, 0xc1, 0x23, 0x09, 0x32, 0x00, 0x5a, 0x23, 0x00, 0x1a, 0x90, 0x00,
+	0x62, 0xf9, 0x61, 0xf4, 0x21, 0x02, 0x03, 0x0e, 0x00, 0x40, 0xc8, 0x02,
+	0x06, 0xf0, 0x92, 0x00, 0xf0, 0x03, 0xfa, 0x61, 0xf4, 0x22, 0x02, 0x03,
+	0x19, 0x61, 0xf4, 0x21, 0x01, 0x03, 0x42, 0x79, 0x08, 0x26, 0x42, 0x30,
+	0x9e, 0x00, 0xf0, 0x17, 0x3f, 0x67, 0x38, 0x60, 0xf4, 0x27, 0x0f, 0x13,
+	0xf4, 0x20, 0x00, 0x03, 0x2f, 0x21, 0xc6, 0x06, 0x85, 0x71, 0xe2, 0x78,
+	0x08, 0x21, 0x1b, 0x00, 0xa9, 0x0f, 0x25, 0xb3, 0x2f, 0x26, 0x86, 0x30,
+	0x01, 0xc0, 0x11, 0x08, 0x32, 0x00, 0x16, 0x01, 0x91, 0x9e, 0x0f, 0x8f,
+	0xfe, 0x06, 0xf0, 0x1e, 0x0f, 0xaf, 0x24, 0x01, 0xa0, 0x00, 0x41, 0x16,
+	0x0f, 0xaf, 0xfe, 0x2f, 0x20, 0xc6, 0x06, 0xac, 0x02, 0xf4, 0x03, 0x01,
+	0x1e, 0x12, 0x10, 0xa5, 0x77, 0x57, 0x0d, 0x13, 0x90, 0x65, 0x77, 0xfd,
+	0x0b, 0x33, 0x90, 0xad, 0x71, 0xe0, 0x00, 0x11, 0x2c, 0xe0, 0x00, 0x10,
+	0xcb, 0xe0, 0x00, 0xd0, 0x23, 0x00, 0x11, 0x41, 0xc0, 0xca, 0x23, 0x41,
+	0x10, 0x0c, 0x69, 0x01, 0xc1, 0x30, 0x04, 0x44, 0x41, 0xc1, 0x42, 0xf0,
+	0xd8, 0x00, 0x13, 0x9e, 0xd8, 0x00, 0xf2, 0x69, 0x42, 0x88, 0x0c, 0x70,
+	0x8f, 0xb8, 0x00, 0x41, 0x1e, 0xf0, 0x02, 0xc6, 0x5a, 0x23, 0x0c, 0x3a,
+	0x56, 0x24, 0x4d, 0x3c, 0x5a, 0x26, 0x0e, 0x1a, 0x55, 0x24, 0x8f, 0x3e,
+	0x99, 0x65, 0xf4, 0x21, 0x9f, 0x00, 0xd9, 0x67, 0xf4, 0x21, 0x81, 0x00,
+	0xfc, 0x64, 0xdd, 0x65, 0x02, 0x21, 0xc1, 0x07, 0x08, 0x23, 0x41, 0x00,
+	0xf4, 0x24, 0x8c, 0x10, 0xf4, 0x25, 0x83, 0x10, 0x44, 0x71, 0x82, 0x7b,
+	0x08, 0x20, 0xc0, 0x00, 0x0e, 0x78, 0xc7, 0x0e, 0xa5, 0xb0, 0x2e, 0x7b,
+	0x72, 0x0e, 0x8f, 0xfe, 0x00, 0x42, 0x6e, 0x0e, 0xaf, 0xfe, 0x60, 0x40,
+	0x01, 0xc1, 0x67, 0x77, 0x01, 0x19, 0x92, 0x00, 0x41, 0xc1, 0x01, 0x1b,
+	0x12, 0x10, 0x8d, 0x0b, 0x13, 0xb0, 0x02, 0xc0, 0x04, 0x77, 0x42, 0xc0,
+	0x02, 0xc0, 0xf7, 0x08, 0x33, 0x80, 0x6f, 0x71, 0xbe, 0x02, 0xb1, 0xc9,
+	0x07, 0x01, 0x69, 0x0f, 0x79, 0x34, 0x71, 0x00, 0x1e, 0x02, 0x40, 0x07,
+	0xa2, 0x1a, 0x05, 0xce, 0xff, 0x62, 0x0b, 0xef, 0xfe, 0x0c, 0x73, 0x60,
+	0x03, 0x44, 0x0c, 0x70, 0x01, 0xa9, 0x1c, 0x00, 0x02, 0xe2, 0x00, 0x00,
+	0x18, 0x03, 0xf2, 0x09, 0x5c, 0x08, 0x41, 0x01, 0xc3, 0x40, 0x03, 0x90,
+	0x74, 0xe1, 0x2c, 0x70, 0x20, 0xb0, 0x82, 0x0e, 0xef, 0xfe, 0x21, 0xb0,
+	0x80, 0x24, 0x0d, 0x3a, 0xf6, 0x04, 0xf2, 0x3d, 0xe0, 0x78, 0xe4, 0xc2,
+	0xa4, 0xc1, 0x08, 0x46, 0x0c, 0x70, 0xfe, 0x09, 0xaf, 0xfe, 0xff, 0xd9,
+	0x00, 0x12, 0x83, 0x30, 0x2c, 0x70, 0xff, 0xd8, 0x4c, 0x75, 0x28, 0x45,
+	0x43, 0xc1, 0x42, 0xc1, 0x41, 0xc1, 0xbe, 0x0a, 0xaf, 0xfe, 0x40, 0xc1,
+	0xc1, 0xbe, 0xff, 0xd8, 0x80, 0xd9, 0x4c, 0x76, 0x20, 0xdb, 0x43, 0xc5,
+	0x42, 0xc6, 0x41, 0xc5, 0xaa, 0x0a, 0xaf, 0xfe, 0x00, 0x1c, 0x41, 0x30,
+	0x0c, 0x70, 0x5e, 0x0a, 0xaf, 0xfe, 0x2c, 0x71, 0xa4, 0xc0, 0xc4, 0xc6,
+	0x4c, 0x00, 0xd1, 0x58, 0xd8, 0x9f, 0xb8, 0xc0, 0x88, 0xcd, 0x10, 0x8d,
+	0x80, 0x0c, 0x70, 0xaa, 0x54, 0x00, 0xf0, 0x01, 0x05, 0x26, 0x41, 0x13,
+	0x0c, 0x70, 0xc1, 0xb9, 0x43, 0xc0, 0x42, 0xc1, 0x41, 0xc0, 0x40, 0xc0,
+	0x4a, 0x00, 0xb7, 0x09, 0xda, 0x66, 0x0a, 0xaf, 0xfe, 0x20, 0xdb, 0x0c,
+	0x70, 0x1e, 0x40, 0x00, 0xf0, 0x01, 0xaa, 0x21, 0xc4, 0x00, 0x11, 0x09,
+	0x3f, 0x00, 0x2c, 0x72, 0xab, 0x21, 0xc4, 0x00, 0x2c, 0x71, 0x06, 0x00,
+	0xf0, 0x17, 0x0f, 0x08, 0x15, 0x04, 0x00, 0x16, 0x00, 0x71, 0x08, 0x90,
+	0xd6, 0x01, 0xe0, 0x7e, 0xaa, 0x21, 0x04, 0x01, 0x32, 0x7b, 0x19, 0x0b,
+	0x25, 0x00, 0xaa, 0x24, 0x44, 0x11, 0xaa, 0x22, 0x04, 0x01, 0xfd, 0x09,
+	0x84, 0x80, 0x62, 0x78, 0x0e, 0x00, 0x40, 0x03, 0xf0, 0x38, 0x60, 0x20,
+	0x00, 0xf0, 0x01, 0x10, 0x71, 0xe1, 0x20, 0xc6, 0x07, 0xaa, 0x22, 0x44,
+	0x01, 0xf3, 0x0c, 0x80, 0x90, 0xe0, 0x7e, 0x48, 0x06, 0xa2, 0x66, 0x08,
+	0x00, 0x00, 0xa6, 0x0f, 0xcf, 0xff, 0xd1, 0xc0, 0x10, 0x00, 0xa0, 0x5a,
+	0x0f, 0xcf, 0xff, 0x96, 0x0f, 0xef, 0xff, 0x14, 0xd8, 0x12, 0x00, 0x60,
+	0xf1, 0xc0, 0x46, 0x08, 0x00, 0x00, 0x46, 0x01, 0x73, 0xe0, 0x06, 0x20,
+	0x89, 0x1b, 0x78, 0x15, 0x42, 0x04, 0x51, 0x01, 0x00, 0x23, 0x09, 0xdf,
+	0x18, 0x00, 0xf0, 0x0f, 0xc8, 0x07, 0x20, 0x89, 0x17, 0x09, 0x34, 0x01,
+	0x6c, 0x21, 0x41, 0x00, 0x09, 0x28, 0x42, 0x80, 0x08, 0xf2, 0x38, 0x60,
+	0x42, 0x78, 0x04, 0xf0, 0x09, 0x08, 0x15, 0x01, 0x0c, 0x74, 0x44, 0x00,
+	0xf4, 0x1d, 0x6f, 0x24, 0x43, 0x13, 0x60, 0x94, 0x1a, 0x23, 0x02, 0x00,
+	0x05, 0x2a, 0x82, 0x0f, 0x1e, 0x00, 0x80, 0x84, 0x17, 0x08, 0x84, 0x0f,
+	0x03, 0x00, 0x41, 0x0d, 0x85, 0x28, 0x0f, 0x0a, 0x1a, 0x20, 0xc2, 0x00,
+	0x85, 0x2a, 0x1f, 0x04, 0x3d, 0x79, 0x01, 0x6a, 0x41, 0x69, 0x6a, 0x00,
+	0x77, 0x0c, 0xe9, 0xfb, 0x14, 0x81, 0x90, 0x15, 0x64, 0x00, 0xf3, 0x07,
+	0x34, 0x70, 0xda, 0x22, 0x42, 0x00, 0x10, 0x72, 0xe0, 0x7f, 0xca, 0x20,
+	0x8d, 0x00, 0xe6, 0xc2, 0xce, 0x0e, 0x2f, 0xff, 0xa4, 0xc1, 0xce, 0x06,
+	0x90, 0x79, 0xc3, 0xb9, 0x58, 0xdd, 0x02, 0x1a, 0x42, 0x30, 0x1e, 0x08,
+	0x62, 0x0b, 0xe8, 0x5f, 0x21, 0x00, 0x01, 0xa8, 0x08, 0xf0, 0x69, 0x57,
+	0x00, 0x44, 0x20, 0x00, 0x0e, 0x1e, 0x62, 0x05, 0xf0, 0x00, 0x16, 0x8e,
+	0x70, 0x00, 0x80, 0x24, 0x00, 0x96, 0x0e, 0x0f, 0xff, 0xcf, 0x79, 0x3d,
+	0x7b, 0x3d, 0x7a, 0x53, 0x26, 0x7e, 0x90, 0x7d, 0x7b, 0x5d, 0x7a, 0xc0,
+	0x23, 0x62, 0x00, 0x5d, 0x7a, 0x53, 0x26, 0x81, 0x90, 0xc3, 0xb8, 0xc0,
+	0x22, 0x62, 0x00, 0x03, 0x1a, 0x02, 0x30, 0x05, 0x1a, 0xc2, 0x30, 0x07,
+	0x1a, 0x42, 0x30, 0x04, 0x1a, 0x82, 0x30, 0x40, 0xc0, 0xc3, 0x41, 0x53,
+	0x00, 0x03, 0x00, 0xb6, 0x0c, 0xaf, 0xfe, 0x0a, 0xd8, 0x6f, 0x27, 0xc3,
+	0x10, 0x00, 0x8f, 0xe2, 0xb8, 0x0c, 0x70, 0xca, 0x20, 0xe1, 0x00, 0x08,
+	0x1a, 0x02, 0x30, 0x24, 0x17, 0x82, 0x10, 0x0f, 0x17, 0x81, 0x14, 0x42,
+	0x27, 0x80, 0x12, 0x00, 0x90, 0x60, 0x8d, 0xc0, 0x97, 0x82, 0x8f, 0xd2,
+	0x01, 0xf1, 0x0c, 0x0a, 0xd8, 0xc3, 0x41, 0x55, 0x00, 0x06, 0x00, 0x41,
+	0xc4, 0x7e, 0x0c, 0xaf, 0xfe, 0x40, 0xc6, 0x08, 0x8f, 0x08, 0xe8, 0xc3,
+	0x41, 0x5a, 0x00, 0x00, 0x00, 0x6e, 0x4a, 0x00, 0xf1, 0x16, 0x32, 0xde,
+	0x9f, 0xbe, 0x01, 0x16, 0x83, 0x14, 0xd1, 0x16, 0x82, 0x90, 0x01, 0x16,
+	0x8c, 0x14, 0x02, 0x16, 0x81, 0x14, 0x01, 0x16, 0x80, 0x14, 0x40, 0xc4,
+	0x41, 0xc1, 0x42, 0xc0, 0xc3, 0x41, 0x5b, 0x00, 0x05, 0x00, 0x42, 0x2a,
+	0x00, 0x00, 0x26, 0x00, 0xe0, 0x21, 0x8e, 0x04, 0x8e, 0xcc, 0x16, 0x82,
+	0x90, 0x80, 0x8e, 0x42, 0xc0, 0x41, 0xc1, 0x5c, 0x00, 0x50, 0x5c, 0x00,
+	0x05, 0x00, 0x22, 0x5a, 0x00, 0xf0, 0x02, 0xc4, 0x08, 0x8f, 0xb5, 0x08,
+	0x11, 0x00, 0x15, 0x8f, 0x31, 0x08, 0x7e, 0x00, 0x3e, 0xdf, 0x40, 0xf8,
+	0x40, 0x00, 0x00, 0x22, 0x00, 0x51, 0x5d, 0x00, 0x05, 0x00, 0x02, 0x22,
+	0x00, 0x24, 0x41, 0xf8, 0x36, 0x00, 0xf5, 0x04, 0x5e, 0x00, 0x05, 0x00,
+	0xee, 0x0b, 0xaf, 0xfe, 0x40, 0xc4, 0x00, 0x8d, 0x33, 0x08, 0x3e, 0x00,
+	0x65, 0xdf, 0x34, 0x30, 0x00, 0x51, 0x5f, 0x00, 0x05, 0x00, 0xd2, 0x1c,
+	0x00, 0x15, 0x35, 0x30, 0x00, 0x51, 0x60, 0x00, 0x05, 0x00, 0xbe, 0x14,
+	0x00, 0xf0, 0x0b, 0x00, 0x8d, 0x51, 0x08, 0x7e, 0x00, 0x71, 0xdd, 0x9f,
+	0xbd, 0x01, 0x15, 0x83, 0x14, 0x01, 0x15, 0x8c, 0x14, 0x02, 0x15, 0x81,
+	0x14, 0x01, 0x15, 0x80, 0x14, 0x98, 0x00, 0x04, 0x74, 0x00, 0x51, 0x61,
+	0x00, 0x05, 0x00, 0x8e, 0x30, 0x00, 0x00, 0x26, 0x00, 0x40, 0x21, 0x8d,
+	0x04, 0x8d, 0x1e, 0x00, 0x24, 0x80, 0x8d, 0x80, 0x00, 0x51, 0x62, 0x00,
+	0x05, 0x00, 0x6e, 0x20, 0x00, 0x00, 0xb2, 0x08, 0xd0, 0xa0, 0x01, 0x02,
+	0x18, 0x15, 0x00, 0x8a, 0x21, 0x44, 0x00, 0x02, 0x18, 0x54, 0x08, 0x00,
+	0x12, 0x01, 0x08, 0x00, 0x31, 0xc4, 0x01, 0x04, 0x10, 0x00, 0xf0, 0x05,
+	0x88, 0x00, 0x20, 0xb0, 0x8a, 0x21, 0x88, 0x02, 0x21, 0xb0, 0x8a, 0x21,
+	0xc8, 0x02, 0x22, 0xb0, 0x8a, 0x20, 0xcc, 0x03, 0xe2, 0x06, 0xf0, 0x09,
+	0x09, 0x90, 0x80, 0xe1, 0x34, 0xd9, 0xc3, 0x40, 0x05, 0x90, 0xee, 0xe0,
+	0x20, 0xb0, 0x4e, 0x0d, 0xef, 0xff, 0xfc, 0x18, 0x05, 0x81, 0xa4, 0xc0,
+	0x94, 0x0b, 0xf2, 0x01, 0x9f, 0xbf, 0x01, 0x17, 0x83, 0x14, 0x01, 0x17,
+	0x8c, 0x14, 0x02, 0x17, 0x81, 0x14, 0x01, 0x17, 0xa0, 0x00, 0x20, 0xe0,
+	0x7e, 0x16, 0x00, 0x41, 0x21, 0x8f, 0x04, 0x8f, 0x90, 0x00, 0xf0, 0x00,
+	0x8f, 0xe0, 0x7e, 0x1a, 0x62, 0x04, 0xf0, 0x01, 0x18, 0x52, 0x00, 0xfd,
+	0x08, 0x84, 0x80, 0xfc, 0x02, 0x02, 0x14, 0x08, 0xf0, 0x17, 0xa7, 0xc1,
+	0x07, 0xda, 0x8c, 0xba, 0xc3, 0x40, 0x00, 0x00, 0x38, 0x9f, 0xcb, 0x45,
+	0x12, 0x90, 0x28, 0x03, 0x00, 0x1e, 0x84, 0x70, 0x00, 0x80, 0x02, 0x00,
+	0x00, 0xb5, 0x58, 0xd8, 0x01, 0xb5, 0xc3, 0x41, 0xb8, 0x00, 0x01, 0x00,
+	0xe6, 0x03, 0xf2, 0x17, 0x0a, 0xd8, 0x20, 0xcc, 0x20, 0x95, 0x30, 0x70,
+	0x0c, 0x70, 0x06, 0xf4, 0x21, 0xcc, 0x21, 0x95, 0x38, 0x20, 0x40, 0x00,
+	0xc3, 0x41, 0xb9, 0x00, 0x00, 0x00, 0x22, 0x0d, 0x0f, 0xfe, 0x00, 0x1e,
+	0x43, 0x70, 0x00, 0x80, 0xe0, 0x06, 0x70, 0x04, 0xf1, 0x00, 0x04, 0x00,
+	0x00, 0x1a, 0x03, 0x31, 0x6f, 0x21, 0x43, 0x02, 0x42, 0xc0, 0x1a, 0x20,
+	0x80, 0x38, 0x0b, 0xf1, 0x04, 0x26, 0x91, 0x41, 0xc0, 0x05, 0x20, 0x80,
+	0x0f, 0x04, 0x90, 0x32, 0x00, 0x40, 0xc1, 0x00, 0x90, 0x43, 0xc0, 0x01,
+	0x10, 0x00, 0xf0, 0x09, 0x02, 0x90, 0x40, 0x00, 0x00, 0x90, 0x46, 0x0a,
+	0x20, 0x01, 0x46, 0xc0, 0x00, 0xc0, 0xe0, 0xb8, 0x64, 0x02, 0x01, 0x00,
+	0x01, 0xc0, 0x03, 0xc1, 0x2c, 0x00, 0x82, 0x05, 0x90, 0x32, 0xe0, 0x80,
+	0xb9, 0x20, 0xb0, 0x2a, 0x00, 0xf1, 0x1e, 0x03, 0x90, 0x90, 0xe0, 0xa2,
+	0x0c, 0x20, 0x00, 0x00, 0x18, 0x05, 0x00, 0x6f, 0x25, 0xc3, 0x1c, 0x00,
+	0x8d, 0x85, 0xe8, 0x00, 0x1e, 0x85, 0x70, 0x04, 0x90, 0xc0, 0x00, 0xe2,
+	0x0c, 0xcf, 0xff, 0x92, 0x0f, 0x0f, 0xff, 0x00, 0x8d, 0x14, 0x70, 0xbb,
+	0xf4, 0x00, 0x16, 0x8d, 0xb6, 0x0b, 0xc0, 0x00, 0x16, 0x8b, 0x70, 0x00,
+	0x80, 0x00, 0x00, 0x1a, 0x25, 0x80, 0x1f, 0xbc, 0x0b, 0x13, 0x45, 0x72,
+	0x00, 0x63, 0x86, 0x00, 0x00, 0x90, 0x44, 0xc0, 0x4e, 0x03, 0xf0, 0x18,
+	0x78, 0xc2, 0xb8, 0x25, 0x08, 0x90, 0x00, 0x33, 0x08, 0xf1, 0x00, 0x8b,
+	0x23, 0x3e, 0x90, 0x08, 0xce, 0xcb, 0x46, 0x00, 0x80, 0x1c, 0x04, 0x1c,
+	0x76, 0x03, 0x1a, 0x98, 0x33, 0x0e, 0xce, 0xcb, 0x47, 0x00, 0x80, 0x34,
+	0x04, 0x18, 0xf0, 0x16, 0x00, 0x20, 0x18, 0x04, 0x14, 0x00, 0x00, 0x12,
+	0x00, 0x40, 0x30, 0x04, 0x0f, 0xf0, 0x2e, 0x00, 0x11, 0x05, 0x2e, 0x00,
+	0x51, 0x10, 0x04, 0x1c, 0x76, 0x0b, 0x2a, 0x00, 0x11, 0x28, 0x22, 0x00,
+	0x62, 0x1c, 0x77, 0x09, 0x1a, 0xd8, 0x33, 0x94, 0x03, 0x11, 0x0c, 0x56,
+	0x00, 0xf0, 0x11, 0x1a, 0x22, 0x9b, 0x0f, 0x01, 0x00, 0xa0, 0x86, 0x0b,
+	0xf2, 0x3c, 0x23, 0x80, 0x3f, 0xa6, 0x00, 0x00, 0x04, 0xc3, 0x41, 0x41,
+	0x01, 0x01, 0x00, 0xe6, 0x0b, 0x0f, 0xfe, 0x2f, 0x22, 0xc2, 0x06, 0xe0,
+	0x0b, 0x04, 0x04, 0x00, 0xe0, 0x95, 0xed, 0x04, 0xc0, 0x44, 0x20, 0x80,
+	0x00, 0x11, 0x66, 0x10, 0x67, 0x10, 0x4a, 0x0e, 0x0b, 0x20, 0x05, 0x28,
+	0x6c, 0x01, 0xf0, 0x07, 0x03, 0x90, 0x80, 0xfe, 0x0f, 0x78, 0x89, 0x20,
+	0xc1, 0x0f, 0x00, 0xb1, 0xe0, 0x19, 0x04, 0x80, 0x02, 0xc0, 0x1a, 0x20,
+	0x8d, 0x0f, 0x78, 0x08, 0x20, 0x05, 0x2b, 0xb0, 0x08, 0xf2, 0x13, 0x00,
+	0xfa, 0x04, 0x71, 0x21, 0x08, 0xfe, 0x01, 0x6c, 0x74, 0x00, 0x22, 0x80,
+	0x0f, 0xff, 0xff, 0x3c, 0x79, 0x8c, 0x20, 0x47, 0x8d, 0x6c, 0x70, 0x85,
+	0xf6, 0x85, 0x28, 0x07, 0x0d, 0x02, 0xf0, 0x0c, 0x71, 0x3e, 0x00, 0xf0,
+	0x03, 0x5a, 0x20, 0x00, 0x02, 0x05, 0xc1, 0x05, 0x21, 0x82, 0x0f, 0x05,
+	0x90, 0x64, 0xe1, 0x05, 0x20, 0xc1, 0x00, 0x58, 0x05, 0xa2, 0x04, 0x90,
+	0x64, 0x01, 0xc1, 0xb8, 0x25, 0x78, 0x00, 0xb2, 0x6e, 0x01, 0x00, 0xe4,
+	0x0c, 0xc2, 0x52, 0x09, 0x20, 0x01, 0xc0, 0x90, 0xe2, 0x08, 0x20, 0x01,
+	0xa1, 0x40, 0x7c, 0x06, 0xe0, 0x1f, 0x00, 0x02, 0xc0, 0x11, 0x21, 0x00,
+	0x80, 0x01, 0xc0, 0xcf, 0x26, 0x21, 0x10, 0xa4, 0x01, 0x00, 0x02, 0x0d,
+	0xf0, 0x13, 0xc0, 0xb0, 0x2a, 0x0b, 0x00, 0x00, 0x4a, 0x0b, 0x8f, 0xff,
+	0xfe, 0x08, 0x8f, 0xfe, 0x52, 0x0c, 0x4f, 0xff, 0x04, 0xca, 0x4c, 0x70,
+	0x8d, 0x70, 0x33, 0xf0, 0x5a, 0x24, 0x9e, 0x14, 0x00, 0x26, 0x83, 0x3f,
+	0x1c, 0x02, 0x71, 0x41, 0xb3, 0x28, 0xf0, 0x1a, 0x24, 0x81, 0x1a, 0x0d,
+	0xf0, 0x21, 0xa5, 0x79, 0x3b, 0x79, 0x05, 0x21, 0x81, 0x0f, 0x02, 0x90,
+	0x40, 0x01, 0x20, 0x91, 0x2f, 0x7e, 0x13, 0x0d, 0xa1, 0x13, 0xc4, 0xbe,
+	0x22, 0x8b, 0x0f, 0x21, 0x41, 0x03, 0x22, 0xab, 0x13, 0xf0, 0x23, 0x8b,
+	0x24, 0x71, 0x23, 0xab, 0x2f, 0x79, 0x14, 0x26, 0x41, 0x30, 0x00, 0x21,
+	0x8f, 0x0f, 0x40, 0x00, 0xf1, 0x30, 0x2c, 0x71, 0xa3, 0xaf, 0x06, 0xee,
+	0x61, 0xbe, 0x01, 0x0e, 0x31, 0x10, 0x3b, 0x79, 0x22, 0xaf, 0xa5, 0x71,
+	0xb3, 0x0d, 0x14, 0x92, 0x85, 0x71, 0x9f, 0x0c, 0x24, 0x90, 0xad, 0x70,
+	0x00, 0xc0, 0x0b, 0x08, 0x3f, 0x03, 0x0c, 0x71, 0x07, 0xf0, 0xd2, 0x0b,
+	0x0f, 0xfe, 0xbe, 0x0a, 0x20, 0x00, 0x0d, 0xd8, 0x0c, 0x70, 0xc6, 0x0f,
+	0x80, 0x01, 0xe2, 0x0e, 0x4f, 0xfe, 0x00, 0x1e, 0x03, 0xa0, 0x02, 0x80,
+	0xa6, 0x0a, 0x20, 0x00, 0x0c, 0x70, 0x04, 0xca, 0x3e, 0x0b, 0xa0, 0x6c,
+	0x70, 0x19, 0xf0, 0x4c, 0x70, 0x14, 0xf0, 0x1a, 0x23, 0xc0, 0x0d, 0xd7,
+	0x00, 0x10, 0x00, 0x23, 0x8d, 0x1f, 0x00, 0x80, 0xf0, 0x07, 0x65, 0x71,
+	0x45, 0x9e, 0x00, 0xf0, 0x1a, 0x80, 0x91, 0x80, 0xad, 0x40, 0xb1, 0x44,
+	0x71, 0xdb, 0x0a, 0x14, 0x82, 0x64, 0x71, 0xd3, 0x0b, 0x24, 0x80, 0x16,
+	0x26, 0xcb, 0x30, 0xde, 0x0b, 0xaf, 0xfe, 0x0c, 0x71, 0x00, 0xc0, 0x13,
+	0x08, 0xbe, 0x00, 0x0c, 0x70, 0xaa, 0x0b, 0x00, 0x01, 0x4a, 0x5a, 0x00,
+	0xf0, 0x01, 0x72, 0x00, 0xc0, 0x44, 0x20, 0x8e, 0x80, 0x07, 0xf2, 0x9a,
+	0x0b, 0x20, 0x01, 0x0c, 0x71, 0x36, 0x14, 0x00, 0x74, 0x71, 0x00, 0xc0,
+	0x1b, 0x08, 0x1e, 0x02, 0x1a, 0x03, 0x30, 0x87, 0xe8, 0x7e, 0x1c, 0x00,
+	0x70, 0x73, 0x1a, 0x0a, 0x20, 0x00, 0x0a, 0xd8, 0x30, 0x00, 0x50, 0x0d,
+	0x82, 0x07, 0xf2, 0x6a, 0x14, 0x00, 0xa0, 0x75, 0x06, 0x0a, 0x20, 0x00,
+	0xfd, 0xd8, 0x08, 0xee, 0x5a, 0x0e, 0x00, 0x70, 0x72, 0xfa, 0x09, 0x20,
+	0x00, 0xfe, 0xd8, 0x64, 0x00, 0xf5, 0x04, 0x3e, 0x01, 0x0c, 0x76, 0x46,
+	0x0b, 0x00, 0x01, 0xe6, 0x09, 0x20, 0x00, 0x0c, 0x74, 0x00, 0xc0, 0x15,
+	0x08, 0x51, 0xf2, 0x0a, 0xb0, 0x84, 0xe8, 0x2e, 0x0b, 0x20, 0x01, 0x0d,
+	0xd8, 0x07, 0xed, 0x26, 0x36, 0x00, 0x20, 0x74, 0xc2, 0x24, 0x00, 0x74,
+	0x73, 0x00, 0xc0, 0x25, 0x08, 0x7f, 0x02, 0xe2, 0x08, 0x24, 0x04, 0x00,
+	0x86, 0x03, 0xd3, 0x05, 0x20, 0x81, 0x0f, 0x03, 0x90, 0x40, 0xe0, 0x06,
+	0xc0, 0x00, 0xb1, 0x40, 0xae, 0x0d, 0xe0, 0x01, 0x00, 0xcb, 0x46, 0x00,
+	0x80, 0xc9, 0x07, 0xe2, 0xb8, 0xca, 0x25, 0xe1, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x13, 0x0d, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82,
+	0x04, 0x0d, 0x00, 0x00, 0xf0, 0x2d, 0x0c, 0x70, 0x00, 0xae, 0x0f, 0x78,
+	0x4f, 0x08, 0x95, 0x00, 0x1d, 0xe8, 0x00, 0x16, 0x80, 0x70, 0x00, 0x80,
+	0x58, 0x00, 0x14, 0x70, 0x0c, 0x71, 0x13, 0xf2, 0x76, 0x0e, 0x4f, 0xfe,
+	0x00, 0x8e, 0x04, 0x71, 0xf6, 0x0a, 0xaf, 0xfe, 0x0f, 0x78, 0x8a, 0x0d,
+	0x4f, 0xfe, 0xc2, 0x0d, 0x6f, 0xfe, 0x01, 0x1e, 0x03, 0x10, 0x00, 0x41,
+	0xf6, 0x0d, 0x20, 0x01, 0xa1, 0x40, 0x1e, 0x00, 0x22, 0xe1, 0xf1, 0x36,
+	0x00, 0x10, 0x25, 0x36, 0x00, 0xf0, 0x68, 0x70, 0xe7, 0xf5, 0xf7, 0xf1,
+	0xc6, 0x0a, 0xaf, 0xfe, 0x0c, 0x73, 0x09, 0xca, 0x85, 0xe8, 0x3e, 0x09,
+	0xaf, 0xfe, 0x02, 0xc0, 0x22, 0x09, 0x20, 0x00, 0x09, 0xd8, 0x09, 0xca,
+	0x37, 0xe8, 0x25, 0xd9, 0x9f, 0xb9, 0x00, 0x89, 0x33, 0x11, 0x8f, 0x00,
+	0xcd, 0x70, 0x05, 0x7f, 0x22, 0xf0, 0x44, 0x26, 0xc1, 0x17, 0x05, 0xe9,
+	0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x1b, 0x78, 0xeb, 0x78, 0x17, 0xf2,
+	0xc1, 0x40, 0xda, 0x0d, 0x6f, 0xfe, 0x2c, 0x71, 0x02, 0xc1, 0x08, 0x45,
+	0xcf, 0x7b, 0x0c, 0x71, 0xa1, 0x42, 0x3a, 0x09, 0xaf, 0xfe, 0x78, 0x43,
+	0x02, 0xc1, 0x0c, 0x70, 0xa1, 0x42, 0x2e, 0x09, 0xaf, 0xfe, 0x63, 0x43,
+	0x63, 0x41, 0xda, 0x09, 0xaf, 0xfe, 0xa1, 0x40, 0xc5, 0x71, 0xc1, 0x0e,
+	0xb4, 0x90, 0x0c, 0x71, 0xda, 0x08, 0x66, 0x00, 0x02, 0x86, 0x00, 0xf0,
+	0x87, 0x00, 0x00, 0xe5, 0xb8, 0xf8, 0x09, 0x82, 0xfe, 0x02, 0x0b, 0x8f,
+	0xff, 0x04, 0xca, 0x6f, 0x70, 0x4c, 0x70, 0x17, 0xf0, 0x6c, 0x70, 0x12,
+	0xf0, 0x1a, 0x22, 0x81, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x65, 0x79, 0x3b,
+	0x79, 0x05, 0x21, 0x8c, 0x0f, 0x02, 0x90, 0x40, 0x01, 0x32, 0x23, 0x81,
+	0x1f, 0x00, 0x80, 0xf0, 0x07, 0x64, 0x71, 0x65, 0x71, 0x20, 0xb4, 0xdf,
+	0x0b, 0x14, 0x82, 0x44, 0x71, 0xd7, 0x0a, 0x24, 0x80, 0x16, 0x23, 0x8b,
+	0x30, 0x01, 0xc0, 0x05, 0x20, 0x81, 0x0f, 0x05, 0x90, 0x32, 0xe0, 0x03,
+	0xc0, 0x00, 0xb1, 0xde, 0x09, 0xaf, 0xfe, 0x0c, 0x70, 0xfa, 0x0c, 0xc0,
+	0x00, 0x2e, 0x08, 0x60, 0x01, 0x07, 0xd8, 0xab, 0x23, 0xc4, 0x30, 0xff,
+	0x7f, 0x00, 0xf0, 0xe2, 0xc2, 0xcb, 0x45, 0x04, 0x90, 0x04, 0x00, 0x00,
+	0x95, 0xa1, 0xb8, 0x00, 0xb5, 0x3e, 0x0f, 0xaf, 0xff, 0x0c, 0x74, 0x1f,
+	0xd8, 0x36, 0x0f, 0xaf, 0xff, 0xf6, 0x1d, 0x5d, 0x10, 0xc2, 0xc6, 0xe2,
+	0xc2, 0x2a, 0x0f, 0xaf, 0xff, 0x1f, 0xd8, 0x26, 0x00, 0xf2, 0x27, 0xf0,
+	0x01, 0x0c, 0x74, 0x1a, 0x0f, 0xaf, 0xff, 0x00, 0x1d, 0x05, 0x10, 0x0a,
+	0x15, 0x00, 0x97, 0x81, 0xb8, 0x0a, 0x1d, 0x1c, 0x90, 0xc2, 0xc6, 0xf1,
+	0xc0, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x12, 0x00, 0x8c, 0x21, 0x03,
+	0x82, 0xcc, 0x0f, 0x0e, 0x01, 0x0e, 0x08, 0x00, 0x00, 0xd1, 0xc0, 0xe0,
+	0x7e, 0xe0, 0x78, 0xe2, 0xc2, 0xd6, 0x00, 0xf0, 0x01, 0x01, 0x00, 0x1b,
+	0x08, 0x3e, 0x00, 0x0a, 0xd8, 0xcb, 0x45, 0x05, 0x90, 0x36, 0xe0, 0xd6,
+	0x0e, 0x46, 0x00, 0x20, 0x45, 0x10, 0x4a, 0x00, 0xf0, 0xc3, 0xc2, 0xc6,
+	0xc3, 0x40, 0x04, 0x90, 0xf2, 0x00, 0x00, 0x18, 0x45, 0x00, 0xe0, 0x7f,
+	0x00, 0x18, 0x05, 0x00, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0x82, 0x24,
+	0x02, 0x30, 0x08, 0x46, 0x60, 0x40, 0x08, 0xdc, 0x61, 0xbc, 0x01, 0x0c,
+	0x31, 0x10, 0x1d, 0x78, 0x44, 0x20, 0x4d, 0x00, 0xa1, 0x40, 0x78, 0x43,
+	0x4e, 0xc2, 0xe2, 0x0a, 0x2f, 0xff, 0x28, 0x47, 0x53, 0x23, 0xc0, 0x30,
+	0xc3, 0x42, 0x03, 0x90, 0xc4, 0xe0, 0x00, 0xb2, 0xb5, 0x70, 0xf0, 0xd9,
+	0x8a, 0x20, 0x07, 0x0c, 0xca, 0x20, 0x41, 0x00, 0x04, 0x20, 0xc1, 0x06,
+	0x8b, 0xba, 0x20, 0xb2, 0x96, 0xc0, 0x2c, 0x70, 0x28, 0xda, 0xbe, 0x09,
+	0xef, 0xff, 0x96, 0xc3, 0x2f, 0x20, 0xc7, 0x06, 0xb8, 0x20, 0xc3, 0x0f,
+	0x6d, 0xc0, 0xc3, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x4b, 0xc0, 0x20, 0xd8,
+	0x4a, 0xc0, 0xa0, 0x14, 0x00, 0x30, 0x4c, 0x71, 0x46, 0xc3, 0x4f, 0xc0,
+	0x45, 0xc0, 0x9c, 0x14, 0x00, 0x30, 0x44, 0x26, 0xc3, 0x17, 0x30, 0x1c,
+	0xc0, 0x36, 0x50, 0xc0, 0x44, 0xc0, 0x0e, 0xc0, 0x38, 0x43, 0x0e, 0xc1,
+	0x25, 0x1c, 0x02, 0x30, 0x40, 0x40, 0x06, 0xeb, 0x61, 0xbb, 0x01, 0x0b,
+	0x31, 0x00, 0x1b, 0x78, 0x24, 0x1c, 0x03, 0x30, 0x5a, 0x20, 0x00, 0x01,
+	0x48, 0xc7, 0x1c, 0x1c, 0x03, 0x31, 0x43, 0xc6, 0x0f, 0x20, 0x80, 0x03,
+	0x0f, 0x78, 0xda, 0x09, 0x20, 0x00, 0x54, 0xc0, 0x0e, 0xc0, 0x63, 0xb8,
+	0x52, 0xc0, 0x14, 0x73, 0x62, 0x00, 0xf0, 0x0c, 0xff, 0xff, 0x48, 0x00,
+	0x2d, 0x00, 0x51, 0xc0, 0xc3, 0x41, 0x08, 0x90, 0xea, 0x01, 0x00, 0x91,
+	0x04, 0x20, 0x82, 0x0f, 0x00, 0x00, 0xff, 0xc0, 0x04, 0x20, 0x80, 0xc6,
+	0x01, 0xf1, 0x83, 0x3f, 0x80, 0x20, 0x10, 0x00, 0x45, 0x78, 0x00, 0xb1,
+	0x00, 0x1e, 0xc4, 0x76, 0x0f, 0x90, 0x22, 0xe0, 0x00, 0x16, 0x00, 0x71,
+	0x04, 0x90, 0xee, 0x00, 0x50, 0x20, 0x41, 0x01, 0x85, 0xb8, 0x00, 0x1e,
+	0x44, 0x70, 0x05, 0x90, 0xee, 0xe0, 0x51, 0xc0, 0x98, 0x14, 0x00, 0x30,
+	0x55, 0xc0, 0x94, 0x14, 0x00, 0x30, 0x53, 0xc0, 0x96, 0x09, 0x60, 0x00,
+	0x83, 0xc0, 0xcb, 0x46, 0x00, 0x80, 0xcb, 0x07, 0x61, 0x8e, 0x20, 0x8e,
+	0x0e, 0xf0, 0x10, 0xc2, 0x34, 0x7a, 0x00, 0x92, 0x89, 0xe8, 0x96, 0xc0,
+	0xf5, 0x20, 0x40, 0x00, 0x0b, 0x08, 0x33, 0x08, 0x42, 0x20, 0x00, 0x08,
+	0x00, 0xb2, 0x24, 0x71, 0xe7, 0x0b, 0x45, 0x80, 0x0e, 0xc0, 0x04, 0x77,
+	0x39, 0x08, 0xb5, 0x00, 0xb5, 0x70, 0xcb, 0x47, 0x00, 0x00, 0xf0, 0xf0,
+	0xdb, 0x43, 0x00, 0x00, 0xff, 0xff, 0xe1, 0x43, 0x7f, 0x73, 0x0f, 0xd8,
+	0xe1, 0x41, 0xe1, 0x42, 0x42, 0x0e, 0xef, 0xfe, 0x40, 0xc3, 0xb5, 0x70,
+	0xca, 0x23, 0xc2, 0x33, 0x08, 0x12, 0x00, 0xc0, 0x63, 0x43, 0x2e, 0x0e,
+	0xef, 0xfe, 0x00, 0x1c, 0xc0, 0x36, 0x3a, 0x0b, 0x6c, 0x00, 0x00, 0x66,
+	0x00, 0x31, 0x0f, 0xf0, 0x0f, 0x66, 0x00, 0x42, 0x15, 0x08, 0xf1, 0x07,
+	0x68, 0x00, 0x60, 0x09, 0x08, 0x33, 0x08, 0x20, 0xe0, 0x66, 0x00, 0xf0,
+	0x37, 0xe9, 0x0b, 0x45, 0x80, 0x12, 0xc0, 0x0b, 0x08, 0x14, 0x01, 0x76,
+	0x0c, 0xaf, 0xff, 0x14, 0xc0, 0x13, 0xc0, 0x07, 0xe8, 0xc3, 0x41, 0x36,
+	0x00, 0x00, 0x00, 0x2a, 0x0b, 0x6f, 0xfe, 0x0c, 0x74, 0xe0, 0x8e, 0x35,
+	0xf0, 0x10, 0xc0, 0xfd, 0x7d, 0xf5, 0x20, 0xc2, 0x03, 0x0f, 0xc0, 0xf5,
+	0x20, 0xc3, 0x03, 0x58, 0x63, 0x1c, 0x78, 0x48, 0x20, 0x00, 0x00, 0x49,
+	0x20, 0xc1, 0x07, 0x15, 0xc0, 0xf4, 0x78, 0x20, 0xb0, 0x50, 0x4b, 0x10,
+	0x00, 0xa4, 0x4e, 0xc0, 0x13, 0xc0, 0x12, 0xe8, 0x10, 0xc0, 0x63, 0x43,
+	0x2c, 0x00, 0xf1, 0x33, 0xc0, 0x03, 0x42, 0xc1, 0x40, 0xc2, 0x41, 0xc0,
+	0x0c, 0x74, 0xc3, 0x41, 0x38, 0x00, 0x05, 0x00, 0xda, 0x0a, 0x6f, 0xfe,
+	0xa1, 0x42, 0x0e, 0xc0, 0xc3, 0x41, 0x39, 0x00, 0x03, 0x00, 0xa1, 0x42,
+	0x0e, 0x78, 0x40, 0xc0, 0x7f, 0x20, 0x40, 0x01, 0x56, 0x0d, 0xef, 0xfd,
+	0x63, 0x43, 0xe5, 0x71, 0x01, 0x8e, 0x97, 0x08, 0xe5, 0x83, 0x44, 0x27,
+	0x5b, 0x10, 0x12, 0xc0, 0x35, 0x08, 0x15, 0x01, 0xc3, 0x42, 0x7a, 0x01,
+	0x30, 0x92, 0x04, 0x20, 0x38, 0x03, 0x06, 0x7a, 0x01, 0x12, 0x00, 0x82,
+	0x01, 0xa1, 0xfc, 0x25, 0x78, 0x00, 0xb2, 0x11, 0xc0, 0x00, 0x1e, 0x04,
+	0x6a, 0x01, 0xf2, 0x05, 0x00, 0x1e, 0x05, 0x70, 0x03, 0x90, 0x04, 0xe0,
+	0x80, 0x24, 0x02, 0x30, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xe0, 0x78,
+	0x88, 0x02, 0xf0, 0x34, 0xad, 0xc1, 0x48, 0xc2, 0x38, 0x43, 0x16, 0x0c,
+	0xef, 0xfe, 0x46, 0xc0, 0x42, 0x23, 0xcd, 0x30, 0x47, 0xc0, 0x7e, 0x09,
+	0x6f, 0xfe, 0xaf, 0x7e, 0x33, 0x0d, 0x34, 0x11, 0x44, 0xc0, 0x0c, 0x70,
+	0x82, 0x0d, 0x2f, 0xfe, 0x2c, 0x70, 0x00, 0x12, 0x83, 0x30, 0x0c, 0x70,
+	0x81, 0xd9, 0x43, 0xc0, 0x42, 0xc0, 0x41, 0xc0, 0x40, 0xc0, 0xff, 0xd8,
+	0x8e, 0xb9, 0x3e, 0x0e, 0x2f, 0xfe, 0x4c, 0x75, 0x0c, 0x70, 0xf6, 0x22,
+	0x00, 0xf1, 0x29, 0x71, 0x0c, 0x73, 0x3c, 0x20, 0x81, 0x03, 0x42, 0x23,
+	0x4e, 0x30, 0xcf, 0x78, 0xed, 0x71, 0x3c, 0x27, 0x00, 0x10, 0x04, 0x20,
+	0x40, 0x80, 0x45, 0xc0, 0x04, 0xc0, 0xca, 0x27, 0x22, 0x12, 0x14, 0x70,
+	0xe1, 0x40, 0xcf, 0x20, 0xa2, 0x00, 0xb5, 0x74, 0x26, 0x0c, 0xef, 0xfe,
+	0xca, 0x27, 0x05, 0x10, 0x2a, 0x0c, 0xef, 0xfe, 0x4a, 0xc0, 0x4c, 0xb0,
+	0x02, 0xf0, 0x38, 0x10, 0x27, 0x1a, 0x0c, 0xaf, 0xff, 0x08, 0xd9, 0xc3,
+	0x41, 0x0f, 0x90, 0xc0, 0xe0, 0x4b, 0xc0, 0xe0, 0xb1, 0x05, 0xc0, 0xcb,
+	0x47, 0xff, 0xff, 0xf0, 0xf0, 0x14, 0x70, 0x8a, 0x20, 0xc7, 0x0f, 0xc0,
+	0x78, 0x05, 0xb1, 0x04, 0xc0, 0x2c, 0x77, 0x45, 0xc1, 0x14, 0x70, 0x20,
+	0x40, 0xfd, 0x70, 0x45, 0xc0, 0x3c, 0x77, 0x0a, 0xc1, 0x07, 0xc0, 0x14,
+	0x21, 0x00, 0x00, 0xe8, 0x48, 0xc0, 0xb9, 0x38, 0x60, 0x2b, 0x0e, 0xb5,
+	0x10, 0x44, 0x3c, 0x02, 0xd0, 0x00, 0xf0, 0xf0, 0xf0, 0x7b, 0x0f, 0xd8,
+	0xc1, 0x41, 0xc1, 0x42, 0x42, 0x0c, 0x00, 0x02, 0x20, 0x05, 0xc0, 0x0c,
+	0x00, 0x51, 0x10, 0x7b, 0x08, 0xd8, 0x32, 0x10, 0x00, 0xf0, 0x17, 0x04,
+	0xc0, 0x30, 0xe0, 0x49, 0xc0, 0x4f, 0x23, 0x40, 0x30, 0x99, 0x08, 0xb1,
+	0x00, 0xb5, 0x73, 0x06, 0xc0, 0xc1, 0xb8, 0x44, 0xc0, 0x07, 0xc0, 0x0f,
+	0x79, 0x96, 0x0c, 0x2f, 0xfe, 0x0c, 0x70, 0x2c, 0x70, 0xad, 0x70, 0x6f,
+	0x71, 0xe0, 0x00, 0xf1, 0x0d, 0x4c, 0x75, 0x6c, 0x74, 0x43, 0xc5, 0x42,
+	0xc5, 0x04, 0x1c, 0xc0, 0x36, 0x52, 0x0d, 0x2f, 0xfe, 0x40, 0xc5, 0x06,
+	0xc0, 0x2c, 0x70, 0x4c, 0x70, 0x0f, 0x7f, 0xff, 0xd8, 0x1a, 0x00, 0x41,
+	0xc7, 0x41, 0xc5, 0x3a, 0x18, 0x00, 0x10, 0x04, 0x18, 0x00, 0x32, 0x76,
+	0x42, 0xc0, 0x18, 0x00, 0x00, 0x30, 0x00, 0x19, 0x22, 0x18, 0x00, 0xb1,
+	0x0c, 0x75, 0x41, 0xc0, 0xff, 0xd8, 0x28, 0xdb, 0x43, 0xc5, 0x0a, 0x18,
+	0x00, 0x71, 0x52, 0x0f, 0x2f, 0xfe, 0xff, 0xd8, 0x08, 0xb0, 0x00, 0xf2,
+	0x09, 0x00, 0x31, 0x14, 0x70, 0x2a, 0x02, 0x21, 0x00, 0xff, 0xd8, 0xf3,
+	0x02, 0x20, 0x00, 0x0c, 0x1c, 0x41, 0x34, 0x4c, 0x04, 0x2d, 0x00, 0x77,
+	0x71, 0x58, 0x04, 0xf2, 0x03, 0x13, 0x00, 0x14, 0x70, 0xd4, 0x05, 0x21,
+	0x00, 0x77, 0x73, 0x08, 0x46, 0x9a, 0x26, 0x04, 0x10, 0x05, 0x7e, 0xdc,
+	0x00, 0x80, 0xc1, 0x43, 0x66, 0x0b, 0xef, 0xfe, 0x40, 0xc6, 0xb8, 0x00,
+	0x81, 0x0c, 0x70, 0xde, 0x0b, 0x2f, 0xfe, 0x38, 0x43, 0x9e, 0x00, 0x90,
+	0x73, 0x0f, 0x7f, 0x20, 0xd8, 0x41, 0xc0, 0xcf, 0x78, 0xa4, 0x01, 0x60,
+	0x22, 0xdb, 0x28, 0x45, 0x43, 0xc1, 0xd8, 0x00, 0xf4, 0x17, 0x42, 0xc7,
+	0x28, 0xd8, 0x41, 0xc0, 0x08, 0xd8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00,
+	0xdd, 0x7e, 0x2c, 0x70, 0xff, 0xd8, 0x4c, 0x73, 0x22, 0xdb, 0x43, 0xc5,
+	0x42, 0xc7, 0x76, 0x0c, 0x2f, 0xfe, 0x40, 0xc6, 0xff, 0xd8, 0x2c, 0x70,
+	0x12, 0x00, 0x50, 0x04, 0x1c, 0xc1, 0x33, 0x62, 0x16, 0x00, 0x56, 0xc5,
+	0xff, 0xd8, 0x80, 0xd9, 0x16, 0x00, 0x31, 0x01, 0x35, 0x4a, 0x16, 0x00,
+	0x73, 0x0c, 0x70, 0x02, 0x0c, 0x2f, 0xfe, 0x2c, 0xa4, 0x00, 0xf0, 0x1b,
+	0x04, 0x00, 0xe0, 0xda, 0x1a, 0x20, 0x81, 0x0f, 0x20, 0x00, 0x00, 0x00,
+	0xc3, 0x40, 0x08, 0x90, 0x00, 0x01, 0x05, 0x21, 0x03, 0x00, 0x04, 0x72,
+	0x25, 0x78, 0x40, 0xb3, 0x00, 0x18, 0x85, 0x04, 0x0c, 0x70, 0x3e, 0x0b,
+	0x2f, 0xfe, 0x63, 0x41, 0x5a, 0x0e, 0xf6, 0x00, 0x60, 0xcd, 0x70, 0x90,
+	0xbe, 0x68, 0xf9, 0x78, 0x00, 0x40, 0x41, 0xc5, 0xfe, 0x0b, 0x56, 0x01,
+	0xa4, 0xff, 0xd8, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x20, 0x4c, 0x73, 0x56,
+	0x01, 0x31, 0x40, 0xc5, 0xe2, 0xd2, 0x00, 0x13, 0x5e, 0x28, 0x00, 0x11,
+	0xd6, 0x28, 0x00, 0x13, 0x57, 0x0e, 0x00, 0x19, 0xc6, 0x0e, 0x00, 0x11,
+	0xba, 0x0e, 0x00, 0x13, 0x50, 0x1c, 0x00, 0x19, 0xaa, 0x0e, 0x00, 0x11,
+	0x9e, 0x0e, 0x00, 0x13, 0x49, 0x1c, 0x00, 0x19, 0x8e, 0x0e, 0x00, 0x11,
+	0x82, 0x0e, 0x00, 0x13, 0x42, 0x1c, 0x00, 0x19, 0x72, 0x0e, 0x00, 0x11,
+	0x66, 0x0e, 0x00, 0x13, 0x3b, 0x1c, 0x00, 0x19, 0x56, 0x0e, 0x00, 0x11,
+	0x4a, 0x0e, 0x00, 0x13, 0x34, 0x1c, 0x00, 0x19, 0x3a, 0x0e, 0x00, 0x11,
+	0x2e, 0x0e, 0x00, 0x13, 0x2d, 0x1c, 0x00, 0x11, 0x1e, 0x0e, 0x00, 0x10,
+	0x09, 0x1c, 0x02, 0x50, 0x75, 0x0f, 0x7b, 0xff, 0xd8, 0x4c, 0x02, 0x31,
+	0x41, 0xc5, 0x0a, 0x16, 0x00, 0x40, 0xdd, 0x79, 0xff, 0xd8, 0x60, 0x02,
+	0xa0, 0x0c, 0x1c, 0x81, 0x30, 0x42, 0xc5, 0x41, 0xc5, 0xf2, 0x0a, 0x0a,
+	0x01, 0x10, 0x1c, 0x3a, 0x00, 0x41, 0xc5, 0x41, 0xc5, 0xe6, 0x0e, 0x00,
+	0x20, 0x0e, 0x0d, 0x30, 0x01, 0x02, 0x36, 0x00, 0xa4, 0xbd, 0x03, 0x20,
+	0x00, 0x40, 0xc5, 0xc1, 0x41, 0x4c, 0x72, 0x24, 0x01, 0x11, 0xc2, 0x24,
+	0x00, 0x10, 0x0c, 0x32, 0x00, 0x10, 0xc7, 0x72, 0x02, 0x11, 0xb2, 0x10,
+	0x00, 0xb1, 0x05, 0xf9, 0x0c, 0x1c, 0xc0, 0x36, 0x42, 0xc7, 0x41, 0xc5,
+	0xa2, 0x10, 0x00, 0x22, 0xfe, 0xf8, 0x6a, 0x01, 0x11, 0x92, 0x0e, 0x00,
+	0x00, 0x88, 0x02, 0x11, 0x00, 0x32, 0x00, 0x11, 0x82, 0x10, 0x00, 0x24,
+	0xfa, 0xf8, 0x2e, 0x00, 0x11, 0x72, 0x10, 0x00, 0x60, 0x0c, 0x75, 0x43,
+	0xc0, 0xf5, 0xf8, 0x3e, 0x00, 0x11, 0x62, 0x10, 0x00, 0x13, 0xef, 0x3e,
+	0x00, 0x11, 0x56, 0x0e, 0x00, 0x0e, 0xe6, 0x02, 0x11, 0x3e, 0x18, 0x00,
+	0x15, 0xe8, 0x46, 0x00, 0x11, 0x2e, 0x10, 0x00, 0x13, 0xe1, 0x36, 0x00,
+	0x11, 0x1e, 0x0e, 0x00, 0x04, 0x36, 0x00, 0x00, 0x7c, 0x00, 0x02, 0x20,
+	0x03, 0x11, 0x06, 0x18, 0x00, 0x00, 0x7a, 0x00, 0x11, 0xda, 0x6c, 0x00,
+	0x20, 0xf6, 0x09, 0xfc, 0x00, 0xc0, 0x09, 0xc0, 0xad, 0x70, 0x2c, 0x70,
+	0x0f, 0x78, 0x45, 0xc0, 0x05, 0xc3, 0x1c, 0x01, 0x02, 0xf8, 0x00, 0x11,
+	0xda, 0x1c, 0x00, 0x03, 0x2a, 0x03, 0xf2, 0x00, 0x21, 0x14, 0x70, 0x6c,
+	0xf2, 0x4c, 0x71, 0xff, 0xd8, 0xc1, 0x41, 0x6c, 0x74, 0x58, 0x43, 0xda,
+	0x00, 0x11, 0xba, 0x22, 0x00, 0x11, 0xca, 0x74, 0x00, 0x00, 0x08, 0x01,
+	0x11, 0xaa, 0x10, 0x00, 0x15, 0xbd, 0x94, 0x00, 0x11, 0x9a, 0x10, 0x00,
+	0x11, 0xcb, 0x20, 0x00, 0x31, 0x41, 0xc5, 0x8a, 0x0e, 0x00, 0x00, 0x8c,
+	0x00, 0x11, 0xbe, 0x12, 0x00, 0x11, 0x7a, 0x10, 0x00, 0x15, 0xb2, 0x2e,
+	0x00, 0x11, 0x6a, 0x10, 0x00, 0x00, 0x08, 0x01, 0x11, 0xad, 0x9c, 0x00,
+	0x11, 0x5a, 0x10, 0x00, 0x11, 0xbc, 0x2c, 0x00, 0x31, 0x41, 0xc5, 0x4e,
+	0x0e, 0x00, 0x04, 0xd2, 0x00, 0x02, 0xce, 0x00, 0x00, 0x74, 0x00, 0x11,
+	0x36, 0x18, 0x00, 0x15, 0xa0, 0x46, 0x00, 0x11, 0x26, 0x10, 0x00, 0x13,
+	0xae, 0x36, 0x00, 0x11, 0x16, 0x0e, 0x00, 0x04, 0x36, 0x00, 0x00, 0x7c,
+	0x00, 0x02, 0x3a, 0x00, 0x20, 0xfe, 0x08, 0xf8, 0x00, 0x00, 0x08, 0x01,
+	0x20, 0x04, 0xf0, 0xf8, 0x03, 0x11, 0x90, 0x72, 0x00, 0x11, 0xea, 0x16,
+	0x00, 0xb0, 0x05, 0xc3, 0x8a, 0xf8, 0x43, 0xc1, 0x42, 0xc1, 0x41, 0xc1,
+	0xda, 0x10, 0x00, 0x61, 0xc1, 0x80, 0xf8, 0x0c, 0x1c, 0xc1, 0x2a, 0x02,
+	0x10, 0xca, 0x10, 0x00, 0x20, 0xc5, 0x91, 0x5c, 0x00, 0x41, 0xc5, 0x41,
+	0xc5, 0xba, 0x0e, 0x00, 0x00, 0x30, 0x02, 0xe1, 0xff, 0xd8, 0x04, 0xc0,
+	0x43, 0xc5, 0x41, 0xc5, 0x42, 0xc0, 0x00, 0x1c, 0x41, 0x30, 0xb8, 0x03,
+	0xf0, 0x04, 0x76, 0xc7, 0xf0, 0xc8, 0xf4, 0x0b, 0xc0, 0xcd, 0x70, 0x1d,
+	0x79, 0x0c, 0xc0, 0x19, 0x61, 0x18, 0x49, 0xc0, 0xb8, 0x06, 0x00, 0xa0,
+	0x4a, 0xc0, 0x0c, 0x70, 0x62, 0xf0, 0x04, 0xc0, 0xcb, 0x45, 0x30, 0x07,
+	0xf0, 0x03, 0x14, 0x70, 0xc0, 0x7d, 0x0f, 0xd8, 0xa1, 0x41, 0xa1, 0x42,
+	0x12, 0x0f, 0xaf, 0xfe, 0x40, 0xc3, 0x05, 0xc0, 0x0c, 0x00, 0x00, 0x30,
+	0x05, 0x11, 0x02, 0x10, 0x00, 0x80, 0x0c, 0x70, 0x7e, 0x0f, 0xef, 0xfd,
+	0x63, 0x41, 0x02, 0x06, 0x13, 0x65, 0x94, 0x00, 0x10, 0x46, 0x76, 0x00,
+	0x23, 0xc1, 0x5e, 0x84, 0x00, 0x10, 0x36, 0x0e, 0x00, 0x50, 0xc5, 0x06,
+	0xc0, 0x6f, 0x73, 0xc0, 0x01, 0x20, 0x48, 0xc0, 0x08, 0x05, 0x40, 0x4c,
+	0x72, 0x08, 0xdb, 0xda, 0x00, 0xb0, 0x41, 0xc5, 0x1a, 0x08, 0x2f, 0xfe,
+	0x00, 0x1c, 0x81, 0x32, 0x08, 0x08, 0x03, 0x10, 0x72, 0x1c, 0x00, 0x04,
+	0x1a, 0x00, 0x61, 0xfe, 0x0f, 0xef, 0xfd, 0x40, 0xc5, 0x78, 0x04, 0x03,
+	0x2e, 0x00, 0x00, 0x0a, 0x03, 0x40, 0xea, 0x0f, 0xef, 0xfd, 0x30, 0x00,
+	0x57, 0x0a, 0xc0, 0x80, 0xd9, 0x4c, 0x38, 0x03, 0x11, 0xd2, 0x2e, 0x00,
+	0xc0, 0x0c, 0x70, 0x8a, 0x0f, 0xef, 0xfd, 0x2c, 0x71, 0x04, 0xc0, 0x04,
+	0x71, 0xb6, 0x05, 0xf4, 0x01, 0x2f, 0x23, 0x07, 0x30, 0x04, 0xc0, 0x37,
+	0x08, 0xb4, 0x80, 0xf0, 0x7b, 0x0c, 0x70, 0xd6, 0x0e, 0xaa, 0x00, 0x01,
+	0x56, 0x00, 0x80, 0x75, 0x43, 0xc6, 0x42, 0xc6, 0x41, 0xc6, 0x96, 0x3a,
+	0x00, 0x30, 0xc6, 0xde, 0x09, 0x4e, 0x03, 0x22, 0x31, 0xf8, 0x14, 0x00,
+	0x11, 0x82, 0x14, 0x00, 0xf0, 0x01, 0x08, 0xca, 0x2c, 0x70, 0x4c, 0x71,
+	0x43, 0xc0, 0x06, 0xc0, 0x08, 0xdb, 0x41, 0xc6, 0x0f, 0x78, 0x9e, 0x00,
+	0x11, 0x6a, 0x1a, 0x00, 0x02, 0xb6, 0x03, 0x41, 0x54, 0x20, 0x80, 0x0c,
+	0xba, 0x03, 0x01, 0x48, 0x00, 0x11, 0x4e, 0x1a, 0x00, 0x21, 0x1e, 0xf8,
+	0xb4, 0x03, 0x41, 0xc6, 0x41, 0xc6, 0x3e, 0x10, 0x00, 0x02, 0x6a, 0x00,
+	0x22, 0x50, 0xdb, 0x58, 0x00, 0x11, 0x2a, 0x14, 0x00, 0x11, 0x56, 0x6c,
+	0x00, 0x02, 0x12, 0x00, 0x00, 0x5a, 0x05, 0x00, 0xca, 0x00, 0x82, 0x12,
+	0x0f, 0xef, 0xfd, 0x6c, 0x74, 0xad, 0xc0, 0x7e, 0x07, 0xf0, 0x07, 0xcb,
+	0x46, 0x00, 0x00, 0xaa, 0xaa, 0x14, 0xf2, 0x17, 0x0b, 0x90, 0x31, 0x1b,
+	0x0b, 0x50, 0x31, 0x1d, 0x0b, 0x31, 0x31, 0xcd, 0x70, 0x16, 0x00, 0x40,
+	0xcc, 0xcc, 0x08, 0xf0, 0x08, 0x00, 0x31, 0x82, 0x82, 0x04, 0x08, 0x00,
+	0x60, 0xb2, 0xb2, 0x0f, 0x02, 0xcf, 0xff, 0xb0, 0x05, 0x20, 0x8f, 0xb9,
+	0x32, 0x04, 0x22, 0xe0, 0x7e, 0x72, 0x00, 0x20, 0x6c, 0x72, 0x80, 0x0a,
+	0x00, 0x18, 0x00, 0x40, 0x4c, 0x75, 0x28, 0x45, 0x0c, 0x00, 0x00, 0x18,
+	0x03, 0x45, 0x4c, 0x71, 0x08, 0xdb, 0x0c, 0x00, 0x36, 0x72, 0x6c, 0x74,
+	0x0c, 0x00, 0x04, 0x18, 0x00, 0x00, 0xc2, 0x06, 0x04, 0x18, 0x00, 0x53,
+	0x2c, 0x70, 0x4c, 0x75, 0x30, 0x30, 0x00, 0x20, 0x63, 0x41, 0x80, 0x05,
+	0x05, 0x30, 0x00, 0x12, 0x71, 0x24, 0x00, 0x02, 0x24, 0x08, 0x40, 0xa6,
+	0xc1, 0x08, 0x46, 0xc2, 0x09, 0xe0, 0x08, 0x90, 0xe0, 0x01, 0x8a, 0x21,
+	0xfd, 0x0f, 0x45, 0xc0, 0x24, 0x78, 0x42, 0xc0, 0x12, 0x00, 0xf0, 0x01,
+	0x0e, 0x90, 0x4c, 0x00, 0x40, 0xc0, 0x19, 0x8e, 0x44, 0xc0, 0x10, 0x8e,
+	0x43, 0xc0, 0xc3, 0x40, 0x10, 0x00, 0x82, 0x01, 0x90, 0x41, 0xc0, 0x04,
+	0xc0, 0x8a, 0xe8, 0x28, 0x0a, 0xc0, 0x00, 0x41, 0x00, 0x42, 0xfe, 0x0c,
+	0xaf, 0xfe, 0x00, 0x43, 0x0f, 0xd8, 0x18, 0x01, 0xf0, 0x13, 0x0f, 0xd9,
+	0x08, 0x86, 0xad, 0x70, 0x1b, 0x78, 0x05, 0x20, 0x80, 0x0f, 0x03, 0x90,
+	0x64, 0xe0, 0xe6, 0x0c, 0xaf, 0xff, 0xa0, 0xb0, 0x29, 0x86, 0xba, 0x0a,
+	0xa0, 0x00, 0x0c, 0x71, 0x02, 0xc0, 0x2c, 0x71, 0xb4, 0x08, 0x60, 0x09,
+	0x90, 0xe0, 0xe1, 0xc3, 0x40, 0x20, 0x00, 0xf0, 0x05, 0x42, 0x20, 0x8f,
+	0x09, 0xa0, 0xb7, 0xa0, 0xb7, 0x9c, 0x1f, 0x5c, 0x13, 0x9b, 0x1f, 0x5c,
+	0x13, 0xe6, 0x1f, 0x84, 0x9f, 0xb8, 0x02, 0xf1, 0x14, 0xf2, 0x1f, 0x44,
+	0x90, 0xe4, 0x1f, 0x44, 0x90, 0x7a, 0x0d, 0xef, 0xfd, 0x0e, 0x96, 0x00,
+	0xc1, 0x01, 0xc2, 0xaa, 0x0c, 0x60, 0x00, 0xc1, 0x40, 0x0f, 0xd8, 0xee,
+	0x08, 0x2f, 0xfe, 0x0f, 0xd9, 0x29, 0x86, 0x66, 0x52, 0x00, 0x17, 0x05,
+	0x52, 0x00, 0x22, 0xa0, 0xb7, 0x3e, 0x00, 0x24, 0x00, 0xff, 0x3e, 0x00,
+	0xf0, 0x01, 0x3a, 0x0d, 0xef, 0xfd, 0x0a, 0x96, 0x58, 0x8e, 0x01, 0x86,
+	0xde, 0x0b, 0x60, 0x00, 0x2c, 0x71, 0x48, 0x00, 0x13, 0x62, 0x48, 0x00,
+	0x11, 0xa6, 0x48, 0x00, 0xf0, 0x03, 0x04, 0xc0, 0x07, 0xe8, 0x03, 0xc0,
+	0xba, 0x0f, 0xef, 0xfd, 0x78, 0x20, 0x00, 0x01, 0x11, 0xf0, 0x03, 0xc0,
+	0xae, 0x06, 0x60, 0xff, 0xff, 0x20, 0x42, 0x14, 0x74, 0xe2, 0x00, 0x60,
+	0xfe, 0xff, 0xca, 0x22, 0x01, 0x00, 0x98, 0x0b, 0x66, 0x16, 0x0c, 0xaf,
+	0xfe, 0x20, 0x43, 0x16, 0x01, 0x06, 0x0e, 0x01, 0x11, 0x02, 0x88, 0x09,
+	0x00, 0xd4, 0x00, 0x40, 0x03, 0xc0, 0x29, 0x86, 0x48, 0x00, 0xf7, 0x00,
+	0x1b, 0x78, 0x1b, 0x78, 0x04, 0x75, 0xc6, 0x09, 0xa0, 0x00, 0x42, 0xc0,
+	0x08, 0x86, 0x6f, 0x10, 0x01, 0xf2, 0x07, 0xd6, 0x0b, 0xaf, 0xff, 0x00,
+	0x18, 0xc4, 0x06, 0x2c, 0x71, 0x00, 0x1f, 0xc4, 0x16, 0x9c, 0x1f, 0xdc,
+	0x16, 0x9b, 0x1f, 0xdc, 0x16, 0xb8, 0x00, 0x15, 0xff, 0xb8, 0x00, 0x80,
+	0x0e, 0x96, 0x82, 0x0c, 0xef, 0xfd, 0x28, 0x45, 0xb0, 0x00, 0x20, 0xb2,
+	0x0b, 0xf8, 0x00, 0x44, 0x05, 0xc0, 0x0f, 0xd9, 0x3a, 0x01, 0x21, 0x0f,
+	0xd8, 0x46, 0x03, 0xb2, 0x1f, 0xc4, 0x16, 0x29, 0x86, 0x62, 0x09, 0xa0,
+	0x00, 0x02, 0xc0, 0x40, 0x00, 0x01, 0xf8, 0x00, 0xf0, 0x02, 0x93, 0xe4,
+	0x1f, 0x44, 0x93, 0x05, 0x86, 0x2c, 0x71, 0x04, 0x71, 0x3e, 0x0c, 0xef,
+	0xfd, 0x10, 0x78, 0x44, 0x00, 0x11, 0x6e, 0x44, 0x00, 0xf0, 0x05, 0x04,
+	0xc0, 0x06, 0xe8, 0x03, 0xc0, 0xce, 0x0e, 0xef, 0xfd, 0x79, 0x20, 0x00,
+	0x01, 0x58, 0x8e, 0x03, 0x86, 0xc6, 0x0a, 0x16, 0x01, 0x13, 0xa6, 0xb6,
+	0x02, 0x04, 0x34, 0x0a, 0x1b, 0xa8, 0x10, 0x02, 0x59, 0x47, 0xc0, 0x24,
+	0x78, 0x45, 0x10, 0x02, 0x57, 0x43, 0xc0, 0x10, 0x8e, 0x42, 0x10, 0x02,
+	0x19, 0x03, 0x10, 0x02, 0x22, 0xee, 0x0a, 0x10, 0x02, 0xf5, 0x06, 0x46,
+	0x0f, 0xef, 0xfd, 0x0f, 0xd9, 0x02, 0xc1, 0x08, 0x86, 0x79, 0x21, 0x01,
+	0x01, 0x52, 0x0b, 0xaf, 0xfe, 0x44, 0xc1, 0x05, 0x2c, 0x01, 0xf0, 0x03,
+	0x29, 0x86, 0xa6, 0x08, 0xa0, 0x00, 0x0c, 0x73, 0xad, 0x70, 0xcb, 0x47,
+	0x03, 0x90, 0x3e, 0xe0, 0xa0, 0xb7, 0x00, 0x02, 0x00, 0x08, 0x02, 0x02,
+	0xce, 0x00, 0x00, 0x0e, 0x01, 0xa0, 0x45, 0x90, 0xe4, 0x1f, 0x45, 0x90,
+	0x0e, 0x96, 0x72, 0x0b, 0x16, 0x04, 0x00, 0xca, 0x00, 0x20, 0xa6, 0x0a,
+	0x0e, 0x01, 0x40, 0x0f, 0xd8, 0xea, 0x0e, 0x5c, 0x00, 0x19, 0x07, 0xfe,
+	0x01, 0x22, 0x4e, 0x0b, 0xee, 0x01, 0x40, 0x02, 0x86, 0xee, 0x09, 0xd8,
+	0x00, 0x00, 0x30, 0x00, 0x13, 0x76, 0x30, 0x00, 0x11, 0xba, 0x30, 0x00,
+	0xd3, 0x03, 0xc0, 0x06, 0xe8, 0xce, 0x0d, 0xef, 0xfd, 0x04, 0xc0, 0x12,
+	0xf0, 0x02, 0xea, 0x01, 0xf8, 0x05, 0xc3, 0x42, 0x00, 0x00, 0xfe, 0xff,
+	0x14, 0x74, 0x20, 0x40, 0xca, 0x20, 0x81, 0x00, 0xca, 0x22, 0x41, 0x00,
+	0x2e, 0x0a, 0xea, 0x01, 0x15, 0x46, 0xe8, 0x00, 0x26, 0x40, 0xc0, 0xbe,
+	0x00, 0x40, 0x04, 0xc0, 0x29, 0x86, 0xe6, 0x01, 0xf2, 0x03, 0x07, 0xe0,
+	0xde, 0x0f, 0x60, 0x00, 0x41, 0xc0, 0x08, 0x86, 0x72, 0x0a, 0xaf, 0xfe,
+	0x04, 0xc1, 0x6f, 0x70, 0xda, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xde, 0x01,
+	0x06, 0xcc, 0x00, 0x02, 0xd0, 0x02, 0x40, 0x0e, 0x96, 0xa6, 0x0a, 0xda,
+	0x01, 0xa0, 0x06, 0xc1, 0x00, 0xc2, 0xda, 0x09, 0x60, 0x00, 0xc1, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0xda, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18,
+	0x60, 0x40, 0x82, 0xcb, 0x0e, 0x00, 0x00, 0xf1, 0x7f, 0x07, 0xc0, 0x0f,
+	0xd9, 0x00, 0x1e, 0x04, 0x70, 0x09, 0x90, 0xe0, 0xe1, 0x0f, 0xd8, 0x12,
+	0x0e, 0xef, 0xfd, 0x00, 0x1f, 0xc4, 0x16, 0x29, 0x86, 0x86, 0x0f, 0x60,
+	0x00, 0x01, 0xc0, 0xc3, 0x40, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x1f, 0x04,
+	0x90, 0xf2, 0x1f, 0x44, 0x93, 0xe4, 0x1f, 0x44, 0x93, 0x05, 0x86, 0x2c,
+	0x71, 0x04, 0x71, 0x62, 0x0a, 0xef, 0xfd, 0x10, 0x78, 0x06, 0xc1, 0x00,
+	0xc2, 0x92, 0x09, 0x60, 0x00, 0xc1, 0x40, 0x03, 0xc0, 0x06, 0xe8, 0x02,
+	0xc0, 0xf2, 0x0c, 0xef, 0xfd, 0x78, 0x20, 0x00, 0x01, 0x58, 0x8e, 0x03,
+	0x86, 0xea, 0x08, 0x60, 0x00, 0x2c, 0x71, 0xa8, 0xc0, 0x04, 0x14, 0x1b,
+	0x34, 0xc6, 0xc6, 0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0x82,
+	0x24, 0x03, 0x35, 0x40, 0xc1, 0xf6, 0x0d, 0xef, 0xfd, 0x2c, 0x71, 0x00,
+	0x16, 0x83, 0x70, 0x00, 0x80, 0x04, 0x00, 0x43, 0xc0, 0x88, 0xc0, 0xff,
+	0xd9, 0x52, 0x0b, 0x6f, 0xff, 0xb4, 0xda, 0x70, 0x00, 0x10, 0x21, 0x90,
+	0x00, 0x62, 0x03, 0x90, 0x04, 0xe0, 0x0c, 0x70, 0x0a, 0x00, 0xf0, 0x4b,
+	0xc4, 0xfe, 0x00, 0xc0, 0xad, 0x71, 0x79, 0x20, 0x00, 0x00, 0x98, 0x48,
+	0x5f, 0x20, 0x00, 0x02, 0x45, 0xc1, 0x42, 0xc0, 0x02, 0xc1, 0x11, 0xf0,
+	0x41, 0x69, 0x9a, 0x21, 0x08, 0x00, 0xa9, 0x44, 0x05, 0xe8, 0x61, 0xb8,
+	0xff, 0x08, 0x31, 0x80, 0x9b, 0x7c, 0x05, 0x21, 0x80, 0x0f, 0x03, 0x90,
+	0xc4, 0xe0, 0x80, 0xb0, 0x40, 0x41, 0x05, 0xc0, 0xe1, 0x09, 0x24, 0x80,
+	0x44, 0x21, 0xc0, 0x07, 0x1a, 0x23, 0x83, 0x0f, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x16, 0x9b, 0x70, 0x00, 0x80, 0xcd, 0x07, 0x46, 0xc3, 0x98, 0xe5,
+	0xd8, 0x01, 0x0d, 0x00, 0xc3, 0x40, 0x0e, 0x00, 0xfa, 0x25, 0x21, 0x88,
+	0x15, 0xf0, 0x03, 0xc0, 0x55, 0x20, 0xc2, 0x08, 0x06, 0xc0, 0x05, 0x7a,
+	0xef, 0xd8, 0x04, 0x20, 0xc0, 0x06, 0x1a, 0x20, 0x80, 0x0f, 0x00, 0x00,
+	0x00, 0x10, 0x67, 0x71, 0x45, 0x78, 0x1b, 0x78, 0x05, 0x20, 0x80, 0x0f,
+	0x02, 0x90, 0x00, 0x1e, 0xa0, 0xb0, 0x2f, 0x20, 0xc7, 0x06, 0xd7, 0x09,
+	0x05, 0x80, 0xa8, 0x00, 0xf0, 0x3d, 0x00, 0xc0, 0xc3, 0x41, 0x03, 0x90,
+	0x64, 0xfe, 0x14, 0x70, 0xc3, 0x40, 0x03, 0x90, 0x64, 0xf0, 0x1c, 0x71,
+	0x6e, 0x08, 0xaf, 0xff, 0x00, 0x19, 0x05, 0x00, 0x66, 0x08, 0x8f, 0xff,
+	0x0f, 0xd8, 0xba, 0x0c, 0xef, 0xfd, 0x0f, 0xd9, 0x0c, 0x73, 0x32, 0x0e,
+	0x60, 0x00, 0x8a, 0x21, 0xc7, 0x0f, 0x7f, 0xdf, 0xcb, 0x46, 0x03, 0x90,
+	0x24, 0xe0, 0x0c, 0x71, 0xe0, 0xb6, 0x44, 0xc0, 0x06, 0xb6, 0x8a, 0x20,
+	0xc4, 0x03, 0xfe, 0x1e, 0x04, 0x90, 0x18, 0xd8, 0x0a, 0x09, 0x1a, 0x01,
+	0x42, 0x8a, 0x20, 0x04, 0x00, 0xfa, 0x00, 0x51, 0x04, 0xe0, 0x0f, 0xd8,
+	0x7e, 0x3e, 0x00, 0x40, 0x07, 0xd8, 0xee, 0x08, 0x1c, 0x00, 0x00, 0x34,
+	0x00, 0xf1, 0x02, 0x06, 0xb6, 0x0f, 0xd8, 0x0f, 0xd9, 0x66, 0x0c, 0xef,
+	0xfd, 0xfe, 0x1e, 0xc5, 0x93, 0x0c, 0x73, 0xd2, 0x1a, 0x00, 0x31, 0x0f,
+	0xd8, 0x52, 0x2a, 0x00, 0xe0, 0x0c, 0x70, 0x2c, 0x71, 0x00, 0x1e, 0xc5,
+	0x1f, 0x0c, 0x1e, 0xc5, 0x1f, 0xba, 0x08, 0x24, 0x00, 0x22, 0x05, 0x90,
+	0xea, 0x00, 0x31, 0x00, 0x16, 0x81, 0x00, 0x01, 0xf1, 0x04, 0x01, 0x88,
+	0x0a, 0x26, 0x80, 0x3f, 0x02, 0x90, 0x64, 0x00, 0x38, 0x43, 0x47, 0xc0,
+	0x5f, 0xf0, 0x1a, 0x22, 0x9f, 0xee, 0x00, 0xf0, 0x4b, 0x02, 0xc6, 0x00,
+	0xc4, 0x53, 0xf0, 0x5f, 0x22, 0x80, 0x04, 0xd5, 0x74, 0xc0, 0x24, 0x61,
+	0x10, 0xca, 0x23, 0x61, 0x10, 0x41, 0xc0, 0x01, 0xc3, 0x88, 0xc0, 0x1b,
+	0x63, 0xd4, 0x7b, 0x00, 0x93, 0xc0, 0xe0, 0x88, 0x00, 0x25, 0x00, 0xc1,
+	0x40, 0x9a, 0x20, 0x04, 0x00, 0x05, 0x20, 0xc0, 0x07, 0x1b, 0x7f, 0x05,
+	0x27, 0x8f, 0x17, 0x00, 0x97, 0x14, 0x70, 0x04, 0xc0, 0xca, 0x23, 0x21,
+	0x10, 0xca, 0x20, 0x21, 0x00, 0x53, 0x0b, 0x30, 0x10, 0x44, 0xc0, 0xcf,
+	0x78, 0x0d, 0x08, 0xd0, 0x00, 0x4b, 0x08, 0x10, 0x02, 0x55, 0x08, 0xd1,
+	0x01, 0x8f, 0x78, 0xbc, 0x01, 0xe5, 0x5f, 0x20, 0x00, 0x01, 0x10, 0xf0,
+	0x01, 0xc3, 0x7f, 0x67, 0x14, 0x7f, 0x61, 0x68, 0x44, 0x00, 0x00, 0x5e,
+	0x01, 0xf2, 0x02, 0x07, 0x00, 0x90, 0x00, 0xb7, 0x60, 0x40, 0xe5, 0x0e,
+	0x25, 0x90, 0x88, 0xc7, 0x25, 0x0e, 0xd1, 0x11, 0xb0, 0x00, 0xe4, 0x54,
+	0x78, 0xaf, 0xa8, 0x0a, 0xf0, 0x6d, 0x70, 0x08, 0xf0, 0x00, 0x97, 0x00,
+	0xb3, 0x14, 0x00, 0xf0, 0x43, 0xb0, 0xa8, 0xc5, 0x71, 0x05, 0xc0, 0x5b,
+	0x0e, 0x04, 0x90, 0x24, 0x71, 0x07, 0xc0, 0x2f, 0x7a, 0x45, 0x08, 0xa5,
+	0x80, 0x6d, 0x71, 0x04, 0xc0, 0xa5, 0x71, 0x14, 0x70, 0x15, 0xf3, 0x00,
+	0x16, 0x80, 0x70, 0x00, 0x80, 0x00, 0x00, 0xc3, 0xb8, 0x41, 0xc0, 0x2f,
+	0xf0, 0x02, 0xc5, 0x28, 0xf0, 0x5f, 0x27, 0x80, 0x14, 0xc3, 0x41, 0x47,
+	0x00, 0x02, 0x00, 0xe1, 0x42, 0x1e, 0x66, 0xf4, 0x26, 0x40, 0x13, 0xa1,
+	0x43, 0x5e, 0x0e, 0x6f, 0xfd, 0xbc, 0x20, 0x01, 0x00, 0x03, 0xc0, 0x1a,
+	0x27, 0x81, 0x1f, 0xea, 0x01, 0xb1, 0xf4, 0x26, 0x42, 0x13, 0x54, 0x20,
+	0x00, 0x0d, 0x05, 0x79, 0xa1, 0xe0, 0x00, 0x31, 0xa5, 0x71, 0x25, 0xfa,
+	0x01, 0x10, 0x81, 0xfa, 0x01, 0xf2, 0x06, 0x00, 0x01, 0xc0, 0x58, 0x60,
+	0x49, 0x20, 0xc0, 0x0f, 0x00, 0xb1, 0x05, 0xc0, 0xb3, 0x0d, 0x24, 0x90,
+	0x88, 0xc6, 0x67, 0x71, 0x90, 0x00, 0xf2, 0x07, 0x01, 0x88, 0x2f, 0x27,
+	0xc7, 0x16, 0x9b, 0x08, 0xc5, 0x83, 0x00, 0xc0, 0x89, 0x08, 0x10, 0x00,
+	0xda, 0x09, 0x4f, 0xfe, 0x08, 0x43, 0x1c, 0x00, 0x22, 0x81, 0x88, 0x8e,
+	0x00, 0x60, 0xcd, 0x07, 0x34, 0xf0, 0xc3, 0x41, 0x6c, 0x02, 0xf1, 0x24,
+	0xb4, 0x79, 0x6f, 0x89, 0x50, 0x89, 0x76, 0x4a, 0x51, 0x4b, 0x70, 0x72,
+	0xca, 0x21, 0x8d, 0x03, 0x2f, 0x7e, 0x1a, 0x26, 0xce, 0x12, 0x08, 0xd9,
+	0xca, 0x27, 0x2d, 0x12, 0xca, 0x21, 0x2d, 0x01, 0x44, 0x2e, 0x0e, 0x18,
+	0x19, 0xf0, 0x03, 0xc2, 0x9a, 0x21, 0x04, 0x00, 0x54, 0x22, 0x03, 0x0d,
+	0x1a, 0x25, 0x82, 0x9e, 0x00, 0xfc, 0x23, 0x65, 0x7a, 0x45, 0x79, 0x3b,
+	0x79, 0x91, 0xb9, 0x9c, 0xb9, 0x9f, 0xb9, 0x60, 0x91, 0xd0, 0x7a, 0x7a,
+	0x62, 0x49, 0x22, 0xc2, 0x0f, 0x40, 0xb1, 0x0a, 0x21, 0x80, 0x07, 0xd5,
+	0x09, 0xe4, 0x83, 0x40, 0x21, 0x5e, 0x00, 0x04, 0x71, 0x0f, 0x7d, 0x9d,
+	0x0c, 0x65, 0x93, 0x09, 0xdf, 0x80, 0x24, 0x03, 0x35, 0x78, 0x03, 0x42,
+	0x0a, 0x3d, 0x40, 0xc0, 0x8e, 0x00, 0xa0, 0x04, 0x00, 0x38, 0x43, 0xc3,
+	0x41, 0x4a, 0x00, 0x00, 0x00, 0xe6, 0x02, 0x42, 0x20, 0x00, 0x00, 0x00,
+	0xe0, 0x02, 0xa6, 0x86, 0x00, 0x00, 0x90, 0x84, 0x20, 0x01, 0x00, 0x1d,
+	0x78, 0x02, 0x00, 0xf0, 0x09, 0x36, 0x0d, 0x6f, 0xfd, 0x52, 0x20, 0x00,
+	0x00, 0xae, 0x08, 0xaf, 0xfe, 0x0c, 0x70, 0xc3, 0x42, 0x03, 0x90, 0x68,
+	0xff, 0x00, 0x1e, 0x05, 0x70, 0x9e, 0x03, 0xf2, 0x2b, 0x00, 0x1a, 0x05,
+	0x00, 0x00, 0xc0, 0x2c, 0x71, 0xcb, 0x47, 0x00, 0x80, 0xca, 0x07, 0x44,
+	0x20, 0xcd, 0x07, 0x20, 0x40, 0x06, 0xed, 0x61, 0xbd, 0x01, 0x0d, 0x31,
+	0x10, 0x1b, 0x78, 0x5a, 0x20, 0x03, 0x01, 0x00, 0x16, 0x00, 0x71, 0x08,
+	0x90, 0xea, 0x01, 0x44, 0xc0, 0xc3, 0x12, 0x00, 0x07, 0x43, 0xc0, 0x0a,
+	0xca, 0x8c, 0x20, 0xc3, 0x8f, 0x0c, 0xf4, 0x88, 0x00, 0xf2, 0x26, 0x00,
+	0x00, 0xe5, 0xb8, 0xff, 0xd8, 0x04, 0xf2, 0x00, 0x8f, 0x0a, 0x1a, 0x02,
+	0x30, 0x00, 0xc1, 0x0f, 0x23, 0x41, 0x00, 0x49, 0xc1, 0x79, 0x23, 0x01,
+	0x30, 0x24, 0x72, 0x4a, 0xc1, 0x20, 0x8f, 0x3b, 0x03, 0x20, 0x00, 0x39,
+	0x21, 0x00, 0x00, 0x04, 0xc0, 0x4c, 0x71, 0x04, 0x20, 0x81, 0x0f, 0x00,
+	0x00, 0xff, 0xc0, 0x04, 0x98, 0x03, 0x70, 0x3f, 0x80, 0x20, 0x10, 0x00,
+	0x25, 0x78, 0x24, 0x03, 0x00, 0x60, 0x00, 0xe0, 0x00, 0x1e, 0x84, 0x73,
+	0x0f, 0x90, 0x22, 0xe0, 0x03, 0xc0, 0x2c, 0x76, 0xa5, 0xb8, 0x16, 0x00,
+	0xf1, 0x10, 0x05, 0x90, 0xee, 0xe0, 0x09, 0xc0, 0x7e, 0x0f, 0x6f, 0xff,
+	0x0f, 0x78, 0x00, 0xc0, 0x0f, 0x78, 0x08, 0xed, 0x82, 0x0b, 0xef, 0xff,
+	0x78, 0x25, 0x81, 0x10, 0xc9, 0x02, 0x00, 0x00, 0x76, 0x66, 0x03, 0x02,
+	0x0e, 0x04, 0x20, 0x04, 0x00, 0x58, 0x03, 0xf2, 0x05, 0x47, 0xc0, 0x46,
+	0xc0, 0x00, 0x24, 0x80, 0x3f, 0x00, 0x00, 0x58, 0x02, 0x2c, 0x70, 0xc6,
+	0x0e, 0x2f, 0xff, 0x5a, 0xda, 0x10, 0x00, 0xf0, 0x07, 0xa4, 0x01, 0xba,
+	0x0e, 0x2f, 0xff, 0xb4, 0xda, 0xda, 0x0d, 0xef, 0xfe, 0x8a, 0x20, 0x04,
+	0x0b, 0x72, 0x0d, 0xef, 0xfe, 0x45, 0xc0, 0x72, 0x00, 0x60, 0x03, 0x90,
+	0xc4, 0xfe, 0x06, 0xc0, 0xda, 0x02, 0xf0, 0x11, 0x08, 0xe0, 0x42, 0xc0,
+	0x12, 0xf0, 0x00, 0x42, 0x44, 0x26, 0xc0, 0x17, 0x21, 0x6e, 0x9a, 0x26,
+	0x08, 0x10, 0x06, 0xe8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x5b, 0x7a,
+	0x05, 0x26, 0x80, 0x1f, 0x92, 0x04, 0xf1, 0x00, 0x40, 0xb0, 0x28, 0x46,
+	0x02, 0xc0, 0xdf, 0x0e, 0x24, 0x90, 0x0c, 0x71, 0x80, 0xd8, 0x8e, 0xa6,
+	0x00, 0x00, 0x46, 0x01, 0x42, 0x1a, 0x23, 0x80, 0x3f, 0x84, 0x01, 0x66,
+	0x81, 0x0f, 0x03, 0x90, 0x86, 0xfe, 0x8c, 0x01, 0xf0, 0x05, 0xa0, 0xb8,
+	0x8e, 0x0f, 0x2f, 0xfe, 0x00, 0xb1, 0x8c, 0x20, 0x03, 0x8f, 0x3f, 0xda,
+	0x43, 0xf6, 0x44, 0x28, 0x02, 0x01, 0x2e, 0x00, 0x00, 0xca, 0x04, 0xf1,
+	0x00, 0xc3, 0x8f, 0x24, 0x8f, 0xc1, 0x43, 0x4b, 0xc0, 0x12, 0xf0, 0x64,
+	0x78, 0x1a, 0x20, 0x8c, 0xbe, 0x03, 0x40, 0x07, 0xc0, 0x64, 0x71, 0xc2,
+	0x02, 0x11, 0x85, 0xb8, 0x02, 0x02, 0xb2, 0x04, 0xe0, 0x40, 0xb0, 0x6f,
+	0x78, 0xe1, 0x09, 0x25, 0x80, 0xef, 0xd8, 0x8a, 0x22, 0xc4, 0x07, 0x9e,
+	0x04, 0xf1, 0x06, 0x24, 0xe0, 0x40, 0xb0, 0x8a, 0x22, 0xc4, 0x03, 0x6f,
+	0x70, 0x0c, 0x18, 0x45, 0x00, 0xfe, 0x18, 0x84, 0x80, 0x9f, 0xf0, 0x07,
+	0xfe, 0x04, 0x11, 0x0b, 0xfe, 0x04, 0x20, 0xc4, 0x78, 0x16, 0x02, 0x00,
+	0x12, 0x03, 0x19, 0xc5, 0xfc, 0x04, 0xf0, 0x05, 0x00, 0x18, 0xc4, 0x06,
+	0xcf, 0x78, 0xd9, 0x09, 0x05, 0x80, 0x0f, 0xd8, 0xea, 0x0f, 0xaf, 0xfd,
+	0x0f, 0xd9, 0xcb, 0x45, 0xf4, 0x04, 0xf2, 0x07, 0x82, 0x0b, 0x6f, 0xff,
+	0x00, 0x1d, 0x05, 0x10, 0x7a, 0x0b, 0x4f, 0xff, 0x3a, 0x0a, 0x2f, 0xff,
+	0x05, 0xc0, 0x0c, 0x71, 0x4a, 0x09, 0xe8, 0x04, 0xf1, 0x06, 0x20, 0xd8,
+	0x3a, 0x0c, 0xaf, 0xfd, 0x2c, 0x71, 0x8f, 0xc0, 0x2c, 0x70, 0xda, 0x0a,
+	0x20, 0x00, 0x4c, 0x71, 0x0f, 0xd8, 0xae, 0x3c, 0x00, 0x30, 0x7f, 0xd8,
+	0x4a, 0x38, 0x00, 0x62, 0xb5, 0x46, 0x0b, 0x4f, 0xff, 0x06, 0x36, 0x00,
+	0x25, 0x73, 0x16, 0x36, 0x00, 0x11, 0x02, 0x36, 0x00, 0x71, 0x55, 0x24,
+	0x00, 0x3f, 0x2c, 0x70, 0xa2, 0x38, 0x00, 0xf2, 0x35, 0x03, 0x8f, 0x5f,
+	0x20, 0x43, 0x02, 0x0a, 0x26, 0x00, 0x30, 0x3f, 0xf0, 0x8c, 0xc0, 0x2c,
+	0x70, 0x26, 0x0d, 0x2f, 0xff, 0x09, 0xda, 0xad, 0x70, 0x30, 0xf0, 0x7b,
+	0x78, 0x84, 0x20, 0x87, 0x0f, 0x8f, 0xc1, 0x35, 0x21, 0x0b, 0x00, 0x55,
+	0x24, 0x01, 0x3f, 0x35, 0x21, 0x0e, 0x00, 0x02, 0x26, 0xc0, 0x12, 0x48,
+	0x20, 0x02, 0x00, 0x8c, 0xc0, 0xb8, 0x60, 0x40, 0xa8, 0x4f, 0x7c, 0x08,
+	0xc0, 0x5f, 0x20, 0x41, 0x02, 0xd0, 0x01, 0xe0, 0x58, 0x02, 0x38, 0x60,
+	0xb8, 0x60, 0x20, 0x88, 0x21, 0x09, 0x05, 0x03, 0x40, 0xa8, 0x1a, 0x00,
+	0x22, 0x81, 0x04, 0x1a, 0x00, 0xf2, 0x37, 0xa4, 0x01, 0x38, 0x60, 0x00,
+	0x23, 0x81, 0x13, 0xb4, 0x78, 0x3d, 0x79, 0x20, 0xb0, 0xa5, 0x71, 0x64,
+	0x71, 0x02, 0xc0, 0xa5, 0x0d, 0x04, 0x90, 0x06, 0xc0, 0x40, 0x26, 0x5e,
+	0x30, 0x14, 0x70, 0xc0, 0x23, 0x61, 0x00, 0x24, 0x8f, 0x2f, 0x20, 0x87,
+	0x07, 0x7f, 0x09, 0x25, 0x80, 0x48, 0xc0, 0xc3, 0x8f, 0x67, 0x74, 0x4c,
+	0x23, 0x80, 0xb7, 0xec, 0x06, 0xce, 0xff, 0x36, 0xf0, 0xad, 0x70, 0x2e,
+	0xf0, 0x5f, 0x23, 0x41, 0x32, 0x4c, 0x00, 0xf0, 0x05, 0x58, 0x02, 0xa1,
+	0x43, 0x38, 0x60, 0xc3, 0x41, 0x3e, 0x00, 0x02, 0x00, 0xf2, 0x09, 0x6f,
+	0xfd, 0xa8, 0x60, 0xa1, 0x42, 0xbc, 0x01, 0xf2, 0x05, 0x00, 0x00, 0x00,
+	0x20, 0x9a, 0x22, 0x08, 0x00, 0x5f, 0x23, 0x81, 0x34, 0xc3, 0x43, 0x02,
+	0x90, 0x80, 0x00, 0x05, 0x7a, 0x32, 0x00, 0xf0, 0x05, 0xa4, 0x01, 0x19,
+	0x61, 0xf4, 0x21, 0x40, 0x03, 0x05, 0x22, 0xcc, 0x00, 0x00, 0xb4, 0x42,
+	0x23, 0x00, 0x08, 0x05, 0x7a, 0x10, 0x00, 0xf1, 0x0c, 0xa5, 0x71, 0x00,
+	0xb2, 0x02, 0xc0, 0xa9, 0x0d, 0x24, 0x90, 0x63, 0x42, 0x24, 0x8f, 0xc5,
+	0x71, 0xcf, 0x78, 0x99, 0x09, 0x25, 0x80, 0x18, 0x43, 0x03, 0xc0, 0x85,
+	0x44, 0x02, 0x00, 0xea, 0x02, 0x20, 0x04, 0xc0, 0xf4, 0x02, 0x00, 0x0a,
+	0x03, 0xf2, 0x09, 0x01, 0xc0, 0x04, 0x71, 0x41, 0xc0, 0x01, 0xc0, 0x0f,
+	0x7d, 0x0a, 0xc0, 0xb1, 0x70, 0xc6, 0x04, 0xed, 0xff, 0xcd, 0x70, 0x80,
+	0x24, 0x0a, 0x3d, 0x0e, 0x04, 0x40, 0xe6, 0xc0, 0xc3, 0x43, 0x86, 0x04,
+	0xd1, 0xa0, 0x8b, 0x81, 0x8b, 0x1f, 0x25, 0x8f, 0x10, 0x1b, 0xf0, 0x1a,
+	0x25, 0x9e, 0x60, 0x04, 0xf4, 0x25, 0x9a, 0x23, 0x04, 0x00, 0x14, 0x21,
+	0x8e, 0x03, 0x05, 0x26, 0x1e, 0x30, 0x05, 0x23, 0x83, 0x07, 0x7b, 0x7b,
+	0x91, 0xbb, 0x9c, 0xbb, 0x9f, 0xbb, 0x60, 0x93, 0xe5, 0x71, 0x65, 0x71,
+	0x60, 0xb6, 0x2f, 0x23, 0xc7, 0x02, 0xd7, 0x0b, 0xa4, 0x80, 0xf0, 0x7e,
+	0xa5, 0x71, 0xf7, 0x0c, 0x65, 0x93, 0x6d, 0x70, 0xc6, 0xc4, 0xd4, 0x07,
+	0x30, 0x1a, 0x20, 0x8d, 0x80, 0x02, 0xf0, 0x30, 0x20, 0x28, 0x47, 0xfd,
+	0x7a, 0x00, 0x41, 0xc3, 0x40, 0x02, 0x90, 0xb2, 0x00, 0x5d, 0x7a, 0x05,
+	0x25, 0x0c, 0x10, 0x45, 0x22, 0x02, 0x06, 0x04, 0x72, 0x00, 0x1c, 0x05,
+	0x10, 0x40, 0xb4, 0x05, 0x25, 0x02, 0x10, 0xc0, 0x92, 0x04, 0x72, 0xc1,
+	0xbf, 0xa5, 0x78, 0x43, 0x6f, 0xa0, 0x90, 0xc1, 0x40, 0x44, 0x22, 0xc3,
+	0x07, 0x06, 0xeb, 0x61, 0xbb, 0x01, 0x0b, 0x31, 0x00, 0x1d, 0x78, 0x26,
+	0x00, 0xf0, 0x87, 0x44, 0x20, 0x83, 0x00, 0xc1, 0x40, 0x44, 0x27, 0xcc,
+	0x17, 0x06, 0xec, 0x61, 0xbc, 0x01, 0x0c, 0x31, 0x10, 0x1d, 0x78, 0xc0,
+	0xb8, 0x05, 0x20, 0xcc, 0x00, 0x66, 0x6f, 0xc1, 0x40, 0x44, 0x23, 0xdb,
+	0x07, 0x11, 0x0b, 0x10, 0x30, 0x42, 0x23, 0x5b, 0x30, 0xff, 0x0b, 0x31,
+	0xb0, 0x1d, 0x78, 0xc4, 0xbb, 0x44, 0x20, 0x00, 0x01, 0x05, 0x24, 0x1e,
+	0x10, 0x40, 0x27, 0x4c, 0x12, 0xc1, 0x40, 0x44, 0x24, 0xce, 0x17, 0x05,
+	0xee, 0x61, 0xbe, 0xff, 0x0e, 0x31, 0x90, 0x1d, 0x78, 0xc4, 0xbf, 0x44,
+	0x22, 0xce, 0x07, 0xa1, 0x42, 0x06, 0xee, 0x61, 0xbe, 0x01, 0x0e, 0x31,
+	0x10, 0x5d, 0x7a, 0xc4, 0xbc, 0x44, 0x22, 0x8e, 0x00, 0xa1, 0x42, 0x05,
+	0xef, 0x61, 0xbf, 0xff, 0x0f, 0x31, 0x90, 0x5d, 0x7a, 0x44, 0x20, 0x00,
+	0x02, 0xc0, 0xba, 0x45, 0x7e, 0xa1, 0x42, 0x05, 0xeb, 0x61, 0xbb, 0xff,
+	0x0b, 0x31, 0x80, 0x5d, 0x7a, 0x05, 0x20, 0x80, 0x07, 0x44, 0x22, 0x03,
+	0x01, 0xa1, 0x42, 0x05, 0xec, 0x61, 0xbc, 0xff, 0x0c, 0x28, 0x00, 0xf2,
+	0x03, 0xc5, 0x7b, 0x44, 0x22, 0x02, 0x02, 0x65, 0x7a, 0x5f, 0x22, 0x02,
+	0x04, 0xd2, 0x0d, 0xaf, 0xfd, 0x45, 0x78, 0x52, 0x01, 0x04, 0x04, 0x01,
+	0x20, 0xcb, 0x45, 0x58, 0x01, 0xf1, 0x2b, 0x80, 0x8d, 0x38, 0x43, 0x18,
+	0x47, 0x6d, 0x70, 0x0c, 0x71, 0x0d, 0xea, 0x5f, 0x24, 0x43, 0x12, 0x1b,
+	0x0a, 0xb1, 0x00, 0x08, 0xd9, 0x08, 0xe3, 0x09, 0xd8, 0xed, 0x71, 0x4a,
+	0x23, 0x00, 0x12, 0x06, 0xf0, 0x9b, 0x7b, 0xed, 0x74, 0x2c, 0x74, 0x02,
+	0xf0, 0xed, 0x71, 0x01, 0x15, 0x9e, 0x10, 0x23, 0xf0, 0xc9, 0x45, 0x9a,
+	0x25, 0x08, 0x10, 0x1a, 0x24, 0xe6, 0x05, 0x70, 0x20, 0xa5, 0x7a, 0x05,
+	0x22, 0x82, 0x0f, 0x98, 0x07, 0xe4, 0x1f, 0x0b, 0x30, 0x30, 0x40, 0x9a,
+	0x8a, 0x25, 0xcf, 0x1f, 0x44, 0x7d, 0x5d, 0x7a, 0x02, 0x00, 0xf4, 0x0d,
+	0x84, 0x22, 0x1f, 0x08, 0xba, 0x62, 0x14, 0x27, 0xcd, 0x30, 0x40, 0xb5,
+	0xfe, 0x66, 0x1b, 0x63, 0xc3, 0x09, 0x85, 0x83, 0x85, 0x71, 0xfd, 0x0e,
+	0x25, 0xb3, 0x69, 0x46, 0x90, 0x00, 0xf0, 0x2d, 0x19, 0x88, 0x63, 0xb8,
+	0x14, 0x73, 0xe0, 0x20, 0xcd, 0x07, 0xc3, 0x40, 0x0e, 0x90, 0x4c, 0x1e,
+	0x20, 0xb0, 0xe0, 0x7f, 0x41, 0xb0, 0xe0, 0x78, 0xf1, 0xc0, 0x6d, 0x70,
+	0x6c, 0x70, 0x16, 0xf0, 0xef, 0x70, 0x11, 0xf0, 0x5a, 0x23, 0x82, 0x0c,
+	0x5c, 0x60, 0x5a, 0x27, 0x42, 0x36, 0xe7, 0x71, 0x9a, 0x62, 0x3c, 0x62,
+	0x00, 0x26, 0x82, 0x36, 0x3c, 0x12, 0x82, 0x00, 0xe8, 0x02, 0xf0, 0x29,
+	0x40, 0xac, 0xe5, 0x0f, 0x94, 0xb0, 0x64, 0x71, 0xd9, 0x0b, 0xb4, 0x80,
+	0x14, 0x23, 0xde, 0x10, 0xd1, 0xc0, 0xe0, 0x7e, 0x1b, 0x79, 0x1d, 0x78,
+	0x84, 0x21, 0x82, 0x0a, 0x46, 0x20, 0x80, 0x0a, 0x05, 0x79, 0x5a, 0x21,
+	0x00, 0x01, 0x3d, 0x79, 0x3d, 0x79, 0x44, 0x21, 0xc1, 0x0c, 0x84, 0x20,
+	0x03, 0x03, 0x05, 0x79, 0x5f, 0x21, 0x00, 0x04, 0x12, 0x00, 0x00, 0x04,
+	0x00, 0xf0, 0x0b, 0x25, 0x78, 0xe0, 0x7f, 0x0f, 0x78, 0xe0, 0x78, 0xe2,
+	0xc2, 0xcb, 0x45, 0x05, 0x90, 0x00, 0xe0, 0x20, 0xd8, 0x26, 0x0e, 0xef,
+	0xfe, 0x00, 0x1d, 0x45, 0x10, 0x26, 0x04, 0x24, 0xc2, 0xc6, 0x08, 0x0a,
+	0x24, 0x02, 0x3b, 0x80, 0x05, 0xa2, 0x42, 0xc1, 0x2c, 0x70, 0x41, 0xc0,
+	0x07, 0xf0, 0xa5, 0xf8, 0xde, 0x05, 0x80, 0xff, 0xfb, 0x00, 0xb2, 0xf7,
+	0x09, 0x94, 0x82, 0x3e, 0x06, 0x40, 0x04, 0x90, 0xaa, 0x00, 0x3a, 0x07,
+	0x40, 0x1f, 0x05, 0x78, 0xda, 0x76, 0x05, 0xf0, 0x0d, 0x85, 0x70, 0x05,
+	0x90, 0xaa, 0xe0, 0xce, 0x0d, 0x2f, 0xfd, 0x8d, 0xc0, 0x8d, 0xc0, 0xce,
+	0x0a, 0xe0, 0x00, 0x78, 0xd9, 0x76, 0x0e, 0x8f, 0xfd, 0x0f, 0xd8, 0x56,
+	0x0b, 0x94, 0x04, 0x40, 0xf6, 0x0e, 0x0f, 0xff, 0x7c, 0x07, 0x71, 0x7c,
+	0x06, 0x12, 0x0b, 0x20, 0x00, 0x2c, 0xa4, 0x07, 0xf4, 0x03, 0x7c, 0x06,
+	0x2c, 0x71, 0xa2, 0x0a, 0xaf, 0xfd, 0xf7, 0xda, 0x01, 0xc0, 0xed, 0x71,
+	0xe1, 0x42, 0xc4, 0xb8, 0x30, 0x0a, 0x20, 0x5b, 0x7a, 0xb8, 0x01, 0xf0,
+	0x30, 0xc9, 0x07, 0x5a, 0x22, 0x02, 0x01, 0x01, 0xc0, 0x20, 0x8d, 0x8a,
+	0x23, 0x7f, 0x0f, 0x0f, 0x22, 0x0e, 0x00, 0x5a, 0x26, 0x00, 0x11, 0x4c,
+	0x70, 0x00, 0x1c, 0xc1, 0x3f, 0xc5, 0x78, 0x0f, 0x78, 0x44, 0xc0, 0x01,
+	0xc0, 0x5f, 0x20, 0x40, 0x06, 0x43, 0xc0, 0x5f, 0x21, 0x80, 0x0c, 0x03,
+	0xc1, 0x19, 0x61, 0x00, 0x21, 0x81, 0x0f, 0x00, 0x80, 0x7c, 0x06, 0x02,
+	0x0d, 0xa0, 0x00, 0x04, 0x24, 0x0b, 0xf0, 0x07, 0x80, 0x7c, 0x06, 0xa2,
+	0x0e, 0xef, 0xff, 0x2c, 0x71, 0x00, 0x8d, 0xcf, 0x7e, 0x5f, 0x20, 0x81,
+	0x0c, 0x03, 0xc0, 0x38, 0x60, 0x00, 0xac, 0x06, 0xb2, 0x80, 0x7c, 0x06,
+	0x01, 0x88, 0x8a, 0x21, 0x44, 0x00, 0x47, 0xc0, 0x7e, 0x05, 0xf0, 0x0d,
+	0xe0, 0xb0, 0xe6, 0xb0, 0xfe, 0x18, 0x44, 0x80, 0xc1, 0x40, 0xa2, 0x0b,
+	0xa0, 0x00, 0x2c, 0x70, 0x30, 0xd8, 0x16, 0x0f, 0x6f, 0xfd, 0x2c, 0x71,
+	0x9e, 0x0d, 0x0f, 0xfe, 0x22, 0x04, 0x00, 0xde, 0x05, 0xf0, 0x09, 0x46,
+	0xc0, 0x0c, 0x70, 0x05, 0xf0, 0x19, 0x61, 0x00, 0x19, 0xc3, 0x0f, 0x04,
+	0x71, 0xfb, 0x08, 0x34, 0x85, 0x88, 0xc1, 0x0c, 0x70, 0xee, 0x0e, 0x28,
+	0x00, 0x40, 0x0f, 0xd8, 0x6e, 0x0a, 0xea, 0x00, 0x30, 0xc1, 0x40, 0x62,
+	0x40, 0x00, 0x50, 0x71, 0x8a, 0x20, 0xc7, 0x0f, 0x4e, 0x0a, 0xf1, 0x04,
+	0x74, 0xe1, 0xed, 0x70, 0x00, 0xb6, 0x01, 0xb6, 0x59, 0x1e, 0x1d, 0x90,
+	0x7d, 0x0f, 0x35, 0x1a, 0x0c, 0x70, 0xbe, 0x30, 0x00, 0xd1, 0x03, 0x15,
+	0x8b, 0x10, 0x82, 0x8d, 0x6f, 0x70, 0x2a, 0xf0, 0x1a, 0x24, 0x80, 0xec,
+	0x03, 0x60, 0x6c, 0x20, 0x02, 0x03, 0x05, 0x22, 0x20, 0x06, 0xf3, 0x05,
+	0x66, 0x01, 0x00, 0x90, 0x79, 0x20, 0x03, 0x00, 0x88, 0xc0, 0x98, 0x60,
+	0x20, 0x88, 0x3b, 0x79, 0x65, 0x79, 0x20, 0xa8, 0x26, 0x00, 0x52, 0x08,
+	0x53, 0x21, 0xbe, 0x80, 0x90, 0x01, 0x00, 0x8a, 0x04, 0x04, 0x98, 0x02,
+	0x40, 0x00, 0x92, 0x05, 0xf2, 0x7c, 0x07, 0xe0, 0x6f, 0x71, 0x00, 0xb2,
+	0x85, 0x71, 0xaf, 0x0b, 0x25, 0x93, 0x0f, 0xd8, 0xde, 0x09, 0x90, 0x00,
+	0xf1, 0x1e, 0x8d, 0x0b, 0x31, 0xb0, 0xe5, 0x71, 0x6f, 0x70, 0xc3, 0x41,
+	0x6e, 0x00, 0x00, 0x00, 0xfe, 0x0c, 0x2f, 0xfd, 0x78, 0x23, 0x00, 0x30,
+	0x00, 0x1e, 0x05, 0x10, 0xc6, 0x0c, 0x2f, 0xfe, 0x02, 0x1e, 0x05, 0x10,
+	0x0c, 0x70, 0x16, 0x0a, 0x20, 0x00, 0x2c, 0x73, 0x40, 0xd8, 0x22, 0x9a,
+	0x00, 0xf0, 0x23, 0x02, 0xc0, 0x2c, 0x71, 0xc6, 0x0c, 0xef, 0xff, 0x4c,
+	0x70, 0x43, 0x8d, 0x62, 0x8d, 0x0e, 0xf0, 0x02, 0xc1, 0x07, 0xc0, 0xf4,
+	0x21, 0xc1, 0x00, 0xe3, 0xb8, 0x40, 0xd8, 0xca, 0x20, 0x22, 0x08, 0x02,
+	0x79, 0x02, 0xc0, 0x74, 0x78, 0x64, 0x71, 0x20, 0xb0, 0xe7, 0x0a, 0xc5,
+	0x80, 0x01, 0xc0, 0xc2, 0x09, 0x4c, 0x06, 0xf2, 0x08, 0x06, 0xc1, 0x55,
+	0x20, 0x00, 0x08, 0x4c, 0x71, 0x25, 0x78, 0x02, 0xc1, 0x2a, 0x09, 0xe0,
+	0x00, 0x6c, 0x71, 0x2c, 0x70, 0x00, 0x1e, 0x44, 0x92, 0x08, 0x81, 0x1e,
+	0x44, 0x70, 0x05, 0x90, 0x76, 0xe0, 0x05, 0x10, 0x05, 0x00, 0x2a, 0x02,
+	0xf0, 0x05, 0x05, 0xf0, 0x0f, 0xf8, 0x8a, 0xb8, 0x00, 0xb2, 0xfd, 0x09,
+	0x94, 0x82, 0x72, 0x0d, 0xcf, 0xff, 0x00, 0x8d, 0x4c, 0x70, 0xe6, 0x01,
+	0x02, 0xa4, 0x01, 0x00, 0xe2, 0x01, 0x00, 0xa8, 0x01, 0x02, 0xce, 0x01,
+	0x20, 0x36, 0x0b, 0xce, 0x01, 0x44, 0x80, 0x24, 0x02, 0x3b, 0x4c, 0x03,
+	0x21, 0x1a, 0x21, 0x06, 0x0c, 0x50, 0x20, 0x24, 0x71, 0x05, 0x20, 0x98,
+	0x03, 0xf0, 0x53, 0x94, 0x00, 0x00, 0x92, 0xe0, 0x7e, 0xe0, 0x78, 0x21,
+	0x88, 0x6c, 0x21, 0x41, 0x00, 0x21, 0xa8, 0x22, 0x88, 0xc6, 0xb9, 0x22,
+	0xa8, 0x2d, 0x88, 0x44, 0x21, 0x02, 0x0c, 0x85, 0x22, 0x3f, 0x02, 0x13,
+	0x09, 0x7f, 0x01, 0x4d, 0xa8, 0x4f, 0x79, 0x85, 0xb9, 0x2d, 0xa8, 0x23,
+	0x88, 0x87, 0xb9, 0x23, 0xa8, 0x2c, 0x70, 0x38, 0xa8, 0x31, 0xa8, 0xe0,
+	0x7f, 0x30, 0xa8, 0xe2, 0xc2, 0x9a, 0x0b, 0xcf, 0xfd, 0x6f, 0x25, 0x43,
+	0x13, 0x60, 0x95, 0x20, 0xda, 0x40, 0xd9, 0x8c, 0x23, 0xca, 0x85, 0xca,
+	0x22, 0x2d, 0x0c, 0x8c, 0x23, 0xd0, 0x89, 0xca, 0x22, 0x4d, 0x00, 0x8c,
+	0x23, 0xd8, 0x8f, 0x50, 0xd9, 0x0a, 0x00, 0x81, 0x8a, 0x21, 0xca, 0x05,
+	0x3c, 0x21, 0xc1, 0x00, 0x1a, 0x00, 0x21, 0x21, 0xad, 0x1a, 0x00, 0xa0,
+	0xca, 0x21, 0xed, 0x00, 0xd3, 0x73, 0x00, 0x00, 0x5f, 0x09, 0x26, 0x0a,
+	0xf0, 0x01, 0x05, 0x21, 0x8c, 0x00, 0xfe, 0x15, 0x81, 0x90, 0x5a, 0x20,
+	0x00, 0x04, 0x1a, 0x21, 0x83, 0x0f, 0x40, 0x08, 0x62, 0xc3, 0x41, 0x04,
+	0x90, 0xf8, 0x00, 0xb2, 0x01, 0xf0, 0x69, 0xf0, 0x1f, 0x81, 0xb8, 0x05,
+	0x23, 0x42, 0x00, 0x24, 0x72, 0x65, 0x79, 0x80, 0xb2, 0x00, 0xb1, 0xc2,
+	0xc6, 0xe0, 0x78, 0xe4, 0xc0, 0x4a, 0x26, 0x00, 0x30, 0x4c, 0x70, 0x13,
+	0xf0, 0x6c, 0x70, 0x0c, 0xf0, 0x5a, 0x22, 0x8c, 0x0c, 0x65, 0x71, 0x9d,
+	0x60, 0x5a, 0x23, 0x4c, 0x06, 0x64, 0x71, 0xbc, 0x64, 0x2c, 0x64, 0x3c,
+	0x1e, 0x02, 0x13, 0xeb, 0x0b, 0xb4, 0x80, 0x00, 0x23, 0x8e, 0x16, 0x44,
+	0x71, 0xdf, 0x0a, 0xb4, 0x80, 0x14, 0x26, 0x8b, 0x30, 0xc4, 0xc4, 0xe6,
+	0xc2, 0x09, 0x12, 0x8d, 0x30, 0xcd, 0x70, 0xed, 0x70, 0x09, 0x1a, 0x82,
+	0x33, 0x09, 0xf0, 0xf0, 0x26, 0xc0, 0x73, 0x00, 0x80, 0xe8, 0x08, 0x62,
+	0x0b, 0x40, 0x00, 0xe5, 0x71, 0x22, 0xcc, 0xf1, 0x0f, 0x04, 0x90, 0x09,
+	0x1a, 0x42, 0x33, 0x22, 0x1a, 0x9c, 0x33, 0xe8, 0x0d, 0x20, 0xc3, 0x43,
+	0x88, 0x06, 0x20, 0x40, 0x93, 0xe0, 0x0b, 0x01, 0x02, 0x03, 0x61, 0x00,
+	0x00, 0xfe, 0x04, 0x22, 0x82, 0xbe, 0x09, 0xc0, 0x45, 0x78, 0x41, 0x93,
+	0x00, 0xb3, 0x62, 0xb9, 0x6c, 0x22, 0x40, 0x01, 0x28, 0x04, 0x51, 0x01,
+	0xb3, 0xe0, 0x78, 0x1b, 0xf4, 0x04, 0x40, 0x03, 0x90, 0x64, 0xe1, 0x50,
+	0x0a, 0x20, 0xc3, 0x42, 0x48, 0x05, 0x63, 0x61, 0x8a, 0x80, 0x8a, 0x0d,
+	0xf0, 0x16, 0x05, 0x61, 0x10, 0x85, 0x71, 0x05, 0x7a, 0x5b, 0x26, 0x00,
+	0xf0, 0x29, 0x02, 0x90, 0x64, 0x01, 0x20, 0xb2, 0xeb, 0x0b, 0x05, 0x83,
+	0xe0, 0x7e, 0xe2, 0xc2, 0x00, 0x16, 0x0d, 0x71, 0x00, 0x80, 0x06, 0x00,
+	0x6d, 0xe5, 0x85, 0x2d, 0x81, 0x1b, 0x53, 0x25, 0x41, 0x90, 0x05, 0xf2,
+	0xaf, 0x78, 0x4e, 0x21, 0x0d, 0x01, 0x1d, 0x65, 0xaf, 0x7a, 0xc3, 0x41,
+	0xaf, 0x00, 0x01, 0x00, 0xe2, 0x0f, 0x6f, 0xfd, 0x0a, 0xd8, 0x12, 0x04,
+	0x40, 0xc8, 0x07, 0xa0, 0xa8, 0x08, 0x01, 0xf0, 0x1c, 0xe6, 0xc2, 0x6f,
+	0x26, 0xc3, 0x15, 0x40, 0x8e, 0x08, 0x45, 0x17, 0xea, 0x1a, 0x0c, 0xaf,
+	0xfe, 0x40, 0x40, 0x08, 0x47, 0x87, 0xe8, 0xc3, 0x41, 0xd6, 0x00, 0x01,
+	0x00, 0x46, 0x0a, 0x2f, 0xfd, 0x0c, 0x70, 0xe1, 0x40, 0x9a, 0x20, 0x01,
+	0x00, 0x05, 0x7f, 0xbb, 0x9a, 0x0c, 0xf0, 0x00, 0x0f, 0x03, 0x90, 0x92,
+	0xfe, 0xe0, 0xb0, 0xff, 0x16, 0x82, 0x90, 0x18, 0xea, 0xea, 0x0b, 0x30,
+	0x00, 0xf1, 0x00, 0x8c, 0x22, 0xc3, 0x8f, 0x09, 0xf2, 0x88, 0xe8, 0xc3,
+	0x41, 0xd7, 0x00, 0x01, 0x00, 0x12, 0x34, 0x00, 0x20, 0x0c, 0x70, 0x34,
+	0x00, 0x40, 0xbb, 0x79, 0x05, 0x21, 0xc6, 0x09, 0x40, 0x9a, 0xfe, 0x00,
+	0xb1, 0x0c, 0x01, 0xf0, 0x19, 0xf1, 0xc0, 0x00, 0x16, 0x82, 0x70, 0x00,
+	0x80, 0x09, 0x00, 0x1a, 0xea, 0x23, 0x0a, 0x30, 0x0a, 0x0c, 0x72, 0x8c,
+	0x22, 0x03, 0x8c, 0x0c, 0xf2, 0xf8, 0xe2, 0x04, 0xf4, 0x0c, 0x71, 0x09,
+	0xf0, 0xc3, 0x41, 0xd8, 0x00, 0x01, 0x00, 0xd2, 0x09, 0x76, 0x00, 0x62,
+	0x0c, 0x70, 0x5f, 0x20, 0x01, 0x04, 0xd4, 0x0a, 0x40, 0x05, 0x90, 0xa0,
+	0xe0, 0x78, 0x05, 0x61, 0xe6, 0xc0, 0x28, 0x43, 0xed, 0x70, 0x5c, 0x0e,
+	0x72, 0xff, 0xe0, 0xb1, 0x04, 0x19, 0x45, 0x00, 0x20, 0x01, 0x60, 0x21,
+	0x8a, 0xc0, 0x8a, 0x39, 0xf0, 0x88, 0x00, 0x50, 0x18, 0xf4, 0x1a, 0x26,
+	0x83, 0xd6, 0x03, 0xf0, 0x08, 0x20, 0xc3, 0x42, 0x02, 0x90, 0x64, 0x1f,
+	0x05, 0x23, 0x8c, 0x00, 0x44, 0x74, 0x65, 0x7a, 0x00, 0xb4, 0x51, 0x0b,
+	0x3f, 0x12, 0xe0, 0xb2, 0xb2, 0x0b, 0xf0, 0x0f, 0x64, 0xf1, 0xe0, 0xb2,
+	0x04, 0x1a, 0x45, 0x00, 0x20, 0xf0, 0x0a, 0x26, 0xc0, 0x32, 0x8d, 0x70,
+	0x16, 0xf0, 0x53, 0xf7, 0x81, 0x43, 0x1a, 0x26, 0x82, 0x1f, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x0e, 0x00, 0x00, 0x04, 0x22,
+	0x4d, 0x18, 0x60, 0x40, 0x82, 0x4e, 0x0e, 0x00, 0x00, 0xf2, 0x67, 0x9a,
+	0x23, 0x08, 0x00, 0x45, 0x7b, 0xc3, 0x42, 0x02, 0x90, 0x64, 0x01, 0x05,
+	0x23, 0x8d, 0x00, 0x44, 0x74, 0x45, 0x7b, 0x00, 0xb5, 0x00, 0x1b, 0x05,
+	0x00, 0x85, 0x71, 0x0d, 0x0e, 0x10, 0x30, 0xd5, 0x0c, 0x74, 0x92, 0x2f,
+	0x26, 0x82, 0xb7, 0xc5, 0x71, 0x93, 0x09, 0xa5, 0x83, 0x2f, 0x22, 0xc7,
+	0x02, 0xc6, 0xc4, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa1, 0xc1, 0xc3,
+	0x40, 0x04, 0x90, 0x30, 0x00, 0xb4, 0x10, 0x01, 0x05, 0x00, 0x16, 0x8f,
+	0x70, 0x00, 0x80, 0x25, 0x00, 0x0d, 0x09, 0x71, 0x01, 0xe0, 0xb0, 0xe1,
+	0xb0, 0x07, 0xf0, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x58, 0x00, 0x21,
+	0xb0, 0x6f, 0x0f, 0x30, 0x10, 0x6f, 0x71, 0x00, 0x16, 0x80, 0x70, 0x00,
+	0x80, 0x32, 0x00, 0x44, 0x27, 0x8d, 0x10, 0xe3, 0xb8, 0x0e, 0x00, 0xf2,
+	0x21, 0xcf, 0x07, 0xca, 0x23, 0xa1, 0x30, 0x44, 0x27, 0x4e, 0x10, 0x40,
+	0xc0, 0x1b, 0xf0, 0x9a, 0x20, 0x04, 0x00, 0x53, 0x27, 0x41, 0x10, 0x05,
+	0x79, 0xa1, 0x40, 0x48, 0xf8, 0x00, 0xc0, 0x41, 0xf8, 0x07, 0xee, 0x00,
+	0xc0, 0x63, 0x42, 0x0f, 0x79, 0xaa, 0x0f, 0xaf, 0xfd, 0x0c, 0x70, 0x08,
+	0xed, 0x0e, 0x00, 0x10, 0x9e, 0x0e, 0x00, 0xf1, 0x0b, 0x71, 0x00, 0xc0,
+	0x04, 0x71, 0x40, 0xc0, 0xc3, 0x40, 0x00, 0x80, 0xcf, 0x07, 0x21, 0x88,
+	0x00, 0xc0, 0xc3, 0x09, 0x25, 0x80, 0xc1, 0x40, 0x00, 0x16, 0x8d, 0x76,
+	0x00, 0x26, 0x6f, 0x0d, 0x74, 0x00, 0x82, 0x65, 0x00, 0x44, 0x25, 0x8e,
+	0x10, 0xe3, 0xb8, 0x2c, 0x00, 0x21, 0x02, 0x88, 0x74, 0x00, 0x26, 0x25,
+	0x4f, 0x74, 0x00, 0x10, 0x25, 0x74, 0x00, 0xa2, 0xc1, 0x40, 0x2b, 0xf8,
+	0x00, 0xc0, 0x24, 0xf8, 0x07, 0xef, 0x66, 0x00, 0x10, 0x36, 0x66, 0x00,
+	0x23, 0x70, 0x08, 0x82, 0x00, 0x10, 0x2a, 0x0e, 0x00, 0x09, 0x74, 0x00,
+	0x13, 0x23, 0x74, 0x00, 0xf0, 0x50, 0xe1, 0x40, 0x00, 0x16, 0x8e, 0x70,
+	0x00, 0x80, 0x04, 0x00, 0xaa, 0x0f, 0xcf, 0xfd, 0xb2, 0x0f, 0xef, 0xfd,
+	0x08, 0x45, 0x00, 0x41, 0xfe, 0x0c, 0xef, 0xff, 0xa1, 0x40, 0x1a, 0x26,
+	0x8c, 0x1f, 0x20, 0x00, 0x00, 0x00, 0xc3, 0x43, 0x08, 0x90, 0xea, 0x01,
+	0x00, 0x93, 0xcb, 0x45, 0x12, 0x90, 0x02, 0x04, 0x05, 0x24, 0x42, 0x13,
+	0x04, 0x20, 0x81, 0x0f, 0x00, 0x00, 0x00, 0x3f, 0x20, 0xb2, 0x44, 0x6d,
+	0x85, 0x7a, 0x96, 0x21, 0x06, 0x00, 0x20, 0xb2, 0x21, 0x93, 0x02, 0x6d,
+	0x85, 0x78, 0xc5, 0xb9, 0x20, 0xb0, 0x87, 0x74, 0x04, 0x14, 0x1b, 0x34,
+	0xc6, 0xc6, 0x1a, 0x20, 0x80, 0x26, 0x00, 0xf0, 0x02, 0x20, 0x05, 0x20,
+	0x81, 0x0f, 0x02, 0x90, 0x54, 0x01, 0x00, 0x91, 0x45, 0x78, 0x00, 0xb1,
+	0xe0, 0x7e, 0x2a, 0x01, 0xf2, 0x05, 0x05, 0x79, 0x63, 0x40, 0x9a, 0x20,
+	0x10, 0x00, 0x05, 0x21, 0x02, 0x00, 0xe0, 0x7e, 0xe0, 0x78, 0xe2, 0xc2,
+	0xa4, 0xc1, 0x56, 0x01, 0xf5, 0x08, 0xe1, 0x06, 0x2c, 0x70, 0x4c, 0x75,
+	0x43, 0xc0, 0xff, 0xd8, 0x08, 0xdb, 0x28, 0x45, 0x42, 0xc1, 0x41, 0xc1,
+	0xf2, 0x08, 0x6f, 0xfd, 0x40, 0x1e, 0x00, 0x22, 0x10, 0xd9, 0x1e, 0x00,
+	0x70, 0x0c, 0xdb, 0x42, 0xc5, 0x41, 0xc5, 0xd6, 0x1c, 0x00, 0xb0, 0xc5,
+	0xff, 0xd8, 0x80, 0xd9, 0x4c, 0x75, 0x6c, 0x72, 0x43, 0xc5, 0x14, 0x00,
+	0x11, 0xc2, 0x14, 0x00, 0xe0, 0xa4, 0xc0, 0xc2, 0xc6, 0xe0, 0x78, 0xe4,
+	0xc2, 0xa4, 0xc1, 0xad, 0x70, 0xff, 0xd8, 0x54, 0x00, 0x22, 0x6c, 0x73,
+	0x20, 0x00, 0x11, 0xa2, 0x20, 0x00, 0xf0, 0x07, 0xcb, 0x46, 0x00, 0x80,
+	0xe1, 0x06, 0x00, 0x8e, 0x25, 0x08, 0xb4, 0x00, 0x2c, 0x70, 0x04, 0x71,
+	0x1d, 0x78, 0x62, 0xb8, 0x0f, 0x78, 0x78, 0x00, 0x00, 0x4a, 0x00, 0x00,
+	0x48, 0x00, 0x11, 0x7a, 0x28, 0x00, 0x20, 0x00, 0x8e, 0x14, 0x00, 0x00,
+	0x40, 0x00, 0x11, 0x08, 0x72, 0x00, 0x13, 0x66, 0x16, 0x00, 0x19, 0x08,
+	0x88, 0x00, 0x11, 0x4e, 0x16, 0x00, 0xf2, 0x3f, 0xa4, 0xc0, 0xc4, 0xc6,
+	0xe0, 0x78, 0xc3, 0x42, 0x04, 0x90, 0x10, 0x01, 0x00, 0x92, 0x4f, 0x20,
+	0x01, 0x01, 0xa4, 0xb8, 0x20, 0xb2, 0xe0, 0x7f, 0x00, 0xb2, 0xe6, 0xc0,
+	0x5f, 0x21, 0x83, 0x04, 0xcb, 0x44, 0x00, 0x80, 0xe2, 0x06, 0x8d, 0x63,
+	0x79, 0x64, 0xc1, 0x89, 0x04, 0x7d, 0x2c, 0x70, 0x09, 0xf0, 0x9a, 0x62,
+	0xe3, 0x8a, 0x09, 0x08, 0xce, 0x03, 0x42, 0x8a, 0x45, 0x7d, 0x24, 0x71,
+	0xf5, 0x09, 0xa4, 0x83, 0x14, 0x23, 0x42, 0x00, 0xa1, 0x40, 0xc6, 0xc4,
+	0xe0, 0x78, 0xa8, 0x02, 0xf1, 0x26, 0x82, 0x24, 0x09, 0x3d, 0x44, 0xc0,
+	0x6f, 0x20, 0x43, 0x02, 0x20, 0x88, 0x54, 0x10, 0x83, 0x00, 0x21, 0x10,
+	0x8d, 0x00, 0xfd, 0x10, 0x8e, 0x80, 0x09, 0x12, 0x8b, 0x30, 0x08, 0x12,
+	0x8f, 0x30, 0x49, 0xc1, 0x00, 0x24, 0x80, 0x3f, 0x00, 0x00, 0x0c, 0x01,
+	0x2c, 0x70, 0xce, 0x08, 0xef, 0xfe, 0xb4, 0xda, 0x96, 0xc0, 0xc6, 0x08,
+	0x00, 0xf0, 0x2f, 0xe2, 0xbe, 0x01, 0x6f, 0x46, 0xc0, 0xdf, 0x20, 0xe1,
+	0x03, 0xcd, 0x70, 0xa5, 0x7b, 0x46, 0xc0, 0x04, 0xc0, 0xd9, 0x43, 0x4d,
+	0xc3, 0x78, 0x20, 0x41, 0x01, 0x82, 0xb8, 0x78, 0x20, 0x00, 0x01, 0x05,
+	0x79, 0x04, 0xc0, 0x78, 0x20, 0xc0, 0x00, 0x4c, 0xc0, 0x25, 0x78, 0x4a,
+	0xc0, 0x04, 0xc0, 0x79, 0x20, 0x80, 0x01, 0x4e, 0xc0, 0x04, 0xc0, 0x69,
+	0xb8, 0x4b, 0xc0, 0x09, 0xc0, 0xbe, 0x01, 0xf0, 0x27, 0x10, 0x00, 0x00,
+	0x00, 0x4f, 0xc0, 0x78, 0x23, 0x00, 0x10, 0x8d, 0x02, 0x20, 0x00, 0x48,
+	0xc0, 0x00, 0x43, 0x44, 0x26, 0xc0, 0x17, 0x0a, 0xc1, 0x06, 0xe8, 0x61,
+	0xb8, 0x01, 0x08, 0x31, 0x00, 0x7b, 0x7b, 0xea, 0x0a, 0x6f, 0xfd, 0xc1,
+	0x40, 0x47, 0xc0, 0x0d, 0xc0, 0x0b, 0x7b, 0x66, 0x02, 0x01, 0x00, 0x04,
+	0xc0, 0x80, 0xb8, 0x62, 0x00, 0xf0, 0x0f, 0x0c, 0xc0, 0x25, 0x78, 0x50,
+	0xc0, 0x15, 0x02, 0x20, 0x00, 0x0c, 0x70, 0x10, 0xc1, 0x4c, 0x70, 0x5e,
+	0x0e, 0x6f, 0xfe, 0x45, 0xc0, 0x14, 0x70, 0xf6, 0x01, 0x21, 0x00, 0xed,
+	0x70, 0xcc, 0x02, 0xf2, 0x0b, 0xc9, 0x07, 0xc1, 0xa8, 0x04, 0xc0, 0x63,
+	0xb8, 0x14, 0x72, 0x28, 0x0a, 0x45, 0xfd, 0x08, 0x45, 0x9a, 0xf7, 0x04,
+	0xc0, 0x31, 0x08, 0xb1, 0x01, 0xad, 0x70, 0x08, 0x02, 0xf8, 0x07, 0xc9,
+	0x07, 0x5a, 0x26, 0x41, 0x16, 0x5f, 0x20, 0x80, 0x0c, 0x38, 0x60, 0x32,
+	0x20, 0x8d, 0x0f, 0x00, 0x80, 0x7f, 0x06, 0xbd, 0x7d, 0x02, 0x00, 0xf4,
+	0x1f, 0x56, 0x24, 0x00, 0x3e, 0x2c, 0x70, 0xda, 0x0f, 0xaf, 0xfe, 0xb4,
+	0xda, 0x04, 0xc0, 0x14, 0x76, 0x64, 0x01, 0x0d, 0x00, 0x04, 0xc0, 0x6f,
+	0x70, 0x25, 0x20, 0x00, 0x00, 0x25, 0xf0, 0x2b, 0xf0, 0x2f, 0xf0, 0x33,
+	0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x34, 0xf0, 0x96, 0xc0, 0x43, 0xc0, 0x26,
+	0x01, 0x20, 0x42, 0xc0, 0x38, 0x00, 0xf0, 0x01, 0x41, 0xc0, 0x08, 0xc0,
+	0xb5, 0x70, 0x8a, 0x23, 0xc7, 0x0f, 0x40, 0xc0, 0xff, 0xd8, 0xca, 0x23,
+	0xba, 0x00, 0xf0, 0x19, 0x06, 0xc1, 0x14, 0x75, 0xca, 0x23, 0xa1, 0x31,
+	0xc1, 0x40, 0x7e, 0x0d, 0xef, 0xfe, 0x63, 0x42, 0x8c, 0xdf, 0x6f, 0x71,
+	0x88, 0xf0, 0x05, 0xc0, 0x0e, 0x0e, 0xaf, 0xff, 0x56, 0x24, 0x01, 0x3e,
+	0x9d, 0xf0, 0x05, 0xc0, 0x36, 0x0f, 0xa0, 0x00, 0x0c, 0x00, 0xf5, 0x10,
+	0x97, 0xf0, 0xc6, 0x0a, 0xa0, 0x00, 0x05, 0xc0, 0x93, 0xf0, 0xc1, 0x40,
+	0x5e, 0x0f, 0x6f, 0xff, 0xa1, 0x41, 0x8f, 0xf0, 0x00, 0x1e, 0xc4, 0x76,
+	0x0f, 0x90, 0x22, 0xe0, 0x96, 0xc0, 0x42, 0x6e, 0x00, 0x51, 0x06, 0xc1,
+	0x08, 0xc3, 0x41, 0x72, 0x00, 0xf2, 0x03, 0x40, 0xc0, 0xc1, 0x40, 0x96,
+	0x0d, 0x20, 0x00, 0x4c, 0x70, 0x6f, 0x71, 0xcf, 0x0d, 0x30, 0x10, 0xc0,
+	0xdf, 0x06, 0x01, 0x22, 0x25, 0x88, 0x08, 0x00, 0xf1, 0x0c, 0x44, 0x88,
+	0x5f, 0x22, 0x43, 0x02, 0x2d, 0xf0, 0x0a, 0x26, 0xc0, 0x30, 0x25, 0xf0,
+	0xf5, 0x20, 0x8d, 0x07, 0x1b, 0xdf, 0x40, 0x26, 0x5e, 0x30, 0xbc, 0x78,
+	0x1c, 0x02, 0x00, 0xf1, 0x09, 0x61, 0xbf, 0xff, 0x0f, 0x31, 0x90, 0x1d,
+	0x78, 0x1f, 0x65, 0xc4, 0xbf, 0x02, 0x7f, 0x44, 0x2d, 0x00, 0x18, 0xa1,
+	0x6c, 0x9a, 0x24, 0x08, 0x10, 0x46, 0x03, 0x32, 0x7f, 0x1a, 0x22, 0x6c,
+	0x03, 0xf0, 0x03, 0x85, 0x78, 0x05, 0x20, 0x80, 0x0f, 0x02, 0x90, 0x64,
+	0x00, 0xe0, 0xb0, 0xa9, 0x44, 0xbd, 0x0c, 0x34, 0x92, 0xee, 0x00, 0xff,
+	0x0d, 0x44, 0x71, 0x09, 0xe3, 0xab, 0x09, 0xa5, 0x80, 0x8d, 0x70, 0x05,
+	0xc0, 0xcb, 0x45, 0x00, 0x80, 0x7c, 0x06, 0xa1, 0x41, 0x4c, 0x70, 0xe2,
+	0x0a, 0x6f, 0xfe, 0x6c, 0x71, 0xae, 0x00, 0x07, 0x80, 0xe6, 0x0c, 0x20,
+	0x00, 0x4c, 0x71, 0x05, 0xc0, 0x2c, 0x00, 0x10, 0xb6, 0x2c, 0x00, 0xf0,
+	0x18, 0x70, 0xc0, 0xdf, 0x04, 0xc0, 0x15, 0x08, 0x70, 0x03, 0x6b, 0x45,
+	0x04, 0xc0, 0x0d, 0x08, 0xb0, 0x01, 0x6b, 0x45, 0x06, 0xf0, 0xad, 0x71,
+	0x05, 0xc0, 0xea, 0x0f, 0xaf, 0xfd, 0x91, 0xc1, 0x6f, 0x70, 0x0d, 0xed,
+	0x07, 0xc0, 0x0e, 0xc2, 0x20, 0x01, 0xe4, 0x1f, 0x67, 0x0f, 0xc0, 0x6c,
+	0x71, 0x4a, 0x08, 0xa0, 0x00, 0xe5, 0x78, 0xb9, 0x43, 0xd2, 0x01, 0xf2,
+	0x49, 0x04, 0x71, 0x00, 0x1e, 0x02, 0x70, 0x00, 0x80, 0xc9, 0x07, 0x0f,
+	0x78, 0x14, 0x71, 0xe8, 0x05, 0xee, 0xff, 0xcf, 0x78, 0x56, 0x0d, 0x6f,
+	0xfd, 0x0c, 0x73, 0x09, 0xca, 0x95, 0xe8, 0x04, 0xc0, 0x11, 0x08, 0xf1,
+	0x00, 0xcf, 0x79, 0xba, 0x0c, 0x6f, 0xfd, 0x07, 0xc0, 0x0d, 0xf0, 0x0b,
+	0xc0, 0x17, 0x08, 0x34, 0x01, 0xcf, 0x7b, 0x0a, 0xc0, 0x09, 0xc1, 0x07,
+	0xc2, 0xf2, 0x0b, 0x6f, 0xfd, 0x52, 0x20, 0x00, 0x00, 0xc5, 0x71, 0xd5,
+	0x72, 0x7a, 0x05, 0xe5, 0xff, 0x0c, 0x71, 0x04, 0xc0, 0x19, 0x08, 0xd1,
+	0x00, 0x09, 0xca, 0x88, 0xe8, 0x60, 0x00, 0xf2, 0x05, 0x00, 0x00, 0xe5,
+	0xb8, 0xb8, 0x0c, 0x42, 0xfd, 0x00, 0x1e, 0x03, 0x70, 0x00, 0x80, 0x0f,
+	0x00, 0x80, 0x24, 0x09, 0x3d, 0x8a, 0x04, 0x04, 0x4c, 0x03, 0x42, 0xb1,
+	0xc1, 0x50, 0xc0, 0x2c, 0x00, 0xf0, 0x3d, 0x04, 0x00, 0x46, 0xc0, 0x96,
+	0x0e, 0xef, 0xfd, 0x20, 0x40, 0xc3, 0x40, 0x00, 0x00, 0xff, 0xff, 0x00,
+	0x41, 0x00, 0x42, 0x72, 0x0b, 0xef, 0xfd, 0x00, 0x43, 0x0f, 0xd8, 0xca,
+	0x0f, 0x2f, 0xfd, 0x0f, 0xd9, 0xcb, 0x47, 0x03, 0x90, 0x04, 0xe0, 0x22,
+	0x1f, 0x15, 0x10, 0x8a, 0x20, 0xc7, 0x0f, 0xa7, 0x1f, 0x1c, 0x10, 0xa8,
+	0x1f, 0x1c, 0x10, 0x0c, 0x71, 0xff, 0xd9, 0x00, 0xb7, 0xfe, 0x1f, 0x04,
+	0x90, 0x05, 0xb7, 0x22, 0x09, 0xef, 0xff, 0xfc, 0x1f, 0x04, 0x90, 0x4a,
+	0x04, 0x51, 0xc9, 0x07, 0x04, 0x8e, 0x48, 0xa6, 0x03, 0xd3, 0xfd, 0x10,
+	0x9e, 0x80, 0x5f, 0x26, 0x00, 0x31, 0x0d, 0x78, 0x1c, 0x79, 0x3c, 0x02,
+	0x00, 0x20, 0x08, 0xc0, 0x0a, 0x00, 0xd5, 0x24, 0x78, 0x41, 0xc0, 0x05,
+	0x8e, 0x4d, 0xc0, 0x24, 0x78, 0x4e, 0xc0, 0x06, 0x60, 0x03, 0xf4, 0x39,
+	0x44, 0xc0, 0x03, 0x8e, 0x4c, 0xc0, 0x02, 0x8e, 0x5f, 0x02, 0x20, 0x00,
+	0x4b, 0xc0, 0x13, 0x0e, 0x5e, 0x31, 0x01, 0xc0, 0x05, 0xae, 0x04, 0xae,
+	0x1b, 0x78, 0x02, 0xae, 0x04, 0x71, 0x03, 0xae, 0xad, 0x70, 0x0c, 0x77,
+	0x6f, 0x71, 0x42, 0xc0, 0xd0, 0xf0, 0x44, 0x23, 0xc1, 0x37, 0x05, 0xe9,
+	0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x1b, 0x78, 0x01, 0x1e, 0xc2, 0x16,
+	0x5a, 0x20, 0x00, 0x01, 0x0f, 0x20, 0xc2, 0x06, 0x00, 0x8e, 0x06, 0xe8,
+	0xb2, 0x06, 0x13, 0x06, 0xbc, 0x06, 0xf0, 0x01, 0x25, 0x00, 0x4f, 0x78,
+	0x0b, 0x79, 0x4a, 0xc0, 0xb3, 0xf2, 0x2f, 0x20, 0xc7, 0x06, 0xc3, 0x41,
+	0xf6, 0x01, 0xf2, 0x1b, 0x4c, 0x71, 0x6c, 0x70, 0xee, 0x08, 0x6f, 0xfe,
+	0x4f, 0xc0, 0x0a, 0xc0, 0x2c, 0x70, 0x1e, 0x0d, 0xef, 0xfe, 0x4c, 0x71,
+	0x0c, 0x70, 0x52, 0x0b, 0x2f, 0xfd, 0x2c, 0x71, 0x0c, 0x70, 0x49, 0xc0,
+	0x03, 0xf0, 0xa5, 0x71, 0x9f, 0xe5, 0x0c, 0x01, 0x09, 0x00, 0xa0, 0x00,
+	0x00, 0xfe, 0x05, 0x00, 0x50, 0x02, 0x60, 0x05, 0x90, 0x40, 0xe0, 0xa0,
+	0xb0, 0x84, 0x04, 0xf0, 0x02, 0xfd, 0x10, 0x80, 0x80, 0x2b, 0x08, 0x5f,
+	0x01, 0x25, 0x8e, 0x44, 0x8e, 0x0e, 0xf0, 0x1a, 0x22, 0x83, 0xe2, 0x05,
+	0x83, 0x10, 0x04, 0xc0, 0x44, 0x71, 0x65, 0x78, 0x1b, 0x7c, 0x02, 0xd2,
+	0x40, 0x00, 0xa0, 0xb0, 0xe7, 0x09, 0x85, 0x80, 0x0e, 0xf0, 0x01, 0xc0,
+	0x1a, 0x2a, 0x06, 0x49, 0x10, 0x04, 0xc0, 0x25, 0x20, 0x00, 0xf3, 0x13,
+	0xce, 0x08, 0xaf, 0xfe, 0x14, 0xd8, 0x9e, 0x0a, 0x8f, 0xff, 0x10, 0xc0,
+	0x2c, 0x71, 0xd2, 0x0a, 0x2f, 0xfd, 0x10, 0x78, 0x04, 0x8e, 0x43, 0xc0,
+	0x0c, 0x70, 0x47, 0xc0, 0x34, 0xf0, 0x03, 0xc0, 0x4c, 0x70, 0x3a, 0x00,
+	0x30, 0x20, 0x05, 0x21, 0xd0, 0x02, 0xd3, 0x70, 0x01, 0x00, 0x90, 0x45,
+	0xc2, 0x11, 0xf0, 0x9a, 0x20, 0x08, 0x00, 0x25, 0x68, 0x00, 0xf0, 0x3d,
+	0x66, 0x01, 0x00, 0x90, 0x06, 0xe8, 0x05, 0xc0, 0x10, 0x78, 0x0f, 0x20,
+	0x80, 0x00, 0x45, 0xc0, 0x44, 0x71, 0xe5, 0x0a, 0x34, 0x82, 0x40, 0x40,
+	0x05, 0xc0, 0x2f, 0x26, 0x08, 0xf0, 0x0b, 0xf4, 0x03, 0xc3, 0x0c, 0x74,
+	0xc3, 0x41, 0x0e, 0x00, 0x03, 0x00, 0x63, 0x42, 0x96, 0x0e, 0x2f, 0xfd,
+	0x40, 0xc5, 0x05, 0xc1, 0x07, 0xc0, 0x25, 0x78, 0x47, 0xc0, 0x03, 0xc0,
+	0x04, 0x71, 0x43, 0xc0, 0x25, 0x8e, 0x03, 0xc0, 0x97, 0x09, 0x25, 0x80,
+	0x0f, 0xd8, 0xda, 0x0d, 0xf2, 0x01, 0x11, 0x07, 0x38, 0x00, 0xf3, 0x15,
+	0x80, 0xf5, 0x02, 0xc0, 0x08, 0x20, 0x40, 0x03, 0x42, 0xc0, 0x0c, 0x71,
+	0x49, 0xc0, 0x09, 0xc0, 0xc3, 0x41, 0x11, 0x00, 0x01, 0x00, 0xea, 0x08,
+	0xef, 0xfc, 0x63, 0x42, 0x8e, 0x0f, 0x6f, 0xfe, 0x0a, 0xc0, 0x0f, 0xc0,
+	0x4e, 0x01, 0xf2, 0x1a, 0x70, 0xa2, 0x0f, 0x2f, 0xfe, 0x6c, 0x70, 0x02,
+	0xc5, 0x67, 0x77, 0x77, 0x70, 0x64, 0x06, 0xea, 0xff, 0x0c, 0x71, 0x02,
+	0xc0, 0xc3, 0x41, 0x13, 0x00, 0x00, 0x00, 0x12, 0x78, 0x2f, 0x20, 0x0d,
+	0x00, 0xb6, 0x08, 0xef, 0xfc, 0xc0, 0xb8, 0x06, 0xc0, 0x9c, 0x01, 0x20,
+	0x16, 0x00, 0x54, 0x05, 0x02, 0x54, 0x01, 0x20, 0x82, 0x0f, 0x54, 0x01,
+	0xa2, 0x02, 0xc0, 0x38, 0x60, 0x49, 0x20, 0xc1, 0x07, 0x20, 0xb2, 0x5c,
+	0x01, 0x73, 0x9e, 0x80, 0x37, 0x0e, 0x5f, 0x31, 0x65, 0x5c, 0x01, 0x15,
+	0x8c, 0x5c, 0x01, 0x17, 0x85, 0x3c, 0x01, 0xa4, 0x20, 0xb0, 0xe7, 0x0b,
+	0x85, 0x80, 0x62, 0x09, 0x8f, 0xff, 0x34, 0x00, 0x02, 0x68, 0x01, 0x13,
+	0x82, 0x2e, 0x00, 0x19, 0x45, 0x2c, 0x00, 0xf4, 0x17, 0x01, 0xc0, 0x04,
+	0x71, 0x41, 0xc0, 0x01, 0xc1, 0x0e, 0xc0, 0x10, 0x71, 0xa4, 0x05, 0xce,
+	0xff, 0x15, 0x0e, 0x5e, 0x31, 0x0d, 0xc0, 0x05, 0xae, 0x08, 0xc0, 0x04,
+	0xae, 0x0c, 0xc0, 0x03, 0xae, 0x0b, 0xc0, 0x02, 0xae, 0x0c, 0x70, 0xde,
+	0x02, 0x42, 0x00, 0xb7, 0xb1, 0xc0, 0x32, 0x03, 0xf4, 0x07, 0x8c, 0x20,
+	0xc3, 0x8f, 0x09, 0xf2, 0x21, 0x08, 0xd1, 0x01, 0xc3, 0x41, 0x04, 0x90,
+	0x38, 0x02, 0x00, 0x19, 0x45, 0x00, 0x06, 0xf0, 0x0c, 0x00, 0xd0, 0x05,
+	0x01, 0x00, 0x19, 0x05, 0x00, 0x09, 0x12, 0x81, 0x30, 0x03, 0xe9, 0x19,
+	0x22, 0x08, 0xf0, 0x00, 0x41, 0x18, 0x90, 0x64, 0x00, 0x00, 0xb1, 0x55,
+	0x00, 0x20, 0x00, 0x02, 0x19, 0x05, 0x00, 0xd0, 0x07, 0xf1, 0x18, 0x08,
+	0x45, 0x09, 0xca, 0x12, 0xe8, 0x22, 0xcc, 0x8c, 0x20, 0x10, 0x80, 0x85,
+	0xf7, 0xc2, 0x0f, 0x0f, 0xfd, 0x22, 0xcc, 0x15, 0x26, 0x01, 0x70, 0x00,
+	0x80, 0xe8, 0x08, 0x04, 0x71, 0xa0, 0xa1, 0x22, 0x1a, 0x1c, 0x30, 0xc2,
+	0xc6, 0xc3, 0x3a, 0x00, 0xf2, 0x03, 0xa0, 0xb1, 0xa1, 0x40, 0x10, 0xdd,
+	0x61, 0xbd, 0x01, 0x0d, 0x31, 0x10, 0x1d, 0x78, 0x02, 0xb1, 0x0e, 0x08,
+	0x48, 0x00, 0x02, 0x20, 0x00, 0xf2, 0x09, 0x08, 0x00, 0x00, 0x91, 0xff,
+	0x08, 0x1f, 0x80, 0x5e, 0x19, 0x45, 0x00, 0x00, 0x91, 0x01, 0x08, 0x1e,
+	0x00, 0xe0, 0x7e, 0xe6, 0xc2, 0x08, 0x47, 0xca, 0x03, 0xf5, 0x2f, 0x01,
+	0x00, 0x3b, 0x08, 0x3f, 0x01, 0x28, 0x45, 0x09, 0xca, 0xf0, 0x7e, 0x0a,
+	0xe8, 0x22, 0xcc, 0x8a, 0x21, 0x10, 0x00, 0x02, 0x79, 0x02, 0x6e, 0x30,
+	0x70, 0x4c, 0x0f, 0x0a, 0xfd, 0x3a, 0x0f, 0xef, 0xff, 0x08, 0xd8, 0x76,
+	0x0f, 0xef, 0xff, 0xe1, 0x40, 0xed, 0x70, 0x07, 0xf0, 0x6a, 0x0f, 0xef,
+	0xff, 0x04, 0x15, 0x00, 0x14, 0xe5, 0x71, 0xf9, 0x0f, 0x84, 0x93, 0xc6,
+	0xc6, 0x64, 0x07, 0x90, 0x31, 0x52, 0xc3, 0x45, 0xc2, 0x54, 0xc1, 0x18,
+	0x43, 0x56, 0x01, 0xf0, 0x08, 0xa0, 0x88, 0xfc, 0x10, 0x8e, 0x80, 0x00,
+	0x16, 0x0f, 0x71, 0x08, 0x90, 0xe0, 0x01, 0x63, 0x40, 0x06, 0x0c, 0x2f,
+	0xfd, 0x2c, 0x70, 0x50, 0xb0, 0x09, 0x03, 0x2c, 0x04, 0x60, 0x46, 0x0f,
+	0xaf, 0xfd, 0x00, 0x43, 0x3c, 0x04, 0xc2, 0x7f, 0xff, 0xe4, 0x78, 0x00,
+	0x1e, 0x04, 0x70, 0x09, 0x90, 0xe0, 0xe1, 0x64, 0x06, 0x20, 0xe4, 0x01,
+	0x20, 0x02, 0x84, 0x4d, 0x04, 0xe6, 0x0d, 0xaf, 0xfc, 0x60, 0xda, 0x14,
+	0x00, 0xf2, 0x01, 0xe2, 0x0a, 0x60, 0x00, 0x60, 0xd9, 0x6c, 0x71, 0x60,
+	0x40, 0x44, 0x23, 0xcf, 0x37, 0x05, 0xef, 0xd0, 0x05, 0x40, 0x1b, 0x78,
+	0xdd, 0x7e, 0xc6, 0x03, 0x20, 0xdd, 0x7e, 0x02, 0x00, 0x00, 0xcc, 0x03,
+	0x20, 0x05, 0xc0, 0x0a, 0x00, 0x40, 0x07, 0xe8, 0xff, 0xd8, 0x56, 0x00,
+	0xf0, 0x0b, 0x03, 0x90, 0xc4, 0xf0, 0x16, 0xf0, 0x0c, 0x70, 0x11, 0xf0,
+	0x44, 0x20, 0xc1, 0x07, 0x06, 0xe9, 0x61, 0xb9, 0x01, 0x09, 0x31, 0x00,
+	0x9b, 0x7c, 0x21, 0x68, 0x0a, 0x03, 0x00, 0x9c, 0x03, 0xf0, 0x07, 0x03,
+	0x90, 0xc4, 0xe0, 0x80, 0xb0, 0x20, 0x40, 0xe3, 0x08, 0x34, 0x82, 0x68,
+	0x44, 0x98, 0x14, 0x00, 0x36, 0x1a, 0x25, 0x8d, 0x1f, 0xba, 0x07, 0xf2,
+	0x1b, 0xc6, 0x7b, 0x4d, 0xc0, 0x97, 0x14, 0x00, 0x36, 0x2c, 0x70, 0x4c,
+	0xc3, 0x4e, 0xc0, 0x96, 0x14, 0x00, 0x36, 0x51, 0xc5, 0x4f, 0xc0, 0x4f,
+	0x78, 0x4c, 0x70, 0x26, 0x09, 0xef, 0xfe, 0x53, 0xc0, 0x2c, 0x70, 0x4a,
+	0xc1, 0x0c, 0xf0, 0x3b, 0x7a, 0x14, 0x70, 0xa4, 0x00, 0xf0, 0x05, 0xc4,
+	0x01, 0xce, 0x22, 0x21, 0x00, 0x38, 0x60, 0x40, 0xa8, 0x24, 0x71, 0xeb,
+	0x09, 0x34, 0x84, 0x44, 0x21, 0x40, 0x00, 0x9c, 0x06, 0xf0, 0x1d, 0xcd,
+	0x07, 0x00, 0x16, 0x9e, 0x70, 0x00, 0x80, 0xcd, 0x07, 0x81, 0x88, 0x0a,
+	0x25, 0x80, 0x17, 0x47, 0xf0, 0x6c, 0x70, 0x42, 0xf0, 0x10, 0xc0, 0x55,
+	0x20, 0x01, 0x0c, 0x11, 0xc0, 0x25, 0x78, 0x1a, 0x26, 0x81, 0x1f, 0x00,
+	0x00, 0x00, 0x10, 0x05, 0x79, 0x60, 0x40, 0xdc, 0x09, 0x00, 0xea, 0x03,
+	0xf5, 0x0c, 0x91, 0xb8, 0x9c, 0xb8, 0x9f, 0xb8, 0xe0, 0x90, 0x05, 0xc0,
+	0x78, 0x23, 0x01, 0x02, 0x79, 0x20, 0x00, 0x00, 0x07, 0x20, 0x7e, 0x80,
+	0x27, 0xf4, 0xfd, 0x78, 0x1d, 0x02, 0x00, 0xf0, 0x1b, 0xc4, 0xbf, 0x2c,
+	0x70, 0x07, 0xe8, 0x00, 0x41, 0x9a, 0x21, 0x10, 0x00, 0x80, 0x21, 0x30,
+	0x00, 0xe5, 0x79, 0x5f, 0x26, 0x8b, 0x14, 0x56, 0x24, 0x82, 0x38, 0x61,
+	0x72, 0x74, 0x7a, 0x20, 0xb2, 0xc3, 0x41, 0x00, 0x00, 0x1f, 0x14, 0x13,
+	0x08, 0x50, 0x01, 0xe4, 0x06, 0x10, 0x80, 0x2e, 0x0a, 0xf0, 0x24, 0x20,
+	0xc1, 0x03, 0x97, 0xc0, 0x61, 0x70, 0x74, 0x78, 0x20, 0xb0, 0x64, 0x71,
+	0x7f, 0x0b, 0x54, 0x82, 0xa5, 0x71, 0xaf, 0x7e, 0x73, 0x0c, 0xa5, 0x93,
+	0x8a, 0x21, 0x04, 0x00, 0x05, 0xc0, 0xad, 0x71, 0x14, 0x70, 0xff, 0xd8,
+	0x49, 0xc0, 0x3c, 0x70, 0x49, 0xc0, 0x5f, 0x26, 0x40, 0x32, 0x44, 0xc0,
+	0x05, 0xc0, 0x7c, 0x00, 0xf0, 0x09, 0x55, 0xc0, 0x5f, 0x20, 0x00, 0x02,
+	0x47, 0xc0, 0xdf, 0xf0, 0x09, 0xc1, 0xd2, 0x08, 0x60, 0x00, 0x56, 0x24,
+	0x80, 0x38, 0x0f, 0xd8, 0xe2, 0x09, 0xf6, 0x03, 0xf0, 0x05, 0x0c, 0x71,
+	0x5a, 0x0b, 0xaf, 0xff, 0xff, 0xd9, 0xcb, 0x46, 0x03, 0x90, 0x24, 0xe0,
+	0xad, 0x70, 0x00, 0x1e, 0x84, 0x1f, 0x12, 0x06, 0xf2, 0x26, 0x06, 0xb6,
+	0xfe, 0x1e, 0x04, 0x90, 0xa8, 0x1e, 0x5c, 0x13, 0xa9, 0x1e, 0x5c, 0x13,
+	0x14, 0xc0, 0x2c, 0x71, 0x20, 0xe0, 0x10, 0x78, 0x26, 0x0e, 0xef, 0xfc,
+	0x18, 0x43, 0x15, 0xc0, 0x2c, 0x71, 0xe1, 0x68, 0x0e, 0xc0, 0xc6, 0x0c,
+	0x6f, 0xff, 0xe1, 0x42, 0x09, 0xc1, 0x7e, 0x08, 0x60, 0x00, 0x97, 0xc0,
+	0x0f, 0xd8, 0x92, 0x52, 0x00, 0x21, 0x73, 0x0a, 0x52, 0x00, 0x44, 0x2c,
+	0x71, 0x63, 0x40, 0x4e, 0x00, 0x51, 0x26, 0xb6, 0xfe, 0x1e, 0x44, 0x4e,
+	0x00, 0x40, 0xe6, 0x0d, 0xef, 0xfc, 0x52, 0x00, 0x51, 0x0d, 0xc0, 0x2c,
+	0x71, 0x86, 0x40, 0x00, 0xf3, 0x00, 0x0a, 0xc0, 0x0f, 0x78, 0x56, 0xc0,
+	0x8f, 0xe0, 0x0c, 0xc0, 0xca, 0x20, 0x61, 0x00, 0x4c, 0xa2, 0x06, 0xf1,
+	0x68, 0xcd, 0x07, 0x4b, 0xc0, 0x04, 0xc0, 0x46, 0xc0, 0x75, 0xf0, 0x06,
+	0xc1, 0x07, 0xc0, 0x07, 0xc6, 0x19, 0x61, 0x46, 0xc1, 0x2c, 0x72, 0x68,
+	0xf0, 0x06, 0xc0, 0x17, 0x0e, 0x31, 0x12, 0x10, 0x7a, 0x05, 0xc0, 0x87,
+	0xe8, 0x0f, 0xc0, 0x54, 0x78, 0xf0, 0x10, 0x02, 0x81, 0x40, 0xb0, 0x58,
+	0xf0, 0x0e, 0xc0, 0xf5, 0x20, 0x83, 0x00, 0x0d, 0xc0, 0xf5, 0x20, 0x8c,
+	0x00, 0x70, 0x4c, 0x48, 0x20, 0x00, 0x00, 0x0e, 0x7f, 0x8d, 0x0f, 0xb3,
+	0x11, 0x0c, 0x73, 0x3c, 0x20, 0x9b, 0x03, 0x91, 0x09, 0xe0, 0x06, 0xc1,
+	0x43, 0x0c, 0xc0, 0x08, 0xc2, 0xc3, 0x41, 0x14, 0x00, 0x03, 0x00, 0x0f,
+	0x78, 0x78, 0x20, 0x00, 0x00, 0x16, 0x0c, 0xaf, 0xfc, 0x40, 0xc7, 0x10,
+	0xc0, 0x63, 0x43, 0x55, 0x20, 0xc1, 0x08, 0x11, 0xc0, 0x05, 0x79, 0x08,
+	0x98, 0x06, 0x02, 0xce, 0x01, 0x00, 0xa2, 0x0b, 0x20, 0x04, 0x00, 0xce,
+	0x01, 0xf0, 0x13, 0x05, 0x20, 0x8d, 0x0f, 0x02, 0x90, 0x00, 0x00, 0x40,
+	0x95, 0x16, 0xc0, 0x00, 0x24, 0x81, 0x3f, 0x00, 0x00, 0xc4, 0x01, 0x33,
+	0x21, 0x01, 0x00, 0x40, 0xc2, 0x58, 0x61, 0x0e, 0x78, 0x08, 0xc2, 0x42,
+	0xc0, 0x70, 0x00, 0x60, 0x41, 0xc1, 0x49, 0x20, 0x0f, 0x08, 0x74, 0x05,
+	0xf0, 0x0d, 0x15, 0x00, 0x06, 0x00, 0x26, 0x09, 0x2f, 0xfd, 0x43, 0xc7,
+	0xe0, 0xb5, 0xad, 0x71, 0x63, 0x41, 0x0a, 0xf0, 0x0f, 0xc0, 0x14, 0x20,
+	0x82, 0x00, 0x78, 0x64, 0x1c, 0x78, 0x2a, 0x00, 0xf0, 0x0a, 0x00, 0xb2,
+	0x06, 0xc0, 0xc5, 0x71, 0x04, 0x71, 0x46, 0xc0, 0x33, 0x0e, 0x54, 0x92,
+	0x0b, 0xc0, 0x04, 0x71, 0x4b, 0xc0, 0x0b, 0xc0, 0x0f, 0x78, 0x48, 0x62,
+	0x03, 0xf0, 0x12, 0x80, 0xcd, 0x07, 0x21, 0x88, 0x08, 0xc0, 0x0d, 0x09,
+	0x25, 0x80, 0xb5, 0x70, 0xe0, 0x0b, 0x82, 0xfe, 0x0a, 0xc0, 0x04, 0x71,
+	0x4a, 0xc0, 0xb5, 0x70, 0x22, 0xf5, 0x12, 0xc0, 0x81, 0x08, 0x30, 0x00,
+	0x62, 0x00, 0x82, 0x16, 0x00, 0x00, 0x00, 0xc2, 0x08, 0x0f, 0xfd, 0xbe,
+	0x0c, 0xf0, 0x0f, 0xcd, 0x07, 0x2d, 0xf0, 0x04, 0xc0, 0x07, 0xc7, 0x10,
+	0x79, 0x07, 0xc0, 0x38, 0x60, 0x44, 0xc0, 0x24, 0xf0, 0x09, 0x0f, 0x11,
+	0x12, 0x05, 0xc0, 0x1c, 0xe8, 0x04, 0xc0, 0x1b, 0x78, 0xae, 0x0c, 0xf0,
+	0x0d, 0x01, 0x00, 0xfe, 0xff, 0x0e, 0xc0, 0x35, 0x20, 0x43, 0x00, 0x0d,
+	0xc0, 0x35, 0x20, 0x42, 0x00, 0x0f, 0xc0, 0x35, 0x20, 0x40, 0x00, 0x41,
+	0xc2, 0x40, 0xc3, 0x42, 0xc0, 0x50, 0x00, 0xf2, 0x0b, 0x17, 0x00, 0x05,
+	0x00, 0xa1, 0x42, 0x72, 0x08, 0x2f, 0xfd, 0xe1, 0x43, 0x04, 0xc0, 0xe5,
+	0x71, 0x04, 0x71, 0x44, 0xc0, 0xbd, 0x0f, 0x54, 0x92, 0xc5, 0x71, 0x02,
+	0x03, 0xf0, 0x03, 0x01, 0x88, 0xcf, 0x7d, 0x9f, 0x08, 0x45, 0x83, 0x8a,
+	0x09, 0x6f, 0xfe, 0x13, 0xc0, 0x00, 0x1e, 0x05, 0x70, 0x1e, 0x08, 0x42,
+	0x80, 0x24, 0x09, 0x31, 0x30, 0x05, 0x02, 0x48, 0x04, 0x80, 0xa4, 0xc1,
+	0x08, 0x45, 0x5f, 0x20, 0x41, 0x06, 0x34, 0x00, 0x62, 0xc9, 0x07, 0x00,
+	0x88, 0x58, 0x43, 0xc0, 0x0a, 0x10, 0x00, 0x0a, 0x0d, 0xf0, 0x14, 0x80,
+	0x7c, 0x06, 0xe2, 0x88, 0x0c, 0x70, 0x4e, 0x0b, 0xef, 0xfc, 0x2c, 0x70,
+	0x0c, 0x71, 0x44, 0x25, 0xca, 0x17, 0x11, 0x0a, 0x10, 0x10, 0x42, 0x22,
+	0x4a, 0x10, 0xff, 0x0a, 0x31, 0x90, 0x1b, 0x78, 0x77, 0x70, 0x0a, 0x04,
+	0xf5, 0x13, 0x2c, 0x70, 0xcf, 0x27, 0xe2, 0x11, 0x4c, 0x73, 0x0f, 0x20,
+	0x40, 0x03, 0x0f, 0x78, 0x42, 0xc0, 0xff, 0xd8, 0x22, 0xdb, 0x28, 0x46,
+	0x43, 0xc1, 0x04, 0x1c, 0x81, 0x30, 0xfa, 0x0d, 0xef, 0xfc, 0x40, 0xc7,
+	0xee, 0x0c, 0xe0, 0xc6, 0x42, 0xc6, 0x41, 0xc6, 0xd6, 0x0b, 0xef, 0xfc,
+	0x40, 0xc6, 0x0c, 0x70, 0x8e, 0x58, 0x00, 0x23, 0x71, 0xa4, 0xc0, 0x05,
+	0x04, 0x90, 0x00, 0xf2, 0x04, 0x28, 0x45, 0xd2, 0x09, 0xaf, 0xfd, 0x08,
+	0x47, 0x08, 0x46, 0x0c, 0x70, 0xd2, 0x0a, 0xef, 0xfc, 0x08, 0xd9, 0x6f,
+	0x0e, 0x0d, 0xf6, 0x12, 0x70, 0x28, 0xdb, 0x0c, 0x1c, 0xc0, 0x36, 0x42,
+	0xc7, 0x04, 0x1c, 0xc0, 0x36, 0x92, 0x0b, 0xef, 0xfc, 0x00, 0x1c, 0xc0,
+	0x36, 0xd6, 0x0d, 0xef, 0xfc, 0xff, 0xd8, 0x2e, 0xe6, 0x18, 0xed, 0x36,
+	0xf8, 0x1e, 0x00, 0x13, 0x72, 0x1e, 0x00, 0x77, 0xff, 0xd8, 0x0c, 0xd9,
+	0x4c, 0x71, 0x0a, 0x38, 0x00, 0x00, 0x34, 0x00, 0x62, 0x0a, 0xf0, 0x0c,
+	0x1c, 0x41, 0x30, 0x48, 0x00, 0x00, 0x10, 0x00, 0x61, 0x28, 0xf8, 0x42,
+	0x0b, 0xcf, 0xfc, 0x72, 0x0d, 0x27, 0x71, 0x08, 0x2c, 0x00, 0x13, 0x2e,
+	0x46, 0x00, 0x42, 0xad, 0x70, 0xcf, 0x7b, 0x4a, 0x00, 0x70, 0x43, 0xc5,
+	0x42, 0xc7, 0x41, 0xc5, 0x16, 0xc0, 0x00, 0x11, 0xc5, 0x30, 0x00, 0x70,
+	0x75, 0x6c, 0x72, 0x0c, 0x1c, 0xc1, 0x30, 0x7c, 0x0d, 0xf1, 0x01, 0xfe,
+	0x0a, 0xef, 0xfc, 0x40, 0xc5, 0x2c, 0x70, 0xff, 0xd8, 0x8f, 0xb9, 0x4c,
+	0x75, 0x6c, 0x74, 0x64, 0x00, 0x41, 0xc5, 0x41, 0xc5, 0xe6, 0x18, 0x00,
+	0xa0, 0xff, 0xd8, 0x2c, 0x70, 0x4c, 0x75, 0x10, 0xdb, 0x43, 0xc5, 0x00,
+	0x00, 0x00, 0x00, 0xb5, 0x0c, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60,
+	0x40, 0x82, 0xa6, 0x0c, 0x00, 0x00, 0xf4, 0x9f, 0x42, 0xc5, 0x41, 0xc5,
+	0xd2, 0x0a, 0xef, 0xfc, 0x40, 0xc5, 0xfe, 0x0c, 0xef, 0xfc, 0xff, 0xd8,
+	0xc1, 0xbf, 0xff, 0xd8, 0x80, 0xd9, 0x4c, 0x76, 0x6c, 0x74, 0x43, 0xc5,
+	0x42, 0xc7, 0x41, 0xc5, 0xb6, 0x0a, 0xef, 0xfc, 0x00, 0x1c, 0x41, 0x30,
+	0xa4, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xff, 0xd8, 0x0c, 0xd9,
+	0x4c, 0x71, 0x08, 0xdb, 0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c,
+	0xc8, 0xb6, 0xa8, 0xc1, 0x45, 0xc1, 0x18, 0x43, 0x0c, 0x70, 0xff, 0xd9,
+	0x46, 0xc3, 0xb2, 0x09, 0xef, 0xfc, 0x44, 0xc2, 0x0d, 0xc0, 0xcd, 0x70,
+	0xad, 0x70, 0x47, 0xc0, 0x3a, 0xf0, 0x32, 0x25, 0x8f, 0x1f, 0x00, 0x80,
+	0x24, 0x06, 0x2c, 0x70, 0x96, 0x08, 0xaf, 0xfc, 0xe1, 0x42, 0x07, 0xc2,
+	0x44, 0x79, 0x06, 0xc2, 0x44, 0x78, 0x05, 0x20, 0x7e, 0x80, 0x2b, 0xf4,
+	0x05, 0xc0, 0x2c, 0x70, 0x4c, 0x73, 0x22, 0xdb, 0xe8, 0x60, 0x0c, 0x1c,
+	0x01, 0x30, 0x08, 0x1c, 0xc0, 0x36, 0x40, 0xc0, 0xff, 0xd8, 0x56, 0x0c,
+	0xef, 0xfc, 0x41, 0xc7, 0x07, 0x0d, 0x90, 0x11, 0x99, 0xed, 0xb5, 0x70,
+	0xc8, 0xd9, 0xfa, 0xd8, 0x5e, 0x0a, 0x2f, 0xfe, 0xca, 0x20, 0x41, 0x00,
+	0x1d, 0x78, 0x02, 0x00, 0xa0, 0x0f, 0x78, 0x43, 0xc0, 0x0c, 0x70, 0x42,
+	0xc0, 0x41, 0xc0, 0x32, 0x00, 0xf0, 0x05, 0x2c, 0x70, 0x4c, 0x75, 0x1e,
+	0x0c, 0xef, 0xfc, 0x20, 0xdb, 0xa5, 0x71, 0x8f, 0x0d, 0x34, 0x93, 0x0c,
+	0x71, 0xff, 0xd8, 0x14, 0x00, 0xf1, 0x01, 0x41, 0xdb, 0x0c, 0x1c, 0x01,
+	0x34, 0x42, 0xc6, 0x41, 0xc6, 0xf2, 0x09, 0xef, 0xfc, 0x40, 0xc6, 0xda,
+	0x00, 0x50, 0x75, 0x6c, 0x74, 0x43, 0xc6, 0x14, 0x00, 0x11, 0xde, 0x14,
+	0x00, 0xf0, 0x13, 0x0c, 0x70, 0x96, 0x09, 0xef, 0xfc, 0x2c, 0x71, 0x04,
+	0xc0, 0x33, 0xe8, 0x0c, 0x70, 0xf2, 0x08, 0xef, 0xfc, 0xff, 0xd9, 0x4f,
+	0xd8, 0xad, 0x70, 0x53, 0x23, 0x5b, 0x30, 0x40, 0xc0, 0x17, 0xf8, 0x43,
+	0xc5, 0x98, 0x00, 0x00, 0xd8, 0x00, 0x51, 0x41, 0xc5, 0x0c, 0x70, 0x6a,
+	0x2c, 0x00, 0xf1, 0x00, 0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42, 0xa6, 0x0f,
+	0x2f, 0xfe, 0x2c, 0x70, 0x0c, 0x70, 0xbe, 0x34, 0x00, 0x53, 0x51, 0xd8,
+	0x40, 0xc0, 0x0b, 0x2e, 0x00, 0x40, 0x82, 0x09, 0xef, 0xfc, 0x2e, 0x00,
+	0x13, 0x3a, 0x2e, 0x00, 0xb3, 0x00, 0x00, 0x40, 0x1f, 0x76, 0x0f, 0x2f,
+	0xfe, 0x1e, 0xd9, 0xa8, 0x46, 0x01, 0x20, 0xe0, 0x78, 0x8c, 0x00, 0x46,
+	0x17, 0xda, 0x6c, 0x74, 0x48, 0x01, 0xf0, 0x19, 0xac, 0xc1, 0x49, 0xc3,
+	0x47, 0xc2, 0x4a, 0xc1, 0x5e, 0x0c, 0x2f, 0xfd, 0x46, 0xc0, 0x11, 0xc0,
+	0xed, 0x71, 0x4b, 0xc0, 0x12, 0xc0, 0x48, 0xc0, 0xff, 0xd8, 0x44, 0xc0,
+	0x0c, 0x70, 0x45, 0xc0, 0xb8, 0xf0, 0x05, 0xc0, 0x32, 0x20, 0x9b, 0x0f,
+	0x50, 0x01, 0xf1, 0x08, 0x0a, 0xc0, 0x32, 0x20, 0xce, 0x06, 0x04, 0xc0,
+	0x0f, 0x78, 0x8c, 0x20, 0xc3, 0x8f, 0x0b, 0xf4, 0xc3, 0x40, 0x00, 0x00,
+	0x00, 0x0a, 0x32, 0x8a, 0x00, 0xf2, 0x0f, 0x52, 0x08, 0x8f, 0xff, 0x0c,
+	0x70, 0x44, 0xc0, 0xe1, 0x41, 0x44, 0x23, 0xc0, 0x37, 0x09, 0xc2, 0x06,
+	0xe8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x3b, 0x79, 0x1f, 0xd8, 0x24,
+	0x7a, 0x0c, 0x00, 0xf8, 0x0f, 0x3c, 0x79, 0x0b, 0xc0, 0x24, 0x78, 0x05,
+	0x22, 0x3e, 0x80, 0x79, 0xf4, 0xdd, 0x78, 0x1d, 0x78, 0x44, 0x20, 0x00,
+	0x08, 0x45, 0x20, 0x8d, 0x01, 0x08, 0xc0, 0x0b, 0xe8, 0x7e, 0xf8, 0x5c,
+	0x01, 0x20, 0xb6, 0x08, 0x58, 0x01, 0x10, 0x04, 0xaa, 0x01, 0xf0, 0x0b,
+	0x70, 0x04, 0x71, 0x44, 0xc0, 0xc3, 0x40, 0x00, 0x80, 0xe0, 0x06, 0x01,
+	0x88, 0x6c, 0x72, 0x41, 0xc7, 0x43, 0xc0, 0x06, 0xc0, 0x40, 0xc5, 0x42,
+	0xc0, 0x92, 0x78, 0x00, 0x14, 0xd8, 0x1a, 0x00, 0x01, 0x3c, 0x01, 0xb0,
+	0x31, 0x43, 0xc0, 0x69, 0xf8, 0x42, 0xc5, 0x41, 0xc7, 0x76, 0x08, 0x40,
+	0x02, 0x40, 0xc0, 0x36, 0x68, 0xf8, 0x2e, 0x00, 0x00, 0x36, 0x00, 0x33,
+	0x42, 0xc0, 0xdd, 0x70, 0x00, 0x59, 0x80, 0x05, 0x40, 0xc0, 0x56, 0x3c,
+	0x00, 0xc0, 0xc5, 0xbe, 0x2c, 0x70, 0x43, 0xc0, 0xff, 0xd8, 0x4c, 0x70,
+	0x6c, 0x72, 0x3e, 0x00, 0x20, 0x3a, 0x08, 0xb8, 0x01, 0x40, 0x05, 0xc0,
+	0x19, 0xe8, 0xe2, 0x00, 0x80, 0x10, 0x27, 0x52, 0x0e, 0x2f, 0xfe, 0x0a,
+	0xd9, 0x06, 0x02, 0x50, 0x04, 0x77, 0x0f, 0x7e, 0x50, 0x62, 0x00, 0xd0,
+	0xc5, 0x40, 0xc5, 0x12, 0x08, 0xef, 0xfc, 0x43, 0xc6, 0x4d, 0xf8, 0x43,
+	0xc6, 0xce, 0x02, 0x44, 0x40, 0xc5, 0x0d, 0xf0, 0x8c, 0x00, 0x00, 0x10,
+	0x00, 0x41, 0x43, 0xc0, 0x40, 0xc5, 0x10, 0x02, 0xf0, 0x14, 0x70, 0x18,
+	0xdb, 0xea, 0x0f, 0x8f, 0xfc, 0x04, 0xc0, 0x0f, 0x79, 0x0f, 0x09, 0x10,
+	0x01, 0x05, 0xc0, 0x17, 0x08, 0xd1, 0x02, 0x09, 0xe9, 0xca, 0x0e, 0x4f,
+	0xff, 0x0c, 0x70, 0x8e, 0x0f, 0xaf, 0xfc, 0x2c, 0x71, 0x6c, 0x01, 0xf0,
+	0x09, 0x05, 0xc0, 0x04, 0x71, 0x45, 0xc0, 0x05, 0xc0, 0x8c, 0xe0, 0x90,
+	0x06, 0xc5, 0xff, 0x07, 0xc0, 0xcf, 0x08, 0x30, 0x00, 0xff, 0xd9, 0xcb,
+	0x47, 0x62, 0x01, 0xf0, 0x09, 0xd2, 0x0e, 0xaf, 0xfc, 0xe1, 0x40, 0xee,
+	0x0e, 0x4f, 0xff, 0xcb, 0x46, 0x00, 0x80, 0xe1, 0x06, 0x00, 0x8e, 0x2c,
+	0x70, 0x4a, 0x23, 0x00, 0x38, 0xdc, 0x00, 0x01, 0xb4, 0x00, 0xf0, 0x00,
+	0xc0, 0xff, 0xd8, 0x28, 0x45, 0x41, 0xc1, 0x82, 0x0f, 0xaf, 0xfc, 0x00,
+	0x1c, 0xc0, 0x36, 0x20, 0x00, 0x11, 0x4c, 0xd2, 0x00, 0x01, 0xd0, 0x00,
+	0x21, 0xc5, 0x6a, 0x18, 0x00, 0x31, 0xc1, 0x33, 0x56, 0x74, 0x00, 0x11,
+	0x1a, 0x74, 0x00, 0x02, 0x4e, 0x02, 0x20, 0x56, 0x0d, 0x4e, 0x02, 0xc4,
+	0xe1, 0x40, 0x6e, 0x0e, 0xaf, 0xfc, 0xff, 0xd9, 0x8e, 0x0e, 0x4f, 0xff,
+	0x3c, 0x00, 0xb1, 0x06, 0xc0, 0x6c, 0x72, 0x41, 0xc5, 0x42, 0xc0, 0xff,
+	0xd8, 0x2a, 0x3e, 0x00, 0x0e, 0x56, 0x00, 0x11, 0x12, 0x18, 0x00, 0x24,
+	0x41, 0x34, 0x32, 0x00, 0x40, 0xff, 0xd8, 0x10, 0xdb, 0xfa, 0x00, 0x80,
+	0xfa, 0x0e, 0xaf, 0xfc, 0x40, 0xc5, 0xea, 0x0d, 0xe0, 0x00, 0x20, 0xae,
+	0x0e, 0xe0, 0x00, 0x57, 0x06, 0x0c, 0x0f, 0xfd, 0xac, 0x84, 0x02, 0x20,
+	0x2c, 0x70, 0xb6, 0x00, 0x00, 0x84, 0x02, 0x04, 0x32, 0x01, 0x00, 0x12,
+	0x00, 0x00, 0x10, 0x00, 0x02, 0xdc, 0x03, 0xf0, 0x01, 0xa9, 0xc1, 0x45,
+	0xc1, 0x58, 0xd9, 0x9f, 0xb9, 0x46, 0xc0, 0x00, 0x89, 0xcd, 0x11, 0x8f,
+	0x80, 0xd6, 0x03, 0xf6, 0x2f, 0x0e, 0xc0, 0xcd, 0x71, 0x43, 0xc3, 0x44,
+	0xc2, 0x48, 0xc0, 0x58, 0xf0, 0x44, 0x25, 0xc1, 0x17, 0x6f, 0x70, 0x05,
+	0xe9, 0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x1b, 0x78, 0x42, 0xc0, 0x4b,
+	0xf0, 0x07, 0xc0, 0x02, 0xc2, 0x08, 0xc1, 0x77, 0x70, 0xca, 0x20, 0xc1,
+	0x03, 0x44, 0x79, 0x0b, 0x79, 0x42, 0xf2, 0x02, 0xc0, 0x44, 0x23, 0xc1,
+	0x37, 0x2f, 0x26, 0x07, 0x30, 0xc1, 0x40, 0x2c, 0x00, 0x62, 0x9e, 0x0e,
+	0xef, 0xfc, 0x0f, 0x78, 0x78, 0x00, 0xfc, 0x2b, 0x00, 0x88, 0x1c, 0xe8,
+	0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x01, 0x00, 0x31, 0x08, 0xdf, 0x00,
+	0x03, 0xc0, 0x5a, 0x23, 0x81, 0x3c, 0x5f, 0x26, 0x02, 0x31, 0x40, 0xc0,
+	0x06, 0xc0, 0x04, 0xc3, 0x04, 0x1c, 0x01, 0x30, 0x19, 0x61, 0x5a, 0x25,
+	0x40, 0x16, 0x19, 0x61, 0x02, 0xc0, 0x45, 0x78, 0x05, 0xc2, 0xce, 0x0c,
+	0xef, 0xff, 0x0f, 0x78, 0x14, 0xf0, 0x2a, 0x00, 0x0a, 0x26, 0x00, 0x20,
+	0x62, 0x0b, 0x26, 0x00, 0xf3, 0x06, 0x67, 0x71, 0x6f, 0x0b, 0x94, 0xb0,
+	0xa5, 0x71, 0x53, 0x0d, 0xb4, 0x90, 0xc1, 0x40, 0x26, 0x0e, 0xef, 0xfc,
+	0x0c, 0x73, 0xa9, 0x06, 0x01, 0xf0, 0x71, 0xe6, 0xc2, 0xc3, 0x43, 0x00,
+	0x80, 0xcd, 0x07, 0x80, 0x8b, 0xa1, 0x8b, 0x5f, 0x24, 0x82, 0x14, 0x58,
+	0x60, 0x17, 0xf0, 0x21, 0x09, 0xee, 0x00, 0x60, 0x42, 0x9a, 0x22, 0x08,
+	0x00, 0x1a, 0x26, 0x8f, 0x1f, 0x00, 0x00, 0x00, 0x20, 0xe5, 0x7a, 0x05,
+	0x22, 0x8f, 0x0f, 0x02, 0x90, 0x64, 0x00, 0x40, 0x90, 0x40, 0xb7, 0x64,
+	0x71, 0x04, 0x72, 0xdd, 0x0b, 0x54, 0x82, 0x85, 0x71, 0x8f, 0x7e, 0xf9,
+	0x0d, 0xa5, 0x93, 0x6c, 0x70, 0x7e, 0x0c, 0x4f, 0xfe, 0xc6, 0xc6, 0xe2,
+	0xc2, 0x9a, 0x21, 0x01, 0x00, 0x9a, 0x23, 0x01, 0x00, 0xcb, 0x44, 0x08,
+	0x90, 0x00, 0x01, 0x25, 0x78, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x04,
+	0x00, 0x45, 0x7b, 0x1a, 0x21, 0x8d, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x05,
+	0x25, 0x01, 0x13, 0x00, 0xb1, 0x02, 0x6c, 0xa5, 0x78, 0x60, 0xb0, 0x0c,
+	0x70, 0x1a, 0x0d, 0x96, 0x01, 0xf1, 0x14, 0xc2, 0xc6, 0xe0, 0x78, 0xe2,
+	0xc2, 0x0a, 0x26, 0x40, 0x30, 0x08, 0x43, 0xad, 0x70, 0x24, 0xf0, 0x5a,
+	0x25, 0x82, 0x11, 0x61, 0x72, 0x01, 0x8a, 0x60, 0x8a, 0x22, 0x8a, 0x9a,
+	0x20, 0x04, 0x00, 0x05, 0x7b, 0x03, 0x08, 0x00, 0x70, 0x25, 0x78, 0x1a,
+	0x20, 0x80, 0x0f, 0x01, 0x46, 0x00, 0x90, 0x20, 0xc1, 0x00, 0x05, 0x8a,
+	0x64, 0x8a, 0x34, 0x77, 0x20, 0x00, 0xf0, 0x0d, 0x65, 0x78, 0x07, 0xf2,
+	0x3b, 0x79, 0x9c, 0xb9, 0x9f, 0xb9, 0x00, 0xb1, 0x03, 0xf0, 0xb6, 0x0a,
+	0x0f, 0xfe, 0xa5, 0x71, 0x45, 0x2e, 0x80, 0x31, 0xb9, 0x0d, 0x04, 0x90,
+	0x5c, 0x00, 0x02, 0xcc, 0x01, 0x40, 0xa1, 0xc1, 0x18, 0x47, 0x6e, 0x01,
+	0xf0, 0x13, 0xcd, 0x07, 0xc0, 0x88, 0x38, 0x43, 0x40, 0xc3, 0x04, 0xea,
+	0xdb, 0x79, 0x04, 0xf0, 0x5f, 0x26, 0x41, 0x12, 0x01, 0x10, 0x9e, 0x00,
+	0x54, 0x70, 0x08, 0xdd, 0xca, 0x25, 0x62, 0x10, 0x39, 0xf0, 0xe1, 0x40,
+	0x54, 0x00, 0xb1, 0x00, 0xc3, 0xf5, 0x23, 0x42, 0x30, 0x13, 0xeb, 0x5c,
+	0x7c, 0x9c, 0x02, 0x00, 0xf0, 0x26, 0x4a, 0x22, 0xc0, 0x16, 0x44, 0x2a,
+	0x03, 0x08, 0x42, 0x22, 0x4a, 0x10, 0xfd, 0x0a, 0x31, 0x90, 0x9d, 0x7c,
+	0x9a, 0x62, 0xc4, 0xba, 0x94, 0x4a, 0x0d, 0xf0, 0x8a, 0x24, 0xcf, 0x1f,
+	0x44, 0x7c, 0x04, 0x22, 0x83, 0x0f, 0x00, 0x00, 0x00, 0xfc, 0x0a, 0xda,
+	0x61, 0xba, 0xff, 0x0a, 0x31, 0x80, 0x7d, 0x7b, 0x1a, 0x26, 0x82, 0x3c,
+	0x01, 0x10, 0x10, 0x10, 0x01, 0xf2, 0x15, 0xe5, 0x71, 0x24, 0x71, 0x05,
+	0x22, 0xc2, 0x07, 0x45, 0x78, 0x1b, 0x78, 0x91, 0xb8, 0x9c, 0xb8, 0x85,
+	0x7b, 0x9f, 0xb8, 0x60, 0xb0, 0x97, 0x0d, 0xc5, 0x93, 0xc5, 0x71, 0xfd,
+	0x0e, 0xa5, 0xb3, 0xed, 0x70, 0x87, 0x74, 0x60, 0x06, 0x04, 0xac, 0x00,
+	0x22, 0x14, 0x70, 0x10, 0x02, 0xf0, 0x45, 0x1b, 0x00, 0xc3, 0x43, 0x40,
+	0x00, 0x00, 0x18, 0x68, 0x45, 0xc0, 0x7d, 0xc3, 0x42, 0x00, 0x80, 0x88,
+	0x06, 0x2f, 0x08, 0x3e, 0x00, 0x6f, 0x70, 0xc3, 0x41, 0x00, 0x80, 0xd3,
+	0x07, 0x04, 0x89, 0x0f, 0xe8, 0x00, 0x89, 0xcb, 0x44, 0x00, 0x80, 0xba,
+	0x06, 0x00, 0xaa, 0x01, 0x89, 0x19, 0xaa, 0x02, 0x89, 0x00, 0xac, 0x03,
+	0x89, 0x19, 0xac, 0x50, 0x23, 0x00, 0x03, 0x04, 0x7d, 0x42, 0x22, 0x0e,
+	0x03, 0xc1, 0x40, 0x06, 0x0f, 0x2f, 0xff, 0x0d, 0xd9, 0xc1, 0x40, 0x0d,
+	0xd9, 0xbe, 0x0c, 0xef, 0xfd, 0x40, 0xda, 0x0a, 0x00, 0xf0, 0x07, 0x8e,
+	0x0e, 0xaf, 0xfc, 0x7f, 0xda, 0xff, 0xdf, 0xc1, 0x40, 0x2c, 0x70, 0xa1,
+	0x42, 0x63, 0x43, 0x12, 0x0d, 0xef, 0xff, 0x40, 0xc7, 0x1a, 0x00, 0x60,
+	0x9a, 0x0c, 0xef, 0xfd, 0x80, 0xda, 0x18, 0x00, 0xa2, 0xc3, 0x42, 0xff,
+	0xff, 0xff, 0xdf, 0x6c, 0x77, 0xf6, 0x0c, 0x1c, 0x00, 0x20, 0xbe, 0x0a,
+	0x48, 0x00, 0x04, 0xaa, 0x00, 0x04, 0x00, 0x07, 0xe2, 0x82, 0x24, 0x03,
+	0x34, 0x2c, 0x70, 0x22, 0x0f, 0xaf, 0xfc, 0x08, 0x45, 0x42, 0xc0, 0xb6,
+	0x00, 0xf0, 0x2f, 0x04, 0x00, 0x22, 0x0c, 0x20, 0x00, 0x41, 0xc0, 0xa1,
+	0x40, 0x0e, 0x0e, 0x2f, 0xfd, 0x55, 0x24, 0xc1, 0x3b, 0xed, 0x71, 0xe1,
+	0x40, 0x44, 0x25, 0xce, 0x17, 0x05, 0xee, 0x61, 0xbe, 0xff, 0x0e, 0x31,
+	0x90, 0x1b, 0x78, 0x5a, 0x20, 0x00, 0x01, 0x0f, 0x20, 0x40, 0x03, 0x7e,
+	0x0d, 0x6f, 0xfd, 0x0f, 0x78, 0x2c, 0x70, 0xc3, 0x40, 0x03, 0x90, 0x64,
+	0xfe, 0x00, 0x1e, 0x44, 0x70, 0x08, 0x00, 0xf4, 0x09, 0x82, 0x18, 0x5c,
+	0x00, 0x8a, 0x20, 0x08, 0x08, 0x00, 0x1e, 0x04, 0x70, 0x03, 0x90, 0x04,
+	0xe0, 0x00, 0x1e, 0xc4, 0x73, 0x0f, 0x90, 0xc0, 0xe0, 0x20, 0x00, 0xa4,
+	0x10, 0xf0, 0x41, 0x69, 0x9a, 0x21, 0x08, 0x00, 0xe1, 0x43, 0xe0, 0x05,
+	0xf0, 0x23, 0x7b, 0x7b, 0x05, 0x21, 0x80, 0x0f, 0x03, 0x90, 0xc4, 0xe0,
+	0x60, 0xb0, 0x40, 0x41, 0xe3, 0x09, 0x34, 0x82, 0x44, 0x21, 0xc0, 0x07,
+	0xcb, 0x45, 0x00, 0x00, 0xaa, 0xaa, 0x0f, 0xd8, 0xa1, 0x41, 0xa1, 0x42,
+	0xa1, 0x43, 0x8e, 0x09, 0x6f, 0xfd, 0x40, 0xc5, 0x0f, 0xd8, 0x2a, 0x0e,
+	0xaf, 0xfc, 0x0f, 0xd9, 0x54, 0x05, 0xf0, 0x22, 0x00, 0x0f, 0x82, 0x0e,
+	0x2f, 0xff, 0x2c, 0x71, 0xcb, 0x46, 0x03, 0x90, 0x74, 0xe1, 0x0c, 0x70,
+	0x00, 0xb6, 0x8a, 0x20, 0xc7, 0x0f, 0x01, 0xb6, 0xdb, 0x43, 0x00, 0x00,
+	0xff, 0xff, 0x30, 0xd8, 0x58, 0x1e, 0xdc, 0x96, 0x5e, 0x1e, 0xdc, 0x93,
+	0x6e, 0x0a, 0xaf, 0xfc, 0x57, 0x1e, 0xdc, 0x93, 0x0f, 0x5a, 0x07, 0x70,
+	0x70, 0x63, 0x43, 0x42, 0x09, 0x6f, 0xfd, 0xe2, 0x04, 0x40, 0x0c, 0x74,
+	0x56, 0x0a, 0xc4, 0x02, 0x04, 0x62, 0x00, 0x11, 0x2a, 0x62, 0x00, 0x00,
+	0x48, 0x00, 0xc0, 0x01, 0xb6, 0x20, 0xd8, 0x58, 0x1e, 0x1c, 0x90, 0x8a,
+	0x20, 0x44, 0x08, 0x42, 0x00, 0x42, 0x57, 0x1e, 0x1c, 0x90, 0x72, 0x00,
+	0x10, 0x0e, 0x72, 0x00, 0x41, 0x73, 0x30, 0xd8, 0x1a, 0x3a, 0x00, 0x60,
+	0x01, 0xc0, 0x00, 0x16, 0x82, 0x70, 0x84, 0x03, 0x00, 0xde, 0x02, 0x51,
+	0x10, 0x00, 0x00, 0x00, 0x43, 0x66, 0x06, 0xf0, 0x06, 0xcd, 0x07, 0x21,
+	0x88, 0x22, 0xf0, 0x0c, 0x70, 0x16, 0x20, 0x83, 0x00, 0x1a, 0xf0, 0x9a,
+	0x20, 0x08, 0x00, 0x1a, 0x22, 0x8c, 0x64, 0x02, 0x61, 0x20, 0x85, 0x78,
+	0x05, 0x20, 0x80, 0x8e, 0x03, 0x53, 0x00, 0x90, 0x1d, 0x7c, 0x9d, 0x02,
+	0x00, 0xf0, 0x0b, 0xc4, 0xb8, 0x05, 0x7c, 0x87, 0xc0, 0x74, 0x78, 0x80,
+	0xb0, 0x64, 0x71, 0xe1, 0x40, 0xd1, 0x08, 0x34, 0x82, 0xe1, 0x68, 0x44,
+	0x71, 0xc1, 0x09, 0xa5, 0x80, 0xd2, 0x00, 0x82, 0x00, 0xb6, 0xed, 0x70,
+	0x0c, 0x71, 0xe1, 0xb6, 0xd0, 0x00, 0x20, 0x1c, 0x90, 0x8e, 0x00, 0x42,
+	0x8a, 0x20, 0xd0, 0x07, 0x60, 0x01, 0x62, 0x64, 0xfe, 0x30, 0xd8, 0x8e,
+	0x09, 0xc8, 0x00, 0x00, 0x02, 0x05, 0x44, 0x63, 0x43, 0x62, 0x08, 0xe0,
+	0x00, 0x13, 0x76, 0x18, 0x00, 0x02, 0x42, 0x01, 0x20, 0x4a, 0x08, 0x42,
+	0x01, 0x02, 0xc8, 0x00, 0x93, 0x2c, 0x71, 0xe0, 0xb6, 0x42, 0x0d, 0x2f,
+	0xff, 0xe1, 0xea, 0x00, 0x33, 0x0c, 0x71, 0x5e, 0xf0, 0x00, 0x00, 0x5e,
+	0x00, 0x51, 0x3e, 0x09, 0xaf, 0xfc, 0x30, 0x16, 0x07, 0x71, 0xcd, 0x07,
+	0x01, 0x88, 0x00, 0x16, 0x8b, 0xe4, 0x00, 0x71, 0x46, 0xc0, 0x84, 0xf0,
+	0x1a, 0x23, 0x80, 0x1a, 0x03, 0xf3, 0x0a, 0x16, 0x27, 0xde, 0x12, 0x4c,
+	0x70, 0x44, 0xc0, 0x04, 0xc1, 0x03, 0xc0, 0x25, 0x78, 0x45, 0xc0, 0x02,
+	0xc0, 0x55, 0x20, 0x01, 0x0d, 0x05, 0xc0, 0x25, 0x26, 0x03, 0xf8, 0x06,
+	0x9f, 0xb8, 0x00, 0x90, 0xc4, 0xb8, 0x41, 0xc0, 0x5d, 0xf0, 0x40, 0x43,
+	0x9a, 0x23, 0x04, 0x00, 0x04, 0xc0, 0x65, 0x78, 0x1b, 0xfc, 0x00, 0x23,
+	0x79, 0x3d, 0x02, 0x00, 0xf1, 0x6a, 0xc4, 0xb8, 0x05, 0x79, 0x87, 0xc0,
+	0xf5, 0x20, 0x9f, 0x07, 0x55, 0x24, 0xc0, 0x3b, 0xf4, 0x20, 0xcc, 0x02,
+	0x01, 0xc0, 0xf3, 0x71, 0x00, 0x24, 0x1b, 0x10, 0xd4, 0x27, 0x29, 0x38,
+	0xe3, 0x71, 0x40, 0x23, 0x0c, 0x34, 0x2e, 0x78, 0x1c, 0x79, 0x8e, 0x7c,
+	0x28, 0x45, 0x2e, 0x79, 0x90, 0x49, 0x54, 0x21, 0x01, 0x08, 0x2f, 0x27,
+	0x09, 0x30, 0x90, 0x49, 0x11, 0x78, 0xf1, 0x08, 0xc2, 0x87, 0x8a, 0x20,
+	0x3f, 0x00, 0x91, 0x48, 0xae, 0x78, 0x19, 0x61, 0x2f, 0x27, 0x49, 0x30,
+	0x91, 0x48, 0x31, 0x79, 0x00, 0x20, 0x8d, 0x0f, 0x00, 0x00, 0xc0, 0xff,
+	0xe7, 0x0f, 0x42, 0xb0, 0x48, 0x20, 0x01, 0x00, 0x3b, 0x78, 0x84, 0x20,
+	0x07, 0x00, 0xc4, 0xb9, 0x05, 0x79, 0x02, 0xc0, 0x05, 0xc4, 0x55, 0x20,
+	0x00, 0x0c, 0x05, 0x7c, 0x85, 0x7b, 0x7b, 0xce, 0x03, 0x93, 0x9f, 0xb8,
+	0x15, 0x0a, 0xf1, 0x01, 0x20, 0xb0, 0x9b, 0x9c, 0x00, 0xe3, 0x00, 0x10,
+	0x20, 0xb0, 0x44, 0x71, 0x40, 0x26, 0x5e, 0x30, 0x4b, 0x0a, 0x14, 0x82,
+	0xee, 0x00, 0x60, 0x20, 0x65, 0x71, 0x05, 0x20, 0x81, 0xb6, 0x01, 0xf1,
+	0x01, 0x1e, 0x01, 0xc0, 0x00, 0xb1, 0x06, 0xc0, 0x0c, 0x23, 0x00, 0x90,
+	0xf8, 0x06, 0xee, 0xff, 0xff, 0x26, 0x02, 0x22, 0x2c, 0x71, 0x54, 0x01,
+	0xf4, 0x03, 0x28, 0x45, 0x5e, 0x1e, 0x5c, 0x90, 0xee, 0x0b, 0x2f, 0xff,
+	0x57, 0x1e, 0x5c, 0x90, 0x26, 0x0f, 0x0f, 0xfe, 0x18, 0x03, 0x22, 0xc4,
+	0x73, 0x08, 0x03, 0x13, 0x44, 0x08, 0x03, 0x00, 0x10, 0x00, 0xa1, 0xc4,
+	0xfe, 0x82, 0x18, 0xdc, 0x03, 0x0f, 0xd8, 0x5a, 0x0b, 0xd0, 0x02, 0x10,
+	0x41, 0xb4, 0x02, 0xf1, 0x05, 0x0f, 0xd8, 0x4c, 0x70, 0x20, 0x43, 0xa2,
+	0x0e, 0x2f, 0xfd, 0x40, 0xc7, 0x3b, 0xf0, 0x0c, 0x70, 0xb6, 0x0f, 0x6f,
+	0xfc, 0x5e, 0x00, 0x10, 0x80, 0x52, 0x02, 0x04, 0x6c, 0x02, 0x51, 0x23,
+	0xf0, 0x1a, 0x22, 0x80, 0x4e, 0x02, 0x02, 0x4c, 0x02, 0x60, 0x66, 0x01,
+	0x60, 0x90, 0x17, 0xeb, 0x82, 0x01, 0x63, 0x0c, 0x0d, 0x03, 0xc0, 0x05,
+	0x7c, 0x1e, 0x00, 0x21, 0x10, 0x85, 0x72, 0x01, 0x60, 0x8c, 0x0f, 0x02,
+	0x90, 0x00, 0x1e, 0xba, 0x04, 0x00, 0x94, 0x01, 0xf0, 0x03, 0x55, 0x20,
+	0x00, 0x08, 0x00, 0xb4, 0x7d, 0x65, 0x44, 0x71, 0xbf, 0x09, 0xa5, 0x80,
+	0x0f, 0xd8, 0xda, 0x0a, 0x7e, 0x00, 0xf1, 0x10, 0x7a, 0x0e, 0x0f, 0xfe,
+	0xe5, 0x71, 0xa1, 0x41, 0x91, 0x0f, 0x34, 0x92, 0xad, 0x70, 0x78, 0x21,
+	0x00, 0x00, 0xc3, 0x41, 0x56, 0x01, 0x00, 0x00, 0xf2, 0x0d, 0x0f, 0xfc,
+	0x00, 0x1e, 0x05, 0xc6, 0x03, 0x42, 0x80, 0x24, 0x03, 0x34, 0xe8, 0x04,
+	0x80, 0xf1, 0xc0, 0x82, 0x24, 0x02, 0x33, 0x80, 0xc0, 0xc8, 0x04, 0xf1,
+	0x04, 0x97, 0x05, 0xfe, 0x0c, 0x2f, 0xfc, 0x8a, 0xda, 0x80, 0xc0, 0xfe,
+	0x09, 0xef, 0xff, 0x8a, 0xd9, 0x0f, 0xd8, 0x8a, 0x52, 0x00, 0xf0, 0x1e,
+	0x80, 0x24, 0x02, 0x33, 0xd1, 0xc0, 0xe0, 0x7e, 0xe6, 0xc3, 0xb2, 0xc1,
+	0x4a, 0xc1, 0x45, 0xc0, 0x2c, 0x71, 0xc4, 0xb8, 0x05, 0xe8, 0x61, 0xb8,
+	0xff, 0x08, 0x31, 0x80, 0x3b, 0x79, 0x5a, 0x21, 0x01, 0x01, 0x05, 0xc0,
+	0x0f, 0x21, 0x00, 0x00, 0x46, 0xc0, 0x05, 0xc0, 0xa2, 0x4c, 0x03, 0x41,
+	0x70, 0x00, 0x16, 0x8d, 0x70, 0x06, 0xf0, 0x11, 0x2a, 0x0d, 0x2f, 0xfd,
+	0x08, 0x46, 0x8c, 0x20, 0x82, 0x8e, 0xed, 0x70, 0xfe, 0xd8, 0x44, 0xc0,
+	0x07, 0xf7, 0x16, 0x0d, 0x0f, 0xfd, 0x54, 0x20, 0x80, 0x08, 0x44, 0xc0,
+	0x1a, 0x25, 0x8d, 0x1f, 0x66, 0x03, 0xf0, 0x0a, 0x0c, 0x71, 0x8d, 0xc1,
+	0x12, 0x0d, 0xaf, 0xfd, 0x4b, 0xc5, 0x76, 0x0f, 0xcf, 0xff, 0xcb, 0x45,
+	0x03, 0x90, 0x02, 0xe0, 0x40, 0xd8, 0x00, 0x1d, 0x84, 0x9c, 0x02, 0xf1,
+	0x42, 0x80, 0x1e, 0x0d, 0xaf, 0xfc, 0x12, 0xb5, 0x00, 0x16, 0x00, 0x71,
+	0x04, 0x90, 0x4a, 0x00, 0x98, 0xd9, 0x11, 0x20, 0x80, 0x83, 0xaa, 0xd8,
+	0xca, 0x21, 0x01, 0x00, 0xc3, 0x40, 0x05, 0x90, 0x4c, 0xe0, 0x49, 0xc0,
+	0x9c, 0x18, 0x54, 0x00, 0x49, 0xc0, 0x05, 0xc0, 0xcb, 0x46, 0x08, 0x90,
+	0x00, 0x00, 0x2c, 0x71, 0x1b, 0x78, 0x56, 0x20, 0x00, 0x0e, 0xc5, 0x78,
+	0x00, 0x90, 0x47, 0xc0, 0xe9, 0x16, 0x00, 0x17, 0x48, 0xc0, 0xa2, 0x0d,
+	0x6f, 0xfc, 0x8a, 0x20, 0x04, 0x00, 0x00, 0x12, 0x83, 0x30, 0x82, 0x09,
+	0xf0, 0x2a, 0x75, 0x43, 0xc7, 0x42, 0xc7, 0x41, 0xc7, 0x62, 0x0e, 0x6f,
+	0xfc, 0x40, 0xc7, 0x06, 0xc0, 0x4c, 0x72, 0x43, 0xc7, 0x0f, 0x78, 0x46,
+	0xc0, 0x42, 0xc0, 0x04, 0xc0, 0x41, 0xc7, 0x40, 0xc7, 0x44, 0x20, 0x41,
+	0x00, 0x38, 0x60, 0x0f, 0x78, 0x44, 0xc0, 0x04, 0xc3, 0x80, 0xd9, 0xff,
+	0xd8, 0x3a, 0x0e, 0x6f, 0xfc, 0x90, 0xb9, 0x0c, 0x70, 0xf2, 0x0d, 0xc2,
+	0x01, 0xf0, 0x11, 0x05, 0xc0, 0xde, 0x09, 0xaf, 0xff, 0x4c, 0x71, 0xf0,
+	0x16, 0x00, 0x17, 0xcb, 0x46, 0x09, 0x90, 0xe0, 0xe1, 0xc3, 0x41, 0x00,
+	0x00, 0x00, 0x0f, 0x4c, 0xc0, 0x88, 0xb8, 0x00, 0xb6, 0x07, 0xc0, 0xb6,
+	0x06, 0xf0, 0x13, 0x47, 0xc0, 0x04, 0x20, 0x42, 0x00, 0x08, 0xc0, 0x32,
+	0x79, 0x24, 0x78, 0x45, 0x78, 0x48, 0xc0, 0x87, 0xb8, 0xf2, 0x1e, 0x04,
+	0x90, 0x09, 0xc1, 0x0c, 0x71, 0x0a, 0x0c, 0x2f, 0xfd, 0x00, 0xb1, 0x47,
+	0xc0, 0x90, 0x00, 0x11, 0x0a, 0x50, 0x00, 0x0c, 0x96, 0x00, 0x20, 0xce,
+	0x0d, 0x96, 0x00, 0x60, 0x12, 0x08, 0xaf, 0xfc, 0xff, 0xd8, 0x74, 0x08,
+	0xf1, 0x02, 0x4c, 0x72, 0x42, 0xc0, 0x0c, 0x70, 0x8f, 0xb8, 0x1b, 0x79,
+	0xff, 0xd8, 0x43, 0xc7, 0x41, 0xc7, 0xae, 0x20, 0x00, 0x53, 0x07, 0xc0,
+	0x4c, 0x71, 0x43, 0xaa, 0x00, 0x80, 0x1e, 0xe0, 0x0f, 0x7b, 0xff, 0xd8,
+	0x2c, 0x74, 0xd4, 0x00, 0x11, 0x8e, 0x1e, 0x00, 0x22, 0x0c, 0x71, 0xc0,
+	0x0a, 0x51, 0x8f, 0xb9, 0x4c, 0x75, 0x6c, 0x18, 0x00, 0x11, 0x76, 0x18,
+	0x00, 0x02, 0xfe, 0x00, 0x23, 0x10, 0xdb, 0x00, 0x01, 0x01, 0x14, 0x00,
+	0x82, 0x8e, 0x0f, 0x6f, 0xfc, 0xff, 0xd8, 0x38, 0xf8, 0x14, 0x00, 0x11,
+	0x4e, 0x14, 0x00, 0x00, 0x04, 0x03, 0x80, 0x10, 0x62, 0x01, 0xb5, 0x0c,
+	0x73, 0xfe, 0x0c, 0xf4, 0x00, 0x62, 0x8a, 0x20, 0x08, 0x04, 0x01, 0xb5,
+	0x54, 0x06, 0xf1, 0x00, 0x01, 0x00, 0x0b, 0x08, 0xbf, 0x00, 0x8a, 0x20,
+	0x06, 0x06, 0x02, 0xf0, 0x33, 0xd8, 0xde, 0x20, 0x00, 0x40, 0x08, 0xc0,
+	0x4c, 0x70, 0xe2, 0x00, 0x50, 0xc6, 0x08, 0xaf, 0xff, 0x05, 0x12, 0x0d,
+	0x70, 0x0b, 0xaf, 0xfd, 0x8d, 0xc1, 0xed, 0x70, 0xe6, 0x00, 0xac, 0x2c,
+	0x71, 0xe0, 0xb5, 0x22, 0x0c, 0x6f, 0xfc, 0xf2, 0xb5, 0xea, 0x00, 0x20,
+	0xe2, 0x0c, 0xea, 0x00, 0x00, 0xe4, 0x00, 0x20, 0x2c, 0x70, 0x58, 0x0a,
+	0x20, 0x90, 0xb9, 0x8a, 0x01, 0x31, 0x41, 0xc7, 0xca, 0x18, 0x00, 0x13,
+	0x14, 0x92, 0x00, 0x11, 0xbe, 0x0e, 0x00, 0x31, 0x0c, 0x70, 0x76, 0x6a,
+	0x00, 0x11, 0x0c, 0x02, 0x0c, 0xf0, 0x23, 0x00, 0xb6, 0x09, 0xc0, 0xe0,
+	0xb0, 0xe1, 0xb5, 0x0e, 0x0b, 0xef, 0xfe, 0x0a, 0xc0, 0x05, 0xc0, 0x2e,
+	0x08, 0xaf, 0xfc, 0x2c, 0x70, 0x0b, 0xc1, 0x55, 0x20, 0x00, 0x0d, 0x4c,
+	0x71, 0x25, 0x78, 0x0a, 0xc1, 0x96, 0x0f, 0xaf, 0xff, 0x6c, 0x70, 0x6e,
+	0x0b, 0x0f, 0xfe, 0x02, 0x0c, 0xcf, 0xfe, 0xc6, 0xc7, 0xe8, 0x0c, 0x00,
+	0x0c, 0x01, 0x3f, 0xe0, 0x7e, 0x00, 0x01, 0x00, 0xff, 0x7e, 0x50, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const struct ddr_phy_fw_image lp4_pmu_train_1d_imem = DDR_PHY_FW_IMAGE(lp4_pmu_train_1d_imem_lz4, 16384);
+
+static const u8 lp4_pmu_train_2d_imem_lz4[] = {
+	0xa9, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x9a,
+	0x0e, 0x00, 0x00, 0x6f, 0x04, 0x02, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00,
+	0x37, 0x84, 0x69, 0x20, 0x40, 0x00, 0x4a, 0x26, 0x00, 0x70, 0x04, 0x00,
+	0x1f, 0x00, 0x01, 0x00, 0x0c, 0xf0, 0x19, 0x54, 0x70, 0xe0, 0x7c, 0x00,
+	0x43, 0x01, 0x11, 0x8c, 0x04, 0x42, 0x22, 0x42, 0x80, 0x01, 0x1b, 0x12,
+	0x03, 0xfb, 0xf5, 0xe0, 0x7e, 0xe0, 0x78, 0xfc, 0x1c, 0xc8, 0xb3, 0xfc,
+	0x1c, 0x88, 0xb3, 0xe0, 0x7f, 0xfc, 0x1c, 0x48, 0xb3, 0xe0, 0x78, 0x14,
+	0x00, 0xd1, 0x8d, 0x74, 0x0c, 0xdd, 0x0c, 0xf0, 0xe0, 0x78, 0x8d, 0x74,
+	0x08, 0xdd, 0x09, 0x08, 0x00, 0x31, 0xad, 0x74, 0x06, 0x08, 0x00, 0xe0,
+	0x06, 0xf0, 0x02, 0xc7, 0x01, 0xc6, 0xb0, 0x24, 0x4d, 0x33, 0xb0, 0x24,
+	0x1f, 0x33, 0x2c, 0x00, 0xf0, 0x1d, 0xe1, 0xc5, 0xe1, 0xc6, 0xe1, 0xc7,
+	0x07, 0x21, 0xcb, 0x00, 0x2f, 0x26, 0x40, 0xf0, 0x4d, 0x70, 0x10, 0x00,
+	0x26, 0x00, 0x2f, 0x23, 0xc4, 0x12, 0x0e, 0x20, 0x80, 0x82, 0x03, 0x22,
+	0x41, 0x10, 0x19, 0x0b, 0xde, 0x07, 0x0e, 0x22, 0x82, 0x82, 0x03, 0x22,
+	0xc3, 0x10, 0x44, 0x00, 0x02, 0x30, 0x00, 0xf4, 0x6d, 0x6d, 0x70, 0x0a,
+	0x25, 0x80, 0x90, 0xcc, 0x23, 0x21, 0x80, 0x60, 0xf2, 0x34, 0x70, 0x0c,
+	0xf2, 0x3c, 0x00, 0x2b, 0x00, 0x40, 0xdc, 0x2f, 0x20, 0x00, 0x80, 0x2f,
+	0x21, 0x4b, 0x80, 0xf8, 0x07, 0xe3, 0xff, 0x61, 0xbc, 0x14, 0xf0, 0x20,
+	0xdc, 0x0a, 0x21, 0x00, 0x80, 0xca, 0x22, 0x21, 0x00, 0xca, 0x23, 0x21,
+	0x00, 0x22, 0xf2, 0x14, 0x00, 0x24, 0x00, 0x0c, 0x70, 0x2f, 0x21, 0x40,
+	0x80, 0x61, 0xbc, 0xfe, 0x07, 0xe3, 0xff, 0xc0, 0x21, 0x43, 0x80, 0x0a,
+	0x24, 0x00, 0x73, 0x0a, 0x26, 0xc0, 0x90, 0x4c, 0x70, 0x46, 0x00, 0x22,
+	0x00, 0x6c, 0x70, 0xa8, 0x20, 0x80, 0x03, 0x00, 0x20, 0x00, 0x80, 0x01,
+	0x21, 0x41, 0x80, 0x01, 0x22, 0x82, 0x80, 0xcc, 0x25, 0x86, 0x90, 0xc0,
+	0x20, 0x6e, 0x00, 0xc2, 0x22, 0x4e, 0x03, 0x75, 0x70, 0x2f, 0xf2, 0x45,
+	0xf6, 0x8e, 0x00, 0x80, 0x2f, 0x23, 0xc0, 0x92, 0x4e, 0x00, 0x03, 0x00,
+	0xaa, 0x00, 0x40, 0x47, 0x00, 0x20, 0x00, 0xae, 0x00, 0x48, 0xa8, 0x20,
+	0x80, 0x05, 0x3e, 0x00, 0xf0, 0x23, 0x01, 0x23, 0xc3, 0x00, 0x02, 0x22,
+	0x42, 0x83, 0x03, 0x23, 0x83, 0x83, 0x46, 0xf7, 0x00, 0x22, 0x42, 0x83,
+	0x01, 0x23, 0x83, 0x83, 0xc0, 0x20, 0x66, 0x00, 0x75, 0x70, 0x12, 0x00,
+	0x01, 0x00, 0xda, 0xf1, 0x41, 0x42, 0x41, 0x43, 0x09, 0x6a, 0x2f, 0x21,
+	0x02, 0x00, 0xc1, 0xc7, 0xc1, 0xc6, 0xc1, 0xc5, 0x14, 0x01, 0x40, 0x44,
+	0x22, 0xfc, 0x8f, 0x98, 0x01, 0x43, 0xe8, 0x20, 0xa2, 0x01, 0xd4, 0x00,
+	0x10, 0x00, 0x18, 0x00, 0xf0, 0x25, 0x2c, 0x70, 0x4c, 0x70, 0x6c, 0x70,
+	0x4d, 0x70, 0x6d, 0x70, 0x8d, 0x70, 0xad, 0x70, 0xcd, 0x70, 0xed, 0x70,
+	0x6a, 0x20, 0x80, 0x02, 0x8d, 0xb8, 0x29, 0x20, 0x00, 0x80, 0xdb, 0x44,
+	0x00, 0x80, 0x00, 0x40, 0xdb, 0x42, 0x00, 0x80, 0x00, 0x04, 0x6f, 0x70,
+	0xe0, 0x78, 0x22, 0x20, 0x80, 0x0f, 0x00, 0x00, 0x48, 0x25, 0xe8, 0x01,
+	0xf0, 0x5d, 0xe0, 0x78, 0xfe, 0xf1, 0xe1, 0xc3, 0xe1, 0xc2, 0xe1, 0xc1,
+	0xe1, 0xc0, 0xf1, 0xc0, 0xe1, 0xc5, 0xa1, 0xc1, 0x06, 0xe8, 0x87, 0x74,
+	0x14, 0xdc, 0x6b, 0x06, 0xcf, 0xff, 0x25, 0xda, 0x9f, 0xba, 0x60, 0x8a,
+	0x33, 0x12, 0x80, 0x00, 0x65, 0x78, 0xea, 0x1a, 0x02, 0x80, 0xed, 0x12,
+	0x80, 0x80, 0x8c, 0x20, 0xc3, 0x8f, 0x0d, 0xf2, 0x85, 0xc0, 0x40, 0xc0,
+	0x20, 0x40, 0x9a, 0x0b, 0x60, 0x02, 0x85, 0xc1, 0xc3, 0x41, 0x02, 0x04,
+	0x00, 0x00, 0x6e, 0x0f, 0x20, 0x00, 0xff, 0xd8, 0xad, 0x70, 0x3e, 0x0a,
+	0x20, 0x02, 0x10, 0x1a, 0x03, 0x30, 0xde, 0x0a, 0x60, 0x02, 0xff, 0xd8,
+	0xab, 0x25, 0xc4, 0x10, 0xff, 0x7f, 0xff, 0xf1, 0xe0, 0x78, 0xe6, 0xb8,
+	0x1d, 0x78, 0x02, 0x00, 0xf2, 0x3f, 0xc2, 0xb8, 0x2c, 0x74, 0x03, 0xf4,
+	0x14, 0x79, 0x06, 0xf0, 0x15, 0x79, 0x09, 0x09, 0x54, 0x03, 0x2c, 0x76,
+	0x15, 0x79, 0xe0, 0x7f, 0x01, 0x69, 0xc3, 0x42, 0x00, 0x80, 0x65, 0x06,
+	0x20, 0x8a, 0x5f, 0x21, 0x81, 0x0c, 0x38, 0x60, 0x21, 0x8a, 0x5f, 0x21,
+	0x41, 0x06, 0x19, 0x61, 0x03, 0x89, 0xe6, 0xb8, 0x02, 0x89, 0x00, 0x16,
+	0x81, 0x70, 0x00, 0x80, 0x1c, 0x00, 0xc2, 0xb8, 0x09, 0xf4, 0x34, 0x70,
+	0xc3, 0x41, 0x00, 0x80, 0x40, 0x05, 0x09, 0xf2, 0x08, 0xe1, 0x07, 0xf0,
+	0x0e, 0x00, 0xf0, 0x03, 0x30, 0x05, 0x03, 0xf2, 0x08, 0xe1, 0x19, 0x61,
+	0xe0, 0x7f, 0x00, 0x89, 0xe2, 0xc0, 0x53, 0x20, 0x4c, 0x01, 0x6a, 0x00,
+	0x04, 0x04, 0x00, 0x40, 0x44, 0x20, 0x4d, 0x00, 0x1e, 0x01, 0xf0, 0x97,
+	0x0b, 0xf0, 0x70, 0x10, 0x83, 0x00, 0x19, 0x0d, 0xe0, 0x10, 0x2f, 0x79,
+	0x6e, 0x10, 0x80, 0x00, 0x44, 0x71, 0x19, 0x61, 0x4f, 0x78, 0xed, 0x08,
+	0xb4, 0x80, 0x43, 0x70, 0x03, 0xf0, 0x99, 0x61, 0x2f, 0x78, 0xc2, 0xc4,
+	0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xb6, 0xc1, 0x48, 0x45,
+	0x53, 0xc1, 0x00, 0x42, 0x0c, 0x75, 0xc3, 0x41, 0x86, 0x01, 0x01, 0x00,
+	0x92, 0x0e, 0x20, 0x00, 0x54, 0xc3, 0x6f, 0x70, 0x41, 0xf0, 0x61, 0x42,
+	0x15, 0xf0, 0x14, 0xc0, 0x19, 0x08, 0xb0, 0x00, 0x8e, 0xc0, 0x14, 0xc0,
+	0x7f, 0x08, 0x71, 0x00, 0x8e, 0xc3, 0x48, 0x65, 0x34, 0x7b, 0x00, 0xb3,
+	0x06, 0xf0, 0xf4, 0x25, 0x83, 0x10, 0x34, 0x78, 0x60, 0xb0, 0x13, 0xc0,
+	0x24, 0x71, 0x1a, 0x62, 0xdd, 0x09, 0x94, 0x82, 0x83, 0x41, 0x1c, 0x91,
+	0x46, 0x14, 0x03, 0x31, 0x5f, 0x91, 0x55, 0xc0, 0x48, 0x14, 0x01, 0x31,
+	0x4a, 0x14, 0x00, 0x31, 0x3a, 0x14, 0x1f, 0x31, 0x3c, 0x14, 0x1e, 0x31,
+	0x40, 0x14, 0x0f, 0x31, 0x42, 0x14, 0x0e, 0x31, 0x44, 0x14, 0x0c, 0x31,
+	0x46, 0xc3, 0x15, 0xc3, 0x48, 0xc0, 0x47, 0xc1, 0x42, 0xc2, 0x72, 0x00,
+	0xf0, 0x7c, 0x87, 0x01, 0x0b, 0x00, 0x45, 0xc4, 0x44, 0xc6, 0x43, 0xc7,
+	0x04, 0x1c, 0x80, 0x37, 0x00, 0x1c, 0xc0, 0x37, 0x12, 0x0e, 0x20, 0x00,
+	0x61, 0x42, 0x67, 0x71, 0x13, 0xc0, 0x2f, 0x23, 0xc8, 0x16, 0x7d, 0x0b,
+	0x24, 0x90, 0x2c, 0x70, 0xb6, 0xc0, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6,
+	0xe0, 0x78, 0x0c, 0x70, 0x00, 0x1e, 0x04, 0x70, 0x04, 0x90, 0x02, 0x01,
+	0xe0, 0x7e, 0xe4, 0xc2, 0x08, 0x43, 0xad, 0x70, 0xcb, 0x46, 0x08, 0x90,
+	0xe4, 0x01, 0x8c, 0x21, 0xc3, 0x8f, 0xa0, 0xb6, 0xa1, 0xb6, 0xa2, 0xb6,
+	0x24, 0xf2, 0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x04, 0x00, 0x1a, 0x20,
+	0x83, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x05, 0x23, 0x80, 0x0f, 0x04, 0x90,
+	0x40, 0x00, 0x20, 0xb0, 0xc3, 0x40, 0x00, 0x80, 0x69, 0x06, 0x81, 0x88,
+	0x00, 0x88, 0x0c, 0xf0, 0x1a, 0x20, 0x82, 0x0f, 0x00, 0x00, 0x00, 0x20,
+	0x04, 0x71, 0x65, 0x7a, 0x05, 0x22, 0x82, 0x0f, 0x02, 0x22, 0x00, 0xf0,
+	0x0a, 0xb2, 0xeb, 0x0c, 0x05, 0x90, 0x8e, 0x08, 0xc0, 0x01, 0x8a, 0x20,
+	0x1a, 0x02, 0xc3, 0x41, 0x0e, 0x90, 0x2a, 0x00, 0xfc, 0x1e, 0xc4, 0x92,
+	0x00, 0xb1, 0x3a, 0x00, 0xf0, 0x49, 0xba, 0x04, 0xa0, 0xa8, 0xc3, 0x40,
+	0x00, 0x00, 0xac, 0x0f, 0x01, 0xb1, 0x0c, 0x70, 0xc4, 0xc6, 0x4c, 0x70,
+	0x10, 0x72, 0xe0, 0x20, 0xca, 0x07, 0x00, 0x16, 0x01, 0x71, 0x08, 0x90,
+	0xd6, 0x01, 0xf3, 0x09, 0x3e, 0x80, 0x44, 0x71, 0xe0, 0x7e, 0xe2, 0xc2,
+	0x28, 0x43, 0xc6, 0x0e, 0x60, 0x00, 0x0a, 0x26, 0x00, 0x30, 0xcb, 0x45,
+	0x04, 0x90, 0xf2, 0x00, 0x00, 0x1d, 0x45, 0x10, 0x00, 0x1d, 0x05, 0x10,
+	0x00, 0x1e, 0x84, 0x77, 0x08, 0x90, 0xe2, 0x01, 0x36, 0x0f, 0x20, 0x01,
+	0x0c, 0x76, 0x17, 0x0b, 0x30, 0x10, 0x10, 0x1d, 0x45, 0x10, 0x54, 0x00,
+	0xf2, 0x19, 0xa8, 0x61, 0xb6, 0x0f, 0xcf, 0xff, 0x10, 0x1d, 0x05, 0x10,
+	0xc2, 0xc6, 0xe2, 0xc2, 0xad, 0x70, 0x07, 0xf0, 0x11, 0xca, 0x04, 0x77,
+	0xba, 0x0f, 0xef, 0xff, 0x10, 0x78, 0xa5, 0x71, 0x13, 0xc8, 0xf3, 0x0d,
+	0x24, 0x90, 0x2c, 0x71, 0xc2, 0xc6, 0xb4, 0x01, 0xf0, 0x1b, 0xa6, 0xc1,
+	0x0a, 0x26, 0x80, 0x30, 0x0b, 0xc2, 0x45, 0xc3, 0x7f, 0xdb, 0x40, 0xc0,
+	0x44, 0x7b, 0x4b, 0xd8, 0x38, 0x23, 0x0f, 0x00, 0x9a, 0x27, 0x02, 0x10,
+	0xe6, 0xba, 0x8a, 0x20, 0x3e, 0x00, 0x4f, 0x23, 0x4c, 0x00, 0xca, 0x27,
+	0x01, 0x10, 0xcf, 0xe4, 0x06, 0x00, 0x20, 0xd1, 0xe3, 0x06, 0x00, 0xe0,
+	0x00, 0xc0, 0x00, 0x16, 0x83, 0x70, 0x00, 0x80, 0xba, 0x04, 0x00, 0x14,
+	0x1f, 0x30, 0xdc, 0x02, 0xf1, 0xa2, 0x0e, 0xc0, 0x42, 0x26, 0x4b, 0x30,
+	0xca, 0x27, 0xc1, 0x30, 0x43, 0xc0, 0x0d, 0xc0, 0x44, 0xc0, 0x0c, 0xc0,
+	0x51, 0x0b, 0xb5, 0x16, 0x42, 0xc0, 0x50, 0xdb, 0x41, 0xc3, 0x20, 0xdb,
+	0x10, 0xd8, 0x30, 0xde, 0x60, 0xdd, 0x78, 0x43, 0x8d, 0x70, 0x25, 0x20,
+	0xc0, 0x02, 0x1a, 0xf0, 0x1a, 0xf0, 0x18, 0xf0, 0x18, 0xf0, 0x5c, 0xf0,
+	0x19, 0xf0, 0x14, 0xf0, 0x16, 0xf0, 0x45, 0xf0, 0x48, 0xf0, 0x10, 0xf0,
+	0x10, 0xf0, 0x47, 0xf0, 0x3b, 0xf0, 0x0e, 0xf0, 0x0c, 0xf0, 0x0a, 0xf0,
+	0x0a, 0xf0, 0x08, 0xf0, 0x08, 0xf0, 0x06, 0xf0, 0x06, 0xf0, 0x3f, 0xf0,
+	0x34, 0xf0, 0x05, 0xf0, 0xa8, 0xf0, 0x6c, 0x70, 0x03, 0xf0, 0x10, 0xdb,
+	0x4c, 0x26, 0x40, 0xb6, 0x4a, 0x01, 0x2d, 0x00, 0x60, 0x40, 0x6c, 0x72,
+	0x8d, 0x74, 0x41, 0xc0, 0x08, 0x46, 0x18, 0x43, 0x08, 0x45, 0x08, 0x47,
+	0x25, 0x20, 0x80, 0x07, 0x36, 0xf0, 0x2c, 0xf0, 0x2b, 0xf0, 0x17, 0xf0,
+	0x17, 0xf0, 0x93, 0xf0, 0x99, 0xf0, 0x93, 0xf0, 0x15, 0xf0, 0x19, 0xf0,
+	0x1c, 0xf0, 0x91, 0xf0, 0x0f, 0xf0, 0x1b, 0xf0, 0x0f, 0xf0, 0x0d, 0xf0,
+	0x89, 0xf0, 0x87, 0xf0, 0x87, 0xf0, 0x85, 0xf0, 0x85, 0xf0, 0x18, 0xf0,
+	0x17, 0xf0, 0x13, 0x60, 0x00, 0xf1, 0x56, 0x07, 0xdb, 0x12, 0xf0, 0x01,
+	0xc7, 0x8d, 0x75, 0x18, 0xf0, 0x8d, 0x75, 0xa9, 0x47, 0x14, 0xf0, 0x8d,
+	0x75, 0xc9, 0x47, 0x12, 0xf0, 0x8d, 0x71, 0x6b, 0x47, 0x0e, 0xf0, 0x8d,
+	0x76, 0x0b, 0xf0, 0x8d, 0x70, 0x0a, 0xf0, 0x6c, 0x73, 0x0d, 0x0e, 0xd1,
+	0x30, 0x02, 0xc4, 0x9a, 0x24, 0x04, 0x10, 0x85, 0x7a, 0x68, 0x44, 0x08,
+	0x47, 0x8a, 0x23, 0xfd, 0x0f, 0x24, 0x7b, 0x3d, 0x78, 0x44, 0x20, 0x0b,
+	0x0c, 0xb0, 0xe3, 0x58, 0xdb, 0xcf, 0x23, 0xe1, 0x11, 0x24, 0x7b, 0x84,
+	0x20, 0x01, 0x00, 0x05, 0x23, 0xc3, 0x02, 0x85, 0x78, 0x05, 0x7b, 0x3d,
+	0x78, 0x9a, 0x23, 0x04, 0x00, 0x1d, 0x78, 0x05, 0xc4, 0x1d, 0x78, 0x04,
+	0x36, 0x04, 0xe0, 0x00, 0x20, 0x05, 0x7c, 0x65, 0x7c, 0x2f, 0x23, 0xc0,
+	0x17, 0xc3, 0x43, 0x08, 0x90, 0x48, 0x02, 0xf0, 0x00, 0xc0, 0x10, 0x80,
+	0xb0, 0x20, 0x40, 0x9a, 0x20, 0x04, 0x00, 0x54, 0x71, 0x04, 0x21, 0x81,
+	0x40, 0x02, 0x40, 0xff, 0x04, 0x20, 0x8c, 0x08, 0x00, 0x42, 0x0f, 0x02,
+	0xc0, 0x1a, 0x36, 0x00, 0xd0, 0x10, 0x05, 0x7c, 0xe1, 0x40, 0xcf, 0x20,
+	0xa1, 0x01, 0x4c, 0x26, 0x80, 0xb1, 0x7a, 0x01, 0xf1, 0x04, 0x04, 0xc0,
+	0xc3, 0xb8, 0x05, 0x7f, 0xef, 0x78, 0x05, 0x7c, 0x54, 0x23, 0x00, 0x18,
+	0x65, 0x78, 0x80, 0xb0, 0x55, 0x08, 0x00, 0xf1, 0x04, 0x40, 0xb0, 0x03,
+	0xc0, 0x05, 0x79, 0x55, 0x23, 0x00, 0x1c, 0x05, 0x7b, 0x20, 0xb3, 0x00,
+	0xc0, 0x40, 0x27, 0x41, 0x98, 0x01, 0x51, 0x05, 0xf4, 0x00, 0x1e, 0x42,
+	0xaa, 0x01, 0x33, 0x2f, 0x78, 0xa6, 0xfa, 0x02, 0xf0, 0x25, 0x8d, 0x73,
+	0x10, 0xdf, 0x9e, 0xf1, 0x8d, 0x70, 0x9b, 0xf1, 0x8d, 0x71, 0x99, 0xf1,
+	0x20, 0xdc, 0x97, 0xf1, 0x8d, 0x75, 0x95, 0xf1, 0xe0, 0x78, 0xf1, 0xc0,
+	0xa4, 0xc1, 0x08, 0xc4, 0x43, 0xc4, 0x07, 0xc4, 0x42, 0xc4, 0x06, 0xc4,
+	0x41, 0xc4, 0x05, 0xc4, 0xe2, 0x0d, 0xef, 0xff, 0x40, 0xc4, 0xa4, 0xc0,
+	0xd1, 0xc0, 0x2c, 0x05, 0x00, 0x42, 0x04, 0x40, 0xba, 0x04, 0x20, 0x89,
+	0xf0, 0x01, 0x40, 0xca, 0x20, 0x41, 0x00, 0x3e, 0x03, 0x4f, 0x08, 0x90,
+	0xe8, 0x01, 0x1c, 0x00, 0x07, 0x11, 0xe6, 0x1c, 0x00, 0xf0, 0x1d, 0x4a,
+	0x26, 0x00, 0x30, 0x10, 0xf0, 0x5a, 0x26, 0x83, 0x3c, 0x7c, 0x60, 0x5a,
+	0x23, 0x43, 0x16, 0x65, 0x71, 0x9b, 0x63, 0x3b, 0x63, 0x80, 0x8b, 0x44,
+	0x7c, 0x80, 0xab, 0xeb, 0x0b, 0x94, 0x90, 0x40, 0x26, 0x5e, 0x30, 0xf9,
+	0x0e, 0xb4, 0xb0, 0x6d, 0x70, 0xe0, 0x7e, 0x84, 0x00, 0xf0, 0x0a, 0x0c,
+	0x70, 0x76, 0x0c, 0xef, 0xff, 0xff, 0xd9, 0x0c, 0x70, 0x43, 0xc0, 0x42,
+	0xc0, 0x41, 0xc0, 0x40, 0xc0, 0xff, 0xd8, 0x88, 0xd9, 0x4c, 0x75, 0x52,
+	0x8e, 0x00, 0x92, 0xdb, 0x0c, 0x70, 0xee, 0x0c, 0xef, 0xff, 0x2c, 0x71,
+	0x96, 0x00, 0x02, 0xc4, 0x02, 0xf0, 0x17, 0xa2, 0xc1, 0x28, 0x45, 0x00,
+	0x43, 0xed, 0x70, 0x4c, 0x70, 0x06, 0xf0, 0x20, 0x88, 0x01, 0x88, 0x15,
+	0x09, 0x04, 0x00, 0x44, 0x71, 0x4f, 0x78, 0xf7, 0x08, 0xf4, 0x87, 0x14,
+	0x23, 0x00, 0x00, 0x4c, 0x70, 0x1e, 0xd9, 0x09, 0xf0, 0x0a, 0x00, 0xf0,
+	0x0b, 0x80, 0x88, 0x01, 0x88, 0x0f, 0x0c, 0x04, 0x10, 0x24, 0x77, 0x2f,
+	0x20, 0x47, 0x80, 0xf8, 0xf5, 0x02, 0xf0, 0x28, 0x47, 0xef, 0x78, 0x40,
+	0xc0, 0x4f, 0x78, 0xa6, 0x00, 0xf2, 0x27, 0xff, 0xde, 0x18, 0x47, 0x18,
+	0x43, 0x6d, 0x70, 0x13, 0xf0, 0x21, 0x88, 0x80, 0x88, 0x14, 0xca, 0x0a,
+	0xe8, 0x66, 0xca, 0x10, 0x74, 0x67, 0xca, 0x0d, 0x09, 0x21, 0x00, 0xc0,
+	0x23, 0x61, 0x10, 0x65, 0x71, 0x08, 0x21, 0x9e, 0x07, 0x09, 0x24, 0x8e,
+	0x13, 0xe7, 0x71, 0x00, 0xc0, 0xdd, 0x08, 0xe5, 0x87, 0x14, 0x23, 0xc0,
+	0x07, 0x24, 0x04, 0xf0, 0x03, 0x0e, 0x00, 0x41, 0xc0, 0x3f, 0x13, 0x80,
+	0x00, 0x0f, 0xe0, 0x00, 0xad, 0x0f, 0x78, 0xc6, 0x08, 0x60, 0x00, 0x70,
+	0x00, 0xd3, 0x40, 0x23, 0xc1, 0x30, 0x22, 0xad, 0x01, 0xad, 0x03, 0x6a,
+	0x0f, 0x78, 0xb2, 0x14, 0x00, 0xd3, 0x00, 0xc1, 0x63, 0xb9, 0x24, 0xad,
+	0x03, 0xad, 0x0b, 0x6f, 0x0f, 0x78, 0x9e, 0x14, 0x00, 0xf0, 0x61, 0x05,
+	0xad, 0x15, 0x12, 0x03, 0x36, 0x16, 0xc8, 0x2f, 0x26, 0xc7, 0xf2, 0x14,
+	0x1a, 0xd8, 0x30, 0x70, 0x50, 0x0b, 0xf2, 0x01, 0xc1, 0x13, 0x09, 0x5e,
+	0x01, 0x0c, 0x70, 0x0f, 0xdb, 0x18, 0x1a, 0x19, 0x30, 0x14, 0x1a, 0xd9,
+	0x33, 0x14, 0x12, 0x81, 0x30, 0x2c, 0xe9, 0x15, 0x12, 0x82, 0x30, 0x2c,
+	0x71, 0x64, 0xdd, 0x44, 0x22, 0xcc, 0x07, 0x20, 0x42, 0x02, 0x26, 0x81,
+	0x33, 0x06, 0xec, 0x61, 0xbc, 0x01, 0x0c, 0x31, 0x10, 0x5b, 0x7a, 0x04,
+	0x29, 0x81, 0x00, 0x4e, 0x23, 0x42, 0x30, 0x24, 0x71, 0x2f, 0x7c, 0x00,
+	0xc1, 0x59, 0x61, 0x2f, 0x7a, 0x13, 0x0a, 0x25, 0x03, 0x64, 0xd9, 0x81,
+	0x41, 0x9f, 0x21, 0x01, 0x09, 0x05, 0x29, 0x81, 0x00, 0x2c, 0x7b, 0x11,
+	0x0c, 0xa5, 0x10, 0x64, 0x00, 0xd3, 0x9f, 0x22, 0x01, 0x09, 0x05, 0x2a,
+	0x0d, 0x03, 0xac, 0x78, 0x70, 0x50, 0xa2, 0x1c, 0x02, 0xc0, 0x4c, 0x70,
+	0xc3, 0x41, 0x03, 0x90, 0x04, 0xe0, 0x40, 0xb1, 0x5d, 0xb1, 0xe0, 0x01,
+	0xf3, 0x1b, 0x09, 0x90, 0xe0, 0xe1, 0xc3, 0x40, 0x03, 0x90, 0x64, 0xff,
+	0x40, 0xb0, 0xe0, 0x7f, 0x04, 0x18, 0x45, 0x00, 0xe0, 0x78, 0x17, 0x09,
+	0xf0, 0x03, 0x8a, 0x22, 0xc7, 0x0f, 0x4c, 0x71, 0xc4, 0xb9, 0x05, 0xe9,
+	0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x5b, 0x7a, 0xb2, 0x02, 0xf0, 0x0a,
+	0x20, 0x05, 0x20, 0x81, 0x0f, 0x02, 0x90, 0x6a, 0x01, 0x4f, 0x22, 0x40,
+	0x02, 0x00, 0x19, 0x05, 0x00, 0x40, 0xb1, 0x00, 0xb1, 0x40, 0xb1, 0xe0,
+	0x7f, 0x0c, 0x00, 0x20, 0xe0, 0x78, 0xc8, 0x04, 0xa4, 0x6c, 0x70, 0x0d,
+	0xf0, 0x0a, 0x23, 0x80, 0x07, 0xc4, 0xbc, 0xb8, 0x00, 0xf0, 0x01, 0x7d,
+	0x7b, 0x24, 0x71, 0xc0, 0xbb, 0x1b, 0x63, 0x2f, 0x7c, 0xe9, 0x0a, 0x25,
+	0x83, 0x6f, 0x78, 0x08, 0x02, 0xf2, 0x11, 0x00, 0x42, 0xf6, 0x0b, 0x60,
+	0x00, 0x20, 0x40, 0x5b, 0x79, 0x44, 0x21, 0x81, 0x01, 0xc4, 0xb9, 0x06,
+	0xe9, 0x61, 0xb9, 0x01, 0x09, 0x31, 0x00, 0x1d, 0x78, 0xd1, 0xc0, 0xe0,
+	0x7f, 0xc1, 0xb8, 0xb0, 0x02, 0x4c, 0x0c, 0x70, 0x4a, 0x0a, 0x2c, 0x02,
+	0xe6, 0x90, 0xd9, 0x4c, 0x75, 0x26, 0x0b, 0xef, 0xff, 0x40, 0xdb, 0x0c,
+	0x70, 0xc2, 0x0a, 0x2c, 0x02, 0x06, 0xb0, 0x07, 0x82, 0xa1, 0xc1, 0x20,
+	0x42, 0x84, 0xc1, 0x40, 0xc1, 0x22, 0x07, 0xf0, 0x01, 0x12, 0x00, 0x0f,
+	0x08, 0x64, 0x00, 0x40, 0x40, 0x02, 0x0c, 0x20, 0x02, 0x00, 0xc1, 0x87,
+	0x74, 0x60, 0x00, 0xf4, 0x07, 0xa4, 0xc0, 0xe0, 0x78, 0x1d, 0x79, 0x6c,
+	0x21, 0x02, 0x01, 0x6c, 0x20, 0x41, 0x01, 0x22, 0x78, 0x1a, 0x62, 0xe0,
+	0x7f, 0x4e, 0x78, 0xe8, 0x06, 0xf0, 0x25, 0xa4, 0xc1, 0xcb, 0x45, 0x00,
+	0x80, 0x74, 0x06, 0xe4, 0x6d, 0x3e, 0x08, 0xa0, 0x00, 0xe1, 0x40, 0xcd,
+	0x70, 0xc9, 0x43, 0x0e, 0xf0, 0x5a, 0x23, 0x41, 0x06, 0x5a, 0x23, 0x80,
+	0x1c, 0x38, 0x60, 0xb2, 0x0a, 0xa0, 0x01, 0xf8, 0x60, 0x64, 0x71, 0xf1,
+	0x0b, 0x94, 0x80, 0x65, 0x71, 0xfb, 0x0b, 0xb4, 0x90, 0x6c, 0x70, 0xf6,
+	0x05, 0xf0, 0x3b, 0x65, 0x06, 0xce, 0xa8, 0xc1, 0xa8, 0xc0, 0xa8, 0xe2,
+	0x0b, 0x60, 0x00, 0xe0, 0xa5, 0xe6, 0x0b, 0x60, 0x00, 0x08, 0x45, 0x00,
+	0x41, 0x72, 0x0a, 0xe0, 0x01, 0xa1, 0x40, 0x6f, 0x23, 0xc3, 0x30, 0x18,
+	0x13, 0x80, 0x30, 0x09, 0xe8, 0xc3, 0x41, 0x45, 0x01, 0x00, 0x00, 0x56,
+	0x0f, 0xef, 0xff, 0x0a, 0xd8, 0x1f, 0xf0, 0x00, 0x13, 0x80, 0x30, 0xcb,
+	0x46, 0x1e, 0x00, 0x80, 0x84, 0xc3, 0x41, 0xf5, 0x05, 0x00, 0xe1, 0x44,
+	0x20, 0x8d, 0x80, 0xc1, 0x40, 0x80, 0x03, 0xf1, 0x0e, 0x92, 0x09, 0x20,
+	0x01, 0x2c, 0x70, 0xb5, 0x70, 0xc3, 0x40, 0x9a, 0x3b, 0x00, 0xca, 0xca,
+	0x26, 0x01, 0x10, 0xc1, 0x40, 0x00, 0x1e, 0xc5, 0x70, 0x04, 0x90, 0xc0,
+	0x00, 0x76, 0x1c, 0x00, 0x02, 0x9a, 0x02, 0x91, 0x0d, 0x00, 0x0f, 0x08,
+	0x1e, 0x00, 0x00, 0x1e, 0x45, 0x1a, 0x00, 0xc0, 0xcb, 0x46, 0x00, 0x80,
+	0x7c, 0x05, 0x00, 0x8e, 0xb7, 0x08, 0x10, 0x00, 0x5c, 0x00, 0x80, 0xaf,
+	0x08, 0xdf, 0x00, 0x82, 0x0c, 0x00, 0x00, 0x3a, 0x06, 0x40, 0x00, 0x0a,
+	0xfa, 0x08, 0x4e, 0x01, 0xf0, 0x1f, 0xad, 0x70, 0xff, 0xd8, 0x2c, 0x70,
+	0x4c, 0x75, 0x6c, 0x73, 0x43, 0xc5, 0x42, 0xc5, 0x41, 0xc5, 0xda, 0x09,
+	0xef, 0xff, 0x40, 0xc5, 0x01, 0x8e, 0x25, 0x08, 0xb4, 0x00, 0x2c, 0x70,
+	0x04, 0x71, 0x1d, 0x78, 0x62, 0xb8, 0x0f, 0x78, 0x43, 0xc0, 0xff, 0xd8,
+	0x4c, 0x75, 0x6c, 0x72, 0x22, 0x00, 0x13, 0xb6, 0x22, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x3a, 0x00, 0x20, 0x0c, 0xdb, 0x16, 0x00, 0x13, 0xa2, 0x16,
+	0x00, 0x40, 0x08, 0xd9, 0x4c, 0x75, 0x1a, 0x00, 0x02, 0x2c, 0x00, 0x11,
+	0x8a, 0x16, 0x00, 0x80, 0xd2, 0x0b, 0xef, 0xff, 0xff, 0xd8, 0x01, 0x8e,
+	0x2e, 0x00, 0x06, 0x1c, 0x00, 0x11, 0x6e, 0x1c, 0x00, 0x11, 0x9a, 0x1c,
+	0x00, 0x80, 0xde, 0x0b, 0xc0, 0x01, 0x96, 0xd8, 0x02, 0x09, 0xc2, 0x01,
+	0xf0, 0x03, 0x1a, 0x0d, 0x00, 0x00, 0x09, 0xf0, 0xe6, 0x0b, 0xcf, 0xff,
+	0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42, 0x96, 0x08, 0xfc, 0x00, 0x00, 0xc0,
+	0x00, 0xf0, 0x1f, 0x3f, 0x08, 0x1e, 0x00, 0xc3, 0x43, 0x04, 0x90, 0x14,
+	0x00, 0x20, 0x93, 0x01, 0xca, 0x0d, 0x08, 0xb0, 0x01, 0x4f, 0x21, 0x82,
+	0x00, 0x0b, 0x08, 0xd1, 0x00, 0x85, 0x21, 0x08, 0x01, 0x20, 0x42, 0x40,
+	0xb3, 0x23, 0xd8, 0xc3, 0x42, 0x05, 0x90, 0x34, 0xe0, 0x00, 0xb2, 0x2c,
+	0x70, 0xcc, 0x02, 0xf1, 0x16, 0x34, 0xe0, 0x20, 0xb0, 0xb1, 0xb8, 0x20,
+	0xb0, 0x21, 0xb2, 0xff, 0xdd, 0xe1, 0x40, 0x2c, 0x70, 0x8a, 0x22, 0xff,
+	0x0d, 0x6c, 0x77, 0xc6, 0x08, 0xa0, 0x02, 0x40, 0xc5, 0x4c, 0x77, 0xe1,
+	0x40, 0x2c, 0x71, 0x40, 0x43, 0xb6, 0x0e, 0x00, 0x13, 0xa4, 0x16, 0x03,
+	0xf0, 0x03, 0xe0, 0x78, 0xe4, 0xc2, 0xad, 0x70, 0x9a, 0xbd, 0xff, 0xd8,
+	0xa1, 0x41, 0xcd, 0x70, 0xba, 0x0d, 0xef, 0xff, 0xac, 0x09, 0xa0, 0x8a,
+	0x08, 0xc0, 0x01, 0x4f, 0x25, 0x01, 0x14, 0xaa, 0x0d, 0xca, 0x00, 0x30,
+	0x26, 0x09, 0x20, 0xba, 0x09, 0x10, 0x26, 0xba, 0x09, 0x22, 0x00, 0xf0,
+	0x98, 0x04, 0x42, 0xa4, 0xc1, 0x43, 0xc0, 0x84, 0x01, 0xc0, 0x12, 0x00,
+	0x6b, 0x08, 0x75, 0x01, 0x6f, 0x70, 0x00, 0x16, 0x8f, 0x70, 0x38, 0x08,
+	0xf0, 0x00, 0x23, 0xf0, 0x03, 0xc0, 0x3b, 0x08, 0xae, 0x03, 0x2f, 0x25,
+	0xc7, 0x16, 0x9f, 0x25, 0x41, 0xb8, 0x07, 0xf0, 0x28, 0x80, 0x1a, 0x07,
+	0x02, 0xc2, 0xc1, 0x43, 0x09, 0x65, 0xb8, 0x60, 0x02, 0x88, 0x40, 0xc1,
+	0xc3, 0x41, 0x16, 0x00, 0x04, 0x00, 0x41, 0xc0, 0x4e, 0x0d, 0xef, 0xff,
+	0x0c, 0x74, 0x00, 0x25, 0x80, 0x1f, 0x00, 0x80, 0xdc, 0x06, 0x2e, 0x08,
+	0x00, 0x00, 0x67, 0x71, 0xc5, 0x71, 0xc3, 0x0e, 0x54, 0x92, 0xe5, 0x71,
+	0xef, 0x78, 0x42, 0xc0, 0x58, 0x02, 0xc6, 0x69, 0x06, 0x21, 0x88, 0x02,
+	0xc0, 0xed, 0x09, 0x25, 0x80, 0xcd, 0x70, 0xb4, 0x00, 0x02, 0x84, 0x00,
+	0xf0, 0xff, 0x4a, 0x82, 0x24, 0x04, 0x3b, 0xa1, 0x68, 0x6f, 0x71, 0xac,
+	0xf0, 0x62, 0x8d, 0xff, 0x15, 0x80, 0x94, 0x2d, 0x15, 0x9f, 0x10, 0x2f,
+	0x15, 0x9e, 0x10, 0xd8, 0x1c, 0x00, 0x30, 0x05, 0x8d, 0x31, 0x15, 0x8b,
+	0x10, 0x33, 0x15, 0x8f, 0x10, 0xdc, 0x1c, 0x00, 0x30, 0x07, 0x8d, 0x35,
+	0x15, 0x8e, 0x10, 0x37, 0x15, 0x8c, 0x10, 0xe0, 0x1c, 0x00, 0x30, 0x09,
+	0x8d, 0x39, 0x15, 0x82, 0x10, 0x3b, 0x15, 0x81, 0x10, 0xe4, 0x1c, 0x00,
+	0x30, 0x0b, 0x8d, 0xe8, 0x1c, 0x00, 0x30, 0x0d, 0x8d, 0xec, 0x1c, 0x00,
+	0x30, 0x0f, 0x8d, 0xf0, 0x1c, 0x00, 0x30, 0x11, 0x8d, 0xf4, 0x1c, 0x00,
+	0x30, 0x13, 0x8d, 0xf8, 0x1c, 0x00, 0x30, 0x15, 0x8d, 0xfc, 0x1c, 0x00,
+	0x30, 0x17, 0x8d, 0x40, 0x1c, 0x18, 0x30, 0x19, 0x8d, 0x41, 0x1c, 0x18,
+	0x30, 0x1b, 0x8d, 0x42, 0x1c, 0x18, 0x30, 0x1d, 0x8d, 0x43, 0x1c, 0x18,
+	0x30, 0x1f, 0x8d, 0x44, 0x1c, 0x18, 0x30, 0x21, 0x15, 0x80, 0x10, 0x45,
+	0x1c, 0x18, 0x30, 0x23, 0x15, 0x80, 0x10, 0x46, 0x1c, 0x18, 0x30, 0x25,
+	0x15, 0x80, 0x10, 0x47, 0x1c, 0x18, 0x30, 0x27, 0x15, 0x80, 0x10, 0x48,
+	0x1c, 0x18, 0x30, 0x29, 0x15, 0x80, 0x10, 0x49, 0x1c, 0x18, 0x30, 0x2b,
+	0x15, 0x80, 0x10, 0x4a, 0x1c, 0x18, 0x30, 0x3d, 0x15, 0x80, 0x10, 0x5a,
+	0xc2, 0xd8, 0x14, 0x02, 0x30, 0x5c, 0xc0, 0x4a, 0x14, 0x00, 0x36, 0x5b,
+	0xc1, 0xc3, 0x41, 0x14, 0x00, 0x1f, 0x00, 0x53, 0xc0, 0x49, 0x14, 0x00,
+	0x36, 0x59, 0xc4, 0x58, 0xc6, 0x52, 0xc0, 0x48, 0x14, 0x00, 0x36, 0x57,
+	0xc7, 0x58, 0x1c, 0xc0, 0x32, 0x51, 0xc0, 0x47, 0x14, 0x00, 0x36, 0x54,
+	0x1c, 0x80, 0x37, 0x50, 0x1c, 0xc0, 0x37, 0x50, 0xc0, 0x46, 0x14, 0x00,
+	0x36, 0x4f, 0xc0, 0x45, 0x14, 0x00, 0x36, 0x4e, 0xc0, 0x44, 0x14, 0x00,
+	0x36, 0x4d, 0xc0, 0x43, 0x14, 0x00, 0x36, 0x4c, 0xc0, 0x42, 0x14, 0x00,
+	0x36, 0x4b, 0xc0, 0x41, 0x14, 0x00, 0x36, 0x4a, 0xc0, 0x40, 0x14, 0x00,
+	0x36, 0x49, 0xc0, 0xfc, 0x14, 0x00, 0x30, 0x48, 0xc0, 0xf8, 0x14, 0x00,
+	0x30, 0x47, 0xc0, 0xf4, 0x14, 0x00, 0x30, 0x46, 0xc0, 0xf0, 0x14, 0x00,
+	0x30, 0x45, 0xc0, 0xec, 0x14, 0x00, 0x30, 0x44, 0xc0, 0xe8, 0x14, 0x00,
+	0x30, 0x43, 0xc0, 0xe4, 0x14, 0x00, 0x30, 0x42, 0xc0, 0xe0, 0x14, 0x00,
+	0x30, 0x41, 0xc0, 0xdc, 0x14, 0x00, 0x30, 0x40, 0xc0, 0xb6, 0x0b, 0x96,
+	0x01, 0xc2, 0x67, 0x77, 0x77, 0x70, 0xac, 0x06, 0xca, 0xff, 0x80, 0x24,
+	0x04, 0x3b, 0x56, 0x0a, 0xf0, 0x08, 0xf1, 0xc0, 0x82, 0x24, 0x02, 0x3d,
+	0x80, 0xc0, 0x2c, 0x70, 0xf2, 0x08, 0x20, 0x01, 0xb4, 0xda, 0xc3, 0x41,
+	0x8f, 0x01, 0x00, 0x00, 0x8a, 0x2e, 0x00, 0xf2, 0x0d, 0x75, 0x40, 0xd8,
+	0x80, 0xc1, 0x22, 0x0c, 0x60, 0x01, 0x09, 0xda, 0x0c, 0x70, 0x09, 0xd9,
+	0x80, 0xc2, 0xce, 0x0c, 0xaf, 0xff, 0x6c, 0x72, 0x30, 0xd8, 0x80, 0xc1,
+	0x0e, 0x16, 0x00, 0x10, 0x71, 0x16, 0x00, 0x11, 0xba, 0x16, 0x00, 0x40,
+	0x80, 0x24, 0x02, 0x3d, 0x76, 0x07, 0x04, 0xa2, 0x04, 0xf0, 0x05, 0x34,
+	0x75, 0xe0, 0x20, 0xc5, 0x07, 0xe0, 0x7f, 0x10, 0x1a, 0x02, 0x30, 0xe6,
+	0xc0, 0xcb, 0x44, 0x04, 0x90, 0xe4, 0x00, 0xfc, 0x0b, 0xf2, 0x29, 0x67,
+	0x06, 0x35, 0x08, 0xb0, 0x00, 0x6c, 0x71, 0x14, 0x71, 0x25, 0xd8, 0xcb,
+	0x46, 0x04, 0x90, 0x30, 0x00, 0x9f, 0xb8, 0x2a, 0xf4, 0x25, 0x8a, 0x23,
+	0xaa, 0xa4, 0x8a, 0x34, 0x7b, 0xa2, 0xaa, 0xc0, 0x96, 0xe0, 0x88, 0xbb,
+	0x78, 0xe0, 0xb4, 0x00, 0xaa, 0x5f, 0x0e, 0x71, 0x11, 0x61, 0xaa, 0xe1,
+	0xb4, 0x2d, 0xf0, 0x0c, 0x70, 0x00, 0xb4, 0x58, 0x00, 0x40, 0x58, 0x00,
+	0x21, 0xb4, 0x4c, 0x00, 0xf0, 0x17, 0xf6, 0x00, 0x00, 0xb4, 0x04, 0xb4,
+	0x06, 0x1c, 0xc5, 0x13, 0x27, 0x8a, 0x23, 0xaa, 0x06, 0x8a, 0x34, 0x7b,
+	0x02, 0xaa, 0x1b, 0x78, 0x00, 0xaa, 0xff, 0xd8, 0x61, 0xaa, 0xfe, 0x1c,
+	0x04, 0x90, 0xc6, 0xc4, 0xa0, 0x88, 0xa0, 0xb4, 0x1c, 0x00, 0x15, 0x04,
+	0x1c, 0x00, 0xf2, 0x1b, 0x61, 0xaa, 0x00, 0x96, 0x29, 0x08, 0x51, 0x01,
+	0xa1, 0xb4, 0x15, 0xf0, 0x02, 0x1c, 0x05, 0x10, 0xc3, 0x41, 0x04, 0x90,
+	0xfe, 0x00, 0xff, 0xd8, 0x00, 0x19, 0xc5, 0x03, 0xf8, 0x19, 0x04, 0x80,
+	0xf6, 0x19, 0x05, 0x80, 0xfe, 0x19, 0x05, 0x80, 0xc6, 0xc4, 0x02, 0x03,
+	0x40, 0x58, 0x00, 0x01, 0xb4, 0x80, 0x03, 0xf5, 0x00, 0x04, 0x90, 0xf6,
+	0x00, 0x20, 0xb0, 0x24, 0xb0, 0xfe, 0x18, 0x44, 0x80, 0x23, 0xb0, 0xc6,
+	0x3c, 0x0c, 0x20, 0xa1, 0xc1, 0xc0, 0x00, 0x80, 0xf4, 0x00, 0x00, 0x96,
+	0xa2, 0x6e, 0x2c, 0x70, 0xf4, 0x07, 0xf0, 0x02, 0x00, 0x15, 0x1b, 0x11,
+	0xe3, 0x95, 0x08, 0x15, 0x0b, 0x11, 0x08, 0x1d, 0xc5, 0x13, 0x00, 0xb5,
+	0x06, 0x06, 0x00, 0x12, 0xb6, 0x4e, 0x00, 0x20, 0x64, 0x06, 0x9e, 0x06,
+	0x40, 0x08, 0x90, 0x90, 0x01, 0xb8, 0x04, 0xf4, 0x09, 0xf8, 0x2a, 0x86,
+	0x0c, 0xe0, 0x00, 0xfa, 0x1e, 0x85, 0x94, 0x00, 0xc0, 0x00, 0xb6, 0xe3,
+	0xb5, 0x00, 0x1d, 0xc4, 0x16, 0x08, 0x1d, 0xc4, 0x12, 0x2c, 0x00, 0x60,
+	0x1d, 0x78, 0xa0, 0xb8, 0x29, 0x68, 0x2a, 0x03, 0xc0, 0x7c, 0x05, 0x21,
+	0xa8, 0x87, 0x74, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0x00, 0x00, 0x00,
+	0x00, 0xa7, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82,
+	0x98, 0x0e, 0x00, 0x00, 0xf1, 0x72, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6,
+	0xcb, 0x47, 0x04, 0x90, 0xe0, 0x01, 0x20, 0x97, 0x00, 0x16, 0x80, 0x70,
+	0x00, 0x80, 0x04, 0x00, 0xad, 0x70, 0x5f, 0x20, 0x00, 0x01, 0x44, 0x20,
+	0xc2, 0x07, 0x20, 0x40, 0x06, 0xea, 0x61, 0xba, 0x01, 0x0a, 0x31, 0x00,
+	0x1d, 0x78, 0xc3, 0xb8, 0x0f, 0x08, 0x70, 0x00, 0xa1, 0xc1, 0x07, 0x08,
+	0x90, 0x01, 0xad, 0x71, 0x0c, 0x70, 0x16, 0x0c, 0xe0, 0x00, 0x40, 0xd9,
+	0xcb, 0x46, 0x05, 0x90, 0x12, 0xe1, 0xde, 0x1e, 0x55, 0x10, 0xa6, 0x1e,
+	0x55, 0x90, 0xb6, 0x17, 0x00, 0x91, 0x6f, 0x71, 0x40, 0xc0, 0x29, 0xed,
+	0x00, 0xc0, 0x4f, 0x08, 0xbf, 0x03, 0x1c, 0xd9, 0x00, 0xc0, 0x84, 0x20,
+	0x07, 0x0c, 0x40, 0xc0, 0x8f, 0xb8, 0x00, 0xb6, 0x0c, 0x70, 0xe2, 0x0b,
+	0xe0, 0x00, 0xf6, 0x1e, 0x05, 0x92, 0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42,
+	0x2c, 0x70, 0xd2, 0x10, 0x00, 0xa0, 0x45, 0x92, 0xbe, 0x17, 0x00, 0x91,
+	0xf0, 0x1e, 0x45, 0x90, 0x1c, 0x00, 0xf0, 0x07, 0x9a, 0x20, 0x08, 0x00,
+	0x04, 0x20, 0x81, 0x0f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0xc0, 0x25, 0x78,
+	0x8e, 0xb8, 0x00, 0xb6, 0x05, 0xf0, 0x1a, 0x00, 0x00, 0x22, 0x00, 0xf3,
+	0x03, 0x00, 0x1e, 0xc4, 0x76, 0x13, 0x90, 0x50, 0xe0, 0x87, 0x74, 0x04,
+	0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xe0, 0x78, 0xc4, 0x00, 0xf0, 0x0f, 0x46,
+	0x04, 0x90, 0xf4, 0x00, 0xa2, 0x6e, 0xff, 0xd8, 0x00, 0x16, 0x1b, 0x11,
+	0x00, 0x15, 0x1e, 0x11, 0x06, 0x15, 0x0b, 0x11, 0xe4, 0x95, 0x08, 0x1d,
+	0xc5, 0x13, 0x00, 0xb5, 0x06, 0x06, 0x00, 0xf4, 0x1c, 0xb6, 0x0c, 0x70,
+	0x00, 0x1e, 0x04, 0x70, 0x08, 0x90, 0x90, 0x01, 0x34, 0xd8, 0xfa, 0x1e,
+	0x04, 0x90, 0xc3, 0x40, 0x00, 0x00, 0xf8, 0x2a, 0x4e, 0x0b, 0xe0, 0x00,
+	0x2c, 0x70, 0x00, 0x1e, 0xc4, 0x16, 0x06, 0x1d, 0xc4, 0x12, 0x00, 0x1d,
+	0x84, 0x17, 0xe4, 0xb5, 0x5c, 0x00, 0xa4, 0x21, 0x88, 0x00, 0x88, 0x19,
+	0x61, 0xe0, 0x7f, 0x3d, 0x78, 0x68, 0x00, 0xf2, 0x11, 0xa2, 0xc1, 0x28,
+	0x43, 0x34, 0x70, 0x00, 0x16, 0x81, 0x70, 0x00, 0x80, 0x1a, 0x00, 0x08,
+	0x46, 0xf0, 0xd8, 0xca, 0x20, 0xe2, 0x03, 0x58, 0x43, 0xfa, 0x09, 0x60,
+	0x01, 0x2b, 0x78, 0x69, 0xf4, 0x44, 0x01, 0xf4, 0xbd, 0x01, 0x00, 0xcb,
+	0x08, 0xbf, 0x00, 0xc1, 0x41, 0x15, 0xca, 0x0c, 0x12, 0x8d, 0x30, 0x41,
+	0xc0, 0x61, 0x40, 0x63, 0x42, 0x40, 0xdb, 0x15, 0x1a, 0xc3, 0x30, 0x52,
+	0x0f, 0x20, 0x00, 0x0c, 0x1a, 0x83, 0x30, 0x1b, 0x0b, 0x30, 0x10, 0xc1,
+	0x40, 0xc1, 0x40, 0x63, 0x41, 0x4c, 0x71, 0x80, 0xdb, 0xfa, 0x0c, 0x60,
+	0x01, 0x00, 0x1c, 0x01, 0x30, 0x05, 0xf0, 0x63, 0x41, 0x4a, 0x0f, 0x60,
+	0x01, 0x4c, 0x70, 0xc3, 0x40, 0x00, 0x80, 0x69, 0x06, 0x01, 0x10, 0x9f,
+	0x00, 0xc0, 0x88, 0x4a, 0x26, 0x00, 0x30, 0x8a, 0x23, 0xc1, 0x1f, 0x8d,
+	0x70, 0x1b, 0xf0, 0x2f, 0x0b, 0x6e, 0x30, 0x0c, 0x70, 0x0f, 0xf0, 0x9f,
+	0x23, 0x41, 0x00, 0xc3, 0x42, 0x00, 0x80, 0xdc, 0x06, 0x14, 0x7b, 0x7f,
+	0x62, 0x4b, 0x63, 0x41, 0x8f, 0x04, 0x71, 0x09, 0x23, 0xcb, 0x10, 0x08,
+	0x26, 0x9e, 0x30, 0xe7, 0x08, 0xf4, 0x87, 0x8f, 0x7b, 0x85, 0x71, 0x24,
+	0x71, 0xd3, 0x09, 0x54, 0x82, 0xc5, 0x71, 0xcf, 0x78, 0xf9, 0x0f, 0x25,
+	0xb0, 0x2c, 0x70, 0x65, 0xca, 0x40, 0x26, 0x1e, 0x32, 0x42, 0x23, 0x0b,
+	0x12, 0x09, 0x20, 0x83, 0x07, 0x64, 0xca, 0x67, 0x1a, 0xc2, 0x30, 0xc3,
+	0x41, 0x32, 0x00, 0x02, 0x00, 0x08, 0x23, 0x00, 0x10, 0x66, 0x1a, 0x02,
+	0x30, 0x0f, 0x7a, 0xe2, 0x0f, 0xaf, 0xff, 0x0c, 0x74, 0x01, 0xc0, 0x0c,
+	0x1a, 0x42, 0x33, 0x15, 0x1a, 0x02, 0x30, 0xa2, 0xc0, 0x0c, 0x01, 0xa0,
+	0xe6, 0xc0, 0x04, 0xc6, 0x0f, 0x09, 0xf4, 0x07, 0x03, 0xc5, 0x48, 0x01,
+	0xfa, 0x5b, 0x03, 0x10, 0x3c, 0xf0, 0x14, 0x20, 0x4c, 0x00, 0xe1, 0x8c,
+	0xf3, 0x0f, 0xa4, 0x90, 0x0a, 0x26, 0xc0, 0x33, 0xe0, 0x8c, 0xeb, 0x0a,
+	0xe4, 0x83, 0xe9, 0x43, 0x02, 0x26, 0x8f, 0x30, 0x02, 0x22, 0xcc, 0x02,
+	0x74, 0x70, 0xfd, 0x74, 0x80, 0xae, 0x28, 0x46, 0x12, 0xf0, 0x2b, 0x0e,
+	0xa4, 0x30, 0xcf, 0x7c, 0x23, 0x0c, 0xf5, 0x17, 0x74, 0x70, 0xff, 0xdc,
+	0xca, 0x24, 0x62, 0x10, 0xfe, 0x64, 0xcd, 0x7c, 0x14, 0x20, 0x0c, 0x03,
+	0x00, 0x14, 0x8b, 0x10, 0x01, 0x14, 0x9e, 0x10, 0xdf, 0x0a, 0xe5, 0x82,
+	0xcd, 0x7f, 0x74, 0x70, 0xff, 0xd8, 0xca, 0x20, 0x61, 0x00, 0xf8, 0x60,
+	0x0d, 0x7a, 0x0c, 0xca, 0x03, 0xf2, 0x31, 0x4a, 0x02, 0xf0, 0x42, 0x79,
+	0x88, 0x02, 0x62, 0x1b, 0x78, 0x00, 0xad, 0xc6, 0xc4, 0xf4, 0x01, 0xf2,
+	0x19, 0x38, 0x43, 0x00, 0x16, 0x01, 0x71, 0x00, 0x80, 0x06, 0x00, 0x48,
+	0x43, 0x8c, 0x21, 0x4a, 0x86, 0x96, 0x00, 0x2d, 0x00, 0xa1, 0xc1, 0xca,
+	0x0e, 0xaf, 0xff, 0x2c, 0x71, 0x0a, 0x26, 0x00, 0x30, 0x5f, 0x23, 0x00,
+	0x18, 0xad, 0x70, 0xec, 0x68, 0x94, 0x01, 0xf1, 0x38, 0x04, 0x00, 0x1a,
+	0x20, 0x8e, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x33, 0xf0, 0x1a, 0x23, 0x81,
+	0x3f, 0x00, 0x00, 0x00, 0x10, 0x25, 0x78, 0x05, 0x20, 0x81, 0x03, 0xa1,
+	0x40, 0x9a, 0x20, 0x04, 0x00, 0x25, 0x78, 0x1b, 0x78, 0x91, 0xb8, 0x9c,
+	0xb8, 0x9f, 0xb8, 0x40, 0xc0, 0x0a, 0x0f, 0xaf, 0xff, 0x00, 0x90, 0x08,
+	0xeb, 0x04, 0x27, 0x81, 0x1f, 0x00, 0x00, 0xfc, 0xff, 0x38, 0x60, 0x03,
+	0xf0, 0xe2, 0x78, 0x0e, 0x7a, 0x5c, 0x78, 0x1c, 0x02, 0x00, 0xf6, 0x1b,
+	0x00, 0x41, 0x1b, 0xd8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x3d, 0x79,
+	0xa5, 0x71, 0x38, 0x62, 0xc4, 0xb8, 0x31, 0x48, 0x44, 0x2a, 0x00, 0x08,
+	0x9a, 0x20, 0x01, 0x00, 0x05, 0x79, 0x00, 0xc0, 0x20, 0xb0, 0xa1, 0x0d,
+	0xb4, 0x90, 0x55, 0x26, 0x00, 0x38, 0xa8, 0x02, 0xf1, 0x0a, 0xe2, 0xc2,
+	0xcb, 0x45, 0x04, 0x90, 0x06, 0x00, 0x20, 0xd8, 0x86, 0x08, 0xe0, 0x00,
+	0x00, 0x1d, 0x45, 0x10, 0x00, 0x1d, 0x05, 0x10, 0xc2, 0xc6, 0xe6, 0x18,
+	0x00, 0xf4, 0x1d, 0xc6, 0x01, 0xc0, 0x95, 0xcb, 0xbe, 0x4f, 0x26, 0xcf,
+	0x12, 0x05, 0x26, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0xe0, 0xb5, 0x00,
+	0xb5, 0x5a, 0x08, 0xe0, 0x00, 0x0a, 0xd8, 0xe0, 0xb5, 0x01, 0x95, 0xc0,
+	0xb5, 0xc9, 0xb8, 0xc6, 0xc6, 0xf5, 0x06, 0x6f, 0xff, 0x40, 0x40, 0x8c,
+	0x02, 0xf0, 0x15, 0xac, 0xc1, 0x49, 0xc2, 0x44, 0xc1, 0x2c, 0x70, 0x4c,
+	0x74, 0x4b, 0xc3, 0x86, 0x0b, 0xe0, 0x00, 0x43, 0xc0, 0x04, 0xc0, 0xed,
+	0x70, 0x04, 0x77, 0x51, 0x08, 0xb5, 0x00, 0x8a, 0x23, 0x02, 0x30, 0x09,
+	0xc6, 0xad, 0x70, 0x08, 0x00, 0x80, 0x1c, 0xf0, 0xcc, 0x79, 0x04, 0xc0,
+	0x14, 0x72, 0x54, 0x02, 0xf0, 0x43, 0x1a, 0x07, 0x03, 0xf4, 0x09, 0x61,
+	0x03, 0xf0, 0x38, 0x60, 0x22, 0x88, 0xb5, 0x70, 0xca, 0x23, 0x41, 0x30,
+	0x38, 0x21, 0xc0, 0x06, 0xc3, 0x41, 0x57, 0x00, 0x01, 0x00, 0x36, 0x0e,
+	0x6f, 0xff, 0xc1, 0x42, 0xb5, 0x70, 0xca, 0x25, 0x61, 0x10, 0xc5, 0x71,
+	0x0b, 0xc0, 0xcd, 0x0e, 0x24, 0x90, 0x41, 0xd9, 0x0c, 0x70, 0x45, 0xc0,
+	0x8e, 0xf0, 0x09, 0xc0, 0xad, 0x70, 0x4a, 0xc6, 0x3b, 0xf0, 0x43, 0x09,
+	0x04, 0x00, 0x02, 0xca, 0x3b, 0x08, 0x44, 0x00, 0x06, 0xc1, 0x08, 0xc0,
+	0x34, 0x78, 0xc3, 0x41, 0x84, 0x02, 0x60, 0x29, 0x60, 0x00, 0x20, 0x80,
+	0x0f, 0x0a, 0x00, 0xf0, 0x11, 0x61, 0x88, 0x05, 0xc0, 0x0f, 0x78, 0x1b,
+	0x63, 0x38, 0x60, 0x41, 0xc0, 0x06, 0xc0, 0x42, 0xc3, 0xc3, 0x41, 0x59,
+	0x00, 0x05, 0x00, 0x40, 0xc0, 0x0c, 0x74, 0x86, 0x0d, 0xaf, 0xff, 0xe1,
+	0x43, 0x36, 0x00, 0x44, 0xcf, 0x7e, 0xaf, 0x7d, 0x3a, 0x00, 0x31, 0x00,
+	0x20, 0x83, 0x38, 0x00, 0xf0, 0x63, 0x2a, 0x60, 0x05, 0xc0, 0x61, 0x8b,
+	0x0f, 0x79, 0x38, 0x63, 0xd1, 0x70, 0xca, 0x26, 0x05, 0x10, 0x38, 0x62,
+	0xb1, 0x70, 0xca, 0x25, 0x0d, 0x10, 0x07, 0xc0, 0x04, 0x71, 0x47, 0xc0,
+	0x07, 0xc0, 0x0f, 0x7a, 0x0b, 0xc0, 0x57, 0x0a, 0x25, 0x00, 0x41, 0xd8,
+	0x4a, 0x78, 0xc3, 0x43, 0x00, 0x80, 0x1b, 0x07, 0x48, 0xc0, 0x69, 0x60,
+	0x04, 0xc0, 0x15, 0x08, 0x70, 0x00, 0xf9, 0x61, 0x08, 0xc0, 0x78, 0x60,
+	0x61, 0x88, 0x80, 0xd8, 0x62, 0x78, 0x45, 0xc0, 0x2d, 0x78, 0x46, 0xc0,
+	0x2f, 0x7b, 0x03, 0xca, 0x57, 0x0b, 0xf4, 0x87, 0x42, 0x50, 0x21, 0x09,
+	0x24, 0x00, 0xcd, 0x70, 0x02, 0xca, 0x19, 0x08, 0x64, 0x00, 0xe1, 0x43,
+	0x06, 0xc0, 0xc3, 0x41, 0x5a, 0x00, 0x03, 0x00, 0x40, 0xc0, 0xfa, 0x0c,
+	0xe8, 0x02, 0xc0, 0xff, 0xdd, 0xcf, 0x79, 0xaf, 0x7b, 0x13, 0x0b, 0x65,
+	0x00, 0x4c, 0x70, 0xb8, 0x00, 0xf0, 0x39, 0x12, 0x49, 0x10, 0x4b, 0x4a,
+	0xc0, 0x03, 0xc0, 0xf4, 0x78, 0x41, 0xa8, 0x0a, 0xc2, 0x40, 0xa8, 0x03,
+	0x12, 0x82, 0x30, 0x12, 0xc8, 0x1f, 0x08, 0x84, 0x00, 0x02, 0x12, 0x82,
+	0x30, 0x17, 0x0a, 0x24, 0x00, 0x0c, 0x74, 0x40, 0xc1, 0xc3, 0x41, 0x5b,
+	0x00, 0x03, 0x00, 0xb6, 0x0c, 0xaf, 0xff, 0xe1, 0x42, 0xe5, 0x71, 0x9f,
+	0xe7, 0xe6, 0x06, 0xe5, 0xff, 0xff, 0xde, 0x03, 0xc0, 0x8a, 0x22, 0x3e,
+	0x00, 0x03, 0xc1, 0x3f, 0x18, 0x03, 0x00, 0x6e, 0x01, 0x90, 0x40, 0x40,
+	0xca, 0x20, 0xc1, 0x06, 0x3e, 0x19, 0x02, 0x0e, 0x00, 0xf3, 0x15, 0x71,
+	0x03, 0xc0, 0xca, 0x22, 0xc1, 0x06, 0x40, 0x18, 0x82, 0x00, 0x03, 0x12,
+	0x81, 0x30, 0x12, 0xc8, 0x15, 0x08, 0x44, 0x00, 0x02, 0x12, 0x81, 0x30,
+	0x0d, 0x09, 0x04, 0x00, 0x5e, 0x0f, 0xaf, 0xff, 0x03, 0xc0, 0xac, 0x6a,
+	0x03, 0x24, 0x14, 0x70, 0xb0, 0x02, 0xf0, 0x17, 0xc3, 0x41, 0x04, 0x90,
+	0x68, 0x01, 0xc2, 0x21, 0x22, 0x02, 0x1a, 0x20, 0x80, 0x0f, 0x20, 0x00,
+	0x00, 0x00, 0x05, 0x79, 0xe0, 0x7f, 0x00, 0x91, 0xe0, 0x78, 0x00, 0x16,
+	0x00, 0x71, 0x00, 0x80, 0x22, 0x00, 0x14, 0x70, 0xe0, 0x7d, 0x0c, 0x00,
+	0x80, 0x04, 0x90, 0x08, 0x00, 0xe0, 0x7e, 0xe0, 0x78, 0x12, 0x04, 0xf0,
+	0x1f, 0x65, 0x06, 0x13, 0x08, 0x70, 0x00, 0x14, 0x70, 0x0c, 0x70, 0x0b,
+	0xf4, 0x40, 0x8a, 0x4f, 0xd8, 0x03, 0xf0, 0x40, 0x8a, 0x53, 0xd8, 0x9f,
+	0xb8, 0x54, 0x70, 0xc0, 0x20, 0xe2, 0x0c, 0x34, 0x70, 0xe0, 0x7f, 0xc0,
+	0x20, 0xa1, 0x00, 0xe0, 0x78, 0xf1, 0xc0, 0x00, 0x42, 0x14, 0x71, 0x14,
+	0x02, 0xf1, 0x04, 0x65, 0x06, 0x05, 0xf2, 0x8c, 0xea, 0x20, 0x88, 0x4d,
+	0xd8, 0x03, 0xf0, 0x20, 0x88, 0x4e, 0xd8, 0x9f, 0xb8, 0x34, 0x2c, 0x00,
+	0xf0, 0x05, 0x08, 0xf0, 0x2c, 0x71, 0x0c, 0x70, 0x1e, 0x0c, 0x6f, 0xff,
+	0x93, 0xb9, 0x0c, 0x70, 0xd1, 0xc0, 0xe0, 0x7e, 0xe2, 0xc2, 0x58, 0x03,
+	0xf0, 0x13, 0x6d, 0x70, 0xad, 0x70, 0x0b, 0xf0, 0x2e, 0x0f, 0x60, 0x00,
+	0x0a, 0x21, 0x80, 0x07, 0x04, 0xe8, 0xaf, 0x78, 0x0f, 0x20, 0xcd, 0x02,
+	0x65, 0x71, 0xf1, 0x0b, 0xb4, 0x90, 0x61, 0x40, 0xaf, 0x78, 0xc2, 0xc6,
+	0x56, 0x00, 0x82, 0x74, 0x06, 0x69, 0x04, 0x6f, 0xff, 0x00, 0x80, 0x0c,
+	0x00, 0x02, 0x9a, 0x00, 0xf1, 0x32, 0x20, 0x80, 0x00, 0x8a, 0x5f, 0x20,
+	0x80, 0x0c, 0x38, 0x60, 0x21, 0x8a, 0x5f, 0x21, 0x41, 0x06, 0x38, 0x60,
+	0x42, 0x88, 0x0c, 0x70, 0x2d, 0x05, 0xef, 0xff, 0x2c, 0x70, 0x4c, 0x70,
+	0x6c, 0x70, 0x0c, 0xf0, 0x17, 0x08, 0xae, 0x00, 0x6f, 0x79, 0x03, 0xea,
+	0x21, 0x6b, 0x2f, 0x79, 0x0b, 0x0a, 0xf4, 0x00, 0x61, 0x69, 0x63, 0x69,
+	0x44, 0x71, 0xeb, 0x0a, 0x94, 0x81, 0xe0, 0x7f, 0x6f, 0x78, 0xe4, 0xb0,
+	0x06, 0x42, 0x18, 0x43, 0x06, 0xe8, 0x24, 0x01, 0x42, 0x14, 0x00, 0x06,
+	0xf0, 0x0a, 0x00, 0xf0, 0x05, 0x15, 0x00, 0x1d, 0x79, 0x3d, 0x79, 0x12,
+	0x1a, 0x02, 0x30, 0x6f, 0x25, 0xc3, 0x1b, 0x3d, 0x79, 0xc0, 0x8d, 0x3d,
+	0x79, 0x02, 0x00, 0xe0, 0x03, 0x1a, 0x82, 0x33, 0x3d, 0x79, 0xf7, 0x15,
+	0x8c, 0x90, 0x0b, 0x1a, 0x42, 0x30, 0x24, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x04, 0x00, 0xb0, 0x44, 0x21, 0x42, 0x00, 0x53, 0x20, 0x41, 0x81, 0x6c,
+	0x77, 0x20, 0xaa, 0x01, 0xf1, 0x1b, 0x00, 0x84, 0x24, 0x01, 0x10, 0x13,
+	0x1a, 0x82, 0x30, 0x12, 0x1a, 0x42, 0x30, 0x0f, 0x1a, 0x02, 0x30, 0x14,
+	0x1a, 0x02, 0x33, 0x02, 0xe9, 0x04, 0xea, 0x12, 0x1a, 0x03, 0x35, 0x0d,
+	0x0e, 0x35, 0x14, 0x0c, 0x70, 0x03, 0x1a, 0xc3, 0x3f, 0x0e, 0xf0, 0xdd,
+	0x58, 0x00, 0xc0, 0x3d, 0x79, 0x09, 0x69, 0xc3, 0xbe, 0x02, 0x1a, 0x02,
+	0x30, 0xd8, 0x61, 0x64, 0x00, 0x20, 0x04, 0x77, 0x0c, 0x00, 0xf4, 0x0d,
+	0x20, 0xd8, 0x9f, 0xb8, 0x40, 0x88, 0x14, 0x1a, 0x98, 0x30, 0x61, 0x88,
+	0x18, 0x1a, 0xd8, 0x30, 0x14, 0xec, 0x1d, 0x0b, 0x10, 0x30, 0x7d, 0x7b,
+	0x7d, 0x7b, 0x5d, 0x7a, 0x04, 0x00, 0x00, 0x18, 0x00, 0x80, 0x5d, 0x7a,
+	0x06, 0xf0, 0xc3, 0xbb, 0xc3, 0xba, 0x0c, 0x00, 0x00, 0x2e, 0x00, 0xf0,
+	0x05, 0x6f, 0x20, 0x43, 0x0f, 0xc9, 0x68, 0x77, 0x70, 0xc1, 0x41, 0xca,
+	0x21, 0x01, 0x00, 0x00, 0x89, 0x1d, 0x78, 0xc1, 0xb8, 0x7e, 0x05, 0x00,
+	0x0a, 0x00, 0x20, 0x1d, 0x78, 0x0e, 0x00, 0xf0, 0x13, 0x0c, 0x1a, 0x02,
+	0x30, 0xf7, 0x15, 0x81, 0x90, 0x0c, 0x71, 0xc3, 0xb9, 0xc4, 0xb9, 0x05,
+	0xe9, 0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x1b, 0x78, 0x53, 0x50, 0xc3,
+	0x41, 0x2b, 0x00, 0x02, 0x00, 0x2a, 0x0a, 0xd0, 0x02, 0xf0, 0x11, 0x77,
+	0x70, 0x7f, 0xd8, 0x50, 0xdd, 0x1c, 0x75, 0x14, 0xc8, 0x65, 0x1a, 0x42,
+	0x33, 0x64, 0x1a, 0x03, 0x30, 0x55, 0x50, 0x18, 0xc8, 0x77, 0x70, 0x56,
+	0x50, 0xfd, 0x16, 0x80, 0x90, 0x1b, 0x79, 0x4c, 0x00, 0xf0, 0x0b, 0x1d,
+	0x78, 0x3c, 0x70, 0x44, 0x20, 0x9e, 0x87, 0x53, 0xf2, 0x61, 0x0b, 0x30,
+	0x30, 0x9f, 0x26, 0x0f, 0x3a, 0x6f, 0x20, 0x43, 0x02, 0x20, 0x88, 0x08,
+	0x88, 0x66, 0x02, 0x82, 0x01, 0x00, 0xa0, 0x86, 0x1d, 0x7b, 0x1a, 0x21,
+	0x70, 0x02, 0x00, 0xba, 0x00, 0xc0, 0x7d, 0x7b, 0x05, 0x20, 0x80, 0x0f,
+	0x02, 0x90, 0x86, 0x00, 0x00, 0x90, 0x10, 0x00, 0xf0, 0x19, 0x44, 0x20,
+	0x82, 0x00, 0x0c, 0xc8, 0x7d, 0x7b, 0x50, 0x60, 0x10, 0x4b, 0x48, 0x20,
+	0x01, 0x00, 0x06, 0xc8, 0x52, 0x60, 0x05, 0x29, 0x81, 0x00, 0x05, 0x2e,
+	0x9e, 0x30, 0x2f, 0x78, 0xff, 0xe0, 0x7f, 0xd8, 0xca, 0x20, 0x45, 0x00,
+	0x10, 0xf0, 0xf8, 0x01, 0x40, 0x65, 0x06, 0x00, 0x88, 0xf0, 0x01, 0x11,
+	0x32, 0x1e, 0x04, 0xf1, 0x14, 0x86, 0x06, 0x9e, 0x0a, 0x4f, 0xff, 0x85,
+	0x2e, 0x06, 0x34, 0x0f, 0x7a, 0x40, 0x26, 0x40, 0x30, 0x0f, 0x79, 0x58,
+	0x61, 0x09, 0x25, 0x03, 0x10, 0x30, 0x4a, 0x48, 0x20, 0x00, 0x00, 0x65,
+	0x1a, 0xc2, 0x30, 0x64, 0x84, 0x06, 0x80, 0xc3, 0x41, 0x29, 0x00, 0x02,
+	0x00, 0x56, 0x09, 0xd2, 0x00, 0x40, 0xa2, 0x0a, 0x00, 0x01, 0x82, 0x06,
+	0xf6, 0x05, 0xc4, 0xc6, 0xcb, 0x44, 0x0e, 0x90, 0xc2, 0x00, 0x02, 0x1c,
+	0x14, 0x10, 0x20, 0xb4, 0x41, 0xb4, 0xe0, 0x7f, 0x62, 0xb4, 0x08, 0x05,
+	0xf1, 0x00, 0xcb, 0x45, 0x00, 0x80, 0x86, 0x06, 0x0a, 0x26, 0x40, 0x33,
+	0x44, 0xc3, 0x00, 0x16, 0x83, 0xc6, 0x08, 0xf0, 0x0b, 0x80, 0x26, 0x81,
+	0x35, 0x4b, 0xc2, 0x43, 0xc1, 0x40, 0xc0, 0x0a, 0x20, 0x80, 0x07, 0xc3,
+	0x42, 0x00, 0x00, 0x91, 0x14, 0x5e, 0x0e, 0xa0, 0x00, 0x2c, 0x70, 0xb4,
+	0x04, 0xf0, 0x13, 0x74, 0x04, 0xc3, 0x40, 0x1f, 0x00, 0x1f, 0x00, 0x09,
+	0xa1, 0x00, 0xc0, 0xed, 0x70, 0x2c, 0x19, 0x01, 0x04, 0xf8, 0xb1, 0x28,
+	0x19, 0xc5, 0x03, 0x0e, 0x1a, 0xc2, 0x33, 0x0d, 0x1a, 0xc2, 0x33, 0x8b,
+	0xe8, 0x1e, 0x08, 0xf0, 0x01, 0x00, 0x0c, 0x18, 0xb1, 0x40, 0x20, 0xc2,
+	0x07, 0x0f, 0xe0, 0x53, 0xb1, 0x14, 0xb1, 0x03, 0xc0, 0x3a, 0x00, 0xb1,
+	0x65, 0x06, 0x42, 0x89, 0x5f, 0x20, 0x00, 0x05, 0x1a, 0x23, 0x83, 0x4e,
+	0x06, 0x13, 0x58, 0xfc, 0x04, 0xe0, 0x70, 0x1b, 0x42, 0xc0, 0x03, 0xc0,
+	0x4a, 0xc3, 0x5f, 0x20, 0x42, 0x06, 0x00, 0x89, 0xf6, 0x00, 0xe0, 0x58,
+	0x60, 0xa8, 0x60, 0x49, 0xc0, 0x05, 0x89, 0x48, 0xc0, 0x04, 0x89, 0x79,
+	0xf0, 0x5e, 0x01, 0x00, 0x74, 0x06, 0xf2, 0x23, 0xff, 0xde, 0xb9, 0x43,
+	0x46, 0xc0, 0x0c, 0x70, 0x47, 0xc6, 0x45, 0xc0, 0x69, 0xf0, 0x00, 0xc0,
+	0x06, 0xe8, 0x4f, 0x25, 0x80, 0x10, 0x0f, 0x78, 0x49, 0x08, 0x11, 0x01,
+	0x00, 0xc0, 0x8c, 0xd9, 0x14, 0x70, 0xc0, 0xd8, 0x3c, 0x70, 0x03, 0xc1,
+	0x19, 0x61, 0x0a, 0xc0, 0x05, 0x79, 0x06, 0xc0, 0x05, 0x79, 0x04, 0x05,
+	0x20, 0x0d, 0x78, 0xa6, 0x06, 0x40, 0x31, 0xf8, 0x6e, 0x08, 0x9c, 0x06,
+	0xf1, 0x14, 0x10, 0x79, 0x0c, 0xca, 0x44, 0x20, 0xc3, 0x07, 0x20, 0x40,
+	0x05, 0xeb, 0x61, 0xbb, 0xff, 0x0b, 0x31, 0x80, 0x1d, 0x78, 0x45, 0xc0,
+	0x00, 0xc0, 0x0d, 0xe8, 0x06, 0xc1, 0x04, 0xc0, 0xc5, 0x71, 0x05, 0x79,
+	0xcd, 0x30, 0x00, 0x82, 0x25, 0xf8, 0x00, 0x10, 0x1b, 0x01, 0x14, 0xf0,
+	0x64, 0x00, 0xf0, 0x1f, 0x21, 0x08, 0x11, 0x01, 0x04, 0xc0, 0x13, 0x08,
+	0x91, 0x00, 0x02, 0xc0, 0x02, 0xc1, 0x00, 0x88, 0x24, 0x71, 0x42, 0xc1,
+	0x02, 0xf0, 0x09, 0xc0, 0x06, 0x09, 0x6f, 0xff, 0xc5, 0x71, 0x18, 0x43,
+	0x0b, 0xc0, 0x41, 0x08, 0x6e, 0x03, 0xef, 0x7a, 0x9f, 0x22, 0x41, 0x00,
+	0x05, 0xc1, 0xc2, 0x01, 0xf0, 0x01, 0x1a, 0x07, 0x6c, 0x70, 0x58, 0x60,
+	0x02, 0x18, 0xc2, 0x06, 0x20, 0xa8, 0x0d, 0xf0, 0x00, 0x21, 0xe6, 0x05,
+	0xf4, 0x25, 0xdd, 0x06, 0x00, 0x18, 0x03, 0x00, 0x00, 0x21, 0x81, 0x07,
+	0x7f, 0xd8, 0x00, 0xa9, 0x64, 0x71, 0xed, 0x0b, 0xf4, 0x87, 0x14, 0x22,
+	0xc1, 0x00, 0xe5, 0x71, 0xa5, 0x71, 0x33, 0x0d, 0x54, 0x92, 0x01, 0xc0,
+	0x04, 0x71, 0x41, 0xc0, 0x01, 0xc0, 0x08, 0xc1, 0x0f, 0x78, 0x30, 0x70,
+	0x08, 0x07, 0xee, 0xff, 0xad, 0x70, 0xde, 0x04, 0x26, 0xe0, 0x78, 0x68,
+	0x07, 0x22, 0xe0, 0x7e, 0xc8, 0x07, 0xf0, 0x21, 0xa3, 0xc1, 0x4c, 0x70,
+	0x05, 0xf0, 0x00, 0x19, 0x05, 0x00, 0x44, 0x71, 0xfd, 0x0a, 0x74, 0x86,
+	0x14, 0x20, 0x81, 0x00, 0x32, 0xdb, 0x9f, 0xbb, 0x20, 0x8b, 0x21, 0xa8,
+	0x21, 0x6b, 0x40, 0xc1, 0x20, 0x89, 0x22, 0xa8, 0x00, 0xc1, 0x24, 0x71,
+	0x41, 0xc1, 0x20, 0x89, 0x23, 0xa8, 0x01, 0xc1, 0xb6, 0x00, 0xf0, 0x31,
+	0x20, 0x89, 0x24, 0xa8, 0x02, 0xc1, 0x41, 0x69, 0x20, 0x8a, 0x40, 0x22,
+	0x5f, 0x00, 0x40, 0x27, 0x4c, 0x30, 0x2b, 0xa8, 0x00, 0x17, 0x81, 0x30,
+	0xa1, 0x6c, 0xc1, 0x6d, 0x2c, 0xa8, 0x20, 0x8c, 0xe1, 0x6e, 0x58, 0x43,
+	0x2d, 0xa8, 0x20, 0x8d, 0x2e, 0xa8, 0x20, 0x8e, 0x30, 0xa8, 0x20, 0x8f,
+	0x31, 0xa8, 0x21, 0x8f, 0x36, 0xa8, 0x22, 0x8f, 0x38, 0xa8, 0xe6, 0x13,
+	0x81, 0x80, 0x30, 0xe9, 0x54, 0x09, 0xf0, 0x55, 0x2a, 0xf0, 0x5a, 0x26,
+	0x82, 0x3c, 0x5a, 0x23, 0x41, 0x16, 0x65, 0x71, 0x1a, 0x62, 0x59, 0x61,
+	0x40, 0x8b, 0x41, 0xa9, 0x00, 0xc2, 0x40, 0x8a, 0x42, 0xa9, 0x01, 0xc2,
+	0x40, 0x8a, 0x43, 0xa9, 0x02, 0xc2, 0x40, 0x8a, 0x44, 0xa9, 0x00, 0x13,
+	0x82, 0x30, 0x4b, 0xa9, 0x00, 0x17, 0x82, 0x30, 0x4c, 0xa9, 0x40, 0x8c,
+	0x4d, 0xa9, 0x40, 0x8d, 0x4e, 0xa9, 0x40, 0x8e, 0x50, 0xa9, 0x40, 0x8f,
+	0x51, 0xa9, 0x41, 0x8f, 0x56, 0xa9, 0x42, 0x8f, 0x58, 0xa9, 0xb9, 0x0b,
+	0x94, 0x90, 0x40, 0x26, 0x5e, 0x30, 0xf9, 0x0e, 0xb4, 0xb0, 0x6d, 0x70,
+	0x8d, 0xf0, 0x3e, 0xda, 0x9f, 0xba, 0x01, 0x12, 0x81, 0x04, 0x3a, 0xa8,
+	0x06, 0x00, 0x11, 0x3b, 0x06, 0x00, 0x11, 0x3c, 0x06, 0x00, 0x11, 0x3d,
+	0x06, 0x00, 0x40, 0x24, 0x18, 0x42, 0x00, 0x1a, 0x00, 0x13, 0x25, 0x08,
+	0x00, 0x13, 0x26, 0x08, 0x00, 0x13, 0x27, 0x08, 0x00, 0x13, 0x29, 0x08,
+	0x00, 0x13, 0x2a, 0x08, 0x00, 0x93, 0x2f, 0x18, 0x42, 0x00, 0x1c, 0x12,
+	0x81, 0x04, 0x31, 0x10, 0x00, 0x13, 0x33, 0x08, 0x00, 0x13, 0x34, 0x08,
+	0x00, 0x13, 0x35, 0x08, 0x00, 0x13, 0x36, 0x08, 0x00, 0x13, 0x3d, 0x08,
+	0x00, 0x13, 0x3e, 0x08, 0x00, 0x13, 0x3f, 0x08, 0x00, 0x13, 0x40, 0x08,
+	0x00, 0x13, 0x42, 0x08, 0x00, 0x13, 0x43, 0x08, 0x00, 0x13, 0x48, 0x08,
+	0x00, 0x13, 0x4a, 0x08, 0x00, 0x13, 0x4c, 0x08, 0x00, 0x13, 0x4d, 0x08,
+	0x00, 0x13, 0x4e, 0x08, 0x00, 0x13, 0x4f, 0x08, 0x00, 0x13, 0x56, 0x08,
+	0x00, 0x13, 0x57, 0x08, 0x00, 0x13, 0x58, 0x08, 0x00, 0x13, 0x59, 0x08,
+	0x00, 0xf3, 0x08, 0x5b, 0x18, 0x42, 0x00, 0x20, 0x8a, 0x5c, 0x18, 0x42,
+	0x00, 0x21, 0x8a, 0x61, 0x18, 0x42, 0x00, 0x22, 0x8a, 0x63, 0x18, 0x42,
+	0x00, 0xa3, 0xe2, 0x06, 0x71, 0xe0, 0x78, 0xe4, 0xc3, 0xab, 0xc1, 0x80,
+	0x4e, 0x03, 0xf7, 0x30, 0x50, 0x05, 0xfe, 0x0b, 0x2f, 0xff, 0x2a, 0xda,
+	0x80, 0xc0, 0x72, 0x09, 0x20, 0x02, 0x2a, 0xd9, 0x25, 0xdd, 0x9f, 0xbd,
+	0x00, 0x8d, 0xcb, 0x46, 0x04, 0x90, 0xe4, 0x00, 0x00, 0xb6, 0x33, 0x15,
+	0x80, 0x10, 0x01, 0xb6, 0xf4, 0x15, 0x80, 0x90, 0x88, 0xe8, 0x00, 0x1e,
+	0x05, 0x70, 0x03, 0x90, 0x54, 0xe1, 0x42, 0x1e, 0x5d, 0x90, 0x02, 0x09,
+	0xcf, 0xff, 0x53, 0x20, 0xc1, 0x00, 0x01, 0xd4, 0x05, 0xc0, 0xc3, 0xb9,
+	0x04, 0x1a, 0x42, 0x30, 0x08, 0xd9, 0x61, 0xb9, 0x01, 0x09, 0xb0, 0x0c,
+	0xf4, 0x13, 0xc1, 0xb8, 0x6e, 0x0b, 0x60, 0x01, 0x08, 0x1a, 0x02, 0x30,
+	0x1e, 0x08, 0x00, 0x00, 0x56, 0x08, 0x00, 0x01, 0x4c, 0x16, 0x00, 0x91,
+	0x0d, 0x08, 0x51, 0x01, 0x00, 0x8d, 0x00, 0xb6, 0x01, 0xb6, 0xc4, 0xc7,
+	0x40, 0x04, 0x00, 0x46, 0x0a, 0x00, 0x02, 0x0d, 0x31, 0x00, 0x16, 0x82,
+	0x3a, 0x04, 0x20, 0x5f, 0x22, 0xfe, 0x0c, 0x0a, 0x5c, 0x03, 0xc0, 0xc3,
+	0xb8, 0x0b, 0x08, 0x90, 0x01, 0x77, 0x08, 0x71, 0x00, 0x18, 0xdf, 0x9e,
+	0x00, 0xf0, 0x21, 0x16, 0x01, 0x08, 0x1e, 0x94, 0x10, 0xad, 0x71, 0x02,
+	0x1e, 0x55, 0x10, 0x29, 0xd8, 0xa0, 0xb6, 0x6c, 0x1e, 0x05, 0x12, 0x6c,
+	0x1e, 0x04, 0x10, 0x2c, 0x70, 0xc3, 0x40, 0x98, 0x00, 0x80, 0x96, 0x28,
+	0x43, 0xf2, 0x1e, 0x44, 0x90, 0xf2, 0x0e, 0x60, 0x00, 0x66, 0x1e, 0x44,
+	0x10, 0xa9, 0xd8, 0x1c, 0x00, 0x42, 0x8a, 0x20, 0x46, 0x0a, 0x08, 0x00,
+	0x11, 0x44, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x66, 0x04, 0xf0, 0x06,
+	0x60, 0x72, 0x1e, 0x5c, 0x93, 0xd0, 0x1e, 0x44, 0x93, 0x72, 0x1e, 0xdd,
+	0x90, 0x66, 0x0e, 0x60, 0x00, 0xd0, 0x1e, 0xc4, 0x92, 0x14, 0x00, 0x60,
+	0x72, 0x1e, 0xdc, 0x92, 0x46, 0xf0, 0x38, 0x0a, 0xf2, 0x05, 0x16, 0x01,
+	0x08, 0x1d, 0x94, 0x10, 0xcd, 0x71, 0x02, 0x1d, 0x55, 0x10, 0x4a, 0x23,
+	0x00, 0x12, 0x2c, 0x70, 0x8b, 0xbf, 0x46, 0x0d, 0xf0, 0x19, 0xc0, 0xb5,
+	0x6c, 0x1d, 0xc4, 0x12, 0x0a, 0x26, 0x40, 0x30, 0xf2, 0x1d, 0x44, 0x90,
+	0x66, 0x1d, 0x44, 0x10, 0x6c, 0x1d, 0xc4, 0x13, 0x7a, 0x0e, 0x60, 0x00,
+	0x18, 0x43, 0x70, 0xbf, 0x2f, 0x20, 0xc2, 0x06, 0x2c, 0x70, 0x6a, 0x0e,
+	0x60, 0x00, 0x16, 0x00, 0x02, 0x9c, 0x00, 0x32, 0x2c, 0x70, 0x5a, 0x10,
+	0x00, 0x72, 0x12, 0x88, 0xd8, 0x6c, 0x1d, 0x04, 0x10, 0x84, 0x00, 0x00,
+	0x46, 0x00, 0xf0, 0x09, 0x6c, 0x1d, 0x84, 0x17, 0x72, 0x1d, 0x9c, 0x93,
+	0xd0, 0x1d, 0x84, 0x93, 0x72, 0x1d, 0xdd, 0x90, 0xda, 0x0d, 0x60, 0x00,
+	0xd0, 0x1d, 0x84, 0x97, 0x14, 0x00, 0xc0, 0x72, 0x1d, 0x9c, 0x97, 0x0c,
+	0x70, 0x22, 0x0e, 0x60, 0x00, 0x20, 0xd9, 0x92, 0x00, 0x80, 0xf0, 0x01,
+	0x20, 0xd8, 0xba, 0x0d, 0x60, 0x00, 0xc6, 0x0a, 0x31, 0x20, 0xd8, 0xb2,
+	0x0a, 0x00, 0x51, 0x45, 0x10, 0x0c, 0x74, 0xa6, 0x0a, 0x00, 0x60, 0x05,
+	0x10, 0x0a, 0x1d, 0x9d, 0x90, 0xba, 0x05, 0x06, 0xa4, 0x0d, 0xf0, 0x05,
+	0xbd, 0xc1, 0x25, 0xd9, 0x9f, 0xb9, 0x00, 0x89, 0x3a, 0x1c, 0x02, 0x30,
+	0x33, 0x11, 0x80, 0x00, 0x3b, 0x1c, 0x02, 0x30, 0x64, 0x04, 0xf2, 0x43,
+	0x64, 0x06, 0x27, 0x88, 0xa0, 0x88, 0x6e, 0xc1, 0x29, 0x88, 0x39, 0x1c,
+	0x42, 0x30, 0x28, 0x88, 0x36, 0x1c, 0x42, 0x30, 0x2a, 0x88, 0x0c, 0x71,
+	0x37, 0x1c, 0x42, 0x30, 0xb2, 0x0d, 0x20, 0x00, 0x93, 0xc1, 0x2c, 0x70,
+	0x46, 0xc1, 0x05, 0xf0, 0x34, 0x7a, 0x0c, 0x70, 0x00, 0xb2, 0x24, 0x71,
+	0xfb, 0x09, 0xb4, 0x82, 0x98, 0xc2, 0x0c, 0xd9, 0x05, 0x29, 0x41, 0x03,
+	0x0c, 0x74, 0x35, 0x78, 0x49, 0xc0, 0x0d, 0x04, 0x20, 0x00, 0x0c, 0x70,
+	0xff, 0x03, 0x20, 0x00, 0x6f, 0x70, 0x05, 0xc0, 0x2c, 0x71, 0x34, 0x0c,
+	0x80, 0x05, 0xc1, 0x05, 0xea, 0x61, 0xba, 0xff, 0x0a, 0x28, 0x07, 0xf2,
+	0x0b, 0x47, 0xc0, 0x2f, 0x20, 0xc7, 0x06, 0x36, 0x0d, 0x20, 0x00, 0x2f,
+	0x79, 0xcb, 0x46, 0x00, 0x80, 0x7c, 0x05, 0x48, 0xc0, 0x00, 0x8e, 0x14,
+	0x70, 0xf6, 0xf2, 0x40, 0x08, 0xf1, 0x15, 0x01, 0x00, 0xe3, 0xb8, 0xf0,
+	0xf4, 0x7a, 0x08, 0x8f, 0xff, 0xed, 0x70, 0x0c, 0x70, 0x7e, 0xf0, 0x04,
+	0xc0, 0x79, 0x20, 0x80, 0x00, 0x04, 0x77, 0x4a, 0xc0, 0x04, 0xc0, 0x82,
+	0xb8, 0x15, 0x08, 0x31, 0x01, 0xff, 0xd9, 0x28, 0x01, 0xf0, 0x16, 0x0a,
+	0xda, 0x0c, 0x0f, 0xff, 0x9e, 0x08, 0x40, 0x01, 0x01, 0x8e, 0xad, 0x71,
+	0x2c, 0x70, 0x43, 0xc0, 0x07, 0xc0, 0x4c, 0x70, 0x6c, 0x72, 0x0f, 0x78,
+	0x4b, 0xc0, 0x42, 0xc0, 0x0a, 0xc0, 0x41, 0xc5, 0x0f, 0x78, 0x4c, 0xc0,
+	0x68, 0x07, 0xf0, 0x07, 0x44, 0x20, 0x00, 0x08, 0x45, 0x20, 0x80, 0x01,
+	0x40, 0xc0, 0x9e, 0x0d, 0x2f, 0xff, 0xff, 0xd8, 0x01, 0x8e, 0x42, 0xc7,
+	0x41, 0xc5, 0xa4, 0x0b, 0x01, 0xec, 0x08, 0x12, 0x72, 0x14, 0x07, 0x73,
+	0xbc, 0x04, 0xc5, 0xb8, 0x40, 0xc0, 0x7a, 0x22, 0x00, 0x00, 0x1a, 0x00,
+	0xe3, 0x43, 0xc0, 0x0b, 0xc0, 0x6c, 0x72, 0x41, 0xc5, 0x42, 0xc0, 0x0c,
+	0xc0, 0x1d, 0x78, 0x46, 0x00, 0x49, 0x05, 0x40, 0xc0, 0x56, 0x24, 0x00,
+	0x60, 0x0a, 0xc0, 0x6c, 0x72, 0x42, 0xc7, 0x3c, 0x00, 0x80, 0xff, 0xd8,
+	0x3e, 0x0d, 0x2f, 0xff, 0x41, 0xc5, 0x9e, 0x00, 0x80, 0x10, 0x27, 0xa2,
+	0x0c, 0x60, 0x00, 0x0a, 0xd9, 0x80, 0x00, 0xf0, 0x07, 0x04, 0x77, 0x0f,
+	0x7d, 0xdd, 0xf8, 0x42, 0xc7, 0x41, 0xc7, 0x40, 0xc7, 0x1a, 0x0d, 0x2f,
+	0xff, 0x43, 0xc5, 0xda, 0xf8, 0x43, 0xc5, 0x10, 0x00, 0xa0, 0x0e, 0x0d,
+	0x2f, 0xff, 0x40, 0xc7, 0x04, 0xc0, 0x63, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0x7f, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x70,
+	0x0e, 0x00, 0x00, 0xf0, 0x3f, 0x11, 0x08, 0x95, 0x00, 0x7a, 0x0f, 0x00,
+	0x01, 0x0c, 0x70, 0x9e, 0x0c, 0x2f, 0xff, 0x2c, 0x71, 0x04, 0xc0, 0x04,
+	0x71, 0x44, 0xc0, 0x04, 0xc0, 0x14, 0x75, 0x02, 0x07, 0xe5, 0xff, 0xff,
+	0xd9, 0xc3, 0x40, 0x00, 0x00, 0x00, 0x0a, 0xea, 0x0b, 0x0f, 0xff, 0xae,
+	0x0f, 0x00, 0x01, 0x01, 0x8e, 0x2c, 0x70, 0xed, 0x71, 0x43, 0xc0, 0xff,
+	0xd8, 0x4c, 0x70, 0x18, 0xdb, 0x28, 0x45, 0x42, 0xc1, 0x41, 0xc7, 0xc2,
+	0x0c, 0x2f, 0xff, 0x40, 0xc1, 0x06, 0x0f, 0x2f, 0xff, 0xff, 0xd8, 0x20,
+	0x00, 0xf0, 0x05, 0x4c, 0x70, 0x43, 0xc0, 0x07, 0xc0, 0x6c, 0x72, 0x41,
+	0xc7, 0x0f, 0x78, 0x44, 0xc0, 0x42, 0xc0, 0x20, 0xd8, 0x40, 0xc0, 0x5c,
+	0x00, 0x06, 0x1e, 0x00, 0xf4, 0x01, 0xff, 0xd8, 0x6c, 0x72, 0x42, 0xc5,
+	0x41, 0xc7, 0x86, 0x0c, 0x2f, 0xff, 0x00, 0x1c, 0xc1, 0x30, 0x36, 0x00,
+	0x11, 0x04, 0x36, 0x00, 0x51, 0x42, 0xc0, 0xff, 0xd8, 0x6e, 0x1a, 0x00,
+	0x24, 0x81, 0x34, 0x1a, 0x00, 0x04, 0x32, 0x00, 0x10, 0x56, 0x6c, 0x00,
+	0x16, 0xc5, 0x16, 0x00, 0x20, 0x08, 0xdb, 0x48, 0x00, 0x11, 0x3e, 0x16,
+	0x00, 0x28, 0x6a, 0x0e, 0x82, 0x00, 0x31, 0xff, 0xd8, 0x18, 0x1c, 0x00,
+	0x11, 0x22, 0x1c, 0x00, 0xf1, 0x32, 0x9a, 0x0e, 0x00, 0x01, 0x7f, 0xf0,
+	0x0c, 0x70, 0x22, 0x0b, 0x2f, 0xff, 0xff, 0xd9, 0x07, 0xc0, 0xad, 0x70,
+	0x4c, 0x73, 0x5a, 0x20, 0x01, 0x01, 0x22, 0xdb, 0x43, 0xc5, 0x40, 0xc5,
+	0x25, 0x78, 0x0f, 0x7e, 0x20, 0xd8, 0x41, 0xc0, 0xff, 0xd8, 0x2c, 0x70,
+	0x02, 0x0e, 0x2f, 0xff, 0x42, 0xc6, 0x28, 0xd8, 0x41, 0xc0, 0x8c, 0xf8,
+	0x43, 0xc5, 0x42, 0xc6, 0xf2, 0x0d, 0x2f, 0xff, 0x40, 0xc5, 0x89, 0x0c,
+	0x00, 0x50, 0x04, 0x1c, 0xc1, 0x33, 0xe2, 0x10, 0x00, 0x23, 0xc0, 0x85,
+	0x10, 0x00, 0x30, 0x01, 0x35, 0xd2, 0x10, 0x00, 0x70, 0xc5, 0xff, 0xd8,
+	0x80, 0xd9, 0x4c, 0x73, 0x4e, 0x00, 0x71, 0x42, 0xc6, 0x04, 0x1c, 0x81,
+	0x30, 0xbe, 0x16, 0x00, 0x40, 0x0c, 0x70, 0x4a, 0x0b, 0x54, 0x01, 0xf0,
+	0x1b, 0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x04, 0x00, 0xe0, 0xda, 0x1a,
+	0x20, 0x81, 0x0f, 0x20, 0x00, 0x00, 0x00, 0xc3, 0x40, 0x08, 0x90, 0x00,
+	0x01, 0x05, 0x21, 0x03, 0x00, 0x04, 0x72, 0x25, 0x78, 0x40, 0xb3, 0x00,
+	0x18, 0x85, 0x04, 0x0c, 0x70, 0x82, 0x0a, 0x9e, 0x00, 0x00, 0x3c, 0x00,
+	0xa0, 0xff, 0xd8, 0x07, 0xc0, 0x2c, 0x70, 0x90, 0xb9, 0x0f, 0x78, 0x0e,
+	0x01, 0xa0, 0x4c, 0x71, 0x6c, 0x74, 0x43, 0xc5, 0x41, 0xc5, 0x56, 0x0b,
+	0x8c, 0x00, 0x80, 0x0c, 0xd9, 0xff, 0xd8, 0x8d, 0xb9, 0x4c, 0x73, 0x14,
+	0x00, 0x51, 0x42, 0xc6, 0x41, 0xc5, 0x42, 0x16, 0x00, 0x20, 0x6a, 0x0d,
+	0xfe, 0x00, 0x01, 0x88, 0x00, 0x11, 0x75, 0x1a, 0x00, 0x41, 0xc5, 0x41,
+	0xc5, 0x26, 0x1a, 0x00, 0xf5, 0x8c, 0x50, 0xd8, 0x49, 0xc0, 0x8a, 0x21,
+	0xc7, 0x0f, 0xc3, 0x40, 0x03, 0x90, 0x48, 0xe0, 0x20, 0xb0, 0x04, 0x18,
+	0x05, 0x00, 0x40, 0x24, 0x80, 0x3e, 0x32, 0x20, 0xc1, 0x06, 0x07, 0xc0,
+	0x2b, 0x78, 0x64, 0xf2, 0x09, 0xc0, 0x2c, 0x70, 0x9e, 0x0a, 0x2f, 0xff,
+	0x10, 0x78, 0x0c, 0x70, 0x42, 0x0a, 0x60, 0x00, 0x1e, 0xd9, 0x40, 0x24,
+	0x80, 0x3d, 0x32, 0x20, 0xcb, 0x06, 0x8e, 0xc0, 0x32, 0x20, 0xcd, 0x06,
+	0xa1, 0x41, 0x0f, 0xf0, 0x1a, 0x21, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x20,
+	0x34, 0x7a, 0x24, 0x71, 0x05, 0x20, 0x80, 0x0f, 0x02, 0x90, 0x54, 0x00,
+	0x00, 0x90, 0x0f, 0x78, 0x00, 0xb2, 0xe9, 0x0b, 0x65, 0x90, 0x8f, 0xc2,
+	0x2c, 0x70, 0x4c, 0x70, 0x34, 0xf0, 0xf4, 0x23, 0x4c, 0x03, 0x08, 0xc0,
+	0xb4, 0x7b, 0x80, 0xbc, 0x80, 0xb3, 0x86, 0xe8, 0x8f, 0xc0, 0xf4, 0x20,
+	0x40, 0x03, 0x0f, 0xe8, 0x5a, 0x23, 0x0e, 0x34, 0x05, 0xc0, 0x16, 0x7e,
+	0x38, 0x66, 0x00, 0x20, 0x80, 0x0f, 0x00, 0x80, 0x44, 0x06, 0xa0, 0xa8,
+	0x24, 0x71, 0x08, 0xc0, 0x17, 0x1a, 0x00, 0x13, 0x58, 0x1a, 0x00, 0xf2,
+	0x0d, 0x24, 0x06, 0xa0, 0xa8, 0x44, 0x71, 0x08, 0xc0, 0x8f, 0xe8, 0x05,
+	0xc0, 0x79, 0x20, 0x00, 0x00, 0x1b, 0x78, 0x1b, 0x78, 0x04, 0x74, 0x05,
+	0x7c, 0x80, 0xb3, 0x05, 0xf0, 0x4e, 0x00, 0xa0, 0x67, 0xe8, 0xa5, 0x71,
+	0x9b, 0x0b, 0x65, 0x93, 0x98, 0xc3, 0x9a, 0x02, 0xf2, 0x1b, 0xc4, 0x09,
+	0xce, 0x09, 0x0f, 0xff, 0x3e, 0x09, 0x0f, 0xff, 0x67, 0x71, 0x77, 0x72,
+	0x08, 0x04, 0xc5, 0xff, 0x05, 0xc0, 0x04, 0x71, 0x45, 0xc0, 0x05, 0xc0,
+	0x14, 0x71, 0xf6, 0x03, 0xce, 0xff, 0x1a, 0xf0, 0x06, 0xc0, 0xf4, 0x21,
+	0x01, 0x00, 0x13, 0xe9, 0x84, 0x01, 0xb0, 0x19, 0x00, 0x8d, 0xe8, 0x06,
+	0xc0, 0x44, 0x21, 0x01, 0x03, 0x1a, 0x8a, 0x00, 0x33, 0x00, 0x00, 0x20,
+	0xcc, 0x00, 0xf2, 0x0c, 0x01, 0x20, 0xb0, 0x06, 0xc0, 0x04, 0x71, 0x46,
+	0xc0, 0x06, 0xc0, 0xd1, 0x08, 0xb4, 0x82, 0x98, 0xc1, 0xc3, 0x40, 0x00,
+	0x80, 0x7c, 0x05, 0x00, 0x88, 0x08, 0xe8, 0x3a, 0x00, 0xe0, 0x01, 0x00,
+	0xe3, 0xb8, 0x98, 0x0d, 0x41, 0xff, 0x0c, 0x70, 0x00, 0x1e, 0x05, 0x70,
+	0x4a, 0x01, 0xe0, 0x1a, 0x09, 0x20, 0x00, 0x93, 0xc1, 0xbd, 0xc0, 0x04,
+	0x14, 0x1b, 0x34, 0xc6, 0xc6, 0x3c, 0x02, 0x00, 0x02, 0x02, 0x41, 0xe0,
+	0x7e, 0xe0, 0x78, 0x0c, 0x00, 0x30, 0x70, 0x6c, 0x72, 0x0c, 0x00, 0xf0,
+	0x35, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa2, 0xc1, 0x28, 0x47, 0x08,
+	0x46, 0x20, 0x40, 0x2c, 0x73, 0x41, 0xc3, 0xda, 0x0a, 0xe0, 0x00, 0x58,
+	0x43, 0x0c, 0x71, 0x08, 0x45, 0x44, 0x26, 0xc0, 0x17, 0x05, 0xe8, 0x61,
+	0xb8, 0xff, 0x08, 0x31, 0x80, 0xbb, 0x7d, 0x15, 0x0b, 0x31, 0x30, 0x5a,
+	0x25, 0x0d, 0x11, 0xe1, 0x40, 0x2c, 0x73, 0xd6, 0x0b, 0x2f, 0xff, 0xbf,
+	0xda, 0x01, 0xc0, 0x0f, 0x25, 0x9b, 0x13, 0x87, 0xe8, 0x12, 0x00, 0x62,
+	0xc2, 0x0b, 0x2f, 0xff, 0x7f, 0xda, 0x8c, 0x00, 0xf5, 0x23, 0x65, 0x06,
+	0x5f, 0x26, 0x4d, 0x16, 0x4c, 0x70, 0x5f, 0x20, 0x80, 0x0c, 0x8a, 0x23,
+	0xff, 0x0d, 0x00, 0x1c, 0xc1, 0x3f, 0xf8, 0x60, 0xb9, 0x60, 0xba, 0x0c,
+	0xa0, 0x01, 0x2f, 0x20, 0xc7, 0x06, 0x86, 0x0a, 0x8f, 0xff, 0x8e, 0x0a,
+	0xaf, 0xff, 0x00, 0x43, 0x00, 0x41, 0x1a, 0x09, 0x20, 0x01, 0x60, 0x40,
+	0x38, 0x00, 0xe1, 0x20, 0x80, 0x0c, 0xf8, 0x60, 0xb8, 0x60, 0x03, 0x10,
+	0xc1, 0x00, 0x3d, 0x78, 0x1d, 0x02, 0x00, 0xf3, 0x0c, 0x44, 0x20, 0x00,
+	0x01, 0x34, 0x70, 0xc5, 0x20, 0xab, 0x04, 0x00, 0x1e, 0x04, 0x70, 0x0e,
+	0x90, 0x22, 0x00, 0xe1, 0x40, 0x62, 0x0f, 0xa0, 0x00, 0x2c, 0x73, 0xa2,
+	0xdc, 0x00, 0x22, 0x1b, 0x7a, 0x40, 0x00, 0xf6, 0x05, 0x1c, 0x00, 0xc4,
+	0xba, 0x05, 0xea, 0x61, 0xba, 0xff, 0x0a, 0x31, 0x80, 0x1d, 0x78, 0x0f,
+	0x78, 0x44, 0x21, 0xc2, 0x07, 0x10, 0x00, 0xb1, 0xe0, 0x7f, 0xc0, 0xb8,
+	0xe0, 0x78, 0xe2, 0xc0, 0x00, 0x16, 0x82, 0xee, 0x02, 0x51, 0x14, 0x70,
+	0x1a, 0x22, 0x83, 0xee, 0x02, 0xf0, 0x3c, 0x05, 0x23, 0x82, 0x0f, 0x02,
+	0x90, 0x86, 0x00, 0x40, 0x92, 0x05, 0x23, 0x83, 0x0f, 0x03, 0x90, 0x86,
+	0xfe, 0xc4, 0x22, 0x81, 0x0f, 0x00, 0x00, 0xff, 0xbf, 0x03, 0xf2, 0x8e,
+	0xba, 0xad, 0x70, 0x40, 0xb3, 0x1d, 0xf0, 0x1a, 0x25, 0x82, 0x1f, 0x00,
+	0x00, 0x00, 0x10, 0x05, 0x22, 0x82, 0x0f, 0x01, 0x00, 0x4a, 0x00, 0x5b,
+	0x7a, 0x05, 0x22, 0x83, 0x0f, 0x00, 0x90, 0x00, 0x00, 0x0b, 0xe8, 0x40,
+	0x93, 0x14, 0x21, 0x4c, 0x03, 0x40, 0xb4, 0x04, 0x22, 0x82, 0x36, 0x00,
+	0xf2, 0x32, 0xfb, 0x03, 0xf0, 0xf4, 0x21, 0x42, 0x03, 0x40, 0xb3, 0xa5,
+	0x71, 0xcd, 0x0d, 0x94, 0x92, 0xc2, 0xc4, 0xe6, 0xc2, 0x6c, 0x70, 0xc3,
+	0x41, 0x00, 0x80, 0x6b, 0x06, 0x24, 0xdd, 0x60, 0xa9, 0x9f, 0xbd, 0x00,
+	0x8d, 0x07, 0xe0, 0x1d, 0x7a, 0x5d, 0x7a, 0x5d, 0x7a, 0x09, 0x6a, 0x01,
+	0xa9, 0x34, 0x15, 0x8c, 0x10, 0x0e, 0xec, 0x04, 0xca, 0x1d, 0x7a, 0x42,
+	0xa9, 0x33, 0x15, 0x80, 0x10, 0x07, 0xe0, 0xf8, 0x00, 0xf2, 0x25, 0x58,
+	0x60, 0x04, 0x77, 0x03, 0xf0, 0x42, 0xa9, 0x03, 0xa9, 0x1e, 0xf0, 0x05,
+	0xee, 0x33, 0x15, 0x8f, 0x10, 0x02, 0xf0, 0xe0, 0x8d, 0xcf, 0x78, 0x16,
+	0x0f, 0xef, 0xff, 0x6f, 0x79, 0x04, 0xe8, 0x07, 0x6f, 0x1d, 0x79, 0x05,
+	0xf0, 0x1f, 0x4f, 0x1d, 0x79, 0x3d, 0x79, 0x3d, 0x79, 0x14, 0x23, 0x80,
+	0x03, 0x3d, 0x79, 0xc0, 0x02, 0xf0, 0x2f, 0x20, 0x06, 0x20, 0xa8, 0xc5,
+	0x71, 0xcf, 0x0e, 0x94, 0x90, 0x64, 0x71, 0xfb, 0x0b, 0xb4, 0x80, 0xcd,
+	0x70, 0xc6, 0xc6, 0xf1, 0xc0, 0x26, 0x0a, 0x40, 0x00, 0xd1, 0xc0, 0xe0,
+	0x7f, 0x0c, 0x70, 0x00, 0x16, 0x01, 0x71, 0x00, 0x80, 0x06, 0x00, 0x0c,
+	0x79, 0x85, 0x29, 0x1f, 0x04, 0xe0, 0x7f, 0x01, 0x69, 0xe0, 0x78, 0xe4,
+	0xc2, 0x00, 0x42, 0x2a, 0x08, 0xaf, 0xff, 0x20, 0x40, 0xaa, 0x00, 0xf2,
+	0x01, 0x65, 0x06, 0x20, 0x89, 0x07, 0xe9, 0x00, 0x16, 0x8d, 0x70, 0x00,
+	0x80, 0x58, 0x00, 0x05, 0xf0, 0x0a, 0x00, 0xf0, 0x23, 0x25, 0x00, 0x6c,
+	0x70, 0x8d, 0x70, 0x24, 0xf0, 0x44, 0x21, 0xce, 0x07, 0x00, 0x41, 0x06,
+	0xee, 0x61, 0xbe, 0x01, 0x0e, 0x31, 0x10, 0x3d, 0x79, 0xc1, 0xb9, 0x33,
+	0x09, 0xa1, 0x00, 0x2c, 0x71, 0x44, 0x23, 0xce, 0x07, 0x05, 0xee, 0x61,
+	0xbe, 0xff, 0x0e, 0x31, 0x90, 0x3b, 0x79, 0xab, 0x79, 0x10, 0xd9, 0x12,
+	0x00, 0x44, 0xc0, 0x24, 0x62, 0x10, 0x2c, 0x00, 0x00, 0x16, 0x00, 0x00,
+	0x10, 0x00, 0xf2, 0x93, 0x64, 0x71, 0xbd, 0x0b, 0x34, 0x81, 0x7b, 0x79,
+	0x81, 0x40, 0xc4, 0xc6, 0xe0, 0x78, 0x42, 0x20, 0x01, 0x07, 0x39, 0x09,
+	0x54, 0x04, 0x89, 0x08, 0x30, 0x0c, 0x1a, 0xd9, 0x85, 0x08, 0x70, 0x0d,
+	0x0f, 0xd9, 0x7d, 0x08, 0x30, 0x0f, 0x18, 0xd9, 0xc5, 0xe0, 0x27, 0xf2,
+	0xd0, 0xe0, 0x27, 0xf2, 0xe0, 0xe0, 0x27, 0xf2, 0xf8, 0xe0, 0x27, 0xf2,
+	0x8c, 0x20, 0x03, 0x8c, 0x2c, 0x72, 0x30, 0xf2, 0x8c, 0x20, 0x02, 0x88,
+	0x19, 0xf4, 0x2c, 0x73, 0x2c, 0xf0, 0x25, 0x20, 0x40, 0x00, 0x11, 0xf0,
+	0x13, 0xf0, 0x1b, 0xf0, 0x11, 0xf0, 0x1b, 0xf0, 0x0f, 0xf0, 0x1b, 0xf0,
+	0x0d, 0xf0, 0x0b, 0xf0, 0x1b, 0xf0, 0x09, 0xf0, 0x09, 0xf0, 0x19, 0xf0,
+	0x07, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x17, 0xf0, 0x3f, 0xd9, 0x16, 0xf0,
+	0x2c, 0x70, 0x14, 0xf0, 0x0b, 0xd9, 0x12, 0xf0, 0x0a, 0xd9, 0x10, 0xf0,
+	0x07, 0xd9, 0x0e, 0xf0, 0x08, 0xd9, 0x0c, 0xf0, 0x3e, 0xd9, 0x0a, 0xf0,
+	0x3b, 0xd9, 0x08, 0xf0, 0x3a, 0xd9, 0x06, 0xf0, 0x1f, 0xd9, 0x04, 0xf0,
+	0x38, 0xd9, 0x02, 0xf0, 0x1b, 0xd9, 0xe0, 0x7f, 0x20, 0x40, 0x18, 0x03,
+	0xf0, 0x73, 0xb6, 0xc1, 0x53, 0xc2, 0x28, 0x43, 0x52, 0xc0, 0x20, 0x40,
+	0x2c, 0x70, 0xee, 0x0a, 0x2f, 0xff, 0x4c, 0x73, 0x54, 0xc0, 0x61, 0x40,
+	0x2c, 0x74, 0xe2, 0x0a, 0x2f, 0xff, 0x08, 0xda, 0x00, 0x16, 0x8e, 0x70,
+	0x00, 0x80, 0x67, 0x06, 0xed, 0x70, 0x55, 0xc0, 0x3c, 0xf0, 0x15, 0xc0,
+	0x14, 0xc1, 0xca, 0x20, 0x46, 0x00, 0x37, 0xe8, 0xef, 0x7d, 0xbf, 0x60,
+	0x12, 0x1a, 0x98, 0x30, 0xef, 0x7b, 0x81, 0xc0, 0x2c, 0x72, 0xa1, 0x42,
+	0xf6, 0x0c, 0x6f, 0xff, 0x78, 0x43, 0x12, 0x12, 0x81, 0x30, 0x13, 0xc2,
+	0xba, 0x09, 0x20, 0x01, 0x81, 0xc0, 0x12, 0xc8, 0x03, 0x12, 0x81, 0x30,
+	0x2b, 0x08, 0x44, 0x00, 0x02, 0x12, 0x81, 0x30, 0x23, 0x09, 0x04, 0x00,
+	0x31, 0xc0, 0x43, 0x14, 0xc3, 0x30, 0x42, 0x14, 0x82, 0x30, 0x40, 0xc0,
+	0xc3, 0x41, 0x69, 0x00, 0x03, 0x00, 0xfa, 0x0a, 0x2f, 0xff, 0x0c, 0x74,
+	0xd0, 0x05, 0x60, 0x81, 0xc0, 0x54, 0x24, 0x40, 0x38, 0x4a, 0x00, 0xf0,
+	0x03, 0xa6, 0x08, 0xa0, 0x01, 0x63, 0x43, 0x12, 0xc0, 0x2c, 0x71, 0xde,
+	0x0d, 0x20, 0x01, 0x81, 0xc2, 0xc5, 0x71, 0x08, 0x04, 0xf3, 0x00, 0x67,
+	0x06, 0x01, 0x88, 0xcf, 0x79, 0x83, 0x08, 0x65, 0x80, 0x2f, 0x22, 0x42,
+	0x80, 0xb6, 0x16, 0x03, 0x22, 0xe0, 0x78, 0xc4, 0x00, 0x31, 0xb7, 0xc1,
+	0x56, 0x3a, 0x06, 0x11, 0x2e, 0xc0, 0x00, 0x71, 0x08, 0x45, 0xff, 0xd8,
+	0x2c, 0x74, 0x22, 0xc0, 0x00, 0x80, 0xba, 0x60, 0x06, 0xca, 0x4f, 0x79,
+	0xdb, 0x43, 0xc4, 0x00, 0xf0, 0x45, 0x2a, 0x78, 0x52, 0xc0, 0x5b, 0x78,
+	0x53, 0xc0, 0x00, 0x16, 0xc0, 0x70, 0x00, 0x80, 0x1e, 0x00, 0x14, 0x70,
+	0x0c, 0x74, 0x54, 0xc0, 0x48, 0xf6, 0x01, 0x13, 0x80, 0x30, 0x04, 0x71,
+	0x54, 0xc0, 0x12, 0xc0, 0x53, 0xc0, 0x00, 0x13, 0x8f, 0x30, 0x2c, 0x70,
+	0x56, 0xf0, 0x13, 0xc0, 0x12, 0xc3, 0x0f, 0x7a, 0xb8, 0x62, 0x6f, 0x7e,
+	0xd1, 0x70, 0x97, 0x0a, 0x30, 0x00, 0xca, 0x26, 0x05, 0x10, 0xfd, 0x78,
+	0x52, 0x50, 0xcf, 0x78, 0x55, 0xc0, 0x15, 0xc3, 0x81, 0xc0, 0x2c, 0x71,
+	0x06, 0x0c, 0x6f, 0xff, 0xa1, 0x42, 0xf2, 0x00, 0x82, 0x81, 0xc0, 0xca,
+	0x08, 0x20, 0x01, 0x4c, 0x70, 0xf2, 0x00, 0x13, 0x2d, 0xf2, 0x00, 0x1d,
+	0x25, 0xf2, 0x00, 0x51, 0x70, 0x00, 0x03, 0x00, 0x06, 0xf2, 0x00, 0x81,
+	0xf2, 0x0c, 0x2f, 0xff, 0x81, 0xc0, 0x15, 0xc3, 0xf4, 0x00, 0xf0, 0x2e,
+	0x71, 0xb2, 0x0f, 0x60, 0x01, 0xa1, 0x42, 0x16, 0xc0, 0xca, 0x0d, 0x6f,
+	0xff, 0x2c, 0x70, 0x43, 0x14, 0x81, 0x30, 0x81, 0xc4, 0x31, 0xc3, 0x0f,
+	0xe1, 0x2f, 0x7a, 0x54, 0x7c, 0x21, 0x8c, 0x62, 0x79, 0x2f, 0x7a, 0x20,
+	0x8c, 0x31, 0x4b, 0x2f, 0x79, 0x09, 0x21, 0x81, 0x00, 0x41, 0x88, 0x09,
+	0x09, 0x85, 0x00, 0x21, 0xa8, 0xc1, 0x41, 0x14, 0xc0, 0x0f, 0x78, 0x1f,
+	0x67, 0xbc, 0x00, 0x93, 0xef, 0x7f, 0x55, 0x08, 0xe5, 0x83, 0x2f, 0x7d,
+	0xb7, 0x16, 0x01, 0xf2, 0x1d, 0x4a, 0x26, 0x00, 0x30, 0x10, 0xf0, 0x5a,
+	0x26, 0x83, 0x3c, 0x7c, 0x60, 0x5a, 0x23, 0x43, 0x16, 0x65, 0x71, 0x9b,
+	0x63, 0x3b, 0x63, 0x80, 0x8b, 0x45, 0x7c, 0x80, 0xab, 0xeb, 0x0b, 0x94,
+	0x90, 0x40, 0x26, 0x5e, 0x30, 0xf9, 0x0e, 0xb4, 0xb0, 0x6d, 0x70, 0xe0,
+	0x7e, 0x40, 0x01, 0xf3, 0x02, 0xbb, 0xc1, 0xfe, 0x09, 0xaf, 0xff, 0x82,
+	0xc0, 0x82, 0xc0, 0x0d, 0xd9, 0xc6, 0x0f, 0xef, 0xff, 0xc8, 0xe6, 0x04,
+	0x60, 0x1b, 0x00, 0x97, 0x08, 0x1e, 0x00, 0x80, 0x01, 0xa2, 0x65, 0x06,
+	0x0e, 0x88, 0x8b, 0x08, 0x30, 0x00, 0x4b, 0xdb, 0x0e, 0x00, 0x22, 0x8d,
+	0x88, 0x08, 0x00, 0x13, 0xac, 0x08, 0x00, 0x13, 0xcb, 0x08, 0x00, 0x73,
+	0x2a, 0x88, 0x9f, 0xbb, 0x01, 0x1b, 0x52, 0x34, 0x00, 0x13, 0xeb, 0x16,
+	0x00, 0xf2, 0x11, 0xe0, 0xab, 0x4c, 0x88, 0x9a, 0x27, 0x04, 0x10, 0x32,
+	0x1b, 0x82, 0x00, 0x65, 0xc1, 0x2d, 0x1c, 0x82, 0x33, 0x46, 0x1c, 0x42,
+	0x33, 0x5f, 0x1c, 0x02, 0x33, 0xb8, 0x13, 0x80, 0x80, 0x25, 0x7f, 0x90,
+	0x03, 0xe0, 0x5f, 0x20, 0x8d, 0x01, 0xcb, 0x46, 0x12, 0x00, 0x10, 0x03,
+	0x2d, 0x89, 0xcb, 0x44, 0x78, 0x04, 0xf0, 0x29, 0xd8, 0x65, 0x85, 0x78,
+	0xe0, 0xb0, 0x33, 0x1b, 0x42, 0x00, 0x9a, 0x21, 0x04, 0x00, 0x02, 0x6e,
+	0xb8, 0x60, 0x85, 0x78, 0x45, 0x79, 0x20, 0xb0, 0xff, 0xd8, 0x40, 0xc0,
+	0x82, 0xc0, 0x2c, 0x71, 0xc3, 0x42, 0x40, 0x00, 0x00, 0x58, 0x92, 0x0b,
+	0xa0, 0x01, 0x6c, 0x70, 0x1e, 0x0b, 0x00, 0x00, 0x7a, 0x08, 0x0f, 0xff,
+	0x52, 0x0b, 0x40, 0x00, 0x22, 0x06, 0xf3, 0x10, 0x04, 0x70, 0x04, 0x90,
+	0xdc, 0x00, 0x6f, 0x25, 0xc3, 0x1c, 0x00, 0x8d, 0xa4, 0xe8, 0x2c, 0x70,
+	0x2f, 0x78, 0x00, 0x1e, 0x42, 0x70, 0x00, 0x80, 0x65, 0x06, 0x39, 0x08,
+	0x95, 0x00, 0x12, 0x54, 0x06, 0x10, 0x58, 0x06, 0x02, 0xb2, 0x71, 0x0a,
+	0xf2, 0x01, 0x69, 0x36, 0x0d, 0x2f, 0xff, 0x0f, 0x78, 0x66, 0x05, 0x62,
+	0x65, 0x06, 0x21, 0x68, 0xe9, 0xf1, 0x0c, 0x00, 0x10, 0x25, 0x22, 0x00,
+	0xb2, 0x70, 0xf0, 0xf5, 0xf8, 0xf1, 0x12, 0x0d, 0x2f, 0xff, 0x0c, 0x73,
+	0xac, 0x00, 0x71, 0x0c, 0x70, 0x01, 0xa9, 0x00, 0x1e, 0x02, 0x50, 0x00,
+	0xf4, 0x01, 0x00, 0x8d, 0x14, 0x70, 0xb5, 0xf4, 0xc3, 0x41, 0x04, 0x90,
+	0x30, 0x00, 0xb4, 0x11, 0x02, 0x05, 0x38, 0x00, 0xc2, 0x41, 0xc0, 0x0d,
+	0x0a, 0x71, 0x01, 0x00, 0xb1, 0x01, 0xc0, 0x06, 0xf0, 0x14, 0x00, 0xc2,
+	0x58, 0x00, 0x01, 0xb1, 0x01, 0xc0, 0x6d, 0x08, 0x30, 0x00, 0x6f, 0x71,
+	0x12, 0x00, 0x42, 0x32, 0x00, 0xe3, 0xb8, 0x4a, 0x01, 0xf0, 0x14, 0xe6,
+	0x88, 0x01, 0xc0, 0xca, 0x23, 0xa1, 0x30, 0x44, 0x20, 0x8e, 0x00, 0x44,
+	0x20, 0x4d, 0x00, 0x1d, 0xf0, 0x01, 0xc1, 0x9a, 0x20, 0x04, 0x00, 0xc1,
+	0xb9, 0x05, 0x79, 0xc1, 0x40, 0x49, 0xf8, 0x1a, 0x27, 0x80, 0x9e, 0x05,
+	0xf1, 0x0b, 0x20, 0x4c, 0xf8, 0x07, 0xed, 0xef, 0x79, 0x0c, 0x70, 0x63,
+	0x42, 0x82, 0x08, 0x6f, 0xff, 0x6c, 0x71, 0x08, 0xee, 0xef, 0x79, 0x0c,
+	0x71, 0x63, 0x42, 0x76, 0x0e, 0x00, 0x11, 0xe5, 0x2e, 0x03, 0xa2, 0x65,
+	0x06, 0x07, 0x88, 0xc5, 0x08, 0xe5, 0x83, 0xa1, 0x40, 0xd6, 0x04, 0x64,
+	0x58, 0x00, 0x79, 0x0d, 0x30, 0x10, 0x74, 0x00, 0x64, 0x65, 0x00, 0x44,
+	0x25, 0x8e, 0x10, 0x78, 0x00, 0x21, 0x08, 0x88, 0x76, 0x00, 0x70, 0x25,
+	0x4f, 0x10, 0x41, 0xc0, 0x22, 0xf0, 0x72, 0x00, 0x40, 0x53, 0x25, 0x41,
+	0x10, 0x74, 0x00, 0x44, 0x2c, 0xf8, 0x01, 0xc0, 0xa4, 0x07, 0xf4, 0x05,
+	0x2e, 0xf8, 0x09, 0xef, 0x01, 0xc0, 0x63, 0x42, 0x6c, 0x71, 0x0f, 0x79,
+	0x0a, 0x08, 0x6f, 0xff, 0x0c, 0x70, 0x09, 0xee, 0x10, 0x00, 0xc2, 0xfa,
+	0x0f, 0x2f, 0xff, 0x0c, 0x71, 0x01, 0xc0, 0x04, 0x71, 0x41, 0xc0, 0xcc,
+	0x00, 0xa2, 0x29, 0x88, 0x01, 0xc0, 0xb9, 0x09, 0x25, 0x80, 0xe1, 0x40,
+	0x40, 0x04, 0xf1, 0x09, 0x04, 0x00, 0x76, 0x0b, 0x4f, 0xff, 0x7e, 0x0b,
+	0x6f, 0xff, 0x08, 0x45, 0x00, 0x41, 0x0a, 0x0a, 0xe0, 0x00, 0xa1, 0x40,
+	0x1a, 0x26, 0x8c, 0x1f, 0x88, 0x09, 0xf0, 0x04, 0x43, 0x08, 0x90, 0xea,
+	0x01, 0x00, 0x93, 0xcb, 0x45, 0x12, 0x90, 0x02, 0x04, 0x05, 0x24, 0x42,
+	0x13, 0x04, 0x20, 0x9a, 0x06, 0xf0, 0x09, 0x00, 0x3f, 0x20, 0xb2, 0x44,
+	0x6d, 0x85, 0x7a, 0x96, 0x21, 0x06, 0x00, 0x20, 0xb2, 0x21, 0x93, 0x02,
+	0x6d, 0x85, 0x78, 0xc5, 0xb9, 0x20, 0xb0, 0x44, 0x09, 0xd3, 0x74, 0xe1,
+	0x2c, 0x70, 0x20, 0xb0, 0xca, 0x0c, 0x2f, 0xff, 0x21, 0xb0, 0xbb, 0xf6,
+	0x02, 0x20, 0xe0, 0x78, 0xbc, 0x00, 0xc0, 0x05, 0x79, 0x63, 0x40, 0x9a,
+	0x20, 0x10, 0x00, 0x05, 0x21, 0x02, 0x00, 0xfc, 0x07, 0x30, 0x05, 0x20,
+	0x81, 0x28, 0x09, 0xf1, 0x22, 0x01, 0x00, 0x91, 0x45, 0x78, 0x00, 0xb1,
+	0xe0, 0x7e, 0xe4, 0xc2, 0xa4, 0xc1, 0x08, 0x46, 0x0c, 0x70, 0x9a, 0x08,
+	0xef, 0xfe, 0xff, 0xd9, 0x00, 0x12, 0x83, 0x30, 0x2c, 0x70, 0xff, 0xd8,
+	0x4c, 0x75, 0x28, 0x45, 0x43, 0xc1, 0x42, 0xc1, 0x41, 0xc1, 0x76, 0x09,
+	0xef, 0xfe, 0x40, 0xc1, 0xc1, 0xbe, 0xc6, 0x09, 0x30, 0x76, 0x20, 0xdb,
+	0x80, 0x0a, 0xf0, 0x05, 0x41, 0xc5, 0x62, 0x09, 0xef, 0xfe, 0x00, 0x1c,
+	0x41, 0x30, 0x0c, 0x70, 0xfa, 0x08, 0xef, 0xfe, 0x2c, 0x71, 0xa4, 0xc0,
+	0xd4, 0x05, 0x00, 0x4c, 0x00, 0xd1, 0x58, 0xd8, 0x9f, 0xb8, 0xc0, 0x88,
+	0xcd, 0x10, 0x8d, 0x80, 0x0c, 0x70, 0x46, 0x54, 0x00, 0xf0, 0x01, 0x05,
+	0x26, 0x41, 0x13, 0x0c, 0x70, 0xc1, 0xb9, 0x43, 0xc0, 0x42, 0xc1, 0x41,
+	0xc0, 0x40, 0xc0, 0x4a, 0x00, 0xb7, 0x09, 0xda, 0x1e, 0x09, 0xef, 0xfe,
+	0x20, 0xdb, 0x0c, 0x70, 0xba, 0x40, 0x00, 0xf0, 0x01, 0xaa, 0x21, 0xc4,
+	0x00, 0x11, 0x09, 0x3f, 0x00, 0x2c, 0x72, 0xab, 0x21, 0xc4, 0x00, 0x2c,
+	0x71, 0x06, 0x00, 0xf0, 0x17, 0x0f, 0x08, 0x15, 0x04, 0x00, 0x16, 0x00,
+	0x71, 0x08, 0x90, 0xd6, 0x01, 0xe0, 0x7e, 0xaa, 0x21, 0x04, 0x01, 0x32,
+	0x7b, 0x19, 0x0b, 0x25, 0x00, 0xaa, 0x24, 0x44, 0x11, 0xaa, 0x22, 0x04,
+	0x01, 0xfd, 0x09, 0x84, 0x80, 0x62, 0x78, 0x0e, 0x00, 0x40, 0x03, 0xf0,
+	0x38, 0x60, 0x20, 0x00, 0xe0, 0x10, 0x71, 0xe1, 0x20, 0xc6, 0x07, 0xaa,
+	0x22, 0x44, 0x01, 0xf3, 0x0c, 0x80, 0x90, 0xf4, 0x00, 0xc2, 0xf1, 0xc0,
+	0x66, 0x08, 0x00, 0x00, 0xa6, 0x0f, 0xcf, 0xff, 0xd1, 0xc0, 0x10, 0x00,
+	0xa0, 0x5a, 0x0f, 0xcf, 0xff, 0x96, 0x0f, 0xef, 0xff, 0x14, 0xd8, 0x12,
+	0x00, 0x60, 0xf1, 0xc0, 0x46, 0x08, 0x00, 0x00, 0xc8, 0x02, 0xf1, 0x04,
+	0x7c, 0x05, 0x20, 0x89, 0x1b, 0x78, 0x15, 0xe9, 0x00, 0x16, 0x81, 0x70,
+	0x00, 0x80, 0x01, 0x00, 0x23, 0x09, 0xdf, 0x18, 0x00, 0xf0, 0x0f, 0x64,
+	0x06, 0x20, 0x89, 0x17, 0x09, 0x34, 0x01, 0x6c, 0x21, 0x41, 0x00, 0x09,
+	0x28, 0x42, 0x80, 0x08, 0xf2, 0x38, 0x60, 0x42, 0x78, 0x04, 0xf0, 0x09,
+	0x08, 0x15, 0x01, 0x0c, 0x74, 0x44, 0x00, 0xf4, 0x1d, 0x6f, 0x24, 0x43,
+	0x13, 0x60, 0x94, 0x1a, 0x23, 0x02, 0x00, 0x05, 0x2a, 0x82, 0x0f, 0x1e,
+	0x00, 0x80, 0x84, 0x17, 0x08, 0x84, 0x0f, 0x03, 0x00, 0x41, 0x0d, 0x85,
+	0x28, 0x0f, 0x0a, 0x1a, 0x20, 0xc2, 0x00, 0x85, 0x2a, 0x1f, 0x04, 0x3d,
+	0x79, 0x01, 0x6a, 0x41, 0x69, 0x6a, 0x00, 0x77, 0x0c, 0xe9, 0xfb, 0x14,
+	0x81, 0x90, 0x15, 0x64, 0x00, 0xf2, 0x07, 0x34, 0x70, 0xda, 0x22, 0x42,
+	0x00, 0x10, 0x72, 0xe0, 0x7f, 0xca, 0x20, 0x8d, 0x00, 0xe6, 0xc2, 0xb2,
+	0x08, 0x6f, 0xff, 0xa4, 0xc1, 0x1c, 0x08, 0xa0, 0x1d, 0x79, 0xc3, 0xb9,
+	0x58, 0xdd, 0x04, 0x1a, 0x42, 0x30, 0x4e, 0x08, 0x62, 0x0b, 0xe8, 0x5f,
+	0x21, 0x00, 0x01, 0xd8, 0x08, 0x80, 0x57, 0x00, 0x44, 0x20, 0x00, 0x0e,
+	0x1e, 0x62, 0xb4, 0x07, 0x00, 0x9e, 0x06, 0xf2, 0x23, 0x24, 0x00, 0x7a,
+	0x08, 0x4f, 0xff, 0xcf, 0x79, 0x3d, 0x7b, 0x3d, 0x7a, 0x53, 0x26, 0x7e,
+	0x90, 0x7d, 0x7b, 0x5d, 0x7a, 0xc0, 0x23, 0x62, 0x00, 0x5d, 0x7a, 0x53,
+	0x26, 0x81, 0x90, 0xc3, 0xb8, 0xc0, 0x22, 0x62, 0x00, 0x05, 0x1a, 0x02,
+	0x30, 0x07, 0x1a, 0xc2, 0x30, 0x09, 0x1a, 0x42, 0x30, 0x06, 0x1a, 0x82,
+	0x06, 0xf0, 0x21, 0xeb, 0x00, 0x03, 0x00, 0x76, 0x0c, 0xef, 0xfe, 0x0a,
+	0xd8, 0x6f, 0x27, 0xc3, 0x10, 0x00, 0x8f, 0xe2, 0xb8, 0x0c, 0x70, 0xca,
+	0x20, 0xe1, 0x00, 0x0a, 0x1a, 0x02, 0x30, 0x24, 0x17, 0x82, 0x10, 0x0f,
+	0x17, 0x81, 0x14, 0x42, 0x27, 0x80, 0x12, 0x00, 0x90, 0x60, 0x8d, 0xc0,
+	0x97, 0x82, 0x8f, 0xd2, 0x01, 0xf1, 0x0c, 0x0a, 0xd8, 0xc3, 0x41, 0xed,
+	0x00, 0x06, 0x00, 0x41, 0xc4, 0x3e, 0x0c, 0xef, 0xfe, 0x40, 0xc6, 0x08,
+	0x8f, 0x08, 0xe8, 0xc3, 0x41, 0xf2, 0x00, 0x00, 0x00, 0x2e, 0x4a, 0x00,
+	0xf1, 0x16, 0x32, 0xde, 0x9f, 0xbe, 0x01, 0x16, 0x83, 0x14, 0xd1, 0x16,
+	0x82, 0x90, 0x01, 0x16, 0x8c, 0x14, 0x02, 0x16, 0x81, 0x14, 0x01, 0x16,
+	0x80, 0x14, 0x40, 0xc4, 0x41, 0xc1, 0x42, 0xc0, 0xc3, 0x41, 0xf3, 0x00,
+	0x05, 0x00, 0x02, 0x2a, 0x00, 0x00, 0x26, 0x00, 0xe0, 0x21, 0x8e, 0x04,
+	0x8e, 0xcc, 0x16, 0x82, 0x90, 0x80, 0x8e, 0x42, 0xc0, 0x41, 0xc1, 0x5c,
+	0x00, 0xf0, 0x0b, 0xf4, 0x00, 0x05, 0x00, 0xe2, 0x0b, 0xef, 0xfe, 0x40,
+	0xc4, 0x08, 0x8f, 0xb5, 0x08, 0x11, 0x00, 0x15, 0x8f, 0x31, 0x08, 0x7e,
+	0x00, 0x3e, 0xdf, 0x40, 0xf8, 0x40, 0x00, 0x00, 0x22, 0x00, 0x51, 0xf5,
+	0x00, 0x05, 0x00, 0xc2, 0x22, 0x00, 0x24, 0x41, 0xf8, 0x36, 0x00, 0x51,
+	0xf6, 0x00, 0x05, 0x00, 0xae, 0x14, 0x00, 0x95, 0x00, 0x8d, 0x33, 0x08,
+	0x3e, 0x00, 0x65, 0xdf, 0x34, 0x30, 0x00, 0x51, 0xf7, 0x00, 0x05, 0x00,
+	0x92, 0x1c, 0x00, 0x15, 0x35, 0x30, 0x00, 0x51, 0xf8, 0x00, 0x05, 0x00,
+	0x7e, 0x14, 0x00, 0xf0, 0x0b, 0x00, 0x8d, 0x51, 0x08, 0x7e, 0x00, 0x71,
+	0xdd, 0x9f, 0xbd, 0x01, 0x15, 0x83, 0x14, 0x01, 0x15, 0x8c, 0x14, 0x02,
+	0x15, 0x81, 0x14, 0x01, 0x15, 0x80, 0x14, 0x98, 0x00, 0x04, 0x74, 0x00,
+	0x51, 0xf9, 0x00, 0x05, 0x00, 0x4e, 0x30, 0x00, 0x00, 0x26, 0x00, 0x40,
+	0x21, 0x8d, 0x04, 0x8d, 0x1e, 0x00, 0x24, 0x80, 0x8d, 0x80, 0x00, 0x51,
+	0xfa, 0x00, 0x05, 0x00, 0x2e, 0x20, 0x00, 0x00, 0x56, 0x0d, 0xd0, 0xa0,
+	0x01, 0x02, 0x18, 0x15, 0x00, 0x8a, 0x21, 0x44, 0x00, 0x02, 0x18, 0x54,
+	0x08, 0x00, 0x12, 0x01, 0x08, 0x00, 0x31, 0xc4, 0x01, 0x04, 0x10, 0x00,
+	0xf0, 0x05, 0x88, 0x00, 0x20, 0xb0, 0x8a, 0x21, 0x88, 0x02, 0x21, 0xb0,
+	0x8a, 0x21, 0xc8, 0x02, 0x22, 0xb0, 0x8a, 0x20, 0xcc, 0x03, 0xf8, 0x0a,
+	0xf2, 0x1d, 0x09, 0x90, 0x80, 0xe1, 0x34, 0xd9, 0xc3, 0x40, 0x05, 0x90,
+	0xee, 0xe0, 0x20, 0xb0, 0x4e, 0x0d, 0xef, 0xff, 0xfc, 0x18, 0x05, 0x81,
+	0xa4, 0xc0, 0xc6, 0xc6, 0xe0, 0x78, 0x9f, 0xbf, 0x01, 0x17, 0x83, 0x14,
+	0x01, 0x17, 0x8c, 0x14, 0x02, 0x17, 0x81, 0x14, 0x01, 0x17, 0xa0, 0x00,
+	0x20, 0xe0, 0x7e, 0x16, 0x00, 0x41, 0x21, 0x8f, 0x04, 0x8f, 0x90, 0x00,
+	0xf0, 0x00, 0x8f, 0xe0, 0x7e, 0x1a, 0x62, 0x04, 0xf0, 0x01, 0x18, 0x52,
+	0x00, 0xfd, 0x08, 0x84, 0x80, 0xfc, 0x02, 0x60, 0x14, 0x20, 0x82, 0x00,
+	0x03, 0xf0, 0x80, 0x00, 0x11, 0xff, 0x12, 0x00, 0x02, 0xf0, 0x06, 0x60,
+	0xa5, 0xc1, 0x07, 0xde, 0x8c, 0xbe, 0xbe, 0x0c, 0x20, 0x38, 0x9f, 0x78,
+	0x04, 0xf0, 0x09, 0x28, 0x03, 0x00, 0x1e, 0x84, 0x73, 0x00, 0x80, 0x02,
+	0x00, 0x00, 0xb5, 0x58, 0xd8, 0x01, 0xb5, 0xc3, 0x41, 0x4c, 0x01, 0x00,
+	0x00, 0x5a, 0x0a, 0x1c, 0x02, 0x00, 0x74, 0x01, 0xf1, 0x19, 0x50, 0x01,
+	0x01, 0x00, 0x4e, 0x0a, 0xef, 0xfe, 0xc1, 0x42, 0x34, 0xcc, 0x20, 0x95,
+	0x30, 0x70, 0x0c, 0x70, 0x05, 0xf4, 0x35, 0xcc, 0x21, 0x95, 0x38, 0x20,
+	0x40, 0x00, 0xc3, 0x41, 0x51, 0x01, 0x00, 0x00, 0x7e, 0x0a, 0x8f, 0xfe,
+	0xcb, 0x45, 0xb0, 0x0c, 0x61, 0x1d, 0x43, 0x10, 0x00, 0x16, 0x9b, 0x80,
+	0x0b, 0x80, 0x00, 0x1a, 0x03, 0x31, 0x1a, 0x23, 0x80, 0x3f, 0xe8, 0x04,
+	0x20, 0x41, 0xc0, 0x8c, 0x04, 0xf0, 0x05, 0x04, 0x90, 0x32, 0x00, 0x6f,
+	0x20, 0x43, 0x02, 0x06, 0x90, 0x40, 0xc0, 0x00, 0x91, 0x42, 0xc0, 0x01,
+	0xc0, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x0e, 0x00, 0x00, 0x04,
+	0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x20, 0x0e, 0x00, 0x00, 0xf0, 0x15,
+	0x80, 0x0f, 0x02, 0x90, 0x40, 0x00, 0x26, 0x0d, 0xa0, 0x00, 0x00, 0x90,
+	0x00, 0xc0, 0xe0, 0xb8, 0x34, 0x02, 0x01, 0x00, 0x01, 0xc0, 0x05, 0x20,
+	0x81, 0x0f, 0x05, 0x90, 0x32, 0xe0, 0x02, 0xc0, 0x80, 0xb8, 0x00, 0xb1,
+	0x10, 0x00, 0xf2, 0x49, 0x80, 0x0f, 0x03, 0x90, 0x90, 0xe0, 0x72, 0x0c,
+	0x20, 0x00, 0x00, 0x18, 0x05, 0x00, 0x6f, 0x26, 0xc3, 0x1c, 0x00, 0x8e,
+	0x85, 0xe8, 0x00, 0x1e, 0x85, 0x70, 0x04, 0x90, 0xc0, 0x00, 0xc6, 0x0c,
+	0xcf, 0xff, 0x32, 0x0c, 0x4f, 0xff, 0x00, 0x8e, 0x9d, 0x08, 0x11, 0x00,
+	0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x04, 0x00, 0xc3, 0x41, 0x02, 0x90,
+	0x86, 0x00, 0x00, 0x16, 0x82, 0x70, 0x00, 0x80, 0x00, 0x00, 0x1a, 0x20,
+	0x80, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x23, 0x9b, 0x3f, 0x10, 0x00,
+	0x00, 0x00, 0x25, 0x78, 0x00, 0x90, 0x1d, 0x78, 0x02, 0x00, 0xf0, 0x0b,
+	0xc2, 0xb8, 0x23, 0x08, 0x90, 0x00, 0x27, 0x08, 0xf1, 0x00, 0x8b, 0x22,
+	0x3e, 0x80, 0xc3, 0x42, 0x00, 0x80, 0x2c, 0x04, 0x0a, 0xce, 0x5c, 0x70,
+	0x16, 0x50, 0x0c, 0x00, 0xe4, 0x44, 0x04, 0x10, 0xce, 0x11, 0xf0, 0x09,
+	0xce, 0x16, 0x50, 0x0f, 0xce, 0x0e, 0xf0, 0x22, 0x00, 0x35, 0x20, 0x04,
+	0x07, 0x22, 0x00, 0xf0, 0x0d, 0x38, 0x04, 0x0d, 0xce, 0x5c, 0x70, 0x34,
+	0x50, 0x01, 0xc0, 0x25, 0x78, 0xfe, 0x0c, 0xa0, 0x00, 0xc0, 0x90, 0x8a,
+	0x0c, 0xa0, 0x00, 0x63, 0x40, 0x01, 0xc0, 0xa0, 0xbe, 0xcc, 0x00, 0xf0,
+	0x28, 0x03, 0x90, 0x86, 0xfe, 0xc0, 0xb1, 0xd2, 0x0b, 0x00, 0x00, 0xd6,
+	0x0b, 0x8f, 0xff, 0x42, 0x09, 0xcf, 0xfe, 0x72, 0x0d, 0x4f, 0xff, 0x06,
+	0xca, 0x4c, 0x70, 0xcd, 0x70, 0x36, 0xf0, 0x5a, 0x26, 0x83, 0x14, 0x7c,
+	0x65, 0x41, 0xb4, 0x2d, 0xf0, 0x1a, 0x26, 0x81, 0x1f, 0x00, 0x00, 0x00,
+	0x10, 0xe5, 0x79, 0x3b, 0x79, 0x05, 0x21, 0x81, 0x1c, 0x01, 0xf2, 0x4c,
+	0x01, 0x20, 0x91, 0x2f, 0x26, 0x47, 0x30, 0x11, 0x0f, 0xa1, 0x17, 0x6d,
+	0x71, 0x22, 0x8c, 0x0f, 0x21, 0xc1, 0x03, 0x22, 0xac, 0x18, 0xf0, 0x23,
+	0x8c, 0x44, 0x26, 0xdb, 0x37, 0x24, 0x71, 0x23, 0xac, 0x2f, 0x79, 0x14,
+	0x23, 0x41, 0x00, 0xb9, 0x61, 0x0a, 0x26, 0xc0, 0x32, 0xe3, 0xa9, 0x11,
+	0x0b, 0x10, 0x30, 0x42, 0x23, 0x5b, 0x30, 0xfd, 0x0b, 0x31, 0xb0, 0x2f,
+	0x26, 0x80, 0x37, 0x02, 0x19, 0x82, 0x07, 0xe5, 0x71, 0xab, 0x0f, 0x14,
+	0x92, 0xc5, 0x71, 0x99, 0x0e, 0x24, 0x90, 0xed, 0x70, 0x00, 0x16, 0x8f,
+	0x70, 0x00, 0x80, 0x25, 0x00, 0x28, 0xef, 0x28, 0x01, 0xf2, 0x1a, 0x32,
+	0x00, 0x00, 0x16, 0x9b, 0x70, 0x00, 0x80, 0x6b, 0x06, 0xcd, 0x71, 0xe3,
+	0xb8, 0xca, 0x26, 0xa1, 0x10, 0x14, 0xf0, 0x15, 0x0f, 0x3e, 0x10, 0x2f,
+	0x21, 0xc7, 0x06, 0x0c, 0x70, 0xc1, 0x42, 0x1a, 0x09, 0x2f, 0xff, 0x6c,
+	0x70, 0x13, 0x0f, 0x7e, 0x12, 0x00, 0x41, 0x71, 0xc1, 0x42, 0x06, 0x12,
+	0x00, 0x40, 0x67, 0x71, 0xc3, 0x40, 0x36, 0x00, 0x62, 0x01, 0x88, 0xd3,
+	0x08, 0xc5, 0x86, 0x56, 0x00, 0x15, 0x58, 0x56, 0x00, 0x20, 0x65, 0x00,
+	0x4e, 0x00, 0x02, 0x22, 0x00, 0x4e, 0x02, 0x10, 0x9b, 0x00, 0x58, 0x00,
+	0x2c, 0xc2, 0x08, 0x58, 0x00, 0x11, 0xae, 0x12, 0x00, 0x04, 0x58, 0x00,
+	0x12, 0x03, 0x58, 0x00, 0xf0, 0x24, 0xc0, 0x0b, 0x08, 0x3f, 0x03, 0x0c,
+	0x71, 0x05, 0xf0, 0xba, 0x0a, 0x20, 0x00, 0x0d, 0xd8, 0x0c, 0x70, 0xd6,
+	0x0c, 0x40, 0x01, 0x62, 0x0d, 0x8f, 0xfe, 0x0c, 0x70, 0xa6, 0x0a, 0x20,
+	0x00, 0x00, 0x1d, 0x03, 0x10, 0x06, 0xca, 0xad, 0x70, 0x6c, 0x70, 0x1a,
+	0xf0, 0x4c, 0x70, 0x15, 0xf0, 0x1a, 0x23, 0x81, 0x0f, 0x42, 0x01, 0xb7,
+	0x00, 0x23, 0x8c, 0x1f, 0x00, 0x80, 0x98, 0x1b, 0x65, 0x71, 0x45, 0x4c,
+	0x01, 0xf2, 0x1f, 0xc0, 0x91, 0xc0, 0xac, 0x40, 0xb1, 0x44, 0x71, 0xdd,
+	0x0a, 0x14, 0x82, 0x64, 0x71, 0xd1, 0x0b, 0x24, 0x80, 0x16, 0x25, 0xcb,
+	0x10, 0x00, 0xc0, 0x53, 0x08, 0xbe, 0x01, 0x0c, 0x70, 0xcb, 0x46, 0x00,
+	0x80, 0x65, 0x06, 0x00, 0xae, 0x0f, 0x78, 0x3d, 0x08, 0x95, 0x00, 0x14,
+	0xe8, 0x20, 0x01, 0xf2, 0x0f, 0x58, 0x00, 0x14, 0x70, 0x0c, 0x71, 0x0a,
+	0xf2, 0x77, 0xf8, 0x9a, 0x0c, 0xe0, 0x00, 0x01, 0x1e, 0x03, 0x10, 0x2e,
+	0x0a, 0x20, 0x00, 0x0c, 0x76, 0x00, 0x8e, 0x04, 0x71, 0xeb, 0xf1, 0x24,
+	0x00, 0x10, 0x25, 0x24, 0x00, 0xf2, 0x02, 0x70, 0xef, 0xf5, 0xf8, 0xf1,
+	0xea, 0x0b, 0xef, 0xfe, 0x0c, 0x73, 0x00, 0xc0, 0xe5, 0xb8, 0x99, 0xf2,
+	0x50, 0x00, 0x3a, 0x8d, 0xf0, 0x09, 0x4a, 0x00, 0x38, 0xf4, 0x82, 0xf0,
+	0x36, 0x00, 0xe0, 0x7c, 0xf2, 0x60, 0xf8, 0x0c, 0x70, 0x40, 0xc0, 0x0c,
+	0x71, 0xa6, 0x0b, 0x2f, 0xff, 0x60, 0x00, 0x51, 0x01, 0x8e, 0x00, 0x16,
+	0x8d, 0xc2, 0x02, 0xa0, 0x5f, 0x20, 0x41, 0x06, 0x00, 0x8e, 0x1a, 0x25,
+	0x8d, 0x1f, 0xba, 0x02, 0x80, 0x5f, 0x20, 0x80, 0x0c, 0x05, 0x25, 0x8f,
+	0x1f, 0xd6, 0x02, 0xf0, 0x0d, 0x19, 0x61, 0x38, 0x66, 0x16, 0x88, 0x43,
+	0xc0, 0xf2, 0x0a, 0x2f, 0xff, 0x0c, 0x71, 0xe0, 0x97, 0x2c, 0x71, 0x02,
+	0x08, 0x60, 0x00, 0x18, 0x43, 0x05, 0x25, 0x80, 0x1f, 0x6e, 0x02, 0xf2,
+	0x13, 0x46, 0x27, 0x4f, 0x13, 0x44, 0xc0, 0xe0, 0xb0, 0x8a, 0x25, 0xc7,
+	0x1f, 0x03, 0xc0, 0x4c, 0x71, 0x6c, 0x70, 0xe6, 0xb8, 0xff, 0xd8, 0xca,
+	0x25, 0x01, 0x10, 0x63, 0x40, 0x4e, 0x0d, 0x20, 0x00, 0xa1, 0x41, 0x84,
+	0x00, 0xf4, 0x37, 0x1d, 0x00, 0x6b, 0x08, 0x3e, 0x00, 0x82, 0xbf, 0x04,
+	0xc0, 0xc3, 0x41, 0x8f, 0x00, 0x00, 0x00, 0xe0, 0xb0, 0x38, 0xf8, 0x2e,
+	0x0d, 0x20, 0x00, 0x40, 0xdb, 0xc3, 0x41, 0x90, 0x00, 0x00, 0x00, 0x34,
+	0xf8, 0x22, 0x0d, 0x20, 0x00, 0x30, 0xdb, 0x63, 0x40, 0xa1, 0x41, 0x4c,
+	0x72, 0x16, 0x0d, 0x20, 0x00, 0x6c, 0x70, 0x1b, 0xf0, 0x00, 0x16, 0x81,
+	0x70, 0x00, 0x80, 0x1f, 0x00, 0x00, 0xc0, 0x25, 0x09, 0x0e, 0x00, 0x00,
+	0xc0, 0x5c, 0x03, 0x04, 0xec, 0x02, 0x20, 0x05, 0x20, 0xd8, 0x03, 0xf0,
+	0x1b, 0x86, 0x00, 0x00, 0x90, 0xa0, 0xb8, 0x00, 0xb1, 0x00, 0xc0, 0x04,
+	0x71, 0x40, 0xc0, 0x00, 0xc0, 0xcb, 0x08, 0x34, 0x81, 0x0c, 0x75, 0xf2,
+	0x08, 0x00, 0x00, 0x00, 0x8e, 0xa1, 0x68, 0xaf, 0x78, 0x14, 0x71, 0xe8,
+	0x06, 0xee, 0xff, 0xa0, 0xae, 0xb6, 0x0a, 0x34, 0x01, 0xf2, 0x03, 0x76,
+	0x0c, 0x8f, 0xff, 0x06, 0xca, 0x6f, 0x70, 0x4c, 0x70, 0x17, 0xf0, 0x6c,
+	0x70, 0x12, 0xf0, 0x1a, 0x22, 0xca, 0x01, 0x11, 0x65, 0xc0, 0x01, 0x11,
+	0x8c, 0x0c, 0x03, 0x31, 0x32, 0x23, 0x81, 0xd6, 0x01, 0xf0, 0x05, 0x64,
+	0x71, 0x65, 0x71, 0x20, 0xb4, 0xdf, 0x0b, 0x14, 0x82, 0x44, 0x71, 0xd7,
+	0x0a, 0x24, 0x80, 0x16, 0x23, 0x8b, 0x30, 0x26, 0x04, 0x04, 0x36, 0x04,
+	0x30, 0x00, 0xb1, 0x4e, 0x54, 0x00, 0xf1, 0x0c, 0x70, 0x6e, 0x08, 0x80,
+	0x00, 0x12, 0x09, 0xe0, 0x00, 0x07, 0xd8, 0xab, 0x23, 0xc4, 0x30, 0xff,
+	0x7f, 0x00, 0xf0, 0xf1, 0xc0, 0x82, 0x0d, 0xaf, 0xfe, 0x0c, 0x74, 0xd0,
+	0x00, 0xd0, 0x70, 0xd1, 0xc0, 0xe0, 0x7e, 0xe0, 0x78, 0xf1, 0xc0, 0x3e,
+	0x0d, 0x8f, 0xfe, 0xd0, 0x01, 0xa0, 0x2e, 0x0a, 0xef, 0xfe, 0x0f, 0x78,
+	0x02, 0x0b, 0x8f, 0xfe, 0x1a, 0x00, 0xf0, 0x19, 0xe2, 0xc2, 0xcb, 0x45,
+	0x04, 0x90, 0x04, 0x00, 0x00, 0x95, 0xa1, 0xb8, 0x00, 0xb5, 0x52, 0x0f,
+	0xaf, 0xff, 0x0c, 0x74, 0x1f, 0xd8, 0x4a, 0x0f, 0xaf, 0xff, 0xf6, 0x1d,
+	0x5d, 0x10, 0xc2, 0xc6, 0xe2, 0xc2, 0x3e, 0x0f, 0xaf, 0xff, 0x1f, 0xd8,
+	0x26, 0x00, 0xf2, 0x0b, 0xf0, 0x01, 0x0c, 0x74, 0x2e, 0x0f, 0xaf, 0xff,
+	0x00, 0x1d, 0x05, 0x10, 0x0a, 0x15, 0x00, 0x97, 0x81, 0xb8, 0x0a, 0x1d,
+	0x1c, 0x90, 0xc2, 0xc6, 0xf1, 0xc0, 0x2c, 0x01, 0xe0, 0x12, 0x00, 0x8c,
+	0x21, 0x03, 0x82, 0x84, 0x08, 0xce, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x5e,
+	0x00, 0x42, 0xe0, 0x78, 0xe2, 0xc2, 0x84, 0x01, 0xf0, 0x01, 0x01, 0x00,
+	0x1b, 0x08, 0x3e, 0x00, 0x0a, 0xd8, 0xcb, 0x45, 0x05, 0x90, 0x36, 0xe0,
+	0xea, 0x0e, 0x46, 0x00, 0x20, 0x45, 0x10, 0x4a, 0x00, 0xe0, 0xc2, 0xc6,
+	0xc3, 0x40, 0x04, 0x90, 0xf2, 0x00, 0x00, 0x18, 0x45, 0x00, 0xe0, 0x7f,
+	0xfa, 0x04, 0xa0, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xa8, 0xc1, 0x08,
+	0x46, 0x5c, 0x03, 0x80, 0x69, 0x06, 0x00, 0x88, 0x46, 0xc1, 0x2c, 0x70,
+	0x80, 0x01, 0x42, 0x00, 0x00, 0x00, 0x20, 0x78, 0x01, 0xf1, 0x46, 0x40,
+	0x00, 0x00, 0x90, 0x44, 0xc0, 0xb6, 0x0e, 0x6f, 0xfe, 0x0c, 0x70, 0x00,
+	0x12, 0x83, 0x30, 0x81, 0xd9, 0xad, 0x70, 0xff, 0xd8, 0x8e, 0xb9, 0x4c,
+	0x75, 0x43, 0xc5, 0x42, 0xc5, 0x41, 0xc5, 0x8e, 0x0f, 0x6f, 0xfe, 0x40,
+	0xc5, 0x0c, 0x70, 0x2a, 0x0f, 0x6f, 0xfe, 0x2c, 0x71, 0xda, 0x08, 0x0f,
+	0xff, 0xe2, 0x08, 0x2f, 0xff, 0x47, 0xc0, 0xc3, 0x40, 0x00, 0x00, 0x10,
+	0x27, 0xe2, 0x0e, 0xaf, 0xff, 0x08, 0xd9, 0xc3, 0x40, 0x0f, 0x90, 0xc0,
+	0xe0, 0x00, 0x18, 0x05, 0x02, 0xa5, 0xb0, 0x04, 0xc0, 0x0f, 0x79, 0x66,
+	0x4e, 0x00, 0x42, 0x2c, 0x70, 0x6f, 0x71, 0x4a, 0x00, 0x20, 0x6c, 0x74,
+	0x4c, 0x00, 0x51, 0x04, 0x1c, 0xc0, 0x36, 0x42, 0x4e, 0x00, 0xb1, 0xcf,
+	0x7f, 0xb8, 0xf8, 0x43, 0xc5, 0x42, 0xc7, 0x41, 0xc5, 0x32, 0x10, 0x00,
+	0xe0, 0xc1, 0xbe, 0x45, 0xc6, 0x05, 0xc0, 0x2c, 0x70, 0x4c, 0x76, 0x42,
+	0xc0, 0xff, 0xd8, 0x2e, 0x00, 0x00, 0x2c, 0x00, 0x11, 0x16, 0x1c, 0x00,
+	0x04, 0x18, 0x00, 0xc0, 0x0c, 0x75, 0x41, 0xc0, 0xff, 0xd8, 0x28, 0xdb,
+	0x43, 0xc5, 0xfe, 0x0e, 0x92, 0x00, 0xf3, 0x1a, 0x42, 0x09, 0xaf, 0xfe,
+	0xff, 0xd8, 0x04, 0xc1, 0x07, 0xc0, 0xcb, 0x46, 0x00, 0x00, 0x00, 0x31,
+	0x14, 0x20, 0x41, 0x00, 0x68, 0x49, 0xc0, 0xb8, 0x38, 0x60, 0x30, 0xe0,
+	0x44, 0xc0, 0x06, 0xc0, 0x04, 0xe8, 0x0c, 0x1c, 0x41, 0x34, 0x68, 0xf0,
+	0xa0, 0x6a, 0x00, 0x11, 0xc6, 0x36, 0x00, 0x11, 0x9a, 0x0e, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0xf2, 0x00, 0x50, 0x40, 0xc5, 0x93, 0xf8, 0x0c, 0x96,
+	0x00, 0x41, 0xc7, 0x41, 0xc5, 0xa6, 0x20, 0x00, 0x11, 0x95, 0x20, 0x00,
+	0x31, 0x41, 0xc5, 0x9a, 0x0e, 0x00, 0x00, 0x74, 0x00, 0x11, 0x8d, 0x12,
+	0x00, 0x11, 0x8a, 0x10, 0x00, 0x15, 0x87, 0x2e, 0x00, 0x11, 0x7a, 0x10,
+	0x00, 0x60, 0x0c, 0x75, 0x43, 0xc0, 0x82, 0xf8, 0xc8, 0x00, 0x11, 0x6a,
+	0x10, 0x00, 0x11, 0x85, 0x2c, 0x00, 0x31, 0x41, 0xc5, 0x5a, 0x0e, 0x00,
+	0x04, 0xba, 0x00, 0x06, 0xd2, 0x00, 0x11, 0x42, 0x18, 0x00, 0x15, 0x76,
+	0x46, 0x00, 0x11, 0x32, 0x10, 0x00, 0x13, 0x78, 0x36, 0x00, 0x11, 0x26,
+	0x0e, 0x00, 0x04, 0x36, 0x00, 0x00, 0x7c, 0x00, 0x02, 0x3a, 0x00, 0x11,
+	0x0e, 0x18, 0x00, 0x00, 0xa8, 0x00, 0x11, 0x67, 0x6c, 0x00, 0x20, 0xfe,
+	0x0d, 0x00, 0x01, 0xe4, 0x04, 0xc0, 0xad, 0x70, 0x2c, 0x70, 0x0f, 0x78,
+	0x44, 0xc0, 0x04, 0xc3, 0xff, 0xd8, 0xae, 0x01, 0x11, 0xe2, 0x1c, 0x00,
+	0x12, 0x06, 0x14, 0x01, 0xf2, 0x00, 0x21, 0x14, 0x70, 0x6d, 0xf2, 0x4c,
+	0x71, 0xff, 0xd8, 0xc1, 0x41, 0x6c, 0x74, 0x58, 0x43, 0x72, 0x01, 0x11,
+	0xbe, 0x22, 0x00, 0x11, 0x58, 0x74, 0x00, 0x00, 0x08, 0x01, 0x11, 0xae,
+	0x10, 0x00, 0x15, 0x4e, 0x94, 0x00, 0x11, 0x9e, 0x10, 0x00, 0x11, 0x47,
+	0x20, 0x00, 0x31, 0x41, 0xc5, 0x92, 0x0e, 0x00, 0x00, 0x8c, 0x00, 0x11,
+	0x4b, 0x12, 0x00, 0x11, 0x82, 0x10, 0x00, 0x15, 0x42, 0x2e, 0x00, 0x11,
+	0x72, 0x10, 0x00, 0x00, 0x08, 0x01, 0x11, 0x3d, 0x9c, 0x00, 0x11, 0x62,
+	0x10, 0x00, 0x11, 0x37, 0x2c, 0x00, 0x31, 0x41, 0xc5, 0x52, 0x0e, 0x00,
+	0x04, 0xd2, 0x00, 0x02, 0xce, 0x00, 0x00, 0x74, 0x00, 0x11, 0x3a, 0x18,
+	0x00, 0x15, 0x31, 0x46, 0x00, 0x11, 0x2a, 0x10, 0x00, 0x13, 0x2a, 0x36,
+	0x00, 0x11, 0x1e, 0x0e, 0x00, 0x04, 0x36, 0x00, 0x00, 0x7c, 0x00, 0x02,
+	0x3a, 0x00, 0x11, 0x06, 0x18, 0x00, 0x00, 0x08, 0x01, 0x20, 0x03, 0xf0,
+	0xdc, 0x01, 0x11, 0x21, 0x72, 0x00, 0x21, 0xee, 0x0c, 0x0e, 0x01, 0x30,
+	0xc3, 0x2c, 0x70, 0x06, 0x01, 0x90, 0x28, 0x45, 0x43, 0xc1, 0x42, 0xc1,
+	0x41, 0xc1, 0xda, 0x16, 0x00, 0x10, 0xc1, 0x14, 0x00, 0xa0, 0x8f, 0xb9,
+	0x4c, 0x75, 0x6c, 0x74, 0x0c, 0x1c, 0xc1, 0x30, 0xce, 0x02, 0x10, 0xc2,
+	0x18, 0x00, 0x90, 0xc5, 0xff, 0xd8, 0x2c, 0x70, 0x4c, 0x75, 0x30, 0xdb,
+	0x96, 0x02, 0x31, 0x41, 0xc5, 0xae, 0x14, 0x00, 0xa6, 0xd6, 0x0e, 0x6f,
+	0xfe, 0xff, 0xd8, 0x05, 0xc0, 0x80, 0xd9, 0x86, 0x02, 0xf0, 0x05, 0x41,
+	0xc5, 0x92, 0x0c, 0x6f, 0xfe, 0x00, 0x1c, 0x41, 0x30, 0xa8, 0xc0, 0x04,
+	0x14, 0x1b, 0x34, 0xc6, 0xc6, 0xe0, 0x78, 0x4e, 0x01, 0x40, 0x4c, 0x71,
+	0x6c, 0x74, 0x0c, 0x04, 0x02, 0x0c, 0x00, 0x25, 0x08, 0xdb, 0x0c, 0x00,
+	0x14, 0x72, 0x0c, 0x00, 0x47, 0x2c, 0x70, 0x4c, 0x70, 0x24, 0x00, 0x12,
+	0x72, 0x0c, 0x00, 0x02, 0x90, 0x03, 0xf2, 0x35, 0x82, 0x24, 0x03, 0x31,
+	0x44, 0xc2, 0x43, 0xc1, 0x47, 0xc0, 0x88, 0xc0, 0xc3, 0x41, 0x00, 0x00,
+	0x00, 0x7f, 0x51, 0xda, 0x86, 0x0e, 0xaf, 0xff, 0x45, 0xc3, 0xc3, 0x40,
+	0x03, 0x90, 0x24, 0xe0, 0x00, 0x18, 0xc5, 0x0f, 0x0c, 0x18, 0xc5, 0x0f,
+	0xfe, 0x18, 0x05, 0x80, 0x8a, 0x23, 0x02, 0x30, 0x05, 0xc0, 0xad, 0x70,
+	0xb0, 0xe0, 0x40, 0xd8, 0xca, 0x23, 0x01, 0x30, 0x05, 0xc0, 0x79, 0x20,
+	0x00, 0x0c, 0x1b, 0x78, 0x02, 0x00, 0xf0, 0x21, 0x30, 0xe0, 0x46, 0xc0,
+	0x6a, 0xf0, 0x07, 0xc0, 0xcf, 0x08, 0x6e, 0x03, 0xaf, 0x7e, 0x03, 0xc2,
+	0xc1, 0x40, 0x0e, 0x08, 0xef, 0xfe, 0x2c, 0x71, 0x03, 0xc2, 0x06, 0xc3,
+	0x0c, 0x71, 0x96, 0x0f, 0xef, 0xfe, 0xc1, 0x41, 0x03, 0xc1, 0x04, 0xc2,
+	0xc1, 0x40, 0x63, 0x43, 0x46, 0x0d, 0x20, 0x00, 0xca, 0x00, 0xf2, 0x15,
+	0x04, 0xc0, 0x12, 0xe8, 0x04, 0xc0, 0x0f, 0x08, 0xb1, 0x00, 0xc1, 0x40,
+	0x03, 0xc1, 0x4c, 0x72, 0x04, 0xf0, 0x03, 0xc1, 0xc1, 0x40, 0x4c, 0x70,
+	0x1e, 0x0d, 0x4f, 0xff, 0x03, 0xc1, 0x6a, 0x0e, 0x20, 0x01, 0xc1, 0x40,
+	0x2e, 0x04, 0xf0, 0x15, 0xe0, 0x88, 0x01, 0x10, 0x8b, 0x00, 0x03, 0xc0,
+	0x2c, 0x70, 0xfe, 0x0f, 0x6f, 0xfe, 0x08, 0xda, 0x40, 0x23, 0x41, 0x10,
+	0xe2, 0x79, 0x29, 0x78, 0x6d, 0x70, 0x0f, 0x7b, 0xff, 0xd8, 0x1f, 0xf0,
+	0x41, 0xdc, 0x2a, 0x7c, 0xf2, 0x08, 0xf0, 0x35, 0xdc, 0x06, 0x65, 0x71,
+	0x32, 0x24, 0x80, 0x1f, 0x00, 0x80, 0x1b, 0x07, 0x0f, 0xe0, 0x0f, 0x78,
+	0x14, 0x7c, 0x88, 0xc0, 0x34, 0x78, 0x4f, 0x64, 0x20, 0x88, 0x9a, 0x62,
+	0x08, 0x21, 0xc1, 0x03, 0x20, 0xa8, 0x21, 0x8a, 0x41, 0x88, 0x09, 0x22,
+	0x42, 0x00, 0x41, 0xa8, 0xf0, 0x49, 0x1c, 0x78, 0x09, 0x20, 0x80, 0x07,
+	0x2f, 0x21, 0xc7, 0x02, 0xc3, 0x09, 0xe4, 0x80, 0x2f, 0x26, 0x07, 0x30,
+	0xc1, 0x40, 0xfa, 0x0b, 0xb6, 0x00, 0xf2, 0x11, 0x21, 0x88, 0x09, 0x26,
+	0x41, 0x30, 0x21, 0xa8, 0xa5, 0x71, 0x2f, 0x0d, 0x94, 0x90, 0x04, 0xc0,
+	0x9b, 0x08, 0xb0, 0x00, 0x0c, 0x74, 0xc3, 0x41, 0x71, 0x00, 0x00, 0x00,
+	0xfa, 0x0f, 0x4f, 0xfe, 0x36, 0x08, 0xc0, 0x69, 0x06, 0x6f, 0x70, 0x35,
+	0xf0, 0x03, 0xc0, 0x5f, 0x08, 0x6e, 0x03, 0x76, 0x08, 0x00, 0x6c, 0x00,
+	0xf0, 0x01, 0x41, 0x88, 0x00, 0x88, 0xa1, 0x43, 0x41, 0xc2, 0x59, 0x60,
+	0x04, 0xc2, 0x3d, 0x7e, 0x40, 0xc0, 0x36, 0x00, 0xe1, 0x73, 0x00, 0x05,
+	0x00, 0xc2, 0x0f, 0x6f, 0xfe, 0x42, 0xc6, 0x04, 0xc0, 0x1a, 0x20, 0x1e,
+	0x06, 0xf0, 0x02, 0x20, 0xa1, 0x40, 0x9a, 0x20, 0x08, 0x00, 0x05, 0x79,
+	0x05, 0xc0, 0x17, 0x08, 0x10, 0x0c, 0x05, 0x21, 0x78, 0x06, 0xa2, 0x80,
+	0x00, 0xc0, 0xb0, 0x05, 0xc0, 0xc0, 0xe0, 0x06, 0xf2, 0x10, 0x00, 0xf0,
+	0x02, 0x60, 0x00, 0xc0, 0xb0, 0x67, 0x71, 0xa5, 0x71, 0x9f, 0x0d, 0x54,
+	0x92, 0xe5, 0x71, 0xef, 0x78, 0x44, 0xea, 0x04, 0xf2, 0x06, 0x80, 0x69,
+	0x06, 0x21, 0x88, 0x04, 0xc0, 0xed, 0x09, 0x25, 0x80, 0xad, 0x70, 0xd2,
+	0x0b, 0x8f, 0xfe, 0x80, 0x24, 0x03, 0x31, 0x12, 0x02, 0xf1, 0x06, 0xe6,
+	0xc0, 0xc3, 0x43, 0x00, 0x80, 0x69, 0x06, 0xa0, 0x8b, 0x81, 0x8b, 0x1f,
+	0x25, 0x8f, 0x10, 0x1b, 0xf0, 0x1a, 0x25, 0x9e, 0x98, 0x09, 0xf0, 0x28,
+	0x9a, 0x23, 0x04, 0x00, 0x14, 0x21, 0x8e, 0x03, 0x05, 0x26, 0x1e, 0x30,
+	0x05, 0x23, 0x83, 0x07, 0x7b, 0x7b, 0x91, 0xbb, 0x9c, 0xbb, 0x9f, 0xbb,
+	0x60, 0x93, 0xe5, 0x71, 0x65, 0x71, 0x60, 0xb6, 0x2f, 0x23, 0xc7, 0x02,
+	0xd7, 0x0b, 0xa4, 0x80, 0xf0, 0x7e, 0xa5, 0x71, 0xf7, 0x0c, 0x65, 0x93,
+	0x6d, 0x70, 0xc6, 0xc4, 0xe0, 0x78, 0xe6, 0x14, 0x02, 0xf0, 0x07, 0x80,
+	0x69, 0x06, 0x60, 0x89, 0x41, 0x89, 0x5f, 0x23, 0x4d, 0x02, 0x08, 0xe5,
+	0x22, 0xf0, 0x9a, 0x21, 0x08, 0x00, 0x1a, 0x23, 0x8e, 0xac, 0x08, 0x83,
+	0x20, 0x8a, 0x27, 0xcf, 0x1f, 0x85, 0x71, 0xc5, 0xf2, 0x09, 0x84, 0x64,
+	0x00, 0x20, 0x91, 0x24, 0x7f, 0x3d, 0x79, 0x02, 0x00, 0xf2, 0x3d, 0x6c,
+	0x21, 0x0e, 0x01, 0xfe, 0x66, 0x14, 0x20, 0x41, 0x03, 0xc0, 0xb1, 0x09,
+	0xe5, 0xc9, 0x0c, 0x74, 0x92, 0x81, 0x41, 0x64, 0x71, 0xf9, 0x0a, 0xe5,
+	0x80, 0x08, 0xdc, 0xc6, 0xc4, 0x32, 0xcc, 0xe0, 0x7f, 0x33, 0x1a, 0x1c,
+	0x30, 0xf1, 0xc0, 0x08, 0x43, 0x6c, 0x70, 0x0f, 0xf0, 0x19, 0x0b, 0xee,
+	0x10, 0x6f, 0x78, 0x7e, 0x0a, 0xcf, 0xfe, 0x4c, 0x70, 0x04, 0xf0, 0x01,
+	0x18, 0xd3, 0x0f, 0x44, 0x71, 0xfb, 0x0a, 0x94, 0x80, 0x64, 0x71, 0xe9,
+	0x0b, 0x94, 0x80, 0x78, 0x06, 0xf0, 0x29, 0xf1, 0xc0, 0x6d, 0x70, 0x6c,
+	0x70, 0x16, 0xf0, 0xef, 0x70, 0x11, 0xf0, 0x5a, 0x23, 0x82, 0x0c, 0x5c,
+	0x60, 0x5a, 0x27, 0x42, 0x36, 0xe7, 0x71, 0x9a, 0x62, 0x3c, 0x62, 0x00,
+	0x26, 0x82, 0x36, 0x5c, 0x12, 0x82, 0x00, 0x40, 0x26, 0x5e, 0x30, 0x40,
+	0xac, 0xe5, 0x0f, 0x94, 0xb0, 0x64, 0x71, 0xd9, 0x0b, 0xb4, 0x80, 0x14,
+	0x23, 0xde, 0x10, 0x3e, 0x00, 0x05, 0xf0, 0x02, 0xf2, 0x3f, 0x30, 0x48,
+	0x45, 0x28, 0x46, 0x08, 0x47, 0x99, 0xc0, 0x2c, 0x70, 0x5a, 0xda, 0x8a,
+	0x0b, 0xaf, 0xff, 0x78, 0x43, 0x82, 0xc0, 0x82, 0x0b, 0xaf, 0xff, 0x5a,
+	0xda, 0x0f, 0x0b, 0x71, 0x00, 0x99, 0xc0, 0x82, 0xc1, 0xe2, 0x09, 0x20,
+	0x00, 0x4c, 0x71, 0x0f, 0xd8, 0x56, 0x0d, 0x6f, 0xfe, 0x0f, 0xd9, 0x66,
+	0xca, 0x70, 0xf0, 0x13, 0x0b, 0x71, 0x30, 0x82, 0xc1, 0x00, 0xc0, 0x16,
+	0x0c, 0xe0, 0x00, 0xa1, 0x42, 0x11, 0xf0, 0x2c, 0x70, 0x0d, 0xf0, 0x19,
+	0x0d, 0x6e, 0x10, 0x20, 0xc6, 0x01, 0xf0, 0x06, 0x20, 0x82, 0x0f, 0x03,
+	0x90, 0x64, 0xe0, 0x00, 0xc0, 0x00, 0xb2, 0x24, 0x71, 0xeb, 0x09, 0x54,
+	0x82, 0xca, 0x08, 0x4f, 0xfe, 0xba, 0x02, 0xf0, 0x1d, 0x67, 0x06, 0x20,
+	0x88, 0x42, 0x88, 0xcb, 0x44, 0x00, 0x80, 0xdc, 0x06, 0x14, 0x26, 0x4b,
+	0x10, 0x23, 0x88, 0x37, 0xf0, 0x4c, 0x26, 0x00, 0xb1, 0x5b, 0x0d, 0xae,
+	0x17, 0xca, 0x23, 0x01, 0x10, 0x00, 0x13, 0x40, 0x11, 0x4d, 0x08, 0x32,
+	0x00, 0x0a, 0x20, 0x80, 0x07, 0x10, 0x02, 0x31, 0x1a, 0x23, 0x9f, 0x5a,
+	0x01, 0x42, 0x05, 0x20, 0xc0, 0x07, 0x14, 0x07, 0xf1, 0x0e, 0x66, 0x01,
+	0x00, 0x90, 0x94, 0xe8, 0x14, 0x24, 0xc0, 0x13, 0x41, 0xc0, 0x01, 0x10,
+	0x9f, 0x00, 0x00, 0xc0, 0x08, 0x27, 0x1f, 0x30, 0x01, 0xc0, 0x01, 0x18,
+	0xc2, 0x07, 0x00, 0x10, 0x00, 0x11, 0x09, 0x10, 0x00, 0x60, 0x00, 0x18,
+	0xc2, 0x07, 0x41, 0xe4, 0xfe, 0x00, 0xf0, 0x0b, 0xa3, 0x0e, 0x74, 0xb2,
+	0x40, 0x23, 0x80, 0x10, 0x44, 0x71, 0x08, 0x43, 0x4f, 0x7b, 0xf3, 0x09,
+	0xe5, 0x80, 0x4a, 0x26, 0x00, 0x30, 0x0f, 0xd8, 0x8a, 0x0c, 0xce, 0x00,
+	0xf0, 0x15, 0x15, 0xca, 0x2c, 0x71, 0xc4, 0xb8, 0x06, 0xe8, 0x61, 0xb8,
+	0x01, 0x08, 0x31, 0x00, 0x3b, 0x79, 0x00, 0xc0, 0x38, 0x60, 0x0f, 0x78,
+	0x40, 0xc0, 0x67, 0xca, 0x00, 0xc1, 0x1b, 0x08, 0x45, 0x80, 0x0f, 0x0b,
+	0x71, 0x30, 0x04, 0x01, 0xa2, 0xde, 0x08, 0x20, 0x00, 0x4c, 0x70, 0x80,
+	0x24, 0x03, 0x30, 0x5c, 0x02, 0x00, 0x54, 0x08, 0xc4, 0x05, 0x90, 0x00,
+	0xe0, 0x20, 0xd8, 0x02, 0x0f, 0x6f, 0xff, 0x00, 0x1d, 0xe8, 0x07, 0xf0,
+	0x4b, 0x21, 0x88, 0x6c, 0x21, 0x41, 0x00, 0x21, 0xa8, 0x22, 0x88, 0xc6,
+	0xb9, 0x22, 0xa8, 0x2d, 0x88, 0x44, 0x21, 0x02, 0x0c, 0x85, 0x22, 0x3f,
+	0x02, 0x13, 0x09, 0x7f, 0x01, 0x4d, 0xa8, 0x4f, 0x79, 0x85, 0xb9, 0x2d,
+	0xa8, 0x23, 0x88, 0x87, 0xb9, 0x23, 0xa8, 0x2c, 0x70, 0x38, 0xa8, 0x31,
+	0xa8, 0xe0, 0x7f, 0x30, 0xa8, 0xe2, 0xc2, 0x4a, 0x0e, 0x8f, 0xfe, 0x6f,
+	0x25, 0x43, 0x13, 0x60, 0x95, 0x20, 0xda, 0x40, 0xd9, 0x8c, 0x23, 0xca,
+	0x85, 0xca, 0x22, 0x2d, 0x0c, 0x8c, 0x23, 0xd0, 0x89, 0xca, 0x22, 0x4d,
+	0x00, 0x8c, 0x23, 0xd8, 0x8f, 0x50, 0xd9, 0x0a, 0x00, 0x81, 0x8a, 0x21,
+	0xca, 0x05, 0x3c, 0x21, 0xc1, 0x00, 0x1a, 0x00, 0x21, 0x21, 0xad, 0x1a,
+	0x00, 0xf1, 0x0e, 0xca, 0x21, 0xed, 0x00, 0xd3, 0x73, 0x00, 0x00, 0x5f,
+	0x09, 0xca, 0x21, 0x2d, 0x01, 0x05, 0x21, 0x8c, 0x00, 0xfe, 0x15, 0x81,
+	0x90, 0x5a, 0x20, 0x00, 0x04, 0x1a, 0x21, 0x83, 0x2a, 0x0d, 0xf2, 0x11,
+	0xc3, 0x41, 0x04, 0x90, 0xf8, 0x00, 0x04, 0x20, 0x80, 0x0f, 0x00, 0x00,
+	0xf0, 0x1f, 0x81, 0xb8, 0x05, 0x23, 0x42, 0x00, 0x24, 0x72, 0x65, 0x79,
+	0x80, 0xb2, 0x00, 0xb1, 0xc2, 0xc6, 0xe0, 0x78, 0x0c, 0x02, 0x20, 0x58,
+	0x43, 0x32, 0x04, 0xf0, 0x04, 0x69, 0x06, 0x00, 0x12, 0x8b, 0x00, 0x38,
+	0x47, 0x0a, 0x26, 0x00, 0x30, 0x30, 0xf0, 0x00, 0x43, 0x1a, 0x21, 0x8d,
+	0x82, 0x01, 0x10, 0x10, 0x32, 0x03, 0xf0, 0x43, 0x30, 0xdc, 0x90, 0xbc,
+	0xcb, 0x47, 0x00, 0x90, 0x00, 0x00, 0x65, 0x7d, 0x05, 0x25, 0x03, 0x13,
+	0x10, 0xe4, 0xa5, 0x7c, 0x5f, 0x21, 0x4d, 0x02, 0x9b, 0x7e, 0x7b, 0x7c,
+	0xe5, 0x7e, 0x00, 0x26, 0x43, 0x33, 0xe3, 0x75, 0x85, 0x7f, 0x1b, 0x63,
+	0x13, 0x0b, 0x30, 0x30, 0x1d, 0x65, 0x80, 0x96, 0x80, 0xab, 0x60, 0x97,
+	0x82, 0x7b, 0x60, 0xad, 0x08, 0xf0, 0x80, 0x8b, 0x80, 0xb6, 0x60, 0x8b,
+	0x00, 0x15, 0xcc, 0x10, 0x9b, 0x63, 0x60, 0xb7, 0x04, 0x71, 0xab, 0x08,
+	0x54, 0x82, 0x65, 0x71, 0x01, 0x8a, 0x6c, 0x04, 0x62, 0xf7, 0x08, 0x65,
+	0x80, 0x0c, 0x70, 0x56, 0x01, 0x40, 0xe0, 0x78, 0xe4, 0xc0, 0x9e, 0x01,
+	0xf2, 0x23, 0x4c, 0x70, 0x13, 0xf0, 0x6c, 0x70, 0x0c, 0xf0, 0x5a, 0x22,
+	0x8c, 0x0c, 0x65, 0x71, 0x9d, 0x60, 0x5a, 0x23, 0x4c, 0x06, 0x64, 0x71,
+	0xbc, 0x64, 0x2c, 0x64, 0x5c, 0x1e, 0x02, 0x13, 0xeb, 0x0b, 0xb4, 0x80,
+	0x00, 0x23, 0x8e, 0x16, 0x44, 0x71, 0xdf, 0x0a, 0xb4, 0x80, 0x14, 0x26,
+	0x8b, 0x30, 0xc4, 0xc4, 0xc4, 0x00, 0xf2, 0x1d, 0xbc, 0xc1, 0x44, 0xc2,
+	0x42, 0xc1, 0x43, 0xc0, 0x00, 0x16, 0x0d, 0x71, 0x08, 0x90, 0xe0, 0x01,
+	0x2c, 0x71, 0xc6, 0x09, 0x60, 0x00, 0x78, 0x43, 0x00, 0x1e, 0x02, 0x70,
+	0x00, 0x80, 0x66, 0x06, 0x08, 0x46, 0x00, 0x16, 0x01, 0x70, 0x00, 0x80,
+	0x74, 0x06, 0x03, 0xc0, 0xb4, 0x04, 0x60, 0x04, 0x00, 0x4c, 0x71, 0xa6,
+	0x0c, 0xc2, 0x0c, 0xf0, 0x32, 0x56, 0x0a, 0x6f, 0xfe, 0xa1, 0x40, 0x8a,
+	0x20, 0x08, 0x00, 0xc3, 0x41, 0x09, 0x90, 0xf2, 0xe1, 0x00, 0xb1, 0xad,
+	0x70, 0x8a, 0x20, 0x10, 0x00, 0xa1, 0xb1, 0x02, 0xb1, 0x0c, 0x71, 0x44,
+	0x26, 0xc1, 0x17, 0x05, 0xe9, 0x61, 0xb9, 0xff, 0x09, 0x31, 0x80, 0x1b,
+	0x78, 0x00, 0x1e, 0x44, 0x73, 0x03, 0x90, 0xc4, 0xfe, 0x5a, 0x20, 0x00,
+	0x01, 0x2c, 0x71, 0x0f, 0x20, 0x80, 0x03, 0x0f, 0x78, 0x32, 0x28, 0x06,
+	0x50, 0xc0, 0x1a, 0x27, 0x8f, 0x1f, 0x96, 0x0e, 0x40, 0x04, 0xc0, 0x14,
+	0x72, 0x34, 0x06, 0xf0, 0x17, 0x04, 0xe0, 0x04, 0xf4, 0xa0, 0xb0, 0x04,
+	0xf0, 0x00, 0x18, 0xc4, 0x06, 0x84, 0x14, 0x00, 0x30, 0x47, 0xc0, 0x00,
+	0x16, 0x00, 0x71, 0x02, 0x90, 0x64, 0x01, 0x02, 0xc1, 0x6c, 0x20, 0xc0,
+	0x00, 0xae, 0x0f, 0x20, 0x00, 0x80, 0xb8, 0xb2, 0x09, 0xd2, 0xff, 0xff,
+	0x00, 0x41, 0x00, 0x42, 0x66, 0x09, 0xef, 0xfe, 0x00, 0x43, 0x92, 0xda,
+	0x05, 0xf4, 0x24, 0xff, 0x28, 0xda, 0x03, 0xc0, 0x92, 0xc1, 0x4c, 0x72,
+	0x55, 0x20, 0xc0, 0x08, 0x05, 0x7f, 0x46, 0xc7, 0x32, 0x0b, 0xef, 0xff,
+	0x06, 0xc0, 0x04, 0xc0, 0x14, 0x70, 0x83, 0xf2, 0x88, 0xc0, 0x8a, 0x21,
+	0x38, 0x00, 0xe6, 0x0f, 0x6f, 0xff, 0x14, 0xda, 0x0c, 0xca, 0x10, 0xd9,
+	0x20, 0x42, 0x44, 0x20, 0xc1, 0x07, 0xa4, 0x00, 0xf0, 0x07, 0x5b, 0x7a,
+	0x44, 0x20, 0xc3, 0x07, 0x2c, 0x71, 0x20, 0x40, 0x06, 0xeb, 0x61, 0xbb,
+	0x01, 0x0b, 0x31, 0x00, 0x1b, 0x78, 0x0f, 0x7c, 0x84, 0x03, 0x42, 0x66,
+	0x06, 0x62, 0x88, 0x08, 0x00, 0xf2, 0x17, 0xa1, 0x88, 0x93, 0x79, 0x99,
+	0x43, 0x0b, 0xf0, 0x54, 0x24, 0x0b, 0x39, 0x14, 0x7c, 0xf4, 0x23, 0x00,
+	0x10, 0xa5, 0x71, 0x24, 0x78, 0x42, 0x78, 0x00, 0xb4, 0xaf, 0x78, 0xed,
+	0x0b, 0x25, 0x80, 0x88, 0xc4, 0xcd, 0x70, 0x44, 0xf0, 0x2c, 0x00, 0x42,
+	0x01, 0x88, 0x14, 0x79, 0x0a, 0x00, 0x42, 0x04, 0x10, 0x8b, 0x00, 0x0a,
+	0x00, 0xc0, 0x43, 0x88, 0x26, 0xf0, 0x80, 0x91, 0x63, 0x74, 0x2f, 0x20,
+	0x06, 0x83, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x0f, 0x00, 0x00, 0x04, 0x22,
+	0x4d, 0x18, 0x60, 0x40, 0x82, 0x1b, 0x0f, 0x00, 0x00, 0xf0, 0xf7, 0x34,
+	0x00, 0x24, 0x00, 0x80, 0xb1, 0x29, 0x08, 0x13, 0x08, 0x1a, 0x23, 0x8f,
+	0x0f, 0x00, 0x00, 0x00, 0x10, 0x06, 0xc0, 0x05, 0x7f, 0x0a, 0x20, 0x80,
+	0x07, 0x9a, 0x20, 0x04, 0x00, 0xe5, 0x78, 0x1b, 0x78, 0x91, 0xb8, 0x9c,
+	0xb8, 0x9f, 0xb8, 0x80, 0xb0, 0x06, 0xf0, 0xc3, 0x40, 0x00, 0x00, 0x00,
+	0xfe, 0x00, 0xb1, 0x40, 0x26, 0x5e, 0x30, 0x24, 0x72, 0xc1, 0x0e, 0x94,
+	0xb0, 0x44, 0x71, 0x4f, 0x7b, 0xfb, 0x0b, 0xe5, 0x90, 0x4a, 0x26, 0x00,
+	0x30, 0xda, 0x0c, 0x8f, 0xff, 0x04, 0xc0, 0x02, 0xc2, 0x88, 0xc1, 0x79,
+	0x20, 0x43, 0x00, 0x5a, 0x0b, 0xef, 0xff, 0xa1, 0x40, 0xc5, 0x71, 0xcf,
+	0x7d, 0x7b, 0x0d, 0xf4, 0x97, 0x88, 0xc1, 0x06, 0xc0, 0x92, 0xc1, 0x4c,
+	0x71, 0xee, 0x0d, 0xe0, 0x00, 0x6c, 0x70, 0x07, 0xf0, 0x02, 0xc2, 0x0f,
+	0xd8, 0x92, 0xc1, 0x36, 0x0b, 0xef, 0xff, 0x6c, 0x70, 0xee, 0x0a, 0x6f,
+	0xff, 0x05, 0xc0, 0x00, 0x16, 0x01, 0x70, 0x00, 0x80, 0x74, 0x06, 0x03,
+	0xc0, 0x4c, 0x70, 0xce, 0x0a, 0x2f, 0xff, 0x6c, 0x70, 0x07, 0xc0, 0x1c,
+	0xe8, 0x04, 0xc0, 0x19, 0x08, 0xb1, 0x00, 0x2c, 0x74, 0x02, 0xc0, 0x03,
+	0xc2, 0x05, 0xc3, 0x40, 0xc0, 0x0c, 0x74, 0xc3, 0x41, 0x1f, 0x00, 0x03,
+	0x00, 0x0b, 0xf0, 0x02, 0xc0, 0x03, 0xc3, 0x41, 0xc0, 0x05, 0xc0, 0x95,
+	0xb9, 0x40, 0xc0, 0x04, 0xc0, 0x41, 0x68, 0x0c, 0x74, 0x2a, 0x09, 0x4f,
+	0xfe, 0x92, 0x0b, 0x6f, 0xfe, 0x02, 0xc0, 0xbc, 0xc0, 0x04, 0x14, 0x1b,
+	0x34, 0xc6, 0xc6, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0x82, 0x24, 0x06,
+	0x38, 0x42, 0xc0, 0x5f, 0x20, 0x40, 0x06, 0x43, 0xc1, 0x4a, 0xc2, 0x49,
+	0xc0, 0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x65, 0x06, 0x5f, 0x20, 0x81,
+	0x0c, 0x09, 0xc0, 0x38, 0x60, 0x00, 0x20, 0x80, 0x0f, 0x7a, 0x00, 0xf0,
+	0x25, 0x12, 0x88, 0x2c, 0x70, 0x47, 0xc0, 0x4e, 0x0f, 0x20, 0x00, 0x02,
+	0xc0, 0x18, 0x43, 0x02, 0xc0, 0x00, 0x16, 0x0f, 0x71, 0x08, 0x90, 0xe0,
+	0x01, 0x02, 0xc3, 0x00, 0x16, 0x8e, 0x70, 0x00, 0x80, 0x04, 0x00, 0x38,
+	0x23, 0x00, 0x30, 0xc3, 0x41, 0x1b, 0x00, 0x02, 0x00, 0x0e, 0x09, 0x2f,
+	0xfe, 0x63, 0x42, 0xc3, 0x40, 0x48, 0x00, 0xf4, 0x1d, 0x01, 0x18, 0xc2,
+	0x06, 0x0c, 0x71, 0x08, 0x45, 0x44, 0x23, 0xc0, 0x37, 0x06, 0xe8, 0x61,
+	0xb8, 0x01, 0x08, 0x31, 0x00, 0xbb, 0x7d, 0x8a, 0x21, 0x04, 0x00, 0x03,
+	0xc0, 0x5a, 0x25, 0x0d, 0x11, 0x1a, 0x26, 0x8e, 0x1f, 0x10, 0x00, 0x00,
+	0x00, 0x04, 0x20, 0x40, 0x80, 0xe6, 0x00, 0xc1, 0x4b, 0xc0, 0x05, 0xf2,
+	0x02, 0xc0, 0x4c, 0x70, 0x6c, 0x71, 0x04, 0xf0, 0x08, 0x00, 0xf2, 0x2a,
+	0x70, 0xda, 0x09, 0x0f, 0xff, 0x0f, 0x25, 0xc0, 0x16, 0x4c, 0xc0, 0x07,
+	0xc0, 0x84, 0x20, 0x3e, 0x00, 0x47, 0xc0, 0x7e, 0x0f, 0x2f, 0xfe, 0xe1,
+	0x40, 0x20, 0xd8, 0x00, 0x1e, 0x04, 0x70, 0x03, 0x90, 0x04, 0xe0, 0x8a,
+	0x20, 0x08, 0x00, 0xc3, 0x41, 0x09, 0x90, 0xf2, 0xe1, 0x00, 0xb1, 0x0c,
+	0x70, 0x8a, 0x22, 0x10, 0x00, 0x01, 0xb1, 0x42, 0xb1, 0x1e, 0x00, 0xc0,
+	0xc4, 0xfe, 0x0c, 0x73, 0x1e, 0x0d, 0x20, 0x00, 0x8a, 0x21, 0xc7, 0x0f,
+	0xa6, 0x01, 0xf2, 0x15, 0xff, 0xff, 0x00, 0x41, 0x00, 0x42, 0xd2, 0x0e,
+	0xaf, 0xfe, 0x00, 0x43, 0x8e, 0xc0, 0x8a, 0x21, 0x38, 0x00, 0x5a, 0xda,
+	0x76, 0x0d, 0x6f, 0xff, 0x8e, 0xc7, 0x02, 0xc0, 0x0c, 0x12, 0x9f, 0x30,
+	0x55, 0x20, 0x0c, 0x0c, 0xbe, 0x00, 0xf2, 0x03, 0x64, 0x88, 0xc5, 0x7c,
+	0x5f, 0x23, 0x80, 0x04, 0x1f, 0x67, 0x0c, 0x77, 0x0a, 0x26, 0x00, 0x30,
+	0x44, 0x27, 0xc6, 0x00, 0x82, 0xff, 0x08, 0x31, 0x80, 0x2f, 0x26, 0x80,
+	0x37, 0x26, 0x00, 0xf0, 0x0f, 0xa5, 0x88, 0x53, 0x26, 0x1e, 0x31, 0x26,
+	0xf0, 0x44, 0x27, 0xc2, 0x37, 0x06, 0xea, 0x61, 0xba, 0x01, 0x0a, 0x31,
+	0x00, 0x1b, 0x78, 0x40, 0x21, 0x4b, 0x00, 0x1a, 0x26, 0x82, 0x1f, 0x36,
+	0x02, 0xf0, 0x82, 0x9a, 0x21, 0x04, 0x00, 0x85, 0x7a, 0x45, 0x79, 0x3b,
+	0x79, 0x91, 0xb9, 0x9c, 0xb9, 0x9f, 0xb9, 0x40, 0x91, 0x04, 0x26, 0x81,
+	0x30, 0x38, 0x60, 0x5d, 0x79, 0x6c, 0x21, 0x01, 0x01, 0x38, 0x60, 0x02,
+	0x1f, 0x14, 0x10, 0x61, 0x41, 0xc3, 0x09, 0x74, 0x82, 0x8a, 0x20, 0x7f,
+	0x0c, 0x64, 0x71, 0x6f, 0x7e, 0xf7, 0x0d, 0xa5, 0x93, 0x2c, 0x70, 0x66,
+	0xca, 0xe6, 0xf0, 0x06, 0xc0, 0xd6, 0x0b, 0x60, 0x00, 0x0f, 0x78, 0x07,
+	0xc1, 0x25, 0x78, 0x0f, 0x79, 0x3e, 0x0f, 0xa0, 0x00, 0x04, 0xc0, 0x04,
+	0xc0, 0x9a, 0x0a, 0xaf, 0xff, 0x2c, 0x70, 0x0f, 0xd8, 0x9a, 0x0e, 0x2f,
+	0xfe, 0x0f, 0xd9, 0x0c, 0xca, 0x4c, 0x70, 0x45, 0xc2, 0x09, 0xf0, 0x55,
+	0x24, 0xc1, 0x3e, 0x5b, 0x61, 0x8e, 0xc1, 0x49, 0x61, 0x44, 0x71, 0x20,
+	0xab, 0x8c, 0x22, 0x02, 0x8d, 0xb8, 0xf7, 0x2c, 0x71, 0x44, 0x20, 0xc2,
+	0x07, 0x20, 0x40, 0x05, 0xea, 0x61, 0xba, 0xff, 0x0a, 0x31, 0x80, 0x1b,
+	0x78, 0x4d, 0xc0, 0xa7, 0xae, 0x02, 0xf2, 0x00, 0x80, 0x65, 0x06, 0x44,
+	0x88, 0x55, 0x24, 0xc0, 0x3e, 0x5f, 0x22, 0x81, 0x04, 0x3c, 0x60, 0xcc,
+	0x00, 0xf3, 0x01, 0x25, 0x88, 0x31, 0xf0, 0x03, 0xc0, 0x55, 0x08, 0x6e,
+	0x03, 0xa1, 0x40, 0x9a, 0x20, 0x08, 0x00, 0xf8, 0x02, 0xf0, 0x0c, 0x20,
+	0xc0, 0x9c, 0xe5, 0x78, 0x05, 0x20, 0x8f, 0x0f, 0x02, 0x90, 0x64, 0x00,
+	0x21, 0x0e, 0x12, 0x10, 0x0b, 0x26, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x1f,
+	0x0d, 0xf2, 0x52, 0x01, 0x40, 0x00, 0xfe, 0x00, 0xb4, 0x08, 0x00, 0xf0,
+	0x02, 0x1f, 0x1c, 0x0d, 0xf0, 0x00, 0x1f, 0x05, 0x10, 0x0a, 0xf0, 0x5e,
+	0x26, 0x00, 0x18, 0xc4, 0xbe, 0x04, 0x3e, 0x02, 0xf0, 0x00, 0x00, 0x00,
+	0xfc, 0xc5, 0x78, 0x00, 0xb7, 0xa5, 0x71, 0x85, 0x72, 0xa7, 0x0d, 0x54,
+	0x92, 0x16, 0x03, 0xe2, 0xf9, 0x09, 0xe5, 0x80, 0xad, 0x70, 0xc6, 0x09,
+	0x8f, 0xff, 0x86, 0x09, 0x0f, 0xfe, 0x7a, 0x00, 0xc2, 0x64, 0x88, 0x55,
+	0x24, 0xcf, 0x3e, 0xcb, 0x43, 0x00, 0x80, 0xdc, 0x06, 0x74, 0x01, 0x02,
+	0x18, 0x00, 0xc3, 0x05, 0x10, 0x9f, 0x00, 0x45, 0xf0, 0xad, 0x70, 0x4c,
+	0x70, 0x40, 0xf0, 0x94, 0x00, 0x20, 0x24, 0x81, 0x56, 0x01, 0xf1, 0x5b,
+	0x20, 0x25, 0x78, 0x05, 0x20, 0x80, 0x0f, 0x02, 0x90, 0x66, 0x01, 0x00,
+	0x90, 0x03, 0xc1, 0x8c, 0x21, 0x04, 0x80, 0xca, 0x22, 0x02, 0x00, 0x02,
+	0xf4, 0x1a, 0x62, 0x03, 0xc0, 0x49, 0x08, 0x6e, 0x03, 0xc0, 0x97, 0x2f,
+	0x26, 0x86, 0xf3, 0x38, 0x00, 0x04, 0x00, 0x06, 0xc0, 0x20, 0x14, 0x1e,
+	0x30, 0x10, 0x78, 0x0d, 0x08, 0x81, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x40,
+	0x13, 0x9e, 0x10, 0x2f, 0x26, 0x88, 0xf0, 0x0e, 0xf4, 0x05, 0xc0, 0x2f,
+	0x26, 0x87, 0x37, 0x14, 0x23, 0x00, 0x10, 0x21, 0x88, 0x08, 0x26, 0x41,
+	0x30, 0x21, 0xa8, 0x20, 0x88, 0x09, 0x26, 0x41, 0x30, 0x20, 0xa8, 0x80,
+	0x23, 0x41, 0x10, 0x0d, 0xc0, 0xa5, 0x71, 0x0f, 0x78, 0xd8, 0xa0, 0x01,
+	0xf0, 0x01, 0x85, 0x0d, 0x54, 0x92, 0x64, 0x71, 0x6f, 0x7c, 0x77, 0x0f,
+	0x25, 0xb3, 0x0f, 0xd8, 0x22, 0x0d, 0x78, 0x01, 0xf0, 0x07, 0x05, 0xc0,
+	0x04, 0x71, 0x45, 0xc0, 0x05, 0xc0, 0x9e, 0xe0, 0xb2, 0x06, 0xce, 0xff,
+	0x42, 0x0f, 0x2f, 0xff, 0x04, 0xc0, 0x15, 0xca, 0x72, 0x01, 0xff, 0x1b,
+	0xcd, 0x07, 0x20, 0x40, 0x08, 0xc1, 0x05, 0xed, 0x61, 0xbd, 0xff, 0x0d,
+	0x31, 0x90, 0x1b, 0x78, 0x38, 0x60, 0x46, 0xc0, 0x06, 0xc0, 0x0c, 0xc1,
+	0x10, 0x78, 0x48, 0xc0, 0x2f, 0x79, 0x67, 0xca, 0x44, 0xc1, 0x08, 0xc1,
+	0x10, 0x71, 0x24, 0x06, 0xce, 0xff, 0x72, 0x03, 0x05, 0x40, 0x32, 0x88,
+	0x52, 0x0d, 0xec, 0x01, 0xf4, 0x17, 0x0a, 0xc0, 0x11, 0xe8, 0x03, 0xc0,
+	0x02, 0xc3, 0xc3, 0x41, 0x1d, 0x00, 0x04, 0x00, 0x41, 0xc0, 0x04, 0xc0,
+	0x4c, 0x72, 0x40, 0xc0, 0x5a, 0x0d, 0x2f, 0xfe, 0x0c, 0x74, 0xbe, 0x0f,
+	0x2f, 0xfe, 0x03, 0xc0, 0x0b, 0xc0, 0x0a, 0xe8, 0x3c, 0x03, 0x00, 0x30,
+	0x03, 0xa2, 0xae, 0x0e, 0xef, 0xfe, 0x6c, 0x70, 0x80, 0x24, 0x06, 0x38,
+	0xea, 0x03, 0xf0, 0x2b, 0xe0, 0x78, 0xe6, 0xc2, 0x10, 0x12, 0x8d, 0x30,
+	0xcd, 0x70, 0xed, 0x70, 0x10, 0x1a, 0x82, 0x33, 0x09, 0xf0, 0xf0, 0x26,
+	0xc0, 0x73, 0x00, 0x80, 0xa4, 0x1c, 0xd2, 0x08, 0x40, 0x00, 0xe5, 0x71,
+	0x36, 0xcc, 0xf1, 0x0f, 0x04, 0x90, 0x10, 0x1a, 0x42, 0x33, 0x36, 0x1a,
+	0x9c, 0x33, 0xc6, 0xc6, 0xe0, 0x78, 0xc3, 0x43, 0x08, 0x90, 0xea, 0x01,
+	0x40, 0x93, 0xe6, 0x04, 0x01, 0x02, 0x04, 0x60, 0x00, 0x00, 0xfe, 0x04,
+	0x22, 0x82, 0x3c, 0x01, 0xf0, 0x32, 0xc0, 0x45, 0x78, 0x41, 0x93, 0x00,
+	0xb3, 0x62, 0xb9, 0x6c, 0x22, 0x40, 0x01, 0x25, 0x78, 0xe0, 0x7f, 0x01,
+	0xb3, 0xe0, 0x78, 0xe2, 0xc2, 0x00, 0x16, 0x0d, 0x71, 0x00, 0x80, 0x06,
+	0x00, 0x6d, 0xe5, 0x85, 0x2d, 0x81, 0x1b, 0x53, 0x25, 0x41, 0x90, 0x05,
+	0xf2, 0xaf, 0x78, 0x4e, 0x21, 0x0d, 0x01, 0x1d, 0x65, 0xaf, 0x7a, 0xc3,
+	0x41, 0x47, 0x01, 0x01, 0x00, 0xa6, 0x0c, 0x2f, 0xfe, 0x0a, 0xd8, 0xd6,
+	0x01, 0x60, 0x64, 0x06, 0xa0, 0xa8, 0xc2, 0xc6, 0x98, 0x00, 0xf1, 0x1a,
+	0x6f, 0x26, 0xc3, 0x15, 0x40, 0x8e, 0x08, 0x45, 0x17, 0xea, 0x7a, 0x08,
+	0x2f, 0xff, 0x40, 0x40, 0x08, 0x47, 0x87, 0xe8, 0xc3, 0x41, 0x6e, 0x01,
+	0x01, 0x00, 0xc6, 0x0c, 0xef, 0xfd, 0x0c, 0x70, 0xe1, 0x40, 0x9a, 0x20,
+	0x01, 0x00, 0x05, 0x7f, 0xbb, 0xec, 0x01, 0xd1, 0x03, 0x90, 0x92, 0xfe,
+	0xe0, 0xb0, 0xff, 0x16, 0x82, 0x90, 0x18, 0xea, 0x4a, 0x30, 0x00, 0xf1,
+	0x00, 0x8c, 0x22, 0xc3, 0x8f, 0x09, 0xf2, 0x88, 0xe8, 0xc3, 0x41, 0x6f,
+	0x01, 0x01, 0x00, 0x92, 0x34, 0x00, 0x20, 0x0c, 0x70, 0x34, 0x00, 0xc0,
+	0xbb, 0x79, 0x05, 0x21, 0x81, 0x0f, 0x03, 0x90, 0x9a, 0xfe, 0x00, 0xb1,
+	0xd4, 0x00, 0xf3, 0x18, 0xf1, 0xc0, 0x00, 0x16, 0x82, 0x70, 0x00, 0x80,
+	0x09, 0x00, 0x1a, 0xea, 0x23, 0x0a, 0x30, 0x0a, 0x0c, 0x72, 0x8c, 0x22,
+	0x03, 0x8c, 0x0c, 0xf2, 0xf8, 0xe2, 0x04, 0xf4, 0x0c, 0x71, 0x09, 0xf0,
+	0xc3, 0x41, 0x70, 0x01, 0x01, 0x00, 0x52, 0x42, 0x00, 0x60, 0x5f, 0x20,
+	0x01, 0x04, 0x25, 0x78, 0x40, 0x04, 0x82, 0x05, 0x90, 0xa0, 0xe0, 0xd1,
+	0xc0, 0xe0, 0x7e, 0x30, 0x05, 0xf1, 0x02, 0xa2, 0xc1, 0x28, 0x46, 0x09,
+	0x20, 0x41, 0x00, 0xb7, 0x0a, 0x65, 0x00, 0x48, 0x47, 0x00, 0x16, 0x81,
+	0xfc, 0x04, 0xf0, 0x2f, 0xcb, 0x45, 0x00, 0x80, 0x74, 0x04, 0xe2, 0x78,
+	0x1a, 0x21, 0x81, 0x0f, 0x20, 0x00, 0x00, 0x00, 0xf4, 0x25, 0xc3, 0x13,
+	0xf4, 0x25, 0x02, 0x10, 0x41, 0xc0, 0x40, 0xc1, 0x0c, 0x75, 0xc3, 0x41,
+	0x60, 0x00, 0x02, 0x00, 0xa6, 0x0b, 0x2f, 0xfe, 0x38, 0x43, 0xe2, 0x7e,
+	0xf4, 0x25, 0x83, 0x13, 0xf4, 0x25, 0xc2, 0x13, 0x4f, 0x23, 0x01, 0x34,
+	0x92, 0x0b, 0x2f, 0xfe, 0x0c, 0x75, 0x12, 0x01, 0xf1, 0x12, 0x67, 0x06,
+	0x01, 0x10, 0x8b, 0x00, 0x40, 0x88, 0xc3, 0x43, 0x00, 0x80, 0xa8, 0x04,
+	0x26, 0xf0, 0x01, 0xc0, 0x6c, 0x66, 0x44, 0x71, 0x9a, 0x24, 0x01, 0x10,
+	0x68, 0x60, 0x05, 0x7c, 0x1a, 0x21, 0x80, 0x7e, 0x06, 0xf1, 0x1c, 0x9a,
+	0x21, 0x08, 0x00, 0x04, 0x20, 0x8d, 0x0f, 0x0f, 0x00, 0x00, 0xe0, 0x00,
+	0xc0, 0x84, 0x21, 0x08, 0x00, 0xa5, 0x78, 0x05, 0x79, 0xc3, 0x40, 0x02,
+	0x90, 0x82, 0x00, 0x05, 0x21, 0x0d, 0x00, 0x80, 0xb5, 0x14, 0xe0, 0x05,
+	0x21, 0x0c, 0x00, 0x69, 0x67, 0x20, 0x38, 0x01, 0xf0, 0x06, 0x25, 0x78,
+	0x00, 0xb4, 0x4f, 0x79, 0xb7, 0x0b, 0x65, 0x90, 0x0c, 0x71, 0x08, 0xf0,
+	0xc3, 0x41, 0x5f, 0x00, 0x00, 0x00, 0x1e, 0x74, 0x00, 0x44, 0x74, 0x0c,
+	0x70, 0xa2, 0x08, 0x06, 0xf0, 0x0e, 0xc0, 0x28, 0x43, 0xed, 0x70, 0xc3,
+	0x41, 0x03, 0x90, 0x64, 0xff, 0xe0, 0xb1, 0x04, 0x19, 0x45, 0x00, 0xc3,
+	0x42, 0x00, 0x80, 0x69, 0x06, 0x21, 0x8a, 0xc0, 0x8a, 0x39, 0xf0, 0x60,
+	0x01, 0x51, 0x18, 0xf4, 0x1a, 0x26, 0x83, 0x72, 0x03, 0xf3, 0x21, 0xc3,
+	0x42, 0x02, 0x90, 0x64, 0x1f, 0x05, 0x23, 0x8c, 0x00, 0x44, 0x74, 0x65,
+	0x7a, 0x00, 0xb4, 0x51, 0x0b, 0x3f, 0x12, 0xe0, 0xb2, 0xc3, 0x42, 0x03,
+	0x90, 0x64, 0xf1, 0xe0, 0xb2, 0x04, 0x1a, 0x45, 0x00, 0x20, 0xf0, 0x0a,
+	0x26, 0xc0, 0x32, 0x8d, 0x70, 0x16, 0xf0, 0x53, 0xf7, 0x81, 0x43, 0x00,
+	0x05, 0x71, 0x20, 0x9a, 0x23, 0x08, 0x00, 0x45, 0x7b, 0x3e, 0x00, 0xf2,
+	0x1e, 0x01, 0x05, 0x23, 0x8d, 0x00, 0x44, 0x74, 0x45, 0x7b, 0x00, 0xb5,
+	0x00, 0x1b, 0x05, 0x00, 0x85, 0x71, 0x0d, 0x0e, 0x10, 0x30, 0xd5, 0x0c,
+	0x74, 0x92, 0x2f, 0x26, 0x82, 0xb7, 0xc5, 0x71, 0x93, 0x09, 0xa5, 0x83,
+	0x2f, 0x22, 0xc7, 0x02, 0xc6, 0xc4, 0xe2, 0xc2, 0xa4, 0xc1, 0x1c, 0x03,
+	0xf5, 0x08, 0x7d, 0x05, 0x2c, 0x70, 0x4c, 0x75, 0x43, 0xc0, 0xff, 0xd8,
+	0x08, 0xdb, 0x28, 0x45, 0x42, 0xc1, 0x41, 0xc1, 0x6a, 0x0d, 0xef, 0xfd,
+	0x40, 0x1e, 0x00, 0x22, 0x10, 0xd9, 0x1e, 0x00, 0x70, 0x0c, 0xdb, 0x42,
+	0xc5, 0x41, 0xc5, 0x4e, 0x1c, 0x00, 0xb0, 0xc5, 0xff, 0xd8, 0x80, 0xd9,
+	0x4c, 0x75, 0x6c, 0x72, 0x43, 0xc5, 0x14, 0x00, 0x11, 0x3a, 0x14, 0x00,
+	0x20, 0xa4, 0xc0, 0x74, 0x02, 0x80, 0xe4, 0xc2, 0xa4, 0xc1, 0xad, 0x70,
+	0xff, 0xd8, 0x54, 0x00, 0x22, 0x6c, 0x73, 0x20, 0x00, 0x11, 0x1a, 0x20,
+	0x00, 0xf0, 0x07, 0xcb, 0x46, 0x00, 0x80, 0x7d, 0x05, 0x00, 0x8e, 0x25,
+	0x08, 0xb4, 0x00, 0x2c, 0x70, 0x04, 0x71, 0x1d, 0x78, 0x62, 0xb8, 0x0f,
+	0x78, 0x78, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x48, 0x00, 0x80, 0xf2, 0x0c,
+	0xef, 0xfd, 0x40, 0xc5, 0x00, 0x8e, 0x14, 0x00, 0x00, 0x40, 0x00, 0x11,
+	0x08, 0x72, 0x00, 0x13, 0xde, 0x16, 0x00, 0x19, 0x08, 0x88, 0x00, 0x00,
+	0xc0, 0x02, 0x50, 0x40, 0xc5, 0xa4, 0xc0, 0xc4, 0x50, 0x03, 0xf4, 0x1c,
+	0x42, 0x04, 0x90, 0x10, 0x01, 0x00, 0x92, 0x4f, 0x20, 0x01, 0x01, 0xa4,
+	0xb8, 0x20, 0xb2, 0xe0, 0x7f, 0x00, 0xb2, 0xe2, 0xc2, 0x00, 0x42, 0x36,
+	0x0d, 0x6f, 0xfe, 0x20, 0x40, 0x08, 0x44, 0x6c, 0x70, 0x6f, 0x78, 0x1b,
+	0x79, 0x44, 0x21, 0xcd, 0x07, 0x81, 0x41, 0x34, 0x04, 0xb5, 0x3d, 0x79,
+	0xc1, 0xb9, 0xeb, 0x09, 0xa1, 0x80, 0x64, 0x71, 0xc2, 0xac, 0x07, 0xf3,
+	0x2c, 0x02, 0x30, 0x4f, 0xc2, 0x5a, 0xc1, 0x4b, 0xc0, 0x9e, 0xc0, 0x2c,
+	0x70, 0xb2, 0x0e, 0x2f, 0xff, 0x4c, 0x76, 0x0b, 0xc0, 0x22, 0x0f, 0xef,
+	0xfd, 0x9e, 0xc1, 0x13, 0xca, 0x07, 0xe8, 0x0b, 0xc0, 0x4e, 0x0a, 0x20,
+	0x00, 0x0f, 0xc1, 0x3d, 0x02, 0x00, 0x00, 0x0c, 0x70, 0x4e, 0xc0, 0x0f,
+	0xc0, 0x79, 0x20, 0x40, 0x00, 0x1b, 0x78, 0x1b, 0x78, 0x04, 0x72, 0x56,
+	0xda, 0x07, 0x42, 0x0e, 0x00, 0x1d, 0x78, 0x02, 0x00, 0xf1, 0x10, 0x44,
+	0x20, 0x41, 0x80, 0x16, 0xc0, 0xca, 0x20, 0xa1, 0x00, 0x56, 0xc0, 0x0b,
+	0xca, 0x05, 0x21, 0x3e, 0x80, 0x0c, 0x74, 0x58, 0xc0, 0xca, 0x20, 0x61,
+	0x00, 0x58, 0xc0, 0x10, 0xd8, 0x57, 0x0a, 0x00, 0xf0, 0x35, 0x57, 0xc0,
+	0x0c, 0x70, 0x4d, 0xc0, 0xdb, 0xf0, 0x0e, 0xc0, 0x38, 0x60, 0xe1, 0x88,
+	0xa0, 0x88, 0x0b, 0xc0, 0xe1, 0x42, 0x76, 0x0d, 0x20, 0x00, 0xa1, 0x41,
+	0x08, 0x46, 0x42, 0x50, 0x03, 0xca, 0x29, 0x09, 0x04, 0x00, 0x02, 0xca,
+	0x25, 0x08, 0x64, 0x00, 0xa1, 0x43, 0x1a, 0xc0, 0x0e, 0xc2, 0xc3, 0x41,
+	0x4b, 0x00, 0x06, 0x00, 0x43, 0xc0, 0x17, 0xc0, 0x40, 0xc7, 0x42, 0xc0,
+	0x18, 0xc0, 0x41, 0xc0, 0xb2, 0x08, 0xa8, 0x04, 0xf1, 0x4c, 0x0c, 0x70,
+	0x5d, 0xc0, 0x17, 0xc0, 0x60, 0x14, 0x1b, 0x30, 0x50, 0xc0, 0x1a, 0xc0,
+	0x59, 0xc0, 0x94, 0xf0, 0xaf, 0x78, 0x4c, 0xc0, 0x0f, 0xc0, 0x4a, 0xc6,
+	0x14, 0x71, 0x0c, 0x70, 0x52, 0xc0, 0x53, 0xc0, 0x26, 0xf2, 0x0c, 0xc0,
+	0x2f, 0x25, 0xc8, 0x16, 0xa2, 0x78, 0x0f, 0x79, 0xef, 0x78, 0x4a, 0xc0,
+	0x0b, 0xc0, 0x0e, 0x0d, 0x20, 0x00, 0x0a, 0xc2, 0x53, 0xc0, 0x0c, 0xc0,
+	0x0a, 0xc2, 0xb8, 0x60, 0x0f, 0x79, 0xfe, 0x0c, 0x20, 0x00, 0x0b, 0xc0,
+	0x52, 0xc0, 0x13, 0xc0, 0x0f, 0x0e, 0x25, 0x10, 0xb3, 0x78, 0x13, 0xc1,
+	0x4a, 0xc1, 0x0a, 0xf0, 0x12, 0x0e, 0x00, 0xf1, 0x08, 0x0c, 0x70, 0x12,
+	0xc0, 0x4a, 0xc0, 0x63, 0x40, 0x02, 0xf0, 0x4a, 0xc6, 0x0e, 0x78, 0x5c,
+	0xc0, 0x0c, 0xc0, 0x1c, 0xc5, 0x1d, 0x65, 0xef, 0x64, 0x00, 0x10, 0x0d,
+	0x24, 0x09, 0xf1, 0x19, 0x70, 0x0c, 0x70, 0x51, 0xc1, 0x23, 0xf0, 0x10,
+	0xc0, 0x10, 0x7f, 0x0c, 0xc0, 0xe2, 0x78, 0x0f, 0x7a, 0xaf, 0x78, 0x5b,
+	0xc0, 0x0b, 0xc0, 0xaa, 0x0c, 0x20, 0x00, 0x1b, 0xc1, 0x51, 0xc0, 0x0c,
+	0xc0, 0x1b, 0xc1, 0xf8, 0x60, 0x0f, 0x7a, 0x9a, 0x64, 0x00, 0xf0, 0x43,
+	0x11, 0xc2, 0x0a, 0xc1, 0x0f, 0x09, 0xa5, 0x00, 0xf3, 0x79, 0x11, 0xc2,
+	0x4a, 0xc2, 0x07, 0xf0, 0x0a, 0xc1, 0x0b, 0x09, 0x25, 0x00, 0x2c, 0x70,
+	0x10, 0xc1, 0x4a, 0xc0, 0x0c, 0xc7, 0x12, 0x12, 0x02, 0x36, 0x03, 0x12,
+	0x83, 0x30, 0x2e, 0x79, 0x37, 0x0a, 0xe4, 0x00, 0x3f, 0x67, 0x02, 0x12,
+	0x83, 0x30, 0x2b, 0x0b, 0xa4, 0x00, 0xef, 0x7b, 0x45, 0xc0, 0x12, 0xc0,
+	0x11, 0xc2, 0x41, 0xc1, 0x43, 0xc0, 0x13, 0xc0, 0x46, 0xc2, 0xaf, 0x7a,
+	0x42, 0xc0, 0x1c, 0xc0, 0xc3, 0x41, 0x50, 0x00, 0x09, 0x00, 0x9c, 0x09,
+	0xf0, 0x33, 0xa6, 0x0f, 0xef, 0xfd, 0x44, 0xc6, 0x1d, 0xc0, 0x04, 0x71,
+	0x53, 0x20, 0x7e, 0x80, 0x5d, 0xc0, 0x05, 0xf4, 0x10, 0xc0, 0x67, 0x77,
+	0x64, 0xb8, 0x50, 0xc0, 0x19, 0xc0, 0x0a, 0xc6, 0x04, 0x77, 0x59, 0xc0,
+	0x10, 0xc0, 0x0e, 0x78, 0x48, 0x20, 0x40, 0x00, 0x50, 0xc0, 0x2f, 0x20,
+	0xc6, 0x06, 0x48, 0x20, 0x5b, 0x00, 0x19, 0xc0, 0x2f, 0x26, 0x07, 0xf0,
+	0x6b, 0xf5, 0x0d, 0xc0, 0x2d, 0x08, 0x85, 0x03, 0x72, 0x01, 0x11, 0x1f,
+	0x72, 0x01, 0xf6, 0x4d, 0x17, 0x08, 0x64, 0x00, 0x0c, 0x74, 0x0e, 0xc2,
+	0x0d, 0xc3, 0xc3, 0x41, 0x51, 0x00, 0x03, 0x00, 0x4a, 0x0f, 0xef, 0xfd,
+	0x40, 0xc6, 0x55, 0xc5, 0x54, 0xc7, 0x4d, 0xc6, 0x0e, 0xc0, 0x04, 0x72,
+	0x4e, 0xc0, 0x0e, 0xc1, 0x16, 0xc0, 0x10, 0x71, 0x48, 0x06, 0xe5, 0xff,
+	0x9e, 0xc1, 0xc3, 0x41, 0x52, 0x00, 0x00, 0x00, 0x76, 0x0f, 0xaf, 0xfd,
+	0x0d, 0xc0, 0x0f, 0xc0, 0x0f, 0x08, 0x50, 0x00, 0x15, 0xc1, 0x0b, 0xc0,
+	0x6f, 0xb9, 0x3f, 0x18, 0x42, 0x00, 0x0f, 0xc0, 0x0d, 0x08, 0x90, 0x00,
+	0x0b, 0xc1, 0x14, 0xc0, 0x40, 0x19, 0x02, 0x00, 0x80, 0x24, 0x02, 0x30,
+	0x34, 0x06, 0x02, 0x20, 0x0a, 0xf0, 0xa3, 0x02, 0x38, 0x47, 0xc1, 0x08,
+	0x45, 0x88, 0xc0, 0x2c, 0x70, 0x42, 0x0c, 0x2f, 0xff, 0x80, 0xda, 0x4c,
+	0x70, 0xcd, 0x70, 0x42, 0xc2, 0x2b, 0xf0, 0x80, 0x88, 0x61, 0x88, 0x81,
+	0x40, 0x15, 0xf0, 0xf8, 0x60, 0x00, 0x10, 0x8b, 0x00, 0x65, 0x71, 0x00,
+	0x18, 0xc2, 0x02, 0x6d, 0x71, 0x15, 0xca, 0x44, 0x20, 0xdb, 0x07, 0x61,
+	0x40, 0x11, 0x0b, 0x10, 0x30, 0x42, 0x23, 0x5b, 0x30, 0xff, 0x0b, 0x31,
+	0xb0, 0x1b, 0x78, 0xf8, 0x60, 0x10, 0x7f, 0xd9, 0x0b, 0xe5, 0x83, 0x88,
+	0xc0, 0x90, 0x4b, 0x14, 0x77, 0x04, 0x71, 0xca, 0x20, 0x2c, 0x00, 0x2f,
+	0x24, 0x07, 0x90, 0x06, 0xf2, 0x4f, 0x7b, 0x24, 0x71, 0x70, 0x74, 0xca,
+	0x22, 0x0d, 0x00, 0xc5, 0x71, 0xb1, 0x0e, 0xf4, 0x97, 0x14, 0x25, 0x80,
+	0x13, 0x0c, 0x70, 0x8d, 0x70, 0xcd, 0x70, 0x18, 0x43, 0x44, 0xc0, 0x46,
+	0xc0, 0x1f, 0xf0, 0x60, 0x88, 0x01, 0x88, 0x62, 0x78, 0x61, 0x68, 0x14,
+	0x77, 0x0f, 0xca, 0x70, 0x7b, 0xca, 0x23, 0x2c, 0x00, 0x1f, 0x63, 0x4f,
+	0x78, 0x25, 0x08, 0xe5, 0x03, 0x6a, 0x7b, 0x04, 0xc0, 0x70, 0x7b, 0x00,
+	0x26, 0xce, 0x90, 0x8c, 0x7b, 0x41, 0x20, 0x00, 0x80, 0x44, 0xc0, 0x06,
+	0xc0, 0x00, 0x23, 0xdb, 0xb0, 0x0c, 0x00, 0x60, 0x46, 0xc0, 0x85, 0x71,
+	0xc9, 0x0c, 0x50, 0x00, 0xf2, 0x21, 0x00, 0x13, 0x67, 0xca, 0x66, 0x12,
+	0x82, 0x30, 0xed, 0x70, 0x6c, 0x70, 0x43, 0xc3, 0x45, 0xc3, 0x2d, 0xf0,
+	0x6a, 0x62, 0x0f, 0x12, 0x8c, 0x30, 0x00, 0x24, 0x8b, 0x10, 0x2f, 0x7c,
+	0x3b, 0x0c, 0xc5, 0x12, 0x1f, 0x22, 0x8c, 0x00, 0x1f, 0xda, 0x1a, 0x24,
+	0xdf, 0x10, 0x0a, 0x26, 0xc0, 0x37, 0xc0, 0x09, 0xf1, 0x46, 0x2f, 0x26,
+	0x81, 0x37, 0x03, 0xc2, 0x00, 0x22, 0xc2, 0x87, 0x43, 0xc2, 0x05, 0xc2,
+	0x01, 0x22, 0x82, 0x87, 0x45, 0xc2, 0x02, 0xc2, 0x00, 0x22, 0x02, 0x83,
+	0x41, 0x27, 0x0f, 0x90, 0x42, 0xc2, 0x15, 0x12, 0x8c, 0x30, 0x4c, 0x71,
+	0xc4, 0xbc, 0x06, 0xec, 0x61, 0xbc, 0x01, 0x0c, 0x31, 0x10, 0x5b, 0x7a,
+	0x7a, 0x62, 0x50, 0x7b, 0xa7, 0x08, 0xe5, 0x80, 0x88, 0xc2, 0x12, 0xc8,
+	0x03, 0x12, 0x81, 0x30, 0x25, 0x08, 0x44, 0x00, 0x02, 0x12, 0x81, 0x30,
+	0x1d, 0x09, 0x24, 0x00, 0x63, 0x42, 0x02, 0xc0, 0xc3, 0x41, 0x46, 0xc0,
+	0x07, 0xf0, 0x4d, 0x03, 0xc0, 0xc1, 0x43, 0x40, 0xc0, 0x9a, 0x0d, 0xef,
+	0xfd, 0x0c, 0x74, 0x02, 0xc0, 0x04, 0xc1, 0xe5, 0x78, 0xc5, 0x79, 0x79,
+	0x20, 0x00, 0x00, 0x79, 0x21, 0x01, 0x00, 0x24, 0x78, 0xc3, 0x41, 0x47,
+	0x00, 0x00, 0x00, 0xca, 0x0d, 0x8f, 0xfd, 0x06, 0xc1, 0x04, 0xc3, 0x63,
+	0x40, 0x8a, 0x0c, 0xaf, 0xfd, 0xc1, 0x42, 0x08, 0x46, 0x03, 0xc0, 0x05,
+	0xc1, 0x02, 0xc2, 0x7a, 0x0c, 0xaf, 0xfd, 0xe1, 0x43, 0x07, 0xc1, 0x15,
+	0x09, 0x70, 0x00, 0x00, 0x43, 0x42, 0x26, 0xc1, 0x13, 0x3f, 0x1d, 0x42,
+	0x10, 0x07, 0xc1, 0x09, 0x09, 0x90, 0x00, 0x40, 0x1d, 0xc2, 0x10, 0x22,
+	0x02, 0x11, 0x35, 0x22, 0x02, 0xf1, 0x00, 0x31, 0x08, 0x64, 0x00, 0xcf,
+	0x7a, 0x6f, 0x7b, 0xc3, 0x41, 0x48, 0x00, 0x02, 0x00, 0x2a, 0x6e, 0x00,
+	0xf1, 0x06, 0x40, 0x15, 0x80, 0x10, 0x3f, 0x15, 0xc3, 0x10, 0x3e, 0x15,
+	0x82, 0x10, 0x40, 0xc0, 0xc3, 0x41, 0x49, 0x00, 0x03, 0x00, 0x12, 0x1a,
+	0x00, 0x53, 0x0f, 0xca, 0x80, 0x24, 0x02, 0x2e, 0x08, 0xf0, 0x33, 0xe6,
+	0xc2, 0xde, 0x08, 0x6f, 0xfe, 0x48, 0x45, 0x3f, 0x15, 0x81, 0x10, 0x00,
+	0x43, 0x40, 0x21, 0xce, 0x03, 0xc9, 0x44, 0x2f, 0x22, 0x07, 0x83, 0x0e,
+	0xf2, 0x5b, 0x78, 0xb8, 0x60, 0xff, 0x10, 0x8f, 0x80, 0x40, 0x15, 0x8b,
+	0x10, 0x11, 0x0f, 0xe4, 0x12, 0x85, 0x77, 0xfe, 0x10, 0x80, 0x80, 0xe5,
+	0x0b, 0x05, 0x90, 0xcf, 0x7c, 0x1f, 0x0c, 0xb5, 0x17, 0x0c, 0x72, 0x94,
+	0x78, 0xb8, 0x60, 0xe1, 0x88, 0x20, 0x00, 0xf4, 0x11, 0x0f, 0x0f, 0xe4,
+	0x12, 0xc5, 0x71, 0x00, 0x88, 0xe9, 0x0b, 0x05, 0x90, 0x1f, 0x49, 0x0f,
+	0x79, 0x50, 0x49, 0x0f, 0x7a, 0x30, 0x4c, 0x0f, 0x78, 0x09, 0x20, 0x82,
+	0x00, 0x0c, 0xca, 0xc4, 0xb8, 0x0c, 0x0c, 0xf0, 0x01, 0x5b, 0x7a, 0x4f,
+	0x79, 0x00, 0x8b, 0x07, 0x09, 0x05, 0x00, 0x40, 0xab, 0xc6, 0xc6, 0x8c,
+	0x20, 0xce, 0x07, 0xf4, 0x01, 0x21, 0x08, 0xd1, 0x01, 0xc3, 0x41, 0x04,
+	0x90, 0x38, 0x02, 0x00, 0x19, 0x45, 0x00, 0x06, 0xf0, 0x0c, 0x00, 0xf0,
+	0x11, 0x05, 0x01, 0x00, 0x19, 0x05, 0x00, 0x10, 0x12, 0x81, 0x30, 0x03,
+	0xe9, 0x19, 0x00, 0x00, 0x00, 0xc3, 0x41, 0x18, 0x90, 0x64, 0x00, 0x00,
+	0xb1, 0x55, 0x00, 0x20, 0x00, 0x02, 0x19, 0x05, 0x00, 0x88, 0x08, 0xf0,
+	0x07, 0x08, 0x45, 0x10, 0xca, 0x12, 0xe8, 0x36, 0xcc, 0x8c, 0x20, 0x10,
+	0x80, 0x85, 0xf7, 0x6e, 0x0e, 0xcf, 0xfd, 0x36, 0xcc, 0x15, 0x26, 0x3e,
+	0x0d, 0xc2, 0xa4, 0x1c, 0x04, 0x71, 0xa0, 0xa1, 0x36, 0x1a, 0x1c, 0x30,
+	0xc2, 0xc6, 0x3a, 0x00, 0xf2, 0x03, 0xa0, 0xb1, 0xa1, 0x40, 0x10, 0xdd,
+	0x61, 0xbd, 0x01, 0x0d, 0x31, 0x10, 0x1d, 0x78, 0x02, 0xb1, 0x0e, 0x08,
+	0x48, 0x00, 0x02, 0x20, 0x00, 0xf0, 0x03, 0x08, 0x00, 0x00, 0x91, 0xff,
+	0x08, 0x1f, 0x80, 0x5e, 0x19, 0x45, 0x00, 0x00, 0x91, 0x01, 0x08, 0x1e,
+	0x00, 0x04, 0x08, 0x22, 0x08, 0x47, 0x94, 0x06, 0xf0, 0x53, 0x01, 0x00,
+	0x3b, 0x08, 0x3f, 0x01, 0x28, 0x45, 0x10, 0xca, 0xf0, 0x7e, 0x0a, 0xe8,
+	0x36, 0xcc, 0x8a, 0x21, 0x10, 0x00, 0x02, 0x79, 0x02, 0x6e, 0x30, 0x70,
+	0xf8, 0x0d, 0xca, 0xfd, 0x3a, 0x0f, 0xef, 0xff, 0x08, 0xd8, 0x76, 0x0f,
+	0xef, 0xff, 0xe1, 0x40, 0xed, 0x70, 0x07, 0xf0, 0x6a, 0x0f, 0xef, 0xff,
+	0x04, 0x15, 0x00, 0x14, 0xe5, 0x71, 0xf9, 0x0f, 0x84, 0x93, 0xc6, 0xc6,
+	0x8d, 0x70, 0x6c, 0x70, 0x09, 0xf0, 0x00, 0x21, 0x80, 0x06, 0x6e, 0x10,
+	0x81, 0x00, 0x15, 0x09, 0xa5, 0x00, 0x64, 0x71, 0x30, 0x4a, 0x6f, 0x79,
+	0xef, 0x09, 0xb4, 0x80, 0x0f, 0x7a, 0x07, 0xf0, 0x70, 0x10, 0x8c, 0x00,
+	0xfc, 0x07, 0x60, 0x45, 0x7c, 0xe0, 0x7f, 0x8f, 0x78, 0x28, 0x09, 0x00,
+	0x8c, 0x03, 0xf0, 0x1d, 0xa5, 0xc1, 0x08, 0x45, 0x40, 0x24, 0x40, 0x34,
+	0x41, 0xc0, 0x40, 0x24, 0xc0, 0x34, 0x6c, 0x70, 0x40, 0xc0, 0xa1, 0x40,
+	0x58, 0x43, 0x28, 0x46, 0x13, 0x1c, 0xc2, 0x30, 0x12, 0x1c, 0xc2, 0x30,
+	0x11, 0x1c, 0xc2, 0x30, 0x7e, 0x0b, 0x2f, 0xfe, 0x64, 0xc3, 0x84, 0xc0,
+	0x24, 0x00, 0x20, 0x80, 0x34, 0x22, 0x00, 0xf0, 0x21, 0xc1, 0x41, 0x63,
+	0x42, 0x66, 0x0b, 0x2f, 0xfe, 0x6c, 0x71, 0x12, 0x14, 0x83, 0x30, 0x13,
+	0x14, 0x82, 0x30, 0x14, 0xc8, 0x24, 0xc5, 0x09, 0x22, 0xc1, 0x00, 0x1a,
+	0x21, 0x0c, 0x00, 0x11, 0x14, 0x80, 0x30, 0x43, 0xc0, 0x09, 0x20, 0x4f,
+	0x03, 0x18, 0xc8, 0xec, 0x78, 0x98, 0x60, 0x42, 0xc0, 0xbe, 0x02, 0xf0,
+	0x29, 0x8c, 0x30, 0x43, 0x08, 0x04, 0x03, 0x02, 0x12, 0x8c, 0x30, 0x3b,
+	0x0c, 0x24, 0x10, 0x0c, 0x74, 0x40, 0xc1, 0xc3, 0x41, 0x3d, 0x00, 0x03,
+	0x00, 0xe2, 0x0a, 0xcf, 0xfd, 0x03, 0xc2, 0x40, 0xc7, 0xcb, 0x47, 0x3e,
+	0x00, 0x03, 0x00, 0x0c, 0x74, 0xe1, 0x41, 0xd2, 0x0a, 0xef, 0xfd, 0xa1,
+	0x43, 0x02, 0xc0, 0x4f, 0x27, 0x01, 0x14, 0xc1, 0x42, 0xe8, 0x04, 0x94,
+	0xbe, 0x0a, 0xef, 0xfd, 0x63, 0x43, 0x02, 0xc0, 0xa5, 0x60, 0x08, 0x03,
+	0x68, 0x0e, 0x84, 0x11, 0x35, 0x66, 0x0f, 0x2f, 0xfe, 0x0c, 0x70, 0x30,
+	0x0e, 0x00, 0xf6, 0x08, 0xc0, 0x70, 0x1b, 0x2c, 0x70, 0xea, 0x0f, 0xef,
+	0xfe, 0x28, 0xda, 0xca, 0x0e, 0x1c, 0x00, 0x20, 0x46, 0xc0, 0x16, 0x00,
+	0xf2, 0x01, 0x65, 0x06, 0x01, 0x88, 0x38, 0x1c, 0x01, 0x30, 0x3c, 0x1c,
+	0x03, 0x30, 0x5f, 0x20, 0x41, 0x06, 0x72, 0x01, 0x00, 0x94, 0x0e, 0x50,
+	0x80, 0x0c, 0x19, 0x61, 0x00, 0x0c, 0x09, 0xf0, 0x00, 0x80, 0x74, 0x06,
+	0x07, 0x10, 0xcf, 0x00, 0x06, 0xc0, 0xaa, 0x0b, 0x6f, 0xff, 0x2c, 0x70,
+	0x46, 0x0e, 0x00, 0x78, 0x09, 0xf0, 0x13, 0x05, 0x26, 0x80, 0x1f, 0x02,
+	0x90, 0x92, 0x00, 0xa0, 0x90, 0xd6, 0x0e, 0x2f, 0xfe, 0x53, 0x25, 0x40,
+	0x11, 0x18, 0x43, 0xbd, 0x78, 0x6b, 0xf9, 0x1d, 0x78, 0xc6, 0x0e, 0x2f,
+	0xfe, 0xc5, 0xb8, 0x08, 0x45, 0x60, 0x00, 0xf2, 0x01, 0x74, 0x04, 0xf4,
+	0x20, 0xc2, 0x06, 0xc3, 0x41, 0x91, 0x00, 0x01, 0x00, 0x12, 0x0a, 0xef,
+	0xfd, 0x82, 0x09, 0x00, 0x16, 0x00, 0xf0, 0x01, 0x42, 0x03, 0xc3, 0x41,
+	0x92, 0x00, 0x01, 0x00, 0xfa, 0x09, 0xef, 0xfd, 0x0c, 0x75, 0x06, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x0e, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18,
+	0x60, 0x40, 0x82, 0x72, 0x0e, 0x00, 0x00, 0xf1, 0x40, 0x2c, 0x71, 0x4c,
+	0x73, 0x7a, 0x0d, 0x20, 0x00, 0x8e, 0xc3, 0x6f, 0x20, 0x43, 0x02, 0x1a,
+	0x88, 0x89, 0x08, 0x3e, 0x00, 0x0c, 0x71, 0x44, 0xc0, 0xc3, 0x41, 0x93,
+	0x00, 0x00, 0x00, 0xd6, 0x09, 0xef, 0xfd, 0x0c, 0x74, 0x05, 0x26, 0x80,
+	0x1f, 0x03, 0x90, 0x90, 0xe0, 0x00, 0x18, 0x45, 0x00, 0x15, 0xf0, 0xc3,
+	0x41, 0x94, 0x00, 0x00, 0x00, 0xba, 0x09, 0xcf, 0xfd, 0x63, 0x40, 0xa1,
+	0x41, 0xce, 0x0d, 0xaf, 0xff, 0xc1, 0x42, 0x08, 0xe8, 0x06, 0xc0, 0x2c,
+	0x72, 0x4c, 0x70, 0x32, 0x4a, 0x00, 0xf1, 0x1c, 0x04, 0xc0, 0x04, 0x71,
+	0x44, 0xc0, 0x04, 0xc0, 0x0f, 0x7e, 0xd7, 0x0e, 0x34, 0x91, 0x0c, 0x75,
+	0xc3, 0x41, 0x95, 0x00, 0x00, 0x00, 0x8a, 0x09, 0xcf, 0xfd, 0x2f, 0xc2,
+	0x63, 0x40, 0x9e, 0x0d, 0xaf, 0xff, 0xa1, 0x41, 0xc3, 0x41, 0x96, 0x00,
+	0x00, 0x00, 0x76, 0x60, 0x00, 0xa0, 0x06, 0xc0, 0xc6, 0x0a, 0x6f, 0xff,
+	0x2c, 0x70, 0x06, 0xc0, 0x8e, 0x00, 0xf1, 0x18, 0xee, 0x0c, 0x20, 0x00,
+	0x6c, 0x70, 0xf5, 0x70, 0xce, 0x04, 0x2a, 0x00, 0x2c, 0x70, 0x00, 0x16,
+	0x83, 0x70, 0x00, 0x80, 0x04, 0x00, 0x00, 0x24, 0x80, 0x3f, 0x00, 0x00,
+	0x04, 0x01, 0x9e, 0x0e, 0xef, 0xfe, 0xb4, 0xda, 0x94, 0xc0, 0x96, 0x08,
+	0x00, 0xf1, 0x2c, 0x1a, 0x23, 0x83, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x80, 0x70, 0x00, 0x80, 0x01, 0x00, 0x52, 0xc0, 0x0c, 0x70, 0x8d,
+	0x04, 0x20, 0x00, 0x50, 0xc3, 0x05, 0xc1, 0x06, 0xc0, 0x11, 0x20, 0x40,
+	0x80, 0x78, 0x04, 0x21, 0x00, 0x2c, 0x70, 0x05, 0xc0, 0x0f, 0x78, 0x76,
+	0x0f, 0xaf, 0xff, 0x4a, 0xc0, 0x08, 0x46, 0x56, 0x24, 0xc0, 0x3d, 0x2c,
+	0x70, 0x56, 0x40, 0x00, 0xf2, 0xb6, 0x05, 0xc0, 0xad, 0x70, 0xed, 0x70,
+	0x55, 0x20, 0x01, 0x0c, 0x10, 0xc0, 0xdb, 0x43, 0x02, 0x90, 0x00, 0x00,
+	0x25, 0x78, 0x4b, 0xc0, 0x06, 0xca, 0x49, 0xc0, 0x39, 0xf0, 0x0a, 0x26,
+	0xc0, 0x33, 0x32, 0xf0, 0x1a, 0x25, 0x81, 0x1f, 0x00, 0x00, 0x00, 0x10,
+	0x9a, 0x20, 0x04, 0x00, 0x25, 0x78, 0x44, 0xc0, 0x04, 0xc1, 0x0b, 0xc0,
+	0x25, 0x78, 0x1b, 0x78, 0x05, 0x20, 0xc0, 0x06, 0xe6, 0x08, 0xef, 0xfd,
+	0x00, 0x90, 0x1c, 0x7a, 0x56, 0x24, 0xc1, 0x3d, 0x5c, 0x7a, 0x14, 0x21,
+	0x81, 0x07, 0x5c, 0x7a, 0x00, 0xb1, 0x5c, 0x7a, 0x1b, 0xd9, 0x61, 0xb9,
+	0xff, 0x09, 0x31, 0x80, 0x5d, 0x7a, 0x64, 0x71, 0x59, 0x60, 0x44, 0x28,
+	0x00, 0x08, 0xc4, 0xb9, 0x42, 0x79, 0x54, 0x23, 0x82, 0x3c, 0x40, 0x26,
+	0x5e, 0x30, 0x9a, 0x20, 0x10, 0x00, 0x05, 0x79, 0x04, 0xc0, 0x1b, 0x78,
+	0x45, 0x78, 0x20, 0xb0, 0xa1, 0x0b, 0x34, 0x82, 0x60, 0x40, 0xa5, 0x71,
+	0x09, 0xe7, 0x09, 0xc0, 0x8f, 0x0d, 0x24, 0x90, 0x6c, 0x70, 0x05, 0xc0,
+	0x05, 0xc3, 0xc3, 0x41, 0x8e, 0x00, 0x02, 0x00, 0x38, 0x20, 0x80, 0x03,
+	0xa2, 0x08, 0xaf, 0xfd, 0xc1, 0x42, 0xc3, 0x40, 0x00, 0x80, 0x65, 0x06,
+	0xc1, 0xa8, 0x00, 0x16, 0x01, 0x70, 0x00, 0x80, 0x74, 0x06, 0x0a, 0xc0,
+	0x4c, 0x70, 0xaa, 0x09, 0xaf, 0xfe, 0x6c, 0x71, 0x00, 0x16, 0x9b, 0x20,
+	0x01, 0xf0, 0x12, 0x16, 0x0d, 0x71, 0x08, 0x90, 0xe0, 0x01, 0xc1, 0x40,
+	0xce, 0x0f, 0xaf, 0xfd, 0x2c, 0x70, 0x4c, 0xc0, 0xc3, 0x40, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x41, 0x00, 0x42, 0xca, 0x0e, 0x2f, 0xfe, 0x00, 0x43,
+	0x10, 0x00, 0xc2, 0x7f, 0xff, 0xa4, 0x78, 0x00, 0x1e, 0x04, 0x70, 0x09,
+	0x90, 0xe0, 0xe1, 0x52, 0x01, 0xe4, 0xf4, 0x03, 0xc3, 0x41, 0x00, 0x80,
+	0xc1, 0x04, 0x7a, 0x0e, 0x6f, 0xfd, 0x60, 0xda, 0x14, 0x00, 0x80, 0xea,
+	0x0b, 0x60, 0x00, 0x60, 0xd9, 0xff, 0xd8, 0x2c, 0x00, 0xf2, 0x3b, 0x03,
+	0x90, 0xc4, 0xf0, 0x0c, 0x71, 0x44, 0x26, 0xcd, 0x17, 0x05, 0xed, 0x61,
+	0xbd, 0xff, 0x0d, 0x31, 0x90, 0x1b, 0x78, 0x2c, 0x70, 0x5a, 0x20, 0x00,
+	0x01, 0x0f, 0x20, 0x80, 0x03, 0x0f, 0x78, 0xf2, 0x0a, 0x2f, 0xff, 0x51,
+	0xc0, 0x0c, 0x70, 0x47, 0xc0, 0x0c, 0xf0, 0x1b, 0x7a, 0x34, 0x70, 0x00,
+	0x24, 0x81, 0x3f, 0x00, 0x00, 0xd4, 0x03, 0xce, 0x22, 0x21, 0x00, 0x19,
+	0x61, 0x40, 0xa9, 0x04, 0x71, 0xeb, 0x08, 0x34, 0x84, 0x44, 0x20, 0x41,
+	0x00, 0xc6, 0x00, 0x33, 0x05, 0x10, 0x9e, 0x0a, 0x00, 0x40, 0x1a, 0x23,
+	0x9b, 0x3f, 0xbe, 0x01, 0xf0, 0x01, 0x64, 0x88, 0x68, 0x44, 0x34, 0x1c,
+	0xc0, 0x36, 0x41, 0xf0, 0xed, 0x70, 0x3c, 0xf0, 0x0c, 0xc0, 0x90, 0x01,
+	0x44, 0x0d, 0xc0, 0x25, 0x78, 0x7c, 0x01, 0x42, 0x05, 0x79, 0xe1, 0x40,
+	0x80, 0x01, 0xf0, 0x31, 0x1b, 0x78, 0x91, 0xb8, 0x9c, 0xb8, 0x9f, 0xb8,
+	0x53, 0x0f, 0x31, 0x12, 0xc0, 0x90, 0xdd, 0x78, 0xad, 0xf8, 0x1d, 0x78,
+	0xc4, 0xbe, 0x2c, 0x70, 0x08, 0xe8, 0x00, 0x41, 0x9a, 0x21, 0x10, 0x00,
+	0x80, 0x21, 0x30, 0x00, 0xc5, 0x79, 0x5f, 0x25, 0x8b, 0x14, 0x00, 0x24,
+	0x82, 0x3f, 0x00, 0x00, 0x20, 0x03, 0x61, 0x72, 0x28, 0xb2, 0xc3, 0x41,
+	0x00, 0x00, 0x1f, 0x14, 0x13, 0x08, 0x50, 0x01, 0x7c, 0x01, 0x10, 0x80,
+	0x80, 0x01, 0x32, 0x20, 0x81, 0x03, 0xec, 0x00, 0xf2, 0x0f, 0x6c, 0x02,
+	0x61, 0x70, 0x28, 0xb0, 0xe5, 0x71, 0x8b, 0x0f, 0x54, 0x92, 0x85, 0x71,
+	0x8f, 0x7d, 0x7f, 0x0e, 0x65, 0xb3, 0x0c, 0x71, 0x5f, 0x23, 0x4f, 0x02,
+	0x44, 0xc0, 0xcb, 0xf0, 0x24, 0x00, 0xf0, 0x11, 0x20, 0x03, 0x96, 0x0a,
+	0x40, 0x00, 0x0f, 0xd8, 0x0e, 0x0e, 0xaf, 0xfd, 0x0f, 0xd9, 0x0c, 0x71,
+	0xb2, 0x0b, 0xaf, 0xff, 0xff, 0xd9, 0xcb, 0x45, 0x03, 0x90, 0x24, 0xe0,
+	0x00, 0x1d, 0x84, 0x1f, 0x68, 0x01, 0xf2, 0x15, 0x06, 0xb5, 0xfe, 0x1d,
+	0x04, 0x90, 0x0c, 0x70, 0x44, 0xc0, 0xa8, 0x1d, 0x1c, 0x10, 0xa9, 0x1d,
+	0x1c, 0x10, 0x12, 0xc0, 0x21, 0xde, 0x2c, 0x71, 0xe2, 0xb8, 0xca, 0x26,
+	0xe1, 0x1b, 0x42, 0x09, 0xaf, 0xfd, 0xc1, 0x40, 0x4e, 0x00, 0x62, 0x04,
+	0x01, 0x72, 0x0f, 0x0f, 0xff, 0x0c, 0x00, 0x31, 0x6c, 0x02, 0x3a, 0x5a,
+	0x00, 0x21, 0xb6, 0x0d, 0x5a, 0x00, 0x21, 0x73, 0x5a, 0x5a, 0x00, 0x44,
+	0x2c, 0x71, 0x0c, 0x70, 0x58, 0x00, 0x64, 0x26, 0xb5, 0xfe, 0x1d, 0x44,
+	0x90, 0x54, 0x00, 0x10, 0xfa, 0x0e, 0x02, 0xe0, 0x40, 0x32, 0x0f, 0x2f,
+	0xff, 0x94, 0xc0, 0x07, 0xc0, 0xe9, 0x45, 0x0f, 0x78, 0x53, 0xe8, 0x01,
+	0xf2, 0x04, 0x80, 0x65, 0x06, 0x04, 0x88, 0x48, 0xc0, 0x63, 0xf0, 0x08,
+	0xe5, 0x2c, 0x72, 0x08, 0xde, 0x5a, 0xf0, 0xb0, 0x7a, 0x60, 0x00, 0xf0,
+	0x2f, 0x04, 0x01, 0xf5, 0x20, 0x8c, 0x00, 0x94, 0xc0, 0xf5, 0x20, 0x83,
+	0x00, 0x90, 0x4b, 0x48, 0x20, 0x00, 0x00, 0x0e, 0x78, 0x83, 0x08, 0xb3,
+	0x01, 0x34, 0x71, 0x2c, 0x71, 0x46, 0xf2, 0x40, 0xc0, 0x0c, 0x70, 0xc3,
+	0x41, 0xac, 0x00, 0x03, 0x00, 0x63, 0x42, 0x3a, 0x0e, 0x6f, 0xfd, 0xc1,
+	0x43, 0x0c, 0xc0, 0x6c, 0x71, 0x55, 0x20, 0xc1, 0x08, 0x0d, 0xc0, 0x05,
+	0x79, 0x1a, 0x23, 0x72, 0x03, 0x22, 0x00, 0x10, 0xee, 0x02, 0xc4, 0x80,
+	0x0f, 0x02, 0x90, 0x00, 0x02, 0x49, 0xc0, 0x40, 0x90, 0x13, 0xc0, 0xe2,
+	0x01, 0xc0, 0x33, 0x21, 0x01, 0x00, 0x40, 0xc2, 0x58, 0x61, 0x0e, 0x78,
+	0x42, 0xc0, 0x5c, 0x00, 0xf0, 0x17, 0x49, 0x20, 0x00, 0x08, 0x41, 0xc1,
+	0x44, 0xc0, 0x43, 0xc0, 0x0c, 0x74, 0xc3, 0x41, 0xad, 0x00, 0x06, 0x00,
+	0x96, 0x0d, 0xaf, 0xfd, 0x63, 0x42, 0x04, 0xc1, 0x09, 0xc0, 0x20, 0xb0,
+	0x0c, 0x71, 0x2c, 0x71, 0x44, 0xc0, 0x0a, 0xf0, 0x80, 0x03, 0x80, 0x14,
+	0x20, 0x82, 0x00, 0x98, 0x63, 0x1c, 0x78, 0x36, 0x00, 0xf3, 0x05, 0x00,
+	0xb2, 0xa5, 0x71, 0xc5, 0x71, 0x4f, 0x0e, 0x54, 0x92, 0x08, 0xc0, 0x04,
+	0x71, 0x48, 0xc0, 0x08, 0xc0, 0x0f, 0x79, 0x2a, 0x02, 0xf0, 0x06, 0x88,
+	0x33, 0x08, 0x65, 0x80, 0x38, 0x43, 0x04, 0xc0, 0x14, 0x70, 0x78, 0x08,
+	0x02, 0xff, 0x07, 0xc0, 0x04, 0x71, 0x47, 0xc0, 0x0e, 0x00, 0xe2, 0x35,
+	0xf5, 0xc3, 0x41, 0xae, 0x00, 0x00, 0x00, 0x36, 0x0d, 0xaf, 0xfd, 0x0c,
+	0x74, 0x2e, 0x00, 0xf3, 0x04, 0xc4, 0x88, 0x27, 0xf0, 0xf0, 0x7f, 0x08,
+	0xe7, 0x08, 0xdd, 0x1f, 0xf0, 0x04, 0x20, 0x81, 0x0f, 0x01, 0x00, 0xfe,
+	0x66, 0x01, 0xc0, 0x04, 0x01, 0x35, 0x20, 0x43, 0x00, 0x94, 0xc0, 0x35,
+	0x20, 0x42, 0x00, 0x7e, 0x00, 0x91, 0x35, 0x20, 0x40, 0x00, 0x41, 0xc2,
+	0x40, 0xc3, 0x42, 0xa8, 0x00, 0xf2, 0x09, 0xaf, 0x00, 0x05, 0x00, 0x63,
+	0x42, 0xea, 0x0c, 0xaf, 0xfd, 0xa1, 0x43, 0xa5, 0x71, 0xe5, 0x71, 0xc7,
+	0x0d, 0x74, 0x92, 0xfb, 0x78, 0xc5, 0x71, 0x56, 0x00, 0x51, 0x05, 0x88,
+	0xcf, 0x79, 0xab, 0x86, 0x00, 0xe8, 0x46, 0x0e, 0xaf, 0xfe, 0x11, 0xc0,
+	0x00, 0x1e, 0x05, 0x70, 0x03, 0x90, 0x04, 0xe0, 0x8a, 0x03, 0x80, 0x1e,
+	0x0e, 0x6f, 0xfe, 0x6c, 0x70, 0x0b, 0xc0, 0x08, 0x04, 0xf2, 0x13, 0x4c,
+	0x70, 0x0a, 0x09, 0x60, 0x00, 0x6c, 0x71, 0x05, 0xc0, 0x04, 0x71, 0x45,
+	0xc0, 0x05, 0xc0, 0x14, 0x73, 0x78, 0x03, 0xce, 0xff, 0x80, 0x24, 0x11,
+	0x35, 0x04, 0x14, 0x1b, 0x34, 0xc6, 0xc6, 0x1d, 0x78, 0x02, 0x00, 0xf1,
+	0x00, 0xe0, 0x7e, 0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6, 0xad,
+	0xc1, 0x00, 0x16, 0x8c, 0xc4, 0x03, 0xf0, 0x0b, 0x40, 0xc3, 0x48, 0xc1,
+	0x1a, 0x24, 0x8c, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xc0, 0xed, 0x70,
+	0x05, 0x24, 0x80, 0x1f, 0x02, 0x90, 0x90, 0x00, 0x20, 0x90, 0x9c, 0x05,
+	0xf2, 0x01, 0x7a, 0x88, 0x44, 0x23, 0x00, 0x08, 0x46, 0xc0, 0x0c, 0x70,
+	0x15, 0x09, 0x71, 0x00, 0x44, 0xc0, 0x1e, 0x00, 0xf0, 0x03, 0x96, 0x00,
+	0x00, 0x90, 0xc5, 0xb8, 0x44, 0xc0, 0x4f, 0x22, 0x40, 0x00, 0x47, 0xc0,
+	0x80, 0xba, 0xc3, 0x40, 0x96, 0x02, 0xf0, 0x4e, 0x49, 0xc2, 0x00, 0x18,
+	0xc5, 0x0f, 0x0c, 0x18, 0xc5, 0x0f, 0xfe, 0x18, 0xc4, 0x83, 0x06, 0xc0,
+	0x70, 0xf8, 0x1d, 0x78, 0xc9, 0x68, 0x0c, 0x71, 0x42, 0xc0, 0xbf, 0xf0,
+	0x0a, 0xc0, 0x11, 0x20, 0xc0, 0x83, 0xba, 0xf2, 0xef, 0x78, 0x2c, 0x70,
+	0xff, 0xda, 0x2e, 0x0b, 0xef, 0xfd, 0x18, 0x43, 0x63, 0x40, 0x56, 0x0a,
+	0xaf, 0xff, 0x2c, 0x70, 0x08, 0x45, 0x08, 0xc0, 0x63, 0x41, 0xff, 0xda,
+	0x0f, 0x7b, 0xaa, 0x0a, 0x2f, 0xfe, 0x0c, 0x70, 0x63, 0x40, 0xff, 0xd9,
+	0xbe, 0x0a, 0x6f, 0xff, 0x4c, 0x71, 0x16, 0x09, 0xaf, 0xfe, 0x63, 0x40,
+	0x09, 0xc0, 0x33, 0x08, 0xf1, 0x20, 0x06, 0xd2, 0x25, 0xc1, 0x17, 0x06,
+	0xe9, 0x61, 0xb9, 0x01, 0x09, 0x31, 0x00, 0x1b, 0x78, 0x0c, 0x04, 0xf0,
+	0x5f, 0x4d, 0x03, 0x02, 0x0c, 0x60, 0x00, 0x63, 0x40, 0xae, 0x0f, 0xef,
+	0xfd, 0x63, 0x40, 0x20, 0x88, 0xaf, 0x7a, 0x72, 0x0b, 0x20, 0x00, 0x40,
+	0x40, 0xcb, 0x45, 0x00, 0x80, 0x69, 0x06, 0x00, 0x8d, 0x01, 0x15, 0x8b,
+	0x10, 0x2c, 0x70, 0x41, 0xc0, 0xff, 0xd8, 0x02, 0x0b, 0xaf, 0xfd, 0x08,
+	0xda, 0x45, 0xc0, 0x01, 0xc0, 0x40, 0x23, 0x41, 0x10, 0x02, 0x79, 0x05,
+	0xc0, 0x29, 0x78, 0x0f, 0x78, 0x4b, 0xc0, 0x0c, 0x70, 0x43, 0xc0, 0x18,
+	0xf0, 0x3d, 0x79, 0x9f, 0x20, 0x41, 0x00, 0x3d, 0x79, 0x12, 0x1a, 0x58,
+	0x30, 0x12, 0x12, 0x81, 0x30, 0x00, 0x20, 0x80, 0x0f, 0x00, 0x80, 0xdc,
+	0x06, 0x4c, 0x72, 0xde, 0x09, 0xaf, 0xff, 0x4c, 0xc0, 0x0c, 0xc2, 0x63,
+	0x40, 0x42, 0x0e, 0xae, 0x00, 0xf2, 0x0d, 0x01, 0xc0, 0x04, 0x71, 0x41,
+	0xc0, 0x01, 0xc0, 0x0b, 0xc1, 0x0f, 0x78, 0xcb, 0x08, 0x64, 0x80, 0x1d,
+	0x79, 0x07, 0xc0, 0x14, 0x73, 0x30, 0x0a, 0x61, 0x00, 0x63, 0x40, 0x32,
+	0x01, 0xf1, 0x03, 0x00, 0xc0, 0x8d, 0x08, 0x10, 0x00, 0x89, 0x0b, 0x1e,
+	0x00, 0x01, 0x8d, 0x20, 0x8d, 0x04, 0x71, 0x31, 0x48, 0x6c, 0x00, 0x90,
+	0x79, 0x37, 0xf0, 0xad, 0x70, 0x4c, 0x70, 0x12, 0xf0, 0x6a, 0x00, 0x20,
+	0xcb, 0x44, 0x5e, 0x00, 0x44, 0xb4, 0x78, 0x8c, 0x60, 0x6a, 0x00, 0xf2,
+	0x2b, 0x01, 0x88, 0x0b, 0x0c, 0x25, 0x10, 0x58, 0x60, 0x92, 0x48, 0xa5,
+	0x71, 0xdf, 0x0d, 0xf4, 0x97, 0x61, 0x40, 0x06, 0xc0, 0x86, 0xe8, 0x50,
+	0x76, 0xca, 0x22, 0x85, 0x03, 0x48, 0x46, 0x16, 0xf0, 0x02, 0xc0, 0x5a,
+	0x22, 0x02, 0x04, 0x10, 0x7c, 0x5a, 0x26, 0x00, 0x14, 0x05, 0x28, 0x00,
+	0x03, 0x18, 0xf8, 0x10, 0x4e, 0x05, 0x2a, 0x0e, 0x03, 0xdd, 0x7e, 0x02,
+	0x00, 0xf0, 0x21, 0x1e, 0x66, 0x02, 0xc0, 0x04, 0x71, 0x42, 0xc0, 0x03,
+	0xc0, 0x04, 0x71, 0x43, 0xc0, 0x03, 0xc0, 0x0f, 0x7a, 0x95, 0x0a, 0x64,
+	0x80, 0x48, 0x43, 0xe5, 0x71, 0xf5, 0x72, 0x82, 0x06, 0xc5, 0xff, 0x00,
+	0xc0, 0x14, 0xe8, 0x25, 0x0b, 0x1e, 0x00, 0x00, 0xc0, 0x40, 0x80, 0x1d,
+	0x0a, 0xa5, 0x03, 0x22, 0x07, 0xfe, 0x07, 0x8d, 0x00, 0x02, 0x00, 0x66,
+	0x0a, 0xaf, 0xfd, 0xc1, 0x43, 0x00, 0xc1, 0x04, 0xc0, 0x04, 0xa9, 0x00,
+	0xc0, 0xc0, 0xa0, 0xad, 0xc0, 0x34, 0x02, 0x40, 0xe4, 0xc0, 0x29, 0xf0,
+	0x52, 0x01, 0xf2, 0x11, 0x1b, 0x07, 0x10, 0xe9, 0x3b, 0x09, 0x70, 0x00,
+	0x48, 0x44, 0x41, 0x09, 0xb1, 0x00, 0x48, 0x44, 0x9a, 0x24, 0x41, 0x10,
+	0x9d, 0x65, 0xc0, 0x8d, 0x81, 0x88, 0xdc, 0x64, 0x80, 0xad, 0x16, 0xf0,
+	0x12, 0x00, 0xf0, 0x09, 0xbe, 0x64, 0xa0, 0x8e, 0x81, 0x88, 0xbc, 0x64,
+	0x80, 0xae, 0x82, 0x88, 0x52, 0x24, 0xcd, 0x11, 0x81, 0x8e, 0xbc, 0x64,
+	0x81, 0xae, 0x06, 0xf0, 0x2e, 0x00, 0xe2, 0xbc, 0x64, 0xa2, 0x88, 0xa1,
+	0xac, 0x44, 0x71, 0xb5, 0x0a, 0xc4, 0x80, 0xc4, 0xc4, 0x8c, 0x02, 0x51,
+	0x0a, 0x26, 0x80, 0x30, 0x00, 0x6e, 0x06, 0xf2, 0x55, 0x69, 0x06, 0x38,
+	0x47, 0x01, 0x10, 0x8b, 0x00, 0x20, 0x88, 0x2a, 0xf0, 0x49, 0x0e, 0x2e,
+	0x33, 0x89, 0x47, 0x5f, 0x20, 0x43, 0x02, 0x9a, 0x27, 0x08, 0x10, 0xcb,
+	0x45, 0x02, 0x90, 0x80, 0x00, 0xe3, 0x73, 0x33, 0x23, 0x0e, 0x03, 0x1a,
+	0x20, 0x83, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x5e, 0x66, 0x42, 0x26, 0x5b,
+	0x90, 0x65, 0x7f, 0x05, 0x27, 0x43, 0x13, 0x40, 0xb3, 0x7f, 0xdb, 0xca,
+	0x23, 0x2b, 0x00, 0x8c, 0x23, 0x41, 0xbf, 0xca, 0x26, 0xcd, 0x10, 0x42,
+	0x25, 0x0d, 0x18, 0xcf, 0x7b, 0xa5, 0x7f, 0x60, 0xb7, 0x85, 0x71, 0xb9,
+	0x0c, 0x54, 0x92, 0x24, 0x71, 0x2f, 0x78, 0xfb, 0x0b, 0x25, 0x90, 0x8d,
+	0x70, 0xde, 0x00, 0x04, 0x08, 0x03, 0xf0, 0x41, 0xa8, 0xc1, 0x45, 0xc1,
+	0x18, 0x43, 0x0c, 0x70, 0xff, 0xd9, 0x46, 0xc3, 0x7a, 0x0b, 0x6f, 0xfd,
+	0x44, 0xc2, 0x0d, 0xc0, 0xcd, 0x70, 0xad, 0x70, 0x47, 0xc0, 0x3a, 0xf0,
+	0x32, 0x25, 0x8f, 0x1f, 0x00, 0x80, 0x24, 0x05, 0x2c, 0x70, 0x3e, 0x09,
+	0x6f, 0xfd, 0xe1, 0x42, 0x07, 0xc2, 0x44, 0x79, 0x06, 0xc2, 0x44, 0x78,
+	0x05, 0x20, 0x7e, 0x80, 0x2b, 0xf4, 0x05, 0xc0, 0x2c, 0x70, 0x4c, 0x73,
+	0x22, 0xdb, 0xe8, 0x60, 0x0c, 0x1c, 0x01, 0x30, 0x08, 0x1c, 0xc0, 0x36,
+	0x40, 0xc0, 0xff, 0xd8, 0xd2, 0x04, 0xf2, 0x07, 0x41, 0xc7, 0x07, 0x0d,
+	0x90, 0x11, 0x99, 0xed, 0xb5, 0x70, 0xc8, 0xd9, 0xfa, 0xd8, 0x6a, 0x0c,
+	0x6f, 0xfe, 0xca, 0x20, 0x41, 0x00, 0x82, 0x03, 0x00, 0x06, 0x00, 0xa0,
+	0x0f, 0x78, 0x43, 0xc0, 0x0c, 0x70, 0x42, 0xc0, 0x41, 0xc0, 0x32, 0x00,
+	0xf0, 0x05, 0x2c, 0x70, 0x4c, 0x75, 0x02, 0x0e, 0x6f, 0xfd, 0x20, 0xdb,
+	0xa5, 0x71, 0x8f, 0x0d, 0x34, 0x93, 0x0c, 0x71, 0xff, 0xd8, 0x14, 0x00,
+	0xf0, 0x0b, 0x41, 0xdb, 0x0c, 0x1c, 0x01, 0x34, 0x42, 0xc6, 0x41, 0xc6,
+	0xd6, 0x0b, 0x6f, 0xfd, 0x40, 0xc6, 0xff, 0xd8, 0x80, 0xd9, 0x4c, 0x75,
+	0x6c, 0x74, 0x43, 0xc6, 0x14, 0x00, 0x11, 0xc2, 0x14, 0x00, 0xf0, 0x13,
+	0x0c, 0x70, 0x5e, 0x0b, 0x6f, 0xfd, 0x2c, 0x71, 0x04, 0xc0, 0x33, 0xe8,
+	0x0c, 0x70, 0xba, 0x0a, 0x6f, 0xfd, 0xff, 0xd9, 0x4f, 0xd8, 0xad, 0x70,
+	0x53, 0x23, 0x5b, 0x30, 0x40, 0xc0, 0x17, 0xf8, 0x43, 0xc5, 0x98, 0x00,
+	0x91, 0x96, 0x0b, 0x6f, 0xfd, 0x41, 0xc5, 0x0c, 0x70, 0x32, 0x2c, 0x00,
+	0xf1, 0x00, 0xc3, 0x40, 0x0f, 0x00, 0x40, 0x42, 0xd2, 0x0a, 0xaf, 0xfe,
+	0x2c, 0x70, 0x0c, 0x70, 0x86, 0x34, 0x00, 0x53, 0x51, 0xd8, 0x40, 0xc0,
+	0x0b, 0x2e, 0x00, 0x13, 0x66, 0x2e, 0x00, 0x13, 0x02, 0x2e, 0x00, 0xb3,
+	0x00, 0x00, 0x40, 0x1f, 0xa2, 0x0a, 0xaf, 0xfe, 0x1e, 0xd9, 0xa8, 0x1a,
+	0x02, 0x20, 0xe0, 0x78, 0x8c, 0x00, 0x42, 0x17, 0xda, 0x6c, 0x74, 0x50,
+	0x04, 0x91, 0xa4, 0xc1, 0x28, 0x46, 0x08, 0x47, 0x0c, 0x70, 0x3a, 0x4c,
+	0x00, 0x40, 0x2c, 0x70, 0xff, 0xd8, 0x18, 0x01, 0xc0, 0x28, 0x45, 0x43,
+	0xc1, 0x42, 0xc7, 0x04, 0x1c, 0x81, 0x33, 0x26, 0x0d, 0xc0, 0x00, 0x60,
+	0x62, 0x0b, 0x6f, 0xfe, 0xfa, 0xd8, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00,
+	0x06, 0x01, 0x02, 0xea, 0x00, 0xc0, 0x20, 0xdb, 0x42, 0xc5, 0x41, 0xc5,
+	0xfe, 0x0c, 0x6f, 0xfd, 0x40, 0xc5, 0x5a, 0x00, 0x60, 0x4c, 0x75, 0x6c,
+	0x72, 0x43, 0xc5, 0x14, 0x00, 0x20, 0xda, 0x0a, 0x14, 0x00, 0x40, 0x0c,
+	0x70, 0x76, 0x0a, 0xe6, 0x00, 0x44, 0xa4, 0xc0, 0xc6, 0xc6, 0xb8, 0x01,
+	0xf0, 0x19, 0xac, 0xc1, 0x49, 0xc3, 0x47, 0xc2, 0x4a, 0xc1, 0x42, 0x0d,
+	0xaf, 0xfd, 0x46, 0xc0, 0x11, 0xc0, 0xed, 0x71, 0x4b, 0xc0, 0x12, 0xc0,
+	0x48, 0xc0, 0xff, 0xd8, 0x44, 0xc0, 0x0c, 0x70, 0x45, 0xc0, 0xb8, 0xf0,
+	0x05, 0xc0, 0x32, 0x20, 0x9b, 0x0f, 0xc0, 0x01, 0xf0, 0x01, 0x0a, 0xc0,
+	0x32, 0x20, 0xce, 0x06, 0x04, 0xc0, 0x0f, 0x78, 0x8c, 0x20, 0xc3, 0x8f,
+	0x0b, 0xf4, 0x94, 0x08, 0x40, 0x00, 0x0a, 0x8a, 0x09, 0x2e, 0x01, 0x40,
+	0x4e, 0x0d, 0x4f, 0xff, 0x40, 0x07, 0xf2, 0x07, 0xe1, 0x41, 0x44, 0x23,
+	0xc0, 0x37, 0x09, 0xc2, 0x06, 0xe8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00,
+	0x3b, 0x79, 0x1f, 0xd8, 0x24, 0x7a, 0x0c, 0x00, 0xf8, 0x0f, 0x3c, 0x79,
+	0x0b, 0xc0, 0x24, 0x78, 0x05, 0x22, 0x3e, 0x80, 0x79, 0xf4, 0xdd, 0x78,
+	0x1d, 0x78, 0x44, 0x20, 0x00, 0x08, 0x45, 0x20, 0x8d, 0x01, 0x08, 0xc0,
+	0x0b, 0xe8, 0x7e, 0xf8, 0xcc, 0x01, 0x20, 0x2a, 0x0a, 0xc8, 0x01, 0x10,
+	0x04, 0x1a, 0x02, 0x10, 0x70, 0x8e, 0x0a, 0x00, 0xce, 0x05, 0xf0, 0x02,
+	0x7c, 0x05, 0x01, 0x88, 0x6c, 0x72, 0x41, 0xc7, 0x43, 0xc0, 0x06, 0xc0,
+	0x40, 0xc5, 0x42, 0xc0, 0x06, 0x26, 0x01, 0x14, 0xd8, 0x1a, 0x00, 0x01,
+	0xac, 0x01, 0xf0, 0x04, 0x31, 0x43, 0xc0, 0x69, 0xf8, 0x42, 0xc5, 0x41,
+	0xc7, 0xea, 0x09, 0x6f, 0xfd, 0x00, 0x1c, 0xc0, 0x36, 0x68, 0xf8, 0x2e,
+	0x00, 0x00, 0x36, 0x00, 0x33, 0x42, 0xc0, 0xdd, 0x70, 0x00, 0x50, 0x80,
+	0x05, 0x40, 0xc0, 0xca, 0xb4, 0x00, 0x05, 0x3c, 0x00, 0xc0, 0xc5, 0xbe,
+	0x2c, 0x70, 0x43, 0xc0, 0xff, 0xd8, 0x4c, 0x70, 0x6c, 0x72, 0x3e, 0x00,
+	0x20, 0xae, 0x09, 0x68, 0x01, 0x40, 0x05, 0xc0, 0x19, 0xe8, 0xe2, 0x00,
+	0x80, 0x10, 0x27, 0x0e, 0x09, 0xaf, 0xfe, 0x0a, 0xd9, 0x6e, 0x01, 0x50,
+	0x04, 0x77, 0x0f, 0x7e, 0x50, 0x62, 0x00, 0xd0, 0xc5, 0x40, 0xc5, 0x86,
+	0x09, 0x6f, 0xfd, 0x43, 0xc6, 0x4d, 0xf8, 0x43, 0xc6, 0x62, 0x01, 0x44,
+	0x40, 0xc5, 0x0d, 0xf0, 0x8c, 0x00, 0x00, 0x10, 0x00, 0x20, 0x43, 0xc0,
+	0x84, 0x01, 0xf0, 0x0d, 0x2c, 0x70, 0x4c, 0x70, 0x18, 0xdb, 0x5e, 0x09,
+	0x4f, 0xfd, 0x04, 0xc0, 0x0f, 0x79, 0x0f, 0x09, 0x10, 0x01, 0x05, 0xc0,
+	0x17, 0x08, 0xd1, 0x02, 0x09, 0xe9, 0xc6, 0x0b, 0x30, 0x01, 0x20, 0xe6,
+	0x08, 0x90, 0x01, 0x00, 0x6c, 0x01, 0x04, 0x72, 0x06, 0xf0, 0x1d, 0x8c,
+	0xe0, 0x90, 0x06, 0xc5, 0xff, 0x07, 0xc0, 0xcf, 0x08, 0x30, 0x00, 0xff,
+	0xd9, 0xcb, 0x47, 0x00, 0x00, 0x00, 0x0a, 0x2a, 0x08, 0x6f, 0xfd, 0xe1,
+	0x40, 0xea, 0x0b, 0x4f, 0xff, 0xcb, 0x46, 0x00, 0x80, 0x7d, 0x05, 0x00,
+	0x8e, 0x2c, 0x70, 0x4a, 0x23, 0x00, 0x38, 0xdc, 0x00, 0x01, 0xb4, 0x00,
+	0x92, 0xc0, 0xff, 0xd8, 0x28, 0x45, 0x41, 0xc1, 0xf6, 0x08, 0xf6, 0x00,
+	0x00, 0x20, 0x00, 0x11, 0x4c, 0xd2, 0x00, 0x01, 0xd0, 0x00, 0x21, 0xc5,
+	0xde, 0x18, 0x00, 0x31, 0xc1, 0x33, 0x52, 0x74, 0x00, 0x11, 0x72, 0x74,
+	0x00, 0x02, 0xbe, 0x02, 0x20, 0x12, 0x08, 0xbe, 0x02, 0xc4, 0xe1, 0x40,
+	0xc6, 0x0f, 0x2f, 0xfd, 0xff, 0xd9, 0x8a, 0x0b, 0x4f, 0xff, 0x3c, 0x00,
+	0xb1, 0x06, 0xc0, 0x6c, 0x72, 0x41, 0xc5, 0x42, 0xc0, 0xff, 0xd8, 0x9e,
+	0x3e, 0x00, 0x24, 0xc0, 0x36, 0x1a, 0x00, 0x22, 0xff, 0xd8, 0x56, 0x00,
+	0x11, 0x86, 0x18, 0x00, 0x26, 0x41, 0x34, 0x18, 0x00, 0x11, 0x10, 0x80,
+	0x02, 0x20, 0x6e, 0x08, 0x6c, 0x02, 0x20, 0xe6, 0x0a, 0xe0, 0x00, 0x11,
+	0x06, 0x6c, 0x00, 0x57, 0x22, 0x0c, 0x8f, 0xfd, 0xac, 0xf4, 0x02, 0x00,
+	0x16, 0x01, 0x20, 0x6c, 0x72, 0xf4, 0x02, 0x04, 0x32, 0x01, 0x00, 0x12,
+	0x00, 0x00, 0x10, 0x00, 0x02, 0xc8, 0x04, 0xf0, 0x01, 0xa9, 0xc1, 0x45,
+	0xc1, 0x58, 0xd9, 0x9f, 0xb9, 0x46, 0xc0, 0x00, 0x89, 0xcd, 0x11, 0x8f,
+	0x80, 0x46, 0x04, 0xf2, 0x05, 0x0e, 0xc0, 0xcd, 0x71, 0x43, 0xc3, 0x44,
+	0xc2, 0x48, 0xc0, 0x58, 0xf0, 0x44, 0x25, 0xc1, 0x17, 0x6f, 0x70, 0x05,
+	0xe9, 0xa8, 0x0b, 0xf6, 0x15, 0x1b, 0x78, 0x42, 0xc0, 0x4b, 0xf0, 0x07,
+	0xc0, 0x02, 0xc2, 0x08, 0xc1, 0x77, 0x70, 0xca, 0x20, 0xc1, 0x03, 0x44,
+	0x79, 0x0b, 0x79, 0x42, 0xf2, 0x02, 0xc0, 0x44, 0x23, 0xc1, 0x37, 0x2f,
+	0x26, 0x07, 0x30, 0xc1, 0x40, 0x2c, 0x00, 0x62, 0x8a, 0x09, 0xaf, 0xfd,
+	0x0f, 0x78, 0x78, 0x00, 0x44, 0x00, 0x88, 0x1c, 0xe8, 0x7c, 0x0c, 0xfc,
+	0x1f, 0x31, 0x08, 0xdf, 0x00, 0x03, 0xc0, 0x5a, 0x23, 0x81, 0x3c, 0x5f,
+	0x26, 0x02, 0x31, 0x40, 0xc0, 0x06, 0xc0, 0x04, 0xc3, 0x04, 0x1c, 0x01,
+	0x30, 0x19, 0x61, 0x5a, 0x25, 0x40, 0x16, 0x19, 0x61, 0x02, 0xc0, 0x45,
+	0x78, 0x05, 0xc2, 0xce, 0x0c, 0xef, 0xff, 0x0f, 0x78, 0x14, 0xf0, 0x2a,
+	0x00, 0x0a, 0x26, 0x00, 0x20, 0xf2, 0x0a, 0x26, 0x00, 0xf3, 0x06, 0x67,
+	0x71, 0x6f, 0x0b, 0x94, 0xb0, 0xa5, 0x71, 0x53, 0x0d, 0xb4, 0x90, 0xc1,
+	0x40, 0x12, 0x09, 0xaf, 0xfd, 0x0c, 0x73, 0xa9, 0x06, 0x01, 0x40, 0xe4,
+	0xc2, 0xc3, 0x42, 0x58, 0x07, 0xf1, 0x04, 0x80, 0x8a, 0xc1, 0x8a, 0x5f,
+	0x24, 0x81, 0x14, 0x38, 0x60, 0x13, 0xf0, 0x19, 0x09, 0x11, 0x02, 0x1a,
+	0x23, 0x82, 0x92, 0x05, 0xf0, 0x2d, 0x05, 0x22, 0x8d, 0x0f, 0x02, 0x90,
+	0x64, 0x10, 0x40, 0x90, 0x40, 0xb5, 0x24, 0x71, 0x04, 0x72, 0xe5, 0x09,
+	0x54, 0x82, 0x85, 0x71, 0x8f, 0x7b, 0xf9, 0x0e, 0xe5, 0x90, 0x2c, 0x70,
+	0x2e, 0x0f, 0x8f, 0xfe, 0xc4, 0xc6, 0xe2, 0xc2, 0x0a, 0x26, 0x40, 0x30,
+	0x08, 0x43, 0xad, 0x70, 0x24, 0xf0, 0x5a, 0x25, 0x82, 0x11, 0x61, 0x72,
+	0x01, 0x8a, 0x60, 0x8a, 0x22, 0x8a, 0x6c, 0x0b, 0x31, 0x05, 0x7b, 0x03,
+	0x08, 0x00, 0xf0, 0x05, 0x25, 0x78, 0x1a, 0x20, 0x80, 0x0f, 0x01, 0x00,
+	0x00, 0x00, 0x05, 0x20, 0xc1, 0x00, 0x05, 0x8a, 0x64, 0x8a, 0x34, 0x77,
+	0x20, 0x00, 0xf5, 0x0e, 0x65, 0x78, 0x07, 0xf2, 0x3b, 0x79, 0x9c, 0xb9,
+	0x9f, 0xb9, 0x00, 0xb1, 0x03, 0xf0, 0xb6, 0x0d, 0x4f, 0xfe, 0xa5, 0x71,
+	0x45, 0x2e, 0x80, 0x31, 0xb9, 0x0d, 0x04, 0x90, 0xc2, 0x1c, 0x04, 0x40,
+	0xa1, 0xc1, 0x18, 0x47, 0x2a, 0x01, 0xf2, 0x11, 0x69, 0x06, 0xc0, 0x88,
+	0x38, 0x43, 0x40, 0xc3, 0x04, 0xea, 0xdb, 0x79, 0x04, 0xf0, 0x5f, 0x26,
+	0x41, 0x12, 0x01, 0x10, 0x9e, 0x00, 0x54, 0x70, 0x08, 0xdd, 0xca, 0x25,
+	0x62, 0x10, 0x39, 0xf0, 0xe0, 0x0b, 0xb1, 0x00, 0xc3, 0xf5, 0x23, 0x42,
+	0x30, 0x13, 0xeb, 0x5c, 0x7c, 0x9c, 0x02, 0x00, 0xf1, 0x13, 0x4a, 0x22,
+	0xc0, 0x16, 0x44, 0x2a, 0x03, 0x08, 0x42, 0x22, 0x4a, 0x10, 0xfd, 0x0a,
+	0x31, 0x90, 0x9d, 0x7c, 0x9a, 0x62, 0xc4, 0xba, 0x94, 0x4a, 0x0d, 0xf0,
+	0x8a, 0x24, 0xcf, 0x1f, 0x44, 0x7c, 0x04, 0x22, 0x7e, 0x06, 0xe2, 0xfc,
+	0x0a, 0xda, 0x61, 0xba, 0xff, 0x0a, 0x31, 0x80, 0x7d, 0x7b, 0x1a, 0x26,
+	0x82, 0xae, 0x0d, 0xd2, 0x23, 0x01, 0x00, 0xe5, 0x71, 0x24, 0x71, 0x05,
+	0x22, 0xc2, 0x07, 0x45, 0x78, 0x36, 0x0c, 0xf2, 0x05, 0x85, 0x7b, 0x9f,
+	0xb8, 0x60, 0xb0, 0x97, 0x0d, 0xc5, 0x93, 0xc5, 0x71, 0xfd, 0x0e, 0xa5,
+	0xb3, 0xed, 0x70, 0x87, 0x74, 0x82, 0x06, 0xf0, 0x03, 0xe6, 0xc2, 0xa1,
+	0xc1, 0x6f, 0x21, 0xc3, 0x0d, 0x14, 0x70, 0x00, 0x89, 0xcb, 0x45, 0x40,
+	0x00, 0x00, 0x18, 0x26, 0x03, 0xf0, 0x12, 0x84, 0x06, 0x57, 0x08, 0x3e,
+	0x00, 0xc0, 0x7d, 0xe9, 0x11, 0x8f, 0x80, 0xc3, 0x41, 0x43, 0x01, 0x00,
+	0x00, 0xc6, 0x0a, 0x6f, 0xfd, 0x0c, 0x74, 0x5f, 0x27, 0x82, 0x11, 0xc3,
+	0x43, 0x12, 0x00, 0x10, 0x3a, 0x0d, 0xf0, 0x0c, 0x90, 0x00, 0x00, 0x08,
+	0xdf, 0x78, 0x62, 0x25, 0x78, 0x00, 0x90, 0x00, 0xae, 0x61, 0xbf, 0x01,
+	0x0f, 0x31, 0x10, 0x1d, 0x78, 0x19, 0xae, 0x02, 0x6b, 0x58, 0x60, 0x14,
+	0x00, 0x00, 0x5c, 0x0d, 0xf0, 0x15, 0xb6, 0x06, 0x08, 0xda, 0x00, 0xa9,
+	0x61, 0xba, 0x01, 0x0a, 0x31, 0x00, 0x1d, 0x78, 0x19, 0xa9, 0x6c, 0xbe,
+	0xc1, 0x40, 0xd6, 0x0e, 0xef, 0xfe, 0x0d, 0xd9, 0xc1, 0x40, 0x0d, 0xd9,
+	0xd2, 0x08, 0x6f, 0xfe, 0x40, 0xda, 0x0a, 0x00, 0xf0, 0x07, 0xe2, 0x0f,
+	0x2f, 0xfd, 0x7f, 0xda, 0xff, 0xdf, 0xc1, 0x40, 0x2c, 0x70, 0xa1, 0x42,
+	0x6c, 0x70, 0x3a, 0x0d, 0xef, 0xff, 0x40, 0xc7, 0x1a, 0x00, 0x60, 0xae,
+	0x08, 0x6f, 0xfe, 0x80, 0xda, 0x18, 0x00, 0x93, 0xc3, 0x42, 0xff, 0xff,
+	0xff, 0xdf, 0x6c, 0x77, 0x1e, 0x1c, 0x00, 0x20, 0xba, 0x0b, 0x48, 0x00,
+	0x42, 0x87, 0x74, 0xc6, 0xc6, 0xf8, 0x02, 0x51, 0xb2, 0xc1, 0x00, 0x16,
+	0x8d, 0x4c, 0x0a, 0xf0, 0x05, 0x28, 0x43, 0x43, 0xc0, 0x20, 0x40, 0x2c,
+	0x70, 0x96, 0x09, 0x6f, 0xfd, 0x4c, 0x73, 0x45, 0xc0, 0x61, 0x40, 0x2c,
+	0x74, 0x68, 0x05, 0xf0, 0x01, 0x08, 0xda, 0x46, 0xc0, 0x03, 0xc0, 0x1a,
+	0x25, 0x8d, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x4c, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x26, 0x03, 0x00, 0x00, 0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82,
+	0x17, 0x03, 0x00, 0x00, 0xf1, 0x8a, 0x55, 0x20, 0xc0, 0x08, 0x44, 0xc0,
+	0x00, 0x16, 0x80, 0x70, 0x00, 0x80, 0x69, 0x06, 0x41, 0xc0, 0x42, 0xf0,
+	0x06, 0xc6, 0x05, 0xc0, 0x51, 0x23, 0x00, 0xb0, 0xca, 0x26, 0x01, 0x10,
+	0x36, 0xee, 0x4f, 0x78, 0x41, 0xd9, 0x0a, 0x79, 0x47, 0xc0, 0xc3, 0x40,
+	0x00, 0x80, 0x1a, 0x07, 0x0a, 0x61, 0x38, 0x60, 0x01, 0x10, 0xc1, 0x00,
+	0x0c, 0xca, 0x63, 0x43, 0x59, 0x61, 0x44, 0x20, 0xc2, 0x07, 0x20, 0x40,
+	0x06, 0xea, 0x61, 0xba, 0x01, 0x0a, 0x31, 0x00, 0x1b, 0x78, 0x0f, 0x7f,
+	0x02, 0xc2, 0x7c, 0x27, 0x00, 0x18, 0xc3, 0x41, 0x75, 0x00, 0x03, 0x00,
+	0xea, 0x09, 0x2f, 0xfd, 0x40, 0xc7, 0x02, 0xc0, 0x04, 0xc1, 0x1a, 0x20,
+	0x80, 0x0f, 0x00, 0x00, 0x00, 0x10, 0xa5, 0x79, 0x05, 0x79, 0x63, 0x40,
+	0x9a, 0x20, 0x04, 0x00, 0x25, 0x78, 0x1b, 0x78, 0x91, 0xb8, 0x9c, 0xb8,
+	0x9f, 0xb8, 0xe0, 0xb0, 0xcf, 0x79, 0x07, 0xc0, 0x1a, 0x61, 0x67, 0x71,
+	0x8b, 0x0b, 0x94, 0xb0, 0x01, 0xc0, 0x04, 0x71, 0x41, 0xc0, 0x01, 0xc0,
+	0x0f, 0x78, 0x42, 0x72, 0x00, 0xc2, 0x69, 0x06, 0x21, 0x88, 0x02, 0xc0,
+	0xe7, 0x09, 0x25, 0x80, 0x6f, 0x70, 0xa4, 0x00, 0xf5, 0x4c, 0x12, 0x00,
+	0x47, 0x08, 0xb5, 0x01, 0x88, 0xc0, 0x00, 0x16, 0x8d, 0x70, 0x00, 0x80,
+	0x04, 0x00, 0x2c, 0x70, 0x8e, 0x0e, 0x6f, 0xfe, 0x28, 0xda, 0x03, 0xc2,
+	0xc3, 0x41, 0x19, 0x00, 0x01, 0x00, 0x22, 0x09, 0x6f, 0xfd, 0x0c, 0x75,
+	0x1a, 0x25, 0x8d, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x88, 0xc1,
+	0x4c, 0x72, 0xb2, 0x09, 0xef, 0xfe, 0xa5, 0x78, 0x0c, 0x70, 0x2c, 0x72,
+	0x88, 0xc2, 0x5e, 0x0a, 0x2f, 0xfd, 0x6c, 0x72, 0xb2, 0xc0, 0x04, 0x14,
+	0x1b, 0x34, 0xc6, 0xc6, 0xe0, 0x78, 0xe6, 0xc2, 0xfc, 0x1c, 0xc8, 0xb6,
+	0x82, 0x24, 0x03, 0x32, 0x43, 0x06, 0x01, 0x31, 0x00, 0x16, 0x9b, 0x5c,
+	0x00, 0xa0, 0xed, 0x70, 0x41, 0xc0, 0x03, 0xc0, 0x1a, 0x23, 0x9b, 0x3f,
+	0x4c, 0x00, 0xf0, 0x15, 0x55, 0x20, 0x00, 0x0c, 0x44, 0xc0, 0x57, 0xf0,
+	0xff, 0xd8, 0x44, 0x26, 0xc1, 0x17, 0x05, 0xe9, 0x61, 0xb9, 0xff, 0x09,
+	0x31, 0x80, 0x1d, 0x78, 0x93, 0x08, 0x3e, 0x00, 0xef, 0x78, 0x9f, 0x20,
+	0x41, 0x00, 0xc3, 0x41, 0x24, 0x01, 0x24, 0x2a, 0x60, 0x24, 0x01, 0x04,
+	0x22, 0x01, 0xf1, 0x00, 0x05, 0xea, 0x61, 0xba, 0xff, 0x0a, 0x31, 0x80,
+	0x1b, 0x78, 0x0e, 0x7a, 0x5c, 0x78, 0x1c, 0x02, 0x00, 0xf4, 0x2f, 0x00,
+	0x41, 0x1b, 0xd8, 0x61, 0xb8, 0x01, 0x08, 0x31, 0x00, 0x3d, 0x79, 0x38,
+	0x62, 0xc4, 0xb8, 0x31, 0x48, 0x44, 0x2a, 0x00, 0x08, 0x02, 0xc2, 0x10,
+	0x7d, 0x7c, 0x25, 0x00, 0x12, 0x9a, 0x25, 0x01, 0x10, 0x25, 0x7d, 0xb0,
+	0x79, 0x40, 0xc1, 0xc3, 0x41, 0x7b, 0x00, 0x03, 0x00, 0x9e, 0x08, 0x2f,
+	0xfd, 0xc1, 0x43, 0x04, 0xc0, 0xe5, 0x71, 0x05, 0x23, 0x01, 0x30, 0x02,
+	0xc0, 0x52, 0x01, 0x3b, 0x05, 0x79, 0xc1, 0x50, 0x01, 0x8f, 0xa0, 0xb0,
+	0xc5, 0x71, 0x5f, 0x0e, 0x54, 0x92, 0x4a, 0x01, 0x03, 0x55, 0xe9, 0x09,
+	0x25, 0x80, 0xcd, 0x4a, 0x01, 0x57, 0x45, 0x08, 0xb5, 0x01, 0x85, 0x4a,
+	0x01, 0x51, 0x42, 0x0d, 0x6f, 0xfe, 0xb4, 0x4a, 0x01, 0x79, 0x17, 0x00,
+	0x01, 0x00, 0xda, 0x0f, 0x2f, 0x4a, 0x01, 0x62, 0x85, 0xc1, 0x09, 0xda,
+	0x6a, 0x08, 0x4a, 0x01, 0x60, 0x09, 0xd9, 0x85, 0xc2, 0x16, 0x09, 0x4a,
+	0x01, 0x4a, 0x80, 0x24, 0x03, 0x32, 0x4c, 0x01, 0xf0, 0x00, 0xad, 0xc1,
+	0x40, 0xc0, 0xff, 0xd8, 0x2c, 0x70, 0x1e, 0x0f, 0x2f, 0xfd, 0x4c, 0x73,
+	0x46, 0x0c, 0x00, 0xf0, 0x3c, 0x74, 0x12, 0x0f, 0x2f, 0xfd, 0x08, 0xda,
+	0x47, 0xc0, 0x00, 0xc0, 0xcb, 0x47, 0x00, 0x80, 0x67, 0x06, 0x20, 0x8f,
+	0x5f, 0x20, 0x00, 0x05, 0x43, 0xc0, 0x3a, 0x60, 0x00, 0x22, 0x9b, 0x0f,
+	0x00, 0x80, 0x70, 0x1b, 0x76, 0x0b, 0xaf, 0xfd, 0x00, 0xc0, 0x20, 0x8f,
+	0xc1, 0x8f, 0x4c, 0x70, 0x0a, 0x26, 0x40, 0x30, 0x28, 0x43, 0x42, 0xc0,
+	0x41, 0xc2, 0x20, 0xf0, 0x07, 0xc5, 0x06, 0xc0, 0xca, 0x25, 0x01, 0x10,
+	0x18, 0xed, 0x07, 0xca, 0x2b, 0x09, 0x25, 0x00, 0x90, 0x02, 0x50, 0x44,
+	0xc0, 0x2a, 0x78, 0x32, 0x54, 0x02, 0xf4, 0x1c, 0x80, 0x1c, 0x07, 0x9a,
+	0x0b, 0x6f, 0xff, 0x45, 0xc0, 0x00, 0x1b, 0x02, 0x30, 0x04, 0xc2, 0x05,
+	0xc1, 0x01, 0xc0, 0xba, 0x62, 0x38, 0x60, 0x41, 0xc0, 0x67, 0x71, 0x40,
+	0x26, 0x5e, 0x30, 0x2f, 0x21, 0x87, 0x07, 0xc1, 0x0e, 0x65, 0x90, 0x51,
+	0x26, 0x00, 0xb0, 0x3e, 0x02, 0x11, 0x61, 0x3e, 0x02, 0xf0, 0x03, 0x2c,
+	0x70, 0x56, 0x0c, 0x6f, 0xfe, 0x14, 0xda, 0x00, 0xc2, 0xc3, 0x41, 0x18,
+	0x00, 0x01, 0x00, 0xee, 0x0e, 0xec, 0x00, 0x91, 0x03, 0xc2, 0x22, 0x8f,
+	0x63, 0x8f, 0x00, 0x22, 0x82, 0x92, 0x00, 0xf2, 0x15, 0x3b, 0x7c, 0x0e,
+	0xf0, 0xad, 0x70, 0x07, 0xf0, 0x88, 0xc6, 0x1e, 0x66, 0x08, 0x62, 0x85,
+	0x71, 0xa5, 0x71, 0x00, 0xae, 0xaf, 0x78, 0xf3, 0x08, 0xb4, 0x80, 0x90,
+	0x78, 0x24, 0x71, 0x2f, 0x78, 0xe7, 0x0b, 0x25, 0x80, 0x54, 0x02, 0xf3,
+	0x16, 0x0a, 0x08, 0x2f, 0xfd, 0x6c, 0x71, 0x00, 0x17, 0x8b, 0x10, 0xc1,
+	0x8f, 0x4e, 0x23, 0x40, 0x10, 0x1e, 0x66, 0x01, 0xc0, 0xd0, 0x79, 0x05,
+	0x28, 0x40, 0x00, 0xfe, 0x0a, 0x6f, 0xff, 0x0f, 0x78, 0x02, 0xc1, 0x00,
+	0xa9, 0xad, 0x72, 0x02, 0x1f, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0x50, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04,
+	0x22, 0x4d, 0x18, 0x60, 0x40, 0x82, 0x1a, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00,
+};
+const struct ddr_phy_fw_image lp4_pmu_train_2d_imem = DDR_PHY_FW_IMAGE(lp4_pmu_train_2d_imem_lz4, 16384);
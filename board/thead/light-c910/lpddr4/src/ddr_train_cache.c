@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * SPDX-License-Identifier: GPL-2.0+
+ */
+
+#include <common.h>
+#include <command.h>
+#include <cpu_func.h>
+#include <malloc.h>
+#include <memalign.h>
+#include <mmc.h>
+#include <linux/sizes.h>
+#include <u-boot/crc.h>
+#include "../include/common_lib.h"
+#include "../include/ddr_common_func.h"
+#include "../include/waitfwdone.h"
+#include "../include/ddr_phy_fw.h"
+#include "../include/ddr_train_cache.h"
+
+#ifdef CONFIG_DDR_H32_MODE
+#define DDR_TRAIN_NR_PHY		1
+#else
+#define DDR_TRAIN_NR_PHY		2
+#endif
+
+#define DDR_TRAIN_MAX_CSR		320
+#define DDR_TRAIN_MSGBLK_WORDS		0x40
+
+/* PHY firmware/CSR access */
+#define DDR_PHY_MICRO_CONT_MUX_SEL	0xd0000
+#define DDR_PHY_MICRO_RESET		0xd0099
+#define DDR_PHY_MSGBLK_SEQUENCE_CTRL	(DDR_PHY_DMEM_BASE + 0x8)
+#define DDR_PHY_SEQUENCE_CTRL_DEVINIT	0x1
+
+/* rank window probed by the post-restore memory check */
+#define DDR_TRAIN_VERIFY_LEN		SZ_4K
+
+struct ddr_train_csr_group {
+	u32 base;
+	u8 nblk;	/* number of DBYTE/ANIB instances, 0x1000 apart */
+	u8 nlane;	/* number of lanes per instance */
+	u16 lane_stride;
+};
+
+/*
+ * Trained PHY CSRs, following the DWC LPDDR4 multiPHY retention register
+ * list: everything the 1D/2D training firmware leaves behind and that is
+ * not written by the straight-line PHY init sequence.
+ */
+static const struct ddr_train_csr_group ddr_train_csr_groups[] = {
+	{ 0x10020, 4, 1, 0 },		/* DBYTE DFIMRL */
+	{ 0x10080, 4, 2, 0x100 },	/* DBYTE RxEnDlyTg0 */
+	{ 0x10081, 4, 2, 0x100 },	/* DBYTE RxEnDlyTg1 */
+	{ 0x1008c, 4, 2, 0x100 },	/* DBYTE RxClkDlyTg0 */
+	{ 0x1008d, 4, 2, 0x100 },	/* DBYTE RxClkDlyTg1 */
+	{ 0x100d0, 4, 2, 0x100 },	/* DBYTE TxDqsDlyTg0 */
+	{ 0x100d1, 4, 2, 0x100 },	/* DBYTE TxDqsDlyTg1 */
+	{ 0x100c0, 4, 9, 0x100 },	/* DBYTE TxDqDlyTg0 */
+	{ 0x100c1, 4, 9, 0x100 },	/* DBYTE TxDqDlyTg1 */
+	{ 0x10068, 4, 9, 0x100 },	/* DBYTE RxPBDlyTg0 */
+	{ 0x10069, 4, 9, 0x100 },	/* DBYTE RxPBDlyTg1 */
+	{ 0x10040, 4, 9, 0x100 },	/* DBYTE VrefDAC0 */
+	{ 0x10030, 4, 9, 0x100 },	/* DBYTE VrefDAC1 */
+	{ 0x00020, 6, 1, 0 },		/* ANIB ATxDly_p0 */
+	{ 0x20010, 1, 1, 0 },		/* MASTER PPTrain */
+	{ 0x20020, 1, 1, 0 },		/* MASTER HwtMRL */
+	{ 0x2002e, 1, 1, 0 },		/* MASTER ARdPtrInitVal */
+};
+
+struct ddr_train_cache_hdr {
+	u32 magic;
+	u16 version;
+	u16 nr_csr;
+	u8 type;
+	u8 rank_num;
+	u8 bits;
+	u8 dbi_off;
+	u16 speed;
+	u16 nr_phy;
+	u32 crc;	/* crc32 over everything after the header */
+};
+
+struct ddr_train_cache_csr {
+	u32 addr;
+	u16 val[DDR_TRAIN_NR_PHY];
+};
+
+struct ddr_train_cache_rec {
+	struct ddr_train_cache_hdr hdr;
+	u16 msgblk[DDR_TRAIN_NR_PHY][DDR_TRAIN_MSGBLK_WORDS];
+	struct ddr_train_cache_csr csr[DDR_TRAIN_MAX_CSR];
+};
+
+#define DDR_TRAIN_CACHE_BLKS	\
+	DIV_ROUND_UP(sizeof(struct ddr_train_cache_rec), 512)
+
+enum {
+	DDR_TRAIN_CACHE_MISS,		/* full training, nothing captured yet */
+	DDR_TRAIN_CACHE_HIT,		/* record valid, restore instead of train */
+	DDR_TRAIN_CACHE_CAPTURED,	/* trained, record ready to be stored */
+};
+
+static struct ddr_train_cache_rec *ddr_train_rec;
+static struct ddr_train_cache_hdr ddr_train_key;
+static int ddr_train_cache_state;
+
+static struct mmc *ddr_train_cache_mmc(void)
+{
+	struct mmc *mmc;
+	int ret;
+
+#if CONFIG_IS_ENABLED(DM_MMC)
+	ret = mmc_init_device(CONFIG_DDR_TRAIN_CACHE_MMC_DEV);
+#else
+	ret = mmc_initialize(NULL);
+#endif
+	if (ret)
+		return NULL;
+
+	mmc = find_mmc_device(CONFIG_DDR_TRAIN_CACHE_MMC_DEV);
+	if (!mmc || mmc_init(mmc))
+		return NULL;
+
+	return mmc;
+}
+
+static int ddr_train_cache_io(struct ddr_train_cache_rec *rec, lbaint_t blks,
+			      bool write)
+{
+	struct mmc *mmc;
+	ulong cnt;
+
+	mmc = ddr_train_cache_mmc();
+	if (!mmc)
+		return -ENODEV;
+
+	if (mmc_switch_part(mmc, CONFIG_DDR_TRAIN_CACHE_MMC_PART))
+		return -EIO;
+
+	if (write)
+		cnt = blk_dwrite(mmc_get_blk_desc(mmc),
+				 CONFIG_DDR_TRAIN_CACHE_SECTOR, blks, rec);
+	else
+		cnt = blk_dread(mmc_get_blk_desc(mmc),
+				CONFIG_DDR_TRAIN_CACHE_SECTOR, blks, rec);
+
+	mmc_switch_part(mmc, 0);
+
+	return cnt == blks ? 0 : -EIO;
+}
+
+static u32 ddr_train_cache_crc(struct ddr_train_cache_rec *rec)
+{
+	return crc32(0, (unsigned char *)rec->msgblk,
+		     sizeof(*rec) - sizeof(rec->hdr));
+}
+
+/**
+ * ddr_train_cache_load() - fetch the stored training record
+ *
+ * Reads the record from the boot eMMC and checks it against the DDR
+ * configuration of this build. On success the following PHY init restores
+ * the trained state instead of running 1D/2D training.
+ *
+ * @return 0 if a matching record was found, -ve on error or mismatch
+ */
+int ddr_train_cache_load(enum DDR_TYPE type, int rank_num, int speed,
+			 enum DDR_BITWIDTH bits)
+{
+	struct ddr_train_cache_hdr *hdr;
+	int ret;
+
+	ddr_train_cache_state = DDR_TRAIN_CACHE_MISS;
+
+	ddr_train_key.magic = DDR_TRAIN_CACHE_MAGIC;
+	ddr_train_key.version = DDR_TRAIN_CACHE_VERSION;
+	ddr_train_key.type = type;
+	ddr_train_key.rank_num = rank_num;
+	ddr_train_key.bits = bits;
+	ddr_train_key.speed = speed;
+	ddr_train_key.nr_phy = DDR_TRAIN_NR_PHY;
+#ifdef CONFIG_DDR_DBI_OFF
+	ddr_train_key.dbi_off = 1;
+#endif
+
+	ddr_train_rec = malloc_cache_aligned(DDR_TRAIN_CACHE_BLKS * 512);
+	if (!ddr_train_rec)
+		return -ENOMEM;
+
+	ret = ddr_train_cache_io(ddr_train_rec, DDR_TRAIN_CACHE_BLKS, false);
+	if (ret) {
+		printf("ddr: training cache unavailable (%d)\n", ret);
+		return ret;
+	}
+
+	hdr = &ddr_train_rec->hdr;
+	if (hdr->magic != ddr_train_key.magic ||
+	    hdr->version != ddr_train_key.version ||
+	    hdr->type != ddr_train_key.type ||
+	    hdr->rank_num != ddr_train_key.rank_num ||
+	    hdr->bits != ddr_train_key.bits ||
+	    hdr->dbi_off != ddr_train_key.dbi_off ||
+	    hdr->speed != ddr_train_key.speed ||
+	    hdr->nr_phy != ddr_train_key.nr_phy ||
+	    hdr->nr_csr > DDR_TRAIN_MAX_CSR) {
+		printf("ddr: no matching training cache, full training\n");
+		return -ENOENT;
+	}
+
+	if (hdr->crc != ddr_train_cache_crc(ddr_train_rec)) {
+		printf("ddr: training cache corrupted, full training\n");
+		return -EBADMSG;
+	}
+
+	ddr_train_cache_state = DDR_TRAIN_CACHE_HIT;
+
+	return 0;
+}
+
+int ddr_train_cache_valid(void)
+{
+	return ddr_train_cache_state == DDR_TRAIN_CACHE_HIT;
+}
+
+static void ddr_phyn_reg_wr(int phy, unsigned long addr, unsigned int val)
+{
+	if (phy)
+		ddr_phy1_reg_wr(addr, val);
+	else
+		ddr_phy0_reg_wr(addr, val);
+}
+
+static unsigned int ddr_phyn_reg_rd(int phy, unsigned long addr)
+{
+	return phy ? ddr_phy1_reg_rd(addr) : ddr_phy0_reg_rd(addr);
+}
+
+/**
+ * ddr_train_cache_restore() - program the cached training results
+ *
+ * Replaces the 1D/2D training step of the PHY init sequence: the trained
+ * CSRs are written back, then the 2D firmware image is loaded with the
+ * cached message block and started with only DevInit in its sequence
+ * control so that it brings up the DRAM mode registers without training.
+ * Leaves the PHY in the same state as the end of a full training.
+ */
+void ddr_train_cache_restore(const struct ddr_phy_fw_image *imem,
+			     const struct ddr_phy_fw_image *dmem)
+{
+	struct ddr_train_cache_rec *rec = ddr_train_rec;
+	int i, phy;
+
+	printf("ddr: restoring cached training results\n");
+
+	ddr_phy_reg_wr(DDR_PHY_MICRO_CONT_MUX_SEL, 0x0);
+	for (i = 0; i < rec->hdr.nr_csr; i++)
+		for (phy = 0; phy < DDR_TRAIN_NR_PHY; phy++)
+			ddr_phyn_reg_wr(phy, rec->csr[i].addr,
+					rec->csr[i].val[phy]);
+
+	ddr_phy_fw_load(DDR_PHY_IMEM_BASE, imem);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_CONT_MUX_SEL, 0x1);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_CONT_MUX_SEL, 0x0);
+	ddr_phy_fw_load(DDR_PHY_DMEM_BASE, dmem);
+	for (phy = 0; phy < DDR_TRAIN_NR_PHY; phy++)
+		for (i = 0; i < DDR_TRAIN_MSGBLK_WORDS; i++)
+			ddr_phyn_reg_wr(phy, DDR_PHY_DMEM_BASE + i,
+					rec->msgblk[phy][i]);
+	ddr_phy_reg_wr(DDR_PHY_MSGBLK_SEQUENCE_CTRL,
+		       DDR_PHY_SEQUENCE_CTRL_DEVINIT);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_CONT_MUX_SEL, 0x1);
+
+	ddr_phy_reg_wr(DDR_PHY_MICRO_RESET, 0x9);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_RESET, 0x1);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_RESET, 0x0);
+#ifndef CONFIG_DDR_H32_MODE
+	ddr_phy_broadcast_en(0);
+#endif
+	dwc_ddrphy_phyinit_userCustom_G_waitFwDone(1);
+#ifndef CONFIG_DDR_H32_MODE
+	dwc_ddrphy1_phyinit_userCustom_G_waitFwDone(1);
+	ddr_phy_broadcast_en(1);
+#endif
+	ddr_phy_reg_wr(DDR_PHY_MICRO_RESET, 0x1);
+	ddr_phy_reg_wr(DDR_PHY_MICRO_CONT_MUX_SEL, 0x0);
+}
+
+/**
+ * ddr_train_cache_capture() - snapshot the results of a full training
+ *
+ * Must be called right after 2D training, with the PHY CSRs accessible.
+ */
+void ddr_train_cache_capture(void)
+{
+	const struct ddr_train_csr_group *grp;
+	struct ddr_train_cache_rec *rec = ddr_train_rec;
+	int i, blk, lane, phy, n = 0;
+	u32 addr;
+
+	if (!rec)
+		return;
+
+	memset(rec, 0, sizeof(*rec));
+
+	for (phy = 0; phy < DDR_TRAIN_NR_PHY; phy++)
+		for (i = 0; i < DDR_TRAIN_MSGBLK_WORDS; i++)
+			rec->msgblk[phy][i] =
+				ddr_phyn_reg_rd(phy, DDR_PHY_DMEM_BASE + i);
+
+	for (i = 0; i < ARRAY_SIZE(ddr_train_csr_groups); i++) {
+		grp = &ddr_train_csr_groups[i];
+		for (blk = 0; blk < grp->nblk; blk++) {
+			for (lane = 0; lane < grp->nlane; lane++) {
+				if (n == DDR_TRAIN_MAX_CSR)
+					return;
+				addr = grp->base + blk * 0x1000 +
+				       lane * grp->lane_stride;
+				rec->csr[n].addr = addr;
+				for (phy = 0; phy < DDR_TRAIN_NR_PHY; phy++)
+					rec->csr[n].val[phy] =
+						ddr_phyn_reg_rd(phy, addr);
+				n++;
+			}
+		}
+	}
+
+	rec->hdr = ddr_train_key;
+	rec->hdr.nr_csr = n;
+	rec->hdr.crc = ddr_train_cache_crc(rec);
+
+	ddr_train_cache_state = DDR_TRAIN_CACHE_CAPTURED;
+}
+
+static int ddr_train_cache_check(ulong base, ulong len)
+{
+	volatile u64 *p = (volatile u64 *)base;
+	ulong i, n = len / sizeof(u64);
+	u64 pat;
+
+	/* address-in-address mixed with a walking one across all DQ lanes */
+	for (i = 0; i < n; i++)
+		p[i] = (base + i * sizeof(u64)) ^ (1ULL << (i & 63));
+
+	flush_dcache_range(base, base + len);
+	invalidate_dcache_range(base, base + len);
+
+	for (i = 0; i < n; i++) {
+		pat = (base + i * sizeof(u64)) ^ (1ULL << (i & 63));
+		if (p[i] != pat) {
+			printf("ddr: verify failed at 0x%lx: 0x%llx != 0x%llx\n",
+			       base + i * sizeof(u64), p[i], pat);
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static int ddr_train_cache_verify(void)
+{
+	ulong rank_size = get_ddr_density() / ddr_train_key.rank_num;
+	ulong base;
+	int rank;
+
+	for (rank = 0; rank < ddr_train_key.rank_num; rank++) {
+		base = CONFIG_SYS_SDRAM_BASE + rank * rank_size;
+		if (ddr_train_cache_check(base, DDR_TRAIN_VERIFY_LEN) ||
+		    ddr_train_cache_check(base + rank_size - DDR_TRAIN_VERIFY_LEN,
+					  DDR_TRAIN_VERIFY_LEN))
+			return -EIO;
+	}
+
+	return 0;
+}
+
+/**
+ * ddr_train_cache_finish() - verify DRAM and update the stored record
+ *
+ * Called once the controller is up. A record that was just captured is
+ * stored after the memory check passes; a restored record that fails the
+ * check is erased and the SoC is reset so the next boot trains again.
+ */
+void ddr_train_cache_finish(void)
+{
+	int ret;
+
+	if (!ddr_train_rec)
+		return;
+
+	ret = ddr_train_cache_verify();
+
+	switch (ddr_train_cache_state) {
+	case DDR_TRAIN_CACHE_HIT:
+		if (!ret)
+			break;
+		printf("ddr: cached training failed verify, retraining\n");
+		memset(ddr_train_rec, 0, sizeof(ddr_train_rec->hdr));
+		ddr_train_cache_io(ddr_train_rec, 1, true);
+		do_reset(NULL, 0, 0, NULL);
+		break;
+	case DDR_TRAIN_CACHE_CAPTURED:
+		if (ret) {
+			printf("ddr: training result failed verify, not cached\n");
+			break;
+		}
+		ret = ddr_train_cache_io(ddr_train_rec, DDR_TRAIN_CACHE_BLKS,
+					 true);
+		if (ret)
+			printf("ddr: failed to store training cache (%d)\n", ret);
+		break;
+	}
+
+	free(ddr_train_rec);
+	ddr_train_rec = NULL;
+}
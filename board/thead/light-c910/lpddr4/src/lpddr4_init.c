@@ -1,12 +1,18 @@
+#include <common.h>
 #include "../include/common_lib.h"
 #include "../include/pinmux.h"
 #include "../include/ddr_common_func.h"
 #include "../include/lpddr4_init.h"
+#include "../include/ddr_train_cache.h"
 
 extern void lp4_phy_train1d2d(enum DDR_TYPE type, int speed, enum DDR_BITWIDTH bits);
 
 void lpddr4_init(enum DDR_TYPE type, int rank_num, int speed, enum DDR_BITWIDTH bits)
 { 
+#ifdef CONFIG_DDR_TRAIN_CACHE
+  ddr_train_cache_load(type, rank_num, speed, bits);
+#endif
+
   //4266 3733 3200 2133
   //Others RSVD
   pll_config(speed);
@@ -24,7 +30,9 @@ void lpddr4_init(enum DDR_TYPE type, int rank_num, int speed, enum DDR_BITWIDTH
 
   dq_pinmux(bits); // pinmux config before training
 
+  bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "ddr training");
   lp4_phy_train1d2d(type, speed, bits);
+  bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "ddr enable");
 
   ctrl_en(bits);
 
@@ -33,4 +41,8 @@ void lpddr4_init(enum DDR_TYPE type, int rank_num, int speed, enum DDR_BITWIDTH
   enable_auto_refresh();
 
   lpddr4_auto_selref();
+
+#ifdef CONFIG_DDR_TRAIN_CACHE
+  ddr_train_cache_finish();
+#endif
 }
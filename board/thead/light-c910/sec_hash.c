@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * SHA-1/SHA-256 on the security engine, through the sc_sha API of the
+ * security library.
+ */
+
+#include <common.h>
+#include <cpu_func.h>
+#include <hash.h>
+#include <malloc.h>
+#include <watchdog.h>
+#include <asm/arch-thead/boot_mode.h>
+#include <linux/errno.h>
+#include <linux/sizes.h>
+#include <u-boot/sha1.h>
+#include <u-boot/sha256.h>
+/* the security library headers bring their own list_entry() */
+#undef list_entry
+#include "../../../lib/sec_library/include/sec_crypto_sha.h"
+
+static sc_sha_t light_sha;
+
+static int light_sha_probe(struct hash_engine *engine)
+{
+	static int ret = 1;
+
+	if (ret > 0) {
+		/* eFuse and crypto core first, as for secure boot */
+		ret = csi_sec_init();
+		if (!ret)
+			ret = sc_sha_init(&light_sha, 0);
+		ret = ret ? -ENODEV : 0;
+	}
+
+	return ret;
+}
+
+static sc_sha_mode_t light_sha_mode(int digest_size)
+{
+	return digest_size == SHA1_SUM_LEN ? SC_SHA_MODE_SHA1 : SC_SHA_MODE_256;
+}
+
+static int light_sha_start(int digest_size, void **ctxp)
+{
+	sc_sha_context_t *ctx = malloc(sizeof(*ctx));
+
+	if (!ctx)
+		return -ENOMEM;
+	if (sc_sha_start(&light_sha, ctx, light_sha_mode(digest_size))) {
+		free(ctx);
+		return -EIO;
+	}
+	*ctxp = ctx;
+
+	return 0;
+}
+
+static int light_sha_init(struct hash_algo *algo, void **ctxp)
+{
+	return light_sha_start(algo->digest_size, ctxp);
+}
+
+static int light_sha_update(struct hash_algo *algo, void *ctx,
+			    const void *buf, unsigned int size, int is_last)
+{
+	ulong start = (ulong)buf & ~(ARCH_DMA_MINALIGN - 1);
+	ulong end = ALIGN((ulong)buf + size, ARCH_DMA_MINALIGN);
+
+	/* the engine fetches the data itself */
+	flush_dcache_range(start, end);
+	if (sc_sha_update(&light_sha, ctx, buf, size)) {
+		free(ctx);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int light_sha_done(int digest_size, void *ctx, void *dest_buf)
+{
+	u8 output[HASH_MAX_DIGEST_SIZE];
+	uint32_t out_size;
+	int ret = 0;
+
+	if (sc_sha_finish(&light_sha, ctx, output, &out_size))
+		ret = -EIO;
+	else
+		memcpy(dest_buf, output, digest_size);
+	free(ctx);
+
+	return ret;
+}
+
+static int light_sha_finish(struct hash_algo *algo, void *ctx, void *dest_buf,
+			    int size)
+{
+	if (size < algo->digest_size) {
+		free(ctx);
+		return -ENOSPC;
+	}
+
+	return light_sha_done(algo->digest_size, ctx, dest_buf);
+}
+
+/* @sw is the built-in implementation, used if the engine fails */
+static void light_sha_ws(int digest_size, const unsigned char *input,
+			 unsigned int ilen, unsigned char *output,
+			 unsigned int chunk_sz,
+			 void (*sw)(const unsigned char *input,
+				    unsigned int ilen, unsigned char *output,
+				    unsigned int chunk_sz))
+{
+	const unsigned char *buf = input;
+	unsigned int left = ilen;
+	void *ctx;
+	uint len;
+
+	if (light_sha_start(digest_size, &ctx))
+		goto err;
+	do {
+		len = min(left, chunk_sz);
+		if (light_sha_update(NULL, ctx, buf, len, len == left))
+			goto err;
+		buf += len;
+		left -= len;
+		WATCHDOG_RESET();
+	} while (left);
+	if (!light_sha_done(digest_size, ctx, output))
+		return;
+err:
+	debug("%s: security engine failed, hashing on the CPU\n", __func__);
+	sw(input, ilen, output, chunk_sz);
+}
+
+#define LIGHT_SHA_ENGINE(_name, _str, _size, _sw)			\
+	static void _name##_ws(const unsigned char *input,		\
+			       unsigned int ilen, unsigned char *output,\
+			       unsigned int chunk_sz)			\
+	{								\
+		light_sha_ws(_size, input, ilen, output, chunk_sz, _sw);\
+	}								\
+	U_BOOT_HASH_ENGINE(_name) = {					\
+		.algo = {						\
+			.name		= _str,				\
+			.digest_size	= _size,			\
+			.chunk_size	= SZ_1M,			\
+			.hash_func_ws	= _name##_ws,			\
+			.hash_init	= light_sha_init,		\
+			.hash_update	= light_sha_update,		\
+			.hash_finish	= light_sha_finish,		\
+		},							\
+		.driver		= "light-sec",				\
+		.priority	= 1,					\
+		.flags		= HASH_ENGINE_OFFLOAD,			\
+		.probe		= light_sha_probe,			\
+	}
+
+LIGHT_SHA_ENGINE(light_sha1, "sha1", SHA1_SUM_LEN, sha1_csum_wd);
+LIGHT_SHA_ENGINE(light_sha256, "sha256", SHA256_SUM_LEN, sha256_csum_wd);
@@ -6,8 +6,11 @@
 
 #include <linux/types.h>
 #include <common.h>
+#include <bloblist.h>
 #include <console.h>
 #include <cpu_func.h>
+#include <mmc.h>
+#include <sdhci.h>
 #include <asm/csr.h>
 #include <asm/io.h>
 #include <asm/barrier.h>
@@ -320,6 +323,28 @@ static int bl1_img_have_head(unsigned long img_src_addr)
     return 0;
 }
 
+/*
+ * Hand the SPL timeline over to U-Boot proper. The bloblist must be sealed
+ * after the last record is added, as U-Boot proper checks its checksum.
+ */
+static void light_spl_handoff(void)
+{
+	__maybe_unused int ret;
+
+	bootstage_mark_name(BOOTSTAGE_ID_END_SPL, "end spl");
+#ifdef CONFIG_BOOTSTAGE_STASH
+	ret = bootstage_stash_default();
+	if (ret)
+		debug("Failed to stash bootstage: err=%d\n", ret);
+#endif
+	if (CONFIG_IS_ENABLED(BLOBLIST)) {
+		ret = bloblist_finish();
+		if (ret)
+			printf("Warning: Failed to finish bloblist (ret=%d)\n",
+			       ret);
+	}
+}
+
 static void light_board_init_r(gd_t *gd, ulong dummy)
 {
 	void (*entry)(long, long);
@@ -327,6 +352,7 @@ static void light_board_init_r(gd_t *gd, ulong dummy)
 
 	cpu_performance_enable();
 
+	bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "image check");
 	sram_uboot_start = (void *)(CONFIG_SPL_TEXT_BASE + CONFIG_SPL_MAX_SIZE);
 	if (bl1_img_have_head((unsigned long)SRAM_BASE_ADDR) == 1) {
 		uint32_t sign_en, encrypt_en;
@@ -341,8 +367,10 @@ static void light_board_init_r(gd_t *gd, ulong dummy)
 	} else {
 		printf("image has no header\n");
 	}
+	bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "image copy");
 	memcpy((void *)CONFIG_SYS_TEXT_BASE, sram_uboot_start, CONFIG_SYS_MONITOR_LEN);
 	entry = (void (*)(long, long))CONFIG_SYS_TEXT_BASE;
+	light_spl_handoff();
 	invalidate_icache_all();
 	flush_dcache_range(CONFIG_SYS_TEXT_BASE, CONFIG_SYS_TEXT_BASE + CONFIG_SYS_MONITOR_LEN);
 	entry(0, 0);
@@ -368,6 +396,7 @@ void board_init_f(ulong dummy)
 	preloader_console_init();
 
 #ifdef CONFIG_PMIC_VOL_INIT
+	bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "pmic init");
 	ret = pmic_ddr_regu_init();
 	if (ret) {
 		printf("%s pmic init failed %d \n",__func__,ret);
@@ -390,15 +419,45 @@ void board_init_f(ulong dummy)
 	ddr_clk_config(0);
 	cpu_clk_config(0);
 
+	bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "ddr init");
 	init_ddr();
+	bootstage_mark_name(BOOTSTAGE_ID_ALLOC, "ddr protect");
 	setup_ddr_scramble();
 	setup_ddr_parity();
 	setup_ddr_pmp();
 
+	if (CONFIG_IS_ENABLED(BLOBLIST)) {
+		/* The bloblist lives in DDR, so it cannot be set up earlier */
+		ret = bloblist_init();
+		if (ret) {
+			printf("%s bloblist init failed %d\n", __func__, ret);
+			hang();
+		}
+	}
+
 	printf("ddr initialized, jump to uboot\n");
 	light_board_init_r(NULL, 0);
 }
 
+#if defined(CONFIG_SPL_MMC_SUPPORT) && !CONFIG_IS_ENABLED(DM_MMC)
+#define LIGHT_EMMC_BASE		0xffe7080000
+
+/*
+ * SPL has no driver model, so register the boot eMMC by hand with the
+ * properties of the emmc node in the device tree.
+ */
+int board_mmc_init(bd_t *bis)
+{
+	static struct sdhci_host host = {
+		.name		= "emmc",
+		.ioaddr		= (void *)LIGHT_EMMC_BASE,
+		.host_caps	= MMC_MODE_8BIT | MMC_CAP_NONREMOVABLE,
+	};
+
+	return snps_sdhci_add(&host, true, true);
+}
+#endif
+
 void board_boot_order(u32 *spl_boot_list)
 {
 #define SOC_OM_ADDRBASE        0xffef018010
@@ -12,31 +12,42 @@
 static int blkc_show(cmd_tbl_t *cmdtp, int flag,
 		     int argc, char * const argv[])
 {
+	struct block_cache_dev_stats dev;
 	struct block_cache_stats stats;
+	int i;
+
 	blkcache_stats(&stats);
 
 	printf("hits: %u\n"
 	       "misses: %u\n"
 	       "entries: %u\n"
-	       "max blocks/entry: %u\n"
-	       "max cache entries: %u\n",
-	       stats.hits, stats.misses, stats.entries,
-	       stats.max_blocks_per_entry, stats.max_entries);
+	       "max cache entries: %u\n"
+	       "line size: %u, ways: %u\n"
+	       "size: %lu KiB, readahead: %lu KiB\n",
+	       stats.hits, stats.misses, stats.entries, stats.max_entries,
+	       stats.line_size, stats.ways, stats.size / 1024,
+	       stats.readahead / 1024);
+
+	for (i = 0; !blkcache_dev_stats(i, &dev); i++)
+		printf("%s %d: hits %u, misses %u, readahead %lu blocks\n",
+		       blk_get_if_type_name(dev.iftype), dev.devnum,
+		       dev.hits, dev.misses, dev.readahead);
 	return 0;
 }
 
 static int blkc_configure(cmd_tbl_t *cmdtp, int flag,
 			  int argc, char * const argv[])
 {
-	unsigned blocks_per_entry, max_entries;
+	unsigned long size, readahead;
 	if (argc != 3)
 		return CMD_RET_USAGE;
 
-	blocks_per_entry = simple_strtoul(argv[1], 0, 0);
-	max_entries = simple_strtoul(argv[2], 0, 0);
-	blkcache_configure(blocks_per_entry, max_entries);
-	printf("changed to max of %u entries of %u blocks each\n",
-	       max_entries, blocks_per_entry);
+	size = simple_strtoul(argv[1], 0, 0);
+	readahead = simple_strtoul(argv[2], 0, 0);
+	if (blkcache_configure(size * 1024 * 1024, readahead * 1024))
+		return CMD_RET_FAILURE;
+	printf("changed to %lu MiB with up to %lu KiB readahead\n",
+	       size, readahead);
 	return 0;
 }
 
@@ -82,5 +93,6 @@ U_BOOT_CMD(
 	blkcache, 4, 0, do_blkcache,
 	"block cache diagnostics and control",
 	"show - show and reset statistics\n"
-	"blkcache configure blocks entries\n"
+	"blkcache configure size readahead - set the cache size in MiB\n"
+	"    (0 disables it) and the maximum readahead in KiB\n"
 );
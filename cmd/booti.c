@@ -123,7 +123,12 @@ U_BOOT_CMD(
 extern int light_secboot(int argc, char * const argv[]);
 int do_secboot(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 {
-    if (light_secboot(argc, argv) != 0) {
+	int ret;
+
+	bootstage_start(BOOTSTAGE_ID_ACCUM_VERIFY, "verify");
+	ret = light_secboot(argc, argv);
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_VERIFY);
+    if (ret != 0) {
         run_command("reset", 0);
         return -1;
     }
@@ -6,8 +6,10 @@
  */
 
 #include <common.h>
+#include <blk.h>
 #include <command.h>
 #include <fs.h>
+#include <fs_dcache.h>
 
 static int do_size_wrapper(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 {
@@ -99,3 +101,63 @@ U_BOOT_CMD(
 	"fstype <interface> <dev>:<part> <varname>\n"
 	"- set environment variable to filesystem type\n"
 );
+
+#if defined(CONFIG_FS_DCACHE) || defined(CONFIG_FS_KEEP_MOUNT)
+static int do_fscache(cmd_tbl_t *cmdtp, int flag, int argc,
+		      char * const argv[])
+{
+#ifdef CONFIG_FS_DCACHE
+	struct fs_dcache_mount_info info;
+	struct fs_dcache_stats stats;
+	int i;
+#endif
+#ifdef CONFIG_FS_KEEP_MOUNT
+	struct fs_mount_info mnt;
+#endif
+
+	if (argc == 2 && !strcmp(argv[1], "flush")) {
+#ifdef CONFIG_FS_KEEP_MOUNT
+		fs_umount();
+#endif
+#ifdef CONFIG_FS_DCACHE
+		fs_dcache_flush();
+#endif
+		return 0;
+	}
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "show")))
+		return CMD_RET_USAGE;
+
+#ifdef CONFIG_FS_KEEP_MOUNT
+	if (!fs_get_mount(&mnt))
+		printf("mounted: %s on %s %d:%d partition %d%s\n", mnt.name,
+		       blk_get_if_type_name(mnt.iftype), mnt.devnum,
+		       mnt.hwpart, mnt.part, mnt.stale ? " (stale)" : "");
+	else
+		printf("mounted: none\n");
+#endif
+
+#ifdef CONFIG_FS_DCACHE
+	fs_dcache_stats(&stats);
+	printf("hits: %u\n"
+	       "misses: %u\n"
+	       "entries: %u\n"
+	       "max cache entries: %u\n",
+	       stats.hits, stats.misses, stats.entries, stats.max_entries);
+
+	for (i = 0; !fs_dcache_mount_info(i, &info); i++)
+		printf("%s %d:%d at " LBAFU ": %u entries%s\n",
+		       blk_get_if_type_name(info.iftype), info.devnum,
+		       info.hwpart, info.start, info.entries,
+		       info.current ? " (open)" : "");
+#endif
+
+	return 0;
+}
+
+U_BOOT_CMD(
+	fscache, 2, 0, do_fscache,
+	"filesystem mount and directory entry cache",
+	"[show] - show the kept mount and cache statistics, reset statistics\n"
+	"fscache flush - unmount the kept filesystem and drop all cached entries"
+);
+#endif
@@ -19,6 +19,15 @@ static int do_hash(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 	char *s;
 	int flags = HASH_FLAG_ENV;
 
+	if (argc == 5 && !strcmp(argv[1], "bench")) {
+		for (s = argv[2]; *s; s++)
+			*s = tolower(*s);
+		if (hash_bench(argv[2], simple_strtoul(argv[3], NULL, 16),
+			       simple_strtoul(argv[4], NULL, 16)))
+			return CMD_RET_FAILURE;
+		return CMD_RET_SUCCESS;
+	}
+
 #ifdef CONFIG_HASH_VERIFY
 	if (argc < 4)
 		return CMD_RET_USAGE;
@@ -46,7 +55,9 @@ U_BOOT_CMD(
 	hash,	HARGS,	1,	do_hash,
 	"compute hash message digest",
 	"algorithm address count [[*]hash_dest]\n"
-		"    - compute message digest [save to env var / *address]"
+		"    - compute message digest [save to env var / *address]\n"
+	"hash bench algorithm address count\n"
+		"    - compare the speed of all implementations of algorithm"
 #ifdef CONFIG_HASH_VERIFY
 	"\nhash -v algorithm address count [*]hash\n"
 		"    - verify message digest of memory area to immediate value, \n"
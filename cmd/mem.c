@@ -1236,7 +1236,7 @@ mod_mem(cmd_tbl_t *cmdtp, int incrflag, int flag, int argc, char * const argv[])
 
 static int do_mem_crc(cmd_tbl_t *cmdtp, int flag, int argc, char * const argv[])
 {
-	int flags = 0;
+	int flags = HASH_FLAG_RATE;
 	int ac;
 	char * const *av;
 
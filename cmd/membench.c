@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * Throughput of the memcpy/memmove/memset/memcmp implementations
+ */
+
+#include <common.h>
+#include <command.h>
+#include <console.h>
+#include <div64.h>
+#include <mapmem.h>
+#include <time.h>
+
+static void membench_report(const char *name, ulong size, ulong count,
+			    ulong us)
+{
+	u64 bytes = (u64)size * count;
+	u64 rate;
+
+	if (!us)
+		us = 1;
+	/* bytes per microsecond is MB/s, report in hundredths of GB/s */
+	rate = lldiv(bytes, us * 10);
+	printf("%-8s %10lu bytes x %lu: %8lu us, %llu.%02llu GB/s\n", name,
+	       size, count, us, rate / 100, rate % 100);
+}
+
+static int do_membench(cmd_tbl_t *cmdtp, int flag, int argc,
+		       char * const argv[])
+{
+	ulong dest, src, size, count = 1;
+	ulong i, start;
+	void *d, *s;
+	int ret = 0;
+
+	if (argc < 4)
+		return CMD_RET_USAGE;
+
+	dest = simple_strtoul(argv[1], NULL, 16);
+	src = simple_strtoul(argv[2], NULL, 16);
+	size = simple_strtoul(argv[3], NULL, 16);
+	if (argc > 4)
+		count = simple_strtoul(argv[4], NULL, 10);
+	if (!size || !count)
+		return CMD_RET_USAGE;
+
+	d = map_sysmem(dest, size);
+	s = map_sysmem(src, size);
+
+	start = timer_get_us();
+	for (i = 0; i < count; i++)
+		memcpy(d, s, size);
+	membench_report("memcpy", size, count, timer_get_us() - start);
+
+	start = timer_get_us();
+	for (i = 0; i < count; i++)
+		ret |= memcmp(d, s, size);
+	membench_report("memcmp", size, count, timer_get_us() - start);
+	if (ret) {
+		printf("memcmp: copy mismatch\n");
+		ret = CMD_RET_FAILURE;
+	}
+
+	/* overlapping move by one cache line, takes the backward path */
+	if (size > ARCH_DMA_MINALIGN) {
+		start = timer_get_us();
+		for (i = 0; i < count; i++)
+			memmove(d + ARCH_DMA_MINALIGN, d,
+				size - ARCH_DMA_MINALIGN);
+		membench_report("memmove", size - ARCH_DMA_MINALIGN, count,
+				timer_get_us() - start);
+	}
+
+	start = timer_get_us();
+	for (i = 0; i < count; i++)
+		memset(d, 0x5a, size);
+	membench_report("memset", size, count, timer_get_us() - start);
+
+	unmap_sysmem(s);
+	unmap_sysmem(d);
+
+	return ret;
+}
+
+U_BOOT_CMD(
+	membench,	5,	0,	do_membench,
+	"measure memory copy/compare/move/fill throughput",
+	"dest src size [count]\n"
+	"    - run memcpy, memcmp, memmove and memset 'count' times (default 1)\n"
+	"      over 'size' bytes and report the throughput in GB/s.\n"
+	"      The contents of 'dest' are destroyed."
+);
@@ -7,6 +7,7 @@
 #include <common.h>
 #include <command.h>
 #include <console.h>
+#include <div64.h>
 #include <mmc.h>
 #include <sparse_format.h>
 #include <image-sparse.h>
@@ -431,6 +432,7 @@ static int do_mmc_sparse_write(cmd_tbl_t *cmdtp, int flag,
 	char dest[11];
 	void *addr;
 	u32 blk;
+	int err;
 
 	if (argc != 3)
 		return CMD_RET_USAGE;
@@ -462,13 +464,16 @@ static int do_mmc_sparse_write(cmd_tbl_t *cmdtp, int flag,
 	sparse.size = dev_desc->lba - blk;
 	sparse.write = mmc_sparse_write;
 	sparse.reserve = mmc_sparse_reserve;
+	sparse.erase = NULL;
 	sparse.mssg = NULL;
 	sprintf(dest, "0x" LBAF, sparse.start * sparse.blksz);
 
-	if (write_sparse_image(&sparse, dest, addr, NULL))
-		return CMD_RET_FAILURE;
-	else
-		return CMD_RET_SUCCESS;
+	blk_dwrite_cache(dev_desc, true);
+	err = write_sparse_image(&sparse, dest, addr, NULL);
+	if (blk_dwrite_cache(dev_desc, false))
+		err = -EIO;
+
+	return err ? CMD_RET_FAILURE : CMD_RET_SUCCESS;
 }
 #endif
 
@@ -483,9 +488,11 @@ static int do_mmc_test(cmd_tbl_t *cmdtp, int flag,
 static int do_mmc_write(cmd_tbl_t *cmdtp, int flag,
 			int argc, char * const argv[])
 {
+	struct blk_desc *bd;
 	struct mmc *mmc;
 	u32 blk, cnt, n;
 	void *addr;
+	ulong start, ms;
 
 	if (argc != 4)
 		return CMD_RET_USAGE;
@@ -505,8 +512,18 @@ static int do_mmc_write(cmd_tbl_t *cmdtp, int flag,
 		printf("Error: card is write protected!\n");
 		return CMD_RET_FAILURE;
 	}
-	n = blk_dwrite(mmc_get_blk_desc(mmc), blk, cnt, addr);
+	bd = mmc_get_blk_desc(mmc);
+	start = get_timer(0);
+	blk_dwrite_cache(bd, true);
+	n = blk_dwrite(bd, blk, cnt, addr);
+	if (blk_dwrite_cache(bd, false))
+		n = 0;
+	ms = get_timer(start);
 	printf("%d blocks written: %s\n", n, (n == cnt) ? "OK" : "ERROR");
+	if (n == cnt && ms) {
+		printf("%lu bytes in %lu ms, ", (ulong)n * bd->blksz, ms);
+		print_size(lldiv((u64)n * bd->blksz * 1000, ms), "/s\n");
+	}
 
 	return (n == cnt) ? CMD_RET_SUCCESS : CMD_RET_FAILURE;
 }
@@ -34,6 +34,18 @@ static int ums_write_sector(struct ums *ums_dev,
 	return blk_dwrite(block_dev, blkstart, blkcnt, buf);
 }
 
+static int ums_flush(struct ums *ums_dev)
+{
+	struct blk_desc *block_dev = &ums_dev->block_dev;
+	int ret;
+
+	/* closing the write cache session writes the cache back */
+	ret = blk_dwrite_cache(block_dev, false);
+	blk_dwrite_cache(block_dev, true);
+
+	return ret;
+}
+
 static struct ums *ums;
 static int ums_count;
 
@@ -41,8 +53,10 @@ static void ums_fini(void)
 {
 	int i;
 
-	for (i = 0; i < ums_count; i++)
+	for (i = 0; i < ums_count; i++) {
+		blk_dwrite_cache(&ums[i].block_dev, false);
 		free((void *)ums[i].name);
+	}
 	free(ums);
 	ums = NULL;
 	ums_count = 0;
@@ -104,6 +118,7 @@ static int ums_init(const char *devtype, const char *devnums_part_str)
 
 		ums[ums_count].read_sector = ums_read_sector;
 		ums[ums_count].write_sector = ums_write_sector;
+		ums[ums_count].flush = ums_flush;
 
 		name = malloc(UMS_NAME_LEN);
 		if (!name)
@@ -118,6 +133,7 @@ static int ums_init(const char *devtype, const char *devnums_part_str)
 		       ums[ums_count].start_sector,
 		       ums[ums_count].num_sectors);
 
+		blk_dwrite_cache(&ums[ums_count].block_dev, true);
 		ums_count++;
 	}
 
@@ -454,10 +454,12 @@ static int should_load_env(void)
 static int initr_env(void)
 {
 	/* initialize environment */
+	bootstage_start(BOOTSTAGE_ID_ACCUM_ENV, "env_load");
 	if (should_load_env())
 		env_relocate();
 	else
 		env_set_default(NULL, 0);
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_ENV);
 #ifdef CONFIG_OF_CONTROL
 	env_set_hex("fdtcontroladdr",
 		    (unsigned long)map_to_sysmem(gd->fdt_blob));
@@ -10,7 +10,9 @@
  */
 
 #include <common.h>
+#include <bloblist.h>
 #include <malloc.h>
+#include <mapmem.h>
 #include <sort.h>
 #include <spl.h>
 #include <linux/compiler.h>
@@ -498,6 +500,40 @@ int bootstage_unstash(const void *base, int size)
 	return 0;
 }
 
+int bootstage_stash_default(void)
+{
+	void *stash;
+
+	if (CONFIG_IS_ENABLED(BLOBLIST)) {
+		stash = bloblist_ensure(BLOBLISTT_BOOTSTAGE,
+					CONFIG_BOOTSTAGE_STASH_SIZE);
+		if (!stash)
+			return -ENOSPC;
+	} else {
+		stash = map_sysmem(CONFIG_BOOTSTAGE_STASH_ADDR,
+				   CONFIG_BOOTSTAGE_STASH_SIZE);
+	}
+
+	return bootstage_stash(stash, CONFIG_BOOTSTAGE_STASH_SIZE);
+}
+
+int bootstage_unstash_default(void)
+{
+	const void *stash;
+
+	if (CONFIG_IS_ENABLED(BLOBLIST)) {
+		stash = bloblist_find(BLOBLISTT_BOOTSTAGE,
+				      CONFIG_BOOTSTAGE_STASH_SIZE);
+		if (!stash)
+			return -ENOENT;
+	} else {
+		stash = map_sysmem(CONFIG_BOOTSTAGE_STASH_ADDR,
+				   CONFIG_BOOTSTAGE_STASH_SIZE);
+	}
+
+	return bootstage_unstash(stash, CONFIG_BOOTSTAGE_STASH_SIZE);
+}
+
 int bootstage_get_size(void)
 {
 	struct bootstage_data *data = gd->bootstage;
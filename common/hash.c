@@ -12,6 +12,7 @@
 #ifndef USE_HOSTCC
 #include <common.h>
 #include <command.h>
+#include <div64.h>
 #include <env.h>
 #include <malloc.h>
 #include <mapmem.h>
@@ -19,6 +20,10 @@
 #include <asm/io.h>
 #include <linux/errno.h>
 #include <u-boot/crc.h>
+#if CONFIG_IS_ENABLED(HASH_PARALLEL)
+#include <cpu_func.h>
+#include <asm/smp.h>
+#endif
 #else
 #include "mkimage.h"
 #include <time.h>
@@ -241,33 +246,58 @@ static void reloc_update(void)
 #endif
 }
 
-int hash_lookup_algo(const char *algo_name, struct hash_algo **algop)
+#ifndef USE_HOSTCC
+/**
+ * hash_find_engine() - Find the preferred engine for an algorithm
+ *
+ * @algo_name:	Hash algorithm to look up
+ * @progressive: true if progressive hashing support is needed
+ * @skip_flags:	Ignore engines with any of these HASH_ENGINE_... flags
+ * @return the engine's algorithm, or NULL if no engine should be used
+ */
+static struct hash_algo *hash_find_engine(const char *algo_name,
+					  bool progressive, uint skip_flags)
 {
-	int i;
-
-	reloc_update();
-
-	for (i = 0; i < ARRAY_SIZE(hash_algo); i++) {
-		if (!strcmp(algo_name, hash_algo[i].name)) {
-			*algop = &hash_algo[i];
-			return 0;
-		}
+	struct hash_engine *start, *engine, *best = NULL;
+	const int n_ents = ll_entry_count(struct hash_engine, hash_engine);
+
+	start = ll_entry_start(struct hash_engine, hash_engine);
+	for (engine = start; engine != start + n_ents; engine++) {
+		if (strcmp(algo_name, engine->algo.name) ||
+		    (progressive && !engine->algo.hash_init) ||
+		    (engine->flags & skip_flags) || engine->priority <= 0)
+			continue;
+		if (best && best->priority >= engine->priority)
+			continue;
+		if (engine->probe && engine->probe(engine))
+			continue;
+		best = engine;
 	}
 
-	debug("Unknown hash algorithm '%s'\n", algo_name);
-	return -EPROTONOSUPPORT;
+	return best ? &best->algo : NULL;
+}
+#else
+static struct hash_algo *hash_find_engine(const char *algo_name,
+					  bool progressive, uint skip_flags)
+{
+	return NULL;
 }
+#endif
 
-int hash_progressive_lookup_algo(const char *algo_name,
-				 struct hash_algo **algop)
+static int hash_lookup(const char *algo_name, bool progressive,
+		       uint skip_flags, struct hash_algo **algop)
 {
 	int i;
 
 	reloc_update();
 
+	*algop = hash_find_engine(algo_name, progressive, skip_flags);
+	if (*algop)
+		return 0;
+
 	for (i = 0; i < ARRAY_SIZE(hash_algo); i++) {
 		if (!strcmp(algo_name, hash_algo[i].name)) {
-			if (hash_algo[i].hash_init) {
+			if (!progressive || hash_algo[i].hash_init) {
 				*algop = &hash_algo[i];
 				return 0;
 			}
@@ -278,6 +308,17 @@ int hash_progressive_lookup_algo(const char *algo_name,
 	return -EPROTONOSUPPORT;
 }
 
+int hash_lookup_algo(const char *algo_name, struct hash_algo **algop)
+{
+	return hash_lookup(algo_name, false, 0, algop);
+}
+
+int hash_progressive_lookup_algo(const char *algo_name,
+				 struct hash_algo **algop)
+{
+	return hash_lookup(algo_name, true, 0, algop);
+}
+
 #ifndef USE_HOSTCC
 int hash_parse_string(const char *algo_name, const char *str, uint8_t *result)
 {
@@ -321,6 +362,114 @@ int hash_block(const char *algo_name, const void *data, unsigned int len,
 	return 0;
 }
 
+#if CONFIG_IS_ENABLED(HASH_PARALLEL)
+struct hash_parallel {
+	struct hash_job *jobs;
+	struct hash_algo **algos;
+	void **ctxs;
+	int *rets;
+	int count;
+};
+
+/*
+ * Every hart computes the same greedy assignment of jobs to the least
+ * loaded hart, then hashes its own jobs. Contexts are set up and finished
+ * by the calling hart since that may use malloc(). Their size is private
+ * to each algorithm, so other harts clean their whole dcache before
+ * returning to leave the updated contexts in memory.
+ */
+static void hash_parallel_run(int idx, int nr, void *arg)
+{
+	struct hash_parallel *hp = arg;
+	ulong load[CONFIG_NR_CPUS] = { 0 };
+	int i, j, owner;
+
+	for (i = 0; i < hp->count; i++) {
+		for (owner = 0, j = 1; j < nr; j++) {
+			if (load[j] < load[owner])
+				owner = j;
+		}
+		load[owner] += hp->jobs[i].len;
+		if (owner != idx)
+			continue;
+
+		hp->rets[i] = hp->algos[i]->hash_update(hp->algos[i],
+							hp->ctxs[i],
+							hp->jobs[i].data,
+							hp->jobs[i].len, 1);
+	}
+
+	if (idx)
+		flush_dcache_all();
+}
+
+int hash_parallel(struct hash_job *jobs, int count)
+{
+	struct hash_parallel hp = {
+		.jobs = jobs,
+		.count = count,
+	};
+	int i, ret = 0;
+
+	hp.algos = calloc(count, sizeof(*hp.algos) + sizeof(*hp.ctxs) +
+			  sizeof(*hp.rets));
+	if (!hp.algos)
+		return -ENOMEM;
+	hp.ctxs = (void **)(hp.algos + count);
+	hp.rets = (int *)(hp.ctxs + count);
+
+	/* offload engines can only be driven from this hart */
+	for (i = 0; i < count; i++) {
+		ret = hash_lookup(jobs[i].algo_name, true,
+				  HASH_ENGINE_OFFLOAD, &hp.algos[i]);
+		if (!ret && hp.algos[i]->hash_init(hp.algos[i], &hp.ctxs[i]))
+			ret = -ENOMEM;
+		if (ret)
+			goto out;
+	}
+
+	smp_parallel_run(hash_parallel_run, &hp);
+
+	for (i = 0; i < count; i++) {
+		if (hp.rets[i]) {
+			/* the context was freed by the failed update */
+			hp.ctxs[i] = NULL;
+			ret = -EIO;
+			continue;
+		}
+		hp.algos[i]->hash_finish(hp.algos[i], hp.ctxs[i],
+					 jobs[i].output,
+					 hp.algos[i]->digest_size);
+		hp.ctxs[i] = NULL;
+	}
+
+out:
+	for (i = 0; i < count; i++) {
+		if (hp.ctxs[i])
+			hp.algos[i]->hash_finish(hp.algos[i], hp.ctxs[i],
+						 jobs[i].output,
+						 hp.algos[i]->digest_size);
+	}
+	free(hp.algos);
+
+	return ret;
+}
+#else
+int hash_parallel(struct hash_job *jobs, int count)
+{
+	int i, ret;
+
+	for (i = 0; i < count; i++) {
+		ret = hash_block(jobs[i].algo_name, jobs[i].data, jobs[i].len,
+				 jobs[i].output, NULL);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_CMD_HASH) || defined(CONFIG_CMD_SHA1SUM) || defined(CONFIG_CMD_CRC32)
 /**
  * store_result: Store the resulting sum to an address or variable
@@ -443,10 +592,28 @@ static void hash_show(struct hash_algo *algo, ulong addr, ulong len, uint8_t *ou
 		printf("%02x", output[i]);
 }
 
+/**
+ * hash_show_rate() - Print how long hashing took and the resulting rate
+ *
+ * @len:	Number of bytes hashed
+ * @start:	Value of get_timer(0) when hashing started
+ */
+static void hash_show_rate(ulong len, ulong start)
+{
+	ulong ms = get_timer(start);
+
+	printf("%lu bytes in %lu ms", len, ms);
+	if (ms) {
+		puts(", ");
+		print_size(lldiv((u64)len * 1000, ms), "/s");
+	}
+	putc('\n');
+}
+
 int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 		 int argc, char * const argv[])
 {
-	ulong addr, len;
+	ulong addr, len, start;
 
 	if ((argc < 2) || ((flags & HASH_FLAG_VERIFY) && (argc < 3)))
 		return CMD_RET_USAGE;
@@ -475,6 +642,7 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 				  sizeof(uint32_t) * HASH_MAX_DIGEST_SIZE);
 
 		buf = map_sysmem(addr, len);
+		start = get_timer(0);
 		algo->hash_func_ws(buf, len, output, algo->chunk_size);
 		unmap_sysmem(buf);
 
@@ -504,6 +672,8 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 		} else {
 			hash_show(algo, addr, len, output);
 			printf("\n");
+			if (flags & HASH_FLAG_RATE)
+				hash_show_rate(len, start);
 
 			if (argc) {
 				store_result(algo, output, *argv,
@@ -518,10 +688,13 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 		ulong crc;
 		ulong *ptr;
 
+		start = get_timer(0);
 		crc = crc32_wd(0, (const uchar *)addr, len, CHUNKSZ_CRC32);
 
 		printf("CRC32 for %08lx ... %08lx ==> %08lx\n",
 				addr, addr + len - 1, crc);
+		if (flags & HASH_FLAG_RATE)
+			hash_show_rate(len, start);
 
 		if (argc >= 3) {
 			ptr = (ulong *)simple_strtoul(argv[0], NULL, 16);
@@ -531,5 +704,71 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 
 	return 0;
 }
+
+#ifdef CONFIG_CMD_HASH
+static int hash_bench_one(struct hash_algo *algo, const char *driver,
+			  const void *buf, ulong len, u8 *ref, bool first)
+{
+	u8 output[HASH_MAX_DIGEST_SIZE];
+	ulong start;
+
+	printf("%-16s", driver);
+	start = get_timer(0);
+	algo->hash_func_ws(buf, len, output, algo->chunk_size);
+	if (first) {
+		memcpy(ref, output, algo->digest_size);
+	} else if (memcmp(ref, output, algo->digest_size)) {
+		puts("** digest mismatch **\n");
+		return -EIO;
+	}
+	hash_show_rate(len, start);
+
+	return 0;
+}
+
+int hash_bench(const char *algo_name, ulong addr, ulong len)
+{
+	struct hash_engine *start, *engine;
+	const int n_ents = ll_entry_count(struct hash_engine, hash_engine);
+	u8 ref[HASH_MAX_DIGEST_SIZE];
+	const void *buf;
+	bool first = true;
+	int i, ret = 0;
+
+	reloc_update();
+
+	buf = map_sysmem(addr, len);
+	for (i = 0; i < ARRAY_SIZE(hash_algo); i++) {
+		if (strcmp(algo_name, hash_algo[i].name))
+			continue;
+		if (hash_bench_one(&hash_algo[i], "built-in", buf, len, ref,
+				   first))
+			ret = -EIO;
+		first = false;
+	}
+
+	start = ll_entry_start(struct hash_engine, hash_engine);
+	for (engine = start; engine != start + n_ents; engine++) {
+		if (strcmp(algo_name, engine->algo.name))
+			continue;
+		if (engine->probe && engine->probe(engine)) {
+			printf("%-16sunavailable\n", engine->driver);
+			continue;
+		}
+		if (hash_bench_one(&engine->algo, engine->driver, buf, len,
+				   ref, first))
+			ret = -EIO;
+		first = false;
+	}
+	unmap_sysmem(buf);
+
+	if (first) {
+		printf("Unknown hash algorithm '%s'\n", algo_name);
+		return -EPROTONOSUPPORT;
+	}
+
+	return ret;
+}
+#endif
 #endif /* CONFIG_CMD_HASH || CONFIG_CMD_SHA1SUM || CONFIG_CMD_CRC32) */
 #endif /* !USE_HOSTCC */
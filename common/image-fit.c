@@ -1116,6 +1116,117 @@ int fit_set_timestamp(void *fit, int noffset, time_t timestamp)
 	return 0;
 }
 
+#if !defined(USE_HOSTCC) && CONFIG_IS_ENABLED(HASH_PARALLEL)
+#define FIT_PREHASH_MAX		16
+
+struct fit_prehash {
+	const void *data;
+	size_t size;
+	const char *algo;
+	uint8_t value[FIT_MAX_HASH_LEN];
+	int value_len;
+};
+
+static struct fit_prehash *fit_prehash;
+static int fit_prehash_count;
+
+/*
+ * Hash the data of all component images up front with hash_parallel(), so
+ * that independent images are hashed on all CPUs. calculate_hash() then
+ * picks the results up while the images are checked one by one. Only
+ * fit_all_image_verify() does this; fit_image_load() hashes each image
+ * on its own as it is loaded.
+ */
+static void fit_prehash_images(const void *fit, int images_noffset)
+{
+	struct hash_job jobs[FIT_PREHASH_MAX];
+	struct fit_prehash *ph;
+	const void *data;
+	size_t size;
+	char *algo;
+	int image_noffset, noffset;
+	int count = 0;
+
+	fit_prehash = calloc(FIT_PREHASH_MAX, sizeof(*fit_prehash));
+	if (!fit_prehash)
+		return;
+
+	fdt_for_each_subnode(image_noffset, fit, images_noffset) {
+		if (fit_image_get_data_and_size(fit, image_noffset, &data,
+						&size))
+			continue;
+
+		fdt_for_each_subnode(noffset, fit, image_noffset) {
+			if (strncmp(fit_get_name(fit, noffset, NULL),
+				    FIT_HASH_NODENAME,
+				    strlen(FIT_HASH_NODENAME)) ||
+			    fit_image_hash_get_algo(fit, noffset, &algo))
+				continue;
+			if (strcmp(algo, "sha1") && strcmp(algo, "sha256"))
+				continue;
+			if (count == FIT_PREHASH_MAX)
+				break;
+
+			ph = &fit_prehash[count];
+			ph->data = data;
+			ph->size = size;
+			ph->algo = algo;
+			ph->value_len = strcmp(algo, "sha1") ?
+					SHA256_SUM_LEN : SHA1_SUM_LEN;
+			jobs[count].algo_name = algo;
+			jobs[count].data = data;
+			jobs[count].len = size;
+			jobs[count].output = ph->value;
+			count++;
+		}
+	}
+
+	if (!hash_parallel(jobs, count))
+		fit_prehash_count = count;
+}
+
+static void fit_prehash_free(void)
+{
+	free(fit_prehash);
+	fit_prehash = NULL;
+	fit_prehash_count = 0;
+}
+
+static bool fit_prehash_lookup(const void *data, int data_len,
+			       const char *algo, uint8_t *value, int *value_len)
+{
+	struct fit_prehash *ph;
+	int i;
+
+	for (i = 0; i < fit_prehash_count; i++) {
+		ph = &fit_prehash[i];
+		if (ph->data == data && ph->size == data_len &&
+		    !strcmp(ph->algo, algo)) {
+			memcpy(value, ph->value, ph->value_len);
+			*value_len = ph->value_len;
+			return true;
+		}
+	}
+
+	return false;
+}
+#else
+static inline void fit_prehash_images(const void *fit, int images_noffset)
+{
+}
+
+static inline void fit_prehash_free(void)
+{
+}
+
+static inline bool fit_prehash_lookup(const void *data, int data_len,
+				      const char *algo, uint8_t *value,
+				      int *value_len)
+{
+	return false;
+}
+#endif
+
 /**
  * calculate_hash - calculate and return hash for provided input data
  * @data: pointer to the input data
@@ -1137,6 +1248,9 @@ int fit_set_timestamp(void *fit, int noffset, time_t timestamp)
 int calculate_hash(const void *data, int data_len, const char *algo,
 			uint8_t *value, int *value_len)
 {
+	if (fit_prehash_lookup(data, data_len, algo, value, value_len))
+		return 0;
+
 	if (IMAGE_ENABLE_CRC32 && strcmp(algo, "crc32") == 0) {
 		*((uint32_t *)value) = crc32_wd(0, data, data_len,
 							CHUNKSZ_CRC32);
@@ -1291,6 +1405,7 @@ int fit_image_verify(const void *fit, int image_noffset)
 	size_t		size;
 	int		noffset = 0;
 	char		*err_msg = "";
+	int		ret;
 
 	/* Get image data and data length */
 	if (fit_image_get_data_and_size(fit, image_noffset, &data, &size)) {
@@ -1301,7 +1416,11 @@ int fit_image_verify(const void *fit, int image_noffset)
 		return 0;
 	}
 
-	return fit_image_verify_with_data(fit, image_noffset, data, size);
+	bootstage_start(BOOTSTAGE_ID_ACCUM_VERIFY, "verify");
+	ret = fit_image_verify_with_data(fit, image_noffset, data, size);
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_VERIFY);
+
+	return ret;
 }
 
 /**
@@ -1333,6 +1452,7 @@ int fit_all_image_verify(const void *fit)
 	/* Process all image subnodes, check hashes for each */
 	printf("## Checking hash(es) for FIT Image at %08lx ...\n",
 	       (ulong)fit);
+	fit_prehash_images(fit, images_noffset);
 	for (ndepth = 0, count = 0,
 	     noffset = fdt_next_node(fit, images_noffset, &ndepth);
 			(noffset >= 0) && (ndepth > 0);
@@ -1346,11 +1466,14 @@ int fit_all_image_verify(const void *fit)
 			       fit_get_name(fit, noffset, NULL));
 			count++;
 
-			if (!fit_image_verify(fit, noffset))
+			if (!fit_image_verify(fit, noffset)) {
+				fit_prehash_free();
 				return 0;
+			}
 			printf("\n");
 		}
 	}
+	fit_prehash_free();
 	return 1;
 }
 
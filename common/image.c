@@ -23,6 +23,7 @@
 #include <image.h>
 #include <lz4.h>
 #include <mapmem.h>
+#include <zstd.h>
 
 #if IMAGE_ENABLE_FIT || IMAGE_ENABLE_OF_LIBFDT
 #include <linux/libfdt.h>
@@ -63,6 +64,7 @@ static const image_header_t *image_get_ramdisk(ulong rd_addr, uint8_t arch,
 #endif
 #endif /* !USE_HOSTCC*/
 
+#include <bootstage.h>
 #include <u-boot/crc.h>
 #include <imximage.h>
 
@@ -192,6 +194,7 @@ static const table_entry_t uimage_comp[] = {
 	{	IH_COMP_LZMA,	"lzma",		"lzma compressed",	},
 	{	IH_COMP_LZO,	"lzo",		"lzo compressed",	},
 	{	IH_COMP_LZ4,	"lz4",		"lz4 compressed",	},
+	{	IH_COMP_ZSTD,	"zstd",		"zstd compressed",	},
 	{	-1,		"",		"",			},
 };
 
@@ -414,6 +417,7 @@ int image_decomp(int comp, ulong load, ulong image_start, int type,
 
 	*load_end = load;
 	print_decomp_msg(comp, type, load == image_start);
+	bootstage_start(BOOTSTAGE_ID_ACCUM_DECOMP, "decompress");
 
 	/*
 	 * Load the image to the right place, decompressing if needed. After
@@ -479,10 +483,21 @@ int image_decomp(int comp, ulong load, ulong image_start, int type,
 		break;
 	}
 #endif /* CONFIG_LZ4 */
+#ifdef CONFIG_ZSTD
+	case IH_COMP_ZSTD: {
+		size_t size = unc_len;
+
+		ret = uzstd(image_buf, image_len, load_buf, &size);
+		image_len = size;
+		break;
+	}
+#endif /* CONFIG_ZSTD */
 	default:
 		printf("Unimplemented compression type %d\n", comp);
-		return -ENOSYS;
+		ret = -ENOSYS;
+		break;
 	}
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_DECOMP);
 
 	*load_end = load + image_len;
 
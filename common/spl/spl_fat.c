@@ -87,6 +87,7 @@ int spl_load_image_fat(struct spl_image_info *spl_image,
 
 		debug("Found FIT\n");
 		load.read = spl_fit_read;
+		load.bdesc = NULL;
 		load.bl_len = 1;
 		load.filename = (void *)filename;
 		load.priv = NULL;
@@ -8,9 +8,13 @@
 #include <errno.h>
 #include <fpga.h>
 #include <gzip.h>
+#include <hash.h>
 #include <image.h>
 #include <linux/libfdt.h>
+#include <malloc.h>
+#include <memalign.h>
 #include <spl.h>
+#include <u-boot/zlib.h>
 
 DECLARE_GLOBAL_DATA_PTR;
 
@@ -153,6 +157,245 @@ static int get_aligned_image_size(struct spl_load_info *info, int data_size,
 	return (data_size + info->bl_len - 1) / info->bl_len;
 }
 
+#if CONFIG_IS_ENABLED(FIT_STREAM)
+struct spl_fit_stream {
+	const void *fit;
+	int node;
+	/* hash check, algo is NULL if the image has no usable hash node */
+	struct hash_algo *algo;
+	void *hash_ctx;
+	int hash_node;
+	/* output */
+	bool gzip;
+	bool started;
+	z_stream zs;
+	u8 *dst;
+	ulong size;
+};
+
+static void spl_fit_stream_hash_init(struct spl_fit_stream *st)
+{
+#if CONFIG_IS_ENABLED(HASH_SUPPORT)
+	char *algo;
+	int noffset;
+
+	fdt_for_each_subnode(noffset, st->fit, st->node) {
+		if (strncmp(fit_get_name(st->fit, noffset, NULL),
+			    FIT_HASH_NODENAME, strlen(FIT_HASH_NODENAME)) ||
+		    fit_image_hash_get_algo(st->fit, noffset, &algo) ||
+		    hash_progressive_lookup_algo(algo, &st->algo))
+			continue;
+		if (st->algo->hash_init(st->algo, &st->hash_ctx)) {
+			st->algo = NULL;
+			continue;
+		}
+		st->hash_node = noffset;
+		return;
+	}
+	st->algo = NULL;
+#endif
+}
+
+/* Finish the hash and, if @check, compare it against the hash node */
+static int spl_fit_stream_hash_finish(struct spl_fit_stream *st, bool check)
+{
+#if CONFIG_IS_ENABLED(HASH_SUPPORT)
+	u8 value[FIT_MAX_HASH_LEN];
+	u8 *fit_value;
+	int fit_value_len;
+	int ret;
+
+	if (!st->algo)
+		return 0;
+	if (!check) {
+		st->algo->hash_finish(st->algo, st->hash_ctx, value,
+				      sizeof(value));
+		st->algo = NULL;
+		return 0;
+	}
+
+	printf("## Checking hash(es) for Image %s ... ",
+	       fit_get_name(st->fit, st->node, NULL));
+	ret = st->algo->hash_finish(st->algo, st->hash_ctx, value,
+				    sizeof(value));
+	st->algo = NULL;
+	if (ret ||
+	    fit_image_hash_get_value(st->fit, st->hash_node, &fit_value,
+				     &fit_value_len) ||
+	    fit_value_len > sizeof(value) ||
+	    memcmp(value, fit_value, fit_value_len)) {
+		puts("Bad hash value\n");
+		return -EPERM;
+	}
+	puts("OK\n");
+#endif
+
+	return 0;
+}
+
+/*
+ * Run one chunk of image data through the hash and the decompressor, or
+ * copy it into place, while it is still in the data cache.
+ */
+static int spl_fit_stream_chunk(struct spl_fit_stream *st, u8 *p, ulong len)
+{
+	int hdr, ret;
+
+#if CONFIG_IS_ENABLED(HASH_SUPPORT)
+	if (st->algo &&
+	    st->algo->hash_update(st->algo, st->hash_ctx, p, len, 0)) {
+		/* the context was freed on error */
+		st->algo = NULL;
+		return -EIO;
+	}
+#endif
+
+	if (!IS_ENABLED(CONFIG_SPL_GZIP) || !st->gzip) {
+		memcpy(st->dst + st->size, p, len);
+		st->size += len;
+		return 0;
+	}
+
+	if (!st->started) {
+		hdr = gzip_parse_header(p, len);
+		if (hdr < 0)
+			return -EINVAL;
+		st->zs.zalloc = gzalloc;
+		st->zs.zfree = gzfree;
+		if (inflateInit2(&st->zs, -MAX_WBITS) != Z_OK)
+			return -ENOMEM;
+		st->zs.next_out = st->dst;
+		st->zs.avail_out = CONFIG_SYS_BOOTM_LEN;
+		st->started = true;
+		p += hdr;
+		len -= hdr;
+	}
+
+	/* the gzip trailer following the deflate stream is not needed */
+	if (st->size)
+		return 0;
+
+	st->zs.next_in = p;
+	st->zs.avail_in = len;
+	ret = inflate(&st->zs, Z_NO_FLUSH);
+	if (ret == Z_STREAM_END) {
+		st->size = st->zs.total_out;
+	} else if (ret != Z_OK || !st->zs.avail_out) {
+		printf("Error: inflate() returned %d\n", ret);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/**
+ * spl_load_fit_image_stream() - load external image data in chunks
+ *
+ * Reads the data of an image stored outside the FIT through a bounce
+ * buffer of SPL_FIT_STREAM_CHUNK bytes, hashing and decompressing each
+ * chunk as it arrives. This replaces one pass over the whole image per
+ * stage with a single pass.
+ *
+ * With SPL_BLK_ASYNC and a block device in @info, a second buffer is used
+ * and the next chunk is read in the background while the current one is
+ * processed.
+ *
+ * @return size of the loaded image, -ENOMEM if the chunk buffer cannot be
+ * allocated, other -ve on error
+ */
+static long spl_load_fit_image_stream(struct spl_load_info *info,
+				      ulong sector, const void *fit, int node,
+				      int offset, int length, ulong load_addr,
+				      bool gzip)
+{
+	struct spl_fit_stream st = {
+		.fit = fit,
+		.node = node,
+		.gzip = gzip,
+		.dst = (u8 *)load_addr,
+	};
+	ulong unit = info->filename ? 1 : info->bl_len;
+	ulong chunk = CONFIG_SPL_FIT_STREAM_CHUNK / unit;
+	ulong pos = sector + get_aligned_image_offset(info, offset);
+	ulong count = get_aligned_image_size(info, length, offset);
+	ulong skip = get_aligned_image_overhead(info, offset);
+	ulong left = length;
+	ulong n = min(chunk, count);
+	ulong m, len;
+	u8 *buf = NULL, *cur, *next = NULL;
+	struct blk_req req;
+	bool pending = false;
+	int ret = 0;
+
+	if (CONFIG_IS_ENABLED(BLK_ASYNC) && info->bdesc) {
+		buf = malloc_cache_aligned(2 * chunk * unit);
+		if (buf)
+			next = buf + chunk * unit;
+	}
+	if (!buf)
+		buf = malloc_cache_aligned(chunk * unit);
+	if (!buf)
+		return -ENOMEM;
+	cur = buf;
+
+	spl_fit_stream_hash_init(&st);
+
+	if (next) {
+		ret = blk_dread_submit(info->bdesc, pos, n, cur, &req);
+		pending = !ret;
+	}
+
+	while (!ret && left) {
+		if (pending) {
+			pending = false;
+			if (blk_req_wait(&req) != n) {
+				ret = -EIO;
+				break;
+			}
+		} else if (info->read(info, pos, n, cur) != n) {
+			ret = -EIO;
+			break;
+		}
+		pos += n;
+		count -= n;
+
+		len = min(n * unit - skip, left);
+		m = min(chunk, count);
+		if (next && left > len) {
+			ret = blk_dread_submit(info->bdesc, pos, m, next, &req);
+			if (ret)
+				break;
+			pending = true;
+		}
+
+		ret = spl_fit_stream_chunk(&st, cur + skip, len);
+		left -= len;
+		skip = 0;
+		n = m;
+		if (next)
+			swap(cur, next);
+	}
+
+	/* the buffers must not be freed under a running read */
+	if (pending)
+		blk_req_wait(&req);
+
+	if (IS_ENABLED(CONFIG_SPL_GZIP) && st.started)
+		inflateEnd(&st.zs);
+	if (!ret && gzip && !st.size) {
+		puts("Uncompressing error\n");
+		ret = -EIO;
+	}
+	if (ret)
+		spl_fit_stream_hash_finish(&st, false);
+	else
+		ret = spl_fit_stream_hash_finish(&st, true);
+	free(buf);
+
+	return ret ? ret : st.size;
+}
+#endif
+
 /**
  * spl_load_fit_image(): load the image described in a certain FIT node
  * @info:	points to information about the device to load data from
@@ -217,6 +460,22 @@ static int spl_load_fit_image(struct spl_load_info *info, ulong sector,
 		if (fit_image_get_data_size(fit, node, &len))
 			return -ENOENT;
 
+#if CONFIG_IS_ENABLED(FIT_STREAM)
+		if (IS_ENABLED(CONFIG_SPL_GZIP) &&
+		    fit_image_get_comp(fit, node, &image_comp))
+			image_comp = IH_COMP_NONE;
+		size = spl_load_fit_image_stream(info, sector, fit, node,
+						 offset, len, load_addr,
+						 image_comp == IH_COMP_GZIP);
+		if ((long)size >= 0) {
+			length = size;
+			goto done;
+		}
+		if ((long)size != -ENOMEM)
+			return size;
+		/* no room for the chunk buffer, load in one go */
+#endif
+
 		load_ptr = (load_addr + align_len) & ~align_len;
 		length = len;
 
@@ -267,6 +526,9 @@ static int spl_load_fit_image(struct spl_load_info *info, ulong sector,
 		memcpy((void *)load_addr, src, length);
 	}
 
+#if CONFIG_IS_ENABLED(FIT_STREAM)
+done:
+#endif
 	if (image_info) {
 		image_info->load_addr = load_addr;
 		image_info->size = length;
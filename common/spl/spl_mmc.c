@@ -78,6 +78,7 @@ int mmc_load_image_raw_sector(struct spl_image_info *spl_image,
 		load.filename = NULL;
 		load.bl_len = mmc->read_bl_len;
 		load.read = h_spl_load_read;
+		load.bdesc = bd;
 		ret = spl_load_simple_fit(spl_image, &load, sector, header);
 	} else if (IS_ENABLED(CONFIG_SPL_LOAD_IMX_CONTAINER)) {
 		struct spl_load_info load;
@@ -87,6 +88,7 @@ int mmc_load_image_raw_sector(struct spl_image_info *spl_image,
 		load.filename = NULL;
 		load.bl_len = mmc->read_bl_len;
 		load.read = h_spl_load_read;
+		load.bdesc = NULL;
 
 		ret = spl_load_imx_container(spl_image, &load, sector);
 	} else {
@@ -47,6 +47,7 @@ static int spl_ram_load_image(struct spl_image_info *spl_image,
 		debug("Found FIT\n");
 		load.bl_len = 1;
 		load.read = spl_ram_load_read;
+		load.bdesc = NULL;
 		spl_load_simple_fit(spl_image, &load, 0, header);
 	} else {
 		ulong u_boot_pos = binman_sym(ulong, u_boot_any, image_pos);
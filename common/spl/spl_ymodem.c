@@ -126,6 +126,7 @@ int spl_ymodem_load_image(struct spl_image_info *spl_image,
 		info.buf = buf;
 		info.image_read = BUF_SIZE;
 		load.read = ymodem_read_fit;
+		load.bdesc = NULL;
 		ret = spl_load_simple_fit(spl_image, &load, 0, (void *)buf);
 		size = info.image_read;
 
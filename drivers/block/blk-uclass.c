@@ -10,6 +10,7 @@
 #include <dm/device-internal.h>
 #include <dm/lists.h>
 #include <dm/uclass-internal.h>
+#include <watchdog.h>
 
 static const char *if_typename_str[IF_TYPE_COUNT] = {
 	[IF_TYPE_IDE]		= "ide",
@@ -426,25 +427,24 @@ int blk_get_device(int if_type, int devnum, struct udevice **devp)
 	return device_probe(*devp);
 }
 
+static ulong blk_read_dev(struct blk_desc *block_dev, lbaint_t start,
+			  lbaint_t blkcnt, void *buffer)
+{
+	struct udevice *dev = block_dev->bdev;
+
+	return blk_get_ops(dev)->read(dev, start, blkcnt, buffer);
+}
+
 unsigned long blk_dread(struct blk_desc *block_dev, lbaint_t start,
 			lbaint_t blkcnt, void *buffer)
 {
 	struct udevice *dev = block_dev->bdev;
 	const struct blk_ops *ops = blk_get_ops(dev);
-	ulong blks_read;
 
 	if (!ops->read)
 		return -ENOSYS;
 
-	if (blkcache_read(block_dev->if_type, block_dev->devnum,
-			  start, blkcnt, block_dev->blksz, buffer))
-		return blkcnt;
-	blks_read = ops->read(dev, start, blkcnt, buffer);
-	if (blks_read == blkcnt)
-		blkcache_fill(block_dev->if_type, block_dev->devnum,
-			      start, blkcnt, block_dev->blksz, buffer);
-
-	return blks_read;
+	return blkcache_dread(block_dev, start, blkcnt, buffer, blk_read_dev);
 }
 
 unsigned long blk_dwrite(struct blk_desc *block_dev, lbaint_t start,
@@ -473,6 +473,72 @@ unsigned long blk_derase(struct blk_desc *block_dev, lbaint_t start,
 	return ops->erase(dev, start, blkcnt);
 }
 
+int blk_dwrite_cache(struct blk_desc *block_dev, bool enable)
+{
+	struct udevice *dev = block_dev->bdev;
+	const struct blk_ops *ops = blk_get_ops(dev);
+
+	if (!ops->write_cache)
+		return 0;
+
+	return ops->write_cache(dev, enable);
+}
+
+int blk_dread_submit(struct blk_desc *block_dev, lbaint_t start,
+		     lbaint_t blkcnt, void *buffer, struct blk_req *req)
+{
+	struct udevice *dev = block_dev->bdev;
+	const struct blk_ops *ops = blk_get_ops(dev);
+	ulong blks_read;
+	int ret;
+
+	req->desc = block_dev;
+	req->start = start;
+	req->blkcnt = blkcnt;
+	req->buffer = buffer;
+	req->done = 0;
+	req->cur = 0;
+	req->status = -EBUSY;
+
+	if (blkcnt && ops->read_submit) {
+		ret = ops->read_submit(dev, req);
+		if (ret != -ENOSYS) {
+			if (ret)
+				req->status = ret;
+			return ret;
+		}
+	}
+
+	/* the device cannot do this one in the background */
+	blks_read = blk_dread(block_dev, start, blkcnt, buffer);
+	if (IS_ERR_VALUE(blks_read)) {
+		req->status = blks_read;
+	} else {
+		req->done = blks_read;
+		req->status = blks_read == blkcnt ? 0 : -EIO;
+	}
+
+	return req->status;
+}
+
+int blk_req_poll(struct blk_req *req)
+{
+	struct udevice *dev = req->desc->bdev;
+
+	if (req->status == -EBUSY)
+		req->status = blk_get_ops(dev)->read_poll(dev, req);
+
+	return req->status;
+}
+
+long blk_req_wait(struct blk_req *req)
+{
+	while (blk_req_poll(req) == -EBUSY)
+		WATCHDOG_RESET();
+
+	return req->status ? req->status : req->done;
+}
+
 int blk_get_from_parent(struct udevice *parent, struct udevice **devp)
 {
 	struct udevice *dev;
@@ -6,162 +6,319 @@
  */
 #include <config.h>
 #include <common.h>
+#include <env.h>
+#include <fs.h>
+#include <fs_dcache.h>
 #include <malloc.h>
 #include <part.h>
 #include <linux/ctype.h>
-#include <linux/list.h>
+#include <linux/log2.h>
+#include <linux/sizes.h>
 
-struct block_cache_node {
-	struct list_head lh;
+/*
+ * The cache is a set-associative table of fixed-size lines. A line holds
+ * BLKCACHE_LINE_SIZE bytes of consecutive blocks, aligned on the line size,
+ * and is found by hashing (interface, device, line number) to a set of
+ * BLKCACHE_WAYS lines which is then searched. The least recently used line
+ * of the set is evicted on a fill.
+ *
+ * Reads that miss are widened to whole lines. When a device is read
+ * sequentially the window doubles on each miss up to the readahead limit,
+ * so walking a file or a directory costs a few large reads instead of many
+ * single-block ones. Reads larger than the readahead limit bypass the
+ * cache altogether.
+ */
+#define BLKCACHE_LINE_SIZE	SZ_8K
+#define BLKCACHE_WAYS		4
+#define BLKCACHE_MAX_DEVS	8
+
+struct block_cache_line {
 	int iftype;
 	int devnum;
-	lbaint_t start;
-	lbaint_t blkcnt;
 	unsigned long blksz;
-	char *cache;
+	lbaint_t tag;		/* first block / blocks per line */
+	ulong used;		/* LRU stamp, 0 if the line is free */
 };
 
-static LIST_HEAD(block_cache);
+struct block_cache_dev {
+	struct block_cache_dev_stats stats;
+	lbaint_t next;		/* block following the last read */
+	lbaint_t window;	/* current readahead window in blocks */
+};
+
+static struct block_cache_line *lines;
+static char *line_data;
+static char *ra_buf;
+static uint nsets;
+static ulong lru_clock;
+static bool configured;
+
+static struct block_cache_dev devs[BLKCACHE_MAX_DEVS];
 
 static struct block_cache_stats _stats = {
-	.max_blocks_per_entry = 8,
-	.max_entries = 32
+	.size = CONFIG_BLOCK_CACHE_SIZE * SZ_1M,
+	.line_size = BLKCACHE_LINE_SIZE,
+	.ways = BLKCACHE_WAYS,
+	.readahead = CONFIG_BLOCK_CACHE_READAHEAD * SZ_1K,
 };
 
-static struct block_cache_node *cache_find(int iftype, int devnum,
-					   lbaint_t start, lbaint_t blkcnt,
-					   unsigned long blksz)
+static void cache_free(void)
 {
-	struct block_cache_node *node;
-
-	list_for_each_entry(node, &block_cache, lh)
-		if ((node->iftype == iftype) &&
-		    (node->devnum == devnum) &&
-		    (node->blksz == blksz) &&
-		    (node->start <= start) &&
-		    (node->start + node->blkcnt >= start + blkcnt)) {
-			if (block_cache.next != &node->lh) {
-				/* maintain MRU ordering */
-				list_del(&node->lh);
-				list_add(&node->lh, &block_cache);
-			}
-			return node;
-		}
-	return 0;
+	free(lines);
+	free(line_data);
+	free(ra_buf);
+	lines = NULL;
+	line_data = NULL;
+	ra_buf = NULL;
+	nsets = 0;
+	_stats.entries = 0;
+	_stats.max_entries = 0;
 }
 
-int blkcache_read(int iftype, int devnum,
-		  lbaint_t start, lbaint_t blkcnt,
-		  unsigned long blksz, void *buffer)
+static int cache_alloc(void)
 {
-	struct block_cache_node *node = cache_find(iftype, devnum, start,
-						   blkcnt, blksz);
-	if (node) {
-		const char *src = node->cache + (start - node->start) * blksz;
-		memcpy(buffer, src, blksz * blkcnt);
-		debug("hit: start " LBAF ", count " LBAFU "\n",
-		      start, blkcnt);
-		++_stats.hits;
-		return 1;
+	uint n = _stats.size / (BLKCACHE_LINE_SIZE * BLKCACHE_WAYS);
+
+	if (!n || _stats.readahead < BLKCACHE_LINE_SIZE)
+		return -EINVAL;
+
+	/* the set index is taken from the hash with a mask */
+	nsets = 1 << (fls(n) - 1);
+	lines = calloc(nsets * BLKCACHE_WAYS, sizeof(*lines));
+	line_data = memalign(ARCH_DMA_MINALIGN,
+			     nsets * BLKCACHE_WAYS * BLKCACHE_LINE_SIZE);
+	ra_buf = memalign(ARCH_DMA_MINALIGN, _stats.readahead);
+	if (!lines || !line_data || !ra_buf) {
+		printf("blkcache: cannot allocate %u KiB\n",
+		       nsets * BLKCACHE_WAYS * BLKCACHE_LINE_SIZE / SZ_1K);
+		cache_free();
+		return -ENOMEM;
 	}
+	_stats.max_entries = nsets * BLKCACHE_WAYS;
 
-	debug("miss: start " LBAF ", count " LBAFU "\n",
-	      start, blkcnt);
-	++_stats.misses;
 	return 0;
 }
 
-void blkcache_fill(int iftype, int devnum,
-		   lbaint_t start, lbaint_t blkcnt,
-		   unsigned long blksz, void const *buffer)
+static bool cache_ready(void)
 {
-	lbaint_t bytes;
-	struct block_cache_node *node;
-
-	/* don't cache big stuff */
-	if (blkcnt > _stats.max_blocks_per_entry)
-		return;
-
-	if (_stats.max_entries == 0)
-		return;
-
-	bytes = blksz * blkcnt;
-	if (_stats.max_entries <= _stats.entries) {
-		/* pop LRU */
-		node = (struct block_cache_node *)block_cache.prev;
-		list_del(&node->lh);
-		_stats.entries--;
-		debug("drop: start " LBAF ", count " LBAFU "\n",
-		      node->start, node->blkcnt);
-		if (node->blkcnt * node->blksz < bytes) {
-			free(node->cache);
-			node->cache = 0;
-		}
-	} else {
-		node = malloc(sizeof(*node));
-		if (!node)
-			return;
-		node->cache = 0;
+	if (!configured) {
+		configured = true;
+#ifndef CONFIG_SPL_BUILD
+		_stats.size = env_get_ulong("blkcache_size", 10,
+					    _stats.size / SZ_1M) * SZ_1M;
+#endif
+		cache_alloc();
 	}
 
-	if (!node->cache) {
-		node->cache = malloc(bytes);
-		if (!node->cache) {
-			free(node);
-			return;
-		}
+	return nsets != 0;
+}
+
+static struct block_cache_dev *cache_dev(int iftype, int devnum, bool add)
+{
+	struct block_cache_dev *d, *free_dev = NULL;
+
+	for (d = devs; d < devs + BLKCACHE_MAX_DEVS; d++) {
+		if (d->stats.iftype == iftype && d->stats.devnum == devnum)
+			return d;
+		if (!free_dev && d->stats.iftype == IF_TYPE_UNKNOWN)
+			free_dev = d;
 	}
+	if (!add || !free_dev)
+		return NULL;
+
+	free_dev->stats.iftype = iftype;
+	free_dev->stats.devnum = devnum;
 
-	debug("fill: start " LBAF ", count " LBAFU "\n",
-	      start, blkcnt);
-
-	node->iftype = iftype;
-	node->devnum = devnum;
-	node->start = start;
-	node->blkcnt = blkcnt;
-	node->blksz = blksz;
-	memcpy(node->cache, buffer, bytes);
-	list_add(&node->lh, &block_cache);
-	_stats.entries++;
+	return free_dev;
 }
 
-void blkcache_invalidate(int iftype, int devnum)
+static struct block_cache_line *cache_set(int iftype, int devnum,
+					  lbaint_t tag)
+{
+	u64 h = ((u64)tag << 8 | (iftype << 4 ^ devnum)) *
+		0x9e3779b97f4a7c15ULL;
+
+	return &lines[((h >> 32) & (nsets - 1)) * BLKCACHE_WAYS];
+}
+
+static struct block_cache_line *cache_find(int iftype, int devnum,
+					   lbaint_t tag, unsigned long blksz)
+{
+	struct block_cache_line *set = cache_set(iftype, devnum, tag);
+	int i;
+
+	for (i = 0; i < BLKCACHE_WAYS; i++)
+		if (set[i].used && set[i].tag == tag &&
+		    set[i].iftype == iftype && set[i].devnum == devnum &&
+		    set[i].blksz == blksz)
+			return &set[i];
+
+	return NULL;
+}
+
+static char *line_buf(struct block_cache_line *line)
+{
+	return line_data + (line - lines) * BLKCACHE_LINE_SIZE;
+}
+
+static int cache_lookup(int iftype, int devnum, lbaint_t start,
+			lbaint_t blkcnt, unsigned long blksz, void *buffer)
+{
+	int shift = ilog2(BLKCACHE_LINE_SIZE / blksz);
+	lbaint_t per_line = (lbaint_t)1 << shift;
+	lbaint_t tag, end = start + blkcnt;
+	struct block_cache_line *line;
+	char *dst = buffer;
+
+	/* check first, so that a partial hit leaves the buffer alone */
+	for (tag = start >> shift; tag << shift < end; tag++)
+		if (!cache_find(iftype, devnum, tag, blksz))
+			return 0;
+
+	while (start < end) {
+		lbaint_t off = start & (per_line - 1);
+		lbaint_t cnt = min(per_line - off, end - start);
+
+		line = cache_find(iftype, devnum, start >> shift, blksz);
+		line->used = ++lru_clock;
+		memcpy(dst, line_buf(line) + off * blksz, cnt * blksz);
+		dst += cnt * blksz;
+		start += cnt;
+	}
+
+	return 1;
+}
+
+static void cache_fill(int iftype, int devnum, lbaint_t start,
+		       lbaint_t blkcnt, unsigned long blksz, const char *buffer)
 {
-	struct list_head *entry, *n;
-	struct block_cache_node *node;
-
-	list_for_each_safe(entry, n, &block_cache) {
-		node = (struct block_cache_node *)entry;
-		if ((node->iftype == iftype) &&
-		    (node->devnum == devnum)) {
-			list_del(entry);
-			free(node->cache);
-			free(node);
-			--_stats.entries;
+	int shift = ilog2(BLKCACHE_LINE_SIZE / blksz);
+	lbaint_t tag = (start + (1 << shift) - 1) >> shift;
+	struct block_cache_line *line, *set;
+	int i;
+
+	/* only whole lines are cached */
+	for (; (tag + 1) << shift <= start + blkcnt; tag++) {
+		line = cache_find(iftype, devnum, tag, blksz);
+		if (!line) {
+			set = cache_set(iftype, devnum, tag);
+			line = set;
+			for (i = 1; i < BLKCACHE_WAYS; i++)
+				if (set[i].used < line->used)
+					line = &set[i];
+			if (!line->used)
+				_stats.entries++;
+			line->iftype = iftype;
+			line->devnum = devnum;
+			line->blksz = blksz;
+			line->tag = tag;
 		}
+		line->used = ++lru_clock;
+		memcpy(line_buf(line),
+		       buffer + ((tag << shift) - start) * blksz,
+		       BLKCACHE_LINE_SIZE);
 	}
 }
 
-void blkcache_configure(unsigned blocks, unsigned entries)
+ulong blkcache_dread(struct blk_desc *block_dev, lbaint_t start,
+		     lbaint_t blkcnt, void *buffer, blkcache_read_t read)
 {
-	struct block_cache_node *node;
-	if ((blocks != _stats.max_blocks_per_entry) ||
-	    (entries != _stats.max_entries)) {
-		/* invalidate cache */
-		while (!list_empty(&block_cache)) {
-			node = (struct block_cache_node *)block_cache.next;
-			list_del(&node->lh);
-			free(node->cache);
-			free(node);
+	int iftype = block_dev->if_type;
+	int devnum = block_dev->devnum;
+	unsigned long blksz = block_dev->blksz;
+	struct block_cache_dev *dev;
+	lbaint_t per_line, ra_start, ra_end, ra_max;
+	ulong blks_read;
+	bool seq;
+
+	if (!cache_ready() || !is_power_of_2(blksz) ||
+	    blksz > BLKCACHE_LINE_SIZE || blkcnt * blksz > _stats.readahead)
+		return read(block_dev, start, blkcnt, buffer);
+
+	dev = cache_dev(iftype, devnum, true);
+	seq = dev && start == dev->next;
+	if (dev)
+		dev->next = start + blkcnt;
+
+	if (cache_lookup(iftype, devnum, start, blkcnt, blksz, buffer)) {
+		debug("hit: start " LBAF ", count " LBAFU "\n", start, blkcnt);
+		++_stats.hits;
+		if (dev)
+			dev->stats.hits++;
+		return blkcnt;
+	}
+
+	debug("miss: start " LBAF ", count " LBAFU "\n", start, blkcnt);
+	++_stats.misses;
+	per_line = BLKCACHE_LINE_SIZE / blksz;
+	ra_max = _stats.readahead / blksz;
+	ra_start = start & ~(per_line - 1);
+	ra_end = (start + blkcnt + per_line - 1) & ~(per_line - 1);
+	if (dev) {
+		dev->stats.misses++;
+		if (seq)
+			dev->window = clamp(dev->window * 2, per_line, ra_max);
+		else
+			dev->window = per_line;
+		ra_end = max(ra_end, ra_start + dev->window);
+	}
+	ra_end = min(ra_end, ra_start + ra_max);
+	if (block_dev->lba)
+		ra_end = min(ra_end, block_dev->lba);
+	if (ra_end < start + blkcnt)
+		return read(block_dev, start, blkcnt, buffer);
+
+	blks_read = read(block_dev, ra_start, ra_end - ra_start, ra_buf);
+	if (blks_read != ra_end - ra_start)
+		return read(block_dev, start, blkcnt, buffer);
+
+	debug("fill: start " LBAF ", count " LBAFU "\n", ra_start,
+	      ra_end - ra_start);
+	cache_fill(iftype, devnum, ra_start, ra_end - ra_start, blksz, ra_buf);
+	memcpy(buffer, ra_buf + (start - ra_start) * blksz, blkcnt * blksz);
+	if (dev)
+		dev->stats.readahead += ra_end - ra_start - blkcnt;
+
+	return blkcnt;
+}
+
+void blkcache_invalidate(int iftype, int devnum)
+{
+	struct block_cache_line *line;
+	struct block_cache_dev *dev;
+
+	/* cached directory entries and mounts go stale with the blocks */
+	fs_dcache_invalidate(iftype, devnum);
+	fs_invalidate(iftype, devnum);
+
+	for (line = lines; line < lines + _stats.max_entries; line++) {
+		if (line->used && line->iftype == iftype &&
+		    line->devnum == devnum) {
+			line->used = 0;
+			_stats.entries--;
 		}
-		_stats.entries = 0;
 	}
 
-	_stats.max_blocks_per_entry = blocks;
-	_stats.max_entries = entries;
+	dev = cache_dev(iftype, devnum, false);
+	if (dev) {
+		dev->next = 0;
+		dev->window = 0;
+	}
+}
 
+int blkcache_configure(unsigned long size, unsigned long readahead)
+{
+	cache_free();
+	configured = true;
+	_stats.size = size;
+	_stats.readahead = readahead;
 	_stats.hits = 0;
 	_stats.misses = 0;
+	memset(devs, 0, sizeof(devs));
+	if (!size)
+		return 0;
+
+	return cache_alloc();
 }
 
 void blkcache_stats(struct block_cache_stats *stats)
@@ -170,3 +327,20 @@ void blkcache_stats(struct block_cache_stats *stats)
 	_stats.hits = 0;
 	_stats.misses = 0;
 }
+
+int blkcache_dev_stats(int idx, struct block_cache_dev_stats *stats)
+{
+	struct block_cache_dev *dev;
+
+	if (idx < 0 || idx >= BLKCACHE_MAX_DEVS ||
+	    devs[idx].stats.iftype == IF_TYPE_UNKNOWN)
+		return -ENOENT;
+
+	dev = &devs[idx];
+	memcpy(stats, &dev->stats, sizeof(*stats));
+	dev->stats.hits = 0;
+	dev->stats.misses = 0;
+	dev->stats.readahead = 0;
+
+	return 0;
+}
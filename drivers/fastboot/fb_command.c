@@ -42,6 +42,9 @@ static void reboot_bootloader(char *, char *);
 static void oem_format(char *, char *);
 #endif
 static void oem_command(char *, char *);
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+static void oem_stream(char *, char *);
+#endif
 
 static const struct {
 	const char *command;
@@ -90,6 +93,12 @@ static const struct {
 		.command = "oem format",
 		.dispatch = oem_format,
 	},
+#endif
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+	[FASTBOOT_COMMAND_OEM_STREAM] = {
+		.command = "oem stream",
+		.dispatch = oem_stream,
+	},
 #endif
 	[FASTBOOT_COMMAND_OEM_COMMAND] = {
 		.command = "oem command",
@@ -187,6 +196,9 @@ static void download(char *cmd_parameter, char *response)
 	} else {
 		printf("Starting download of %d bytes\n",
 		       fastboot_bytes_expected);
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+		fastboot_mmc_stream_begin(fastboot_bytes_expected);
+#endif
 		fastboot_response("DATA", response, "%s", cmd_parameter);
 	}
 }
@@ -201,6 +213,23 @@ u32 fastboot_data_remaining(void)
 	return fastboot_bytes_expected - fastboot_bytes_received;
 }
 
+/**
+ * fastboot_data_buffer() - Return where download data can be received
+ *
+ * @offset: Offset from the start of the download buffer
+ * @len: Number of bytes to receive there
+ *
+ * Return: Pointer into the download buffer, or NULL if @len bytes at
+ * @offset do not fit
+ */
+void *fastboot_data_buffer(u32 offset, u32 len)
+{
+	if (offset > fastboot_buf_size || len > fastboot_buf_size - offset)
+		return NULL;
+
+	return fastboot_buf_addr + offset;
+}
+
 /**
  * fastboot_data_download() - Copy image data to fastboot_buf_addr.
  *
@@ -208,9 +237,10 @@ u32 fastboot_data_remaining(void)
  * @fastboot_data_len: Length of received fastboot data
  * @response: Pointer to fastboot response buffer
  *
- * Copies image data from fastboot_data to fastboot_buf_addr. Writes to
- * response. fastboot_bytes_received is updated to indicate the number
- * of bytes that have been transferred.
+ * Copies image data from fastboot_data to fastboot_buf_addr, unless it
+ * was received in place already. Writes to response.
+ * fastboot_bytes_received is updated to indicate the number of bytes that
+ * have been transferred.
  *
  * On completion sets image_size and ${filesize} to the total size of the
  * downloaded image.
@@ -221,21 +251,30 @@ void fastboot_data_download(const void *fastboot_data,
 {
 #define BYTES_PER_DOT	0x20000
 	u32 pre_dot_num, now_dot_num;
+	void *dst = fastboot_buf_addr + fastboot_bytes_received;
 
 	if (fastboot_data_len == 0 ||
 	    (fastboot_bytes_received + fastboot_data_len) >
 	    fastboot_bytes_expected) {
 		fastboot_fail("Received invalid data length",
 			      response);
+		fastboot_data_abort();
 		return;
 	}
-	/* Download data to fastboot_buf_addr */
-	memcpy(fastboot_buf_addr + fastboot_bytes_received,
-	       fastboot_data, fastboot_data_len);
+	/*
+	 * Download data to fastboot_buf_addr. USB receives it there directly
+	 * or slightly above it, so the areas may overlap.
+	 */
+	if (fastboot_data != dst)
+		memmove(dst, fastboot_data, fastboot_data_len);
 
 	pre_dot_num = fastboot_bytes_received / BYTES_PER_DOT;
 	fastboot_bytes_received += fastboot_data_len;
 	now_dot_num = fastboot_bytes_received / BYTES_PER_DOT;
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+	fastboot_mmc_stream_data(fastboot_buf_addr, fastboot_bytes_received,
+				 fastboot_bytes_expected);
+#endif
 
 	if (pre_dot_num != now_dot_num) {
 		putc('.');
@@ -245,6 +284,19 @@ void fastboot_data_download(const void *fastboot_data,
 	*response = '\0';
 }
 
+/**
+ * fastboot_data_abort() - Abandon the current transfer
+ *
+ * Releases what was set up for the download, such as the write cache
+ * session of an image streamed to eMMC.
+ */
+void fastboot_data_abort(void)
+{
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+	fastboot_mmc_stream_abort();
+#endif
+}
+
 /**
  * fastboot_data_complete() - Mark current transfer complete
  *
@@ -376,6 +428,10 @@ static void flash(char *cmd_parameter, char *response)
 	} 
 #endif
 
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+	if (fastboot_mmc_stream_flash(cmd_parameter, response))
+		return;
+#endif
 #if CONFIG_IS_ENABLED(FASTBOOT_FLASH_MMC)
 	printf("cmd_parameter: %s, imagesize: %d\n", cmd_parameter, image_size);
 	fastboot_mmc_flash_write(cmd_parameter, fastboot_buf_addr, image_size,
@@ -445,6 +501,19 @@ static void oem_format(char *cmd_parameter, char *response)
 }
 #endif
 
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+/**
+ * oem_stream() - Write the next download while it is being received
+ *
+ * @cmd_parameter: Pointer to partition name
+ * @response: Pointer to fastboot response buffer
+ */
+static void oem_stream(char *cmd_parameter, char *response)
+{
+	fastboot_mmc_stream_arm(cmd_parameter, response);
+}
+#endif
+
 /**
  * oem_command() - Execute the OEM command
  *
@@ -15,6 +15,7 @@
 #include <mmc.h>
 #include <div64.h>
 #include <linux/compat.h>
+#include <linux/log2.h>
 #include <android_image.h>
 
 #define FASTBOOT_MAX_BLK_WRITE 16384
@@ -97,6 +98,42 @@ static lbaint_t fb_mmc_sparse_reserve(struct sparse_storage *info,
 	return blkcnt;
 }
 
+static lbaint_t fb_mmc_sparse_erase(struct sparse_storage *info,
+		lbaint_t blk, lbaint_t blkcnt)
+{
+	struct fb_mmc_sparse *sparse = info->priv;
+
+	return fb_mmc_blk_write(sparse->dev_desc, blk, blkcnt, NULL);
+}
+
+/**
+ * fb_mmc_sparse_setup_erase() - Let FILL chunks be erased where possible
+ *
+ * eMMC reads erased blocks back as all zeroes or all ones, as given by
+ * EXT_CSD_ERASED_MEM_CONT, so FILL chunks of that value can be erased a
+ * whole erase group at a time.
+ *
+ * @dev_desc: MMC device descriptor
+ * @sparse: Sparse storage to set up
+ */
+static void fb_mmc_sparse_setup_erase(struct blk_desc *dev_desc,
+				      struct sparse_storage *sparse)
+{
+	struct mmc *mmc = find_mmc_device(dev_desc->devnum);
+
+	sparse->erase = NULL;
+	/* fb_mmc_blk_write() must not split an erase group */
+	if (!mmc || IS_SD(mmc) || !mmc->ext_csd ||
+	    !is_power_of_2(mmc->erase_grp_size) ||
+	    mmc->erase_grp_size > FASTBOOT_MAX_BLK_WRITE)
+		return;
+
+	sparse->erase = fb_mmc_sparse_erase;
+	sparse->erase_grp = mmc->erase_grp_size;
+	sparse->erase_val = mmc->ext_csd[EXT_CSD_ERASED_MEM_CONT] & 1 ?
+			    0xffffffff : 0;
+}
+
 static void write_raw_image(struct blk_desc *dev_desc, disk_partition_t *info,
 		const char *part_name, void *buffer,
 		u32 download_bytes, char *response)
@@ -337,6 +374,7 @@ void fastboot_mmc_flash_write(const char *cmd, void *download_buffer,
 {
 	struct blk_desc *dev_desc;
 	disk_partition_t info;
+	ulong start, ms;
 
 	dev_desc = blk_get_dev("mmc", CONFIG_FASTBOOT_FLASH_MMC_DEV);
 	if (!dev_desc || dev_desc->type == DEV_TYPE_UNKNOWN) {
@@ -402,6 +440,8 @@ void fastboot_mmc_flash_write(const char *cmd, void *download_buffer,
 		return;
 	}
 
+	start = get_timer(0);
+	blk_dwrite_cache(dev_desc, true);
 	if (is_sparse_image(download_buffer)) {
 		struct fb_mmc_sparse sparse_priv;
 		struct sparse_storage sparse;
@@ -415,6 +455,7 @@ void fastboot_mmc_flash_write(const char *cmd, void *download_buffer,
 		sparse.write = fb_mmc_sparse_write;
 		sparse.reserve = fb_mmc_sparse_reserve;
 		sparse.mssg = fastboot_fail;
+		fb_mmc_sparse_setup_erase(dev_desc, &sparse);
 
 		printf("Flashing sparse image at offset " LBAFU "\n",
 		       sparse.start);
@@ -428,8 +469,141 @@ void fastboot_mmc_flash_write(const char *cmd, void *download_buffer,
 		write_raw_image(dev_desc, &info, cmd, download_buffer,
 				download_bytes, response);
 	}
+	if (blk_dwrite_cache(dev_desc, false)) {
+		pr_err("failed flushing device %d\n", dev_desc->devnum);
+		fastboot_fail("failed flushing device", response);
+		return;
+	}
+	if (strncmp(response, "OKAY", 4))
+		return;
+
+	ms = get_timer(start);
+	printf("........ %u byte image flashed in %lu ms", download_bytes, ms);
+	if (ms) {
+		puts(", ");
+		print_size(lldiv((u64)download_bytes * 1000, ms), "/s");
+	}
+	putc('\n');
+}
+
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+/* Write at least this many blocks at a time while downloading */
+#define FASTBOOT_STREAM_MIN_BLKS	2048
+
+/**
+ * struct fb_mmc_stream - raw image written while it is downloaded
+ *
+ * @part_name: Partition the next download is meant for
+ * @dev_desc: Block device of the partition
+ * @info: The partition
+ * @written: Blocks of the current download written so far
+ * @armed: The next download is streamed to @part_name
+ * @active: The current download is being streamed
+ * @done: All of the last download has been written to @part_name
+ */
+static struct fb_mmc_stream {
+	char part_name[PART_NAME_LEN];
+	struct blk_desc *dev_desc;
+	disk_partition_t info;
+	lbaint_t written;
+	bool armed;
+	bool active;
+	bool done;
+} fb_stream;
+
+void fastboot_mmc_stream_arm(const char *part_name, char *response)
+{
+	fb_stream.armed = false;
+	if (fastboot_mmc_get_part_info(part_name, &fb_stream.dev_desc,
+				       &fb_stream.info, response) < 0)
+		return;
+
+	strlcpy(fb_stream.part_name, part_name, sizeof(fb_stream.part_name));
+	fb_stream.armed = true;
+	fastboot_okay(NULL, response);
 }
 
+void fastboot_mmc_stream_abort(void)
+{
+	if (fb_stream.active && fb_stream.written)
+		blk_dwrite_cache(fb_stream.dev_desc, false);
+	fb_stream.active = false;
+}
+
+void fastboot_mmc_stream_begin(u32 download_bytes)
+{
+	u32 blksz = fb_stream.info.blksz;
+
+	/* a download that was cut short */
+	fastboot_mmc_stream_abort();
+
+	fb_stream.active = fb_stream.armed &&
+			   DIV_ROUND_UP(download_bytes, blksz) <=
+			   fb_stream.info.size;
+	fb_stream.armed = false;
+	fb_stream.done = false;
+	fb_stream.written = 0;
+}
+
+void fastboot_mmc_stream_data(void *download_buffer, u32 received,
+			      u32 expected)
+{
+	u32 blksz = fb_stream.info.blksz;
+	bool last = received == expected;
+	lbaint_t blkcnt;
+
+	if (!fb_stream.active)
+		return;
+
+	/* Sparse images are left to 'flash' */
+	if (!fb_stream.written) {
+		if (received < sizeof(sparse_header_t) && !last)
+			return;
+		if (is_sparse_image(download_buffer)) {
+			fb_stream.active = false;
+			return;
+		}
+	}
+
+	blkcnt = (last ? DIV_ROUND_UP(received, blksz) : received / blksz) -
+		 fb_stream.written;
+	if (!last && blkcnt < FASTBOOT_STREAM_MIN_BLKS)
+		return;
+
+	if (!fb_stream.written)
+		blk_dwrite_cache(fb_stream.dev_desc, true);
+	if (fb_mmc_blk_write(fb_stream.dev_desc,
+			     fb_stream.info.start + fb_stream.written, blkcnt,
+			     download_buffer + fb_stream.written * blksz) !=
+	    blkcnt) {
+		pr_err("failed streaming to '%s', leaving it to flash\n",
+		       fb_stream.part_name);
+		blk_dwrite_cache(fb_stream.dev_desc, false);
+		fb_stream.active = false;
+		return;
+	}
+
+	fb_stream.written += blkcnt;
+	if (last) {
+		fb_stream.active = false;
+		fb_stream.done = !blk_dwrite_cache(fb_stream.dev_desc, false);
+	}
+}
+
+bool fastboot_mmc_stream_flash(const char *cmd, char *response)
+{
+	if (!fb_stream.done || strcmp(cmd, fb_stream.part_name))
+		return false;
+
+	fb_stream.done = false;
+	printf("........ wrote " LBAFU " bytes to '%s' while downloading\n",
+	       fb_stream.written * fb_stream.info.blksz, cmd);
+	fastboot_okay(NULL, response);
+
+	return true;
+}
+#endif
+
 /**
  * fastboot_mmc_flash_erase() - Erase eMMC for fastboot
  *
@@ -30,9 +30,35 @@ int dm_mmc_send_cmd(struct udevice *dev, struct mmc_cmd *cmd,
 
 int mmc_send_cmd(struct mmc *mmc, struct mmc_cmd *cmd, struct mmc_data *data)
 {
+	mmc_async_drain(mmc);
 	return dm_mmc_send_cmd(mmc->dev, cmd, data);
 }
 
+#if CONFIG_IS_ENABLED(BLK_ASYNC)
+int mmc_send_cmd_submit(struct mmc *mmc, struct mmc_cmd *cmd,
+			struct mmc_data *data)
+{
+	struct dm_mmc_ops *ops = mmc_get_ops(mmc->dev);
+	int ret;
+
+	if (!ops->send_cmd_submit || !ops->send_cmd_poll)
+		return -ENOSYS;
+	if (!cmd)
+		return ops->send_cmd_submit(mmc->dev, NULL, data);
+
+	mmmc_trace_before_send(mmc, cmd);
+	ret = ops->send_cmd_submit(mmc->dev, cmd, data);
+	mmmc_trace_after_send(mmc, cmd, ret);
+
+	return ret;
+}
+
+int mmc_send_cmd_poll(struct mmc *mmc, struct mmc_data *data)
+{
+	return mmc_get_ops(mmc->dev)->send_cmd_poll(mmc->dev, data);
+}
+#endif
+
 int dm_mmc_set_ios(struct udevice *dev)
 {
 	struct dm_mmc_ops *ops = mmc_get_ops(dev);
@@ -423,6 +449,13 @@ static const struct blk_ops mmc_blk_ops = {
 #if CONFIG_IS_ENABLED(MMC_WRITE)
 	.write	= mmc_bwrite,
 	.erase	= mmc_berase,
+#endif
+#if CONFIG_IS_ENABLED(MMC_WRITE_CACHE)
+	.write_cache	= mmc_bwrite_cache,
+#endif
+#if CONFIG_IS_ENABLED(BLK_ASYNC)
+	.read_submit	= mmc_bread_submit,
+	.read_poll	= mmc_bread_poll,
 #endif
 	.select_hwpart	= mmc_select_hwpart,
 };
@@ -375,11 +375,36 @@ int mmc_send_tuning(struct mmc *mmc, u32 opcode, int *cmd_error)
 }
 #endif
 
+/**
+ * mmc_set_block_count() - pre-define the length of the next transfer
+ *
+ * @mmc:	MMC device
+ * @blkcnt:	number of blocks of the following multi-block command
+ *
+ * The card ends the transfer by itself, no STOP_TRANSMISSION is needed.
+ *
+ * @return 0 if OK, -ve on error
+ */
+int mmc_set_block_count(struct mmc *mmc, lbaint_t blkcnt)
+{
+	struct mmc_cmd cmd;
+
+	cmd.cmdidx = MMC_CMD_SET_BLOCK_COUNT;
+	cmd.cmdarg = blkcnt;
+	cmd.resp_type = MMC_RSP_R1;
+
+	return mmc_send_cmd(mmc, &cmd, NULL);
+}
+
 static int mmc_read_blocks(struct mmc *mmc, void *dst, lbaint_t start,
 			   lbaint_t blkcnt)
 {
 	struct mmc_cmd cmd;
 	struct mmc_data data;
+	bool sbc = blkcnt > 1 && mmc_can_cmd23(mmc);
+
+	if (sbc && mmc_set_block_count(mmc, blkcnt))
+		return 0;
 
 	if (blkcnt > 1)
 		cmd.cmdidx = MMC_CMD_READ_MULTIPLE_BLOCK;
@@ -401,7 +426,7 @@ static int mmc_read_blocks(struct mmc *mmc, void *dst, lbaint_t start,
 	if (mmc_send_cmd(mmc, &cmd, &data))
 		return 0;
 
-	if (blkcnt > 1) {
+	if (blkcnt > 1 && !sbc) {
 		cmd.cmdidx = MMC_CMD_STOP_TRANSMISSION;
 		cmd.cmdarg = 0;
 		cmd.resp_type = MMC_RSP_R1b;
@@ -473,6 +498,143 @@ ulong mmc_bread(struct blk_desc *block_dev, lbaint_t start, lbaint_t blkcnt,
 	return blkcnt;
 }
 
+#if CONFIG_IS_ENABLED(BLK_ASYNC) && CONFIG_IS_ENABLED(DM_MMC)
+/* Start the next transfer of a background read, at most b_max blocks */
+static int mmc_async_start(struct mmc *mmc, struct blk_req *req)
+{
+	lbaint_t start = req->start + req->done;
+	lbaint_t blkcnt = min(req->blkcnt - req->done,
+			      (lbaint_t)mmc->cfg->b_max);
+	struct mmc_data *data = &mmc->async_data;
+	bool sbc = blkcnt > 1 && mmc_can_cmd23(mmc);
+	struct mmc_cmd cmd;
+	int ret;
+
+	data->dest = req->buffer + req->done * mmc->read_bl_len;
+	data->blocks = blkcnt;
+	data->blocksize = mmc->read_bl_len;
+	data->flags = MMC_DATA_READ;
+
+	/* nothing may be sent to the card for a transfer the host won't run */
+	ret = mmc_send_cmd_submit(mmc, NULL, data);
+	if (ret)
+		return ret;
+
+	if (sbc && mmc_set_block_count(mmc, blkcnt))
+		return -EIO;
+
+	if (blkcnt > 1)
+		cmd.cmdidx = MMC_CMD_READ_MULTIPLE_BLOCK;
+	else
+		cmd.cmdidx = MMC_CMD_READ_SINGLE_BLOCK;
+
+	if (mmc->high_capacity)
+		cmd.cmdarg = start;
+	else
+		cmd.cmdarg = start * mmc->read_bl_len;
+
+	cmd.resp_type = MMC_RSP_R1;
+
+	ret = mmc_send_cmd_submit(mmc, &cmd, data);
+	if (ret)
+		return ret;
+
+	mmc->async_req = req;
+	mmc->async_stop = blkcnt > 1 && !sbc;
+	req->cur = blkcnt;
+
+	return 0;
+}
+
+static int mmc_async_poll(struct mmc *mmc)
+{
+	struct blk_req *req = mmc->async_req;
+	struct mmc_cmd cmd;
+	lbaint_t left;
+	int ret;
+
+	ret = mmc_send_cmd_poll(mmc, &mmc->async_data);
+	if (ret == -EBUSY)
+		return ret;
+
+	mmc->async_req = NULL;
+	if (!ret && mmc->async_stop) {
+		cmd.cmdidx = MMC_CMD_STOP_TRANSMISSION;
+		cmd.cmdarg = 0;
+		cmd.resp_type = MMC_RSP_R1b;
+		if (mmc_send_cmd(mmc, &cmd, NULL))
+			ret = -EIO;
+	}
+
+	if (!ret) {
+		req->done += req->cur;
+		if (req->done < req->blkcnt) {
+			ret = mmc_async_start(mmc, req);
+			if (!ret)
+				return -EBUSY;
+		}
+		/* the host may not take every chunk in the background */
+		if (ret == -ENOSYS) {
+			left = req->blkcnt - req->done;
+			if (blk_dread(req->desc, req->start + req->done, left,
+				      req->buffer + req->done *
+				      mmc->read_bl_len) == left) {
+				req->done += left;
+				ret = 0;
+			} else {
+				ret = -EIO;
+			}
+		}
+	}
+	req->status = ret;
+
+	return ret;
+}
+
+void mmc_async_drain(struct mmc *mmc)
+{
+	while (mmc->async_req)
+		mmc_async_poll(mmc);
+}
+
+int mmc_bread_submit(struct udevice *dev, struct blk_req *req)
+{
+	struct blk_desc *block_dev = dev_get_uclass_platdata(dev);
+	struct mmc *mmc = find_mmc_device(block_dev->devnum);
+	int err;
+
+	if (!mmc)
+		return -ENODEV;
+
+	err = blk_dselect_hwpart(block_dev, block_dev->hwpart);
+	if (err < 0)
+		return err;
+
+	if ((req->start + req->blkcnt) > block_dev->lba) {
+		pr_err("MMC: block number 0x" LBAF " exceeds max(0x" LBAF ")\n",
+		       req->start + req->blkcnt, block_dev->lba);
+		return -EINVAL;
+	}
+
+	if (mmc_set_blocklen(mmc, mmc->read_bl_len))
+		return -EIO;
+
+	return mmc_async_start(mmc, req);
+}
+
+int mmc_bread_poll(struct udevice *dev, struct blk_req *req)
+{
+	struct blk_desc *block_dev = dev_get_uclass_platdata(dev);
+	struct mmc *mmc = find_mmc_device(block_dev->devnum);
+
+	/* another access may have completed it already */
+	if (mmc && mmc->async_req == req)
+		return mmc_async_poll(mmc);
+
+	return req->status;
+}
+#endif
+
 static int mmc_go_idle(struct mmc *mmc)
 {
 	struct mmc_cmd cmd;
@@ -2345,6 +2507,17 @@ static int mmc_startup_v4(struct mmc *mmc)
 	if (mmc->version >= MMC_VERSION_4_5)
 		mmc->gen_cmd6_time = ext_csd[EXT_CSD_GENERIC_CMD6_TIME];
 
+#if CONFIG_IS_ENABLED(MMC_WRITE)
+	/* the cache is off after a reset */
+	mmc->cache_users = 0;
+	mmc->cache_size = 0;
+	if (mmc->version >= MMC_VERSION_4_5)
+		mmc->cache_size = ext_csd[EXT_CSD_CACHE_SIZE] << 0
+				| ext_csd[EXT_CSD_CACHE_SIZE + 1] << 8
+				| ext_csd[EXT_CSD_CACHE_SIZE + 2] << 16
+				| ext_csd[EXT_CSD_CACHE_SIZE + 3] << 24;
+#endif
+
 	/* The partition data may be non-zero but it is only
 	 * effective if PARTITION_SETTING_COMPLETED is set in
 	 * EXT_CSD, so ignore any data if this bit is not set,
@@ -3008,12 +3181,14 @@ int mmc_init(struct mmc *mmc)
 		return 0;
 
 	start = get_timer(0);
+	bootstage_start(BOOTSTAGE_ID_ACCUM_MMC, "mmc_init");
 
 	if (!mmc->init_in_progress)
 		err = mmc_start_init(mmc);
 
 	if (!err)
 		err = mmc_complete_init(mmc);
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_MMC);
 	if (err)
 		pr_info("%s: %d, time %lu\n", __func__, err, get_timer(start));
 
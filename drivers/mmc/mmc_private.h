@@ -16,6 +16,33 @@ int mmc_send_status(struct mmc *mmc, unsigned int *status);
 int mmc_poll_for_busy(struct mmc *mmc, int timeout);
 
 int mmc_set_blocklen(struct mmc *mmc, int len);
+int mmc_set_block_count(struct mmc *mmc, lbaint_t blkcnt);
+
+#if CONFIG_IS_ENABLED(BLK_ASYNC) && CONFIG_IS_ENABLED(DM_MMC)
+int mmc_send_cmd_submit(struct mmc *mmc, struct mmc_cmd *cmd,
+			struct mmc_data *data);
+int mmc_send_cmd_poll(struct mmc *mmc, struct mmc_data *data);
+int mmc_bread_submit(struct udevice *dev, struct blk_req *req);
+int mmc_bread_poll(struct udevice *dev, struct blk_req *req);
+
+/* Complete the background read, before sending anything else */
+void mmc_async_drain(struct mmc *mmc);
+#else
+static inline void mmc_async_drain(struct mmc *mmc) {}
+#endif
+
+/*
+ * Whether multi-block transfers can be bounded with SET_BLOCK_COUNT
+ * (CMD23) instead of being closed with STOP_TRANSMISSION.
+ */
+static inline bool mmc_can_cmd23(struct mmc *mmc)
+{
+	if (!(mmc->cfg->host_caps & MMC_CAP_CMD23) || mmc_host_is_spi(mmc))
+		return false;
+	if (IS_SD(mmc))
+		return mmc->scr[0] & SD_SCR_CMD23_SUPPORT;
+	return mmc->version >= MMC_VERSION_3;
+}
 #ifdef CONFIG_FSL_ESDHC_ADAPTER_IDENT
 void mmc_adapter_card_type_ident(void);
 #endif
@@ -34,6 +61,7 @@ ulong mmc_bread(struct blk_desc *block_dev, lbaint_t start, lbaint_t blkcnt,
 ulong mmc_bwrite(struct udevice *dev, lbaint_t start, lbaint_t blkcnt,
 		 const void *src);
 ulong mmc_berase(struct udevice *dev, lbaint_t start, lbaint_t blkcnt);
+int mmc_bwrite_cache(struct udevice *dev, bool enable);
 #else
 ulong mmc_bwrite(struct blk_desc *block_dev, lbaint_t start, lbaint_t blkcnt,
 		 const void *src);
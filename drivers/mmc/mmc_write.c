@@ -132,6 +132,7 @@ static ulong mmc_write_blocks(struct mmc *mmc, lbaint_t start,
 	struct mmc_cmd cmd;
 	struct mmc_data data;
 	int timeout_ms = 1000;
+	bool sbc = blkcnt > 1 && mmc_can_cmd23(mmc);
 
 	if ((start + blkcnt) > mmc_get_blk_desc(mmc)->lba) {
 		printf("MMC: block number 0x" LBAF " exceeds max(0x" LBAF ")\n",
@@ -158,6 +159,11 @@ static ulong mmc_write_blocks(struct mmc *mmc, lbaint_t start,
 	data.blocksize = mmc->write_bl_len;
 	data.flags = MMC_DATA_WRITE;
 
+	if (sbc && mmc_set_block_count(mmc, blkcnt)) {
+		printf("mmc fail to set block count\n");
+		return 0;
+	}
+
 	if (mmc_send_cmd(mmc, &cmd, &data)) {
 		printf("mmc write failed\n");
 		return 0;
@@ -166,7 +172,7 @@ static ulong mmc_write_blocks(struct mmc *mmc, lbaint_t start,
 	/* SPI multiblock writes terminate using a special
 	 * token, not a STOP_TRANSMISSION request.
 	 */
-	if (!mmc_host_is_spi(mmc) && blkcnt > 1) {
+	if (!mmc_host_is_spi(mmc) && blkcnt > 1 && !sbc) {
 		cmd.cmdidx = MMC_CMD_STOP_TRANSMISSION;
 		cmd.cmdarg = 0;
 		cmd.resp_type = MMC_RSP_R1b;
@@ -221,3 +227,65 @@ ulong mmc_bwrite(struct blk_desc *block_dev, lbaint_t start, lbaint_t blkcnt,
 
 	return blkcnt;
 }
+
+#if CONFIG_IS_ENABLED(MMC_WRITE_CACHE)
+/* Writing back a full cache can take a long time */
+#define MMC_CACHE_FLUSH_TIMEOUT_MS	30000
+
+static int mmc_flush_cache(struct mmc *mmc)
+{
+	struct mmc_cmd cmd;
+	int err;
+
+	/* R1 rather than R1b: the host would give up on the busy too early */
+	cmd.cmdidx = MMC_CMD_SWITCH;
+	cmd.resp_type = MMC_RSP_R1;
+	cmd.cmdarg = (MMC_SWITCH_MODE_WRITE_BYTE << 24) |
+		     (EXT_CSD_FLUSH_CACHE << 16) | (1 << 8);
+
+	err = mmc_send_cmd(mmc, &cmd, NULL);
+	if (!err)
+		err = mmc_poll_for_busy(mmc, MMC_CACHE_FLUSH_TIMEOUT_MS);
+
+	return err;
+}
+
+int mmc_write_cache(struct mmc *mmc, bool enable)
+{
+	int err;
+
+	if (!mmc || IS_SD(mmc) || !mmc->cache_size)
+		return 0;
+
+	if (enable) {
+		if (mmc->cache_users++)
+			return 0;
+		err = mmc_switch(mmc, EXT_CSD_CMD_SET_NORMAL,
+				 EXT_CSD_CACHE_CTRL, 1);
+		if (err)
+			mmc->cache_users = 0;
+		return err;
+	}
+
+	if (!mmc->cache_users || --mmc->cache_users)
+		return 0;
+
+	/* turning the cache off flushes it too, but hides a failure */
+	err = mmc_flush_cache(mmc);
+	if (err)
+		printf("mmc cache flush failed\n");
+	if (mmc_switch(mmc, EXT_CSD_CMD_SET_NORMAL, EXT_CSD_CACHE_CTRL, 0))
+		err = -EIO;
+
+	return err;
+}
+
+#if CONFIG_IS_ENABLED(BLK)
+int mmc_bwrite_cache(struct udevice *dev, bool enable)
+{
+	struct blk_desc *block_dev = dev_get_uclass_platdata(dev);
+
+	return mmc_write_cache(find_mmc_device(block_dev->devnum), enable);
+}
+#endif
+#endif
@@ -14,6 +14,7 @@
 #include <malloc.h>
 #include <mmc.h>
 #include <sdhci.h>
+#include <linux/sizes.h>
 #include <dm.h>
 
 #if defined(CONFIG_FIXED_SDHCI_ALIGNED_BUFFER)
@@ -101,33 +102,71 @@ static void sdhci_prepare_adma_table(struct sdhci_host *host,
 				     struct mmc_data *data)
 {
 	uint trans_bytes = data->blocksize * data->blocks;
-	uint desc_count = DIV_ROUND_UP(trans_bytes, ADMA_MAX_LEN);
-	int i = desc_count;
+	enum dma_data_direction dir;
+	uint len;
 	char *buf;
 
 	host->desc_slot = 0;
 
-	if (data->flags & MMC_DATA_READ)
+	if (data->flags & MMC_DATA_READ) {
 		buf = data->dest;
-	else
+		dir = DMA_FROM_DEVICE;
+	} else {
 		buf = (char *)data->src;
+		dir = DMA_TO_DEVICE;
+	}
 
-	while (--i) {
-		sdhci_adma_desc(host, buf, ADMA_MAX_LEN, false);
-		buf += ADMA_MAX_LEN;
-		trans_bytes -= ADMA_MAX_LEN;
+	/*
+	 * Only the bytes up to the first aligned address go through the
+	 * alignment buffer, the rest of the transfer uses the caller's buffer
+	 * directly.
+	 */
+	host->align_len = -(ulong)buf & (ADMA_ALIGN - 1);
+	if (host->align_len) {
+		if (dir == DMA_TO_DEVICE)
+			memcpy(host->align_buffer, buf, host->align_len);
+		dma_sync_range_for_device((ulong)host->align_buffer,
+					  ARCH_DMA_MINALIGN, dir);
+		sdhci_adma_desc(host, host->align_buffer, host->align_len,
+				false);
+		buf += host->align_len;
+		trans_bytes -= host->align_len;
 	}
 
-	sdhci_adma_desc(host, buf, trans_bytes, true);
+	while (trans_bytes) {
+		len = min_t(uint, trans_bytes, ADMA_MAX_LEN);
+		if (host->quirks & SDHCI_QUIRK_ADMA_128M_BOUNDARY)
+			len = min_t(ulong, len,
+				    SZ_128M - ((ulong)buf & (SZ_128M - 1)));
+		trans_bytes -= len;
+		sdhci_adma_desc(host, buf, len, !trans_bytes);
+		buf += len;
+	}
+
+	dma_sync_range_for_device((dma_addr_t)host->adma_desc_table,
+				  (host->desc_slot + 1) *
+				  sizeof(struct sdhci_adma_desc),
+				  DMA_TO_DEVICE);
+}
+
+static void sdhci_adma_complete(struct sdhci_host *host,
+				struct mmc_data *data)
+{
+	if (!host->align_len || data->flags != MMC_DATA_READ)
+		return;
 
-	flush_cache((dma_addr_t)host->adma_desc_table,
-		    ROUND(desc_count * sizeof(struct sdhci_adma_desc),
-			  ARCH_DMA_MINALIGN));
+	dma_sync_range_for_cpu((ulong)host->align_buffer, ARCH_DMA_MINALIGN,
+			       DMA_FROM_DEVICE);
+	memcpy(data->dest, host->align_buffer, host->align_len);
 }
 #elif defined(CONFIG_MMC_SDHCI_SDMA)
 static void sdhci_prepare_adma_table(struct sdhci_host *host,
 				     struct mmc_data *data)
 {}
+
+static void sdhci_adma_complete(struct sdhci_host *host,
+				struct mmc_data *data)
+{}
 #endif
 #if (defined(CONFIG_MMC_SDHCI_SDMA) || CONFIG_IS_ENABLED(MMC_SDHCI_ADMA))
 static void sdhci_prepare_dma(struct sdhci_host *host, struct mmc_data *data,
@@ -177,19 +216,12 @@ static void sdhci_prepare_dma(struct sdhci_host *host, struct mmc_data *data,
 			sdhci_writel(host, (u64)host->adma_addr >> 32,
 				     SDHCI_ADMA_ADDRESS_HI);
 	}
-	if(data->flags == MMC_DATA_READ){
-		/*invalidate cache before start dma read. 
-		 invalidate_dcache_range () for different arch/cpu may implemented in 2 ways: 
-		 1) only invalidate range cover addr to end cache lines,
-		   this way may add flush_cache before invalid better when start addr not align to cache line
-		 2) clean & invalidate range cover addr to end cache lines
-		    this way is ok handled with not aligned addr
-		 */
-		invalidate_dcache_range(host->start_addr,host->start_addr+ROUND(trans_bytes, ARCH_DMA_MINALIGN));
-	}else{
-		flush_cache(host->start_addr, ROUND(trans_bytes, ARCH_DMA_MINALIGN));
-	}
-
+	if (data->flags == MMC_DATA_READ)
+		dma_sync_range_for_device(host->start_addr, trans_bytes,
+					  DMA_FROM_DEVICE);
+	else
+		dma_sync_range_for_device(host->start_addr, trans_bytes,
+					  DMA_TO_DEVICE);
 }
 #else
 static void sdhci_prepare_dma(struct sdhci_host *host, struct mmc_data *data,
@@ -246,13 +278,11 @@ static int sdhci_transfer_data(struct sdhci_host *host, struct mmc_data *data)
 			return -ETIMEDOUT;
 		}
 	} while (!(stat & SDHCI_INT_DATA_END));
-#ifdef CONFIG_TARGET_LIGHT_C910	
-	extern void invalid_dcache_range(unsigned long start, unsigned long end);
-	/*After read ,invalid dcache range again to avoid cache filled during read tranfer*/
-	if(data->flags == MMC_DATA_READ){
-		invalid_dcache_range(host->start_addr,host->start_addr+ROUND(data->blocks*data->blocksize, ARCH_DMA_MINALIGN));
-	}
-#endif
+	/* Drop lines speculatively fetched while the DMA was writing */
+	if ((host->flags & USE_DMA) && data->flags == MMC_DATA_READ)
+		dma_sync_range_for_cpu(host->start_addr,
+				       data->blocks * data->blocksize,
+				       DMA_FROM_DEVICE);
 	return 0;
 }
 
@@ -267,21 +297,48 @@ static int sdhci_transfer_data(struct sdhci_host *host, struct mmc_data *data)
 #define SDHCI_CMD_DEFAULT_TIMEOUT		100
 #define SDHCI_READ_STATUS_TIMEOUT		1000
 
-#ifdef CONFIG_DM_MMC
-static int sdhci_send_command(struct udevice *dev, struct mmc_cmd *cmd,
-			      struct mmc_data *data)
+static int sdhci_send_command_finish(struct sdhci_host *host,
+				     struct mmc_data *data, int ret,
+				     int is_aligned)
 {
-	struct mmc *mmc = mmc_get_mmc_dev(dev);
+	unsigned int stat;
 
-#else
-static int sdhci_send_command(struct mmc *mmc, struct mmc_cmd *cmd,
-			      struct mmc_data *data)
-{
+	if (host->quirks & SDHCI_QUIRK_WAIT_SEND_CMD)
+		udelay(1000);
+
+	stat = sdhci_readl(host, SDHCI_INT_STATUS);
+	sdhci_writel(host, SDHCI_INT_ALL_MASK, SDHCI_INT_STATUS);
+	if (!ret) {
+		if ((host->quirks & SDHCI_QUIRK_32BIT_DMA_ADDR) &&
+				!is_aligned && (data->flags == MMC_DATA_READ))
+			memcpy(data->dest, aligned_buffer,
+			       data->blocks * data->blocksize);
+#if (defined(CONFIG_MMC_SDHCI_SDMA) || CONFIG_IS_ENABLED(MMC_SDHCI_ADMA))
+		if (data && (host->flags & (USE_ADMA | USE_ADMA64)))
+			sdhci_adma_complete(host, data);
 #endif
+		return 0;
+	}
+
+	sdhci_reset(host, SDHCI_RESET_CMD);
+	sdhci_reset(host, SDHCI_RESET_DATA);
+	if (stat & SDHCI_INT_TIMEOUT)
+		return -ETIMEDOUT;
+	else
+		return -ECOMM;
+}
+
+/*
+ * Issue a command and wait for its response. A data transfer is still
+ * running on return. Returns 1 if the command completed without waiting
+ * (SDHCI_QUIRK_BROKEN_R1B).
+ */
+static int sdhci_send_command_start(struct mmc *mmc, struct mmc_cmd *cmd,
+				    struct mmc_data *data, int *is_aligned)
+{
 	struct sdhci_host *host = mmc->priv;
 	unsigned int stat = 0;
-	int ret = 0;
-	int trans_bytes = 0, is_aligned = 1;
+	int trans_bytes = 0;
 	u32 mask, flags, mode;
 	unsigned int time = 0;
 	int mmc_dev = mmc_get_blk_desc(mmc)->devnum;
@@ -355,7 +412,7 @@ static int sdhci_send_command(struct mmc *mmc, struct mmc_cmd *cmd,
 
 		if (host->flags & USE_DMA) {
 			mode |= SDHCI_TRNS_DMA;
-			sdhci_prepare_dma(host, data, &is_aligned, trans_bytes);
+			sdhci_prepare_dma(host, data, is_aligned, trans_bytes);
 		}
 
 		sdhci_writew(host, SDHCI_MAKE_BLKSZ(SDHCI_DEFAULT_BOUNDARY_ARG,
@@ -377,7 +434,7 @@ static int sdhci_send_command(struct mmc *mmc, struct mmc_cmd *cmd,
 
 		if (get_timer(start) >= SDHCI_READ_STATUS_TIMEOUT) {
 			if (host->quirks & SDHCI_QUIRK_BROKEN_R1B) {
-				return 0;
+				return 1;
 			} else {
 				printf("%s: Timeout for status update!\n",
 				       __func__);
@@ -389,33 +446,90 @@ static int sdhci_send_command(struct mmc *mmc, struct mmc_cmd *cmd,
 	if ((stat & (SDHCI_INT_ERROR | mask)) == mask) {
 		sdhci_cmd_done(host, cmd);
 		sdhci_writel(host, mask, SDHCI_INT_STATUS);
-	} else
-		ret = -1;
+		return 0;
+	}
 
-	if (!ret && data)
+	return sdhci_send_command_finish(host, data, -1, *is_aligned);
+}
+
+#if CONFIG_IS_ENABLED(DM_MMC)
+static int sdhci_send_command(struct udevice *dev, struct mmc_cmd *cmd,
+			      struct mmc_data *data)
+{
+	struct mmc *mmc = mmc_get_mmc_dev(dev);
+
+#else
+static int sdhci_send_command(struct mmc *mmc, struct mmc_cmd *cmd,
+			      struct mmc_data *data)
+{
+#endif
+	struct sdhci_host *host = mmc->priv;
+	int is_aligned = 1;
+	int ret;
+
+	ret = sdhci_send_command_start(mmc, cmd, data, &is_aligned);
+	if (ret)
+		return ret > 0 ? 0 : ret;
+	if (data)
 		ret = sdhci_transfer_data(host, data);
 
-	if (host->quirks & SDHCI_QUIRK_WAIT_SEND_CMD)
-		udelay(1000);
+	return sdhci_send_command_finish(host, data, ret, is_aligned);
+}
 
-	stat = sdhci_readl(host, SDHCI_INT_STATUS);
-	sdhci_writel(host, SDHCI_INT_ALL_MASK, SDHCI_INT_STATUS);
-	if (!ret) {
-		if ((host->quirks & SDHCI_QUIRK_32BIT_DMA_ADDR) &&
-				!is_aligned && (data->flags == MMC_DATA_READ))
-			memcpy(data->dest, aligned_buffer, trans_bytes);
+#if CONFIG_IS_ENABLED(BLK_ASYNC) && CONFIG_IS_ENABLED(DM_MMC)
+/* Same limit as sdhci_transfer_data() */
+#define SDHCI_ASYNC_TIMEOUT			10000
+
+static int sdhci_send_command_submit(struct udevice *dev,
+				     struct mmc_cmd *cmd,
+				     struct mmc_data *data)
+{
+	struct mmc *mmc = mmc_get_mmc_dev(dev);
+	struct sdhci_host *host = mmc->priv;
+	int is_aligned = 1;
+	int ret;
+
+	/* only ADMA moves the data without the CPU */
+	if (!data || !(host->flags & (USE_ADMA | USE_ADMA64)))
+		return -ENOSYS;
+	if (!cmd)
 		return 0;
+
+	ret = sdhci_send_command_start(mmc, cmd, data, &is_aligned);
+	if (ret)
+		return ret > 0 ? -EIO : ret;
+	host->async_start = get_timer(0);
+
+	return 0;
+}
+
+static int sdhci_send_command_poll(struct udevice *dev, struct mmc_data *data)
+{
+	struct mmc *mmc = mmc_get_mmc_dev(dev);
+	struct sdhci_host *host = mmc->priv;
+	unsigned int stat;
+	int ret = 0;
+
+	stat = sdhci_readl(host, SDHCI_INT_STATUS);
+	if (stat & SDHCI_INT_ERROR) {
+		pr_err("%s: Error detected in status(0x%X)!\n", __func__, stat);
+		ret = -EIO;
+	} else if (!(stat & SDHCI_INT_DATA_END)) {
+		if (get_timer(host->async_start) < SDHCI_ASYNC_TIMEOUT)
+			return -EBUSY;
+		printf("%s: Transfer data timeout\n", __func__);
+		ret = -ETIMEDOUT;
+	} else if (data->flags == MMC_DATA_READ) {
+		dma_sync_range_for_cpu(host->start_addr,
+				       data->blocks * data->blocksize,
+				       DMA_FROM_DEVICE);
 	}
 
-	sdhci_reset(host, SDHCI_RESET_CMD);
-	sdhci_reset(host, SDHCI_RESET_DATA);
-	if (stat & SDHCI_INT_TIMEOUT)
-		return -ETIMEDOUT;
-	else
-		return -ECOMM;
+	return sdhci_send_command_finish(host, data, ret, 1);
 }
+#endif
 
-#if defined(CONFIG_DM_MMC) && defined(MMC_SUPPORTS_TUNING)
+#if CONFIG_IS_ENABLED(DM_MMC) && defined(MMC_SUPPORTS_TUNING)
 static int sdhci_execute_tuning(struct udevice *dev, uint opcode)
 {
 	int err;
@@ -616,7 +730,7 @@ void sdhci_set_timing(struct mmc *mmc)
 	sdhci_writew(host, reg, SDHCI_HOST_CONTROL2);
 }
 
-#ifdef CONFIG_DM_MMC
+#if CONFIG_IS_ENABLED(DM_MMC)
 static int sdhci_set_ios(struct udevice *dev)
 {
 	struct mmc *mmc = mmc_get_mmc_dev(dev);
@@ -706,7 +820,7 @@ static int sdhci_init(struct mmc *mmc)
 	return 0;
 }
 
-#ifdef CONFIG_DM_MMC
+#if CONFIG_IS_ENABLED(DM_MMC)
 int sdhci_probe(struct udevice *dev)
 {
 	struct mmc *mmc = mmc_get_mmc_dev(dev);
@@ -746,6 +860,10 @@ static int sdhci_get_cd(struct udevice *dev)
 
 const struct dm_mmc_ops sdhci_ops = {
 	.send_cmd	= sdhci_send_command,
+#if CONFIG_IS_ENABLED(BLK_ASYNC)
+	.send_cmd_submit = sdhci_send_command_submit,
+	.send_cmd_poll	= sdhci_send_command_poll,
+#endif
 	.set_ios	= sdhci_set_ios,
 	.get_cd		= sdhci_get_cd,
 #ifdef MMC_SUPPORTS_TUNING
@@ -790,12 +908,15 @@ int sdhci_setup_cfg(struct mmc_config *cfg, struct sdhci_host *host,
 #endif
 #if CONFIG_IS_ENABLED(MMC_SDHCI_ADMA)
 	if (!(caps & SDHCI_CAN_DO_ADMA2)) {
-		printf("%s: Your controller doesn't support SDMA!!\n",
+		printf("%s: Your controller doesn't support ADMA2!!\n",
 		       __func__);
 		return -EINVAL;
 	}
 	host->adma_desc_table = (struct sdhci_adma_desc *)
 				memalign(ARCH_DMA_MINALIGN, ADMA_TABLE_SZ);
+	host->align_buffer = memalign(ARCH_DMA_MINALIGN, ARCH_DMA_MINALIGN);
+	if (!host->adma_desc_table || !host->align_buffer)
+		return -ENOMEM;
 
 	host->adma_addr = (dma_addr_t)host->adma_desc_table;
 #ifdef CONFIG_DMA_ADDR_T_64BIT
@@ -811,7 +932,7 @@ int sdhci_setup_cfg(struct mmc_config *cfg, struct sdhci_host *host,
 		host->version = sdhci_readw(host, SDHCI_HOST_VERSION);
 
 	cfg->name = host->name;
-#ifndef CONFIG_DM_MMC
+#if !CONFIG_IS_ENABLED(DM_MMC)
 	cfg->ops = &sdhci_ops;
 #endif
 
@@ -912,7 +1033,7 @@ int sdhci_setup_cfg(struct mmc_config *cfg, struct sdhci_host *host,
 	return 0;
 }
 
-#ifdef CONFIG_BLK
+#if CONFIG_IS_ENABLED(BLK)
 int sdhci_bind(struct udevice *dev, struct mmc *mmc, struct mmc_config *cfg)
 {
 	return mmc_bind(dev, mmc, cfg);
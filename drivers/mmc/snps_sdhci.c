@@ -14,6 +14,20 @@
 
 volatile int DELAY_LANE = 50;
 
+#if !CONFIG_IS_ENABLED(DM_MMC)
+/* without driver model only the boot eMMC is set up, see snps_sdhci_add() */
+static struct snps_sdhci_plat snps_sdhci_plat;
+#endif
+
+static struct snps_sdhci_plat *snps_sdhci_get_plat(struct sdhci_host *host)
+{
+#if CONFIG_IS_ENABLED(DM_MMC)
+	return dev_get_platdata(host->mmc->dev);
+#else
+	return &snps_sdhci_plat;
+#endif
+}
+
 static void sdhci_phy_1_8v_init_no_pull(struct sdhci_host *host)
 {
     uint32_t val;
@@ -74,7 +88,7 @@ static void sdhci_phy_3_3v_init_no_pull(struct sdhci_host *host)
 static void sdhci_phy_1_8v_init(struct sdhci_host *host)
 {
     uint32_t val;
-	struct snps_sdhci_plat *plat = dev_get_platdata(host->mmc->dev);
+	struct snps_sdhci_plat *plat = snps_sdhci_get_plat(host);
     if(plat->pull_up_en == false) {
         sdhci_phy_1_8v_init_no_pull(host);
         return;
@@ -116,7 +130,7 @@ static void sdhci_phy_1_8v_init(struct sdhci_host *host)
 static void sdhci_phy_3_3v_init(struct sdhci_host *host)
 {
     uint32_t val;
-	struct snps_sdhci_plat *plat = dev_get_platdata(host->mmc->dev);
+	struct snps_sdhci_plat *plat = snps_sdhci_get_plat(host);
     if(plat->pull_up_en == false) {
         sdhci_phy_3_3v_init_no_pull(host);
         return;
@@ -208,7 +222,7 @@ void snps_set_uhs_timing(struct sdhci_host *host)
 static void snps_sdhci_set_control_reg(struct sdhci_host *host)
 {
 	struct mmc *mmc = (struct mmc *)host->mmc;
-	struct snps_sdhci_plat *plat = dev_get_platdata(host->mmc->dev);
+	struct snps_sdhci_plat *plat = snps_sdhci_get_plat(host);
 	u32 reg;
 
     reg = sdhci_readw(host, EMMC_CTRL_R);
@@ -241,7 +255,7 @@ extern int mmc_send_cmd(struct mmc *mmc, struct mmc_cmd *cmd, struct mmc_data *d
 static int snps_execute_tuning(struct mmc *mmc, u8 opcode)
 {
 #define SDHCI_TUNING_LOOP_COUNT 128
-	struct sdhci_host *host = dev_get_priv(mmc->dev);
+	struct sdhci_host *host = mmc->priv;
     struct mmc_cmd cmd;
     struct mmc_data data;
     char tuning_loop_counter = SDHCI_TUNING_LOOP_COUNT;
@@ -321,6 +335,26 @@ const struct sdhci_ops snps_ops = {
 	.set_control_reg = &snps_sdhci_set_control_reg,
 };
 
+/* Program the signalling voltage and the PHY pads for it */
+static void snps_sdhci_phy_setup(struct sdhci_host *host,
+				 struct snps_sdhci_plat *plat)
+{
+	uint16_t val = sdhci_readw(host, SDHCI_HOST_CONTROL2);
+
+	if (host->voltages == MMC_VDD_165_195) {
+		val |= SDHCI_CTRL_VDD_180;
+		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
+		sdhci_phy_1_8v_init(host);
+	} else {
+		val &= ~SDHCI_CTRL_VDD_180;
+		if (plat->io_fixed_1v8)
+			val |= SDHCI_CTRL_VDD_180;
+		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
+		sdhci_phy_3_3v_init(host);
+	}
+}
+
+#if CONFIG_IS_ENABLED(DM_MMC)
 static int snps_sdhci_probe(struct udevice *dev)
 {
 	struct mmc_uclass_priv *upriv = dev_get_uclass_priv(dev);
@@ -351,6 +385,8 @@ static int snps_sdhci_probe(struct udevice *dev)
 	host->mmc->priv = host;
 	upriv->mmc = host->mmc;
 	host->ops = &snps_ops;
+	host->quirks |= SDHCI_QUIRK_ADMA_128M_BOUNDARY;
+	host->host_caps |= MMC_CAP_CMD23;
 
  	ret = mmc_of_parse(dev, &plat->cfg);
 	if (ret)
@@ -370,19 +406,7 @@ static int snps_sdhci_probe(struct udevice *dev)
 	if (dev_read_bool(dev, "io_fixed_1v8"))
 		plat->io_fixed_1v8 = true;
 
-	uint16_t val = sdhci_readw(host, SDHCI_HOST_CONTROL2);
-
-	if (host->voltages == MMC_VDD_165_195) {
-		val |= SDHCI_CTRL_VDD_180;
-		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
-		sdhci_phy_1_8v_init(host);
-	} else {
-		val &= ~SDHCI_CTRL_VDD_180;
-		if (plat->io_fixed_1v8)
-			val |= SDHCI_CTRL_VDD_180;
-		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
-		sdhci_phy_3_3v_init(host);
-	}
+	snps_sdhci_phy_setup(host, plat);
 
 	host->voltages = MMC_VDD_32_33 | MMC_VDD_33_34 | MMC_VDD_165_195;
 
@@ -397,26 +421,14 @@ err:
 int snps_sdhci_init(struct mmc *mmc)
 {
 	struct sdhci_host *host = dev_get_priv(mmc->dev);
-	struct snps_sdhci_plat *plat = dev_get_platdata(host->mmc->dev);
+	struct snps_sdhci_plat *plat = snps_sdhci_get_plat(host);
 	int ret;
 	host->voltages = MMC_VDD_33_34;
 	ret = sdhci_probe(mmc->dev);
 	if (ret)
 		return -1;
 
-	uint16_t val = sdhci_readw(host, SDHCI_HOST_CONTROL2);
-
-	if (host->voltages == MMC_VDD_165_195) {
-		val |= SDHCI_CTRL_VDD_180;
-		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
-		sdhci_phy_1_8v_init(host);
-	} else {
-		val &= ~SDHCI_CTRL_VDD_180;
-		if (plat->io_fixed_1v8)
-			val |= SDHCI_CTRL_VDD_180;
-		sdhci_writew(host, val, SDHCI_HOST_CONTROL2);
-		sdhci_phy_3_3v_init(host);
-	}
+	snps_sdhci_phy_setup(host, plat);
 
 	return 0;
 }
@@ -443,3 +455,45 @@ U_BOOT_DRIVER(snps_sdhci_drv) = {
 	.priv_auto_alloc_size = sizeof(struct sdhci_host),
 	.platdata_auto_alloc_size = sizeof(struct snps_sdhci_plat),
 };
+#else
+int snps_sdhci_init(struct mmc *mmc)
+{
+	struct sdhci_host *host = mmc->priv;
+	int ret;
+
+	host->voltages = MMC_VDD_33_34;
+	ret = mmc->cfg->ops->init(mmc);
+	if (ret)
+		return -1;
+
+	snps_sdhci_phy_setup(host, snps_sdhci_get_plat(host));
+
+	return 0;
+}
+
+int snps_sdhci_add(struct sdhci_host *host, bool pull_up, bool io_fixed_1v8)
+{
+	struct snps_sdhci_plat *plat = &snps_sdhci_plat;
+	int ret;
+
+	plat->pull_up_en = pull_up;
+	plat->io_fixed_1v8 = io_fixed_1v8;
+	host->ops = &snps_ops;
+	host->quirks |= SDHCI_QUIRK_ADMA_128M_BOUNDARY;
+	host->host_caps |= MMC_CAP_CMD23;
+
+	ret = add_sdhci(host, 0, 0);
+	if (ret)
+		return ret;
+
+	/*
+	 * What sdhci-caps-mask does for a 1.8 V only eMMC in the DT. The
+	 * PHY is set up by set_control_reg() once the core has reset the
+	 * controller.
+	 */
+	if (io_fixed_1v8)
+		host->cfg.voltages = MMC_VDD_165_195;
+
+	return 0;
+}
+#endif
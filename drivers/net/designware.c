@@ -139,6 +139,75 @@ static int dw_mdio_init(const char *name, void *priv)
 	return mdio_register(bus);
 }
 
+static void dw_free_rings(struct dw_eth_dev *priv)
+{
+	free(priv->tx_mac_descrtable);
+	free(priv->rx_mac_descrtable);
+	free(priv->txbuffs);
+	free(priv->rxbuffs);
+	priv->tx_mac_descrtable = NULL;
+	priv->rx_mac_descrtable = NULL;
+	priv->txbuffs = NULL;
+	priv->rxbuffs = NULL;
+}
+
+static bool dw_dma_reachable(void *buf, size_t size)
+{
+	return (phys_addr_t)buf + size <= (1ULL << 32);
+}
+
+static int dw_alloc_rings(struct dw_eth_dev *priv)
+{
+	size_t tx_descs = priv->tx_descr_num * sizeof(struct dmamacdescr);
+	size_t rx_descs = priv->rx_descr_num * sizeof(struct dmamacdescr);
+	size_t tx_bufs = priv->tx_descr_num * CONFIG_ETH_BUFSIZE;
+	size_t rx_bufs = priv->rx_descr_num * CONFIG_ETH_BUFSIZE;
+
+	if (priv->rx_mac_descrtable)
+		return 0;
+
+	priv->tx_mac_descrtable = memalign(ARCH_DMA_MINALIGN, tx_descs);
+	priv->rx_mac_descrtable = memalign(ARCH_DMA_MINALIGN, rx_descs);
+	priv->txbuffs = memalign(ARCH_DMA_MINALIGN, tx_bufs);
+	priv->rxbuffs = memalign(ARCH_DMA_MINALIGN, rx_bufs);
+	if (!priv->tx_mac_descrtable || !priv->rx_mac_descrtable ||
+	    !priv->txbuffs || !priv->rxbuffs) {
+		printf("designware: cannot allocate %u/%u descriptor rings\n",
+		       priv->tx_descr_num, priv->rx_descr_num);
+		dw_free_rings(priv);
+		return -ENOMEM;
+	}
+
+	if (!dw_dma_reachable(priv->tx_mac_descrtable, tx_descs) ||
+	    !dw_dma_reachable(priv->rx_mac_descrtable, rx_descs) ||
+	    !dw_dma_reachable(priv->txbuffs, tx_bufs) ||
+	    !dw_dma_reachable(priv->rxbuffs, rx_bufs)) {
+		printf("designware: buffers are outside DMA memory\n");
+		dw_free_rings(priv);
+		return -EINVAL;
+	}
+
+	memset(priv->tx_mac_descrtable, 0, tx_descs);
+	memset(priv->rx_mac_descrtable, 0, rx_descs);
+	memset(priv->rxbuffs, 0, rx_bufs);
+
+	return 0;
+}
+
+/* Flush @count descriptors of a ring from @first on, wrapping at @num */
+static void dw_flush_descs(struct dmamacdescr *table, u32 num, u32 first,
+			   u32 count)
+{
+	u32 tail = min(count, num - first);
+
+	dma_sync_range_for_device((ulong)&table[first],
+				  tail * sizeof(*table), DMA_TO_DEVICE);
+	if (count > tail)
+		dma_sync_range_for_device((ulong)&table[0],
+					  (count - tail) * sizeof(*table),
+					  DMA_TO_DEVICE);
+}
+
 static void tx_descs_init(struct dw_eth_dev *priv)
 {
 	struct eth_dma_regs *dma_p = priv->dma_regs_p;
@@ -147,7 +216,7 @@ static void tx_descs_init(struct dw_eth_dev *priv)
 	struct dmamacdescr *desc_p;
 	u32 idx;
 
-	for (idx = 0; idx < CONFIG_TX_DESCR_NUM; idx++) {
+	for (idx = 0; idx < priv->tx_descr_num; idx++) {
 		desc_p = &desc_table_p[idx];
 		desc_p->dmamac_addr = (ulong)&txbuffs[idx * CONFIG_ETH_BUFSIZE];
 		desc_p->dmamac_next = (ulong)&desc_table_p[idx + 1];
@@ -171,12 +240,14 @@ static void tx_descs_init(struct dw_eth_dev *priv)
 	desc_p->dmamac_next = (ulong)&desc_table_p[0];
 
 	/* Flush all Tx buffer descriptors at once */
-	flush_dcache_range((ulong)priv->tx_mac_descrtable,
-			   (ulong)priv->tx_mac_descrtable +
-			   sizeof(priv->tx_mac_descrtable));
+	dma_sync_range_for_device((ulong)priv->tx_mac_descrtable,
+				  priv->tx_descr_num * sizeof(*desc_p),
+				  DMA_TO_DEVICE);
 
 	writel((ulong)&desc_table_p[0], &dma_p->txdesclistaddr);
 	priv->tx_currdescnum = 0;
+	priv->tx_dirtydescnum = 0;
+	priv->tx_free = priv->tx_descr_num;
 }
 
 static void rx_descs_init(struct dw_eth_dev *priv)
@@ -193,9 +264,11 @@ static void rx_descs_init(struct dw_eth_dev *priv)
 	 * Otherwise there's a chance to get some of them flushed in RAM when
 	 * GMAC is already pushing data to RAM via DMA. This way incoming from
 	 * GMAC data will be corrupted. */
-	flush_dcache_range((ulong)rxbuffs, (ulong)rxbuffs + RX_TOTAL_BUFSIZE);
+	dma_sync_range_for_device((ulong)rxbuffs,
+				  priv->rx_descr_num * CONFIG_ETH_BUFSIZE,
+				  DMA_FROM_DEVICE);
 
-	for (idx = 0; idx < CONFIG_RX_DESCR_NUM; idx++) {
+	for (idx = 0; idx < priv->rx_descr_num; idx++) {
 		desc_p = &desc_table_p[idx];
 		desc_p->dmamac_addr = (ulong)&rxbuffs[idx * CONFIG_ETH_BUFSIZE];
 		desc_p->dmamac_next = (ulong)&desc_table_p[idx + 1];
@@ -211,12 +284,14 @@ static void rx_descs_init(struct dw_eth_dev *priv)
 	desc_p->dmamac_next = (ulong)&desc_table_p[0];
 
 	/* Flush all Rx buffer descriptors at once */
-	flush_dcache_range((ulong)priv->rx_mac_descrtable,
-			   (ulong)priv->rx_mac_descrtable +
-			   sizeof(priv->rx_mac_descrtable));
+	dma_sync_range_for_device((ulong)priv->rx_mac_descrtable,
+				  priv->rx_descr_num * sizeof(*desc_p),
+				  DMA_TO_DEVICE);
 
 	writel((ulong)&desc_table_p[0], &dma_p->rxdesclistaddr);
 	priv->rx_currdescnum = 0;
+	priv->rx_ready = 0;
+	priv->rx_refill = 0;
 }
 
 static int _dw_write_hwaddr(struct dw_eth_dev *priv, u8 *mac_id)
@@ -333,6 +408,10 @@ int designware_eth_init(struct dw_eth_dev *priv, u8 *enetaddr)
 	 */
 	_dw_write_hwaddr(priv, enetaddr);
 
+	ret = dw_alloc_rings(priv);
+	if (ret)
+		return ret;
+
 	rx_descs_init(priv);
 	tx_descs_init(priv);
 
@@ -381,30 +460,54 @@ int designware_eth_enable(struct dw_eth_dev *priv)
 
 #define ETH_ZLEN	60
 
+/*
+ * Take back the descriptors the DMA has finished with, oldest first. This
+ * never waits: it stops at the first descriptor still owned by the DMA.
+ */
+static void dw_tx_reclaim(struct dw_eth_dev *priv)
+{
+	u32 desc_num = priv->tx_dirtydescnum;
+	struct dmamacdescr *desc_p;
+
+	while (priv->tx_free < priv->tx_descr_num) {
+		desc_p = &priv->tx_mac_descrtable[desc_num];
+		/*
+		 * Strictly we only need to invalidate the "txrx_status" field,
+		 * but on some platforms we cannot invalidate only 4 bytes.
+		 * This is safe because the individual descriptors are each
+		 * aligned to ARCH_DMA_MINALIGN and padded appropriately.
+		 */
+		dma_sync_range_for_cpu((ulong)desc_p, sizeof(*desc_p),
+				       DMA_FROM_DEVICE);
+		if (desc_p->txrx_status & DESC_TXSTS_OWNBYDMA)
+			break;
+
+		if (++desc_num >= priv->tx_descr_num)
+			desc_num = 0;
+		priv->tx_free++;
+	}
+
+	priv->tx_dirtydescnum = desc_num;
+}
+
 static int _dw_eth_send(struct dw_eth_dev *priv, void *packet, int length)
 {
 	struct eth_dma_regs *dma_p = priv->dma_regs_p;
 	u32 desc_num = priv->tx_currdescnum;
 	struct dmamacdescr *desc_p = &priv->tx_mac_descrtable[desc_num];
 	ulong desc_start = (ulong)desc_p;
-	ulong desc_end = desc_start +
-		roundup(sizeof(*desc_p), ARCH_DMA_MINALIGN);
 	ulong data_start = desc_p->dmamac_addr;
-	ulong data_end = data_start + roundup(length, ARCH_DMA_MINALIGN);
+
 	/*
-	 * Strictly we only need to invalidate the "txrx_status" field
-	 * for the following check, but on some platforms we cannot
-	 * invalidate only 4 bytes, so we flush the entire descriptor,
-	 * which is 16 bytes in total. This is safe because the
-	 * individual descriptors in the array are each aligned to
-	 * ARCH_DMA_MINALIGN and padded appropriately.
+	 * Completed descriptors are only reclaimed once the ring runs dry, so
+	 * most frames go out without touching the descriptor cache lines.
 	 */
-	invalidate_dcache_range(desc_start, desc_end);
-
-	/* Check if the descriptor is owned by CPU */
-	if (desc_p->txrx_status & DESC_TXSTS_OWNBYDMA) {
-		printf("CPU not owner of tx frame\n");
-		return -EPERM;
+	if (!priv->tx_free) {
+		dw_tx_reclaim(priv);
+		if (!priv->tx_free) {
+			debug("%s: Tx ring full\n", __func__);
+			return -EAGAIN;
+		}
 	}
 
 	memcpy((void *)data_start, packet, length);
@@ -414,7 +517,7 @@ static int _dw_eth_send(struct dw_eth_dev *priv, void *packet, int length)
 	}
 
 	/* Flush data to be sent */
-	flush_dcache_range(data_start, data_end);
+	dma_sync_range_for_device(data_start, length, DMA_TO_DEVICE);
 
 #if defined(CONFIG_DW_ALTDESCRIPTOR)
 	desc_p->txrx_status |= DESC_TXSTS_TXFIRST | DESC_TXSTS_TXLAST;
@@ -434,13 +537,14 @@ static int _dw_eth_send(struct dw_eth_dev *priv, void *packet, int length)
 #endif
 
 	/* Flush modified buffer descriptor */
-	flush_dcache_range(desc_start, desc_end);
+	dma_sync_range_for_device(desc_start, sizeof(*desc_p), DMA_TO_DEVICE);
 
 	/* Test the wrap-around condition. */
-	if (++desc_num >= CONFIG_TX_DESCR_NUM)
+	if (++desc_num >= priv->tx_descr_num)
 		desc_num = 0;
 
 	priv->tx_currdescnum = desc_num;
+	priv->tx_free--;
 
 	/* Start the transmission */
 	writel(POLL_DATA, &dma_p->txpolldemand);
@@ -448,34 +552,70 @@ static int _dw_eth_send(struct dw_eth_dev *priv, void *packet, int length)
 	return 0;
 }
 
-static int _dw_eth_recv(struct dw_eth_dev *priv, uchar **packetp)
+/* Hand the descriptors freed since the last refill back to the DMA */
+static void dw_rx_refill(struct dw_eth_dev *priv)
 {
-	u32 status, desc_num = priv->rx_currdescnum;
-	struct dmamacdescr *desc_p = &priv->rx_mac_descrtable[desc_num];
-	int length = -EAGAIN;
-	ulong desc_start = (ulong)desc_p;
-	ulong desc_end = desc_start +
-		roundup(sizeof(*desc_p), ARCH_DMA_MINALIGN);
-	ulong data_start = desc_p->dmamac_addr;
-	ulong data_end;
+	u32 num = priv->rx_descr_num;
+	u32 count = priv->rx_refill;
 
-	/* Invalidate entire buffer descriptor */
-	invalidate_dcache_range(desc_start, desc_end);
+	if (!count)
+		return;
 
-	status = desc_p->txrx_status;
+	dw_flush_descs(priv->rx_mac_descrtable, num,
+		       (priv->rx_currdescnum + num - count) % num, count);
+	priv->rx_refill = 0;
 
-	/* Check  if the owner is the CPU */
-	if (!(status & DESC_RXSTS_OWNBYDMA)) {
+	/* Resume the DMA in case it ran out of descriptors */
+	writel(POLL_DATA, &priv->dma_regs_p->rxpolldemand);
+}
 
-		length = (status & DESC_RXSTS_FRMLENMSK) >>
-			 DESC_RXSTS_FRMLENSHFT;
+/*
+ * Invalidate a burst of descriptors at once and count how many frames are
+ * complete, so that they can be handed up without touching the descriptor
+ * cache lines again. Freed descriptors must have been flushed first as the
+ * invalidation would otherwise drop their ownership update.
+ */
+static void dw_rx_scan(struct dw_eth_dev *priv)
+{
+	u32 first = priv->rx_currdescnum;
+	u32 count = min_t(u32, DW_RX_BURST, priv->rx_descr_num - first);
+	struct dmamacdescr *desc_p = &priv->rx_mac_descrtable[first];
+	u32 ready;
+
+	dma_sync_range_for_cpu((ulong)desc_p, count * sizeof(*desc_p),
+			       DMA_FROM_DEVICE);
+
+	for (ready = 0; ready < count; ready++, desc_p++)
+		if (desc_p->txrx_status & DESC_RXSTS_OWNBYDMA)
+			break;
 
-		/* Invalidate received data */
-		data_end = data_start + roundup(length, ARCH_DMA_MINALIGN);
-		invalidate_dcache_range(data_start, data_end);
-		*packetp = (uchar *)(ulong)desc_p->dmamac_addr;
+	priv->rx_ready = ready;
+}
+
+static int _dw_eth_recv(struct dw_eth_dev *priv, uchar **packetp)
+{
+	struct dmamacdescr *desc_p;
+	ulong data_start;
+	u32 status;
+	int length;
+
+	if (!priv->rx_ready) {
+		dw_rx_refill(priv);
+		dw_rx_scan(priv);
+		if (!priv->rx_ready)
+			return -EAGAIN;
 	}
 
+	desc_p = &priv->rx_mac_descrtable[priv->rx_currdescnum];
+	data_start = desc_p->dmamac_addr;
+	status = desc_p->txrx_status;
+
+	length = (status & DESC_RXSTS_FRMLENMSK) >> DESC_RXSTS_FRMLENSHFT;
+
+	/* Invalidate received data */
+	dma_sync_range_for_cpu(data_start, length, DMA_FROM_DEVICE);
+	*packetp = (uchar *)data_start;
+
 	return length;
 }
 
@@ -483,24 +623,24 @@ static int _dw_free_pkt(struct dw_eth_dev *priv)
 {
 	u32 desc_num = priv->rx_currdescnum;
 	struct dmamacdescr *desc_p = &priv->rx_mac_descrtable[desc_num];
-	ulong desc_start = (ulong)desc_p;
-	ulong desc_end = desc_start +
-		roundup(sizeof(*desc_p), ARCH_DMA_MINALIGN);
 
 	/*
-	 * Make the current descriptor valid again and go to
-	 * the next one
+	 * Make the current descriptor valid again and go to the next one.
+	 * The flush is deferred so that a whole burst is given back at once.
 	 */
 	desc_p->txrx_status |= DESC_RXSTS_OWNBYDMA;
-
-	/* Flush only status field - others weren't changed */
-	flush_dcache_range(desc_start, desc_end);
+	priv->rx_ready--;
+	priv->rx_refill++;
 
 	/* Test the wrap-around condition. */
-	if (++desc_num >= CONFIG_RX_DESCR_NUM)
+	if (++desc_num >= priv->rx_descr_num)
 		desc_num = 0;
 	priv->rx_currdescnum = desc_num;
 
+	/* Do not let the DMA starve while a long burst is handed up */
+	if (!priv->rx_ready || priv->rx_refill >= priv->rx_descr_num / 4)
+		dw_rx_refill(priv);
+
 	return 0;
 }
 
@@ -550,15 +690,20 @@ static int dw_eth_send(struct eth_device *dev, void *packet, int length)
 
 static int dw_eth_recv(struct eth_device *dev)
 {
+	struct dw_eth_dev *priv = dev->priv;
 	uchar *packet;
 	int length;
+	u32 i;
 
-	length = _dw_eth_recv(dev->priv, &packet);
-	if (length == -EAGAIN)
-		return 0;
-	net_process_received_packet(packet, length);
+	/* Drain everything that arrived since the last poll */
+	for (i = 0; i < priv->rx_descr_num; i++) {
+		length = _dw_eth_recv(priv, &packet);
+		if (length == -EAGAIN)
+			break;
+		net_process_received_packet(packet, length);
 
-	_dw_free_pkt(dev->priv);
+		_dw_free_pkt(priv);
+	}
 
 	return 0;
 }
@@ -606,6 +751,8 @@ int designware_initialize(ulong base_addr, u32 interface)
 	dev->priv = priv;
 
 	priv->dev = dev;
+	priv->tx_descr_num = CONFIG_ETH_DESIGNWARE_TX_DESCR_NUM;
+	priv->rx_descr_num = CONFIG_ETH_DESIGNWARE_RX_DESCR_NUM;
 	priv->mac_regs_p = (struct eth_mac_regs *)base_addr;
 	priv->dma_regs_p = (struct eth_dma_regs *)(base_addr +
 			DW_DMA_BASE_OFFSET);
@@ -716,7 +863,8 @@ static int designware_eth_bind(struct udevice *dev)
 
 int designware_eth_probe(struct udevice *dev)
 {
-	struct eth_pdata *pdata = dev_get_platdata(dev);
+	struct dw_eth_pdata *dw_pdata = dev_get_platdata(dev);
+	struct eth_pdata *pdata = &dw_pdata->eth_pdata;
 	struct dw_eth_dev *priv = dev_get_priv(dev);
 	phys_addr_t iobase = pdata->iobase;
 	phys_addr_t ioaddr;
@@ -795,6 +943,10 @@ int designware_eth_probe(struct udevice *dev)
 	priv->dma_regs_p = (struct eth_dma_regs *)(ioaddr + DW_DMA_BASE_OFFSET);
 	priv->interface = pdata->phy_interface;
 	priv->max_speed = pdata->max_speed;
+	priv->tx_descr_num = dw_pdata->tx_descr_num ?:
+			     CONFIG_ETH_DESIGNWARE_TX_DESCR_NUM;
+	priv->rx_descr_num = dw_pdata->rx_descr_num ?:
+			     CONFIG_ETH_DESIGNWARE_RX_DESCR_NUM;
 
 	ret = dw_mdio_init(dev->name, dev);
 	if (ret) {
@@ -836,6 +988,7 @@ static int designware_eth_remove(struct udevice *dev)
 	free(priv->phydev);
 	mdio_unregister(priv->bus);
 	mdio_free(priv->bus);
+	dw_free_rings(priv);
 
 #ifdef CONFIG_CLK
 	return clk_release_all(priv->clocks, priv->clock_count);
@@ -878,6 +1031,14 @@ int designware_eth_ofdata_to_platdata(struct udevice *dev)
 	}
 
 	pdata->max_speed = dev_read_u32_default(dev, "max-speed", 0);
+	dw_pdata->tx_descr_num = dev_read_u32_default(dev, "snps,tx-desc-num",
+					CONFIG_ETH_DESIGNWARE_TX_DESCR_NUM);
+	dw_pdata->rx_descr_num = dev_read_u32_default(dev, "snps,rx-desc-num",
+					CONFIG_ETH_DESIGNWARE_RX_DESCR_NUM);
+	if (dw_pdata->tx_descr_num < 2 || dw_pdata->rx_descr_num < 2) {
+		debug("%s: Invalid descriptor ring size\n", __func__);
+		return -EINVAL;
+	}
 
 #ifdef CONFIG_DM_GPIO
 	if (dev_read_bool(dev, "snps,reset-active-low"))
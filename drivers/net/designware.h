@@ -11,11 +11,10 @@
 #include <asm-generic/gpio.h>
 #endif
 
-#define CONFIG_TX_DESCR_NUM	16
-#define CONFIG_RX_DESCR_NUM	16
 #define CONFIG_ETH_BUFSIZE	2048
-#define TX_TOTAL_BUFSIZE	(CONFIG_ETH_BUFSIZE * CONFIG_TX_DESCR_NUM)
-#define RX_TOTAL_BUFSIZE	(CONFIG_ETH_BUFSIZE * CONFIG_RX_DESCR_NUM)
+
+/* Rx descriptors are checked for completion this many at a time */
+#define DW_RX_BURST		32
 
 #define CONFIG_MACRESET_TIMEOUT	(3 * CONFIG_SYS_HZ)
 #define CONFIG_MDIO_TIMEOUT	(3 * CONFIG_SYS_HZ)
@@ -220,15 +219,22 @@ struct dmamacdescr {
 #endif
 
 struct dw_eth_dev {
-	struct dmamacdescr tx_mac_descrtable[CONFIG_TX_DESCR_NUM];
-	struct dmamacdescr rx_mac_descrtable[CONFIG_RX_DESCR_NUM];
-	char txbuffs[TX_TOTAL_BUFSIZE] __aligned(ARCH_DMA_MINALIGN);
-	char rxbuffs[RX_TOTAL_BUFSIZE] __aligned(ARCH_DMA_MINALIGN);
+	/* Rings are allocated on first start, sized per device */
+	struct dmamacdescr *tx_mac_descrtable;
+	struct dmamacdescr *rx_mac_descrtable;
+	char *txbuffs;
+	char *rxbuffs;
+	u32 tx_descr_num;
+	u32 rx_descr_num;
 
 	u32 interface;
 	u32 max_speed;
 	u32 tx_currdescnum;
+	u32 tx_dirtydescnum;	/* oldest descriptor not yet reclaimed */
+	u32 tx_free;		/* descriptors known to be owned by the CPU */
 	u32 rx_currdescnum;
+	u32 rx_ready;		/* completed frames from rx_currdescnum on */
+	u32 rx_refill;		/* freed descriptors not yet given back */
 
 	struct eth_mac_regs *mac_regs_p;
 	struct eth_dma_regs *dma_regs_p;
@@ -255,6 +261,8 @@ extern const struct eth_ops designware_eth_ops;
 struct dw_eth_pdata {
 	struct eth_pdata eth_pdata;
 	u32 reset_delays[3];
+	u32 tx_descr_num;
+	u32 rx_descr_num;
 };
 
 int designware_eth_init(struct dw_eth_dev *priv, u8 *enetaddr);
@@ -905,7 +905,8 @@ static void dwc3_ep0_xfer_complete(struct dwc3 *dwc,
 	dep->flags &= ~DWC3_EP_BUSY;
 	dep->resource_index = 0;
 	dwc->setup_packet_pending = false;
-	invalid_dcache_range(dwc->ctrl_req, (dmaaddr_t)dwc->ctrl_req + ROUND(sizeof(*dwc->ctrl_req), CACHELINE_SIZE));
+	dma_sync_range_for_cpu((uintptr_t)dwc->ctrl_req,
+			       sizeof(*dwc->ctrl_req), DMA_FROM_DEVICE);
 
 	switch (dwc->ep0state) {
 	case EP0_SETUP_PHASE:
@@ -50,7 +50,6 @@ static inline void dwc3_writel(void __iomem *base, u32 offset, u32 value)
 
 static inline void dwc3_flush_cache(uintptr_t addr, int length)
 {
-	flush_dcache_range(addr, addr + ROUND(length, CACHELINE_SIZE));
-	invalidate_dcache_range(addr, addr + ROUND(length, CACHELINE_SIZE));
+	dma_sync_range_for_device(addr, length, DMA_BIDIRECTIONAL);
 }
 #endif /* __DRIVERS_USB_DWC3_IO_H */
@@ -20,7 +20,9 @@
 #include <linux/usb/ch9.h>
 #include <linux/usb/gadget.h>
 #include <linux/usb/composite.h>
+#include <linux/bitops.h>
 #include <linux/compiler.h>
+#include <linux/sizes.h>
 #include <g_dnl.h>
 
 #define FASTBOOT_INTERFACE_CLASS	0xff
@@ -38,12 +40,28 @@
  * that expect bulk OUT requests to be divisible by maxpacket size.
  */
 
+/*
+ * During a download CONFIG_FASTBOOT_USB_DL_REQS requests of up to
+ * DL_BUFFER_SIZE are kept queued on the OUT endpoint. They point straight
+ * into the download buffer, so the controller DMAs the image into place
+ * and there is no copy. The command request is only used as a bounce
+ * buffer for data that does not fit in place.
+ */
+#define DL_BUFFER_SIZE			SZ_1M
+
 struct f_fastboot {
 	struct usb_function usb_function;
 
 	/* IN/OUT EP's and corresponding requests */
 	struct usb_ep *in_ep, *out_ep;
 	struct usb_request *in_req, *out_req;
+
+	/* download requests, their busy mask and what they cover */
+	struct usb_request *dl_req[CONFIG_FASTBOOT_USB_DL_REQS];
+	unsigned int dl_busy;
+	unsigned int dl_total;
+	unsigned int dl_offset;
+	unsigned int dl_pending;
 };
 
 static char fb_ext_prop_name[] = "DeviceInterfaceGUID";
@@ -193,6 +211,7 @@ static struct usb_gadget_strings *fastboot_strings[] = {
 };
 
 static void rx_handler_command(struct usb_ep *ep, struct usb_request *req);
+static void rx_handler_dl_image(struct usb_ep *ep, struct usb_request *req);
 
 static void fastboot_complete(struct usb_ep *ep, struct usb_request *req)
 {
@@ -277,10 +296,20 @@ static void fastboot_unbind(struct usb_configuration *c, struct usb_function *f)
 static void fastboot_disable(struct usb_function *f)
 {
 	struct f_fastboot *f_fb = func_to_fastboot(f);
+	int i;
 
 	usb_ep_disable(f_fb->out_ep);
 	usb_ep_disable(f_fb->in_ep);
 
+	for (i = 0; i < CONFIG_FASTBOOT_USB_DL_REQS; i++) {
+		if (f_fb->dl_req[i]) {
+			/* the buffer belongs to the download area */
+			usb_ep_free_request(f_fb->out_ep, f_fb->dl_req[i]);
+			f_fb->dl_req[i] = NULL;
+		}
+	}
+	f_fb->dl_busy = 0;
+
 	if (f_fb->out_req) {
 		free(f_fb->out_req->buf);
 		usb_ep_free_request(f_fb->out_ep, f_fb->out_req);
@@ -315,7 +344,7 @@ static struct usb_request *fastboot_start_ep(struct usb_ep *ep)
 static int fastboot_set_alt(struct usb_function *f,
 			    unsigned interface, unsigned alt)
 {
-	int ret;
+	int i, ret;
 	struct usb_composite_dev *cdev = f->config->cdev;
 	struct usb_gadget *gadget = cdev->gadget;
 	struct f_fastboot *f_fb = func_to_fastboot(f);
@@ -339,6 +368,16 @@ static int fastboot_set_alt(struct usb_function *f,
 	}
 	f_fb->out_req->complete = rx_handler_command;
 
+	for (i = 0; i < CONFIG_FASTBOOT_USB_DL_REQS; i++) {
+		f_fb->dl_req[i] = usb_ep_alloc_request(f_fb->out_ep, 0);
+		if (!f_fb->dl_req[i]) {
+			puts("failed to alloc download req\n");
+			ret = -EINVAL;
+			goto err;
+		}
+		f_fb->dl_req[i]->complete = rx_handler_dl_image;
+	}
+
 	d = fb_ep_desc(gadget, &fs_ep_in, &hs_ep_in, &ss_ep_in);
 	ret = usb_ep_enable(f_fb->in_ep, d);
 	if (ret) {
@@ -423,16 +462,14 @@ static void compl_do_reset(struct usb_ep *ep, struct usb_request *req)
 	do_reset(NULL, 0, 0, NULL);
 }
 
-static unsigned int rx_bytes_expected(struct usb_ep *ep)
+static unsigned int rx_bytes_expected(struct usb_ep *ep, unsigned int rx_remain,
+				      unsigned int max)
 {
-	int rx_remain = fastboot_data_remaining();
 	unsigned int rem;
 	unsigned int maxpacket = usb_endpoint_maxp(ep->desc);
 
-	if (rx_remain <= 0)
-		return 0;
-	else if (rx_remain > EP_BUFFER_SIZE)
-		return EP_BUFFER_SIZE;
+	if (rx_remain > max)
+		return max;
 
 	/*
 	 * Some controllers e.g. DWC3 don't like OUT transfers to be
@@ -447,15 +484,108 @@ static unsigned int rx_bytes_expected(struct usb_ep *ep)
 	return rx_remain;
 }
 
+/**
+ * rx_queue_dl() - Keep the OUT endpoint busy until the download is covered
+ *
+ * @ep: OUT endpoint
+ *
+ * Queues idle download requests at the next free spot of the download
+ * buffer. When nothing is in flight, that is the first cache-aligned spot
+ * after what has been received; fastboot_data_download() moves the data
+ * down if it lands above its final place. Whatever cannot be placed
+ * without overrunning the buffer is read through the command request.
+ */
+static void rx_queue_dl(struct usb_ep *ep)
+{
+	struct f_fastboot *f_fb = fastboot_func;
+	unsigned int remain = fastboot_data_remaining();
+	struct usb_request *req;
+	unsigned int len;
+	int i;
+
+	if (!f_fb->dl_pending)
+		f_fb->dl_offset = ALIGN(f_fb->dl_total - remain,
+					ARCH_DMA_MINALIGN);
+
+	for (i = 0; i < CONFIG_FASTBOOT_USB_DL_REQS; i++) {
+		if (remain <= f_fb->dl_pending)
+			return;
+		if (f_fb->dl_busy & BIT(i))
+			continue;
+
+		len = rx_bytes_expected(ep, remain - f_fb->dl_pending,
+					DL_BUFFER_SIZE);
+		req = f_fb->dl_req[i];
+		req->buf = fastboot_data_buffer(f_fb->dl_offset, len);
+		if (!req->buf)
+			break;
+
+		req->length = len;
+		req->actual = 0;
+		if (usb_ep_queue(ep, req, 0))
+			break;
+		f_fb->dl_busy |= BIT(i);
+		f_fb->dl_offset += len;
+		f_fb->dl_pending += len;
+	}
+
+	if (remain > f_fb->dl_pending && !f_fb->dl_pending) {
+		req = f_fb->out_req;
+		req->complete = rx_handler_dl_image;
+		req->length = rx_bytes_expected(ep, remain, EP_BUFFER_SIZE);
+		req->actual = 0;
+		if (!usb_ep_queue(ep, req, 0))
+			f_fb->dl_pending += req->length;
+	}
+}
+
+/**
+ * rx_dl_done() - Return the OUT endpoint to command mode
+ *
+ * @ep: OUT endpoint
+ *
+ * Requests left over after a short transfer are cancelled so that they
+ * cannot swallow the next command.
+ */
+static void rx_dl_done(struct usb_ep *ep)
+{
+	struct f_fastboot *f_fb = fastboot_func;
+	struct usb_request *req = f_fb->out_req;
+	int i;
+
+	f_fb->dl_pending = 0;
+	for (i = 0; i < CONFIG_FASTBOOT_USB_DL_REQS; i++) {
+		if (f_fb->dl_busy & BIT(i))
+			usb_ep_dequeue(ep, f_fb->dl_req[i]);
+	}
+	f_fb->dl_busy = 0;
+
+	req->complete = rx_handler_command;
+	req->length = EP_BUFFER_SIZE;
+	req->actual = 0;
+	usb_ep_queue(ep, req, 0);
+}
+
 static void rx_handler_dl_image(struct usb_ep *ep, struct usb_request *req)
 {
+	struct f_fastboot *f_fb = fastboot_func;
 	char response[FASTBOOT_RESPONSE_LEN] = {0};
 	unsigned int transfer_size = fastboot_data_remaining();
 	const unsigned char *buffer = req->buf;
 	unsigned int buffer_size = req->actual;
+	int i;
+
+	for (i = 0; i < CONFIG_FASTBOOT_USB_DL_REQS; i++) {
+		if (req == f_fb->dl_req[i])
+			f_fb->dl_busy &= ~BIT(i);
+	}
+	if (!f_fb->dl_pending)
+		return;
+	f_fb->dl_pending -= req->length;
 
 	if (req->status != 0) {
 		printf("Bad status: %d\n", req->status);
+		fastboot_data_abort();
 		return;
 	}
 
@@ -464,23 +594,17 @@ static void rx_handler_dl_image(struct usb_ep *ep, struct usb_request *req)
 
 	fastboot_data_download(buffer, transfer_size, response);
 	if (response[0]) {
+		rx_dl_done(ep);
 		fastboot_tx_write_str(response);
+		return;
 	} else if (!fastboot_data_remaining()) {
 		fastboot_data_complete(response);
-
-		/*
-		 * Reset global transfer variable
-		 */
-		req->complete = rx_handler_command;
-		req->length = EP_BUFFER_SIZE;
-
+		rx_dl_done(ep);
 		fastboot_tx_write_str(response);
-	} else {
-		req->length = rx_bytes_expected(ep);
+		return;
 	}
 
-	req->actual = 0;
-	usb_ep_queue(ep, req, 0);
+	rx_queue_dl(ep);
 }
 
 static void do_exit_on_complete(struct usb_ep *ep, struct usb_request *req)
@@ -524,8 +648,11 @@ static void rx_handler_command(struct usb_ep *ep, struct usb_request *req)
 	}
 
 	if (!strncmp("DATA", response, 4)) {
-		req->complete = rx_handler_dl_image;
-		req->length = rx_bytes_expected(ep);
+		fastboot_func->dl_total = fastboot_data_remaining();
+		fastboot_func->dl_pending = 0;
+		rx_queue_dl(ep);
+		fastboot_tx_write_str(response);
+		return;
 	}
 
 	if (!strncmp("OKAY", response, 4)) {
@@ -984,6 +984,14 @@ static int do_write(struct fsg_common *common)
 
 static int do_synchronize_cache(struct fsg_common *common)
 {
+	struct fsg_lun	*curlun = &common->luns[common->lun];
+	struct ums	*ums_dev = &ums[common->lun];
+
+	if (ums_dev->flush && ums_dev->flush(ums_dev)) {
+		curlun->sense_data = SS_WRITE_ERROR;
+		return -EIO;
+	}
+
 	return 0;
 }
 
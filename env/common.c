@@ -202,19 +202,61 @@ int env_import_redund(const char *buf1, int buf1_read_fail,
 #endif /* CONFIG_SYS_REDUNDAND_ENVIRONMENT */
 
 /* Export the environment and generate CRC for it. */
+#if defined(CONFIG_ENV_EXPORT_CACHE) && !defined(CONFIG_SPL_BUILD)
+/*
+ * The last export, handed out again while the hash table is unchanged so
+ * that saving the same environment twice costs a copy instead of a sort
+ * and a CRC of the whole area.
+ */
+static env_t *env_exported;
+static unsigned int env_exported_changes;
+
+static bool env_export_cached(env_t *env_out)
+{
+	if (!env_exported || env_exported_changes != env_htab.changes)
+		return false;
+
+	memcpy(env_out, env_exported, sizeof(*env_out));
+
+	return true;
+}
+
+static void env_export_cache(const env_t *env_out)
+{
+	if (!env_exported)
+		env_exported = malloc(sizeof(*env_exported));
+	if (!env_exported)
+		return;
+
+	memcpy(env_exported, env_out, sizeof(*env_out));
+	env_exported_changes = env_htab.changes;
+}
+#else
+static inline bool env_export_cached(env_t *env_out)
+{
+	return false;
+}
+
+static inline void env_export_cache(const env_t *env_out) {}
+#endif
+
 int env_export(env_t *env_out)
 {
 	char *res;
 	ssize_t	len;
 
-	res = (char *)env_out->data;
-	len = hexport_r(&env_htab, '\0', 0, &res, ENV_SIZE, 0, NULL);
-	if (len < 0) {
-		pr_err("Cannot export environment: errno = %d\n", errno);
-		return 1;
-	}
+	if (!env_export_cached(env_out)) {
+		res = (char *)env_out->data;
+		len = hexport_r(&env_htab, '\0', 0, &res, ENV_SIZE, 0, NULL);
+		if (len < 0) {
+			pr_err("Cannot export environment: errno = %d\n",
+			       errno);
+			return 1;
+		}
 
-	env_out->crc = crc32(0, env_out->data, ENV_SIZE);
+		env_out->crc = crc32(0, env_out->data, ENV_SIZE);
+		env_export_cache(env_out);
+	}
 
 #ifdef CONFIG_SYS_REDUNDAND_ENVIRONMENT
 	env_out->flags = ++env_flags; /* increase the serial */
@@ -188,6 +188,54 @@ static inline int write_env(struct mmc *mmc, unsigned long size,
 	return (n == blk_cnt) ? 0 : -1;
 }
 
+/*
+ * Write only the blocks that differ from what the area holds, so that
+ * saving after changing a few variables does not rewrite all of it.
+ * Everything is written when the area can't be read first.
+ */
+static int write_env_changed(struct mmc *mmc, unsigned long size,
+			     unsigned long offset, const void *buffer)
+{
+	uint blk_start, blk_cnt, blksz, i, end, n, written = 0;
+	struct blk_desc *desc = mmc_get_blk_desc(mmc);
+	const u_char *new = buffer;
+	u_char *old;
+	int ret = 0;
+
+	blksz		= mmc->write_bl_len;
+	blk_start	= ALIGN(offset, blksz) / blksz;
+	blk_cnt		= ALIGN(size, blksz) / blksz;
+
+	old = malloc_cache_aligned(blk_cnt * blksz);
+	if (!old || blk_dread(desc, blk_start, blk_cnt, old) != blk_cnt) {
+		free(old);
+		return write_env(mmc, size, offset, buffer);
+	}
+
+	for (i = 0; i < blk_cnt; i = end) {
+		while (i < blk_cnt &&
+		       !memcmp(old + i * blksz, new + i * blksz, blksz))
+			i++;
+		for (end = i; end < blk_cnt; end++)
+			if (!memcmp(old + end * blksz, new + end * blksz, blksz))
+				break;
+		if (i == end)
+			break;
+
+		n = blk_dwrite(desc, blk_start + i, end - i,
+			       (u_char *)new + i * blksz);
+		if (n != end - i) {
+			ret = -1;
+			break;
+		}
+		written += n;
+	}
+	debug("%s: %u of %u blocks changed\n", __func__, written, blk_cnt);
+	free(old);
+
+	return ret;
+}
+
 static int env_mmc_save(void)
 {
 	ALLOC_CACHE_ALIGN_BUFFER(env_t, env_new, 1);
@@ -218,7 +266,8 @@ static int env_mmc_save(void)
 	}
 
 	printf("Writing to %sMMC(%d)... ", copy ? "redundant " : "", dev);
-	if (write_env(mmc, CONFIG_ENV_SIZE, offset, (u_char *)env_new)) {
+	if (write_env_changed(mmc, CONFIG_ENV_SIZE, offset,
+			      (u_char *)env_new)) {
 		puts("failed\n");
 		ret = 1;
 		goto fini;
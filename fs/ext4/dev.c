@@ -53,6 +53,23 @@ int ext4fs_devread(lbaint_t sector, int byte_offset, int byte_len,
 			  byte_len, buffer);
 }
 
+/*
+ * Start reading whole sectors of the partition in the background, see
+ * blk_dread_submit()
+ */
+int ext4fs_devread_submit(lbaint_t sector, lbaint_t count, char *buffer,
+			  struct blk_req *req)
+{
+	if (sector + count > part_info->size) {
+		printf("%s read outside partition " LBAFU "\n", __func__,
+		       sector);
+		return -EINVAL;
+	}
+
+	return blk_dread_submit(ext4fs_blk_desc, part_info->start + sector,
+				count, buffer, req);
+}
+
 int ext4_read_superblock(char *buffer)
 {
 	struct ext_filesystem *fs = get_fs();
@@ -21,6 +21,7 @@
 #include <common.h>
 #include <ext_common.h>
 #include <ext4fs.h>
+#include <fs_dcache.h>
 #include <malloc.h>
 #include <memalign.h>
 #include <stddef.h>
@@ -43,6 +44,11 @@ int ext4fs_indir3_size;
 int ext4fs_indir3_blkno = -1;
 struct ext2_inode *g_parent_inode;
 static int symlinknest;
+/* the mount is kept between commands, see ext4fs_keep() */
+static bool ext4fs_kept;
+/* first block of the inode table of each group, 0 until read */
+static uint64_t *ext4fs_inode_tables;
+static uint32_t ext4fs_groups;
 
 #if defined(CONFIG_EXT4_WRITE)
 struct ext2_block_group *ext4fs_get_group_descriptor
@@ -1563,6 +1569,171 @@ static struct ext4_extent_header *ext4fs_get_extent_block
 	}
 }
 
+/*
+ * Extent lists of recently read inodes, so that a file read in several
+ * pieces (directories in particular) walks its extent tree only once per
+ * mount.
+ */
+#define EXT4_EXTENT_MAP_CACHE	4
+
+static struct ext4_extent_map_cache {
+	int ino;
+	int count;
+	int alloced;
+	struct ext4_extent_map *map;
+} ext4_extent_maps[EXT4_EXTENT_MAP_CACHE];
+static int ext4_extent_map_next;
+
+static int ext4fs_add_extent(struct ext4_extent_map_cache *c,
+			     const struct ext4_extent *ext)
+{
+	struct ext4_extent_map *m, *prev;
+	uint32_t len = le16_to_cpu(ext->ee_len);
+	bool uninit = len > EXT4_EXT_INIT_MAX_LEN;
+
+	if (uninit)
+		len -= EXT4_EXT_INIT_MAX_LEN;
+	if (!len)
+		return 0;
+
+	m = c->count ? &c->map[c->count - 1] : NULL;
+	if (m && le32_to_cpu(ext->ee_block) < m->lblk + m->len)
+		return -EINVAL;
+
+	if (c->count == c->alloced) {
+		c->alloced = c->alloced ? c->alloced * 2 : 16;
+		m = realloc(c->map, c->alloced * sizeof(*m));
+		if (!m)
+			return -ENOMEM;
+		c->map = m;
+	}
+	m = &c->map[c->count];
+	m->lblk = le32_to_cpu(ext->ee_block);
+	m->len = len;
+	m->pblk = ((uint64_t)le16_to_cpu(ext->ee_start_hi) << 32) +
+		  le32_to_cpu(ext->ee_start_lo);
+	m->uninit = uninit;
+
+	/* merge runs contiguous on disk, so that they are read in one go */
+	prev = c->count ? m - 1 : NULL;
+	if (prev && prev->uninit == uninit &&
+	    prev->lblk + prev->len == m->lblk &&
+	    prev->pblk + prev->len == m->pblk &&
+	    prev->len <= UINT_MAX - len) {
+		prev->len += len;
+		return 0;
+	}
+	c->count++;
+
+	return 0;
+}
+
+static int ext4fs_add_extents(struct ext4_extent_map_cache *c,
+			      struct ext4_extent_header *eh, int depth)
+{
+	struct ext4_extent_idx *index;
+	int blksz = EXT2_BLOCK_SIZE(ext4fs_root);
+	int log2_blksz = LOG2_BLOCK_SIZE(ext4fs_root) -
+			 get_fs()->dev_desc->log2blksz;
+	uint64_t block;
+	char *buf;
+	int i, ret = 0;
+
+	if (le16_to_cpu(eh->eh_magic) != EXT4_EXT_MAGIC ||
+	    le16_to_cpu(eh->eh_depth) != depth)
+		return -EINVAL;
+
+	if (!depth) {
+		struct ext4_extent *ext = (struct ext4_extent *)(eh + 1);
+
+		for (i = 0; i < le16_to_cpu(eh->eh_entries); i++) {
+			ret = ext4fs_add_extent(c, &ext[i]);
+			if (ret)
+				return ret;
+		}
+		return 0;
+	}
+
+	buf = malloc(blksz);
+	if (!buf)
+		return -ENOMEM;
+	index = (struct ext4_extent_idx *)(eh + 1);
+	for (i = 0; i < le16_to_cpu(eh->eh_entries); i++) {
+		block = le16_to_cpu(index[i].ei_leaf_hi);
+		block = (block << 32) + le32_to_cpu(index[i].ei_leaf_lo);
+		if (!ext4fs_devread((lbaint_t)block << log2_blksz, 0, blksz,
+				    buf)) {
+			ret = -EIO;
+			break;
+		}
+		ret = ext4fs_add_extents(c, (struct ext4_extent_header *)buf,
+					 depth - 1);
+		if (ret)
+			break;
+	}
+	free(buf);
+
+	return ret;
+}
+
+/**
+ * ext4fs_get_extent_map() - Map all the blocks of an extent-based file
+ *
+ * The extent tree is walked once and the result kept until the filesystem
+ * is closed or written to. Holes between the runs read as zeroes.
+ *
+ * @node:	File, which must have EXT4_EXTENTS_FL set
+ * @map:	Returns the runs in logical block order
+ * @return number of runs, or -ve on error
+ */
+int ext4fs_get_extent_map(struct ext2fs_node *node,
+			  const struct ext4_extent_map **map)
+{
+	struct ext4_extent_header *eh =
+		(struct ext4_extent_header *)node->inode.b.blocks.dir_blocks;
+	struct ext4_extent_map_cache *c;
+	int depth = le16_to_cpu(eh->eh_depth);
+	int ret;
+
+	for (c = ext4_extent_maps;
+	     c < ext4_extent_maps + EXT4_EXTENT_MAP_CACHE; c++) {
+		if (node->ino && c->ino == node->ino) {
+			*map = c->map;
+			return c->count;
+		}
+	}
+
+	c = &ext4_extent_maps[ext4_extent_map_next];
+	ext4_extent_map_next = (ext4_extent_map_next + 1) %
+			       EXT4_EXTENT_MAP_CACHE;
+	c->ino = 0;
+	c->count = 0;
+
+	if (depth > EXT4_EXT_MAX_DEPTH)
+		return -EINVAL;
+	ret = ext4fs_add_extents(c, eh, depth);
+	if (ret) {
+		printf("invalid extent block\n");
+		return ret;
+	}
+	c->ino = node->ino;
+	*map = c->map;
+
+	return c->count;
+}
+
+void ext4fs_free_extent_maps(void)
+{
+	struct ext4_extent_map_cache *c;
+
+	for (c = ext4_extent_maps;
+	     c < ext4_extent_maps + EXT4_EXTENT_MAP_CACHE; c++) {
+		free(c->map);
+		memset(c, 0, sizeof(*c));
+	}
+	ext4_extent_map_next = 0;
+}
+
 static int ext4fs_blockgroup
 	(struct ext2_data *data, int group, struct ext2_block_group *blkgrp)
 {
@@ -1589,46 +1760,60 @@ static int ext4fs_blockgroup
 			      blkoff, desc_size, (char *)blkgrp);
 }
 
-int ext4fs_read_inode(struct ext2_data *data, int ino, struct ext2_inode *inode)
+/*
+ * Return the first block of the inode table of a group, reading its
+ * descriptor only the first time in a mount. Returns 0 on error.
+ */
+static uint64_t ext4fs_inode_table(struct ext2_data *data, uint32_t group)
 {
 	struct ext2_block_group *blkgrp;
+	uint64_t blkno;
+
+	if (group < ext4fs_groups && ext4fs_inode_tables[group])
+		return ext4fs_inode_tables[group];
+
+	/* Allocate blkgrp based on gdsize (for 64-bit support). */
+	blkgrp = zalloc(get_fs()->gdsize);
+	if (!blkgrp)
+		return 0;
+
+	blkno = 0;
+	if (ext4fs_blockgroup(data, group, blkgrp))
+		blkno = ext4fs_bg_get_inode_table_id(blkgrp, get_fs());
+	free(blkgrp);
+
+	if (group < ext4fs_groups)
+		ext4fs_inode_tables[group] = blkno;
+
+	return blkno;
+}
+
+int ext4fs_read_inode(struct ext2_data *data, int ino, struct ext2_inode *inode)
+{
 	struct ext2_sblock *sblock = &data->sblock;
 	struct ext_filesystem *fs = get_fs();
 	int log2blksz = get_fs()->dev_desc->log2blksz;
 	int inodes_per_block, status;
 	long int blkno;
 	unsigned int blkoff;
-
-	/* Allocate blkgrp based on gdsize (for 64-bit support). */
-	blkgrp = zalloc(get_fs()->gdsize);
-	if (!blkgrp)
-		return 0;
+	uint64_t itable;
 
 	/* It is easier to calculate if the first inode is 0. */
 	ino--;
-	if ( le32_to_cpu(sblock->inodes_per_group) == 0 || fs->inodesz == 0) {
-		free(blkgrp);
+	if ( le32_to_cpu(sblock->inodes_per_group) == 0 || fs->inodesz == 0)
 		return 0;
-	}
-	status = ext4fs_blockgroup(data, ino / le32_to_cpu
-				   (sblock->inodes_per_group), blkgrp);
-	if (status == 0) {
-		free(blkgrp);
+	itable = ext4fs_inode_table(data, ino / le32_to_cpu
+				    (sblock->inodes_per_group));
+	if (!itable)
 		return 0;
-	}
 
 	inodes_per_block = EXT2_BLOCK_SIZE(data) / fs->inodesz;
-	if ( inodes_per_block == 0 ) {
-		free(blkgrp);
+	if ( inodes_per_block == 0 )
 		return 0;
-	}
-	blkno = ext4fs_bg_get_inode_table_id(blkgrp, fs) +
+	blkno = itable +
 	    (ino % le32_to_cpu(sblock->inodes_per_group)) / inodes_per_block;
 	blkoff = (ino % inodes_per_block) * fs->inodesz;
 
-	/* Free blkgrp as it is no longer required. */
-	free(blkgrp);
-
 	/* Read the inode. */
 	status = ext4fs_devread((lbaint_t)blkno << (LOG2_BLOCK_SIZE(data) -
 				log2blksz), blkoff,
@@ -2006,6 +2191,7 @@ long int read_allocated_block(struct ext2_inode *inode, int fileblock,
  */
 void ext4fs_reinit_global(void)
 {
+	ext4fs_free_extent_maps();
 	if (ext4fs_indir1_block != NULL) {
 		free(ext4fs_indir1_block);
 		ext4fs_indir1_block = NULL;
@@ -2035,40 +2221,73 @@ void ext4fs_close(void)
 		free(ext4fs_root);
 		ext4fs_root = NULL;
 	}
+	free(ext4fs_inode_tables);
+	ext4fs_inode_tables = NULL;
+	ext4fs_groups = 0;
+	ext4fs_kept = false;
 
+	fs_dcache_umount();
 	ext4fs_reinit_global();
 }
 
-int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
-				struct ext2fs_node **fnode, int *ftype)
+/*
+ * End a command but keep the superblock, root inode, inode table
+ * locations and block map caches for ext4fs_reopen(). The fs layer only
+ * does so while the device is not written to.
+ */
+int ext4fs_keep(void)
+{
+	if (!ext4fs_root)
+		return -1;
+
+	if (ext4fs_file) {
+		ext4fs_free_node(ext4fs_file, &ext4fs_root->diropen);
+		ext4fs_file = NULL;
+	}
+	fs_dcache_umount();
+	ext4fs_kept = true;
+
+	return 0;
+}
+
+int ext4fs_reopen(struct blk_desc *fs_dev_desc, disk_partition_t *fs_partition)
+{
+	/* someone mounted another filesystem in between */
+	if (!ext4fs_kept || !ext4fs_root)
+		return -1;
+
+	ext4fs_kept = false;
+	ext4fs_set_blk_dev(fs_dev_desc, fs_partition);
+	fs_dcache_mount(fs_dev_desc, fs_partition->start, &ext4fs_root->sblock,
+			SUPERBLOCK_SIZE);
+
+	return 0;
+}
+
+/*
+ * Look for name in, or list with a NULL name, the entries of a directory
+ * from byte fpos to end. Returns 1 if the name was found, 0 if not and
+ * -ve on error.
+ */
+static int ext4fs_scan_dir(struct ext2fs_node *diro, char *name,
+			   struct ext2fs_node **fnode, int *ftype,
+			   unsigned int fpos, unsigned int end)
 {
-	unsigned int fpos = 0;
 	int status;
 	loff_t actread;
-	struct ext2fs_node *diro = (struct ext2fs_node *) dir;
 
-#ifdef DEBUG
-	if (name != NULL)
-		printf("Iterate dir %s\n", name);
-#endif /* of DEBUG */
-	if (!diro->inode_read) {
-		status = ext4fs_read_inode(diro->data, diro->ino, &diro->inode);
-		if (status == 0)
-			return 0;
-	}
-	/* Search the file.  */
-	while (fpos < le32_to_cpu(diro->inode.size)) {
+	while (fpos < end) {
 		struct ext2_dirent dirent;
 
 		status = ext4fs_read_file(diro, fpos,
 					   sizeof(struct ext2_dirent),
 					   (char *)&dirent, &actread);
 		if (status < 0)
-			return 0;
+			return -EIO;
 
 		if (dirent.direntlen == 0) {
 			printf("Failed to iterate over directory %s\n", name);
-			return 0;
+			return -EINVAL;
 		}
 
 		if (dirent.namelen != 0) {
@@ -2082,11 +2301,11 @@ int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
 						  dirent.namelen, filename,
 						  &actread);
 			if (status < 0)
-				return 0;
+				return -EIO;
 
 			fdiro = zalloc(sizeof(struct ext2fs_node));
 			if (!fdiro)
-				return 0;
+				return -ENOMEM;
 
 			fdiro->data = diro->data;
 			fdiro->ino = le32_to_cpu(dirent.inode);
@@ -2109,7 +2328,7 @@ int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
 							   &fdiro->inode);
 				if (status == 0) {
 					free(fdiro);
-					return 0;
+					return -EIO;
 				}
 				fdiro->inode_read = 1;
 
@@ -2145,7 +2364,7 @@ int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
 								 &fdiro->inode);
 					if (status == 0) {
 						free(fdiro);
-						return 0;
+						return -EIO;
 					}
 					fdiro->inode_read = 1;
 				}
@@ -2174,6 +2393,79 @@ int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
 	return 0;
 }
 
+/*
+ * Look a name up, through the directory entry cache and the hash index
+ * of the directory when there is one.
+ */
+static int ext4fs_lookup(struct ext2fs_node *diro, char *name,
+			 struct ext2fs_node **fnode, int *ftype)
+{
+	unsigned int size = le32_to_cpu(diro->inode.size);
+	unsigned int blksz = EXT2_BLOCK_SIZE(diro->data);
+	int len = strlen(name);
+	uint32_t blocks[4];
+	int i, n = -EINVAL;
+	int found = 0;
+	u64 ino;
+
+	if (fs_dcache_lookup(diro->ino, name, len, &ino, ftype)) {
+		if (*ftype == FS_DCACHE_ABSENT)
+			return 0;
+		*fnode = zalloc(sizeof(struct ext2fs_node));
+		if (!*fnode)
+			return -ENOMEM;
+		(*fnode)->data = diro->data;
+		(*fnode)->ino = ino;
+		return 1;
+	}
+
+	/* "." and ".." are only in the first block, outside the index */
+	if ((le32_to_cpu(diro->inode.flags) & EXT4_INDEX_FL) &&
+	    strcmp(name, ".") && strcmp(name, ".."))
+		n = ext4fs_dx_find_leaves(diro, name, len, blocks,
+					  ARRAY_SIZE(blocks));
+	if (n < 0 && n != -EIO)
+		found = ext4fs_scan_dir(diro, name, fnode, ftype, 0, size);
+	else if (n < 0)
+		found = n;
+	for (i = 0; i < n && !found; i++)
+		found = ext4fs_scan_dir(diro, name, fnode, ftype,
+					blocks[i] * blksz,
+					(blocks[i] + 1) * blksz);
+
+	if (found > 0)
+		fs_dcache_add(diro->ino, name, len, (*fnode)->ino, *ftype);
+	else if (!found)
+		fs_dcache_add(diro->ino, name, len, 0, FS_DCACHE_ABSENT);
+
+	return found;
+}
+
+int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
+				struct ext2fs_node **fnode, int *ftype)
+{
+	int status;
+	struct ext2fs_node *diro = (struct ext2fs_node *) dir;
+
+#ifdef DEBUG
+	if (name != NULL)
+		printf("Iterate dir %s\n", name);
+#endif /* of DEBUG */
+	if (!diro->inode_read) {
+		status = ext4fs_read_inode(diro->data, diro->ino, &diro->inode);
+		if (status == 0)
+			return 0;
+	}
+
+	if ((name != NULL) && (fnode != NULL) && (ftype != NULL))
+		status = ext4fs_lookup(diro, name, fnode, ftype);
+	else
+		status = ext4fs_scan_dir(diro, name, fnode, ftype, 0,
+					 le32_to_cpu(diro->inode.size));
+
+	return status > 0;
+}
+
 static char *ext4fs_read_symlink(struct ext2fs_node *node)
 {
 	char *symlink;
@@ -2365,6 +2657,11 @@ int ext4fs_mount(unsigned part_length)
 	struct ext2_data *data;
 	int status;
 	struct ext_filesystem *fs = get_fs();
+
+	/* drop a mount kept for the fs layer */
+	if (ext4fs_kept)
+		ext4fs_close();
+
 	data = zalloc(SUPERBLOCK_SIZE);
 	if (!data)
 		return 0;
@@ -2404,11 +2701,22 @@ int ext4fs_mount(unsigned part_length)
 	data->diropen.inode_read = 1;
 	data->inode = &data->diropen.inode;
 
+	free(ext4fs_inode_tables);
+	ext4fs_groups = 0;
+	if (le32_to_cpu(data->sblock.inodes_per_group))
+		ext4fs_groups = DIV_ROUND_UP(le32_to_cpu(data->sblock.total_inodes),
+			le32_to_cpu(data->sblock.inodes_per_group));
+	ext4fs_inode_tables = calloc(ext4fs_groups, sizeof(uint64_t));
+	if (!ext4fs_inode_tables)
+		ext4fs_groups = 0;
+
 	status = ext4fs_read_inode(data, 2, data->inode);
 	if (status == 0)
 		goto fail;
 
 	ext4fs_root = data;
+	fs_dcache_mount(fs->dev_desc, part_offset, &data->sblock,
+			SUPERBLOCK_SIZE);
 
 	return 1;
 fail:
@@ -56,6 +56,32 @@ int ext4fs_find_file(const char *path, struct ext2fs_node *rootnode,
 int ext4fs_iterate_dir(struct ext2fs_node *dir, char *name,
 			struct ext2fs_node **fnode, int *ftype);
 
+/* A run of file blocks mapped by the extent tree, in filesystem blocks */
+struct ext4_extent_map {
+	uint32_t lblk;		/* first logical block */
+	uint32_t len;		/* number of blocks */
+	uint64_t pblk;		/* first physical block */
+	bool uninit;		/* allocated but unwritten, reads as zeroes */
+};
+
+int ext4fs_get_extent_map(struct ext2fs_node *node,
+			  const struct ext4_extent_map **map);
+void ext4fs_free_extent_maps(void);
+
+/**
+ * ext4fs_dx_find_leaves() - look a name up in the hash index of a directory
+ *
+ * @dir: directory with EXT4_INDEX_FL set and its inode read
+ * @name: name to look up
+ * @len: length of @name
+ * @blocks: set to the directory blocks that may hold the name, in order
+ * @max: size of @blocks
+ * @return number of blocks, -EINVAL if the index cannot be used and the
+ *	directory has to be searched linearly, other -ve error otherwise
+ */
+int ext4fs_dx_find_leaves(struct ext2fs_node *dir, const char *name, int len,
+			  uint32_t *blocks, int max);
+
 #if defined(CONFIG_EXT4_WRITE)
 uint32_t ext4fs_div_roundup(uint32_t size, uint32_t n);
 uint16_t ext4fs_checksum_update(unsigned int i);
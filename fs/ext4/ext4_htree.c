@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Hashed (htree) directory lookup for ext4
+ *
+ * Directories with EXT4_INDEX_FL set keep a B-tree of name hashes in
+ * their first blocks, pointing to the leaf block holding the names of
+ * each hash range. Finding a name then reads the index and one leaf
+ * instead of every block of the directory.
+ *
+ * The hash functions follow fs/ext4/hash.c of Linux,
+ * Copyright (C) 2002 by Theodore Ts'o
+ */
+
+#include <common.h>
+#include <ext_common.h>
+#include <ext4fs.h>
+#include <malloc.h>
+#include "ext4_common.h"
+
+#define DX_HASH_LEGACY			0
+#define DX_HASH_HALF_MD4		1
+#define DX_HASH_TEA			2
+#define DX_HASH_LEGACY_UNSIGNED		3
+#define DX_HASH_HALF_MD4_UNSIGNED	4
+#define DX_HASH_TEA_UNSIGNED		5
+
+#define DX_MAX_LEVELS			3
+#define DX_BLOCK_MASK			0x0fffffff
+#define DX_ROOT_INFO_OFFSET		24	/* after the "." and ".." entries */
+#define DX_NODE_ENTRIES_OFFSET		8	/* after an empty dirent */
+
+#define EXT4_HTREE_EOF_32BIT		0x7fffffff
+
+struct dx_root_info {
+	__le32 reserved_zero;
+	uint8_t hash_version;
+	uint8_t info_length;
+	uint8_t indirect_levels;
+	uint8_t unused_flags;
+};
+
+struct dx_entry {
+	__le32 hash;
+	__le32 block;
+};
+
+/* takes the place of the hash of the first entry of an index block */
+struct dx_countlimit {
+	__le16 limit;
+	__le16 count;
+};
+
+#define DELTA 0x9E3779B9
+
+static void tea_transform(uint32_t buf[4], const uint32_t in[])
+{
+	uint32_t sum = 0;
+	uint32_t b0 = buf[0], b1 = buf[1];
+	uint32_t a = in[0], b = in[1], c = in[2], d = in[3];
+	int n = 16;
+
+	do {
+		sum += DELTA;
+		b0 += ((b1 << 4) + a) ^ (b1 + sum) ^ ((b1 >> 5) + b);
+		b1 += ((b0 << 4) + c) ^ (b0 + sum) ^ ((b0 >> 5) + d);
+	} while (--n);
+
+	buf[0] += b0;
+	buf[1] += b1;
+}
+
+static inline uint32_t rol32(uint32_t word, unsigned int shift)
+{
+	return (word << shift) | (word >> (32 - shift));
+}
+
+/* F, G and H are basic MD4 functions: selection, majority, parity */
+#define F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define G(x, y, z) (((x) & (y)) + (((x) ^ (y)) & (z)))
+#define H(x, y, z) ((x) ^ (y) ^ (z))
+
+#define MD4_ROUND(f, a, b, c, d, x, s)	\
+	(a += f(b, c, d) + x, a = rol32(a, s))
+#define K1 0
+#define K2 013240474631UL
+#define K3 015666365641UL
+
+static void half_md4_transform(uint32_t buf[4], const uint32_t in[8])
+{
+	uint32_t a = buf[0], b = buf[1], c = buf[2], d = buf[3];
+
+	/* Round 1 */
+	MD4_ROUND(F, a, b, c, d, in[0] + K1,  3);
+	MD4_ROUND(F, d, a, b, c, in[1] + K1,  7);
+	MD4_ROUND(F, c, d, a, b, in[2] + K1, 11);
+	MD4_ROUND(F, b, c, d, a, in[3] + K1, 19);
+	MD4_ROUND(F, a, b, c, d, in[4] + K1,  3);
+	MD4_ROUND(F, d, a, b, c, in[5] + K1,  7);
+	MD4_ROUND(F, c, d, a, b, in[6] + K1, 11);
+	MD4_ROUND(F, b, c, d, a, in[7] + K1, 19);
+
+	/* Round 2 */
+	MD4_ROUND(G, a, b, c, d, in[1] + K2,  3);
+	MD4_ROUND(G, d, a, b, c, in[3] + K2,  5);
+	MD4_ROUND(G, c, d, a, b, in[5] + K2,  9);
+	MD4_ROUND(G, b, c, d, a, in[7] + K2, 13);
+	MD4_ROUND(G, a, b, c, d, in[0] + K2,  3);
+	MD4_ROUND(G, d, a, b, c, in[2] + K2,  5);
+	MD4_ROUND(G, c, d, a, b, in[4] + K2,  9);
+	MD4_ROUND(G, b, c, d, a, in[6] + K2, 13);
+
+	/* Round 3 */
+	MD4_ROUND(H, a, b, c, d, in[3] + K3,  3);
+	MD4_ROUND(H, d, a, b, c, in[7] + K3,  9);
+	MD4_ROUND(H, c, d, a, b, in[2] + K3, 11);
+	MD4_ROUND(H, b, c, d, a, in[6] + K3, 15);
+	MD4_ROUND(H, a, b, c, d, in[1] + K3,  3);
+	MD4_ROUND(H, d, a, b, c, in[5] + K3,  9);
+	MD4_ROUND(H, c, d, a, b, in[0] + K3, 11);
+	MD4_ROUND(H, b, c, d, a, in[4] + K3, 15);
+
+	buf[0] += a;
+	buf[1] += b;
+	buf[2] += c;
+	buf[3] += d;
+}
+
+/* the legacy hash, characters taken as signed or unsigned */
+static uint32_t dx_hack_hash(const char *name, int len, bool unsigned_chars)
+{
+	uint32_t hash, hash0 = 0x12a3fe2d, hash1 = 0x37abe8f9;
+	int c;
+
+	while (len--) {
+		c = unsigned_chars ? (unsigned char)*name : (signed char)*name;
+		name++;
+		hash = hash1 + (hash0 ^ (c * 7152373));
+
+		if (hash & 0x80000000)
+			hash -= 0x7fffffff;
+		hash1 = hash0;
+		hash0 = hash;
+	}
+
+	return hash0 << 1;
+}
+
+static void str2hashbuf(const char *msg, int len, uint32_t *buf, int num,
+			bool unsigned_chars)
+{
+	uint32_t pad, val;
+	int i, c;
+
+	pad = (uint32_t)len | ((uint32_t)len << 8);
+	pad |= pad << 16;
+
+	val = pad;
+	if (len > num * 4)
+		len = num * 4;
+	for (i = 0; i < len; i++) {
+		c = unsigned_chars ? (unsigned char)msg[i] :
+				     (signed char)msg[i];
+		val = c + (val << 8);
+		if ((i % 4) == 3) {
+			*buf++ = val;
+			val = pad;
+			num--;
+		}
+	}
+	if (--num >= 0)
+		*buf++ = val;
+	while (--num >= 0)
+		*buf++ = pad;
+}
+
+static int ext4fs_dirhash(int version, const __le32 *seed, const char *name,
+			  int len, uint32_t *hashp)
+{
+	uint32_t buf[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+	bool unsigned_chars = false;
+	uint32_t in[8], hash;
+	int i;
+
+	/* an all zero seed means the default one */
+	for (i = 0; i < 4; i++) {
+		if (seed[i]) {
+			for (i = 0; i < 4; i++)
+				buf[i] = le32_to_cpu(seed[i]);
+			break;
+		}
+	}
+
+	switch (version) {
+	case DX_HASH_LEGACY_UNSIGNED:
+		unsigned_chars = true;
+		/* fall through */
+	case DX_HASH_LEGACY:
+		hash = dx_hack_hash(name, len, unsigned_chars);
+		break;
+	case DX_HASH_HALF_MD4_UNSIGNED:
+		unsigned_chars = true;
+		/* fall through */
+	case DX_HASH_HALF_MD4:
+		for (; len > 0; len -= 32, name += 32) {
+			str2hashbuf(name, len, in, 8, unsigned_chars);
+			half_md4_transform(buf, in);
+		}
+		hash = buf[1];
+		break;
+	case DX_HASH_TEA_UNSIGNED:
+		unsigned_chars = true;
+		/* fall through */
+	case DX_HASH_TEA:
+		for (; len > 0; len -= 16, name += 16) {
+			str2hashbuf(name, len, in, 4, unsigned_chars);
+			tea_transform(buf, in);
+		}
+		hash = buf[0];
+		break;
+	default:
+		debug("ext4: unsupported directory hash %d\n", version);
+		return -EINVAL;
+	}
+
+	hash &= ~1;
+	if (hash == (EXT4_HTREE_EOF_32BIT << 1))
+		hash = (EXT4_HTREE_EOF_32BIT - 1) << 1;
+	*hashp = hash;
+
+	return 0;
+}
+
+int ext4fs_dx_find_leaves(struct ext2fs_node *dir, const char *name, int len,
+			  uint32_t *blocks, int max)
+{
+	struct ext2_data *data = dir->data;
+	struct ext2_sblock *sb = &data->sblock;
+	int blksz = EXT2_BLOCK_SIZE(data);
+	uint32_t nblocks = le32_to_cpu(dir->inode.size) / blksz;
+	uint32_t hash = 0, blk = 0, next_hash = 0;
+	bool has_next = false;
+	struct dx_root_info *info;
+	struct dx_countlimit *cl;
+	struct dx_entry *entries, *end, *p, *q, *at;
+	int level = 0, levels = 0, version, n = 0;
+	loff_t actread;
+	char *buf;
+	int ret;
+
+	if (!(le32_to_cpu(sb->feature_compatibility) &
+	      EXT4_FEATURE_COMPAT_DIR_INDEX))
+		return -EINVAL;
+
+	buf = malloc(blksz);
+	if (!buf)
+		return -ENOMEM;
+
+	for (;;) {
+		ret = ext4fs_read_file(dir, (loff_t)blk * blksz, blksz, buf,
+				       &actread);
+		if (ret < 0 || actread != blksz) {
+			ret = -EIO;
+			goto out;
+		}
+
+		ret = -EINVAL;
+		if (!level) {
+			info = (struct dx_root_info *)(buf + DX_ROOT_INFO_OFFSET);
+			if (info->reserved_zero || info->info_length < 8 ||
+			    info->indirect_levels >= DX_MAX_LEVELS)
+				goto out;
+
+			version = info->hash_version;
+			if (version <= DX_HASH_TEA &&
+			    le32_to_cpu(sb->flags) & EXT2_FLAGS_UNSIGNED_HASH)
+				version += DX_HASH_LEGACY_UNSIGNED;
+			if (ext4fs_dirhash(version, sb->hash_seed, name, len,
+					   &hash))
+				goto out;
+
+			levels = info->indirect_levels;
+			entries = (struct dx_entry *)(buf + DX_ROOT_INFO_OFFSET +
+						      info->info_length);
+		} else {
+			entries = (struct dx_entry *)(buf +
+						      DX_NODE_ENTRIES_OFFSET);
+		}
+
+		cl = (struct dx_countlimit *)entries;
+		if (!cl->count || le16_to_cpu(cl->count) > le16_to_cpu(cl->limit) ||
+		    (char *)(entries + le16_to_cpu(cl->limit)) > buf + blksz)
+			goto out;
+		end = entries + le16_to_cpu(cl->count);
+
+		/* the last entry with a hash not above ours */
+		p = entries + 1;
+		q = end - 1;
+		while (p <= q) {
+			struct dx_entry *m = p + (q - p) / 2;
+
+			if (le32_to_cpu(m->hash) > hash)
+				q = m - 1;
+			else
+				p = m + 1;
+		}
+		at = p - 1;
+		blk = le32_to_cpu(at->block) & DX_BLOCK_MASK;
+		if (blk >= nblocks)
+			goto out;
+
+		if (level++ == levels)
+			break;
+
+		/* remember where the following subtree starts */
+		if (at + 1 < end) {
+			next_hash = le32_to_cpu(at[1].hash);
+			has_next = true;
+		}
+	}
+
+	/*
+	 * Names with the same hash may spill into the following leaves,
+	 * which then have the low bit of their hash set.
+	 */
+	blocks[n++] = blk;
+	for (at++; at < end && (le32_to_cpu(at->hash) & ~1) == hash; at++) {
+		if (n == max)
+			goto out;
+		blocks[n] = le32_to_cpu(at->block) & DX_BLOCK_MASK;
+		if (blocks[n++] >= nblocks)
+			goto out;
+	}
+	/* let the caller scan it all when they continue in another node */
+	if (at == end && has_next && (next_hash & ~1) == hash)
+		goto out;
+
+	ret = n;
+out:
+	free(buf);
+
+	return ret;
+}
@@ -698,6 +698,9 @@ void ext4fs_deinit(void)
 	struct ext_filesystem *fs = get_fs();
 	uint32_t new_feature_incompat;
 
+	/* files written since the mount may have moved */
+	ext4fs_free_extent_maps();
+
 	/* free journal */
 	char *temp_buff = zalloc(fs->blksz);
 	if (temp_buff) {
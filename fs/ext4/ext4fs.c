@@ -40,6 +40,111 @@ void ext4fs_free_node(struct ext2fs_node *node, struct ext2fs_node *currroot)
 		free(node);
 }
 
+/*
+ * Read an extent-based file: one device read per run of the extent map,
+ * straight into @buf, and zero fill for holes and unwritten extents.
+ *
+ * The sector-aligned part of each run is read in the background, so the
+ * zero fill and the walk to the next run overlap the transfer. Partial
+ * sectors at either end are read first, since any access to the device
+ * waits for the background read.
+ */
+static int ext4fs_read_extents(struct ext2fs_node *node, loff_t pos,
+			       loff_t len, char *buf)
+{
+	int log2blksz = get_fs()->dev_desc->log2blksz;
+	int log2_fs_blocksize = LOG2_BLOCK_SIZE(node->data);
+	loff_t blkmask = (1 << log2blksz) - 1;
+	const struct ext4_extent_map *ext;
+	loff_t done = pos, end = pos + len;
+	loff_t start, stop, off, n;
+	struct blk_req req;
+	bool pending = false;
+	lbaint_t sector;
+	int count;
+
+	count = ext4fs_get_extent_map(node, &ext);
+	if (count < 0)
+		return count;
+
+	for (; count && done < end; ext++, count--) {
+		start = (loff_t)ext->lblk << log2_fs_blocksize;
+		stop = start + ((loff_t)ext->len << log2_fs_blocksize);
+		if (stop <= done)
+			continue;
+		if (start >= end)
+			break;
+
+		if (start > done) {
+			memset(buf + (done - pos), 0, start - done);
+			done = start;
+		}
+		stop = min(stop, end);
+		if (ext->uninit) {
+			memset(buf + (done - pos), 0, stop - done);
+			done = stop;
+			continue;
+		}
+
+		if (pending) {
+			pending = false;
+			if (blk_req_wait(&req) < 0)
+				return -EIO;
+		}
+
+		sector = (lbaint_t)ext->pblk << (log2_fs_blocksize - log2blksz);
+		off = done - start;
+
+		/* partial sector at the start of the run */
+		n = min(stop - done, (-off) & blkmask);
+		if (n) {
+			if (!ext4fs_devread(sector + (off >> log2blksz),
+					    off & blkmask, n, buf + (done - pos)))
+				return -EIO;
+			done += n;
+			off += n;
+		}
+
+		/* partial sector at the end of the run */
+		n = (stop - done) & blkmask;
+		if (n) {
+			if (!ext4fs_devread(sector + ((off + stop - done - n) >>
+						      log2blksz), 0, n,
+					    buf + (stop - n - pos)))
+				return -EIO;
+			stop -= n;
+		}
+
+		if (stop > done) {
+			if (ext4fs_devread_submit(sector + (off >> log2blksz),
+						  (stop - done) >> log2blksz,
+						  buf + (done - pos), &req))
+				return -EIO;
+			pending = true;
+		}
+		done = stop + n;
+
+		/*
+		 * The zero fill must not dirty a cache line the transfer is
+		 * still writing to
+		 */
+		if (pending && ((ulong)buf + (stop - pos)) &
+		    (ARCH_DMA_MINALIGN - 1)) {
+			pending = false;
+			if (blk_req_wait(&req) < 0)
+				return -EIO;
+		}
+	}
+
+	if (done < end)
+		memset(buf + (done - pos), 0, end - done);
+
+	if (pending && blk_req_wait(&req) < 0)
+		return -EIO;
+
+	return 0;
+}
+
 /*
  * Taken from openmoko-kernel mailing list: By Andy green
  * Optimized read file API : collects and defers contiguous sector
@@ -65,17 +170,22 @@ int ext4fs_read_file(struct ext2fs_node *node, loff_t pos,
 	short status;
 	struct ext_block_cache cache;
 
-	ext_cache_init(&cache);
-
 	/* Adjust len so it we can't read past the end of the file. */
 	if (len + pos > filesize)
 		len = (filesize - pos);
 
-	if (blocksize <= 0 || len <= 0) {
-		ext_cache_fini(&cache);
+	if (blocksize <= 0 || len <= 0)
 		return -1;
+
+	if (le32_to_cpu(node->inode.flags) & EXT4_EXTENTS_FL) {
+		if (ext4fs_read_extents(node, pos, len, buf))
+			return -1;
+		*actread = len;
+		return 0;
 	}
 
+	ext_cache_init(&cache);
+
 	blockcnt = lldiv(((len + pos) + blocksize - 1), blocksize);
 
 	for (i = lldiv(pos, blocksize); i < blockcnt; i++) {
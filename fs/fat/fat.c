@@ -14,6 +14,7 @@
 #include <exports.h>
 #include <fat.h>
 #include <fs.h>
+#include <fs_dcache.h>
 #include <asm/byteorder.h>
 #include <part.h>
 #include <malloc.h>
@@ -76,10 +77,12 @@ int fat_set_blk_dev(struct blk_desc *dev_desc, disk_partition_t *info)
 	}
 
 	/* Check for FAT12/FAT16/FAT32 filesystem */
-	if (!memcmp(buffer + DOS_FS_TYPE_OFFSET, "FAT", 3))
-		return 0;
-	if (!memcmp(buffer + DOS_FS32_TYPE_OFFSET, "FAT32", 5))
+	if (!memcmp(buffer + DOS_FS_TYPE_OFFSET, "FAT", 3) ||
+	    !memcmp(buffer + DOS_FS32_TYPE_OFFSET, "FAT32", 5)) {
+		fs_dcache_mount(dev_desc, info->start, buffer,
+				dev_desc->blksz);
 		return 0;
+	}
 
 	cur_dev = NULL;
 	return -1;
@@ -259,21 +262,39 @@ get_cluster(fsdata *mydata, __u32 clustnum, __u8 *buffer, unsigned long size)
 	debug("gc - clustnum: %d, startsect: %d\n", clustnum, startsect);
 
 	if ((unsigned long)buffer & (ARCH_DMA_MINALIGN - 1)) {
-		ALLOC_CACHE_ALIGN_BUFFER(__u8, tmpbuf, mydata->sect_size);
+		__u32 chunk = min_t(unsigned long, size / mydata->sect_size,
+				    MAX_CLUSTSIZE / mydata->sect_size);
+		__u8 *tmpbuf = NULL;
 
 		debug("FAT: Misaligned buffer address (%p)\n", buffer);
 
+		/* bounce through an aligned buffer, many sectors at a time */
+		if (chunk) {
+			tmpbuf = malloc_cache_aligned(chunk *
+						      mydata->sect_size);
+			if (!tmpbuf) {
+				debug("Error: allocating buffer\n");
+				return -1;
+			}
+		}
+
 		while (size >= mydata->sect_size) {
-			ret = disk_read(startsect++, 1, tmpbuf);
-			if (ret != 1) {
+			idx = min_t(unsigned long, chunk,
+				    size / mydata->sect_size);
+			ret = disk_read(startsect, idx, tmpbuf);
+			if (ret != idx) {
 				debug("Error reading data (got %d)\n", ret);
+				free(tmpbuf);
 				return -1;
 			}
 
-			memcpy(buffer, tmpbuf, mydata->sect_size);
-			buffer += mydata->sect_size;
-			size -= mydata->sect_size;
+			startsect += idx;
+			idx *= mydata->sect_size;
+			memcpy(buffer, tmpbuf, idx);
+			buffer += idx;
+			size -= idx;
 		}
+		free(tmpbuf);
 	} else {
 		idx = size / mydata->sect_size;
 		ret = disk_read(startsect, idx, buffer);
@@ -389,50 +410,43 @@ static int get_contents(fsdata *mydata, dir_entry *dentptr, loff_t pos,
 		}
 	}
 
-	actsize = bytesperclust;
-	endclust = curclust;
-
-	do {
-		/* search for consecutive clusters */
+	/*
+	 * Follow the chain through the FAT window, and read each run of
+	 * consecutive clusters straight into the buffer with one request.
+	 */
+	while (1) {
+		actsize = bytesperclust;
+		endclust = curclust;
+		newclust = 0;
 		while (actsize < filesize) {
 			newclust = get_fatent(mydata, endclust);
-			if ((newclust - 1) != endclust)
-				goto getit;
-			if (CHECK_CLUST(newclust, mydata->fatsize)) {
-				debug("curclust: 0x%x\n", newclust);
-				printf("Invalid FAT entry\n");
-				return -1;
-			}
+			if (newclust != endclust + 1 ||
+			    CHECK_CLUST(newclust, mydata->fatsize))
+				break;
 			endclust = newclust;
 			actsize += bytesperclust;
 		}
+		actsize = min(actsize, filesize);
 
-		/* get remaining bytes */
-		actsize = filesize;
-		if (get_cluster(mydata, curclust, buffer, (int)actsize) != 0) {
+		debug("run: clusters %u-%u, %llu bytes\n", curclust, endclust,
+		      actsize);
+		if (get_cluster(mydata, curclust, buffer, actsize) != 0) {
 			printf("Error reading cluster\n");
 			return -1;
 		}
 		*gotsize += actsize;
-		return 0;
-getit:
-		if (get_cluster(mydata, curclust, buffer, (int)actsize) != 0) {
-			printf("Error reading cluster\n");
-			return -1;
-		}
-		*gotsize += (int)actsize;
 		filesize -= actsize;
+		if (!filesize)
+			return 0;
 		buffer += actsize;
 
-		curclust = get_fatent(mydata, endclust);
+		curclust = newclust;
 		if (CHECK_CLUST(curclust, mydata->fatsize)) {
 			debug("curclust: 0x%x\n", curclust);
 			printf("Invalid FAT entry\n");
 			return -1;
 		}
-		actsize = bytesperclust;
-		endclust = curclust;
-	} while (1);
+	}
 }
 
 /*
@@ -708,6 +722,29 @@ static int fat_itr_root(fat_itr *itr, fsdata *fsdata)
 	return 0;
 }
 
+/**
+ * fat_itr_enter() - point an iterator at the start of a directory
+ *
+ * @itr: iterator to initialize, its fsdata must be set
+ * @clustnum: first cluster of the directory, 0 for the root directory
+ */
+static void fat_itr_enter(fat_itr *itr, unsigned clustnum)
+{
+	itr->start_clust = clustnum;
+	if (clustnum > 0) {
+		itr->clust = clustnum;
+		itr->next_clust = clustnum;
+		itr->is_root = 0;
+	} else {
+		itr->clust = itr->fsdata->root_cluster;
+		itr->next_clust = itr->fsdata->root_cluster;
+		itr->is_root = 1;
+	}
+	itr->dent = NULL;
+	itr->remaining = 0;
+	itr->last_cluster = 0;
+}
+
 /**
  * fat_itr_child() - initialize an iterator to descend into a sub-
  * directory
@@ -728,24 +765,11 @@ static int fat_itr_root(fat_itr *itr, fsdata *fsdata)
 static void fat_itr_child(fat_itr *itr, fat_itr *parent)
 {
 	fsdata *mydata = parent->fsdata;  /* for silly macros */
-	unsigned clustnum = START(parent->dent);
 
 	assert(fat_itr_isdir(parent));
 
 	itr->fsdata = parent->fsdata;
-	itr->start_clust = clustnum;
-	if (clustnum > 0) {
-		itr->clust = clustnum;
-		itr->next_clust = clustnum;
-		itr->is_root = 0;
-	} else {
-		itr->clust = parent->fsdata->root_cluster;
-		itr->next_clust = parent->fsdata->root_cluster;
-		itr->is_root = 1;
-	}
-	itr->dent = NULL;
-	itr->remaining = 0;
-	itr->last_cluster = 0;
+	fat_itr_enter(itr, START(parent->dent));
 }
 
 static void *next_cluster(fat_itr *itr, unsigned *nbytes)
@@ -998,7 +1022,12 @@ static int fat_itr_isdir(fat_itr *itr)
  */
 static int fat_itr_resolve(fat_itr *itr, const char *path, unsigned type)
 {
+	fsdata *mydata = itr->fsdata;  /* for silly macros */
 	const char *next;
+	char key[64];
+	bool cacheable;
+	int len, dtype;
+	u64 clust;
 
 	/* chomp any extra leading slashes: */
 	while (path[0] && ISDIRDELIM(path[0]))
@@ -1038,6 +1067,22 @@ static int fat_itr_resolve(fat_itr *itr, const char *path, unsigned type)
 		}
 	}
 
+	/* directory entry cache, keyed on the lower case name */
+	len = next - path;
+	cacheable = len < sizeof(key);
+	if (cacheable) {
+		memcpy(key, path, len);
+		key[len] = '\0';
+		downcase(key, len);
+		if (fs_dcache_lookup(itr->start_clust, key, len, &clust,
+				     &dtype)) {
+			if (dtype == FS_DCACHE_ABSENT)
+				return -ENOENT;
+			fat_itr_enter(itr, clust);
+			return fat_itr_resolve(itr, next, type);
+		}
+	}
+
 	while (fat_itr_next(itr)) {
 		int match = 0;
 		unsigned n = max(strlen(itr->name), (size_t)(next - path));
@@ -1053,6 +1098,9 @@ static int fat_itr_resolve(fat_itr *itr, const char *path, unsigned type)
 			continue;
 
 		if (fat_itr_isdir(itr)) {
+			if (cacheable)
+				fs_dcache_add(itr->start_clust, key, len,
+					      START(itr->dent), FS_DT_DIR);
 			/* recurse into directory: */
 			fat_itr_child(itr, itr);
 			return fat_itr_resolve(itr, next, type);
@@ -1070,6 +1118,10 @@ static int fat_itr_resolve(fat_itr *itr, const char *path, unsigned type)
 		}
 	}
 
+	/* a read error ends the scan too, only remember a complete one */
+	if (cacheable && (itr->dent || itr->last_cluster))
+		fs_dcache_add(itr->start_clust, key, len, 0, FS_DCACHE_ABSENT);
+
 	return -ENOENT;
 }
 
@@ -1315,4 +1367,5 @@ void fat_closedir(struct fs_dir_stream *dirs)
 
 void fat_close(void)
 {
+	fs_dcache_umount();
 }
@@ -104,10 +104,10 @@ static void set_name(dir_entry *dirent, const char *filename)
  */
 static int flush_dirty_fat_buffer(fsdata *mydata)
 {
-	int getsize = FATBUFBLOCKS;
+	int getsize;
 	__u32 fatlength = mydata->fatlength;
-	__u8 *bufptr = mydata->fatbuf;
-	__u32 startblock = mydata->fatbufnum * FATBUFBLOCKS;
+	__u8 *bufptr;
+	__u32 startblock;
 
 	debug("debug: evicting %d, dirty: %d\n", mydata->fatbufnum,
 	      (int)mydata->fat_dirty);
@@ -115,7 +115,10 @@ static int flush_dirty_fat_buffer(fsdata *mydata)
 	if ((!mydata->fat_dirty) || (mydata->fatbufnum == -1))
 		return 0;
 
-	/* Cap length if fatlength is not a multiple of FATBUFBLOCKS */
+	/* Only write back the sectors that were modified */
+	getsize = mydata->fat_dirty_hi - mydata->fat_dirty_lo + 1;
+	bufptr = mydata->fatbuf + mydata->fat_dirty_lo * mydata->sect_size;
+	startblock = mydata->fatbufnum * FATBUFBLOCKS + mydata->fat_dirty_lo;
 	if (startblock + getsize > fatlength)
 		getsize = fatlength - startblock;
 
@@ -140,6 +143,26 @@ static int flush_dirty_fat_buffer(fsdata *mydata)
 	return 0;
 }
 
+/*
+ * Record that 'len' bytes at 'off' in the FAT buffer are about to change
+ */
+static void mark_fat_dirty(fsdata *mydata, __u32 off, __u32 len)
+{
+	__u32 lo = off / mydata->sect_size;
+	__u32 hi = (off + len - 1) / mydata->sect_size;
+
+	if (hi >= FATBUFBLOCKS)
+		hi = FATBUFBLOCKS - 1;
+	if (!mydata->fat_dirty) {
+		mydata->fat_dirty_lo = lo;
+		mydata->fat_dirty_hi = hi;
+		mydata->fat_dirty = 1;
+		return;
+	}
+	mydata->fat_dirty_lo = min(mydata->fat_dirty_lo, lo);
+	mydata->fat_dirty_hi = max(mydata->fat_dirty_hi, hi);
+}
+
 /*
  * Set the file name information from 'name' into 'slotptr',
  */
@@ -308,7 +331,17 @@ static int set_fatent_value(fsdata *mydata, __u32 entry, __u32 entry_value)
 	}
 
 	/* Mark as dirty */
-	mydata->fat_dirty = 1;
+	switch (mydata->fatsize) {
+	case 32:
+		mark_fat_dirty(mydata, offset * 4, 4);
+		break;
+	case 16:
+		mark_fat_dirty(mydata, offset * 2, 2);
+		break;
+	case 12:
+		mark_fat_dirty(mydata, (offset * 3) / 4 * 2, 4);
+		break;
+	}
 
 	/* Set the actual entry */
 	switch (mydata->fatsize) {
@@ -27,6 +27,25 @@ static int fs_dev_part;
 static disk_partition_t fs_partition;
 static int fs_type = FS_TYPE_ANY;
 
+#if CONFIG_IS_ENABLED(FS_KEEP_MOUNT)
+/*
+ * The filesystem last opened, left mounted by fs_close() when its driver
+ * can keep it, so that the next command on the same partition skips the
+ * probe. It goes stale when its device is written or reinitialised.
+ */
+static struct {
+	bool kept;		/* mounted, between two commands */
+	bool stale;
+	int fstype;
+	int part;
+	int iftype;
+	int devnum;
+	int hwpart;
+	lbaint_t start;
+	lbaint_t size;
+} fs_mnt;
+#endif
+
 static inline int fs_probe_unsupported(struct blk_desc *fs_dev_desc,
 				      disk_partition_t *fs_partition)
 {
@@ -144,6 +163,17 @@ struct fstype_info {
 	int (*write)(const char *filename, void *buf, loff_t offset,
 		     loff_t len, loff_t *actwrite);
 	void (*close)(void);
+	/*
+	 * Optional: end a command but keep the filesystem mounted for
+	 * .reopen(). Return 0 if it was kept, otherwise it is closed.
+	 */
+	int (*keep)(void);
+	/*
+	 * Take back the mount left by .keep() for the same partition.
+	 * Return 0 on success; on failure the filesystem is probed again.
+	 */
+	int (*reopen)(struct blk_desc *fs_dev_desc,
+		      disk_partition_t *fs_partition);
 	int (*uuid)(char *uuid_str);
 	/*
 	 * Open a directory stream.  On success return 0 and directory
@@ -200,6 +230,8 @@ static struct fstype_info fstypes[] = {
 		.null_dev_desc_ok = false,
 		.probe = ext4fs_probe,
 		.close = ext4fs_close,
+		.keep = ext4fs_keep,
+		.reopen = ext4fs_reopen,
 		.ls = ext4fs_ls,
 		.exists = ext4fs_exists,
 		.size = ext4fs_size,
@@ -333,6 +365,67 @@ const char *fs_get_type_name(void)
 	return fs_get_info(fs_type)->name;
 }
 
+#if CONFIG_IS_ENABLED(FS_KEEP_MOUNT)
+/* record the filesystem just probed on fs_dev_desc/fs_partition */
+static void fs_opened(int fstype, int part)
+{
+	fs_type = fstype;
+	fs_dev_part = part;
+
+	if (!fs_dev_desc)
+		return;
+	fs_mnt.fstype = fstype;
+	fs_mnt.part = part;
+	fs_mnt.iftype = fs_dev_desc->if_type;
+	fs_mnt.devnum = fs_dev_desc->devnum;
+	fs_mnt.hwpart = fs_dev_desc->hwpart;
+	fs_mnt.start = fs_partition.start;
+	fs_mnt.size = fs_partition.size;
+	fs_mnt.stale = false;
+}
+
+/*
+ * Take back the mount kept by fs_close() if it is of the partition in
+ * fs_dev_desc/fs_partition, or close it so the caller can probe.
+ */
+static int fs_reopen(int fstype, int part)
+{
+	struct fstype_info *info;
+
+	if (!fs_mnt.kept)
+		return -1;
+
+	info = fs_get_info(fs_mnt.fstype);
+	fs_mnt.kept = false;
+	if (!fs_mnt.stale && fs_dev_desc &&
+	    (fstype == FS_TYPE_ANY || fstype == fs_mnt.fstype) &&
+	    fs_mnt.iftype == fs_dev_desc->if_type &&
+	    fs_mnt.devnum == fs_dev_desc->devnum &&
+	    fs_mnt.hwpart == fs_dev_desc->hwpart &&
+	    fs_mnt.start == fs_partition.start &&
+	    fs_mnt.size == fs_partition.size &&
+	    !info->reopen(fs_dev_desc, &fs_partition)) {
+		fs_type = fs_mnt.fstype;
+		fs_dev_part = part;
+		return 0;
+	}
+	info->close();
+
+	return -1;
+}
+#else
+static void fs_opened(int fstype, int part)
+{
+	fs_type = fstype;
+	fs_dev_part = part;
+}
+
+static inline int fs_reopen(int fstype, int part)
+{
+	return -1;
+}
+#endif
+
 int fs_set_blk_dev(const char *ifname, const char *dev_part_str, int fstype)
 {
 	struct fstype_info *info;
@@ -359,6 +452,9 @@ int fs_set_blk_dev(const char *ifname, const char *dev_part_str, int fstype)
 	if (part < 0)
 		return -1;
 
+	if (!fs_reopen(fstype, part))
+		return 0;
+
 	for (i = 0, info = fstypes; i < ARRAY_SIZE(fstypes); i++, info++) {
 		if (fstype != FS_TYPE_ANY && info->fstype != FS_TYPE_ANY &&
 				fstype != info->fstype)
@@ -368,8 +464,7 @@ int fs_set_blk_dev(const char *ifname, const char *dev_part_str, int fstype)
 			continue;
 
 		if (!info->probe(fs_dev_desc, &fs_partition)) {
-			fs_type = info->fstype;
-			fs_dev_part = part;
+			fs_opened(info->fstype, part);
 			return 0;
 		}
 	}
@@ -391,10 +486,12 @@ int fs_set_blk_dev_with_part(struct blk_desc *desc, int part)
 		return ret;
 	fs_dev_desc = desc;
 
+	if (!fs_reopen(FS_TYPE_ANY, part))
+		return 0;
+
 	for (i = 0, info = fstypes; i < ARRAY_SIZE(fstypes); i++, info++) {
 		if (!info->probe(fs_dev_desc, &fs_partition)) {
-			fs_type = info->fstype;
-			fs_dev_part = part;
+			fs_opened(info->fstype, part);
 			return 0;
 		}
 	}
@@ -406,11 +503,49 @@ void fs_close(void)
 {
 	struct fstype_info *info = fs_get_info(fs_type);
 
+#if CONFIG_IS_ENABLED(FS_KEEP_MOUNT)
+	if (info->keep && fs_dev_desc && !fs_mnt.stale && !info->keep()) {
+		fs_mnt.kept = true;
+		fs_type = FS_TYPE_ANY;
+		return;
+	}
+#endif
 	info->close();
 
 	fs_type = FS_TYPE_ANY;
 }
 
+#if CONFIG_IS_ENABLED(FS_KEEP_MOUNT)
+void fs_umount(void)
+{
+	if (fs_mnt.kept) {
+		fs_get_info(fs_mnt.fstype)->close();
+		fs_mnt.kept = false;
+	}
+}
+
+void fs_invalidate(int iftype, int devnum)
+{
+	if (fs_mnt.iftype == iftype && fs_mnt.devnum == devnum)
+		fs_mnt.stale = true;
+}
+
+int fs_get_mount(struct fs_mount_info *info)
+{
+	if (!fs_mnt.kept)
+		return -ENOENT;
+
+	info->name = fs_get_info(fs_mnt.fstype)->name;
+	info->iftype = fs_mnt.iftype;
+	info->devnum = fs_mnt.devnum;
+	info->hwpart = fs_mnt.hwpart;
+	info->part = fs_mnt.part;
+	info->stale = fs_mnt.stale;
+
+	return 0;
+}
+#endif
+
 int fs_uuid(char *uuid_str)
 {
 	struct fstype_info *info = fs_get_info(fs_type);
@@ -511,9 +646,11 @@ static int _fs_read(const char *filename, ulong addr, loff_t offset, loff_t len,
 	 * We don't actually know how many bytes are being read, since len==0
 	 * means read the whole file.
 	 */
+	bootstage_start(BOOTSTAGE_ID_ACCUM_FS_READ, "fs_read");
 	buf = map_sysmem(addr, len);
 	ret = info->read(filename, buf, offset, len, actread);
 	unmap_sysmem(buf);
+	bootstage_accum(BOOTSTAGE_ID_ACCUM_FS_READ);
 
 	/* If we requested a specific number of bytes, check we got it */
 	if (ret == 0 && len && *actread != len)
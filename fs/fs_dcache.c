@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Directory entry cache shared by the filesystem drivers
+ *
+ * Every fs command opens the filesystem again and resolves its path from
+ * the root, so a boot script probing for a list of files reads the same
+ * directories over and over. The cache remembers the result of each
+ * lookup, names that were not found included, for the last few
+ * filesystems opened. It survives fs_close() and is dropped when the
+ * filesystem changes: a different superblock at mount time, or a write
+ * or reinitialisation of the block device.
+ *
+ * Entries live in a set-associative table of FS_DCACHE_WAYS entries per
+ * set, indexed by a hash of (filesystem, directory, name). The least
+ * recently used entry of a set is replaced.
+ */
+#include <common.h>
+#include <blk.h>
+#include <fs_dcache.h>
+#include <u-boot/crc.h>
+
+#define FS_DCACHE_WAYS		4
+#define FS_DCACHE_SETS		(CONFIG_FS_DCACHE_ENTRIES / FS_DCACHE_WAYS)
+#define FS_DCACHE_MOUNTS	4
+#define FS_DCACHE_NAME_LEN	46
+
+struct fs_dcache_entry {
+	u64 dir;
+	u64 ino;
+	ulong used;		/* LRU stamp, 0 if the entry is free */
+	int type;
+	u8 mount;		/* index in mounts[] */
+	u8 len;
+	char name[FS_DCACHE_NAME_LEN];
+};
+
+struct fs_dcache_mount {
+	struct fs_dcache_mount_info info;
+	u32 id;			/* crc32 of the identification data */
+	ulong used;		/* LRU stamp, 0 if the slot is free */
+};
+
+static struct fs_dcache_entry entries[FS_DCACHE_SETS * FS_DCACHE_WAYS];
+static struct fs_dcache_mount mounts[FS_DCACHE_MOUNTS];
+static struct fs_dcache_mount *cur;
+static ulong lru_clock;
+
+static struct fs_dcache_stats _stats = {
+	.max_entries = FS_DCACHE_SETS * FS_DCACHE_WAYS,
+};
+
+static void dcache_drop(struct fs_dcache_mount *mnt)
+{
+	struct fs_dcache_entry *e;
+	int idx = mnt - mounts;
+
+	for (e = entries; e < entries + ARRAY_SIZE(entries); e++) {
+		if (e->used && e->mount == idx) {
+			e->used = 0;
+			_stats.entries--;
+		}
+	}
+	mnt->info.entries = 0;
+}
+
+static struct fs_dcache_entry *dcache_set(u64 dir, const char *name, int len)
+{
+	u32 h = crc32(cur - mounts, (const u8 *)&dir, sizeof(dir));
+
+	h = crc32(h, (const u8 *)name, len);
+
+	return &entries[(h % FS_DCACHE_SETS) * FS_DCACHE_WAYS];
+}
+
+static struct fs_dcache_entry *dcache_find(u64 dir, const char *name, int len)
+{
+	struct fs_dcache_entry *set = dcache_set(dir, name, len);
+	int i;
+
+	for (i = 0; i < FS_DCACHE_WAYS; i++)
+		if (set[i].used && set[i].mount == cur - mounts &&
+		    set[i].dir == dir && set[i].len == len &&
+		    !memcmp(set[i].name, name, len))
+			return &set[i];
+
+	return NULL;
+}
+
+void fs_dcache_mount(struct blk_desc *dev_desc, lbaint_t start,
+		     const void *id, size_t len)
+{
+	struct fs_dcache_mount *mnt, *slot = NULL;
+	u32 crc = crc32(0, id, len);
+
+	for (mnt = mounts; mnt < mounts + FS_DCACHE_MOUNTS; mnt++) {
+		if (mnt->used && mnt->info.iftype == dev_desc->if_type &&
+		    mnt->info.devnum == dev_desc->devnum &&
+		    mnt->info.hwpart == dev_desc->hwpart &&
+		    mnt->info.start == start) {
+			slot = mnt;
+			break;
+		}
+		if (!slot || mnt->used < slot->used)
+			slot = mnt;
+	}
+
+	if (!slot->used || slot->id != crc) {
+		debug("dcache: new mount of %s %d:%d at " LBAF "\n",
+		      blk_get_if_type_name(dev_desc->if_type),
+		      dev_desc->devnum, dev_desc->hwpart, start);
+		dcache_drop(slot);
+		slot->info.iftype = dev_desc->if_type;
+		slot->info.devnum = dev_desc->devnum;
+		slot->info.hwpart = dev_desc->hwpart;
+		slot->info.start = start;
+		slot->id = crc;
+	}
+	slot->used = ++lru_clock;
+	cur = slot;
+}
+
+void fs_dcache_umount(void)
+{
+	cur = NULL;
+}
+
+int fs_dcache_lookup(u64 dir, const char *name, int len, u64 *ino, int *type)
+{
+	struct fs_dcache_entry *e;
+
+	if (!cur)
+		return 0;
+
+	e = len <= FS_DCACHE_NAME_LEN ? dcache_find(dir, name, len) : NULL;
+	if (!e) {
+		_stats.misses++;
+		return 0;
+	}
+
+	_stats.hits++;
+	e->used = ++lru_clock;
+	*ino = e->ino;
+	*type = e->type;
+
+	return 1;
+}
+
+void fs_dcache_add(u64 dir, const char *name, int len, u64 ino, int type)
+{
+	struct fs_dcache_entry *e, *set;
+	int i;
+
+	if (!cur || len > FS_DCACHE_NAME_LEN)
+		return;
+
+	e = dcache_find(dir, name, len);
+	if (!e) {
+		set = dcache_set(dir, name, len);
+		e = set;
+		for (i = 1; i < FS_DCACHE_WAYS; i++)
+			if (set[i].used < e->used)
+				e = &set[i];
+		if (e->used)
+			mounts[e->mount].info.entries--;
+		else
+			_stats.entries++;
+		cur->info.entries++;
+		e->mount = cur - mounts;
+		e->dir = dir;
+		e->len = len;
+		memcpy(e->name, name, len);
+	}
+	e->used = ++lru_clock;
+	e->ino = ino;
+	e->type = type;
+}
+
+void fs_dcache_invalidate(int iftype, int devnum)
+{
+	struct fs_dcache_mount *mnt;
+
+	for (mnt = mounts; mnt < mounts + FS_DCACHE_MOUNTS; mnt++) {
+		if (mnt->used && mnt->info.iftype == iftype &&
+		    mnt->info.devnum == devnum) {
+			dcache_drop(mnt);
+			mnt->used = 0;
+			if (mnt == cur)
+				cur = NULL;
+		}
+	}
+}
+
+void fs_dcache_flush(void)
+{
+	memset(entries, 0, sizeof(entries));
+	memset(mounts, 0, sizeof(mounts));
+	cur = NULL;
+	_stats.entries = 0;
+}
+
+void fs_dcache_stats(struct fs_dcache_stats *stats)
+{
+	memcpy(stats, &_stats, sizeof(*stats));
+	_stats.hits = 0;
+	_stats.misses = 0;
+}
+
+int fs_dcache_mount_info(int idx, struct fs_dcache_mount_info *info)
+{
+	int i;
+
+	for (i = 0; i < FS_DCACHE_MOUNTS; i++) {
+		if (!mounts[i].used || idx--)
+			continue;
+		memcpy(info, &mounts[i].info, sizeof(*info));
+		info->current = &mounts[i] == cur;
+		return 0;
+	}
+
+	return -ENOENT;
+}
@@ -112,38 +112,50 @@ struct blk_desc {
 #define PAD_TO_BLOCKSIZE(size, blk_desc) \
 	(PAD_SIZE(size, blk_desc->blksz))
 
-#if CONFIG_IS_ENABLED(BLOCK_CACHE)
 /**
- * blkcache_read() - attempt to read a set of blocks from cache
- *
- * @param iftype - IF_TYPE_x for type of device
- * @param dev - device index of particular type
- * @param start - starting block number
- * @param blkcnt - number of blocks to read
- * @param blksz - size in bytes of each block
- * @param buf - buffer to contain cached data
+ * struct blk_req - a block read running in the background
  *
- * @return - '1' if block returned from cache, '0' otherwise.
+ * @desc:	Device being read
+ * @start:	First block to read
+ * @blkcnt:	Number of blocks to read
+ * @buffer:	Destination of the data
+ * @done:	Blocks read so far
+ * @cur:	Blocks in the transfer running on the device
+ * @status:	-EBUSY while the read runs, then 0 or -ve error
  */
-int blkcache_read(int iftype, int dev,
-		  lbaint_t start, lbaint_t blkcnt,
-		  unsigned long blksz, void *buffer);
+struct blk_req {
+	struct blk_desc *desc;
+	lbaint_t start;
+	lbaint_t blkcnt;
+	void *buffer;
+	lbaint_t done;
+	lbaint_t cur;
+	int status;
+};
 
+/* reads blocks from the device, like blk_desc->block_read() */
+typedef ulong (*blkcache_read_t)(struct blk_desc *block_dev, lbaint_t start,
+				 lbaint_t blkcnt, void *buffer);
+
+#if CONFIG_IS_ENABLED(BLOCK_CACHE)
 /**
- * blkcache_fill() - make data read from a block device available
- * to the block cache
+ * blkcache_dread() - read a set of blocks through the block cache
  *
- * @param iftype - IF_TYPE_x for type of device
- * @param dev - device index of particular type
+ * Blocks found in the cache are copied out. On a miss the read is widened
+ * to whole cache lines, and further ahead when the device is being read
+ * sequentially, and the result is kept in the cache. Reads larger than the
+ * readahead limit go straight to the device.
+ *
+ * @param block_dev - block device to read from
  * @param start - starting block number
- * @param blkcnt - number of blocks available
- * @param blksz - size in bytes of each block
- * @param buf - buffer containing data to cache
+ * @param blkcnt - number of blocks to read
+ * @param buffer - buffer to contain the data
+ * @param read - function doing the device read
  *
+ * @return - number of blocks read, or the value returned by read()
  */
-void blkcache_fill(int iftype, int dev,
-		   lbaint_t start, lbaint_t blkcnt,
-		   unsigned long blksz, void const *buffer);
+ulong blkcache_dread(struct blk_desc *block_dev, lbaint_t start,
+		     lbaint_t blkcnt, void *buffer, blkcache_read_t read);
 
 /**
  * blkcache_invalidate() - discard the cache for a set of blocks
@@ -157,10 +169,14 @@ void blkcache_invalidate(int iftype, int dev);
 /**
  * blkcache_configure() - configure block cache
  *
- * @param blocks - maximum blocks per entry
- * @param entries - maximum entries in cache
+ * The cache is emptied and its memory reallocated.
+ *
+ * @param size - cache size in bytes, 0 to disable the cache
+ * @param readahead - maximum readahead in bytes
+ *
+ * @return - 0 on success, -ve error number otherwise
  */
-void blkcache_configure(unsigned blocks, unsigned entries);
+int blkcache_configure(unsigned long size, unsigned long readahead);
 
 /*
  * statistics of the block cache
@@ -168,9 +184,23 @@ void blkcache_configure(unsigned blocks, unsigned entries);
 struct block_cache_stats {
 	unsigned hits;
 	unsigned misses;
-	unsigned entries; /* current entry count */
-	unsigned max_blocks_per_entry;
-	unsigned max_entries;
+	unsigned entries; /* lines in use */
+	unsigned max_entries; /* lines allocated */
+	unsigned long size; /* configured size in bytes */
+	unsigned line_size;
+	unsigned ways;
+	unsigned long readahead; /* maximum readahead in bytes */
+};
+
+/*
+ * per-device statistics of the block cache
+ */
+struct block_cache_dev_stats {
+	int iftype;
+	int devnum;
+	unsigned hits;
+	unsigned misses;
+	unsigned long readahead; /* blocks read ahead of requests */
 };
 
 /**
@@ -180,19 +210,25 @@ struct block_cache_stats {
  */
 void blkcache_stats(struct block_cache_stats *stats);
 
+/**
+ * blkcache_dev_stats() - return statistics of a device and reset
+ *
+ * @param idx - index of the device in the cache, from 0
+ * @param stats - statistics are copied here
+ *
+ * @return - 0 on success, -ENOENT past the last device
+ */
+int blkcache_dev_stats(int idx, struct block_cache_dev_stats *stats);
+
 #else
 
-static inline int blkcache_read(int iftype, int dev,
-				lbaint_t start, lbaint_t blkcnt,
-				unsigned long blksz, void *buffer)
+static inline ulong blkcache_dread(struct blk_desc *block_dev,
+				   lbaint_t start, lbaint_t blkcnt,
+				   void *buffer, blkcache_read_t read)
 {
-	return 0;
+	return read(block_dev, start, blkcnt, buffer);
 }
 
-static inline void blkcache_fill(int iftype, int dev,
-				 lbaint_t start, lbaint_t blkcnt,
-				 unsigned long blksz, void const *buffer) {}
-
 static inline void blkcache_invalidate(int iftype, int dev) {}
 
 #endif
@@ -258,6 +294,43 @@ struct blk_ops {
 	 * @return 0 if OK, -ve on error
 	 */
 	int (*select_hwpart)(struct udevice *dev, int hwpart);
+
+	/**
+	 * write_cache() - open or close a write cache session
+	 *
+	 * Devices with a volatile write cache may keep the data written
+	 * while a session is open, and write it back when the last session
+	 * is closed. Bulk writers open a session for the whole operation.
+	 * This operation is optional.
+	 *
+	 * @dev:	Device to update
+	 * @enable:	true to open a session, false to close one
+	 * @return 0 if OK, -ve on error
+	 */
+	int (*write_cache)(struct udevice *dev, bool enable);
+
+	/**
+	 * read_submit() - start a read and return while it runs
+	 *
+	 * This operation is optional. A device which cannot run a
+	 * particular read in the background returns -ENOSYS and the read is
+	 * done synchronously instead.
+	 *
+	 * @dev:	Device to read from
+	 * @req:	Request to start; start, blkcnt and buffer are set
+	 * @return 0 if the read was started, -ve on error
+	 */
+	int (*read_submit)(struct udevice *dev, struct blk_req *req);
+
+	/**
+	 * read_poll() - check on a read started by read_submit()
+	 *
+	 * @dev:	Device being read
+	 * @req:	Request to check
+	 * @return -EBUSY while the read runs, 0 when it is complete, other
+	 * -ve value on error. The value is also left in @req->status.
+	 */
+	int (*read_poll)(struct udevice *dev, struct blk_req *req);
 };
 
 #define blk_get_ops(dev)	((struct blk_ops *)(dev)->driver->ops)
@@ -275,6 +348,53 @@ unsigned long blk_dwrite(struct blk_desc *block_dev, lbaint_t start,
 unsigned long blk_derase(struct blk_desc *block_dev, lbaint_t start,
 			 lbaint_t blkcnt);
 
+/**
+ * blk_dwrite_cache() - open or close a write cache session on a device
+ *
+ * See write_cache() in struct blk_ops. Devices without a write cache
+ * ignore this.
+ *
+ * @block_dev:	Block device descriptor
+ * @enable:	true to open a session, false to close one
+ * @return 0 if OK, -ve on error
+ */
+int blk_dwrite_cache(struct blk_desc *block_dev, bool enable);
+
+/**
+ * blk_dread_submit() - start reading blocks in the background
+ *
+ * The caller can do other work while the data arrives, then call
+ * blk_req_poll() or blk_req_wait(). Only one read runs at a time on a
+ * device: any other access to it waits for the read to complete first.
+ * Devices which cannot read in the background complete the read before
+ * returning. Reads do not go through the block cache.
+ *
+ * @block_dev:	Block device descriptor
+ * @start:	First block to read
+ * @blkcnt:	Number of blocks to read
+ * @buffer:	Destination buffer, which must stay valid until completion
+ * @req:	Request to fill in, owned by the caller
+ * @return 0 if the read was started or done, -ve on error
+ */
+int blk_dread_submit(struct blk_desc *block_dev, lbaint_t start,
+		     lbaint_t blkcnt, void *buffer, struct blk_req *req);
+
+/**
+ * blk_req_poll() - check whether a background read is complete
+ *
+ * @req:	Request started by blk_dread_submit()
+ * @return -EBUSY while the read runs, 0 when complete, other -ve on error
+ */
+int blk_req_poll(struct blk_req *req);
+
+/**
+ * blk_req_wait() - wait for a background read to complete
+ *
+ * @req:	Request started by blk_dread_submit()
+ * @return number of blocks read, or -ve on error
+ */
+long blk_req_wait(struct blk_req *req);
+
 /**
  * blk_find_device() - Find a block device
  *
@@ -428,22 +548,13 @@ struct blk_desc *blk_get_by_device(struct udevice *dev);
 static inline ulong blk_dread(struct blk_desc *block_dev, lbaint_t start,
 			      lbaint_t blkcnt, void *buffer)
 {
-	ulong blks_read;
-	if (blkcache_read(block_dev->if_type, block_dev->devnum,
-			  start, blkcnt, block_dev->blksz, buffer))
-		return blkcnt;
-
 	/*
 	 * We could check if block_read is NULL and return -ENOSYS. But this
 	 * bloats the code slightly (cause some board to fail to build), and
 	 * it would be an error to try an operation that does not exist.
 	 */
-	blks_read = block_dev->block_read(block_dev, start, blkcnt, buffer);
-	if (blks_read == blkcnt)
-		blkcache_fill(block_dev->if_type, block_dev->devnum,
-			      start, blkcnt, block_dev->blksz, buffer);
-
-	return blks_read;
+	return blkcache_dread(block_dev, start, blkcnt, buffer,
+			      block_dev->block_read);
 }
 
 static inline ulong blk_dwrite(struct blk_desc *block_dev, lbaint_t start,
@@ -460,6 +571,33 @@ static inline ulong blk_derase(struct blk_desc *block_dev, lbaint_t start,
 	return block_dev->block_erase(block_dev, start, blkcnt);
 }
 
+static inline int blk_dwrite_cache(struct blk_desc *block_dev, bool enable)
+{
+	return 0;
+}
+
+static inline int blk_dread_submit(struct blk_desc *block_dev,
+				   lbaint_t start, lbaint_t blkcnt,
+				   void *buffer, struct blk_req *req)
+{
+	req->desc = block_dev;
+	req->blkcnt = blkcnt;
+	req->done = blk_dread(block_dev, start, blkcnt, buffer);
+	req->status = req->done == blkcnt ? 0 : -EIO;
+
+	return req->status;
+}
+
+static inline int blk_req_poll(struct blk_req *req)
+{
+	return req->status;
+}
+
+static inline long blk_req_wait(struct blk_req *req)
+{
+	return req->status ? req->status : req->done;
+}
+
 /**
  * struct blk_driver - Driver for block interface types
  *
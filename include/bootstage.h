@@ -202,6 +202,10 @@ enum bootstage_id {
 	BOOTSTATE_ID_ACCUM_DM_SPL,
 	BOOTSTATE_ID_ACCUM_DM_F,
 	BOOTSTATE_ID_ACCUM_DM_R,
+	BOOTSTAGE_ID_ACCUM_ENV,
+	BOOTSTAGE_ID_ACCUM_MMC,
+	BOOTSTAGE_ID_ACCUM_FS_READ,
+	BOOTSTAGE_ID_ACCUM_VERIFY,
 
 	/* a few spare for the user, from here */
 	BOOTSTAGE_ID_USER,
@@ -340,6 +344,26 @@ int bootstage_stash(void *base, int size);
  */
 int bootstage_unstash(const void *base, int size);
 
+/**
+ * bootstage_stash_default() - Stash bootstage data for the next phase
+ *
+ * The data goes into the bloblist if there is one, otherwise to
+ * CONFIG_BOOTSTAGE_STASH_ADDR. This must be called before bloblist_finish().
+ *
+ * @return 0 if OK, -ENOSPC if there is no room, other -ve on error
+ */
+int bootstage_stash_default(void);
+
+/**
+ * bootstage_unstash_default() - Read bootstage data left by an earlier phase
+ *
+ * This is the counterpart of bootstage_stash_default(), so the bloblist (if
+ * used) must already be set up.
+ *
+ * @return 0 if OK, -ENOENT if no data was found, other -ve on error
+ */
+int bootstage_unstash_default(void);
+
 /**
  * bootstage_get_size() - Get the size of the bootstage data
  *
@@ -416,6 +440,16 @@ static inline int bootstage_unstash(const void *base, int size)
 	return 0;	/* Pretend to succeed */
 }
 
+static inline int bootstage_stash_default(void)
+{
+	return 0;	/* Pretend to succeed */
+}
+
+static inline int bootstage_unstash_default(void)
+{
+	return 0;	/* Pretend to succeed */
+}
+
 static inline int bootstage_get_size(void)
 {
 	return 0;
@@ -9,6 +9,7 @@
 #define __CPU_LEGACY_H
 
 #include <linux/types.h>
+#include <linux/dma-direction.h>
 
 /*
  * Multicore arch functions
@@ -69,6 +70,12 @@ void invalidate_dcache_range(unsigned long start, unsigned long stop);
 void invalidate_dcache_all(void);
 void invalidate_icache_all(void);
 
+/* lib/dma_sync.c, may be overridden by the architecture */
+void dma_sync_range_for_device(unsigned long addr, size_t len,
+			       enum dma_data_direction dir);
+void dma_sync_range_for_cpu(unsigned long addr, size_t len,
+			    enum dma_data_direction dir);
+
 enum {
 	/* Disable caches (else flush caches but leave them active) */
 	CBL_DISABLE_CACHES		= 1 << 0,
@@ -0,0 +1,66 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ */
+
+#ifndef __DECOMP_PARALLEL_H
+#define __DECOMP_PARALLEL_H
+
+#include <linux/types.h>
+
+/**
+ * struct decomp_chunk - an independently decodable piece of compressed data
+ *
+ * @src:	Compressed data
+ * @srcn:	Length of compressed data
+ * @dst:	Where the data decompresses to
+ * @dstn:	Expected length of the decompressed data
+ * @ret:	Length actually decompressed, or -ve error, set by the decoder
+ */
+struct decomp_chunk {
+	const void *src;
+	size_t srcn;
+	void *dst;
+	size_t dstn;
+	long ret;
+};
+
+/**
+ * decomp_parallel() - Decompress independent chunks on all CPUs
+ *
+ * Chunks are spread over the harts, balanced by decompressed length, and
+ * @decode is called once per chunk on the hart that owns it. Each hart
+ * gets its own decoder context; when fewer than the number of harts are
+ * given, only that many harts are used. The decoder must not call
+ * malloc() or any driver, see smp_parallel_run().
+ *
+ * @chunks:	Chunks to decompress, ret is filled in for each one
+ * @count:	Number of chunks
+ * @decode:	Decoder, returning the decompressed length or -ve error
+ * @ctxs:	Per-hart decoder contexts, or NULL if the decoder needs none
+ * @nctx:	Number of contexts in @ctxs, or maximum harts to use
+ * @return number of harts the chunks were spread across
+ */
+int decomp_parallel(struct decomp_chunk *chunks, int count,
+		    long (*decode)(void *ctx, struct decomp_chunk *chunk),
+		    void **ctxs, int nctx);
+
+/**
+ * decomp_parallel_safe() - Check chunks can be decoded out of order
+ *
+ * Compressed data may be placed at the end of its own output buffer and
+ * decompressed in place; that only works front to back on one CPU.
+ *
+ * @src:	Compressed data
+ * @srcn:	Length of compressed data
+ * @dst:	Output buffer
+ * @dstn:	Size of output buffer
+ * @return true if input and output do not overlap
+ */
+static inline bool decomp_parallel_safe(const void *src, size_t srcn,
+					const void *dst, size_t dstn)
+{
+	return src + srcn <= dst || dst + dstn <= src;
+}
+
+#endif
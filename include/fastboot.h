@@ -44,6 +44,9 @@ enum {
 #if CONFIG_IS_ENABLED(FASTBOOT_CMD_OEM_BOOTBUS)
 	FASTBOOT_COMMAND_OEM_BOOTBUS,
 #endif
+#if CONFIG_IS_ENABLED(FASTBOOT_MMC_STREAM)
+	FASTBOOT_COMMAND_OEM_STREAM,
+#endif
 #if CONFIG_IS_ENABLED(FASTBOOT_UUU_SUPPORT)
 	FASTBOOT_COMMAND_ACMD,
 	FASTBOOT_COMMAND_UCMD,
@@ -151,6 +154,20 @@ int fastboot_handle_command(char *cmd_string, char *response);
  */
 u32 fastboot_data_remaining(void);
 
+/**
+ * fastboot_data_buffer() - Return where download data can be received
+ *
+ * @offset: Offset from the start of the download buffer
+ * @len: Number of bytes to receive there
+ *
+ * Lets a transport receive data straight into the download buffer, which
+ * fastboot_data_download() then uses without copying.
+ *
+ * Return: Pointer into the download buffer, or NULL if @len bytes at
+ * @offset do not fit
+ */
+void *fastboot_data_buffer(u32 offset, u32 len);
+
 /**
  * fastboot_data_download() - Copy image data to fastboot_buf_addr.
  *
@@ -158,13 +175,21 @@ u32 fastboot_data_remaining(void);
  * @fastboot_data_len: Length of received fastboot data
  * @response: Pointer to fastboot response buffer
  *
- * Copies image data from fastboot_data to fastboot_buf_addr. Writes to
- * response. fastboot_bytes_received is updated to indicate the number
- * of bytes that have been transferred.
+ * Copies image data from fastboot_data to fastboot_buf_addr, unless it
+ * was received in place already. Writes to response.
+ * fastboot_bytes_received is updated to indicate the number of bytes that
+ * have been transferred.
  */
 void fastboot_data_download(const void *fastboot_data,
 			    unsigned int fastboot_data_len, char *response);
 
+/**
+ * fastboot_data_abort() - Abandon the current transfer
+ *
+ * Called by a transport when a download fails or is cut short.
+ */
+void fastboot_data_abort(void);
+
 /**
  * fastboot_data_complete() - Mark current transfer complete
  *
@@ -23,7 +23,17 @@
 #define DIRENTSPERCLUST	((mydata->clust_size * mydata->sect_size) / \
 			 sizeof(dir_entry))
 
+/*
+ * Sectors of the FAT held in memory at once. Reading a file follows its
+ * cluster chain through this window, so it is large enough to cover the
+ * chain of a big file in a few reads. It is a multiple of 3 so that no
+ * FAT12 entry straddles two windows.
+ */
+#ifdef CONFIG_SPL_BUILD
 #define FATBUFBLOCKS	6
+#else
+#define FATBUFBLOCKS	96
+#endif
 #define FATBUFSIZE	(mydata->sect_size * FATBUFBLOCKS)
 #define FAT12BUFSIZE	((FATBUFSIZE*2)/3)
 #define FAT16BUFSIZE	(FATBUFSIZE/2)
@@ -166,6 +176,8 @@ typedef struct {
 	__u32	fatlength;	/* Length of FAT in sectors */
 	__u16	fat_sect;	/* Starting sector of the FAT */
 	__u8	fat_dirty;      /* Set if fatbuf has been modified */
+	__u32	fat_dirty_lo;	/* First modified sector of fatbuf */
+	__u32	fat_dirty_hi;	/* Last modified sector of fatbuf */
 	__u32	rootdir_sect;	/* Start sector of root directory */
 	__u16	sect_size;	/* Size of sectors in bytes */
 	__u16	clust_size;	/* Size of clusters in sectors */
@@ -35,4 +35,46 @@ void fastboot_mmc_flash_write(const char *cmd, void *download_buffer,
  * @response: Pointer to fastboot response buffer
  */
 void fastboot_mmc_erase(const char *cmd, char *response);
+
+/**
+ * fastboot_mmc_stream_arm() - Stream the next download to a partition
+ *
+ * @part_name: Named partition to write the next download to
+ * @response: Pointer to fastboot response buffer
+ */
+void fastboot_mmc_stream_arm(const char *part_name, char *response);
+
+/**
+ * fastboot_mmc_stream_begin() - A download is starting
+ *
+ * @download_bytes: Size of the download
+ */
+void fastboot_mmc_stream_begin(u32 download_bytes);
+
+/**
+ * fastboot_mmc_stream_abort() - The current download was abandoned
+ *
+ * Stops streaming and closes the write cache session if one is open.
+ */
+void fastboot_mmc_stream_abort(void);
+
+/**
+ * fastboot_mmc_stream_data() - Write out newly downloaded data
+ *
+ * @download_buffer: Pointer to the download buffer
+ * @received: Bytes received so far
+ * @expected: Size of the download
+ */
+void fastboot_mmc_stream_data(void *download_buffer, u32 received,
+			      u32 expected);
+
+/**
+ * fastboot_mmc_stream_flash() - Complete a flash command for a streamed image
+ *
+ * @cmd: Named partition to write image to
+ * @response: Pointer to fastboot response buffer
+ *
+ * Return: true if the last download was already written to the partition
+ */
+bool fastboot_mmc_stream_flash(const char *cmd, char *response);
 #endif
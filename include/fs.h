@@ -46,9 +46,54 @@ int fs_set_blk_dev_with_part(struct blk_desc *desc, int part);
  * Many file functions implicitly call fs_close(), e.g. fs_closedir(),
  * fs_exist(), fs_ln(), fs_ls(), fs_mkdir(), fs_read(), fs_size(), fs_write(),
  * fs_unlink().
+ *
+ * With CONFIG_FS_KEEP_MOUNT, filesystems that support it stay mounted
+ * until the next fs_set_blk_dev() for another partition, fs_umount() or
+ * a write to their device.
  */
 void fs_close(void);
 
+/*
+ * a filesystem kept mounted between commands
+ */
+struct fs_mount_info {
+	const char *name;	/* filesystem type */
+	int iftype;
+	int devnum;
+	int hwpart;
+	int part;
+	bool stale;		/* its device was written since */
+};
+
+#if CONFIG_IS_ENABLED(FS_KEEP_MOUNT)
+/**
+ * fs_invalidate() - stop keeping a filesystem of a device mounted
+ *
+ * Called when the device is written or (re)initialised. The filesystem
+ * is closed at the end of the command using it, or when the next one
+ * starts.
+ *
+ * @iftype: IF_TYPE_x for type of device
+ * @devnum: device index of particular type
+ */
+void fs_invalidate(int iftype, int devnum);
+#else
+static inline void fs_invalidate(int iftype, int devnum) {}
+#endif
+
+/**
+ * fs_umount() - close the filesystem kept mounted by fs_close(), if any
+ */
+void fs_umount(void);
+
+/**
+ * fs_get_mount() - return the filesystem kept mounted by fs_close()
+ *
+ * @info: filled in with the filesystem and its partition
+ * @return 0 on success, -ENOENT if no filesystem is kept mounted
+ */
+int fs_get_mount(struct fs_mount_info *info);
+
 /**
  * fs_get_type() - Get type of current filesystem
  *
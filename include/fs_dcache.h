@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * Directory entry cache shared by the filesystem drivers
+ */
+#ifndef _FS_DCACHE_H
+#define _FS_DCACHE_H
+
+#include <part.h>
+
+/* type of a cached name that does not exist in its directory */
+#define FS_DCACHE_ABSENT	(-1)
+
+/*
+ * statistics of the directory entry cache
+ */
+struct fs_dcache_stats {
+	unsigned hits;
+	unsigned misses;
+	unsigned entries;	/* entries in use */
+	unsigned max_entries;
+};
+
+/*
+ * a filesystem the cache holds entries for
+ */
+struct fs_dcache_mount_info {
+	int iftype;
+	int devnum;
+	int hwpart;
+	lbaint_t start;		/* first block of the partition */
+	unsigned entries;
+	bool current;		/* the filesystem opened last */
+};
+
+#if CONFIG_IS_ENABLED(FS_DCACHE)
+/**
+ * fs_dcache_mount() - select the filesystem to look names up in
+ *
+ * The filesystem is identified by its block device and partition, and
+ * @id is data read when mounting it, such as the superblock. Entries
+ * cached from an earlier mount of the partition are kept when @id is
+ * unchanged, and dropped otherwise.
+ *
+ * @dev_desc: block device holding the filesystem
+ * @start: first block of the partition
+ * @id: filesystem identification
+ * @len: length of @id in bytes
+ */
+void fs_dcache_mount(struct blk_desc *dev_desc, lbaint_t start,
+		     const void *id, size_t len);
+
+/**
+ * fs_dcache_umount() - stop caching for the current filesystem
+ *
+ * The entries are kept for the next fs_dcache_mount() of the partition.
+ */
+void fs_dcache_umount(void);
+
+/**
+ * fs_dcache_lookup() - look a name up in a directory
+ *
+ * @dir: directory, as an inode or cluster number
+ * @name: name of the entry, need not be zero terminated
+ * @len: length of @name
+ * @ino: set to the inode or cluster number of the entry
+ * @type: set to the type of the entry, FS_DCACHE_ABSENT if the directory
+ *	has no such entry
+ * @return 1 if the name is cached, 0 otherwise
+ */
+int fs_dcache_lookup(u64 dir, const char *name, int len, u64 *ino, int *type);
+
+/**
+ * fs_dcache_add() - cache the result of a directory lookup
+ *
+ * Names too long for the cache are ignored.
+ *
+ * @dir: directory, as an inode or cluster number
+ * @name: name of the entry, need not be zero terminated
+ * @len: length of @name
+ * @ino: inode or cluster number of the entry
+ * @type: type of the entry, FS_DCACHE_ABSENT if there is none
+ */
+void fs_dcache_add(u64 dir, const char *name, int len, u64 ino, int type);
+
+/**
+ * fs_dcache_invalidate() - drop the entries of filesystems on a device
+ *
+ * Called when the device is written or (re)initialised.
+ *
+ * @iftype: IF_TYPE_x for type of device
+ * @devnum: device index of particular type
+ */
+void fs_dcache_invalidate(int iftype, int devnum);
+
+/**
+ * fs_dcache_flush() - drop all entries
+ */
+void fs_dcache_flush(void);
+
+/**
+ * fs_dcache_stats() - return statistics and reset
+ *
+ * @stats: statistics are copied here
+ */
+void fs_dcache_stats(struct fs_dcache_stats *stats);
+
+/**
+ * fs_dcache_mount_info() - return the state of a cached filesystem
+ *
+ * @idx: index of the filesystem in the cache, from 0
+ * @info: filled in with the filesystem state
+ * @return 0 on success, -ENOENT past the last filesystem
+ */
+int fs_dcache_mount_info(int idx, struct fs_dcache_mount_info *info);
+
+#else
+
+static inline void fs_dcache_mount(struct blk_desc *dev_desc, lbaint_t start,
+				   const void *id, size_t len) {}
+static inline void fs_dcache_umount(void) {}
+static inline int fs_dcache_lookup(u64 dir, const char *name, int len,
+				   u64 *ino, int *type)
+{
+	return 0;
+}
+
+static inline void fs_dcache_add(u64 dir, const char *name, int len, u64 ino,
+				 int type) {}
+static inline void fs_dcache_invalidate(int iftype, int devnum) {}
+static inline void fs_dcache_flush(void) {}
+
+#endif
+
+#endif /* _FS_DCACHE_H */
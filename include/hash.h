@@ -15,6 +15,7 @@
 enum {
 	HASH_FLAG_VERIFY	= 1 << 0,	/* Enable verify mode */
 	HASH_FLAG_ENV		= 1 << 1,	/* Allow env vars */
+	HASH_FLAG_RATE		= 1 << 2,	/* Report throughput */
 };
 
 struct hash_algo {
@@ -73,6 +74,39 @@ struct hash_algo {
 };
 
 #ifndef USE_HOSTCC
+enum {
+	/*
+	 * The engine drives a single hardware unit, so it must only be used
+	 * from the boot CPU and never by hash_parallel()
+	 */
+	HASH_ENGINE_OFFLOAD	= 1 << 0,
+};
+
+/**
+ * struct hash_engine - an alternative implementation of a hash algorithm
+ *
+ * Engines are declared with U_BOOT_HASH_ENGINE(). hash_lookup_algo() and
+ * hash_progressive_lookup_algo() return the usable engine with the highest
+ * priority for an algorithm in preference to the built-in implementation.
+ * Engines with a priority of 0 or less are only used by 'hash bench'.
+ *
+ * @algo:	Implementation; algo.name is the algorithm it provides
+ * @driver:	Name of the engine, e.g. "light-sec"
+ * @priority:	Preference over the built-in implementation, higher wins
+ * @flags:	HASH_ENGINE_... flags
+ * @probe:	Optional; returns 0 if the engine can be used, else -ve
+ */
+struct hash_engine {
+	struct hash_algo algo;
+	const char *driver;
+	int priority;
+	unsigned int flags;
+	int (*probe)(struct hash_engine *engine);
+};
+
+#define U_BOOT_HASH_ENGINE(__name)					\
+	ll_entry_declare(struct hash_engine, __name, hash_engine)
+
 /**
  * hash_command: Process a hash command for a particular algorithm
  *
@@ -110,6 +144,50 @@ int hash_command(const char *algo_name, int flags, cmd_tbl_t *cmdtp, int flag,
 int hash_block(const char *algo_name, const void *data, unsigned int len,
 	       uint8_t *output, int *output_size);
 
+/**
+ * struct hash_job - one independent hash computed by hash_parallel()
+ *
+ * @algo_name:	Hash algorithm to use
+ * @data:	Data to hash
+ * @len:	Length of data to hash in bytes
+ * @output:	Place to put the hash value, large enough for the algorithm
+ */
+struct hash_job {
+	const char *algo_name;
+	const void *data;
+	unsigned int len;
+	uint8_t *output;
+};
+
+/**
+ * hash_parallel() - Hash several independent blocks at once
+ *
+ * Each job gives the same result as hash_block(). With HASH_PARALLEL the
+ * jobs are spread over all available CPUs, balanced by length; otherwise
+ * they are hashed one after the other.
+ *
+ * @jobs:	Blocks to hash
+ * @count:	Number of jobs
+ * @return 0 if ok, -ve on error: -EPROTONOSUPPORT for an unknown algorithm,
+ * -ENOMEM if out of memory, -EIO if hashing failed.
+ */
+int hash_parallel(struct hash_job *jobs, int count);
+
+/**
+ * hash_bench() - Time every implementation of an algorithm
+ *
+ * Hashes the same buffer with the built-in implementation and with each
+ * usable engine, printing the time taken and the rate for each and
+ * checking that they all agree.
+ *
+ * @algo_name:	Hash algorithm to benchmark
+ * @addr:	Address of the buffer
+ * @len:	Length of the buffer in bytes
+ * @return 0 if ok, -EPROTONOSUPPORT for an unknown algorithm, -EIO if the
+ * implementations disagree.
+ */
+int hash_bench(const char *algo_name, ulong addr, ulong len);
+
 #endif /* !USE_HOSTCC */
 
 /**
@@ -23,6 +23,17 @@ struct sparse_storage {
 				 lbaint_t blk,
 				 lbaint_t blkcnt);
 
+	/*
+	 * Optional: erase blkcnt blocks at blk, which is aligned to
+	 * erase_grp (a power of two). Erased blocks must read back as
+	 * erase_val, so FILL chunks of that value are erased, not written.
+	 */
+	lbaint_t	(*erase)(struct sparse_storage *info,
+				 lbaint_t blk,
+				 lbaint_t blkcnt);
+	lbaint_t	erase_grp;
+	uint32_t	erase_val;
+
 	void		(*mssg)(const char *str, char *response);
 };
 
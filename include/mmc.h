@@ -70,6 +70,7 @@
 #define MMC_CAP_NONREMOVABLE	BIT(14)
 #define MMC_CAP_NEEDS_POLL	BIT(15)
 #define MMC_CAP_CD_ACTIVE_HIGH  BIT(16)
+#define MMC_CAP_CMD23		BIT(17)
 
 #define MMC_MODE_8BIT		BIT(30)
 #define MMC_MODE_4BIT		BIT(29)
@@ -78,6 +79,7 @@
 
 
 #define SD_DATA_4BIT	0x00040000
+#define SD_SCR_CMD23_SUPPORT	0x00000002
 
 #define IS_SD(x)	((x)->version & SD_VERSION_SD)
 #define IS_MMC(x)	((x)->version & MMC_VERSION_MMC)
@@ -208,6 +210,8 @@ static inline bool mmc_is_tuning_cmd(uint cmdidx)
 /*
  * EXT_CSD fields
  */
+#define EXT_CSD_FLUSH_CACHE		32	/* W */
+#define EXT_CSD_CACHE_CTRL		33	/* R/W */
 #define EXT_CSD_ENH_START_ADDR		136	/* R/W */
 #define EXT_CSD_ENH_SIZE_MULT		140	/* R/W */
 #define EXT_CSD_GP_SIZE_MULT		143	/* R/W */
@@ -221,6 +225,7 @@ static inline bool mmc_is_tuning_cmd(uint cmdidx)
 #define EXT_CSD_WR_REL_SET		167	/* R/W */
 #define EXT_CSD_RPMB_MULT		168	/* RO */
 #define EXT_CSD_ERASE_GROUP_DEF		175	/* R/W */
+#define EXT_CSD_ERASED_MEM_CONT		181	/* RO */
 #define EXT_CSD_BOOT_BUS_WIDTH		177
 #define EXT_CSD_PART_CONF		179	/* R/W */
 #define EXT_CSD_BUS_WIDTH		183	/* R/W */
@@ -234,6 +239,7 @@ static inline bool mmc_is_tuning_cmd(uint cmdidx)
 #define EXT_CSD_HC_ERASE_GRP_SIZE	224	/* RO */
 #define EXT_CSD_BOOT_MULT		226	/* RO */
 #define EXT_CSD_GENERIC_CMD6_TIME       248     /* RO */
+#define EXT_CSD_CACHE_SIZE		249	/* RO, 4 bytes */
 #define EXT_CSD_BKOPS_SUPPORT		502	/* RO */
 
 /*
@@ -416,6 +422,33 @@ struct dm_mmc_ops {
 	int (*send_cmd)(struct udevice *dev, struct mmc_cmd *cmd,
 			struct mmc_data *data);
 
+#if CONFIG_IS_ENABLED(BLK_ASYNC)
+	/**
+	 * send_cmd_submit() - Send a command and start its data transfer
+	 *
+	 * Like send_cmd(), but return once the command has been answered and
+	 * leave the data transfer running. This is optional.
+	 *
+	 * @dev:	Device to receive the command
+	 * @cmd:	Command to send, or NULL to only check whether @data
+	 *		could be transferred in the background
+	 * @data:	Data to transfer, which must stay valid until complete
+	 * @return 0 if the transfer is running, -ENOSYS if this transfer
+	 * cannot run in the background, other -ve on error
+	 */
+	int (*send_cmd_submit)(struct udevice *dev, struct mmc_cmd *cmd,
+			       struct mmc_data *data);
+
+	/**
+	 * send_cmd_poll() - Check on a transfer started by send_cmd_submit()
+	 *
+	 * @dev:	Device running the transfer
+	 * @data:	Data passed to send_cmd_submit()
+	 * @return -EBUSY while running, 0 when complete, other -ve on error
+	 */
+	int (*send_cmd_poll)(struct udevice *dev, struct mmc_data *data);
+#endif
+
 	/**
 	 * set_ios() - Set the I/O speed/width for an MMC device
 	 *
@@ -623,6 +656,8 @@ struct mmc {
 #if CONFIG_IS_ENABLED(MMC_WRITE)
 	uint write_bl_len;
 	uint erase_grp_size;	/* in 512-byte sectors */
+	uint cache_size;	/* volatile cache in KiB, 0 if none */
+	uint cache_users;	/* open write cache sessions */
 #endif
 #if CONFIG_IS_ENABLED(MMC_HW_PARTITIONING)
 	uint hc_wp_grp_size;	/* in 512-byte sectors */
@@ -663,6 +698,11 @@ struct mmc {
 				  * accessing the boot partitions
 				  */
 	u32 quirks;
+#if CONFIG_IS_ENABLED(BLK_ASYNC) && CONFIG_IS_ENABLED(DM_MMC)
+	struct blk_req *async_req;	/* background read in progress */
+	struct mmc_data async_data;	/* its current transfer */
+	bool async_stop;		/* transfer ends with STOP_TRANSMISSION */
+#endif
 };
 
 struct mmc_hwpart_conf {
@@ -814,6 +854,22 @@ int mmc_rpmb_route_frames(struct mmc *mmc, void *req, unsigned long reqlen,
 int mmc_set_bkops_enable(struct mmc *mmc);
 #endif
 
+#if CONFIG_IS_ENABLED(MMC_WRITE_CACHE)
+/**
+ * mmc_write_cache() - open or close a write cache session
+ *
+ * The first session turns the eMMC volatile cache on, so that the writes
+ * of a bulk operation are acknowledged as soon as they reach the cache.
+ * Closing the last session flushes the cache once and turns it off again.
+ * This does nothing for cards without a cache.
+ *
+ * @mmc:	MMC device
+ * @enable:	true to open a session, false to close one
+ * @return 0 if OK, -ve on error
+ */
+int mmc_write_cache(struct mmc *mmc, bool enable);
+#endif
+
 /**
  * Start device initialization and return immediately; it does not block on
  * polling OCR (operation condition register) status. Useful for checking
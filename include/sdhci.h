@@ -243,6 +243,8 @@
 #define SDHCI_QUIRK_WAIT_SEND_CMD	(1 << 6)
 #define SDHCI_QUIRK_USE_WIDE8		(1 << 8)
 #define SDHCI_QUIRK_NO_1_8_V		(1 << 9)
+/* ADMA2 descriptors must not cross a 128 MiB boundary (DWC MSHC) */
+#define SDHCI_QUIRK_ADMA_128M_BOUNDARY	(1 << 10)
 
 /* to make gcc happy */
 struct sdhci_host;
@@ -276,8 +278,11 @@ struct sdhci_ops {
 #else
 #define ADMA_DESC_LEN	8
 #endif
-#define ADMA_TABLE_NO_ENTRIES (CONFIG_SYS_MMC_MAX_BLK_COUNT * \
-			       MMC_MAX_BLOCK_LEN) / ADMA_MAX_LEN
+/* one more for the unaligned head, one more for a 128 MiB boundary split */
+#define ADMA_TABLE_NO_ENTRIES (DIV_ROUND_UP(CONFIG_SYS_MMC_MAX_BLK_COUNT * \
+					    MMC_MAX_BLOCK_LEN, ADMA_MAX_LEN) + 2)
+/* ADMA2 data addresses must be 32-bit aligned */
+#define ADMA_ALIGN	4
 
 #define ADMA_TABLE_SZ (ADMA_TABLE_NO_ENTRIES * ADMA_DESC_LEN)
 
@@ -331,6 +336,11 @@ struct sdhci_host {
 #if CONFIG_IS_ENABLED(MMC_SDHCI_ADMA)
 	struct sdhci_adma_desc *adma_desc_table;
 	uint desc_slot;
+	void *align_buffer;	/* head of unaligned transfers */
+	uint align_len;
+#endif
+#if CONFIG_IS_ENABLED(BLK_ASYNC)
+	ulong async_start;	/* get_timer() when the transfer started */
 #endif
 };
 
@@ -416,7 +426,7 @@ static inline u8 sdhci_readb(struct sdhci_host *host, int reg)
 }
 #endif
 
-#ifdef CONFIG_BLK
+#if CONFIG_IS_ENABLED(BLK)
 /**
  * sdhci_setup_cfg() - Set up the configuration for DWMMC
  *
@@ -484,7 +494,22 @@ int add_sdhci(struct sdhci_host *host, u32 f_max, u32 f_min);
 #endif /* !CONFIG_BLK */
 
 void sdhci_set_uhs_timing(struct sdhci_host *host);
-#ifdef CONFIG_DM_MMC
+
+#if !CONFIG_IS_ENABLED(DM_MMC)
+/**
+ * snps_sdhci_add() - Add a Synopsys DWC MSHC without driver model
+ *
+ * For SPLs without driver model. Only one such controller is supported.
+ *
+ * @host:		SDHCI host structure with name, ioaddr and host_caps
+ *			filled in
+ * @pull_up:		Enable the PHY pad pull-ups ("pull_up" in the DT)
+ * @io_fixed_1v8:	Card I/O is fixed at 1.8 V ("io_fixed_1v8" in the DT)
+ * @return 0 if OK, -ve on error
+ */
+int snps_sdhci_add(struct sdhci_host *host, bool pull_up, bool io_fixed_1v8);
+#endif
+#if CONFIG_IS_ENABLED(DM_MMC)
 /* Export the operations to drivers */
 int sdhci_probe(struct udevice *dev);
 int sdhci_set_clock(struct mmc *mmc, unsigned int clock);
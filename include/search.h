@@ -45,6 +45,9 @@ struct hsearch_data {
 	struct env_entry_node *table;
 	unsigned int size;
 	unsigned int filled;
+	unsigned int deleted;	/* slots of deleted entries, not reused yet */
+	unsigned int busy;	/* changes in progress, the table can't move */
+	unsigned int changes;	/* bumped by every change of the contents */
 /*
  * Callback function which will check whether the given change for variable
  * "item" to "newval" may be applied or not, and possibly apply such change.
@@ -56,7 +59,11 @@ struct hsearch_data {
 			 enum env_op, int flag);
 };
 
-/* Create a new hash table which will contain at most "nel" elements.  */
+/*
+ * Create a new hash table for "nel" elements.  It grows when it gets
+ * full, which moves the entries: pointers returned by hsearch_r() are
+ * only valid until the next ENV_ENTER.
+ */
 int hcreate_r(size_t nel, struct hsearch_data *htab);
 
 /* Destroy current internal hash table.  */
@@ -155,6 +155,8 @@ struct spl_image_info {
  * @bl_len: Block length for reading in bytes
  * @filename: Name of the fit image file.
  * @read: Function to call to read from the device
+ * @bdesc: Block device that @read reads from, with sectors numbered the
+ *	same way, or NULL. Lets the loader read in the background.
  */
 struct spl_load_info {
 	void *dev;
@@ -163,6 +165,7 @@ struct spl_load_info {
 	const char *filename;
 	ulong (*read)(struct spl_load_info *load, ulong sector, ulong count,
 		      void *buf);
+	struct blk_desc *bdesc;
 };
 
 /*
@@ -93,14 +93,57 @@ uint32_t crc32_no_comp(uint32_t crc, const unsigned char *buf, uint len);
 void crc32_wd_buf(const uint8_t *input, uint ilen, uint8_t *output,
 		  uint chunk_sz);
 
+/*
+ * Number of 256-entry lookup tables used by crc32() and crc32c_cal(): 1 for
+ * the byte at a time loop, 8 or 16 with CONFIG_CRC32_SLICEBY8/16.
+ */
+#ifndef USE_HOSTCC
+#if CONFIG_IS_ENABLED(CRC32_SLICEBY16)
+#define CRC32_SLICES		16
+#elif CONFIG_IS_ENABLED(CRC32_SLICEBY8)
+#define CRC32_SLICES		8
+#endif
+#endif
+#ifndef CRC32_SLICES
+#define CRC32_SLICES		1
+#endif
+
+#if CRC32_SLICES > 1
+/**
+ * crc32_slice_init() - Set up slicing tables for a reflected CRC32
+ *
+ * @tab: CRC32_SLICES tables to fill in, tab[k][n] being the CRC of byte n
+ *	followed by k zero bytes
+ * @poly: Bit-reflected polynomial
+ */
+void crc32_slice_init(uint32_t (*tab)[256], uint32_t poly);
+
+/**
+ * crc32_slice() - Update a reflected CRC32 using slicing tables
+ *
+ * No one's complement is applied, as for crc32_no_comp().
+ *
+ * @crc: Previous crc
+ * @buf: Bytes to checksum
+ * @len: Number of bytes to checksum
+ * @tab: Tables set up by crc32_slice_init()
+ * @return checksum value
+ */
+uint32_t crc32_slice(uint32_t crc, const uint8_t *buf, uint len,
+		     const uint32_t (*tab)[256]);
+#endif
+
 /* lib/crc32c.c */
 
+/* Number of entries in a table set up by crc32c_init() */
+#define CRC32C_TABLE_SIZE	(256 * CRC32_SLICES)
+
 /**
  * crc32c_init() - Set up a the CRC32 table
  *
- * This sets up 256-item table to aid in CRC32 calculation
+ * This sets up CRC32C_TABLE_SIZE-item table to aid in CRC32 calculation
  *
- * @crc32c_table: Place to put table
+ * @crc32c_table: Place to put table, CRC32C_TABLE_SIZE entries
  * @pol: polynomial to use
  */
 void crc32c_init(uint32_t *crc32c_table, uint32_t pol);
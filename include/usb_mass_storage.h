@@ -19,6 +19,8 @@ struct ums {
 			   ulong start, lbaint_t blkcnt, void *buf);
 	int (*write_sector)(struct ums *ums_dev,
 			    ulong start, lbaint_t blkcnt, const void *buf);
+	/* optional, writes back what the device holds in its write cache */
+	int (*flush)(struct ums *ums_dev);
 	unsigned int start_sector;
 	unsigned int num_sectors;
 	const char *name;
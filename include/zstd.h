@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ */
+
+#ifndef __ZSTD_H
+#define __ZSTD_H
+
+/**
+ * uzstd() - Decompress Zstandard data
+ *
+ * The whole input must be in memory. It may hold several concatenated
+ * frames, which are decoded back to back. Output is written directly to
+ * @dst, which also serves as the decoder's history window, so no window
+ * buffer is allocated whatever window size the data was compressed with.
+ * With DECOMP_PARALLEL, input made of several frames which record their
+ * content size is decompressed on all CPUs, one frame per CPU at a time.
+ *
+ * @src: Source data to decompress
+ * @srcn: Length of source data
+ * @dst: Destination for uncompressed data
+ * @dstn: On entry, size of @dst; returns length of uncompressed data
+ * @return 0 if OK, -EPROTONOSUPPORT if the magic number or frame
+ *	parameters are not recognised, -ENOMEM if the decompression context
+ *	cannot be allocated, -ENOBUFS if the destination buffer is too small,
+ *	-EINVAL if the input is truncated, -EPROTO if the compressed data
+ *	causes an error in the decompression algorithm
+ */
+int uzstd(const void *src, size_t srcn, void *dst, size_t *dstn);
+
+#endif
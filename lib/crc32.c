@@ -178,11 +178,91 @@ const uint32_t * ZEXPORT get_crc_table()
 
 /* ========================================================================= */
 
+#if CRC32_SLICES > 1
+/*
+ * Filled in on first use, which may come before relocation while BSS is
+ * not usable yet, so keep the tables in a data section.
+ */
+#ifdef CONFIG_EFI_LOADER
+#define __crc_slice_data __efi_runtime_data
+#else
+#define __crc_slice_data __section(".data")
+#endif
+
+static uint32_t crc_slice_table[CRC32_SLICES][256] __crc_slice_data;
+static int crc_slice_ready __crc_slice_data;
+
+void __efi_runtime crc32_slice_init(uint32_t (*tab)[256], uint32_t poly)
+{
+	uint32_t c;
+	int n, k;
+
+	for (n = 0; n < 256; n++) {
+		c = n;
+		for (k = 0; k < 8; k++)
+			c = c & 1 ? poly ^ (c >> 1) : c >> 1;
+		tab[0][n] = c;
+	}
+	for (k = 1; k < CRC32_SLICES; k++) {
+		for (n = 0; n < 256; n++) {
+			c = tab[k - 1][n];
+			tab[k][n] = tab[0][c & 0xff] ^ (c >> 8);
+		}
+	}
+}
+
+/* Fold the four bytes of @v through tables @s down to @s - 3 */
+#define SLICE4(v, s) \
+	(tab[(s)][(v) & 0xff] ^ tab[(s) - 1][((v) >> 8) & 0xff] ^ \
+	 tab[(s) - 2][((v) >> 16) & 0xff] ^ tab[(s) - 3][(v) >> 24])
+
+uint32_t __efi_runtime crc32_slice(uint32_t crc, const uint8_t *buf, uint len,
+				   const uint32_t (*tab)[256])
+{
+	const uint32_t *w;
+	uint32_t v0, v1;
+
+	/* Words are read in little-endian order, so this is endian-neutral */
+	for (; len && ((ulong)buf & 3); len--)
+		crc = tab[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+
+	for (; len >= CRC32_SLICES; len -= CRC32_SLICES) {
+		w = (const uint32_t *)buf;
+		v0 = le32_to_cpu(w[0]) ^ crc;
+		v1 = le32_to_cpu(w[1]);
+		crc = SLICE4(v0, CRC32_SLICES - 1) ^
+		      SLICE4(v1, CRC32_SLICES - 5);
+#if CRC32_SLICES == 16
+		v0 = le32_to_cpu(w[2]);
+		v1 = le32_to_cpu(w[3]);
+		crc ^= SLICE4(v0, 7) ^ SLICE4(v1, 3);
+#endif
+		buf += CRC32_SLICES;
+	}
+
+	for (; len; len--)
+		crc = tab[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+
+	return crc;
+}
+#undef SLICE4
+#endif
+
 /* No ones complement version. JFFS2 (and other things ?)
  * don't use ones compliment in their CRC calculations.
  */
 uint32_t __efi_runtime crc32_no_comp(uint32_t crc, const Bytef *buf, uInt len)
 {
+#if CRC32_SLICES > 1
+    if (!crc_slice_ready) {
+	 crc32_slice_init(crc_slice_table, 0xedb88320);
+	 /* other harts must not see the flag before the tables */
+	 __sync_synchronize();
+	 crc_slice_ready = 1;
+    }
+
+    return crc32_slice(crc, buf, len, crc_slice_table);
+#else
     const uint32_t *tab = crc_table;
     const uint32_t *b =(const uint32_t *)buf;
     size_t rem_len;
@@ -220,6 +300,7 @@ uint32_t __efi_runtime crc32_no_comp(uint32_t crc, const Bytef *buf, uInt len)
     }
 
     return le32_to_cpu(crc);
+#endif
 }
 #undef DO_CRC
 
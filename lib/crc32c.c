@@ -12,18 +12,27 @@
 
 #include <common.h>
 #include <compiler.h>
+#include <u-boot/crc.h>
 
 uint32_t crc32c_cal(uint32_t crc, const char *data, int length,
 		    uint32_t *crc32c_table)
 {
+#if CRC32_SLICES > 1
+	return crc32_slice(crc, (const uint8_t *)data, length,
+			   (const uint32_t (*)[256])crc32c_table);
+#else
 	while (length--)
 		crc = crc32c_table[(u8)(crc ^ *data++)] ^ (crc >> 8);
 
 	return crc;
+#endif
 }
 
 void crc32c_init(uint32_t *crc32c_table, uint32_t pol)
 {
+#if CRC32_SLICES > 1
+	crc32_slice_init((uint32_t (*)[256])crc32c_table, pol);
+#else
 	int i, j;
 	uint32_t v;
 	const uint32_t poly = pol; /* Bit-reflected CRC32C polynomial */
@@ -35,4 +44,5 @@ void crc32c_init(uint32_t *crc32c_table, uint32_t pol)
 
 		crc32c_table[i] = v;
 	}
+#endif
 }
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ */
+
+#include <common.h>
+#include <cpu_func.h>
+#include <decomp_parallel.h>
+#include <asm/smp.h>
+
+struct decomp_parallel {
+	struct decomp_chunk *chunks;
+	int count;
+	long (*decode)(void *ctx, struct decomp_chunk *chunk);
+	void **ctxs;
+	int nctx;
+};
+
+/*
+ * Every hart computes the same greedy assignment of chunks to the least
+ * loaded hart, then decodes its own chunks with its own context. Other
+ * harts clean what they wrote from their own cache before returning, so
+ * the output is in memory once the calling hart sees them done.
+ */
+static void decomp_parallel_run(int idx, int nr, void *arg)
+{
+	struct decomp_parallel *dp = arg;
+	struct decomp_chunk *chunk;
+	ulong load[CONFIG_NR_CPUS] = { 0 };
+	int i, j, owner;
+
+	nr = min(nr, dp->nctx);
+	if (idx >= nr)
+		return;
+
+	for (i = 0; i < dp->count; i++) {
+		for (owner = 0, j = 1; j < nr; j++) {
+			if (load[j] < load[owner])
+				owner = j;
+		}
+		load[owner] += dp->chunks[i].dstn;
+		if (owner != idx)
+			continue;
+
+		chunk = &dp->chunks[i];
+		chunk->ret = dp->decode(dp->ctxs ? dp->ctxs[idx] : NULL, chunk);
+		if (idx) {
+			flush_dcache_range((ulong)chunk->dst,
+					   (ulong)chunk->dst + chunk->dstn);
+			flush_dcache_range((ulong)chunk, (ulong)(chunk + 1));
+		}
+	}
+}
+
+int decomp_parallel(struct decomp_chunk *chunks, int count,
+		    long (*decode)(void *ctx, struct decomp_chunk *chunk),
+		    void **ctxs, int nctx)
+{
+	struct decomp_parallel dp = {
+		.chunks = chunks,
+		.count = count,
+		.decode = decode,
+		.ctxs = ctxs,
+		.nctx = min(nctx, CONFIG_NR_CPUS),
+	};
+	int nr;
+
+	nr = smp_parallel_run(decomp_parallel_run, &dp);
+
+	return min(nr, dp.nctx);
+}
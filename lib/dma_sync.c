@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ *
+ * Cache maintenance for streaming DMA transfers
+ */
+
+#include <common.h>
+#include <cpu_func.h>
+#include <asm/cache.h>
+
+/**
+ * dma_sync_range_for_device() - hand a buffer over to a DMA master
+ *
+ * @addr:	start of the buffer
+ * @len:	length of the buffer, rounded up to ARCH_DMA_MINALIGN
+ * @dir:	direction of the transfer
+ *
+ * Writes back data the device is going to read and makes sure no dirty
+ * line can be evicted on top of data the device is going to write.
+ * Architectures with a cheaper combined operation override this.
+ */
+__weak void dma_sync_range_for_device(unsigned long addr, size_t len,
+				      enum dma_data_direction dir)
+{
+	unsigned long end = addr + ROUND(len, ARCH_DMA_MINALIGN);
+
+	if (dir != DMA_FROM_DEVICE)
+		flush_dcache_range(addr, end);
+	if (dir != DMA_TO_DEVICE)
+		invalidate_dcache_range(addr, end);
+}
+
+/**
+ * dma_sync_range_for_cpu() - take a buffer back from a DMA master
+ *
+ * @addr:	start of the buffer
+ * @len:	length of the buffer, rounded up to ARCH_DMA_MINALIGN
+ * @dir:	direction of the transfer
+ *
+ * Drops lines the CPU may have speculatively fetched while the device was
+ * writing the buffer.
+ */
+__weak void dma_sync_range_for_cpu(unsigned long addr, size_t len,
+				   enum dma_data_direction dir)
+{
+	if (dir != DMA_TO_DEVICE)
+		invalidate_dcache_range(addr,
+					addr + ROUND(len, ARCH_DMA_MINALIGN));
+}
@@ -205,6 +205,7 @@ int gzwrite(unsigned char *src, int len,
 	s.next_in = src + i;
 	s.avail_in = payload_size+8;
 	writebuf = (unsigned char *)malloc_cache_aligned(szwritebuf);
+	blk_dwrite_cache(dev, true);
 
 	/* decompress until deflate stream ends or end of file */
 	do {
@@ -262,6 +263,8 @@ int gzwrite(unsigned char *src, int len,
 		r = 0;
 
 out:
+	if (blk_dwrite_cache(dev, false))
+		r = -1;
 	gzwrite_progress_finish(r, totalfilled, szexpected,
 				expected_crc, crc);
 	free(writebuf);
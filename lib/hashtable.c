@@ -119,6 +119,7 @@ int hcreate_r(size_t nel, struct hsearch_data *htab)
 
 	htab->size = nel;
 	htab->filled = 0;
+	htab->deleted = 0;
 
 	/* allocate memory and zero out */
 	htab->table = (struct env_entry_node *)calloc(htab->size + 1,
@@ -163,6 +164,70 @@ void hdestroy_r(struct hsearch_data *htab)
 
 	/* the sign for an existing table is an value != NULL in htable */
 	htab->table = NULL;
+	htab->changes++;
+}
+
+/*
+ * First hash function:
+ * a value for the string, modulo the table size but never zero.
+ */
+static unsigned int hash_key(const char *key, unsigned int size)
+{
+	unsigned int len = strlen(key);
+	unsigned int hval = len;
+	unsigned int count = len;
+
+	while (count-- > 0) {
+		hval <<= 4;
+		hval += key[count];
+	}
+
+	hval %= size;
+	if (hval == 0)
+		++hval;
+
+	return hval;
+}
+
+/*
+ * Move the entries to a new table for "nel" elements, which also drops
+ * the slots of deleted entries.
+ */
+static int hresize_r(size_t nel, struct hsearch_data *htab)
+{
+	struct hsearch_data new = { .table = NULL };
+	unsigned int i, idx, hval, hval2;
+
+	if (hcreate_r(nel, &new) == 0)
+		return 0;
+
+	debug("hresize: %u -> %u entries, %u used\n", htab->size, new.size,
+	      htab->filled);
+
+	for (i = 1; i <= htab->size; ++i) {
+		struct env_entry_node *node = &htab->table[i];
+
+		if (node->used <= 0)
+			continue;
+
+		hval = hash_key(node->entry.key, new.size);
+		hval2 = 1 + hval % (new.size - 2);
+		for (idx = hval; new.table[idx].used; ) {
+			if (idx <= hval2)
+				idx = new.size + idx - hval2;
+			else
+				idx -= hval2;
+		}
+		new.table[idx].used = hval;
+		new.table[idx].entry = node->entry;
+	}
+
+	free(htab->table);
+	htab->table = new.table;
+	htab->size = new.size;
+	htab->deleted = 0;
+
+	return 1;
 }
 
 /*
@@ -264,6 +329,7 @@ static inline int _compare_and_overwrite_entry(struct env_entry item,
 				*retval = NULL;
 				return 0;
 			}
+			++htab->changes;
 		}
 		/* return found entry */
 		*retval = &htab->table[idx].entry;
@@ -273,31 +339,16 @@ static inline int _compare_and_overwrite_entry(struct env_entry item,
 	return -1;
 }
 
-int hsearch_r(struct env_entry item, enum env_action action,
-	      struct env_entry **retval, struct hsearch_data *htab, int flag)
+static int _hsearch_r(struct env_entry item, enum env_action action,
+		      struct env_entry **retval, struct hsearch_data *htab,
+		      int flag)
 {
 	unsigned int hval;
-	unsigned int count;
-	unsigned int len = strlen(item.key);
 	unsigned int idx;
 	unsigned int first_deleted = 0;
 	int ret;
 
-	/* Compute an value for the given string. Perhaps use a better method. */
-	hval = len;
-	count = len;
-	while (count-- > 0) {
-		hval <<= 4;
-		hval += item.key[count];
-	}
-
-	/*
-	 * First hash function:
-	 * simply take the modul but prevent zero.
-	 */
-	hval %= htab->size;
-	if (hval == 0)
-		++hval;
+	hval = hash_key(item.key, htab->size);
 
 	/* The first index tried. */
 	idx = hval;
@@ -370,8 +421,10 @@ int hsearch_r(struct env_entry item, enum env_action action,
 		 * Create new entry;
 		 * create copies of item.key and item.data
 		 */
-		if (first_deleted)
+		if (first_deleted) {
 			idx = first_deleted;
+			--htab->deleted;
+		}
 
 		htab->table[idx].used = hval;
 		htab->table[idx].entry.key = strdup(item.key);
@@ -384,6 +437,7 @@ int hsearch_r(struct env_entry item, enum env_action action,
 		}
 
 		++htab->filled;
+		++htab->changes;
 
 		/* This is a new entry, so look up a possible callback */
 		env_callback_init(&htab->table[idx].entry);
@@ -423,6 +477,33 @@ int hsearch_r(struct env_entry item, enum env_action action,
 	return 0;
 }
 
+int hsearch_r(struct env_entry item, enum env_action action,
+	      struct env_entry **retval, struct hsearch_data *htab, int flag)
+{
+	unsigned int size = htab->size;
+	int ret;
+
+	if (action == ENV_FIND)
+		return _hsearch_r(item, action, retval, htab, flag);
+
+	/*
+	 * Keep a quarter of the slots free so that lookups stay short,
+	 * growing the table when it is mostly in use and otherwise just
+	 * dropping the slots of deleted entries. Not while a callback of
+	 * an outer change runs, which holds on to its slot.
+	 */
+	if (htab->table && !htab->busy &&
+	    (htab->filled + htab->deleted + 1) * 4 > size * 3)
+		hresize_r((htab->filled + 1) * 2 > size ? size * 2 : size,
+			  htab);
+
+	++htab->busy;
+	ret = _hsearch_r(item, action, retval, htab, flag);
+	--htab->busy;
+
+	return ret;
+}
+
 
 /*
  * hdelete()
@@ -446,6 +527,8 @@ static void _hdelete(const char *key, struct hsearch_data *htab,
 	htab->table[idx].used = USED_DELETED;
 
 	--htab->filled;
+	++htab->deleted;
+	++htab->changes;
 }
 
 int hdelete_r(const char *key, struct hsearch_data *htab, int flag)
@@ -473,13 +556,16 @@ int hdelete_r(const char *key, struct hsearch_data *htab, int flag)
 	}
 
 	/* If there is a callback, call it */
+	++htab->busy;
 	if (htab->table[idx].entry.callback &&
 	    htab->table[idx].entry.callback(key, NULL, env_op_delete, flag)) {
 		debug("callback() rejected deleting variable "
 			"%s, skipping it!\n", key);
+		--htab->busy;
 		__set_errno(EINVAL);
 		return 0;
 	}
+	--htab->busy;
 
 	_hdelete(key, htab, ep, idx);
 
@@ -836,7 +922,8 @@ int himport_r(struct hsearch_data *htab,
 	 * environment size), so we clip it to a reasonable value.
 	 * On the other hand we need to add some more entries for free
 	 * space when importing very small buffers. Both boundaries can
-	 * be overwritten in the board config file if needed.
+	 * be overwritten in the board config file if needed. The table
+	 * grows when more entries are added later.
 	 */
 
 	if (!htab->table) {
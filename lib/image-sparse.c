@@ -43,27 +43,173 @@
 #include <sparse_format.h>
 
 #include <linux/math64.h>
+#include <linux/sizes.h>
 
 static void default_log(const char *ignored, char *response) {}
 
+/* RAW chunks up to this size are copied together to be written at once */
+#define SPARSE_MERGE_MAX	SZ_256K
+#define SPARSE_MERGE_BUF_SIZE	SZ_1M
+
+/**
+ * struct sparse_run - RAW data waiting to be written in one request
+ *
+ * @blk:	First block of the run
+ * @blkcnt:	Number of blocks in the run
+ * @data:	Data of the run, contiguous in memory
+ * @buf:	Buffer small chunks are merged in, NULL if none
+ * @buf_blks:	Size of @buf in blocks
+ */
+struct sparse_run {
+	lbaint_t	blk;
+	lbaint_t	blkcnt;
+	const void	*data;
+	void		*buf;
+	lbaint_t	buf_blks;
+};
+
+static int sparse_write(struct sparse_storage *info, lbaint_t *blk,
+			lbaint_t blkcnt, const void *data, char *response)
+{
+	lbaint_t blks;
+
+	blks = info->write(info, *blk, blkcnt, data);
+	/* blks might be > blkcnt (eg. NAND bad-blocks) */
+	if (blks < blkcnt) {
+		printf("%s: %s" LBAFU " [" LBAFU "]\n",
+		       __func__, "Write failed, block #", *blk, blks);
+		info->mssg("flash write failure", response);
+		return -1;
+	}
+	*blk += blks;
+
+	return 0;
+}
+
+static int sparse_run_flush(struct sparse_storage *info,
+			    struct sparse_run *run, char *response)
+{
+	lbaint_t blk = run->blk;
+	int ret = 0;
+
+	if (run->blkcnt)
+		ret = sparse_write(info, &blk, run->blkcnt, run->data,
+				   response);
+	run->blk = blk;
+	run->blkcnt = 0;
+
+	return ret;
+}
+
+/**
+ * sparse_run_add() - Add a RAW chunk to the pending run
+ *
+ * The chunk joins the run if it follows it on the device. Chunk headers
+ * sit between the chunks in the image, so small chunks are copied next
+ * to each other into the merge buffer; a large one is worth a request of
+ * its own and is written from the image. The image itself is left as it
+ * is, so that it can be flashed again.
+ *
+ * @info:	Storage the image is written to
+ * @run:	Pending run; run->blk is where the chunk goes
+ * @data:	Chunk data
+ * @blkcnt:	Number of blocks in the chunk
+ * @response:	Fastboot response buffer
+ * @return 0 if ok, -1 on write failure
+ */
+static int sparse_run_add(struct sparse_storage *info, struct sparse_run *run,
+			  const void *data, lbaint_t blkcnt, char *response)
+{
+	size_t len = blkcnt * info->blksz;
+	size_t run_len = run->blkcnt * info->blksz;
+
+	if (run->blkcnt &&
+	    (len > SPARSE_MERGE_MAX || run->blkcnt + blkcnt > run->buf_blks ||
+	     (run->data != run->buf && run_len > SPARSE_MERGE_MAX))) {
+		if (sparse_run_flush(info, run, response))
+			return -1;
+		run_len = 0;
+	}
+
+	if (!run->blkcnt) {
+		run->data = data;
+	} else {
+		if (run->data != run->buf) {
+			memcpy(run->buf, run->data, run_len);
+			run->data = run->buf;
+		}
+		memcpy(run->buf + run_len, data, len);
+	}
+	run->blkcnt += blkcnt;
+
+	return 0;
+}
+
+/**
+ * sparse_fill() - Write a FILL chunk
+ *
+ * Blocks are written from a buffer holding the fill pattern. When the
+ * storage can erase and reads erased blocks back as the pattern, the
+ * aligned middle of the range is erased instead.
+ */
+static int sparse_fill(struct sparse_storage *info, lbaint_t *blk,
+		       lbaint_t blkcnt, uint32_t fill_val, void *fill_buf,
+		       lbaint_t fill_buf_num_blks, char *response)
+{
+	lbaint_t grp = info->erase_grp;
+	lbaint_t head, middle = 0, j;
+
+	if (info->erase && grp && fill_val == info->erase_val) {
+		head = min(blkcnt, (lbaint_t)(ALIGN(*blk, grp) - *blk));
+		middle = (blkcnt - head) & ~(grp - 1);
+	}
+	if (middle) {
+		while (head) {
+			j = min(head, fill_buf_num_blks);
+			if (sparse_write(info, blk, j, fill_buf, response))
+				return -1;
+			head -= j;
+			blkcnt -= j;
+		}
+		if (info->erase(info, *blk, middle) != middle) {
+			printf("%s: %s" LBAFU "\n", __func__,
+			       "Erase failed, block #", *blk);
+			info->mssg("flash erase failure", response);
+			return -1;
+		}
+		*blk += middle;
+		blkcnt -= middle;
+	}
+
+	while (blkcnt) {
+		j = min(blkcnt, fill_buf_num_blks);
+		if (sparse_write(info, blk, j, fill_buf, response))
+			return -1;
+		blkcnt -= j;
+	}
+
+	return 0;
+}
+
 int write_sparse_image(struct sparse_storage *info,
 		       const char *part_name, void *data, char *response)
 {
-	lbaint_t blk;
+	struct sparse_run run = { 0 };
 	lbaint_t blkcnt;
-	lbaint_t blks;
 	uint32_t bytes_written = 0;
 	unsigned int chunk;
 	unsigned int offset;
 	unsigned int chunk_data_sz;
-	uint32_t *fill_buf = NULL;
+	uint32_t chunk_type, chunk_total_sz, chunk_sz;
+	uint32_t *fill_buf;
 	uint32_t fill_val;
+	bool fill_valid = false;
 	sparse_header_t *sparse_header;
 	chunk_header_t *chunk_header;
 	uint32_t total_blocks = 0;
-	int fill_buf_num_blks;
+	lbaint_t fill_buf_num_blks;
+	int ret = -1;
 	int i;
-	int j;
 
 	fill_buf_num_blks = CONFIG_IMAGE_SPARSE_FILLBUF_SIZE / info->blksz;
 
@@ -104,20 +250,39 @@ int write_sparse_image(struct sparse_storage *info,
 		return -1;
 	}
 
+	/* One fill buffer for the whole image, refilled on new values */
+	fill_buf = (uint32_t *)
+		   memalign(ARCH_DMA_MINALIGN,
+			    ROUNDUP(info->blksz * fill_buf_num_blks,
+				    ARCH_DMA_MINALIGN));
+	if (!fill_buf) {
+		info->mssg("Malloc failed for: CHUNK_TYPE_FILL", response);
+		return -1;
+	}
+
+	/* Without a merge buffer every RAW chunk is written on its own */
+	run.buf = memalign(ARCH_DMA_MINALIGN, SPARSE_MERGE_BUF_SIZE);
+	if (run.buf)
+		run.buf_blks = SPARSE_MERGE_BUF_SIZE / info->blksz;
+
 	puts("Flashing Sparse Image\n");
 
 	/* Start processing chunks */
-	blk = info->start;
+	run.blk = info->start;
 	for (chunk = 0; chunk < sparse_header->total_chunks; chunk++) {
 		/* Read and skip over chunk header */
 		chunk_header = (chunk_header_t *)data;
 		data += sizeof(chunk_header_t);
 
-		if (chunk_header->chunk_type != CHUNK_TYPE_RAW) {
+		chunk_type = chunk_header->chunk_type;
+		chunk_sz = chunk_header->chunk_sz;
+		chunk_total_sz = chunk_header->total_sz;
+
+		if (chunk_type != CHUNK_TYPE_RAW) {
 			debug("=== Chunk Header ===\n");
-			debug("chunk_type: 0x%x\n", chunk_header->chunk_type);
-			debug("chunk_data_sz: 0x%x\n", chunk_header->chunk_sz);
-			debug("total_size: 0x%x\n", chunk_header->total_sz);
+			debug("chunk_type: 0x%x\n", chunk_type);
+			debug("chunk_data_sz: 0x%x\n", chunk_sz);
+			debug("total_size: 0x%x\n", chunk_total_sz);
 		}
 
 		if (sparse_header->chunk_hdr_sz > sizeof(chunk_header_t)) {
@@ -129,133 +294,115 @@ int write_sparse_image(struct sparse_storage *info,
 				 sizeof(chunk_header_t));
 		}
 
-		chunk_data_sz = sparse_header->blk_sz * chunk_header->chunk_sz;
+		chunk_data_sz = sparse_header->blk_sz * chunk_sz;
 		blkcnt = chunk_data_sz / info->blksz;
-		switch (chunk_header->chunk_type) {
+
+		/* Anything but RAW data ends the pending run */
+		if (chunk_type != CHUNK_TYPE_RAW &&
+		    sparse_run_flush(info, &run, response))
+			goto out;
+
+		switch (chunk_type) {
 		case CHUNK_TYPE_RAW:
-			if (chunk_header->total_sz !=
+			if (chunk_total_sz !=
 			    (sparse_header->chunk_hdr_sz + chunk_data_sz)) {
 				info->mssg("Bogus chunk size for chunk type Raw",
 					   response);
-				return -1;
+				goto out;
 			}
 
-			if (blk + blkcnt > info->start + info->size) {
+			if (run.blk + run.blkcnt + blkcnt >
+			    info->start + info->size) {
 				printf(
 				    "%s: Request would exceed partition size!\n",
 				    __func__);
 				info->mssg("Request would exceed partition size!",
 					   response);
-				return -1;
+				goto out;
 			}
 
-			blks = info->write(info, blk, blkcnt, data);
-			/* blks might be > blkcnt (eg. NAND bad-blocks) */
-			if (blks < blkcnt) {
-				printf("%s: %s" LBAFU " [" LBAFU "]\n",
-				       __func__, "Write failed, block #",
-				       blk, blks);
-				info->mssg("flash write failure", response);
-				return -1;
-			}
-			blk += blks;
+			if (sparse_run_add(info, &run, data, blkcnt, response))
+				goto out;
 			bytes_written += blkcnt * info->blksz;
-			total_blocks += chunk_header->chunk_sz;
+			total_blocks += chunk_sz;
 			data += chunk_data_sz;
 			break;
 
 		case CHUNK_TYPE_FILL:
-			if (chunk_header->total_sz !=
+			if (chunk_total_sz !=
 			    (sparse_header->chunk_hdr_sz + sizeof(uint32_t))) {
 				info->mssg("Bogus chunk size for chunk type FILL", response);
-				return -1;
-			}
-
-			fill_buf = (uint32_t *)
-				   memalign(ARCH_DMA_MINALIGN,
-					    ROUNDUP(
-						info->blksz * fill_buf_num_blks,
-						ARCH_DMA_MINALIGN));
-			if (!fill_buf) {
-				info->mssg("Malloc failed for: CHUNK_TYPE_FILL",
-					   response);
-				return -1;
+				goto out;
 			}
 
 			fill_val = *(uint32_t *)data;
 			data = (char *)data + sizeof(uint32_t);
 
-			for (i = 0;
-			     i < (info->blksz * fill_buf_num_blks /
-				  sizeof(fill_val));
-			     i++)
-				fill_buf[i] = fill_val;
+			if (!fill_valid || fill_buf[0] != fill_val) {
+				for (i = 0;
+				     i < (info->blksz * fill_buf_num_blks /
+					  sizeof(fill_val));
+				     i++)
+					fill_buf[i] = fill_val;
+				fill_valid = true;
+			}
 
-			if (blk + blkcnt > info->start + info->size) {
+			if (run.blk + blkcnt > info->start + info->size) {
 				printf(
 				    "%s: Request would exceed partition size!\n",
 				    __func__);
 				info->mssg("Request would exceed partition size!",
 					   response);
-				return -1;
+				goto out;
 			}
 
-			for (i = 0; i < blkcnt;) {
-				j = blkcnt - i;
-				if (j > fill_buf_num_blks)
-					j = fill_buf_num_blks;
-				blks = info->write(info, blk, j, fill_buf);
-				/* blks might be > j (eg. NAND bad-blocks) */
-				if (blks < j) {
-					printf("%s: %s " LBAFU " [%d]\n",
-					       __func__,
-					       "Write failed, block #",
-					       blk, j);
-					info->mssg("flash write failure",
-						   response);
-					free(fill_buf);
-					return -1;
-				}
-				blk += blks;
-				i += j;
-			}
+			if (sparse_fill(info, &run.blk, blkcnt, fill_val,
+					fill_buf, fill_buf_num_blks, response))
+				goto out;
 			bytes_written += blkcnt * info->blksz;
 			total_blocks += chunk_data_sz / sparse_header->blk_sz;
-			free(fill_buf);
 			break;
 
 		case CHUNK_TYPE_DONT_CARE:
-			blk += info->reserve(info, blk, blkcnt);
-			total_blocks += chunk_header->chunk_sz;
+			run.blk += info->reserve(info, run.blk, blkcnt);
+			total_blocks += chunk_sz;
 			break;
 
 		case CHUNK_TYPE_CRC32:
-			if (chunk_header->total_sz !=
+			if (chunk_total_sz !=
 			    sparse_header->chunk_hdr_sz) {
 				info->mssg("Bogus chunk size for chunk type Dont Care",
 					   response);
-				return -1;
+				goto out;
 			}
-			total_blocks += chunk_header->chunk_sz;
+			total_blocks += chunk_sz;
 			data += chunk_data_sz;
 			break;
 
 		default:
 			printf("%s: Unknown chunk type: %x\n", __func__,
-			       chunk_header->chunk_type);
+			       chunk_type);
 			info->mssg("Unknown chunk type", response);
-			return -1;
+			goto out;
 		}
 	}
 
+	if (sparse_run_flush(info, &run, response))
+		goto out;
+
 	debug("Wrote %d blocks, expected to write %d blocks\n",
 	      total_blocks, sparse_header->total_blks);
 	printf("........ wrote %u bytes to '%s'\n", bytes_written, part_name);
 
 	if (total_blocks != sparse_header->total_blks) {
 		info->mssg("sparse image write failure", response);
-		return -1;
+		goto out;
 	}
 
-	return 0;
+	ret = 0;
+out:
+	free(run.buf);
+	free(fill_buf);
+
+	return ret;
 }
@@ -5,8 +5,10 @@
 
 #include <common.h>
 #include <compiler.h>
+#include <decomp_parallel.h>
 #include <image.h>
 #include <lz4.h>
+#include <malloc.h>
 #include <linux/kernel.h>
 #include <linux/types.h>
 
@@ -62,11 +64,119 @@ struct lz4_block_header {
 	/* + u32 block_checksum iff has_block_checksum is set */
 } __packed;
 
+#if CONFIG_IS_ENABLED(DECOMP_PARALLEL)
+static long ulz4_decode_block(void *ctx, struct decomp_chunk *chunk)
+{
+	int ret;
+
+	/* constant folding essential, do not touch params! */
+	ret = LZ4_decompress_generic(chunk->src, chunk->dst, chunk->srcn,
+			chunk->dstn, endOnInputSize,
+			full, 0, noDict, chunk->dst, NULL, 0);
+
+	return ret < 0 ? -EPROTO : ret;
+}
+
+/*
+ * Independent blocks can be decompressed in any order as long as we know
+ * where each one goes. The lz4 tool fills every block but the last up to
+ * the maximum block size, so block n starts at n times that size; this is
+ * checked afterwards. Returns 0 if all went well, or -ve to have the caller
+ * decode the frame front to back, which also produces the proper error for
+ * damaged or differently laid out data.
+ */
+static int ulz4fn_parallel(const void *src, size_t srcn, const void *in,
+			   int has_block_checksum, size_t block_size,
+			   void *dst, size_t *dstn)
+{
+	struct decomp_chunk *chunks;
+	struct lz4_block_header b;
+	const void *p;
+	size_t out, size, total = 0;
+	int blocks, count, i, ret = 0;
+
+	if (!decomp_parallel_safe(src, srcn, dst, *dstn))
+		return -EINVAL;
+
+	for (blocks = 0, p = in; ; blocks++) {
+		if (p - src + sizeof(b) > srcn)
+			return -EINVAL;
+		b.raw = le32_to_cpu(*(u32 *)p);
+		p += sizeof(b);
+		if (!b.size)
+			break;
+		if (p - src + b.size > srcn)
+			return -EINVAL;
+		p += b.size;
+		if (has_block_checksum)
+			p += sizeof(u32);
+	}
+	if (blocks < 2 || (blocks - 1) * block_size >= *dstn)
+		return -ENOENT;
+
+	chunks = calloc(blocks, sizeof(*chunks));
+	if (!chunks)
+		return -ENOMEM;
+
+	/* Stored blocks are copied right away, the others queued */
+	for (count = 0, i = 0, p = in; i < blocks; i++) {
+		out = i * block_size;
+		size = min(block_size, *dstn - out);
+
+		b.raw = le32_to_cpu(*(u32 *)p);
+		p += sizeof(b);
+		if (b.not_compressed) {
+			if (b.size > size ||
+			    (i < blocks - 1 && b.size != block_size)) {
+				ret = -EPROTO;
+				goto out;
+			}
+			memcpy(dst + out, p, b.size);
+			total = out + b.size;
+		} else {
+			chunks[count].src = p;
+			chunks[count].srcn = b.size;
+			chunks[count].dst = dst + out;
+			chunks[count].dstn = size;
+			count++;
+		}
+		p += b.size;
+		if (has_block_checksum)
+			p += sizeof(u32);
+	}
+
+	decomp_parallel(chunks, count, ulz4_decode_block, NULL,
+			CONFIG_NR_CPUS);
+
+	for (i = 0; i < count; i++) {
+		if (chunks[i].ret < 0) {
+			ret = chunks[i].ret;
+			goto out;
+		}
+		out = chunks[i].dst - dst;
+		if (out + block_size <= (blocks - 1) * block_size &&
+		    chunks[i].ret != block_size) {
+			ret = -EPROTO;
+			goto out;
+		}
+		total = max(total, out + chunks[i].ret);
+	}
+	*dstn = total;
+
+out:
+	free(chunks);
+
+	return ret;
+}
+#endif
+
 int ulz4fn(const void *src, size_t srcn, void *dst, size_t *dstn)
 {
 	const void *end = dst + *dstn;
 	const void *in = src;
 	void *out = dst;
+	size_t __maybe_unused capacity = *dstn;
+	size_t __maybe_unused block_size;
 	int has_block_checksum;
 	int ret;
 	*dstn = 0;
@@ -85,6 +195,8 @@ int ulz4fn(const void *src, size_t srcn, void *dst, size_t *dstn)
 		if (!h->independent_blocks)
 			return -EPROTONOSUPPORT; /* we can't support this yet */
 		has_block_checksum = h->has_block_checksum;
+		block_size = h->max_block_size >= 4 ?
+			1 << (8 + 2 * h->max_block_size) : 0;
 
 		in += sizeof(*h);
 		if (h->has_content_size)
@@ -92,6 +204,14 @@ int ulz4fn(const void *src, size_t srcn, void *dst, size_t *dstn)
 		in += sizeof(u8);
 	}
 
+#if CONFIG_IS_ENABLED(DECOMP_PARALLEL)
+	if (block_size && !ulz4fn_parallel(src, srcn, in, has_block_checksum,
+					   block_size, dst, &capacity)) {
+		*dstn = capacity;
+		return 0;
+	}
+#endif
+
 	while (1) {
 		struct lz4_block_header b;
 
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Copyright (C) 2017-2020 Alibaba Group Holding Limited
+ */
+
+#include <common.h>
+#include <decomp_parallel.h>
+#include <malloc.h>
+#include <zstd.h>
+#include <linux/errno.h>
+#include <linux/zstd.h>
+
+static int zstd_errno(size_t code)
+{
+	switch (ZSTD_getErrorCode(code)) {
+	case ZSTD_error_prefix_unknown:
+	case ZSTD_error_version_unsupported:
+	case ZSTD_error_frameParameter_unsupported:
+	case ZSTD_error_frameParameter_unsupportedBy32bits:
+	case ZSTD_error_frameParameter_windowTooLarge:
+		return -EPROTONOSUPPORT;
+	case ZSTD_error_memory_allocation:
+		return -ENOMEM;
+	case ZSTD_error_dstSize_tooSmall:
+		return -ENOBUFS;
+	case ZSTD_error_srcSize_wrong:
+		return -EINVAL;
+	default:
+		return -EPROTO;
+	}
+}
+
+#if CONFIG_IS_ENABLED(DECOMP_PARALLEL)
+static long uzstd_decode_frame(void *ctx, struct decomp_chunk *chunk)
+{
+	size_t ret;
+
+	ret = ZSTD_decompressDCtx(ctx, chunk->dst, chunk->dstn, chunk->src,
+				  chunk->srcn);
+
+	return ZSTD_isError(ret) ? zstd_errno(ret) : ret;
+}
+
+/*
+ * Split the input at frame boundaries, placing the output of each frame
+ * after that of the previous one according to the content size recorded
+ * in its header. Skippable and empty frames are left out. Returns the
+ * number of frames, filling in @chunks if not NULL, or -ve if the data
+ * cannot be split up front.
+ */
+static int uzstd_split(const void *src, size_t srcn, void *dst, size_t dstn,
+		       struct decomp_chunk *chunks)
+{
+	unsigned long long usize;
+	size_t csize, out = 0;
+	int count = 0;
+
+	while (srcn) {
+		csize = ZSTD_findFrameCompressedSize(src, srcn);
+		if (ZSTD_isError(csize) || csize > srcn)
+			return -EINVAL;
+		usize = ZSTD_getFrameContentSize(src, srcn);
+		if (usize >= ZSTD_CONTENTSIZE_ERROR)
+			return -ENOENT;
+		if (usize > dstn - out)
+			return -ENOBUFS;
+
+		if (usize) {
+			if (chunks) {
+				chunks[count].src = src;
+				chunks[count].srcn = csize;
+				chunks[count].dst = dst + out;
+				chunks[count].dstn = usize;
+			}
+			count++;
+		}
+		src += csize;
+		srcn -= csize;
+		out += usize;
+	}
+
+	return count;
+}
+
+/*
+ * Decompress each frame on its own hart. Returns 0 if all went well, or
+ * -ve to have the caller decode the whole input front to back, which also
+ * produces the proper error for damaged data.
+ */
+static int uzstd_parallel(const void *src, size_t srcn, void *dst,
+			  size_t *dstn)
+{
+	void *workspace[CONFIG_NR_CPUS];
+	void *ctxs[CONFIG_NR_CPUS];
+	struct decomp_chunk *chunks;
+	int count, nctx, i, ret = 0;
+	size_t wsize;
+
+	if (!decomp_parallel_safe(src, srcn, dst, *dstn))
+		return -EINVAL;
+	count = uzstd_split(src, srcn, dst, *dstn, NULL);
+	if (count < 2)
+		return -ENOENT;
+
+	chunks = calloc(count, sizeof(*chunks));
+	if (!chunks)
+		return -ENOMEM;
+	uzstd_split(src, srcn, dst, *dstn, chunks);
+
+	/* One context per hart, as many as the heap has room for */
+	wsize = ZSTD_DCtxWorkspaceBound();
+	for (nctx = 0; nctx < min(count, CONFIG_NR_CPUS); nctx++) {
+		workspace[nctx] = malloc(wsize);
+		if (!workspace[nctx])
+			break;
+		ctxs[nctx] = ZSTD_initDCtx(workspace[nctx], wsize);
+		if (!ctxs[nctx]) {
+			free(workspace[nctx]);
+			break;
+		}
+	}
+	if (nctx < 2) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	decomp_parallel(chunks, count, uzstd_decode_frame, ctxs, nctx);
+
+	for (i = 0; i < count; i++) {
+		if (chunks[i].ret != chunks[i].dstn) {
+			debug("%s: frame %d: %ld\n", __func__, i, chunks[i].ret);
+			ret = -EPROTO;
+			goto out;
+		}
+	}
+	*dstn = chunks[count - 1].dst + chunks[count - 1].dstn - dst;
+
+out:
+	while (nctx--)
+		free(workspace[nctx]);
+	free(chunks);
+
+	return ret;
+}
+#endif
+
+int uzstd(const void *src, size_t srcn, void *dst, size_t *dstn)
+{
+	ZSTD_DCtx *dctx;
+	void *workspace;
+	size_t wsize;
+	size_t ret;
+	int err = 0;
+
+#if CONFIG_IS_ENABLED(DECOMP_PARALLEL)
+	if (!uzstd_parallel(src, srcn, dst, dstn))
+		return 0;
+#endif
+
+	wsize = ZSTD_DCtxWorkspaceBound();
+	workspace = malloc(wsize);
+	if (!workspace) {
+		debug("%s: cannot allocate %zu byte workspace\n", __func__,
+		      wsize);
+		return -ENOMEM;
+	}
+
+	dctx = ZSTD_initDCtx(workspace, wsize);
+	if (!dctx) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	/*
+	 * The frame decoder references earlier output in place, so with
+	 * the whole image resident this decodes straight into @dst; the
+	 * streaming API would stage every block through its own window
+	 * buffer and copy it out again.
+	 */
+	ret = ZSTD_decompressDCtx(dctx, dst, *dstn, src, srcn);
+	if (ZSTD_isError(ret)) {
+		err = zstd_errno(ret);
+		debug("%s: error %d\n", __func__, ZSTD_getErrorCode(ret));
+		/* Let callers tell an oversize image from a corrupt one */
+		if (err != -ENOBUFS)
+			*dstn = 0;
+		goto out;
+	}
+	*dstn = ret;
+
+out:
+	free(workspace);
+
+	return err;
+}
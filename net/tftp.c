@@ -8,6 +8,7 @@
 
 #include <common.h>
 #include <command.h>
+#include <div64.h>
 #include <efi_loader.h>
 #include <env.h>
 #include <mapmem.h>
@@ -138,8 +139,39 @@ static char tftp_filename[MAX_LEN];
 #define TFTP_MTU_BLOCKSIZE 1468
 #endif
 
+/*
+ * Largest block the receive path can hold: the UDP payload of a single
+ * frame, or of a reassembled datagram when IP fragments are put back
+ * together. RFC 2348 caps the option at 65464 in any case.
+ */
+#ifdef CONFIG_IP_DEFRAG
+#ifndef CONFIG_NET_MAXDEFRAG
+#define CONFIG_NET_MAXDEFRAG 16384
+#endif
+#define TFTP_MAX_BLOCKSIZE \
+	min_t(unsigned int, CONFIG_NET_MAXDEFRAG - IP_UDP_HDR_SIZE - 4, 65464)
+#else
+#define TFTP_MAX_BLOCKSIZE 1468
+#endif
+
+#ifdef CONFIG_TFTP_WINDOWSIZE
+#define TFTP_WINDOWSIZE CONFIG_TFTP_WINDOWSIZE
+#else
+#define TFTP_WINDOWSIZE 1
+#endif
+
 static unsigned short tftp_block_size = TFTP_BLOCK_SIZE;
 static unsigned short tftp_block_size_option = TFTP_MTU_BLOCKSIZE;
+/* RFC 7440 window: blocks the server sends per acknowledgement */
+static unsigned short tftp_windowsize = 1;
+static unsigned short tftp_windowsize_option = TFTP_WINDOWSIZE;
+/* blocks received in sequence since our last acknowledgement */
+static unsigned short tftp_window_pos;
+/* 1 if the current gap in the sequence has already been reported */
+static int	tftp_gap_acked;
+/* transfer statistics for the summary line */
+static ulong	tftp_timeouts;
+static ulong	tftp_dropped;
 
 static inline int store_block(int block, uchar *src, unsigned int len)
 {
@@ -200,6 +232,8 @@ static void new_transfer(void)
 	tftp_prev_block = 0;
 	tftp_block_wrap = 0;
 	tftp_block_wrap_offset = 0;
+	tftp_window_pos = 0;
+	tftp_gap_acked = 0;
 #ifdef CONFIG_CMD_TFTPPUT
 	tftp_put_final_block_sent = 0;
 #endif
@@ -304,8 +338,14 @@ static void tftp_complete(void)
 	time_start = get_timer(time_start);
 	if (time_start > 0) {
 		puts("\n\t ");	/* Line up with "Loading: " */
-		print_size(net_boot_file_size /
-			time_start * 1000, "/s");
+		print_size(lldiv((u64)net_boot_file_size * 1000, time_start),
+			   "/s");
+		printf(" in %lu ms (blksize %u, windowsize %u", time_start,
+		       tftp_block_size, tftp_windowsize);
+		if (tftp_timeouts || tftp_dropped)
+			printf(", %lu timeouts, %lu blocks dropped",
+			       tftp_timeouts, tftp_dropped);
+		putc(')');
 	}
 	puts("\ndone\n");
 	net_set_state(NETLOOP_SUCCESS);
@@ -352,6 +392,10 @@ static void tftp_send(void)
 		/* try for more effic. blk size */
 		pkt += sprintf((char *)pkt, "blksize%c%d%c",
 				0, tftp_block_size_option, 0);
+		/* and for more than one block in flight per ACK */
+		if (tftp_state == STATE_SEND_RRQ && tftp_windowsize_option > 1)
+			pkt += sprintf((char *)pkt, "windowsize%c%d%c",
+					0, tftp_windowsize_option, 0);
 		len = pkt - xp;
 		break;
 
@@ -496,6 +540,15 @@ static void tftp_handler(uchar *pkt, unsigned dest, struct in_addr sip,
 				debug("Blocksize ack: %s, %d\n",
 				      (char *)pkt + i + 8, tftp_block_size);
 			}
+			if (strcmp((char *)pkt + i, "windowsize") == 0) {
+				tftp_windowsize = (unsigned short)
+					simple_strtoul((char *)pkt + i + 11,
+						       NULL, 10);
+				if (!tftp_windowsize)
+					tftp_windowsize = 1;
+				debug("Windowsize ack: %s, %d\n",
+				      (char *)pkt + i + 11, tftp_windowsize);
+			}
 #ifdef CONFIG_TFTP_TSIZE
 			if (strcmp((char *)pkt+i, "tsize") == 0) {
 				tftp_tsize = simple_strtoul((char *)pkt + i + 6,
@@ -520,8 +573,6 @@ static void tftp_handler(uchar *pkt, unsigned dest, struct in_addr sip,
 		len -= 2;
 		tftp_cur_block = ntohs(*(__be16 *)pkt);
 
-		update_block_number();
-
 		if (tftp_state == STATE_SEND_RRQ)
 			debug("Server did not acknowledge timeout option!\n");
 
@@ -542,15 +593,32 @@ static void tftp_handler(uchar *pkt, unsigned dest, struct in_addr sip,
 			}
 		}
 
-		if (tftp_cur_block == tftp_prev_block) {
-			/* Same block again; ignore it. */
+		if (tftp_cur_block != (unsigned short)(tftp_prev_block + 1)) {
+			/*
+			 * Duplicate or out-of-order block; drop it. The first
+			 * time a gap shows up, re-ACK the last block we got in
+			 * sequence so that the server restarts its window
+			 * from the missing one (RFC 7440 section 4) rather
+			 * than waiting for our timeout.
+			 */
+			tftp_dropped++;
+			tftp_cur_block = tftp_prev_block;
+			if (!tftp_gap_acked) {
+				tftp_gap_acked = 1;
+				tftp_window_pos = 0;
+				tftp_send();
+			}
 			break;
 		}
 
+		update_block_number();
+
 		tftp_prev_block = tftp_cur_block;
+		tftp_gap_acked = 0;
 		timeout_count_max = tftp_timeout_count_max;
 		net_set_timeout_handler(timeout_ms, tftp_timeout_handler);
 
+		/* Payload goes straight from the Rx buffer to its final place */
 		if (store_block(tftp_cur_block - 1, pkt + 2, len)) {
 			eth_halt();
 			net_set_state(NETLOOP_FAIL);
@@ -558,10 +626,15 @@ static void tftp_handler(uchar *pkt, unsigned dest, struct in_addr sip,
 		}
 
 		/*
-		 *	Acknowledge the block just received, which will prompt
-		 *	the remote for the next one.
+		 *	Acknowledge the last block of each window, or the short
+		 *	block ending the file, which will prompt the remote for
+		 *	the next window.
 		 */
-		tftp_send();
+		if (++tftp_window_pos >= tftp_windowsize ||
+		    len < tftp_block_size) {
+			tftp_window_pos = 0;
+			tftp_send();
+		}
 
 		if (len < tftp_block_size)
 			tftp_complete();
@@ -599,7 +672,10 @@ static void tftp_timeout_handler(void)
 		restart("Retry count exceeded");
 	} else {
 		puts("T ");
+		tftp_timeouts++;
 		net_set_timeout_handler(timeout_ms, tftp_timeout_handler);
+		/* The server restarts its window after our ACK */
+		tftp_window_pos = 0;
 		if (tftp_state != STATE_RECV_WRQ)
 			tftp_send();
 	}
@@ -638,6 +714,10 @@ void tftp_start(enum proto_t protocol)
 	if (ep != NULL)
 		tftp_block_size_option = simple_strtol(ep, NULL, 10);
 
+	ep = env_get("tftpwindowsize");
+	if (ep != NULL)
+		tftp_windowsize_option = simple_strtol(ep, NULL, 10);
+
 	ep = env_get("tftptimeout");
 	if (ep != NULL)
 		timeout_ms = simple_strtol(ep, NULL, 10);
@@ -659,8 +739,16 @@ void tftp_start(enum proto_t protocol)
 	}
 #endif
 
-	debug("TFTP blocksize = %i, timeout = %ld ms\n",
-	      tftp_block_size_option, timeout_ms);
+	if (tftp_block_size_option > TFTP_MAX_BLOCKSIZE) {
+		printf("TFTP blocksize (%u) too large, set max = %u\n",
+		       tftp_block_size_option, TFTP_MAX_BLOCKSIZE);
+		tftp_block_size_option = TFTP_MAX_BLOCKSIZE;
+	}
+	if (!tftp_windowsize_option)
+		tftp_windowsize_option = 1;
+
+	debug("TFTP blocksize = %i, windowsize = %i, timeout = %ld ms\n",
+	      tftp_block_size_option, tftp_windowsize_option, timeout_ms);
 
 	tftp_remote_ip = net_server_ip;
 	if (!net_parse_bootfile(&tftp_remote_ip, tftp_filename, MAX_LEN)) {
@@ -759,8 +847,11 @@ void tftp_start(enum proto_t protocol)
 
 	/* zero out server ether in case the server ip has changed */
 	memset(net_server_ethaddr, 0, 6);
-	/* Revert tftp_block_size to dflt */
+	/* Revert tftp_block_size and tftp_windowsize to dflt */
 	tftp_block_size = TFTP_BLOCK_SIZE;
+	tftp_windowsize = 1;
+	tftp_timeouts = 0;
+	tftp_dropped = 0;
 #ifdef CONFIG_TFTP_TSIZE
 	tftp_tsize = 0;
 	tftp_tsize_num_hash = 0;
@@ -791,8 +882,11 @@ void tftp_start_server(void)
 	timeout_ms = TIMEOUT;
 	net_set_timeout_handler(timeout_ms, tftp_timeout_handler);
 
-	/* Revert tftp_block_size to dflt */
+	/* Revert tftp_block_size and tftp_windowsize to dflt */
 	tftp_block_size = TFTP_BLOCK_SIZE;
+	tftp_windowsize = 1;
+	tftp_timeouts = 0;
+	tftp_dropped = 0;
 	tftp_cur_block = 0;
 	tftp_our_port = WELL_KNOWN_PORT;
 
@@ -123,3 +123,22 @@ static int env_test_htab_deletes(struct unit_test_state *uts)
 }
 
 ENV_TEST(env_test_htab_deletes, 0);
+
+/* Enter more elements than the table was created for */
+static int env_test_htab_grow(struct unit_test_state *uts)
+{
+	struct hsearch_data htab;
+
+	memset(&htab, 0, sizeof(htab));
+	ut_asserteq(1, hcreate_r(SIZE, &htab));
+
+	ut_assertok(htab_fill(uts, &htab, SIZE * 8));
+	ut_assertok(htab_check_fill(uts, &htab, SIZE * 8));
+	ut_asserteq(SIZE * 8, htab.filled);
+	ut_assert(htab.size > SIZE * 8);
+
+	hdestroy_r(&htab);
+	return 0;
+}
+
+ENV_TEST(env_test_htab_grow, 0);